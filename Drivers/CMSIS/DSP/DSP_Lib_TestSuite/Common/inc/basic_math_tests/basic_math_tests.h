@@ -13,5 +13,8 @@ JTEST_DECLARE_GROUP(offset_tests);
 JTEST_DECLARE_GROUP(scale_tests);
 JTEST_DECLARE_GROUP(shift_tests);
 JTEST_DECLARE_GROUP(sub_tests);
+JTEST_DECLARE_GROUP(clamp_tests);
+JTEST_DECLARE_GROUP(compare_tests);
+JTEST_DECLARE_GROUP(fma_tests);
 
 #endif /* _BASIC_MATH_TESTS_H_ */
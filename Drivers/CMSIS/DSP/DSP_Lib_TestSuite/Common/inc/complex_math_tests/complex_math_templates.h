@@ -162,6 +162,14 @@
 #define REF_cmplx_mult_real_INPUT_INTERFACE(input_a, input_b, block_size) \
     PAREN(input_a, input_b, complex_math_output_ref_a.data_ptr, block_size)
 
+#define ARM_cmplx_to_polar_INPUT_INTERFACE(input, block_size)          \
+    PAREN(input, complex_math_output_fut_a.data_ptr,                    \
+          complex_math_output_fut_b.data_ptr, block_size)
+
+#define REF_cmplx_to_polar_INPUT_INTERFACE(input, block_size)          \
+    PAREN(input, complex_math_output_ref_a.data_ptr,                    \
+          complex_math_output_ref_b.data_ptr, block_size)
+
 /*--------------------------------------------------------------------------------*/
 /* Test Templates */
 /*--------------------------------------------------------------------------------*/
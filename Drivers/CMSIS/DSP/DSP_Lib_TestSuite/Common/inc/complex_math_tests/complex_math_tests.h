@@ -7,8 +7,10 @@
 JTEST_DECLARE_GROUP(cmplx_conj_tests);
 JTEST_DECLARE_GROUP(cmplx_dot_prod_tests);
 JTEST_DECLARE_GROUP(cmplx_mag_tests);
+JTEST_DECLARE_GROUP(cmplx_mag_approx_tests);
 JTEST_DECLARE_GROUP(cmplx_mag_squared_tests);
 JTEST_DECLARE_GROUP(cmplx_mult_cmplx_tests);
 JTEST_DECLARE_GROUP(cmplx_mult_real_tests);
+JTEST_DECLARE_GROUP(cmplx_to_polar_tests);
 
 #endif /* _COMPLEX_MATH_TESTS_H_ */
@@ -7,5 +7,10 @@
 JTEST_DECLARE_GROUP(pid_reset_tests);
 JTEST_DECLARE_GROUP(sin_cos_tests);
 JTEST_DECLARE_GROUP(pid_tests);
+JTEST_DECLARE_GROUP(pid_ext_tests);
+JTEST_DECLARE_GROUP(comp_tests);
+JTEST_DECLARE_GROUP(foc_tests);
+JTEST_DECLARE_GROUP(kalman_tests);
+JTEST_DECLARE_GROUP(pll_tests);
 
 #endif /* _CONTROLLER_TESTS_H_ */
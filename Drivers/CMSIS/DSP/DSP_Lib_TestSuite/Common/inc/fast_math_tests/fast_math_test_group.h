@@ -5,5 +5,11 @@
 /* Declare Test Groups */
 /*--------------------------------------------------------------------------------*/
 JTEST_DECLARE_GROUP(fast_math_tests);
+JTEST_DECLARE_GROUP(fast_math_block_tests);
+JTEST_DECLARE_GROUP(fast_math_sincos_tests);
+JTEST_DECLARE_GROUP(fast_math_divide_tests);
+JTEST_DECLARE_GROUP(fast_math_nco_tests);
+JTEST_DECLARE_GROUP(fast_math_interp_tests);
+JTEST_DECLARE_GROUP(fast_math_resize_tests);
 
 #endif /* _FAST_MATH_TEST_GROUP_H_ */
@@ -8,6 +8,7 @@ JTEST_DECLARE_GROUP(mat_add_tests);
 JTEST_DECLARE_GROUP(mat_cmplx_mult_tests);
 JTEST_DECLARE_GROUP(mat_init_tests);
 JTEST_DECLARE_GROUP(mat_inverse_tests);
+JTEST_DECLARE_GROUP(mat_polyfit_tests);
 JTEST_DECLARE_GROUP(mat_mult_tests);
 JTEST_DECLARE_GROUP(mat_mult_fast_tests);
 JTEST_DECLARE_GROUP(mat_sub_tests);
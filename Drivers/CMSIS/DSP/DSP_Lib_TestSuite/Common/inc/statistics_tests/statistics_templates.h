@@ -35,6 +35,7 @@
 #define STATISTICS_SNR_THRESHOLD_q31_t 100
 #define STATISTICS_SNR_THRESHOLD_q15_t 60
 #define STATISTICS_SNR_THRESHOLD_q7_t 30
+#define STATISTICS_SNR_THRESHOLD_f32_t STATISTICS_SNR_THRESHOLD_float32_t
 
 /**
  *  Compare reference and fut outputs using SNR.
@@ -58,6 +59,87 @@
 
 
 
+/*
+ * Largest difference between the reference and fut fields of the
+ * arm_stats_result_xxx structures that is accepted without checking the SNR.
+ * The fixed-point variance of nearly constant inputs is only a few LSBs, where
+ * the SNR of a single value is meaningless.
+ */
+#define STATS_MAX_DELTA_f32 0.0f
+#define STATS_MAX_DELTA_q31 4.0f
+#define STATS_MAX_DELTA_q15 2.0f
+#define STATS_MAX_DELTA_q7  1.0f
+
+#define STATS_ABS(x) ((x) > 0 ? (x) : -(x))
+
+/**
+ *  Compare one field of the reference and fut arm_stats_result_xxx structures
+ *  using SNR.
+ */
+#define STATS_FIELD_SNR_COMPARE_INTERFACE(suffix, field, threshold)     \
+    do                                                                  \
+    {                                                                   \
+        statistics_output_f32_ref[0] = (float32_t)                      \
+            ((arm_stats_result_##suffix *)                              \
+             statistics_output_ref.data_ptr)->field;                    \
+        statistics_output_f32_fut[0] = (float32_t)                      \
+            ((arm_stats_result_##suffix *)                              \
+             statistics_output_fut.data_ptr)->field;                    \
+        if (STATS_ABS(statistics_output_f32_ref[0] -                    \
+                      statistics_output_f32_fut[0]) >                   \
+            STATS_MAX_DELTA_##suffix)                                   \
+        {                                                               \
+            TEST_ASSERT_SNR(                                            \
+                statistics_output_f32_ref,                              \
+                statistics_output_f32_fut,                              \
+                1,                                                      \
+                threshold);                                             \
+        }                                                               \
+    } while (0)
+
+/**
+ *  Compare an index field of the reference and fut arm_stats_result_xxx
+ *  structures.
+ */
+#define STATS_FIELD_EQUAL_INTERFACE(suffix, field)                      \
+    TEST_ASSERT_EQUAL(                                                  \
+        ((arm_stats_result_##suffix *)                                  \
+         statistics_output_ref.data_ptr)->field,                        \
+        ((arm_stats_result_##suffix *)                                  \
+         statistics_output_fut.data_ptr)->field)
+
+/**
+ *  Compare all the fields of the reference and fut arm_stats_result_xxx
+ *  structures stored in statistics_output_ref and statistics_output_fut.
+ */
+#define STATS_COMPARE_INTERFACE(suffix)                                 \
+    do                                                                  \
+    {                                                                   \
+        STATS_FIELD_SNR_COMPARE_INTERFACE(                              \
+            suffix, mean,                                               \
+            STATISTICS_SNR_THRESHOLD_##suffix##_t);                     \
+        STATS_FIELD_SNR_COMPARE_INTERFACE(                              \
+            suffix, var,                                                \
+            STATISTICS_SNR_THRESHOLD_##suffix##_t);                     \
+        STATS_FIELD_SNR_COMPARE_INTERFACE(                              \
+            suffix, std,                                                \
+            STATISTICS_SNR_THRESHOLD_##suffix##_t);                     \
+        STATS_FIELD_SNR_COMPARE_INTERFACE(                              \
+            suffix, rms,                                                \
+            STATISTICS_SNR_THRESHOLD_##suffix##_t);                     \
+        STATS_FIELD_SNR_COMPARE_INTERFACE(                              \
+            suffix, power,                                              \
+            STATISTICS_SNR_THRESHOLD_##suffix##_t);                     \
+        STATS_FIELD_SNR_COMPARE_INTERFACE(                              \
+            suffix, min,                                                \
+            STATISTICS_SNR_THRESHOLD_##suffix##_t);                     \
+        STATS_FIELD_SNR_COMPARE_INTERFACE(                              \
+            suffix, max,                                                \
+            STATISTICS_SNR_THRESHOLD_##suffix##_t);                     \
+        STATS_FIELD_EQUAL_INTERFACE(suffix, minIndex);                  \
+        STATS_FIELD_EQUAL_INTERFACE(suffix, maxIndex);                  \
+    } while (0)
+
 /*--------------------------------------------------------------------------------*/
 /* Input Interfaces */
 /*--------------------------------------------------------------------------------*/
@@ -122,6 +204,14 @@
 #define REF_var_INPUT_INTERFACE(input, block_size)              \
     PAREN(input, block_size, statistics_output_ref.data_ptr)
 
+#define ARM_stats_INPUT_INTERFACE(input, block_size)            \
+    PAREN(input, block_size, ARM_STATS_ALL,                     \
+          statistics_output_fut.data_ptr)
+
+#define REF_stats_INPUT_INTERFACE(input, block_size)            \
+    PAREN(input, block_size, ARM_STATS_ALL,                     \
+          statistics_output_ref.data_ptr)
+
 
 /*--------------------------------------------------------------------------------*/
 /* Test Templates */
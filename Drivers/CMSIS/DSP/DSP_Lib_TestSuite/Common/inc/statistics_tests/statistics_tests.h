@@ -11,5 +11,11 @@ JTEST_DECLARE_GROUP(power_tests);
 JTEST_DECLARE_GROUP(rms_tests);
 JTEST_DECLARE_GROUP(std_tests);
 JTEST_DECLARE_GROUP(var_tests);
+JTEST_DECLARE_GROUP(stats_tests);
+JTEST_DECLARE_GROUP(stats_acc_tests);
+JTEST_DECLARE_GROUP(envelope_tests);
+JTEST_DECLARE_GROUP(histogram_tests);
+JTEST_DECLARE_GROUP(select_tests);
+JTEST_DECLARE_GROUP(topk_tests);
 
 #endif /* _STATISTICS_TESTS_H_ */
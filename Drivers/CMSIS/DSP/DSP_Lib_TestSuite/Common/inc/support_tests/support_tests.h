@@ -7,5 +7,7 @@
 JTEST_DECLARE_GROUP(copy_tests);
 JTEST_DECLARE_GROUP(fill_tests);
 JTEST_DECLARE_GROUP(x_to_y_tests);
+JTEST_DECLARE_GROUP(quant_tests);
+JTEST_DECLARE_GROUP(interleave_tests);
 
 #endif /* _SUPPORT_TESTS_H_ */
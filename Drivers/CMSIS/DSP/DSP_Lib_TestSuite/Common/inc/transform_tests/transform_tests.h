@@ -9,5 +9,8 @@ JTEST_DECLARE_GROUP(cfft_family_tests);
 JTEST_DECLARE_GROUP(dct4_tests);
 JTEST_DECLARE_GROUP(rfft_tests);
 JTEST_DECLARE_GROUP(rfft_fast_tests);
+JTEST_DECLARE_GROUP(spectral_peaks_tests);
+JTEST_DECLARE_GROUP(window_tests);
+JTEST_DECLARE_GROUP(welch_tests);
 
 #endif /* _TRANSFORM_TESTS_H_ */
@@ -12,6 +12,9 @@ JTEST_DEFINE_GROUP(basic_math_tests)
     JTEST_GROUP_CALL(scale_tests); 
     JTEST_GROUP_CALL(shift_tests);
     JTEST_GROUP_CALL(sub_tests);
+    JTEST_GROUP_CALL(clamp_tests);
+    JTEST_GROUP_CALL(compare_tests);
+    JTEST_GROUP_CALL(fma_tests);
 
     return;
 }
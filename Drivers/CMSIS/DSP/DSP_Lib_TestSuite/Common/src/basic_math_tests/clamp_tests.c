@@ -0,0 +1,75 @@
+#include "jtest.h"
+#include "basic_math_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "basic_math_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Parameters */
+/*--------------------------------------------------------------------------------*/
+
+/* Ranges, narrower than the inputs so that both bounds are hit */
+#define CLAMP_LOW_f32   (-1.0f)
+#define CLAMP_HIGH_f32  (2.0f)
+#define CLAMP_LOW_q31   ((q31_t) 0xC0000000)
+#define CLAMP_HIGH_q31  ((q31_t) 0x20000000)
+#define CLAMP_LOW_q15   ((q15_t) 0xC000)
+#define CLAMP_HIGH_q15  ((q15_t) 0x2000)
+#define CLAMP_LOW_q7    ((q7_t) 0xC0)
+#define CLAMP_HIGH_q7   ((q7_t) 0x20)
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+#define JTEST_ARM_CLAMP_TEST(suffix)                                     \
+    JTEST_DEFINE_TEST(arm_clamp_##suffix##_test,                         \
+                      arm_clamp_##suffix)                                \
+    {                                                                   \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            input_idx, ARR_DESC_t *, input_ptr, basic_math_f_all        \
+            ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                block_size_idx, uint32_t, block_size,                   \
+                basic_math_block_sizes                                  \
+                ,                                                       \
+                TEST_DO_VALID_BLOCKSIZE(                                \
+                    block_size, TYPE_FROM_ABBREV(suffix), input_ptr     \
+                    ,                                                   \
+                    JTEST_COUNT_CYCLES(                                 \
+                        arm_clamp_##suffix(                              \
+                            (TYPE_FROM_ABBREV(suffix) *) input_ptr->data_ptr, \
+                            basic_math_output_fut.data_ptr,             \
+                            CLAMP_LOW_##suffix, CLAMP_HIGH_##suffix,      \
+                            block_size));                               \
+                    ref_clamp_##suffix(                                  \
+                        (TYPE_FROM_ABBREV(suffix) *) input_ptr->data_ptr, \
+                        basic_math_output_ref.data_ptr,                 \
+                        CLAMP_LOW_##suffix, CLAMP_HIGH_##suffix,          \
+                        block_size);                                    \
+                                                                        \
+                    BASIC_MATH_COMPARE_INTERFACE(                       \
+                        block_size, TYPE_FROM_ABBREV(suffix)))));       \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_CLAMP_TEST(f32);
+JTEST_ARM_CLAMP_TEST(q31);
+JTEST_ARM_CLAMP_TEST(q15);
+JTEST_ARM_CLAMP_TEST(q7);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(clamp_tests)
+{
+    JTEST_TEST_CALL(arm_clamp_f32_test);
+    JTEST_TEST_CALL(arm_clamp_q31_test);
+    JTEST_TEST_CALL(arm_clamp_q15_test);
+    JTEST_TEST_CALL(arm_clamp_q7_test);
+}
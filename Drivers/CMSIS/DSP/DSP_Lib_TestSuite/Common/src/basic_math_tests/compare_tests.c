@@ -0,0 +1,165 @@
+#include "jtest.h"
+#include "basic_math_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "basic_math_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Parameters */
+/*--------------------------------------------------------------------------------*/
+
+static float32_t compare_input_b[BASIC_MATH_MAX_INPUT_ELEMENTS];
+static uint8_t compare_mask[BASIC_MATH_MAX_INPUT_ELEMENTS];
+
+/* Masks for the blend tests, with non-zero values other than 0xFF */
+static const uint8_t compare_mask_pattern[8] =
+{
+    0x00, 0x01, 0x80, 0xFF, 0x00, 0x7F, 0x00, 0x10
+};
+
+/*
+  The second input is the first one reversed, except every fourth element which
+  is kept, so that all the outcomes of the comparisons occur.
+*/
+#define COMPARE_MAKE_INPUT_B(suffix)                                    \
+    static TYPE_FROM_ABBREV(suffix) * compare_make_input_b_##suffix(    \
+        TYPE_FROM_ABBREV(suffix) * pSrcA,                               \
+        uint32_t blockSize)                                             \
+    {                                                                   \
+        TYPE_FROM_ABBREV(suffix) * pSrcB =                              \
+            (TYPE_FROM_ABBREV(suffix) *) compare_input_b;               \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0; i < blockSize; i++)                                 \
+        {                                                               \
+            pSrcB[i] = ((i % 4) == 0) ? pSrcA[i] : pSrcA[blockSize - 1 - i]; \
+        }                                                               \
+                                                                        \
+        return pSrcB;                                                   \
+    }
+
+COMPARE_MAKE_INPUT_B(f32)
+COMPARE_MAKE_INPUT_B(q31)
+COMPARE_MAKE_INPUT_B(q15)
+COMPARE_MAKE_INPUT_B(q7)
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Shared loops over the inputs and the block sizes.  pSrcA and pSrcB are the
+  two inputs of the body.
+*/
+#define COMPARE_DO_INPUTS(suffix, body)                                 \
+    TEMPLATE_DO_ARR_DESC(                                               \
+        input_idx, ARR_DESC_t *, input_ptr, basic_math_f_all            \
+        ,                                                               \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            block_size_idx, uint32_t, block_size,                       \
+            basic_math_block_sizes                                      \
+            ,                                                           \
+            TEST_DO_VALID_BLOCKSIZE(                                    \
+                block_size, TYPE_FROM_ABBREV(suffix), input_ptr         \
+                ,                                                       \
+                pSrcA = (TYPE_FROM_ABBREV(suffix) *) input_ptr->data_ptr; \
+                pSrcB = compare_make_input_b_##suffix(pSrcA, block_size); \
+                body)))
+
+/*
+  Every operator is tested, for vector and threshold comparisons.  The
+  threshold is an element of the input, so that the equal outcome occurs.
+*/
+#define JTEST_ARM_COMPARE_TEST(suffix)                                  \
+    JTEST_DEFINE_TEST(arm_compare_##suffix##_test,                      \
+                      arm_compare_##suffix)                             \
+    {                                                                   \
+        TYPE_FROM_ABBREV(suffix) * pSrcA;                               \
+        TYPE_FROM_ABBREV(suffix) * pSrcB;                               \
+        int32_t op;                                                     \
+                                                                        \
+        for (op = ARM_CMP_LT; op <= ARM_CMP_GE; op++)                   \
+        {                                                               \
+            JTEST_DUMP_STRF("Operator: %d\n", (int) op);                \
+            COMPARE_DO_INPUTS(                                          \
+                suffix,                                                 \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_compare_##suffix(                               \
+                        pSrcA, pSrcB, (arm_compare_op) op,              \
+                        basic_math_output_fut.data_ptr, block_size));   \
+                ref_compare_##suffix(                                   \
+                    pSrcA, pSrcB, (arm_compare_op) op,                  \
+                    basic_math_output_ref.data_ptr, block_size);        \
+                                                                        \
+                BASIC_MATH_COMPARE_INTERFACE(block_size, uint8_t);      \
+                                                                        \
+                arm_threshold_##suffix(                                 \
+                    pSrcA, pSrcA[block_size / 2], (arm_compare_op) op,  \
+                    basic_math_output_fut.data_ptr, block_size);        \
+                ref_threshold_##suffix(                                 \
+                    pSrcA, pSrcA[block_size / 2], (arm_compare_op) op,  \
+                    basic_math_output_ref.data_ptr, block_size);        \
+                                                                        \
+                BASIC_MATH_COMPARE_INTERFACE(block_size, uint8_t));     \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_COMPARE_TEST(f32);
+JTEST_ARM_COMPARE_TEST(q31);
+JTEST_ARM_COMPARE_TEST(q15);
+JTEST_ARM_COMPARE_TEST(q7);
+
+#define JTEST_ARM_BLEND_TEST(suffix)                                   \
+    JTEST_DEFINE_TEST(arm_blend_##suffix##_test,                       \
+                      arm_blend_##suffix)                              \
+    {                                                                   \
+        TYPE_FROM_ABBREV(suffix) * pSrcA;                               \
+        TYPE_FROM_ABBREV(suffix) * pSrcB;                               \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0; i < BASIC_MATH_MAX_INPUT_ELEMENTS; i++)             \
+        {                                                               \
+            compare_mask[i] = compare_mask_pattern[i % 8];              \
+        }                                                               \
+                                                                        \
+        COMPARE_DO_INPUTS(                                              \
+            suffix,                                                     \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_blend_##suffix(                                    \
+                    compare_mask, pSrcA, pSrcB,                         \
+                    basic_math_output_fut.data_ptr, block_size));       \
+            ref_blend_##suffix(                                        \
+                compare_mask, pSrcA, pSrcB,                             \
+                basic_math_output_ref.data_ptr, block_size);            \
+                                                                        \
+            BASIC_MATH_COMPARE_INTERFACE(                               \
+                block_size, TYPE_FROM_ABBREV(suffix)));                 \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_BLEND_TEST(f32);
+JTEST_ARM_BLEND_TEST(q31);
+JTEST_ARM_BLEND_TEST(q15);
+JTEST_ARM_BLEND_TEST(q7);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(compare_tests)
+{
+    JTEST_TEST_CALL(arm_compare_f32_test);
+    JTEST_TEST_CALL(arm_compare_q31_test);
+    JTEST_TEST_CALL(arm_compare_q15_test);
+    JTEST_TEST_CALL(arm_compare_q7_test);
+    JTEST_TEST_CALL(arm_blend_f32_test);
+    JTEST_TEST_CALL(arm_blend_q31_test);
+    JTEST_TEST_CALL(arm_blend_q15_test);
+    JTEST_TEST_CALL(arm_blend_q7_test);
+}
@@ -0,0 +1,236 @@
+#include "jtest.h"
+#include "basic_math_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "basic_math_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Parameters */
+/*--------------------------------------------------------------------------------*/
+
+#define FMA_SCALE_f32    (0.75f)
+#define FMA_OFFSET_f32   (-0.5f)
+#define FMA_SCALE_q31    ((q31_t) 0x60000000)
+#define FMA_OFFSET_q31   ((q31_t) 0x20000000)
+#define FMA_SCALE_q15    ((q15_t) 0x6000)
+#define FMA_OFFSET_q15   ((q15_t) 0x2000)
+#define FMA_SCALE_q7     ((q7_t) 0x60)
+#define FMA_OFFSET_q7    ((q7_t) 0x20)
+
+#define FMA_WEIGHT_A_f32 (0.3f)
+#define FMA_WEIGHT_B_f32 (-1.25f)
+#define FMA_WEIGHT_A_q31 ((q31_t) 0x50000000)
+#define FMA_WEIGHT_B_q31 ((q31_t) 0x80000000)
+#define FMA_WEIGHT_A_q15 ((q15_t) 0x5000)
+#define FMA_WEIGHT_B_q15 ((q15_t) 0x8000)
+#define FMA_WEIGHT_A_q7  ((q7_t) 0x50)
+#define FMA_WEIGHT_B_q7  ((q7_t) 0x80)
+
+static float32_t fma_input_b[BASIC_MATH_MAX_INPUT_ELEMENTS];
+
+/* The second input is the first one reversed */
+#define FMA_MAKE_INPUT_B(suffix)                                        \
+    static TYPE_FROM_ABBREV(suffix) * fma_make_input_b_##suffix(        \
+        TYPE_FROM_ABBREV(suffix) * pSrcA,                               \
+        uint32_t blockSize)                                             \
+    {                                                                   \
+        TYPE_FROM_ABBREV(suffix) * pSrcB =                              \
+            (TYPE_FROM_ABBREV(suffix) *) fma_input_b;                   \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0; i < blockSize; i++)                                 \
+        {                                                               \
+            pSrcB[i] = pSrcA[blockSize - 1 - i];                        \
+        }                                                               \
+                                                                        \
+        return pSrcB;                                                   \
+    }
+
+FMA_MAKE_INPUT_B(f32)
+FMA_MAKE_INPUT_B(q31)
+FMA_MAKE_INPUT_B(q15)
+FMA_MAKE_INPUT_B(q7)
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/* Expands the output type before it is pasted by the comparison interface */
+#define FMA_COMPARE(compare_interface, block_size, output_type)        \
+    compare_interface(block_size, output_type)
+
+/*
+  Shared loops over the inputs and the block sizes.  pSrcA and pSrcB are the
+  two inputs of the body.
+*/
+#define FMA_DO_INPUTS(suffix, body)                                     \
+    TEMPLATE_DO_ARR_DESC(                                               \
+        input_idx, ARR_DESC_t *, input_ptr, basic_math_f_all            \
+        ,                                                               \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            block_size_idx, uint32_t, block_size,                       \
+            basic_math_block_sizes                                      \
+            ,                                                           \
+            TEST_DO_VALID_BLOCKSIZE(                                    \
+                block_size, TYPE_FROM_ABBREV(suffix), input_ptr         \
+                ,                                                       \
+                pSrcA = (TYPE_FROM_ABBREV(suffix) *) input_ptr->data_ptr; \
+                pSrcB = fma_make_input_b_##suffix(pSrcA, block_size);   \
+                body)))
+
+/*
+  The fused scale and offset is compared with the reference, and its cycle
+  count with the one of arm_scale_xxx() followed by arm_offset_xxx().
+*/
+JTEST_DEFINE_TEST(arm_scale_offset_f32_test,
+                  arm_scale_offset_f32)
+{
+    float32_t * pSrcA;
+    float32_t * pSrcB;
+
+    FMA_DO_INPUTS(
+        f32,
+        JTEST_COUNT_CYCLES(
+            arm_scale_offset_f32(
+                pSrcA, FMA_SCALE_f32, FMA_OFFSET_f32,
+                basic_math_output_fut.data_ptr, block_size));
+        ref_scale_offset_f32(
+            pSrcA, FMA_SCALE_f32, FMA_OFFSET_f32,
+            basic_math_output_ref.data_ptr, block_size);
+
+        JTEST_DUMP_STR("Separate functions:\n");
+        JTEST_COUNT_CYCLES(
+            arm_scale_f32(
+                pSrcB, FMA_SCALE_f32, (float32_t *) fma_input_b, block_size);
+            arm_offset_f32(
+                (float32_t *) fma_input_b, FMA_OFFSET_f32,
+                (float32_t *) fma_input_b, block_size));
+
+        BASIC_MATH_SNR_COMPARE_INTERFACE(block_size, float32_t));
+
+    return JTEST_TEST_PASSED;
+}
+
+#define JTEST_ARM_SCALE_OFFSET_TEST(suffix)                             \
+    JTEST_DEFINE_TEST(arm_scale_offset_##suffix##_test,                 \
+                      arm_scale_offset_##suffix)                        \
+    {                                                                   \
+        TYPE_FROM_ABBREV(suffix) * pSrcA;                               \
+        TYPE_FROM_ABBREV(suffix) * pSrcB;                               \
+                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            shift_idx, int8_t, shift, basic_math_elts2                  \
+            ,                                                           \
+            JTEST_DUMP_STRF("Shift: %d\n", (int) shift);                \
+            FMA_DO_INPUTS(                                              \
+                suffix,                                                 \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_scale_offset_##suffix(                          \
+                        pSrcA, FMA_SCALE_##suffix, shift,               \
+                        FMA_OFFSET_##suffix,                            \
+                        basic_math_output_fut.data_ptr, block_size));   \
+                ref_scale_offset_##suffix(                              \
+                    pSrcA, FMA_SCALE_##suffix, shift,                   \
+                    FMA_OFFSET_##suffix,                                \
+                    basic_math_output_ref.data_ptr, block_size);        \
+                                                                        \
+                JTEST_DUMP_STR("Separate functions:\n");                \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_scale_##suffix(                                 \
+                        pSrcB, FMA_SCALE_##suffix, shift, pSrcB,        \
+                        block_size);                                    \
+                    arm_offset_##suffix(                                \
+                        pSrcB, FMA_OFFSET_##suffix, pSrcB,              \
+                        block_size));                                   \
+                                                                        \
+                BASIC_MATH_COMPARE_INTERFACE(                           \
+                    block_size, TYPE_FROM_ABBREV(suffix))));            \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_SCALE_OFFSET_TEST(q31);
+JTEST_ARM_SCALE_OFFSET_TEST(q15);
+JTEST_ARM_SCALE_OFFSET_TEST(q7);
+
+/* D = A * B + A */
+#define JTEST_ARM_MULT_ADD_TEST(suffix, compare_interface)              \
+    JTEST_DEFINE_TEST(arm_mult_add_##suffix##_test,                     \
+                      arm_mult_add_##suffix)                            \
+    {                                                                   \
+        TYPE_FROM_ABBREV(suffix) * pSrcA;                               \
+        TYPE_FROM_ABBREV(suffix) * pSrcB;                               \
+                                                                        \
+        FMA_DO_INPUTS(                                                  \
+            suffix,                                                     \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_mult_add_##suffix(                                  \
+                    pSrcA, pSrcB, pSrcA,                                \
+                    basic_math_output_fut.data_ptr, block_size));       \
+            ref_mult_add_##suffix(                                      \
+                pSrcA, pSrcB, pSrcA,                                    \
+                basic_math_output_ref.data_ptr, block_size);            \
+                                                                        \
+            FMA_COMPARE(compare_interface, block_size,                  \
+                        TYPE_FROM_ABBREV(suffix)));                     \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_MULT_ADD_TEST(f32, BASIC_MATH_SNR_COMPARE_INTERFACE);
+JTEST_ARM_MULT_ADD_TEST(q31, BASIC_MATH_SNR_COMPARE_INTERFACE);
+JTEST_ARM_MULT_ADD_TEST(q15, BASIC_MATH_COMPARE_INTERFACE);
+JTEST_ARM_MULT_ADD_TEST(q7 , BASIC_MATH_COMPARE_INTERFACE);
+
+#define JTEST_ARM_WEIGHTED_SUM_TEST(suffix, compare_interface)          \
+    JTEST_DEFINE_TEST(arm_weighted_sum_##suffix##_test,                 \
+                      arm_weighted_sum_##suffix)                        \
+    {                                                                   \
+        TYPE_FROM_ABBREV(suffix) * pSrcA;                               \
+        TYPE_FROM_ABBREV(suffix) * pSrcB;                               \
+                                                                        \
+        FMA_DO_INPUTS(                                                  \
+            suffix,                                                     \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_weighted_sum_##suffix(                              \
+                    pSrcA, FMA_WEIGHT_A_##suffix,                       \
+                    pSrcB, FMA_WEIGHT_B_##suffix,                       \
+                    basic_math_output_fut.data_ptr, block_size));       \
+            ref_weighted_sum_##suffix(                                  \
+                pSrcA, FMA_WEIGHT_A_##suffix,                           \
+                pSrcB, FMA_WEIGHT_B_##suffix,                           \
+                basic_math_output_ref.data_ptr, block_size);            \
+                                                                        \
+            FMA_COMPARE(compare_interface, block_size,                  \
+                        TYPE_FROM_ABBREV(suffix)));                     \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_WEIGHTED_SUM_TEST(f32, BASIC_MATH_SNR_COMPARE_INTERFACE);
+JTEST_ARM_WEIGHTED_SUM_TEST(q31, BASIC_MATH_COMPARE_INTERFACE);
+JTEST_ARM_WEIGHTED_SUM_TEST(q15, BASIC_MATH_COMPARE_INTERFACE);
+JTEST_ARM_WEIGHTED_SUM_TEST(q7 , BASIC_MATH_COMPARE_INTERFACE);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fma_tests)
+{
+    JTEST_TEST_CALL(arm_scale_offset_f32_test);
+    JTEST_TEST_CALL(arm_scale_offset_q31_test);
+    JTEST_TEST_CALL(arm_scale_offset_q15_test);
+    JTEST_TEST_CALL(arm_scale_offset_q7_test);
+    JTEST_TEST_CALL(arm_mult_add_f32_test);
+    JTEST_TEST_CALL(arm_mult_add_q31_test);
+    JTEST_TEST_CALL(arm_mult_add_q15_test);
+    JTEST_TEST_CALL(arm_mult_add_q7_test);
+    JTEST_TEST_CALL(arm_weighted_sum_f32_test);
+    JTEST_TEST_CALL(arm_weighted_sum_q31_test);
+    JTEST_TEST_CALL(arm_weighted_sum_q15_test);
+    JTEST_TEST_CALL(arm_weighted_sum_q7_test);
+}
@@ -0,0 +1,134 @@
+#include "jtest.h"
+#include "complex_math_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "complex_math_templates.h"
+#include "type_abbrev.h"
+
+/*
+ * Comparison SNR thresholds for the estimates, from their maximum relative
+ * errors of 3.96%, 0.97% and 4.8e-5.
+ */
+#define CMPLX_MAG_APPROX_SNR_THRESHOLD_fast   25
+#define CMPLX_MAG_APPROX_SNR_THRESHOLD_medium 37
+#define CMPLX_MAG_APPROX_SNR_THRESHOLD_newton 70
+
+/*
+  Approximate complex magnitude test function.  The output is compared with the
+  exact magnitude, and the cycle count of arm_cmplx_mag_xxx() is displayed for
+  comparison.
+*/
+#define JTEST_ARM_CMPLX_MAG_APPROX_TEST(suffix, accuracy, name)         \
+    JTEST_DEFINE_TEST(arm_cmplx_mag_approx_##suffix##_##name##_test,    \
+                      arm_cmplx_mag_approx_##suffix)                    \
+    {                                                                   \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            input_idx, ARR_DESC_t *, input_ptr, complex_math_f_all      \
+            ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                block_size_idx, uint32_t, block_size,                   \
+                complex_math_block_sizes                                \
+                ,                                                       \
+                TYPE_FROM_ABBREV(suffix) * input_data_ptr =             \
+                    (TYPE_FROM_ABBREV(suffix) *) input_ptr->data_ptr;   \
+                                                                        \
+                TEST_DO_VALID_BLOCKSIZE(                                \
+                    block_size, TYPE_FROM_ABBREV(suffix), input_ptr     \
+                    ,                                                   \
+                    JTEST_COUNT_CYCLES(                                 \
+                        arm_cmplx_mag_approx_##suffix(                  \
+                            input_data_ptr, accuracy,                   \
+                            complex_math_output_fut_a.data_ptr,         \
+                            block_size));                               \
+                                                                        \
+                    JTEST_DUMP_STR("arm_cmplx_mag_" #suffix ":\n");     \
+                    JTEST_COUNT_CYCLES(                                 \
+                        arm_cmplx_mag_##suffix(                         \
+                            input_data_ptr,                             \
+                            complex_math_output_ref_a.data_ptr,         \
+                            block_size));                               \
+                                                                        \
+                    ref_cmplx_mag_##suffix(                             \
+                        input_data_ptr,                                 \
+                        complex_math_output_ref_a.data_ptr,             \
+                        block_size);                                    \
+                                                                        \
+                    TEST_CONVERT_AND_ASSERT_SNR(                        \
+                        complex_math_output_f32_ref_a,                  \
+                        complex_math_output_ref_a.data_ptr,             \
+                        complex_math_output_f32_fut_a,                  \
+                        complex_math_output_fut_a.data_ptr,             \
+                        block_size,                                     \
+                        TYPE_FROM_ABBREV(suffix),                       \
+                        CMPLX_MAG_APPROX_SNR_THRESHOLD_##name))));      \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_CMPLX_MAG_APPROX_TEST(f32, ARM_CMPLX_MAG_APPROX_FAST, fast);
+JTEST_ARM_CMPLX_MAG_APPROX_TEST(f32, ARM_CMPLX_MAG_APPROX_MEDIUM, medium);
+JTEST_ARM_CMPLX_MAG_APPROX_TEST(f32, ARM_CMPLX_MAG_APPROX_NEWTON, newton);
+JTEST_ARM_CMPLX_MAG_APPROX_TEST(q31, ARM_CMPLX_MAG_APPROX_FAST, fast);
+JTEST_ARM_CMPLX_MAG_APPROX_TEST(q31, ARM_CMPLX_MAG_APPROX_MEDIUM, medium);
+JTEST_ARM_CMPLX_MAG_APPROX_TEST(q31, ARM_CMPLX_MAG_APPROX_NEWTON, newton);
+JTEST_ARM_CMPLX_MAG_APPROX_TEST(q15, ARM_CMPLX_MAG_APPROX_FAST, fast);
+JTEST_ARM_CMPLX_MAG_APPROX_TEST(q15, ARM_CMPLX_MAG_APPROX_MEDIUM, medium);
+JTEST_ARM_CMPLX_MAG_APPROX_TEST(q15, ARM_CMPLX_MAG_APPROX_NEWTON, newton);
+
+/*
+  The inputs of magnitude 0 and 1 LSB give an output of at most 1 LSB, the
+  magnitude being 0.5 LSB in the output format.
+*/
+#define JTEST_ARM_CMPLX_MAG_APPROX_UNIT_TEST(suffix, accuracy, name)    \
+    JTEST_DEFINE_TEST(arm_cmplx_mag_approx_##suffix##_##name##_unit_test, \
+                      arm_cmplx_mag_approx_##suffix)                    \
+    {                                                                   \
+        TYPE_FROM_ABBREV(suffix) input[10] =                            \
+            {1, 0, -1, 0, 0, 1, 0, -1, 0, 0};                           \
+        TYPE_FROM_ABBREV(suffix) output[5];                             \
+        uint32_t i;                                                     \
+                                                                        \
+        arm_cmplx_mag_approx_##suffix(input, accuracy, output, 5U);     \
+                                                                        \
+        for (i = 0; i < 5U; i++)                                        \
+        {                                                               \
+            if ((output[i] < 0) || (output[i] > 1))                     \
+            {                                                           \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_CMPLX_MAG_APPROX_UNIT_TEST(q31, ARM_CMPLX_MAG_APPROX_FAST, fast);
+JTEST_ARM_CMPLX_MAG_APPROX_UNIT_TEST(q31, ARM_CMPLX_MAG_APPROX_MEDIUM, medium);
+JTEST_ARM_CMPLX_MAG_APPROX_UNIT_TEST(q31, ARM_CMPLX_MAG_APPROX_NEWTON, newton);
+JTEST_ARM_CMPLX_MAG_APPROX_UNIT_TEST(q15, ARM_CMPLX_MAG_APPROX_FAST, fast);
+JTEST_ARM_CMPLX_MAG_APPROX_UNIT_TEST(q15, ARM_CMPLX_MAG_APPROX_MEDIUM, medium);
+JTEST_ARM_CMPLX_MAG_APPROX_UNIT_TEST(q15, ARM_CMPLX_MAG_APPROX_NEWTON, newton);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(cmplx_mag_approx_tests)
+{
+    JTEST_TEST_CALL(arm_cmplx_mag_approx_f32_fast_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_approx_f32_medium_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_approx_f32_newton_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_approx_q31_fast_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_approx_q31_medium_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_approx_q31_newton_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_approx_q15_fast_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_approx_q15_medium_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_approx_q15_newton_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_approx_q31_fast_unit_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_approx_q31_medium_unit_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_approx_q31_newton_unit_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_approx_q15_fast_unit_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_approx_q15_medium_unit_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_approx_q15_newton_unit_test);
+}
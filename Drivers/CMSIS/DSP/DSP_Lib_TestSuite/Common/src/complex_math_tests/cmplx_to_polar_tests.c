@@ -0,0 +1,59 @@
+#include "jtest.h"
+#include "complex_math_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "complex_math_templates.h"
+#include "type_abbrev.h"
+
+/*
+ * Comparison SNR thresholds of the phases.  The Q15 phase has an error of up to
+ * 1 LSB, which is below the usual Q15 threshold for a single small angle.
+ */
+#define CMPLX_TO_POLAR_PHASE_SNR_THRESHOLD_float32_t 120
+#define CMPLX_TO_POLAR_PHASE_SNR_THRESHOLD_q31_t 100
+#define CMPLX_TO_POLAR_PHASE_SNR_THRESHOLD_q15_t 60
+
+/**
+ *  Compare the magnitudes in the 'a' buffers and the phases in the 'b' buffers
+ *  using SNR.
+ */
+#define CMPLX_TO_POLAR_SNR_COMPARE_INTERFACE(block_size, output_type)  \
+    do                                                                  \
+    {                                                                   \
+        COMPLEX_MATH_SNR_COMPARE_OUT_INTERFACE(block_size,              \
+                                               output_type,             \
+                                               a);                      \
+        TEST_CONVERT_AND_ASSERT_SNR(                                    \
+            complex_math_output_f32_ref_b,                              \
+            complex_math_output_ref_b.data_ptr,                         \
+            complex_math_output_f32_fut_b,                              \
+            complex_math_output_fut_b.data_ptr,                         \
+            block_size,                                                 \
+            output_type,                                                \
+            CMPLX_TO_POLAR_PHASE_SNR_THRESHOLD_##output_type);          \
+    } while (0)
+
+#define JTEST_ARM_CMPLX_TO_POLAR_TEST(suffix, comparison_interface)     \
+    COMPLEX_MATH_DEFINE_TEST_TEMPLATE_BUF1_BLK(                         \
+        cmplx_to_polar,                                                 \
+        suffix,                                                         \
+        TYPE_FROM_ABBREV(suffix),                                       \
+        TYPE_FROM_ABBREV(suffix),                                       \
+        comparison_interface)
+
+JTEST_ARM_CMPLX_TO_POLAR_TEST(f32, CMPLX_TO_POLAR_SNR_COMPARE_INTERFACE);
+JTEST_ARM_CMPLX_TO_POLAR_TEST(q31, CMPLX_TO_POLAR_SNR_COMPARE_INTERFACE);
+JTEST_ARM_CMPLX_TO_POLAR_TEST(q15, CMPLX_TO_POLAR_SNR_COMPARE_INTERFACE);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(cmplx_to_polar_tests)
+{
+    JTEST_TEST_CALL(arm_cmplx_to_polar_f32_test);
+    JTEST_TEST_CALL(arm_cmplx_to_polar_q31_test);
+    JTEST_TEST_CALL(arm_cmplx_to_polar_q15_test);
+}
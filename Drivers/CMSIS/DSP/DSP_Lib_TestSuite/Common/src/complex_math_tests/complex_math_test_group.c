@@ -6,9 +6,11 @@ JTEST_DEFINE_GROUP(complex_math_tests)
     JTEST_GROUP_CALL(cmplx_conj_tests);
     JTEST_GROUP_CALL(cmplx_dot_prod_tests);
     JTEST_GROUP_CALL(cmplx_mag_tests);
+    JTEST_GROUP_CALL(cmplx_mag_approx_tests);
     JTEST_GROUP_CALL(cmplx_mag_squared_tests);
     JTEST_GROUP_CALL(cmplx_mult_cmplx_tests);
     JTEST_GROUP_CALL(cmplx_mult_real_tests);
+    JTEST_GROUP_CALL(cmplx_to_polar_tests);
     
     return;
 }
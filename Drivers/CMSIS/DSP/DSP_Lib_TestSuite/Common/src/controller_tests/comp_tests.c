@@ -0,0 +1,280 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"
+#include "ref.h"
+#include "type_abbrev.h"
+#include "test_templates.h"
+#include "controller_test_data.h"
+#include "controller_templates.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Compensator Designs */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Buck converter switching at 200 kHz, 12 V to 5 V, 22 uH, 100 uF and a 2 ohm
+  load, with a crossover frequency near 10 kHz:
+
+  - Voltage mode with a type III (3P3Z) compensator: the two zeros are placed
+    at the LC resonance, 3.4 kHz.
+  - Peak current mode with a type II (2P2Z) compensator: the zero cancels the
+    RC pole of the output, 796 Hz.
+*/
+#define COMP_FS          200.0e3
+#define COMP_SUBSTEPS    20
+#define COMP_VIN         12.0
+#define COMP_L           22.0e-6
+#define COMP_C           100.0e-6
+#define COMP_R           2.0
+#define COMP_R_STEP      1.0        /* Load after the load step */
+#define COMP_VSCALE      16.0       /* Full scale of the voltage measurement, V */
+#define COMP_ISCALE      10.0       /* Full scale of the current reference, A */
+#define COMP_VREF        5.0
+#define COMP_STEPS       2000       /* 10 ms, with the load step half way */
+#define COMP_SETTLED     100        /* Steps checked before the load step and at the end */
+#define COMP_TOLERANCE   0.05       /* 1 percent of the output voltage */
+#define COMP_OVERSHOOT   0.25       /* 5 percent of the output voltage */
+
+static const float32_t comp_type3_zeros[2] = { 3400.0f, 3400.0f };
+static const float32_t comp_type3_poles[2] = { 50.0e3f, 100.0e3f };
+static const float32_t comp_type2_zeros[1] = { 796.0f };
+static const float32_t comp_type2_poles[1] = { 50.0e3f };
+
+#define COMP_TYPE3_GAIN  77550.0f
+#define COMP_TYPE2_GAIN  51000.0f
+
+#define COMP_ONE_q31     2147483648.0
+#define COMP_ONE_q15     32768.0
+
+/* 3P3Z for the voltage mode converter, 2P2Z for the current mode converter */
+static void comp_design(uint32_t order, float32_t * pCoeffs)
+{
+    if (order == 3U)
+    {
+        arm_comp_design_f32(3U, COMP_TYPE3_GAIN, comp_type3_zeros,
+                            comp_type3_poles, (float32_t) COMP_FS, pCoeffs);
+    }
+    else
+    {
+        arm_comp_design_f32(2U, COMP_TYPE2_GAIN, comp_type2_zeros,
+                            comp_type2_poles, (float32_t) COMP_FS, pCoeffs);
+    }
+}
+
+/*
+  Convert the coefficients to fixed-point, with the smallest postShift that
+  fits the largest coefficient.
+*/
+#define COMP_COEFFS_CONVERT(suffix, type)                               \
+    static uint8_t comp_coeffs_##suffix(                                \
+        uint32_t order,                                                 \
+        const float32_t * pCoeffs,                                      \
+        type * pDst)                                                    \
+    {                                                                   \
+        float32_t maxCoeff = 0.0f;                                      \
+        uint8_t postShift = 0U;                                         \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0U; i < (2U * order) + 1U; i++)                        \
+        {                                                               \
+            maxCoeff = (fabsf(pCoeffs[i]) > maxCoeff) ?                 \
+                fabsf(pCoeffs[i]) : maxCoeff;                           \
+        }                                                               \
+        while (maxCoeff >= (float32_t) (1U << postShift))               \
+        {                                                               \
+            postShift++;                                                \
+        }                                                               \
+                                                                        \
+        for (i = 0U; i < (2U * order) + 1U; i++)                        \
+        {                                                               \
+            pDst[i] = (type) (pCoeffs[i] / (float32_t) (1U << postShift) \
+                              * COMP_ONE_##suffix);                     \
+        }                                                               \
+                                                                        \
+        return postShift;                                               \
+    }
+
+COMP_COEFFS_CONVERT(q31, q31_t)
+COMP_COEFFS_CONVERT(q15, q15_t)
+
+/*--------------------------------------------------------------------------------*/
+/* Converter Model */
+/*--------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    float64_t iL;
+    float64_t v;
+    float64_t r;
+} comp_buck_t;
+
+/*
+  Averaged model of the buck converter over one switching period.  In voltage
+  mode u is the duty cycle, in current mode it is the inductor current
+  reference, in per unit of COMP_ISCALE.  Returns the output voltage.
+*/
+static float64_t comp_buck_step(comp_buck_t * b, uint32_t currentMode, float64_t u)
+{
+    float64_t dt = 1.0 / (COMP_FS * COMP_SUBSTEPS);
+    uint32_t k;
+
+    for (k = 0; k < COMP_SUBSTEPS; k++)
+    {
+        if (currentMode)
+        {
+            b->iL = u * COMP_ISCALE;
+        }
+        else
+        {
+            b->iL += dt * (u * COMP_VIN - b->v) / COMP_L;
+            b->iL = (b->iL < 0.0) ? 0.0 : b->iL;
+        }
+        b->v += dt * (b->iL - b->v / b->r) / COMP_C;
+    }
+
+    return b->v;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Compare against the reference on the controller inputs, scaled down so that
+  the output is not always clamped.
+*/
+#define ARM_COMP_TEST(form, order, suffix, type)                        \
+    JTEST_DEFINE_TEST(arm_comp_##form##_##suffix##_test,                \
+                      arm_comp_##form##_##suffix)                       \
+    {                                                                   \
+            uint32_t j;                                                 \
+            float32_t coeffs[7];                                        \
+            type qcoeffs[7];                                            \
+            uint8_t postShift;                                          \
+            type in = 0;                                                \
+            type * fut = (type *) controller_output_fut;                \
+            type * ref = (type *) controller_output_ref;                \
+                                                                        \
+            arm_comp_instance_##suffix fut_inst;                        \
+            arm_comp_instance_##suffix ref_inst;                        \
+                                                                        \
+            comp_design(order, coeffs);                                 \
+            postShift = comp_coeffs_##suffix(order, coeffs, qcoeffs);   \
+            arm_comp_init_##suffix(&fut_inst, order, qcoeffs, postShift, \
+                (type) (-0.5 * COMP_ONE_##suffix),                      \
+                (type) (0.5 * COMP_ONE_##suffix));                      \
+            arm_comp_init_##suffix(&ref_inst, order, qcoeffs, postShift, \
+                (type) (-0.5 * COMP_ONE_##suffix),                      \
+                (type) (0.5 * COMP_ONE_##suffix));                      \
+                                                                        \
+            for(j=0;j<CONTROLLER_MAX_LEN;j++)                           \
+            {                                                           \
+                in = controller_##suffix##_inputs[j] >> 6;              \
+                fut[j] = arm_comp_##form##_##suffix(&fut_inst, in);     \
+                ref[j] = ref_comp_##suffix(&ref_inst, order, in);       \
+            }                                                           \
+                                                                        \
+            /* Display the cycle count of one step */                   \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_comp_##form##_##suffix(&fut_inst, in));             \
+                                                                        \
+            /* Test correctness */                                      \
+            CONTROLLER_SNR_COMPARE_INTERFACE(                           \
+                    CONTROLLER_MAX_LEN,                                 \
+                    type);                                              \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+    }
+
+ARM_COMP_TEST(2p2z, 2U, q31, q31_t);
+ARM_COMP_TEST(3p3z, 3U, q31, q31_t);
+ARM_COMP_TEST(2p2z, 2U, q15, q15_t);
+ARM_COMP_TEST(3p3z, 3U, q15, q15_t);
+
+/*
+  Closed loop test: start-up of the converter from zero, then a load step
+  from 2 to 1 ohm.  The output voltage must not overshoot at start-up, where
+  the output is clamped for many periods, and must settle within 1 percent
+  before the load step and at the end.
+*/
+#define ARM_COMP_BUCK_TEST(form, order, suffix, type, outLimit)         \
+    JTEST_DEFINE_TEST(arm_comp_##form##_buck_##suffix##_test,           \
+                      arm_comp_##form##_##suffix)                       \
+    {                                                                   \
+            uint32_t n;                                                 \
+            float32_t coeffs[7];                                        \
+            type qcoeffs[7];                                            \
+            type out;                                                   \
+            comp_buck_t buck = { 0.0, 0.0, COMP_R };                    \
+            float64_t v = 0.0, vMax = 0.0, err, maxErr = 0.0;           \
+                                                                        \
+            arm_comp_instance_##suffix S;                               \
+                                                                        \
+            comp_design(order, coeffs);                                 \
+            arm_comp_init_##suffix(&S, order, qcoeffs,                  \
+                comp_coeffs_##suffix(order, coeffs, qcoeffs),           \
+                0, (type) (outLimit * COMP_ONE_##suffix));              \
+                                                                        \
+            for(n=0;n<COMP_STEPS;n++)                                   \
+            {                                                           \
+                if (n == COMP_STEPS/2)                                  \
+                {                                                       \
+                    buck.r = COMP_R_STEP;                               \
+                }                                                       \
+                                                                        \
+                out = arm_comp_##form##_##suffix(&S,                    \
+                    (type) ((COMP_VREF - v) / COMP_VSCALE               \
+                            * COMP_ONE_##suffix));                      \
+                if ((out < S.outMin) || (out > S.outMax))               \
+                {                                                       \
+                    return JTEST_TEST_FAILED;                           \
+                }                                                       \
+                                                                        \
+                v = comp_buck_step(&buck, (order) == 2U,                \
+                                   out / COMP_ONE_##suffix);            \
+                                                                        \
+                vMax = ((n < COMP_STEPS/2) && (v > vMax)) ? v : vMax;   \
+                if (((n >= COMP_STEPS/2 - COMP_SETTLED) &&              \
+                     (n < COMP_STEPS/2)) ||                             \
+                    (n >= COMP_STEPS - COMP_SETTLED))                   \
+                {                                                       \
+                    err = fabs(v - COMP_VREF);                          \
+                    maxErr = (err > maxErr) ? err : maxErr;             \
+                }                                                       \
+            }                                                           \
+                                                                        \
+            JTEST_DUMP_STRF("Overshoot: %f V, settled error: %f V\n",   \
+                            vMax - COMP_VREF, maxErr);                  \
+            if ((vMax - COMP_VREF > COMP_OVERSHOOT) ||                  \
+                (maxErr > COMP_TOLERANCE))                              \
+            {                                                           \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+    }
+
+/* Duty cycle up to 0.9 in voltage mode, current up to 5 A in current mode */
+ARM_COMP_BUCK_TEST(3p3z, 3U, q31, q31_t, 0.9);
+ARM_COMP_BUCK_TEST(2p2z, 2U, q31, q31_t, 0.5);
+ARM_COMP_BUCK_TEST(3p3z, 3U, q15, q15_t, 0.9);
+ARM_COMP_BUCK_TEST(2p2z, 2U, q15, q15_t, 0.5);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(comp_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_comp_2p2z_q31_test);
+    JTEST_TEST_CALL(arm_comp_3p3z_q31_test);
+    JTEST_TEST_CALL(arm_comp_2p2z_q15_test);
+    JTEST_TEST_CALL(arm_comp_3p3z_q15_test);
+    JTEST_TEST_CALL(arm_comp_3p3z_buck_q31_test);
+    JTEST_TEST_CALL(arm_comp_2p2z_buck_q31_test);
+    JTEST_TEST_CALL(arm_comp_3p3z_buck_q15_test);
+    JTEST_TEST_CALL(arm_comp_2p2z_buck_q15_test);
+}
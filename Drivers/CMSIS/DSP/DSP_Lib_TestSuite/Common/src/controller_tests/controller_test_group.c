@@ -8,6 +8,11 @@ JTEST_DEFINE_GROUP(controller_tests)
     */
     JTEST_GROUP_CALL(pid_reset_tests);
     JTEST_GROUP_CALL(pid_tests);
+    JTEST_GROUP_CALL(pid_ext_tests);
+    JTEST_GROUP_CALL(comp_tests);
     JTEST_GROUP_CALL(sin_cos_tests);
+    JTEST_GROUP_CALL(foc_tests);
+    JTEST_GROUP_CALL(kalman_tests);
+    JTEST_GROUP_CALL(pll_tests);
     return;
 }
@@ -0,0 +1,329 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"
+#include "ref.h"
+#include "type_abbrev.h"
+#include "test_templates.h"
+#include "controller_test_data.h"
+#include "controller_templates.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Motor Model */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Surface mounted permanent magnet motor turning at a constant electrical
+  speed, fed by an ideal inverter from the duty cycles.  The model is
+  integrated in the stationary frame in double precision, with substeps
+  inside each PWM period.
+*/
+#define FOC_PI_F64       3.14159265358979323846
+#define FOC_R            0.5                     /* Phase resistance, ohm */
+#define FOC_L            1.0e-3                  /* Phase inductance, H */
+#define FOC_PSI          0.01                    /* Magnet flux linkage, Wb */
+#define FOC_OMEGA        (2.0 * FOC_PI_F64 * 100.0) /* Electrical speed, rad/s */
+#define FOC_VBUS         24.0                    /* DC bus voltage, V */
+#define FOC_TS           50.0e-6                 /* PWM period, 20 kHz */
+#define FOC_SUBSTEPS     10
+#define FOC_STEPS        400                     /* 20 ms */
+#define FOC_SETTLED      200                     /* Steps checked at the end of the run */
+
+/* Current loops with a bandwidth of 1 kHz */
+#define FOC_BANDWIDTH    (2.0 * FOC_PI_F64 * 1000.0)
+#define FOC_KP           (FOC_L * FOC_BANDWIDTH)
+#define FOC_KI           (FOC_R * FOC_BANDWIDTH * FOC_TS)
+#define FOC_VLIMIT       (FOC_VBUS / 2.449489743) /* vBus / sqrt(6) */
+
+/* Current references and the accepted error at the end of the run, A */
+#define FOC_ID_REF       0.0
+#define FOC_IQ_REF       5.0
+#define FOC_TOLERANCE    0.05
+
+/* Full scale current of the Q31 version, A */
+#define FOC_IBASE        20.0
+
+typedef struct
+{
+    float64_t ialpha;
+    float64_t ibeta;
+    float64_t theta;
+} foc_motor_t;
+
+/* Apply the duty cycles for one PWM period */
+static void foc_motor_step(foc_motor_t * m, const float64_t * pDuty)
+{
+    float64_t mean, va, vb, vc, valpha, vbeta;
+    float64_t dt = FOC_TS / FOC_SUBSTEPS;
+    uint32_t k;
+
+    /* Phase to neutral voltages */
+    mean = (pDuty[0] + pDuty[1] + pDuty[2]) / 3.0;
+    va = (pDuty[0] - mean) * FOC_VBUS;
+    vb = (pDuty[1] - mean) * FOC_VBUS;
+    vc = (pDuty[2] - mean) * FOC_VBUS;
+    valpha = va;
+    vbeta = (vb - vc) / sqrt(3.0);
+
+    for (k = 0; k < FOC_SUBSTEPS; k++)
+    {
+        m->ialpha += dt * (valpha - FOC_R * m->ialpha + FOC_OMEGA * FOC_PSI * sin(m->theta)) / FOC_L;
+        m->ibeta  += dt * (vbeta  - FOC_R * m->ibeta  - FOC_OMEGA * FOC_PSI * cos(m->theta)) / FOC_L;
+        m->theta  += dt * FOC_OMEGA;
+    }
+
+    m->theta = (m->theta >= FOC_PI_F64) ? (m->theta - 2.0 * FOC_PI_F64) : m->theta;
+}
+
+/* Phase currents and rotor angle seen by the controller */
+static void foc_motor_sense(const foc_motor_t * m, float64_t * pIa, float64_t * pIb)
+{
+    *pIa = m->ialpha;
+    *pIb = -0.5 * m->ialpha + 0.8660254037844386 * m->ibeta;
+}
+
+/* Largest error of the rotor frame currents over the end of a run */
+static float64_t foc_motor_error(const foc_motor_t * m, float64_t maxErr)
+{
+    float64_t id, iq, err;
+
+    id =  m->ialpha * cos(m->theta) + m->ibeta * sin(m->theta);
+    iq = -m->ialpha * sin(m->theta) + m->ibeta * cos(m->theta);
+
+    err = fabs(id - FOC_ID_REF);
+    maxErr = (err > maxErr) ? err : maxErr;
+    err = fabs(iq - FOC_IQ_REF);
+    maxErr = (err > maxErr) ? err : maxErr;
+
+    return maxErr;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Separate Function Calls */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The same step written with the separate transform, PID and sin_cos
+  functions, without the limits.  Used to display the cycle count of the
+  equivalent sequence of calls.
+*/
+static void foc_separate_f32(
+    arm_pid_instance_f32 * pidD,
+    arm_pid_instance_f32 * pidQ,
+    float32_t Ia,
+    float32_t Ib,
+    float32_t theta,
+    float32_t * pDuty)
+{
+    float32_t sinVal, cosVal, Ialpha, Ibeta, Id, Iq, Vd, Vq, Va, Vb, Vc, offset;
+
+    arm_sin_cos_f32(theta * 57.2957795f, &sinVal, &cosVal);
+    arm_clarke_f32(Ia, Ib, &Ialpha, &Ibeta);
+    arm_park_f32(Ialpha, Ibeta, &Id, &Iq, sinVal, cosVal);
+    Vd = arm_pid_f32(pidD, -Id);
+    Vq = arm_pid_f32(pidQ, (float32_t) FOC_IQ_REF - Iq);
+    arm_inv_park_f32(Vd, Vq, &Ialpha, &Ibeta, sinVal, cosVal);
+    arm_inv_clarke_f32(Ialpha, Ibeta, &Va, &Vb);
+    Vc = -(Va + Vb);
+    offset = 0.5f * (((Va > Vb) ? ((Va > Vc) ? Va : Vc) : ((Vb > Vc) ? Vb : Vc)) +
+                     ((Va < Vb) ? ((Va < Vc) ? Va : Vc) : ((Vb < Vc) ? Vb : Vc)));
+    pDuty[0] = 0.5f + (Va - offset) * (float32_t) (1.0 / FOC_VBUS);
+    pDuty[1] = 0.5f + (Vb - offset) * (float32_t) (1.0 / FOC_VBUS);
+    pDuty[2] = 0.5f + (Vc - offset) * (float32_t) (1.0 / FOC_VBUS);
+}
+
+static void foc_separate_q31(
+    arm_pid_instance_q31 * pidD,
+    arm_pid_instance_q31 * pidQ,
+    q31_t Ia,
+    q31_t Ib,
+    q31_t theta,
+    q31_t * pDuty)
+{
+    q31_t sinVal, cosVal, Ialpha, Ibeta, Id, Iq, Vd, Vq, Va, Vb, Vc, offset;
+
+    arm_sin_cos_q31(theta, &sinVal, &cosVal);
+    arm_clarke_q31(Ia, Ib, &Ialpha, &Ibeta);
+    arm_park_q31(Ialpha, Ibeta, &Id, &Iq, sinVal, cosVal);
+    Vd = arm_pid_q31(pidD, -Id);
+    Vq = arm_pid_q31(pidQ, (q31_t) (FOC_IQ_REF / FOC_IBASE * 2147483648.0) - Iq);
+    arm_inv_park_q31(Vd, Vq, &Ialpha, &Ibeta, sinVal, cosVal);
+    arm_inv_clarke_q31(Ialpha, Ibeta, &Va, &Vb);
+    Vc = -(Va + Vb);
+    offset = ((((Va > Vb) ? ((Va > Vc) ? Va : Vc) : ((Vb > Vc) ? Vb : Vc))) >> 1) +
+             ((((Va < Vb) ? ((Va < Vc) ? Va : Vc) : ((Vb < Vc) ? Vb : Vc))) >> 1);
+    pDuty[0] = 0x40000000 + (Va - offset);
+    pDuty[1] = 0x40000000 + (Vb - offset);
+    pDuty[2] = 0x40000000 + (Vc - offset);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Closed loop test: the step function drives the motor model from rest to the
+  current references.  The rotor frame currents must settle within the
+  tolerance, the voltage commands must stay within the limit and the duty
+  cycles within [0 1].
+*/
+JTEST_DEFINE_TEST(arm_foc_f32_test, arm_foc_f32)
+{
+    arm_foc_instance_f32 S;
+    arm_pid_instance_f32 pidD = { 0 };
+    arm_pid_instance_f32 pidQ = { 0 };
+    foc_motor_t motor = { 0.0, 0.0, 0.0 };
+    float32_t duty[3];
+    float64_t dutyF64[3];
+    float64_t Ia, Ib;
+    float64_t maxErr = 0.0;
+    uint32_t n, i;
+
+    arm_foc_init_f32(&S, (float32_t) FOC_KP, (float32_t) FOC_KI,
+                     (float32_t) FOC_VLIMIT, (float32_t) FOC_VBUS);
+
+    for (n = 0; n < FOC_STEPS; n++)
+    {
+        foc_motor_sense(&motor, &Ia, &Ib);
+
+        arm_foc_f32(&S, (float32_t) Ia, (float32_t) Ib, (float32_t) motor.theta,
+                    (float32_t) FOC_ID_REF, (float32_t) FOC_IQ_REF, duty);
+
+        for (i = 0; i < 3; i++)
+        {
+            if ((duty[i] < 0.0f) || (duty[i] > 1.0f))
+            {
+                return JTEST_TEST_FAILED;
+            }
+            dutyF64[i] = (float64_t) duty[i];
+        }
+
+        if ((fabsf(S.Vd) > S.vLimit) || (fabsf(S.Vq) > S.vLimit))
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        foc_motor_step(&motor, dutyF64);
+
+        if (n >= (FOC_STEPS - FOC_SETTLED))
+        {
+            maxErr = foc_motor_error(&motor, maxErr);
+        }
+    }
+
+    JTEST_DUMP_STRF("Settled current error: %f A (tolerance %f A)\n",
+                    maxErr, FOC_TOLERANCE);
+    if (maxErr > FOC_TOLERANCE)
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    /* Cycle budget of one PWM period */
+    foc_motor_sense(&motor, &Ia, &Ib);
+    JTEST_DUMP_STR("One step:\n");
+    JTEST_COUNT_CYCLES(
+        arm_foc_f32(&S, (float32_t) Ia, (float32_t) Ib, (float32_t) motor.theta,
+                    (float32_t) FOC_ID_REF, (float32_t) FOC_IQ_REF, duty));
+
+    pidD.Kp = (float32_t) FOC_KP;
+    pidD.Ki = (float32_t) FOC_KI;
+    pidQ = pidD;
+    arm_pid_init_f32(&pidD, 1);
+    arm_pid_init_f32(&pidQ, 1);
+    JTEST_DUMP_STR("Separate functions:\n");
+    JTEST_COUNT_CYCLES(
+        foc_separate_f32(&pidD, &pidQ, (float32_t) Ia, (float32_t) Ib,
+                         (float32_t) motor.theta, duty));
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_foc_q31_test, arm_foc_q31)
+{
+    arm_foc_instance_q31 S;
+    arm_pid_instance_q31 pidD = { 0 };
+    arm_pid_instance_q31 pidQ = { 0 };
+    foc_motor_t motor = { 0.0, 0.0, 0.0 };
+    q31_t duty[3];
+    q31_t Ia, Ib, theta;
+    float64_t dutyF64[3];
+    float64_t IaF64, IbF64;
+    float64_t maxErr = 0.0;
+    float64_t scale = FOC_IBASE / FOC_VBUS / 8.0; /* Gains in bus voltage per full scale current, postShift 3 */
+    uint32_t n, i;
+
+    arm_foc_init_q31(&S,
+                     (q31_t) (FOC_KP * scale * 2147483648.0),
+                     (q31_t) (FOC_KI * scale * 2147483648.0),
+                     3U,
+                     (q31_t) (FOC_VLIMIT / FOC_VBUS * 2147483648.0));
+
+    for (n = 0; n < FOC_STEPS; n++)
+    {
+        foc_motor_sense(&motor, &IaF64, &IbF64);
+        Ia = (q31_t) (IaF64 / FOC_IBASE * 2147483648.0);
+        Ib = (q31_t) (IbF64 / FOC_IBASE * 2147483648.0);
+        theta = (q31_t) (motor.theta / FOC_PI_F64 * 2147483648.0);
+
+        arm_foc_q31(&S, Ia, Ib, theta,
+                    (q31_t) (FOC_ID_REF / FOC_IBASE * 2147483648.0),
+                    (q31_t) (FOC_IQ_REF / FOC_IBASE * 2147483648.0), duty);
+
+        for (i = 0; i < 3; i++)
+        {
+            if (duty[i] < 0)
+            {
+                return JTEST_TEST_FAILED;
+            }
+            dutyF64[i] = (float64_t) duty[i] / 2147483648.0;
+        }
+
+        if ((S.Vd > S.vLimit) || (S.Vd < -S.vLimit) ||
+            (S.Vq > S.vLimit) || (S.Vq < -S.vLimit))
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        foc_motor_step(&motor, dutyF64);
+
+        if (n >= (FOC_STEPS - FOC_SETTLED))
+        {
+            maxErr = foc_motor_error(&motor, maxErr);
+        }
+    }
+
+    JTEST_DUMP_STRF("Settled current error: %f A (tolerance %f A)\n",
+                    maxErr, FOC_TOLERANCE);
+    if (maxErr > FOC_TOLERANCE)
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    /* Cycle budget of one PWM period */
+    JTEST_DUMP_STR("One step:\n");
+    JTEST_COUNT_CYCLES(
+        arm_foc_q31(&S, Ia, Ib, theta, 0,
+                    (q31_t) (FOC_IQ_REF / FOC_IBASE * 2147483648.0), duty));
+
+    pidD.Kp = S.KpD;
+    pidD.Ki = S.KiD;
+    pidQ = pidD;
+    arm_pid_init_q31(&pidD, 1);
+    arm_pid_init_q31(&pidQ, 1);
+    JTEST_DUMP_STR("Separate functions:\n");
+    JTEST_COUNT_CYCLES(foc_separate_q31(&pidD, &pidQ, Ia, Ib, theta, duty));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(foc_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_foc_f32_test);
+    JTEST_TEST_CALL(arm_foc_q31_test);
+}
@@ -0,0 +1,360 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"
+#include "ref.h"
+#include "type_abbrev.h"
+#include "test_templates.h"
+#include "controller_test_data.h"
+#include "controller_templates.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Parameters */
+/*--------------------------------------------------------------------------------*/
+
+/* Tracker: position and velocity in the plane, positions measured, accelerations as inputs */
+#define KALMAN_TRACK_N     4U
+#define KALMAN_TRACK_M     2U
+#define KALMAN_TRACK_P     2U
+#define KALMAN_TRACK_DT    0.1f
+#define KALMAN_TRACK_STEPS 100U
+
+/* Battery: state of charge and RC voltage, terminal voltage measured */
+#define KALMAN_BATT_N      2U
+#define KALMAN_BATT_M      1U
+#define KALMAN_BATT_DT     1.0f                  /* s */
+#define KALMAN_BATT_CAP    7200.0f               /* 2 Ah, in As */
+#define KALMAN_BATT_R0     0.05f                 /* ohm */
+#define KALMAN_BATT_R1     0.02f                 /* ohm */
+#define KALMAN_BATT_A1     0.98f                 /* exp(-dt / (R1 C1)) */
+#define KALMAN_BATT_STEPS  600U
+
+/* Thresholds of the comparison to the reference, and accepted SoC error */
+#define KALMAN_SNR_THRESHOLD 80
+#define KALMAN_SOC_TOL       0.01f
+
+static float32_t kalman_state[KALMAN_TRACK_N];
+static float32_t kalman_cov[KALMAN_TRACK_N * KALMAN_TRACK_N];
+static float32_t kalman_ref_state[KALMAN_TRACK_N];
+static float32_t kalman_ref_cov[KALMAN_TRACK_N * KALMAN_TRACK_N];
+static float32_t kalman_F[KALMAN_TRACK_N * KALMAN_TRACK_N];
+static float32_t kalman_H[KALMAN_TRACK_M * KALMAN_TRACK_N];
+static float32_t kalman_work[ARM_KALMAN_WORK_SIZE(KALMAN_TRACK_N, KALMAN_TRACK_M)];
+
+static const float32_t kalman_track_B[KALMAN_TRACK_N * KALMAN_TRACK_P] =
+{
+    0.005f, 0.0f,
+    0.0f,   0.005f,
+    0.1f,   0.0f,
+    0.0f,   0.1f
+};
+
+/* Process noise from a random acceleration, B B' * 0.5 */
+static const float32_t kalman_track_Q[KALMAN_TRACK_N * KALMAN_TRACK_N] =
+{
+    1.25e-5f, 0.0f,     2.5e-4f, 0.0f,
+    0.0f,     1.25e-5f, 0.0f,    2.5e-4f,
+    2.5e-4f,  0.0f,     5.0e-3f, 0.0f,
+    0.0f,     2.5e-4f,  0.0f,    5.0e-3f
+};
+
+static const float32_t kalman_track_R[KALMAN_TRACK_M * KALMAN_TRACK_M] =
+{
+    0.25f, 0.05f,
+    0.05f, 0.16f
+};
+
+static const float32_t kalman_batt_Q[KALMAN_BATT_N * KALMAN_BATT_N] =
+{
+    1.0e-8f, 0.0f,
+    0.0f,    1.0e-6f
+};
+
+static const float32_t kalman_batt_R[KALMAN_BATT_M * KALMAN_BATT_M] =
+{
+    1.0e-4f
+};
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+static uint32_t kalman_seed;
+
+/*
+  Approximately normal noise with a unit variance: sum of four uniform values.
+*/
+static float32_t kalman_noise(void)
+{
+    float32_t sum = 0.0f;
+    uint32_t k;
+
+    for (k = 0; k < 4; k++)
+    {
+        kalman_seed = kalman_seed * 1664525U + 1013904223U;
+        sum += (float32_t) (kalman_seed >> 8) / 16777216.0f - 0.5f;
+    }
+
+    return sum * 1.7320508f;
+}
+
+/*
+  Battery model: open circuit voltage of the state of charge, first order RC
+  network and series resistance.  The current, positive in discharge, is in
+  the context.
+*/
+static float32_t kalman_batt_ocv(float32_t soc)
+{
+    return 3.0f + soc * (1.2f + soc * (-0.6f + soc * 0.4f));
+}
+
+static void kalman_batt_transition(void * pContext, const float32_t * pState,
+                                   float32_t * pNext, float32_t * pF)
+{
+    float32_t current = *(float32_t *) pContext;
+
+    pNext[0] = pState[0] - KALMAN_BATT_DT * current / KALMAN_BATT_CAP;
+    pNext[1] = KALMAN_BATT_A1 * pState[1] + KALMAN_BATT_R1 * (1.0f - KALMAN_BATT_A1) * current;
+
+    pF[0] = 1.0f;
+    pF[1] = 0.0f;
+    pF[2] = 0.0f;
+    pF[3] = KALMAN_BATT_A1;
+}
+
+static void kalman_batt_measurement(void * pContext, const float32_t * pState,
+                                    float32_t * pMeas, float32_t * pH)
+{
+    float32_t current = *(float32_t *) pContext;
+    float32_t soc = pState[0];
+
+    pMeas[0] = kalman_batt_ocv(soc) - pState[1] - KALMAN_BATT_R0 * current;
+
+    pH[0] = 1.2f + soc * (-1.2f + soc * 1.2f);
+    pH[1] = -1.0f;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Linear tracker driven by known accelerations, compared at each step to the
+  reference filter.  The covariance must stay exactly symmetric.
+*/
+JTEST_DEFINE_TEST(arm_kalman_f32_test,
+                  arm_kalman_update_f32)
+{
+    arm_kalman_instance_f32 S;
+    float32_t truth[KALMAN_TRACK_N] = {0.0f, 0.0f, 1.0f, -0.5f};
+    float32_t next[KALMAN_TRACK_N];
+    float32_t u[KALMAN_TRACK_P];
+    float32_t z[KALMAN_TRACK_M];
+    float32_t * fut = controller_output_f32_fut;
+    float32_t * ref = controller_output_f32_ref;
+    uint32_t n = KALMAN_TRACK_N;
+    uint32_t step;
+    uint32_t i, j;
+
+    kalman_seed = 1U;
+
+    arm_fill_f32(0.0f, kalman_state, n);
+    arm_fill_f32(0.0f, kalman_cov, n * n);
+    arm_fill_f32(0.0f, kalman_F, n * n);
+    arm_fill_f32(0.0f, kalman_H, KALMAN_TRACK_M * n);
+    for (i = 0; i < n; i++)
+    {
+        kalman_cov[i * n + i] = 10.0f;
+        kalman_F[i * n + i] = 1.0f;
+    }
+    kalman_F[0 * n + 2] = KALMAN_TRACK_DT;
+    kalman_F[1 * n + 3] = KALMAN_TRACK_DT;
+    kalman_H[0 * n + 0] = 1.0f;
+    kalman_H[1 * n + 1] = 1.0f;
+
+    arm_copy_f32(kalman_state, kalman_ref_state, n);
+    arm_copy_f32(kalman_cov, kalman_ref_cov, n * n);
+
+    if (arm_kalman_init_f32(&S, KALMAN_TRACK_N, KALMAN_TRACK_M, KALMAN_TRACK_P,
+                            kalman_state, kalman_cov, kalman_F, kalman_track_B,
+                            kalman_H, kalman_track_Q, kalman_track_R,
+                            kalman_work) != ARM_MATH_SUCCESS)
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    for (step = 0; step < KALMAN_TRACK_STEPS; step++)
+    {
+        u[0] = 0.5f * arm_sin_f32(0.05f * (float32_t) step);
+        u[1] = 0.3f;
+
+        /* Truth, with a random acceleration */
+        for (i = 0; i < KALMAN_TRACK_P; i++)
+        {
+            u[i] += 0.7f * kalman_noise();
+        }
+        for (i = 0; i < n; i++)
+        {
+            next[i] = kalman_track_B[i * KALMAN_TRACK_P] * u[0]
+                + kalman_track_B[i * KALMAN_TRACK_P + 1] * u[1];
+            for (j = 0; j < n; j++)
+            {
+                next[i] += kalman_F[i * n + j] * truth[j];
+            }
+        }
+        arm_copy_f32(next, truth, n);
+        z[0] = truth[0] + 0.5f * kalman_noise();
+        z[1] = truth[1] + 0.4f * kalman_noise();
+
+        /* The filter only knows the commanded accelerations */
+        u[0] = 0.5f * arm_sin_f32(0.05f * (float32_t) step);
+        u[1] = 0.3f;
+
+        JTEST_COUNT_CYCLES(arm_kalman_predict_f32(&S, u));
+        JTEST_COUNT_CYCLES(arm_kalman_update_f32(&S, z));
+
+        for (i = 0; i < n; i++)
+        {
+            next[i] = kalman_track_B[i * KALMAN_TRACK_P] * u[0]
+                + kalman_track_B[i * KALMAN_TRACK_P + 1] * u[1];
+            for (j = 0; j < n; j++)
+            {
+                next[i] += kalman_F[i * n + j] * kalman_ref_state[j];
+            }
+        }
+        ref_kalman_predict_f32(KALMAN_TRACK_N, kalman_ref_state, kalman_ref_cov,
+                               kalman_F, kalman_track_Q, next);
+        ref_kalman_update_f32(KALMAN_TRACK_N, KALMAN_TRACK_M, kalman_ref_state,
+                              kalman_ref_cov, kalman_H, kalman_track_R, z, NULL);
+
+        arm_copy_f32(kalman_state, &fut[step * n], n);
+        arm_copy_f32(kalman_ref_state, &ref[step * n], n);
+
+        for (i = 0; i < n; i++)
+        {
+            for (j = i + 1U; j < n; j++)
+            {
+                if (kalman_cov[i * n + j] != kalman_cov[j * n + i])
+                {
+                    JTEST_DUMP_STRF("Covariance not symmetric at step %d\n", (int)step);
+                    return JTEST_TEST_FAILED;
+                }
+            }
+        }
+    }
+
+    TEST_ASSERT_SNR(ref, fut, KALMAN_TRACK_STEPS * n, KALMAN_SNR_THRESHOLD);
+    TEST_ASSERT_SNR(kalman_ref_cov, kalman_cov, n * n, KALMAN_SNR_THRESHOLD);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Extended filter estimating the state of charge of a battery under a pulsed
+  discharge, from a wrong initial state.  Compared to the reference filter
+  fed with the same linearization, and to the true state of charge.
+*/
+JTEST_DEFINE_TEST(arm_kalman_ext_f32_test,
+                  arm_kalman_update_ext_f32)
+{
+    arm_kalman_instance_f32 S;
+    float32_t truth[KALMAN_BATT_N] = {0.9f, 0.0f};
+    float32_t next[KALMAN_BATT_N];
+    float32_t F[KALMAN_BATT_N * KALMAN_BATT_N];
+    float32_t H[KALMAN_BATT_M * KALMAN_BATT_N];
+    float32_t meas[KALMAN_BATT_M];
+    float32_t z[KALMAN_BATT_M];
+    float32_t current;
+    float32_t * fut = controller_output_f32_fut;
+    float32_t * ref = controller_output_f32_ref;
+    uint32_t step;
+
+    kalman_seed = 2U;
+
+    kalman_state[0] = 0.6f;
+    kalman_state[1] = 0.0f;
+    kalman_cov[0] = 0.1f;
+    kalman_cov[1] = 0.0f;
+    kalman_cov[2] = 0.0f;
+    kalman_cov[3] = 1.0e-4f;
+    arm_copy_f32(kalman_state, kalman_ref_state, KALMAN_BATT_N);
+    arm_copy_f32(kalman_cov, kalman_ref_cov, KALMAN_BATT_N * KALMAN_BATT_N);
+
+    arm_kalman_init_f32(&S, KALMAN_BATT_N, KALMAN_BATT_M, 0U,
+                        kalman_state, kalman_cov, kalman_F, NULL,
+                        kalman_H, kalman_batt_Q, kalman_batt_R, kalman_work);
+
+    for (step = 0; step < KALMAN_BATT_STEPS; step++)
+    {
+        /* 1 A discharge, 4 A pulses */
+        current = ((step % 60U) < 20U) ? 4.0f : 1.0f;
+
+        kalman_batt_transition(&current, truth, next, F);
+        arm_copy_f32(next, truth, KALMAN_BATT_N);
+        kalman_batt_measurement(&current, truth, z, H);
+        z[0] += 0.01f * kalman_noise();
+
+        JTEST_COUNT_CYCLES(arm_kalman_predict_ext_f32(&S, kalman_batt_transition, &current));
+        JTEST_COUNT_CYCLES(arm_kalman_update_ext_f32(&S, kalman_batt_measurement, &current, z));
+
+        kalman_batt_transition(&current, kalman_ref_state, next, F);
+        ref_kalman_predict_f32(KALMAN_BATT_N, kalman_ref_state, kalman_ref_cov,
+                               F, kalman_batt_Q, next);
+        kalman_batt_measurement(&current, kalman_ref_state, meas, H);
+        ref_kalman_update_f32(KALMAN_BATT_N, KALMAN_BATT_M, kalman_ref_state,
+                              kalman_ref_cov, H, kalman_batt_R, z, meas);
+
+        fut[step] = kalman_state[0];
+        ref[step] = kalman_ref_state[0];
+    }
+
+    TEST_ASSERT_SNR(ref, fut, KALMAN_BATT_STEPS, KALMAN_SNR_THRESHOLD);
+
+    if (fabsf(kalman_state[0] - truth[0]) > KALMAN_SOC_TOL)
+    {
+        JTEST_DUMP_STRF("State of charge %f, expected %f\n",
+                        (double)kalman_state[0], (double)truth[0]);
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  A zero innovation covariance is rejected and leaves the filter unchanged.
+*/
+JTEST_DEFINE_TEST(arm_kalman_singular_f32_test,
+                  arm_kalman_update_f32)
+{
+    arm_kalman_instance_f32 S;
+    static const float32_t zero[KALMAN_BATT_N * KALMAN_BATT_N] = {0.0f};
+    float32_t z[KALMAN_BATT_M] = {1.0f};
+
+    kalman_state[0] = 0.5f;
+    kalman_state[1] = 0.25f;
+    arm_fill_f32(0.0f, kalman_cov, KALMAN_BATT_N * KALMAN_BATT_N);
+    kalman_H[0] = 1.0f;
+    kalman_H[1] = 0.0f;
+
+    if ((arm_kalman_init_f32(&S, 0U, 1U, 0U, kalman_state, kalman_cov, kalman_F, NULL,
+                             kalman_H, zero, zero, kalman_work) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_kalman_init_f32(&S, KALMAN_BATT_N, KALMAN_BATT_M, 0U, kalman_state, kalman_cov,
+                             kalman_F, NULL, kalman_H, zero, zero, kalman_work) != ARM_MATH_SUCCESS) ||
+        (arm_kalman_update_f32(&S, z) != ARM_MATH_SINGULAR) ||
+        (kalman_state[0] != 0.5f) || (kalman_state[1] != 0.25f))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(kalman_tests)
+{
+    JTEST_TEST_CALL(arm_kalman_f32_test);
+    JTEST_TEST_CALL(arm_kalman_ext_f32_test);
+    JTEST_TEST_CALL(arm_kalman_singular_f32_test);
+}
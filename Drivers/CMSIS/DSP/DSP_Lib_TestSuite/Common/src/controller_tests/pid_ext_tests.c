@@ -0,0 +1,201 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"
+#include "ref.h"
+#include "type_abbrev.h"
+#include "test_templates.h"
+#include "controller_test_data.h"
+#include "controller_templates.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Parameters */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The output limits are set well inside the range reached by the outputs, so
+  that both the clamped and the linear paths are tested.
+*/
+#define PID_EXT_INIT_f32(S, Kp, Ki, Kd)                                 \
+    arm_pid_ext_init_f32(S, Kp, Ki, Kd, 0.25f, -500.0f, 500.0f)
+#define PID_EXT_INIT_q31(S, Kp, Ki, Kd)                                 \
+    arm_pid_ext_init_q31(S, Kp, Ki, Kd, 0x20000000, 0U,                 \
+                         (q31_t) 0xC0000000, 0x40000000)
+#define PID_EXT_INIT_q15(S, Kp, Ki, Kd)                                 \
+    arm_pid_ext_init_q15(S, Kp, Ki, Kd, 0x2000, 0U,                     \
+                         (q15_t) 0xC000, 0x4000)
+
+/* Number of loops stepped by the batch test, not a multiple of 4 */
+#define PID_EXT_BATCH_LOOPS 7
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Single loop test.  The gains change half way through the block with
+  arm_pid_ext_set_gains_xxx().  The cycle count of the basic PID function is
+  displayed for comparison.
+*/
+#define ARM_PID_EXT_TEST(suffix,type)                                   \
+    JTEST_DEFINE_TEST(arm_pid_ext_##suffix##_test, arm_pid_ext_##suffix) \
+    {                                                                   \
+            uint32_t i,j;                                               \
+            const type * coeffs = controller_##suffix##_coeffs;         \
+            const type * inputs = controller_##suffix##_inputs;         \
+            type * fut = (type *) controller_output_fut;                \
+            type * ref = (type *) controller_output_ref;                \
+                                                                        \
+            arm_pid_ext_instance_##suffix fut_pid_inst;                 \
+            arm_pid_ext_instance_##suffix ref_pid_inst;                 \
+            arm_pid_instance_##suffix pid_inst = { 0 };                 \
+                                                                        \
+            for(i=0;i<(CONTROLLER_MAX_COEFFS_LEN/3)-1;i++)              \
+            {                                                           \
+                PID_EXT_INIT_##suffix(&fut_pid_inst, coeffs[i*3+0],     \
+                                      coeffs[i*3+1], coeffs[i*3+2]);    \
+                PID_EXT_INIT_##suffix(&ref_pid_inst, coeffs[i*3+0],     \
+                                      coeffs[i*3+1], coeffs[i*3+2]);    \
+                                                                        \
+                /* Display cycle count and run test */                  \
+                JTEST_DUMP_STRF("Block Size: %d\n",                     \
+                                (int)(CONTROLLER_MAX_LEN / 2));         \
+                JTEST_COUNT_CYCLES(                                     \
+                    for(j=0;j<CONTROLLER_MAX_LEN/2;j++)                 \
+                    {                                                   \
+                       fut[j] = arm_pid_ext_##suffix(&fut_pid_inst,     \
+                                                     inputs[j]);        \
+                    });                                                 \
+                                                                        \
+                arm_pid_ext_set_gains_##suffix(&fut_pid_inst,           \
+                    coeffs[i*3+3], coeffs[i*3+4], coeffs[i*3+5]);       \
+                for(j=CONTROLLER_MAX_LEN/2;j<CONTROLLER_MAX_LEN;j++)    \
+                {                                                       \
+                   fut[j] = arm_pid_ext_##suffix(&fut_pid_inst,         \
+                                                 inputs[j]);            \
+                }                                                       \
+                                                                        \
+                for(j=0;j<CONTROLLER_MAX_LEN;j++)                       \
+                {                                                       \
+                   if (j == CONTROLLER_MAX_LEN/2)                       \
+                   {                                                    \
+                       ref_pid_ext_set_gains_##suffix(&ref_pid_inst,    \
+                           coeffs[i*3+3], coeffs[i*3+4], coeffs[i*3+5]); \
+                   }                                                    \
+                   ref[j] = ref_pid_ext_##suffix(&ref_pid_inst,         \
+                                                 inputs[j]);            \
+                }                                                       \
+                                                                        \
+                /* Test the limits */                                   \
+                for(j=0;j<CONTROLLER_MAX_LEN;j++)                       \
+                {                                                       \
+                   if ((fut[j] < fut_pid_inst.outMin) ||                \
+                       (fut[j] > fut_pid_inst.outMax))                  \
+                   {                                                    \
+                       JTEST_DUMP_STRF("Output out of limits: %d\n",    \
+                                       (int)j);                         \
+                       return JTEST_TEST_FAILED;                        \
+                   }                                                    \
+                }                                                       \
+                                                                        \
+                /* Test correctness */                                  \
+                CONTROLLER_SNR_COMPARE_INTERFACE(                       \
+                        CONTROLLER_MAX_LEN,                             \
+                        type);                                          \
+            }                                                           \
+                                                                        \
+            pid_inst.Kp = coeffs[0];                                    \
+            pid_inst.Ki = coeffs[1];                                    \
+            pid_inst.Kd = coeffs[2];                                    \
+            arm_pid_init_##suffix(&pid_inst, 1);                        \
+            JTEST_DUMP_STR("Basic PID:\n");                             \
+            JTEST_COUNT_CYCLES(                                         \
+                for(j=0;j<CONTROLLER_MAX_LEN/2;j++)                     \
+                {                                                       \
+                   fut[j] = arm_pid_##suffix(&pid_inst, inputs[j]);     \
+                });                                                     \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+    }
+
+ARM_PID_EXT_TEST(f32,float32_t);
+ARM_PID_EXT_TEST(q31,q31_t);
+ARM_PID_EXT_TEST(q15,q15_t);
+
+/*
+  Batch test: PID_EXT_BATCH_LOOPS loops with different gains are stepped
+  together, each loop taking every PID_EXT_BATCH_LOOPS-th input sample.
+*/
+#define ARM_PID_EXT_BATCH_TEST(suffix,type)                             \
+    JTEST_DEFINE_TEST(arm_pid_ext_batch_##suffix##_test,                \
+                      arm_pid_ext_batch_##suffix)                       \
+    {                                                                   \
+            uint32_t j,k;                                               \
+            uint32_t numSteps = CONTROLLER_MAX_LEN / PID_EXT_BATCH_LOOPS; \
+            const type * coeffs = controller_##suffix##_coeffs;         \
+            type * fut = (type *) controller_output_fut;                \
+            type * ref = (type *) controller_output_ref;                \
+                                                                        \
+            arm_pid_ext_instance_##suffix fut_pid_inst[PID_EXT_BATCH_LOOPS]; \
+            arm_pid_ext_instance_##suffix ref_pid_inst[PID_EXT_BATCH_LOOPS]; \
+                                                                        \
+            for(k=0;k<PID_EXT_BATCH_LOOPS;k++)                          \
+            {                                                           \
+                PID_EXT_INIT_##suffix(&fut_pid_inst[k], coeffs[k*3+0],  \
+                                      coeffs[k*3+1], coeffs[k*3+2]);    \
+                PID_EXT_INIT_##suffix(&ref_pid_inst[k], coeffs[k*3+0],  \
+                                      coeffs[k*3+1], coeffs[k*3+2]);    \
+            }                                                           \
+                                                                        \
+            /* Display cycle count and run test */                      \
+            JTEST_DUMP_STRF("Loops: %d, Steps: %d\n",                   \
+                            (int)PID_EXT_BATCH_LOOPS, (int)numSteps);   \
+            JTEST_COUNT_CYCLES(                                         \
+                for(j=0;j<numSteps;j++)                                 \
+                {                                                       \
+                   arm_pid_ext_batch_##suffix(                          \
+                       fut_pid_inst,                                    \
+                       (type *) controller_##suffix##_inputs +          \
+                           j * PID_EXT_BATCH_LOOPS,                     \
+                       fut + j * PID_EXT_BATCH_LOOPS,                   \
+                       PID_EXT_BATCH_LOOPS);                            \
+                });                                                     \
+                                                                        \
+            for(j=0;j<numSteps;j++)                                     \
+            {                                                           \
+                for(k=0;k<PID_EXT_BATCH_LOOPS;k++)                      \
+                {                                                       \
+                   ref[j * PID_EXT_BATCH_LOOPS + k] =                   \
+                       ref_pid_ext_##suffix(&ref_pid_inst[k],           \
+                           controller_##suffix##_inputs[                \
+                               j * PID_EXT_BATCH_LOOPS + k]);           \
+                }                                                       \
+            }                                                           \
+                                                                        \
+            /* Test correctness */                                      \
+            CONTROLLER_SNR_COMPARE_INTERFACE(                           \
+                    numSteps * PID_EXT_BATCH_LOOPS,                     \
+                    type);                                              \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+    }
+
+ARM_PID_EXT_BATCH_TEST(f32,float32_t);
+ARM_PID_EXT_BATCH_TEST(q31,q31_t);
+ARM_PID_EXT_BATCH_TEST(q15,q15_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(pid_ext_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_pid_ext_f32_test);
+    JTEST_TEST_CALL(arm_pid_ext_q31_test);
+    JTEST_TEST_CALL(arm_pid_ext_q15_test);
+    JTEST_TEST_CALL(arm_pid_ext_batch_f32_test);
+    JTEST_TEST_CALL(arm_pid_ext_batch_q31_test);
+    JTEST_TEST_CALL(arm_pid_ext_batch_q15_test);
+}
@@ -0,0 +1,358 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"
+#include "ref.h"
+#include "type_abbrev.h"
+#include "test_templates.h"
+#include "controller_test_data.h"
+#include "controller_templates.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Grid Model */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Grid voltage sampled at 20 kHz, computed in double precision.  The grid runs at
+  50 Hz with 5% of 5th and 3% of 7th harmonic, and starts 120 degrees away from the
+  angle of a loop at rest.  Its phase jumps by 30 degrees after one segment, and its
+  frequency steps to 51 Hz after two segments.  The loops must be locked at the end
+  of each segment.
+*/
+#define PLL_PI_F64       3.14159265358979323846
+#define PLL_FS           20000.0                 /* Sampling rate, Hz */
+#define PLL_F0           50.0                    /* Nominal frequency, Hz */
+#define PLL_F1           51.0                    /* Frequency after the step, Hz */
+#define PLL_AMP          0.8                     /* Amplitude of the fundamental */
+#define PLL_H5           0.05                    /* Relative amplitude of the 5th harmonic */
+#define PLL_H7           0.03                    /* Relative amplitude of the 7th harmonic */
+#define PLL_PHASE0       (2.0 * PLL_PI_F64 / 3.0) /* Initial phase, rad */
+#define PLL_JUMP         (PLL_PI_F64 / 6.0)      /* Phase jump, rad */
+#define PLL_SEGMENT      4000                    /* 200 ms */
+#define PLL_SEGMENTS     3
+#define PLL_SETTLED      1000                    /* Samples checked at the end of each segment */
+
+/* Loops with a natural frequency of 20 Hz and a damping of 0.707 */
+#define PLL_WN           (2.0 * PLL_PI_F64 * 20.0)
+#define PLL_KP           (2.0 * 0.707 * PLL_WN / PLL_AMP)
+#define PLL_KI           (PLL_WN * PLL_WN / PLL_AMP)
+#define PLL_SOGI_GAIN    1.414213562
+
+/* Accepted errors at the end of each segment */
+#define PLL_PHASE_TOL    0.5                     /* Degrees */
+#define PLL_FREQ_TOL     0.2                     /* Hz */
+#define PLL_AMP_TOL      0.005                   /* Relative error of the mean amplitude */
+
+/* Phase error that ends the lock time, degrees */
+#define PLL_LOCK_TOL     1.0
+
+typedef struct
+{
+    float64_t phase;     /* Phase of the fundamental, rad */
+    float64_t freq;      /* Frequency, Hz */
+    float64_t v[3];      /* Phase voltages */
+} pll_grid_t;
+
+typedef struct
+{
+    float64_t phaseErr;  /* Largest phase error over the settled samples, degrees */
+    float64_t freqErr;   /* Largest frequency error over the settled samples, Hz */
+    float64_t ampSum;    /* Sum of the amplitudes over the settled samples */
+    uint32_t lock;       /* Last sample of the segment with a phase error above PLL_LOCK_TOL */
+} pll_result_t;
+
+static pll_result_t pll_results[PLL_SEGMENTS];
+
+/* Grid voltages at sample n */
+static void pll_grid_sample(uint32_t n, pll_grid_t * g)
+{
+    float64_t t = (float64_t) n / PLL_FS;
+    float64_t t1 = (float64_t) (2 * PLL_SEGMENT) / PLL_FS;
+    float64_t ph;
+    uint32_t i;
+
+    if (n < 2 * PLL_SEGMENT)
+    {
+        g->phase = 2.0 * PLL_PI_F64 * PLL_F0 * t;
+        g->freq = PLL_F0;
+    }
+    else
+    {
+        g->phase = 2.0 * PLL_PI_F64 * (PLL_F0 * t1 + PLL_F1 * (t - t1));
+        g->freq = PLL_F1;
+    }
+
+    g->phase += PLL_PHASE0;
+
+    if (n >= PLL_SEGMENT)
+    {
+        g->phase += PLL_JUMP;
+    }
+
+    for (i = 0; i < 3; i++)
+    {
+        ph = g->phase - 2.0 * PLL_PI_F64 / 3.0 * (float64_t) i;
+        g->v[i] = PLL_AMP * (cos(ph) + PLL_H5 * cos(5.0 * ph) + PLL_H7 * cos(7.0 * ph));
+    }
+}
+
+/* Accumulate the errors of the loop outputs at sample n */
+static void pll_check(
+    uint32_t n,
+    const pll_grid_t * g,
+    float64_t phase,
+    float64_t freq,
+    float64_t amp)
+{
+    pll_result_t * r = &pll_results[n / PLL_SEGMENT];
+    float64_t err;
+
+    err = phase - g->phase;
+    err = fabs(err - 2.0 * PLL_PI_F64 * floor(err / (2.0 * PLL_PI_F64) + 0.5)) * 180.0 / PLL_PI_F64;
+
+    if (err > PLL_LOCK_TOL)
+    {
+        r->lock = n % PLL_SEGMENT;
+    }
+
+    if ((n % PLL_SEGMENT) >= (PLL_SEGMENT - PLL_SETTLED))
+    {
+        r->phaseErr = (err > r->phaseErr) ? err : r->phaseErr;
+        err = fabs(freq - g->freq);
+        r->freqErr = (err > r->freqErr) ? err : r->freqErr;
+        r->ampSum += amp;
+    }
+}
+
+/* Compare the errors of each segment to the tolerances */
+static JTEST_TEST_RET_t pll_results_check(void)
+{
+    float64_t ampErr;
+    uint32_t s;
+
+    for (s = 0; s < PLL_SEGMENTS; s++)
+    {
+        ampErr = fabs(pll_results[s].ampSum / PLL_SETTLED - PLL_AMP) / PLL_AMP;
+
+        JTEST_DUMP_STRF("Segment %d: lock %f ms, phase error %f deg, "
+                        "frequency error %f Hz, amplitude error %f\n",
+                        (int)s, 1000.0 * pll_results[s].lock / PLL_FS,
+                        pll_results[s].phaseErr, pll_results[s].freqErr, ampErr);
+
+        if ((pll_results[s].phaseErr > PLL_PHASE_TOL) ||
+            (pll_results[s].freqErr > PLL_FREQ_TOL) ||
+            (ampErr > PLL_AMP_TOL))
+        {
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Separate Function Calls */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The three-phase step written with the separate Park, PID and sin_cos functions,
+  without the integrator limit.  Used to display the cycle count of the equivalent
+  sequence of calls.
+*/
+static float32_t pll_separate_f32(
+    arm_pid_instance_f32 * pid,
+    float32_t va,
+    float32_t vb,
+    float32_t vc,
+    float32_t theta)
+{
+    float32_t sinVal, cosVal, alpha, beta, d, q;
+
+    arm_sin_cos_f32(theta * 57.2957795f, &sinVal, &cosVal);
+    alpha = (2.0f * va - vb - vc) * 0.333333333f;
+    beta = (vb - vc) * 0.577350269f;
+    arm_park_f32(alpha, beta, &d, &q, sinVal, cosVal);
+    theta += (float32_t) (2.0 * PLL_PI_F64 * PLL_F0 / PLL_FS) + arm_pid_f32(pid, q);
+    return (theta >= PI) ? (theta - 2.0f * PI) : theta;
+}
+
+static q31_t pll_separate_q31(
+    arm_pid_instance_q31 * pid,
+    q31_t va,
+    q31_t vb,
+    q31_t vc,
+    q31_t theta)
+{
+    q31_t sinVal, cosVal, alpha, beta, d, q;
+
+    arm_sin_cos_q31(theta, &sinVal, &cosVal);
+    alpha = (q31_t) (((((q63_t) va * 2) - vb - vc) * 0x2AAAAAAB) >> 31);
+    beta = (q31_t) ((((q63_t) vb - vc) * 0x49E69D16) >> 31);
+    arm_park_q31(alpha, beta, &d, &q, sinVal, cosVal);
+    return (q31_t) ((uint32_t) theta + (uint32_t) (q31_t) (2.0 * PLL_F0 / PLL_FS * 2147483648.0) +
+                    (uint32_t) arm_pid_q31(pid, q));
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Closed loop tests: each step function runs on the disturbed grid from rest.  At
+  the end of each segment the phase and the frequency must be within the tolerances,
+  and the mean of the amplitude output must match the fundamental.  The lock time
+  after each disturbance is displayed.
+*/
+JTEST_DEFINE_TEST(arm_pll_sogi_f32_test, arm_pll_sogi_f32)
+{
+    arm_pll_instance_f32 S;
+    pll_grid_t g;
+    uint32_t n;
+
+    memset(pll_results, 0, sizeof(pll_results));
+    arm_pll_init_f32(&S, (float32_t) PLL_FS, (float32_t) PLL_F0, (float32_t) PLL_KP,
+                     (float32_t) PLL_KI, (float32_t) PLL_SOGI_GAIN);
+
+    for (n = 0; n < PLL_SEGMENTS * PLL_SEGMENT; n++)
+    {
+        pll_grid_sample(n, &g);
+
+        arm_pll_sogi_f32(&S, (float32_t) g.v[0]);
+
+        pll_check(n, &g, S.phase, S.freq, S.amplitude);
+    }
+
+    /* Cycle budget of one sample */
+    JTEST_DUMP_STR("One step:\n");
+    JTEST_COUNT_CYCLES(arm_pll_sogi_f32(&S, (float32_t) g.v[0]));
+
+    return pll_results_check();
+}
+
+JTEST_DEFINE_TEST(arm_pll_sogi_q31_test, arm_pll_sogi_q31)
+{
+    arm_pll_instance_q31 S;
+    pll_grid_t g;
+    q31_t v;
+    uint32_t n;
+
+    memset(pll_results, 0, sizeof(pll_results));
+    arm_pll_init_q31(&S,
+                     (q31_t) (2.0 * PLL_F0 / PLL_FS * 2147483648.0),
+                     (q31_t) (PLL_KP / (PLL_PI_F64 * PLL_FS) * 2147483648.0),
+                     (q31_t) (PLL_KI / (PLL_PI_F64 * PLL_FS * PLL_FS) * 2147483648.0),
+                     (q31_t) (PLL_SOGI_GAIN / 2.0 * 2147483648.0));
+
+    for (n = 0; n < PLL_SEGMENTS * PLL_SEGMENT; n++)
+    {
+        pll_grid_sample(n, &g);
+        v = (q31_t) (g.v[0] * 2147483648.0);
+
+        arm_pll_sogi_q31(&S, v);
+
+        pll_check(n, &g, S.phase / 2147483648.0 * PLL_PI_F64,
+                  S.freq / 2147483648.0 * PLL_FS / 2.0,
+                  S.amplitude / 2147483648.0);
+    }
+
+    /* Cycle budget of one sample */
+    JTEST_DUMP_STR("One step:\n");
+    JTEST_COUNT_CYCLES(arm_pll_sogi_q31(&S, v));
+
+    return pll_results_check();
+}
+
+JTEST_DEFINE_TEST(arm_pll_srf_f32_test, arm_pll_srf_f32)
+{
+    arm_pll_instance_f32 S;
+    arm_pid_instance_f32 pid = { 0 };
+    pll_grid_t g;
+    float32_t theta;
+    uint32_t n;
+
+    memset(pll_results, 0, sizeof(pll_results));
+    arm_pll_init_f32(&S, (float32_t) PLL_FS, (float32_t) PLL_F0, (float32_t) PLL_KP,
+                     (float32_t) PLL_KI, 0.0f);
+
+    for (n = 0; n < PLL_SEGMENTS * PLL_SEGMENT; n++)
+    {
+        pll_grid_sample(n, &g);
+
+        arm_pll_srf_f32(&S, (float32_t) g.v[0], (float32_t) g.v[1], (float32_t) g.v[2]);
+
+        pll_check(n, &g, S.phase, S.freq, S.amplitude);
+    }
+
+    /* Cycle budget of one sample */
+    JTEST_DUMP_STR("One step:\n");
+    JTEST_COUNT_CYCLES(
+        arm_pll_srf_f32(&S, (float32_t) g.v[0], (float32_t) g.v[1], (float32_t) g.v[2]));
+
+    pid.Kp = S.Kp;
+    pid.Ki = S.Ki;
+    arm_pid_init_f32(&pid, 1);
+    theta = S.theta;
+    JTEST_DUMP_STR("Separate functions:\n");
+    JTEST_COUNT_CYCLES(
+        theta = pll_separate_f32(&pid, (float32_t) g.v[0], (float32_t) g.v[1],
+                                 (float32_t) g.v[2], theta));
+
+    return pll_results_check();
+}
+
+JTEST_DEFINE_TEST(arm_pll_srf_q31_test, arm_pll_srf_q31)
+{
+    arm_pll_instance_q31 S;
+    arm_pid_instance_q31 pid = { 0 };
+    pll_grid_t g;
+    q31_t va, vb, vc, theta;
+    uint32_t n;
+
+    memset(pll_results, 0, sizeof(pll_results));
+    arm_pll_init_q31(&S,
+                     (q31_t) (2.0 * PLL_F0 / PLL_FS * 2147483648.0),
+                     (q31_t) (PLL_KP / (PLL_PI_F64 * PLL_FS) * 2147483648.0),
+                     (q31_t) (PLL_KI / (PLL_PI_F64 * PLL_FS * PLL_FS) * 2147483648.0),
+                     0);
+
+    for (n = 0; n < PLL_SEGMENTS * PLL_SEGMENT; n++)
+    {
+        pll_grid_sample(n, &g);
+        va = (q31_t) (g.v[0] * 2147483648.0);
+        vb = (q31_t) (g.v[1] * 2147483648.0);
+        vc = (q31_t) (g.v[2] * 2147483648.0);
+
+        arm_pll_srf_q31(&S, va, vb, vc);
+
+        pll_check(n, &g, S.phase / 2147483648.0 * PLL_PI_F64,
+                  S.freq / 2147483648.0 * PLL_FS / 2.0,
+                  S.amplitude / 2147483648.0);
+    }
+
+    /* Cycle budget of one sample */
+    JTEST_DUMP_STR("One step:\n");
+    JTEST_COUNT_CYCLES(arm_pll_srf_q31(&S, va, vb, vc));
+
+    pid.Kp = S.Kp;
+    pid.Ki = S.Ki;
+    arm_pid_init_q31(&pid, 1);
+    theta = S.theta;
+    JTEST_DUMP_STR("Separate functions:\n");
+    JTEST_COUNT_CYCLES(theta = pll_separate_q31(&pid, va, vb, vc, theta));
+
+    return pll_results_check();
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(pll_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_pll_sogi_f32_test);
+    JTEST_TEST_CALL(arm_pll_sogi_q31_test);
+    JTEST_TEST_CALL(arm_pll_srf_f32_test);
+    JTEST_TEST_CALL(arm_pll_srf_q31_test);
+}
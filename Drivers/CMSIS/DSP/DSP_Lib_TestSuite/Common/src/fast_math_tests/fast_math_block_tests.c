@@ -0,0 +1,407 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "fast_math_templates.h"
+#include "fast_math_test_data.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Input Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/* Inputs derived from the common fast math inputs, used as any data type */
+static float32_t fast_math_block_a[FAST_MATH_MAX_LEN];
+static float32_t fast_math_block_b[FAST_MATH_MAX_LEN];
+
+/* Number of blocks of FAST_MATH_MAX_LEN samples in an accuracy sweep */
+#define FAST_MATH_SWEEP_BLOCKS 16
+
+/* Double precision pi, the PI of ref.h is single precision */
+#define FAST_MATH_PI_F64 3.14159265358979323846
+
+/*--------------------------------------------------------------------------------*/
+/* Input Generation */
+/*--------------------------------------------------------------------------------*/
+
+/* The second coordinate of atan2 is the same data rotated by one sample. */
+static void fast_math_block_inputs_f32(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        fast_math_block_a[i] = fast_math_f32_inputs[i];
+        fast_math_block_b[i] = fast_math_f32_inputs[(i + 1) % FAST_MATH_MAX_LEN];
+    }
+}
+
+static void fast_math_block_inputs_q31(void)
+{
+    q31_t * pA = (q31_t *) fast_math_block_a;
+    q31_t * pB = (q31_t *) fast_math_block_b;
+    uint32_t i;
+
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        pA[i] = fast_math_q31_inputs[i];
+        pB[i] = fast_math_q31_inputs[(i + 1) % FAST_MATH_MAX_LEN];
+    }
+}
+
+static void fast_math_block_inputs_q15(void)
+{
+    q15_t * pA = (q15_t *) fast_math_block_a;
+    q15_t * pB = (q15_t *) fast_math_block_b;
+    uint32_t i;
+
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        pA[i] = fast_math_q15_inputs[i];
+        pB[i] = fast_math_q15_inputs[(i + 1) % FAST_MATH_MAX_LEN];
+    }
+}
+
+/* exp: negative inputs, in [-2 0) for the fixed-point versions. */
+static void fast_math_block_exp_inputs_q31(void)
+{
+    q31_t * pA = (q31_t *) fast_math_block_a;
+    uint32_t i;
+
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        pA[i] = -((fast_math_q31_inputs[i] & 0x7FFFFFFF) >> 4);
+    }
+}
+
+static void fast_math_block_exp_inputs_q15(void)
+{
+    q15_t * pA = (q15_t *) fast_math_block_a;
+    uint32_t i;
+
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        pA[i] = (q15_t) -((fast_math_q15_inputs[i] & 0x7FFF) >> 3);
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Templates */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Block function test: the output is compared to the reference with SNR.  The
+  cycle count of the scalar function called in a loop is displayed for
+  comparison.  The scalar loop writes to the reference buffer, which is then
+  overwritten by the reference function.
+*/
+#define FAST_MATH_BLOCK_TEST(func, suffix, type, setup, scalar_loop)    \
+    JTEST_DEFINE_TEST(arm_v##func##_##suffix##_test,                    \
+                      arm_v##func##_##suffix)                           \
+    {                                                                   \
+        type * pIn = (type *) fast_math_block_a;                        \
+        type * pOut = (type *) fast_math_output_ref;                    \
+        uint32_t i;                                                     \
+                                                                        \
+        setup;                                                          \
+                                                                        \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_v##func##_##suffix(                                     \
+                pIn, (type *) fast_math_output_fut,                     \
+                FAST_MATH_MAX_LEN));                                    \
+                                                                        \
+        JTEST_DUMP_STR("Scalar loop:\n");                               \
+        JTEST_COUNT_CYCLES(                                             \
+            for (i = 0; i < FAST_MATH_MAX_LEN; i++)                     \
+            {                                                           \
+                scalar_loop;                                            \
+            });                                                         \
+                                                                        \
+        ref_v##func##_##suffix(                                         \
+            pIn, (type *) fast_math_output_ref, FAST_MATH_MAX_LEN);     \
+                                                                        \
+        FAST_MATH_SNR_COMPARE_INTERFACE(                                \
+            FAST_MATH_MAX_LEN,                                          \
+            type);                                                      \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/* Same test without a scalar function to compare with. */
+#define FAST_MATH_BLOCK_TEST_NO_SCALAR(func, suffix, type, setup)       \
+    JTEST_DEFINE_TEST(arm_v##func##_##suffix##_test,                    \
+                      arm_v##func##_##suffix)                           \
+    {                                                                   \
+        type * pIn = (type *) fast_math_block_a;                        \
+                                                                        \
+        setup;                                                          \
+                                                                        \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_v##func##_##suffix(                                     \
+                pIn, (type *) fast_math_output_fut,                     \
+                FAST_MATH_MAX_LEN));                                    \
+                                                                        \
+        ref_v##func##_##suffix(                                         \
+            pIn, (type *) fast_math_output_ref, FAST_MATH_MAX_LEN);     \
+                                                                        \
+        FAST_MATH_SNR_COMPARE_INTERFACE(                                \
+            FAST_MATH_MAX_LEN,                                          \
+            type);                                                      \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+#define FAST_MATH_ATAN2_TEST(suffix, type)                              \
+    JTEST_DEFINE_TEST(arm_vatan2_##suffix##_test,                       \
+                      arm_vatan2_##suffix)                              \
+    {                                                                   \
+        fast_math_block_inputs_##suffix();                              \
+                                                                        \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_vatan2_##suffix(                                        \
+                (type *) fast_math_block_a,                             \
+                (type *) fast_math_block_b,                             \
+                (type *) fast_math_output_fut,                          \
+                FAST_MATH_MAX_LEN));                                    \
+                                                                        \
+        ref_vatan2_##suffix(                                            \
+            (type *) fast_math_block_a,                                 \
+            (type *) fast_math_block_b,                                 \
+            (type *) fast_math_output_ref,                              \
+            FAST_MATH_MAX_LEN);                                         \
+                                                                        \
+        FAST_MATH_SNR_COMPARE_INTERFACE(                                \
+            FAST_MATH_MAX_LEN,                                          \
+            type);                                                      \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+FAST_MATH_BLOCK_TEST(sin, f32, float32_t, fast_math_block_inputs_f32(),
+                     pOut[i] = arm_sin_f32(pIn[i]))
+FAST_MATH_BLOCK_TEST(sin, q31, q31_t, fast_math_block_inputs_q31(),
+                     pOut[i] = arm_sin_q31(pIn[i] & 0x7FFFFFFF))
+FAST_MATH_BLOCK_TEST(sin, q15, q15_t, fast_math_block_inputs_q15(),
+                     pOut[i] = arm_sin_q15(pIn[i] & 0x7FFF))
+
+FAST_MATH_BLOCK_TEST(cos, f32, float32_t, fast_math_block_inputs_f32(),
+                     pOut[i] = arm_cos_f32(pIn[i]))
+FAST_MATH_BLOCK_TEST(cos, q31, q31_t, fast_math_block_inputs_q31(),
+                     pOut[i] = arm_cos_q31(pIn[i] & 0x7FFFFFFF))
+FAST_MATH_BLOCK_TEST(cos, q15, q15_t, fast_math_block_inputs_q15(),
+                     pOut[i] = arm_cos_q15(pIn[i] & 0x7FFF))
+
+FAST_MATH_BLOCK_TEST(sqrt, f32, float32_t, fast_math_block_inputs_f32(),
+                     arm_sqrt_f32(pIn[i], pOut + i))
+FAST_MATH_BLOCK_TEST(sqrt, q31, q31_t, fast_math_block_inputs_q31(),
+                     arm_sqrt_q31(pIn[i], pOut + i))
+FAST_MATH_BLOCK_TEST(sqrt, q15, q15_t, fast_math_block_inputs_q15(),
+                     arm_sqrt_q15(pIn[i], pOut + i))
+
+FAST_MATH_BLOCK_TEST_NO_SCALAR(exp, f32, float32_t, fast_math_block_inputs_f32())
+FAST_MATH_BLOCK_TEST_NO_SCALAR(exp, q31, q31_t, fast_math_block_exp_inputs_q31())
+FAST_MATH_BLOCK_TEST_NO_SCALAR(exp, q15, q15_t, fast_math_block_exp_inputs_q15())
+
+FAST_MATH_BLOCK_TEST_NO_SCALAR(log, f32, float32_t, fast_math_block_inputs_f32(); arm_abs_f32(pIn, pIn, FAST_MATH_MAX_LEN))
+FAST_MATH_BLOCK_TEST_NO_SCALAR(log, q31, q31_t, fast_math_block_inputs_q31(); arm_abs_q31(pIn, pIn, FAST_MATH_MAX_LEN))
+FAST_MATH_BLOCK_TEST_NO_SCALAR(log, q15, q15_t, fast_math_block_inputs_q15(); arm_abs_q15(pIn, pIn, FAST_MATH_MAX_LEN))
+
+FAST_MATH_ATAN2_TEST(f32, float32_t)
+FAST_MATH_ATAN2_TEST(q31, q31_t)
+FAST_MATH_ATAN2_TEST(q15, q15_t)
+
+/*--------------------------------------------------------------------------------*/
+/* Accuracy Sweeps */
+/*--------------------------------------------------------------------------------*/
+
+/* Exact values of the functions, for inputs in the units of the fixed-point functions */
+static float64_t fast_math_sin_turns(float64_t x) { return sin(2.0 * FAST_MATH_PI_F64 * x); }
+static float64_t fast_math_cos_turns(float64_t x) { return cos(2.0 * FAST_MATH_PI_F64 * x); }
+
+/*
+  Maximum error of a block function over FAST_MATH_SWEEP_BLOCKS blocks of inputs
+  spread evenly on [lo hi).  Inputs are divided by in_scale and the exact result
+  multiplied by out_scale and saturated to out_max: the error is in LSB for the
+  fixed-point types.  When relative is set, the error is relative to the exact value.
+*/
+#define FAST_MATH_SWEEP_FUNCTION(suffix, type)                          \
+    static float64_t fast_math_sweep_##suffix(                          \
+        void (*fut)(type *, type *, uint32_t),                          \
+        float64_t (*exact)(float64_t),                                  \
+        float64_t lo,                                                   \
+        float64_t hi,                                                   \
+        float64_t in_scale,                                             \
+        float64_t out_scale,                                            \
+        float64_t out_max,                                              \
+        uint32_t relative)                                              \
+    {                                                                   \
+        type * pIn = (type *) fast_math_block_a;                        \
+        type * pOut = (type *) fast_math_output_fut;                    \
+        float64_t step, expected, err;                                  \
+        float64_t maxErr = 0.0;                                         \
+        uint32_t b, i;                                                  \
+                                                                        \
+        step = (hi - lo) / (FAST_MATH_SWEEP_BLOCKS * FAST_MATH_MAX_LEN); \
+                                                                        \
+        for (b = 0; b < FAST_MATH_SWEEP_BLOCKS; b++)                    \
+        {                                                               \
+            for (i = 0; i < FAST_MATH_MAX_LEN; i++)                     \
+            {                                                           \
+                pIn[i] = (type) (lo + step * (b * FAST_MATH_MAX_LEN + i)); \
+            }                                                           \
+                                                                        \
+            fut(pIn, pOut, FAST_MATH_MAX_LEN);                          \
+                                                                        \
+            for (i = 0; i < FAST_MATH_MAX_LEN; i++)                     \
+            {                                                           \
+                expected = exact((float64_t) pIn[i] / in_scale) * out_scale; \
+                expected = (expected > out_max) ? out_max : expected;   \
+                err = fabs((float64_t) pOut[i] - expected);             \
+                if (relative != 0U)                                     \
+                {                                                       \
+                    err /= fabs(expected);                              \
+                }                                                       \
+                maxErr = (err > maxErr) ? err : maxErr;                 \
+            }                                                           \
+        }                                                               \
+                                                                        \
+        return maxErr;                                                  \
+    }
+
+FAST_MATH_SWEEP_FUNCTION(f32, float32_t)
+FAST_MATH_SWEEP_FUNCTION(q31, q31_t)
+FAST_MATH_SWEEP_FUNCTION(q15, q15_t)
+
+/* Maximum error of atan2 on circles of radius r, relative to the full scale, in out_scale units */
+#define FAST_MATH_SWEEP_ATAN2_FUNCTION(suffix, type)                    \
+    static float64_t fast_math_sweep_atan2_##suffix(                    \
+        float64_t full_scale,                                           \
+        float64_t out_scale,                                            \
+        float64_t out_max)                                              \
+    {                                                                   \
+        type * pY = (type *) fast_math_block_a;                         \
+        type * pX = (type *) fast_math_block_b;                         \
+        type * pOut = (type *) fast_math_output_fut;                    \
+        float64_t angle, r, expected, err;                              \
+        float64_t maxErr = 0.0;                                         \
+        uint32_t b, i;                                                  \
+                                                                        \
+        for (b = 0; b < FAST_MATH_SWEEP_BLOCKS; b++)                    \
+        {                                                               \
+            r = full_scale / (float64_t) (1U << b);                     \
+            for (i = 0; i < FAST_MATH_MAX_LEN; i++)                     \
+            {                                                           \
+                angle = 2.0 * FAST_MATH_PI_F64 * i / FAST_MATH_MAX_LEN; \
+                pY[i] = (type) (r * sin(angle));                        \
+                pX[i] = (type) (r * cos(angle));                        \
+            }                                                           \
+                                                                        \
+            arm_vatan2_##suffix(pY, pX, pOut, FAST_MATH_MAX_LEN);       \
+                                                                        \
+            for (i = 0; i < FAST_MATH_MAX_LEN; i++)                     \
+            {                                                           \
+                expected = atan2((float64_t) pY[i], (float64_t) pX[i]) * out_scale; \
+                expected = (expected > out_max) ? out_max : expected;   \
+                err = fabs((float64_t) pOut[i] - expected);             \
+                maxErr = (err > maxErr) ? err : maxErr;                 \
+            }                                                           \
+        }                                                               \
+                                                                        \
+        return maxErr;                                                  \
+    }
+
+FAST_MATH_SWEEP_ATAN2_FUNCTION(f32, float32_t)
+FAST_MATH_SWEEP_ATAN2_FUNCTION(q31, q31_t)
+FAST_MATH_SWEEP_ATAN2_FUNCTION(q15, q15_t)
+
+/* Display the maximum error of one function and compare it to its documented bound */
+#define FAST_MATH_SWEEP_CHECK(name, sweep, bound)                       \
+    do                                                                  \
+    {                                                                   \
+        float64_t maxErr = sweep;                                       \
+                                                                        \
+        JTEST_DUMP_STRF("%s max error: %e (bound %e)\n",                \
+                        name, maxErr, (float64_t) (bound));             \
+        if (maxErr > (bound))                                           \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+    } while (0)
+
+JTEST_DEFINE_TEST(fast_math_block_sweep_f32_test, arm_vsin_f32)
+{
+    FAST_MATH_SWEEP_CHECK("sin", fast_math_sweep_f32(arm_vsin_f32, sin, -2.0 * PI, 2.0 * PI, 1.0, 1.0, DBL_MAX, 0U), 1.9e-5);
+    FAST_MATH_SWEEP_CHECK("cos", fast_math_sweep_f32(arm_vcos_f32, cos, -2.0 * PI, 2.0 * PI, 1.0, 1.0, DBL_MAX, 0U), 1.9e-5);
+    FAST_MATH_SWEEP_CHECK("sqrt", fast_math_sweep_f32(arm_vsqrt_f32, sqrt, 1.0e-3, 1.0e3, 1.0, 1.0, DBL_MAX, 1U), 6.0e-8);
+    FAST_MATH_SWEEP_CHECK("exp", fast_math_sweep_f32(arm_vexp_f32, exp, -87.0, 88.0, 1.0, 1.0, DBL_MAX, 1U), 1.1e-7);
+    FAST_MATH_SWEEP_CHECK("log", fast_math_sweep_f32(arm_vlog_f32, log, 0.5, 1.5, 1.0, 1.0, DBL_MAX, 0U), 6.0e-8);
+    FAST_MATH_SWEEP_CHECK("log", fast_math_sweep_f32(arm_vlog_f32, log, 2.0, 1.0e6, 1.0, 1.0, DBL_MAX, 1U), 1.6 * 1.19e-7);
+    FAST_MATH_SWEEP_CHECK("atan2", fast_math_sweep_atan2_f32(1.0e3, 1.0, DBL_MAX), 3.1e-7);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(fast_math_block_sweep_q31_test, arm_vsin_q31)
+{
+    FAST_MATH_SWEEP_CHECK("sin", fast_math_sweep_q31(arm_vsin_q31, fast_math_sin_turns, -2147483648.0, 2147483647.0, 2147483648.0, 2147483648.0, 2147483647.0, 0U), 1.9e-5 * 2147483648.0);
+    FAST_MATH_SWEEP_CHECK("cos", fast_math_sweep_q31(arm_vcos_q31, fast_math_cos_turns, -2147483648.0, 2147483647.0, 2147483648.0, 2147483648.0, 2147483647.0, 0U), 1.9e-5 * 2147483648.0);
+    FAST_MATH_SWEEP_CHECK("sqrt", fast_math_sweep_q31(arm_vsqrt_q31, sqrt, 0.0, 2147483647.0, 2147483648.0, 2147483648.0, 2147483647.0, 0U), 1.0);
+    FAST_MATH_SWEEP_CHECK("exp", fast_math_sweep_q31(arm_vexp_q31, exp, -2147483648.0, 0.0, 67108864.0, 2147483648.0, 2147483647.0, 0U), 3.3);
+    FAST_MATH_SWEEP_CHECK("log", fast_math_sweep_q31(arm_vlog_q31, log, 1.0, 2147483647.0, 2147483648.0, 67108864.0, 2147483647.0, 0U), 1.0);
+    FAST_MATH_SWEEP_CHECK("atan2", fast_math_sweep_atan2_q31(2147483647.0, 2147483648.0 / FAST_MATH_PI_F64, 2147483647.0), 12.0);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(fast_math_block_sweep_q15_test, arm_vsin_q15)
+{
+    FAST_MATH_SWEEP_CHECK("sin", fast_math_sweep_q15(arm_vsin_q15, fast_math_sin_turns, -32768.0, 32768.0, 32768.0, 32768.0, 32767.0, 0U), 5.0);
+    FAST_MATH_SWEEP_CHECK("cos", fast_math_sweep_q15(arm_vcos_q15, fast_math_cos_turns, -32768.0, 32768.0, 32768.0, 32768.0, 32767.0, 0U), 5.0);
+    FAST_MATH_SWEEP_CHECK("sqrt", fast_math_sweep_q15(arm_vsqrt_q15, sqrt, 0.0, 32768.0, 32768.0, 32768.0, 32767.0, 0U), 0.5);
+    FAST_MATH_SWEEP_CHECK("exp", fast_math_sweep_q15(arm_vexp_q15, exp, -32768.0, 0.0, 2048.0, 32768.0, 32767.0, 0U), 1.4);
+    FAST_MATH_SWEEP_CHECK("log", fast_math_sweep_q15(arm_vlog_q15, log, 1.0, 32768.0, 32768.0, 2048.0, 32767.0, 0U), 1.0);
+    FAST_MATH_SWEEP_CHECK("atan2", fast_math_sweep_atan2_q15(32767.0, 32768.0 / FAST_MATH_PI_F64, 32767.0), 1.0);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fast_math_block_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_vsin_f32_test);
+    JTEST_TEST_CALL(arm_vsin_q31_test);
+    JTEST_TEST_CALL(arm_vsin_q15_test);
+
+    JTEST_TEST_CALL(arm_vcos_f32_test);
+    JTEST_TEST_CALL(arm_vcos_q31_test);
+    JTEST_TEST_CALL(arm_vcos_q15_test);
+
+    JTEST_TEST_CALL(arm_vsqrt_f32_test);
+    JTEST_TEST_CALL(arm_vsqrt_q31_test);
+    JTEST_TEST_CALL(arm_vsqrt_q15_test);
+
+    JTEST_TEST_CALL(arm_vexp_f32_test);
+    JTEST_TEST_CALL(arm_vexp_q31_test);
+    JTEST_TEST_CALL(arm_vexp_q15_test);
+
+    JTEST_TEST_CALL(arm_vlog_f32_test);
+    JTEST_TEST_CALL(arm_vlog_q31_test);
+    JTEST_TEST_CALL(arm_vlog_q15_test);
+
+    JTEST_TEST_CALL(arm_vatan2_f32_test);
+    JTEST_TEST_CALL(arm_vatan2_q31_test);
+    JTEST_TEST_CALL(arm_vatan2_q15_test);
+
+    JTEST_TEST_CALL(fast_math_block_sweep_f32_test);
+    JTEST_TEST_CALL(fast_math_block_sweep_q31_test);
+    JTEST_TEST_CALL(fast_math_block_sweep_q15_test);
+}
@@ -0,0 +1,297 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "fast_math_templates.h"
+#include "fast_math_test_data.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Input Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/* Numerators and denominators, used as any data type */
+static q31_t fast_math_divide_a[FAST_MATH_MAX_LEN];
+static q31_t fast_math_divide_b[FAST_MATH_MAX_LEN];
+
+/* Quotient shifts of the function under test and of the reference */
+static int16_t fast_math_divide_shift_fut[FAST_MATH_MAX_LEN];
+static int16_t fast_math_divide_shift_ref[FAST_MATH_MAX_LEN];
+
+/* Number of inputs replaced by edge cases */
+#define FAST_MATH_DIVIDE_EDGES 8
+
+static const q31_t fast_math_divide_edges_q31[2 * FAST_MATH_DIVIDE_EDGES] =
+{
+    INT_MIN, 1,     INT_MIN, -1,    INT_MIN, INT_MIN,   0x7FFFFFFF, INT_MIN,
+    1, 0x7FFFFFFF,  -1, INT_MIN,    0x1234, 0,          0, 0x1234
+};
+
+static const q15_t fast_math_divide_edges_q15[2 * FAST_MATH_DIVIDE_EDGES] =
+{
+    SHRT_MIN, 1,    SHRT_MIN, -1,   SHRT_MIN, SHRT_MIN, 0x7FFF, SHRT_MIN,
+    1, 0x7FFF,      -1, SHRT_MIN,   0x123, 0,           0, 0x123
+};
+
+/*--------------------------------------------------------------------------------*/
+/* Input Generation */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The magnitudes are spread over the whole range with shifts, the signs
+  alternate, and the first inputs are edge cases.
+*/
+static void fast_math_divide_inputs_q31(void)
+{
+    q31_t * pA = fast_math_divide_a;
+    q31_t * pB = fast_math_divide_b;
+    uint32_t i;
+
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        pA[i] = fast_math_q31_inputs[i] >> (i % 31U);
+        pB[i] = fast_math_q31_inputs[(i + 1U) % FAST_MATH_MAX_LEN] >> ((7U * i) % 31U);
+        pA[i] = ((i & 1U) != 0U) ? -pA[i] : pA[i];
+        pB[i] = ((i & 2U) != 0U) ? -pB[i] : pB[i];
+        pB[i] = (pB[i] == 0) ? 1 : pB[i];
+    }
+
+    for (i = 0; i < FAST_MATH_DIVIDE_EDGES; i++)
+    {
+        pA[i] = fast_math_divide_edges_q31[2U * i];
+        pB[i] = fast_math_divide_edges_q31[(2U * i) + 1U];
+    }
+}
+
+static void fast_math_divide_inputs_q15(void)
+{
+    q15_t * pA = (q15_t *) fast_math_divide_a;
+    q15_t * pB = (q15_t *) fast_math_divide_b;
+    uint32_t i;
+
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        pA[i] = (q15_t) (fast_math_q15_inputs[i] >> (i % 15U));
+        pB[i] = (q15_t) (fast_math_q15_inputs[(i + 1U) % FAST_MATH_MAX_LEN] >> ((7U * i) % 15U));
+        pA[i] = ((i & 1U) != 0U) ? (q15_t) -pA[i] : pA[i];
+        pB[i] = ((i & 2U) != 0U) ? (q15_t) -pB[i] : pB[i];
+        pB[i] = (pB[i] == 0) ? 1 : pB[i];
+    }
+
+    for (i = 0; i < FAST_MATH_DIVIDE_EDGES; i++)
+    {
+        pA[i] = fast_math_divide_edges_q15[2U * i];
+        pB[i] = fast_math_divide_edges_q15[(2U * i) + 1U];
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Divide the whole input buffers with the scalar function, or with the C
+  integer division of the reference, for the cycle counts.
+*/
+#define FAST_MATH_DIVIDE_LOOP(prefix, suffix)                           \
+    static arm_status prefix##_divide_loop_##suffix(                    \
+        TYPE_FROM_ABBREV(suffix) * pQuotient,                           \
+        int16_t * pShift)                                               \
+    {                                                                   \
+        TYPE_FROM_ABBREV(suffix) * pA =                                 \
+            (TYPE_FROM_ABBREV(suffix) *) fast_math_divide_a;            \
+        TYPE_FROM_ABBREV(suffix) * pB =                                 \
+            (TYPE_FROM_ABBREV(suffix) *) fast_math_divide_b;            \
+        arm_status status = ARM_MATH_SUCCESS;                           \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0; i < FAST_MATH_MAX_LEN; i++)                         \
+        {                                                               \
+            if (prefix##_divide_##suffix(pA[i], pB[i], &pQuotient[i],   \
+                                         &pShift[i]) != ARM_MATH_SUCCESS) \
+            {                                                           \
+                status = ARM_MATH_NANINF;                               \
+            }                                                           \
+        }                                                               \
+                                                                        \
+        return status;                                                  \
+    }
+
+FAST_MATH_DIVIDE_LOOP(arm, q31)
+FAST_MATH_DIVIDE_LOOP(arm, q15)
+FAST_MATH_DIVIDE_LOOP(ref, q31)
+FAST_MATH_DIVIDE_LOOP(ref, q15)
+
+/* Exact comparison of the quotients and of the shifts */
+#define FAST_MATH_DIVIDE_COMPARE(type, pFut, pRef, pShiftFut, pShiftRef) \
+    do                                                                  \
+    {                                                                   \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0; i < FAST_MATH_MAX_LEN; i++)                         \
+        {                                                               \
+            if ((((type *) (pFut))[i] != ((type *) (pRef))[i]) ||       \
+                ((pShiftFut)[i] != (pShiftRef)[i]))                     \
+            {                                                           \
+                JTEST_DUMP_STRF("Mismatch at %d: %d / %d\n", (int) i,   \
+                                (int) ((type *) fast_math_divide_a)[i], \
+                                (int) ((type *) fast_math_divide_b)[i]); \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+        }                                                               \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Scalar division test: the quotients, shifts and status must be the same as
+  those of the integer division.
+*/
+#define FAST_MATH_DIVIDE_TEST(suffix)                                   \
+    JTEST_DEFINE_TEST(arm_divide_##suffix##_test,                       \
+                      arm_divide_##suffix)                              \
+    {                                                                   \
+        arm_status status_fut, status_ref;                              \
+                                                                        \
+        fast_math_divide_inputs_##suffix();                             \
+                                                                        \
+        JTEST_COUNT_CYCLES(                                             \
+            status_fut = arm_divide_loop_##suffix(                      \
+                (TYPE_FROM_ABBREV(suffix) *) fast_math_output_fut,      \
+                fast_math_divide_shift_fut));                           \
+                                                                        \
+        JTEST_DUMP_STR("Integer division:\n");                          \
+        JTEST_COUNT_CYCLES(                                             \
+            status_ref = ref_divide_loop_##suffix(                      \
+                (TYPE_FROM_ABBREV(suffix) *) fast_math_output_ref,      \
+                fast_math_divide_shift_ref));                           \
+                                                                        \
+        if (status_fut != status_ref)                                   \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+                                                                        \
+        FAST_MATH_DIVIDE_COMPARE(TYPE_FROM_ABBREV(suffix),              \
+                                 fast_math_output_fut,                  \
+                                 fast_math_output_ref,                  \
+                                 fast_math_divide_shift_fut,            \
+                                 fast_math_divide_shift_ref);           \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+FAST_MATH_DIVIDE_TEST(q31);
+FAST_MATH_DIVIDE_TEST(q15);
+
+/*
+  Block division test: the saturated quotients must be the same as those of
+  the integer division.
+*/
+#define FAST_MATH_VDIVIDE_TEST(suffix)                                  \
+    JTEST_DEFINE_TEST(arm_vdivide_##suffix##_test,                      \
+                      arm_vdivide_##suffix)                             \
+    {                                                                   \
+        uint32_t i;                                                     \
+                                                                        \
+        fast_math_divide_inputs_##suffix();                             \
+                                                                        \
+        for (i = 0; i < FAST_MATH_MAX_LEN; i++)                         \
+        {                                                               \
+            fast_math_divide_shift_fut[i] = 0;                          \
+            fast_math_divide_shift_ref[i] = 0;                          \
+        }                                                               \
+                                                                        \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_vdivide_##suffix(                                       \
+                (TYPE_FROM_ABBREV(suffix) *) fast_math_divide_a,        \
+                (TYPE_FROM_ABBREV(suffix) *) fast_math_divide_b,        \
+                (TYPE_FROM_ABBREV(suffix) *) fast_math_output_fut,      \
+                FAST_MATH_MAX_LEN));                                    \
+                                                                        \
+        JTEST_DUMP_STR("Integer division:\n");                          \
+        JTEST_COUNT_CYCLES(                                             \
+            ref_vdivide_##suffix(                                       \
+                (TYPE_FROM_ABBREV(suffix) *) fast_math_divide_a,        \
+                (TYPE_FROM_ABBREV(suffix) *) fast_math_divide_b,        \
+                (TYPE_FROM_ABBREV(suffix) *) fast_math_output_ref,      \
+                FAST_MATH_MAX_LEN));                                    \
+                                                                        \
+        FAST_MATH_DIVIDE_COMPARE(TYPE_FROM_ABBREV(suffix),              \
+                                 fast_math_output_fut,                  \
+                                 fast_math_output_ref,                  \
+                                 fast_math_divide_shift_fut,            \
+                                 fast_math_divide_shift_ref);           \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+FAST_MATH_VDIVIDE_TEST(q31);
+FAST_MATH_VDIVIDE_TEST(q15);
+
+/*
+  Count of leading sign bits and normalization test, against a bit by bit
+  count.  The normalized values must keep the sign and have no redundant sign
+  bit left.
+*/
+JTEST_DEFINE_TEST(arm_norm_test, arm_norm_q31)
+{
+    q31_t x31, norm31;
+    q15_t x15, norm15;
+    uint32_t i, count;
+
+    fast_math_divide_inputs_q31();
+
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        x31 = fast_math_divide_a[i];
+        count = 0;
+        while ((count < 31U) && (((x31 << count) ^ (x31 << (count + 1U))) >= 0))
+        {
+            count++;
+        }
+
+        if ((arm_cls_q31(x31) != count) ||
+            (arm_norm_q31(x31, &norm31) != count) ||
+            (norm31 != (q31_t) ((uint32_t) x31 << count)))
+        {
+            JTEST_DUMP_STRF("Mismatch for 0x%x\n", (int) x31);
+            return JTEST_TEST_FAILED;
+        }
+
+        x15 = (q15_t) (x31 >> 16);
+        count = 0;
+        while ((count < 15U) && ((((q31_t) x15 << (count + 16U)) ^ ((q31_t) x15 << (count + 17U))) >= 0))
+        {
+            count++;
+        }
+
+        if ((arm_cls_q15(x15) != count) ||
+            (arm_norm_q15(x15, &norm15) != count) ||
+            (norm15 != (q15_t) ((uint32_t) x15 << count)))
+        {
+            JTEST_DUMP_STRF("Mismatch for 0x%x\n", (int) x15);
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fast_math_divide_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_divide_q31_test);
+    JTEST_TEST_CALL(arm_divide_q15_test);
+
+    JTEST_TEST_CALL(arm_vdivide_q31_test);
+    JTEST_TEST_CALL(arm_vdivide_q15_test);
+
+    JTEST_TEST_CALL(arm_norm_test);
+}
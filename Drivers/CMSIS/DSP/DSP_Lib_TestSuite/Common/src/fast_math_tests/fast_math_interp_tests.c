@@ -0,0 +1,450 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "fast_math_templates.h"
+#include "fast_math_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Input Data */
+/*--------------------------------------------------------------------------------*/
+
+/* Number of points of each block, odd to run the remainder loops */
+#define INTERP_BLOCK_SIZE 509U
+
+/* Uniform table: one period of a sine wave */
+#define INTERP_UNIFORM_LEN 65U
+
+/* Non-uniform table: breakpoints dense at the start */
+#define INTERP_NU_LEN 33U
+
+/* Number of bins of the floating-point indexes and bits of the Q15 index */
+#define INTERP_INDEX_LEN  32U
+#define INTERP_INDEX_BITS 6U
+
+#define INTERP_SNR_THRESHOLD_f32    110
+#define INTERP_SNR_THRESHOLD_spline 100
+
+/* Maximum error of the Q15 piecewise linear interpolation, in LSB */
+#define INTERP_TOL_q15 1.5f
+
+static float32_t interp_uniform_x[INTERP_UNIFORM_LEN];
+static float32_t interp_uniform_f32[INTERP_UNIFORM_LEN];
+static q31_t interp_uniform_q31[INTERP_UNIFORM_LEN];
+static q15_t interp_uniform_q15[INTERP_UNIFORM_LEN];
+
+static float32_t interp_nu_x_f32[INTERP_NU_LEN];
+static float32_t interp_nu_y_f32[INTERP_NU_LEN];
+static q15_t interp_nu_x_q15[INTERP_NU_LEN];
+static q15_t interp_nu_y_q15[INTERP_NU_LEN];
+
+static float32_t interp_input_f32[INTERP_BLOCK_SIZE];
+static q31_t interp_input_q31[INTERP_BLOCK_SIZE];
+static q15_t interp_input_q15[INTERP_BLOCK_SIZE];
+
+static float32_t interp_coeffs[3U * (INTERP_NU_LEN - 1U)];
+static float32_t interp_scratch[2U * INTERP_NU_LEN];
+static q31_t interp_slopes_q31[INTERP_NU_LEN - 1U];
+static uint16_t interp_index[1U << INTERP_INDEX_BITS];
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Fill the tables and the inputs.  The inputs sweep past both ends of the
+  tables.
+*/
+static void interp_make_tables(void)
+{
+    float32_t r;
+    uint32_t i;
+
+    for (i = 0; i < INTERP_UNIFORM_LEN; i++)
+    {
+        interp_uniform_x[i] = (float32_t) i * (2.0f * PI / 64.0f);
+        interp_uniform_f32[i] = sinf(interp_uniform_x[i]);
+    }
+    arm_float_to_q31(interp_uniform_f32, interp_uniform_q31, INTERP_UNIFORM_LEN);
+    arm_float_to_q15(interp_uniform_f32, interp_uniform_q15, INTERP_UNIFORM_LEN);
+
+    for (i = 0; i < INTERP_NU_LEN; i++)
+    {
+        r = (float32_t) i / (float32_t) (INTERP_NU_LEN - 1U);
+        interp_nu_x_f32[i] = (100.0f * r * r) - 20.0f;
+        interp_nu_y_f32[i] = sinf(interp_nu_x_f32[i] / 15.0f);
+        interp_nu_x_q15[i] = (q15_t) (-30000 + (int32_t) ((i * i * 60000U) / 1024U));
+        interp_nu_y_q15[i] = (q15_t) (20000.0f * sinf(0.2f * (float32_t) i));
+    }
+
+    for (i = 0; i < INTERP_BLOCK_SIZE; i++)
+    {
+        interp_input_f32[i] = -0.1f + (1.2f * (float32_t) i / (float32_t) (INTERP_BLOCK_SIZE - 1U));
+
+        /* 12.20 format, from -1 to 66 */
+        interp_input_q31[i] = (q31_t) ((-1.0f + (67.0f * interp_input_f32[i] + 6.7f) / 1.2f)
+                                       * 1048576.0f);
+        interp_input_q15[i] = (q15_t) (-32768 + (int32_t) ((i * 65535U) / (INTERP_BLOCK_SIZE - 1U)));
+    }
+}
+
+/*
+  Map the inputs into fast_math_output_f32_fut, [0 1] to [lo hi].  The
+  inputs go 10% of the range past each end.
+*/
+static void interp_scale_inputs(float32_t lo, float32_t hi)
+{
+    uint32_t i;
+
+    for (i = 0; i < INTERP_BLOCK_SIZE; i++)
+    {
+        fast_math_output_f32_fut[i] = lo + ((hi - lo) * interp_input_f32[i]);
+    }
+}
+
+/*
+  The scalar interpolation in a loop, for the benchmark.
+*/
+static void interp_scalar_f32(arm_linear_interp_instance_f32 * S,
+                              float32_t * pSrc, float32_t * pDst, uint32_t blockSize)
+{
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++)
+    {
+        pDst[i] = arm_linear_interp_f32(S, pSrc[i]);
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Uniform table, compared to the reference on the same breakpoints.
+*/
+JTEST_DEFINE_TEST(arm_linear_interp_block_f32_test,
+                  arm_linear_interp_block_f32)
+{
+    arm_linear_interp_instance_f32 S = {INTERP_UNIFORM_LEN, 0.0f, 2.0f * PI / 64.0f,
+                                        interp_uniform_f32};
+
+    interp_make_tables();
+    interp_scale_inputs(0.0f, 2.0f * PI);
+
+    JTEST_COUNT_CYCLES(
+        arm_linear_interp_block_f32(&S, fast_math_output_f32_fut,
+                                    fast_math_output_fut, INTERP_BLOCK_SIZE));
+
+    ref_pwl_f32(interp_uniform_x, interp_uniform_f32, INTERP_UNIFORM_LEN,
+                fast_math_output_f32_fut, fast_math_output_ref, INTERP_BLOCK_SIZE);
+
+    TEST_ASSERT_SNR(fast_math_output_ref, fast_math_output_fut,
+                    INTERP_BLOCK_SIZE, INTERP_SNR_THRESHOLD_f32);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  The points out of the uint32_t range of positions return the end values,
+  and a NaN returns the first value.
+*/
+JTEST_DEFINE_TEST(arm_linear_interp_block_f32_clamp_test,
+                  arm_linear_interp_block_f32)
+{
+    arm_linear_interp_instance_f32 S = {INTERP_UNIFORM_LEN, 0.0f, 2.0f * PI / 64.0f,
+                                        interp_uniform_f32};
+    float32_t input[5] = {NAN, 1.0e20f, -1.0e20f, INFINITY, -INFINITY};
+    uint32_t ends[5] = {0U, INTERP_UNIFORM_LEN - 1U, 0U, INTERP_UNIFORM_LEN - 1U, 0U};
+    float32_t output[5];
+    uint32_t i;
+
+    interp_make_tables();
+
+    arm_linear_interp_block_f32(&S, input, output, 5U);
+
+    for (i = 0; i < 5U; i++)
+    {
+        if (output[i] != interp_uniform_f32[ends[i]])
+        {
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  The fixed-point block functions must match the scalar ones exactly.
+*/
+#define INTERP_BLOCK_DEFINE_TEST(suffix, type)                              \
+    JTEST_DEFINE_TEST(arm_linear_interp_block_##suffix##_test,              \
+                      arm_linear_interp_block_##suffix)                     \
+    {                                                                       \
+        type * out = (type *) fast_math_output_fut;                         \
+        uint32_t i;                                                         \
+                                                                            \
+        interp_make_tables();                                               \
+                                                                            \
+        JTEST_COUNT_CYCLES(                                                 \
+            arm_linear_interp_block_##suffix(                               \
+                interp_uniform_##suffix, interp_input_q31, out,             \
+                INTERP_UNIFORM_LEN, INTERP_BLOCK_SIZE));                    \
+                                                                            \
+        for (i = 0; i < INTERP_BLOCK_SIZE; i++)                             \
+        {                                                                   \
+            if (out[i] != arm_linear_interp_##suffix(                       \
+                    interp_uniform_##suffix, interp_input_q31[i],           \
+                    INTERP_UNIFORM_LEN))                                    \
+            {                                                               \
+                JTEST_DUMP_STRF("Mismatch at point %d\n", (int)i);          \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+INTERP_BLOCK_DEFINE_TEST(q31, q31_t);
+INTERP_BLOCK_DEFINE_TEST(q15, q15_t);
+
+/*
+  Non-uniform table, with the index and with the binary search.
+*/
+JTEST_DEFINE_TEST(arm_pwl_f32_test,
+                  arm_pwl_f32)
+{
+    arm_pwl_instance_f32 S;
+    uint32_t indexed;
+
+    interp_make_tables();
+    interp_scale_inputs(-30.0f, 90.0f);
+
+    ref_pwl_f32(interp_nu_x_f32, interp_nu_y_f32, INTERP_NU_LEN,
+                fast_math_output_f32_fut, fast_math_output_ref, INTERP_BLOCK_SIZE);
+
+    for (indexed = 0; indexed < 2; indexed++)
+    {
+        JTEST_DUMP_STRF("Index: %d\n", (int)indexed);
+
+        if (arm_pwl_init_f32(&S, INTERP_NU_LEN, interp_nu_x_f32, interp_nu_y_f32,
+                             fast_math_output_f32_ref,
+                             (indexed != 0) ? interp_index : NULL,
+                             INTERP_INDEX_LEN) != ARM_MATH_SUCCESS)
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        JTEST_COUNT_CYCLES(
+            arm_pwl_f32(&S, fast_math_output_f32_fut, fast_math_output_fut,
+                        INTERP_BLOCK_SIZE));
+
+        TEST_ASSERT_SNR(fast_math_output_ref, fast_math_output_fut,
+                        INTERP_BLOCK_SIZE, INTERP_SNR_THRESHOLD_f32);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Q15 table over the whole Q15 range, compared to the floating-point
+  reference.
+*/
+JTEST_DEFINE_TEST(arm_pwl_q15_test,
+                  arm_pwl_q15)
+{
+    arm_pwl_instance_q15 S;
+    q15_t * out = (q15_t *) fast_math_output_fut;
+    float32_t err;
+    uint32_t indexed;
+    uint32_t i;
+
+    interp_make_tables();
+
+    /* The reference in LSB */
+    for (i = 0; i < INTERP_NU_LEN; i++)
+    {
+        interp_nu_x_f32[i] = (float32_t) interp_nu_x_q15[i];
+        interp_nu_y_f32[i] = (float32_t) interp_nu_y_q15[i];
+    }
+    for (i = 0; i < INTERP_BLOCK_SIZE; i++)
+    {
+        fast_math_output_f32_fut[i] = (float32_t) interp_input_q15[i];
+    }
+    ref_pwl_f32(interp_nu_x_f32, interp_nu_y_f32, INTERP_NU_LEN,
+                fast_math_output_f32_fut, fast_math_output_ref, INTERP_BLOCK_SIZE);
+
+    for (indexed = 0; indexed < 2; indexed++)
+    {
+        JTEST_DUMP_STRF("Index: %d\n", (int)indexed);
+
+        if (arm_pwl_init_q15(&S, INTERP_NU_LEN, interp_nu_x_q15, interp_nu_y_q15,
+                             interp_slopes_q31,
+                             (indexed != 0) ? interp_index : NULL,
+                             INTERP_INDEX_BITS) != ARM_MATH_SUCCESS)
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        JTEST_COUNT_CYCLES(
+            arm_pwl_q15(&S, interp_input_q15, out, INTERP_BLOCK_SIZE));
+
+        for (i = 0; i < INTERP_BLOCK_SIZE; i++)
+        {
+            err = fabsf((float32_t) out[i] - fast_math_output_ref[i]);
+            if (err > INTERP_TOL_q15)
+            {
+                JTEST_DUMP_STRF("Point %d: %d, expected %f\n", (int)i,
+                                (int)out[i], (double)fast_math_output_ref[i]);
+                return JTEST_TEST_FAILED;
+            }
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Both end conditions, with the index and with the binary search.
+*/
+JTEST_DEFINE_TEST(arm_spline_f32_test,
+                  arm_spline_f32)
+{
+    arm_spline_instance_f32 S;
+    uint32_t type;
+    uint32_t indexed;
+
+    interp_make_tables();
+    interp_scale_inputs(-30.0f, 90.0f);
+
+    for (type = ARM_SPLINE_NATURAL; type <= ARM_SPLINE_PARABOLIC_RUNOUT; type++)
+    {
+        ref_spline_f32((arm_spline_type) type, interp_nu_x_f32, interp_nu_y_f32,
+                       INTERP_NU_LEN, fast_math_output_f32_fut,
+                       fast_math_output_ref, INTERP_BLOCK_SIZE);
+
+        for (indexed = 0; indexed < 2; indexed++)
+        {
+            JTEST_DUMP_STRF("Type: %d\nIndex: %d\n", (int)type, (int)indexed);
+
+            if (arm_spline_init_f32(&S, (arm_spline_type) type, INTERP_NU_LEN,
+                                    interp_nu_x_f32, interp_nu_y_f32,
+                                    interp_coeffs, interp_scratch,
+                                    (indexed != 0) ? interp_index : NULL,
+                                    INTERP_INDEX_LEN) != ARM_MATH_SUCCESS)
+            {
+                return JTEST_TEST_FAILED;
+            }
+
+            JTEST_COUNT_CYCLES(
+                arm_spline_f32(&S, fast_math_output_f32_fut,
+                               fast_math_output_fut, INTERP_BLOCK_SIZE));
+
+            TEST_ASSERT_SNR(fast_math_output_ref, fast_math_output_fut,
+                            INTERP_BLOCK_SIZE, INTERP_SNR_THRESHOLD_spline);
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Tables that are not strictly increasing and wrong index sizes are
+  rejected.
+*/
+JTEST_DEFINE_TEST(arm_interp_init_test,
+                  arm_pwl_init_f32)
+{
+    arm_pwl_instance_f32 pwl_f32;
+    arm_pwl_instance_q15 pwl_q15;
+    arm_spline_instance_f32 spline;
+    static const float32_t x_f32[3] = {0.0f, 1.0f, 1.0f};
+    static const q15_t x_q15[3] = {0, 2, 1};
+
+    interp_make_tables();
+
+    if ((arm_pwl_init_f32(&pwl_f32, 3, x_f32, interp_nu_y_f32,
+                          interp_scratch, NULL, 0) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_pwl_init_f32(&pwl_f32, 1, interp_nu_x_f32, interp_nu_y_f32,
+                          interp_scratch, NULL, 0) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_pwl_init_f32(&pwl_f32, INTERP_NU_LEN, interp_nu_x_f32, interp_nu_y_f32,
+                          interp_scratch, interp_index, 0) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_pwl_init_q15(&pwl_q15, 3, x_q15, interp_nu_y_q15,
+                          interp_slopes_q31, NULL, 0) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_pwl_init_q15(&pwl_q15, INTERP_NU_LEN, interp_nu_x_q15, interp_nu_y_q15,
+                          interp_slopes_q31, interp_index, 17) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_spline_init_f32(&spline, ARM_SPLINE_NATURAL, 3, x_f32, interp_nu_y_f32,
+                             interp_coeffs, interp_scratch, NULL, 0) != ARM_MATH_ARGUMENT_ERROR))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Throughput of the block functions against the scalar call in a loop,
+  and of the index against the binary search.
+*/
+JTEST_DEFINE_TEST(arm_interp_benchmark,
+                  arm_linear_interp_block_f32)
+{
+    arm_linear_interp_instance_f32 S = {INTERP_UNIFORM_LEN, 0.0f, 2.0f * PI / 64.0f,
+                                        interp_uniform_f32};
+    arm_pwl_instance_f32 pwl;
+
+    interp_make_tables();
+
+    /* The scalar function needs the points below the last breakpoint */
+    interp_scale_inputs(0.6f, 5.6f);
+
+    JTEST_DUMP_STRF("Method: %s\n", "scalar");
+    JTEST_COUNT_CYCLES(
+        interp_scalar_f32(&S, fast_math_output_f32_fut, fast_math_output_ref,
+                          INTERP_BLOCK_SIZE));
+
+    JTEST_DUMP_STRF("Method: %s\n", "block");
+    JTEST_COUNT_CYCLES(
+        arm_linear_interp_block_f32(&S, fast_math_output_f32_fut,
+                                    fast_math_output_fut, INTERP_BLOCK_SIZE));
+
+    TEST_ASSERT_SNR(fast_math_output_ref, fast_math_output_fut,
+                    INTERP_BLOCK_SIZE, INTERP_SNR_THRESHOLD_f32);
+
+    arm_pwl_init_f32(&pwl, INTERP_UNIFORM_LEN, interp_uniform_x, interp_uniform_f32,
+                     fast_math_output_f32_ref, NULL, 0);
+    JTEST_DUMP_STRF("Method: %s\n", "non-uniform, binary search");
+    JTEST_COUNT_CYCLES(
+        arm_pwl_f32(&pwl, fast_math_output_f32_fut, fast_math_output_fut,
+                    INTERP_BLOCK_SIZE));
+
+    arm_pwl_init_f32(&pwl, INTERP_UNIFORM_LEN, interp_uniform_x, interp_uniform_f32,
+                     fast_math_output_f32_ref, interp_index, INTERP_UNIFORM_LEN - 1U);
+    JTEST_DUMP_STRF("Method: %s\n", "non-uniform, index");
+    JTEST_COUNT_CYCLES(
+        arm_pwl_f32(&pwl, fast_math_output_f32_fut, fast_math_output_fut,
+                    INTERP_BLOCK_SIZE));
+
+    TEST_ASSERT_SNR(fast_math_output_ref, fast_math_output_fut,
+                    INTERP_BLOCK_SIZE, INTERP_SNR_THRESHOLD_f32);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fast_math_interp_tests)
+{
+    JTEST_TEST_CALL(arm_linear_interp_block_f32_test);
+    JTEST_TEST_CALL(arm_linear_interp_block_f32_clamp_test);
+    JTEST_TEST_CALL(arm_linear_interp_block_q31_test);
+    JTEST_TEST_CALL(arm_linear_interp_block_q15_test);
+    JTEST_TEST_CALL(arm_pwl_f32_test);
+    JTEST_TEST_CALL(arm_pwl_q15_test);
+    JTEST_TEST_CALL(arm_spline_f32_test);
+    JTEST_TEST_CALL(arm_interp_init_test);
+    JTEST_TEST_CALL(arm_interp_benchmark);
+}
@@ -0,0 +1,237 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "fast_math_templates.h"
+#include "fast_math_test_data.h"
+#include "type_abbrev.h"
+
+/* Number of blocks of a test, the phase must be continuous between them */
+#define FAST_MATH_NCO_BLOCKS 8
+
+/* Odd block length, to run the remainder loops */
+#define FAST_MATH_NCO_BLOCK_SIZE 509
+
+/* Double precision pi, the PI of ref.h is single precision */
+#define FAST_MATH_NCO_PI_F64 3.14159265358979323846
+
+/* Maximum absolute errors of the outputs, 1.2e-7 and 4e-8 with a margin for f32 and q31 */
+#define FAST_MATH_NCO_TOL_f32 1.5e-7
+#define FAST_MATH_NCO_TOL_q31 4.5e-8
+#define FAST_MATH_NCO_TOL_q15 (1.0 / 32768.0)
+
+/* Full scale of the fixed-point types */
+#define FAST_MATH_NCO_ONE_f32 1.0
+#define FAST_MATH_NCO_ONE_q31 2147483648.0
+#define FAST_MATH_NCO_ONE_q15 32768.0
+
+/* Phase increments of the tests: slow, fast, negative and near Nyquist */
+static const uint32_t fast_math_nco_incs[] = {0x00012345U, 0x12345679U, 0xF0000001U, 0x7FFFFFFFU};
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/* Phase of the sample n of a block in radians */
+static float64_t fast_math_nco_phase(uint32_t phase0, uint32_t inc, uint32_t n)
+{
+    uint32_t phase = phase0 + inc * n;
+
+    return (2.0 * FAST_MATH_NCO_PI_F64 * (float64_t) phase) / 4294967296.0;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Oscillator test template.  Arguments are: function name, instance suffix,
+  output suffix, output type, number of values per sample, and the reference
+  value of the output k of sample n at phase p.  The outputs of successive
+  blocks are compared to the reference computed in double precision.
+*/
+#define NCO_DEFINE_TEST(fn, inst_suffix, suffix, type, width, ref)          \
+    JTEST_DEFINE_TEST(arm_nco_##fn##_##suffix##_test,                       \
+                      arm_nco_##fn##_##suffix)                              \
+    {                                                                       \
+        arm_nco_instance_##inst_suffix nco_inst;                            \
+        type * out = (type *) fast_math_output_fut;                         \
+        float64_t p, err;                                                   \
+        float64_t max_err = 0.0;                                            \
+        uint32_t phase0;                                                    \
+        uint32_t i, b, n, k;                                                \
+                                                                            \
+        for (i = 0; i < sizeof(fast_math_nco_incs) / sizeof(fast_math_nco_incs[0]); i++) \
+        {                                                                   \
+            nco_inst.phase = 0x40000000U;                                   \
+            nco_inst.phaseInc = fast_math_nco_incs[i];                      \
+                                                                            \
+            for (b = 0; b < FAST_MATH_NCO_BLOCKS; b++)                      \
+            {                                                               \
+                phase0 = nco_inst.phase;                                    \
+                                                                            \
+                JTEST_COUNT_CYCLES(                                         \
+                    arm_nco_##fn##_##suffix(&nco_inst, out,                 \
+                                            FAST_MATH_NCO_BLOCK_SIZE));     \
+                                                                            \
+                for (n = 0; n < FAST_MATH_NCO_BLOCK_SIZE; n++)              \
+                {                                                           \
+                    p = fast_math_nco_phase(phase0, nco_inst.phaseInc, n);  \
+                    for (k = 0; k < width; k++)                             \
+                    {                                                       \
+                        err = fabs((float64_t) out[width * n + k] /         \
+                                   FAST_MATH_NCO_ONE_##suffix - (ref));     \
+                        max_err = (err > max_err) ? err : max_err;          \
+                    }                                                       \
+                }                                                           \
+                                                                            \
+                if (nco_inst.phase != phase0 +                              \
+                    FAST_MATH_NCO_BLOCK_SIZE * nco_inst.phaseInc)           \
+                {                                                           \
+                    return JTEST_TEST_FAILED;                               \
+                }                                                           \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        JTEST_DUMP_STRF("Maximum error: %.3e\n", max_err);                  \
+                                                                            \
+        if (max_err > FAST_MATH_NCO_TOL_##suffix)                           \
+        {                                                                   \
+            return JTEST_TEST_FAILED;                                       \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+NCO_DEFINE_TEST(real, f32, f32, float32_t, 1, cos(p));
+NCO_DEFINE_TEST(real, q31, q31, q31_t, 1, cos(p));
+NCO_DEFINE_TEST(real, q31, q15, q15_t, 1, cos(p));
+NCO_DEFINE_TEST(iq, f32, f32, float32_t, 2, (k == 0) ? cos(p) : sin(p));
+NCO_DEFINE_TEST(iq, q31, q31, q31_t, 2, (k == 0) ? cos(p) : sin(p));
+
+/*
+  Mixer test template.  Arguments are: function name, type suffix, type,
+  number of input values per sample, divider of the input and the tolerance.
+  The input is the common input of the type divided by the divider, the
+  output is compared to the product of the input and the complex exponential
+  computed in double precision.
+*/
+#define NCO_MIX_DEFINE_TEST(fn, suffix, type, width, div, tol)              \
+    JTEST_DEFINE_TEST(arm_nco_##fn##_##suffix##_test,                       \
+                      arm_nco_##fn##_##suffix)                              \
+    {                                                                       \
+        arm_nco_instance_##suffix nco_inst;                                 \
+        type * in = (type *) fast_math_output_ref;                          \
+        type * out = (type *) fast_math_output_fut;                         \
+        uint32_t len = FAST_MATH_MAX_LEN / 2;                               \
+        float64_t a, b, p, re, im, err;                                     \
+        float64_t max_err = 0.0;                                            \
+        float64_t max_in = 0.0;                                             \
+        uint32_t n;                                                         \
+                                                                            \
+        for (n = 0; n < width * len; n++)                                   \
+        {                                                                   \
+            in[n] = fast_math_##suffix##_inputs[n] / div;                   \
+        }                                                                   \
+                                                                            \
+        nco_inst.phase = 0x12345678U;                                       \
+        nco_inst.phaseInc = 0xE0000123U;                                    \
+                                                                            \
+        JTEST_COUNT_CYCLES(                                                 \
+            arm_nco_##fn##_##suffix(&nco_inst, in, out, len));              \
+                                                                            \
+        for (n = 0; n < len; n++)                                           \
+        {                                                                   \
+            p = fast_math_nco_phase(0x12345678U, 0xE0000123U, n);           \
+            a = (float64_t) in[width * n];                                  \
+            b = (width == 2) ? (float64_t) in[width * n + 1] : 0.0;         \
+            re = a * cos(p) - b * sin(p);                                   \
+            im = a * sin(p) + b * cos(p);                                   \
+                                                                            \
+            err = fabs((float64_t) out[2 * n] - re);                        \
+            max_err = (err > max_err) ? err : max_err;                      \
+            err = fabs((float64_t) out[2 * n + 1] - im);                    \
+            max_err = (err > max_err) ? err : max_err;                      \
+            max_in = (fabs(a) > max_in) ? fabs(a) : max_in;                 \
+            max_in = (fabs(b) > max_in) ? fabs(b) : max_in;                 \
+        }                                                                   \
+                                                                            \
+        JTEST_DUMP_STRF("Maximum relative error: %.3e\n", max_err / max_in); \
+                                                                            \
+        if (max_err > (tol) * max_in)                                       \
+        {                                                                   \
+            return JTEST_TEST_FAILED;                                       \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+/* The magnitude of the complex Q31 input is kept below 1 */
+NCO_MIX_DEFINE_TEST(mix, f32, float32_t, 1, 1, 3.0e-7);
+NCO_MIX_DEFINE_TEST(mix, q31, q31_t, 1, 1, 1.0e-7);
+NCO_MIX_DEFINE_TEST(mix_cmplx, f32, float32_t, 2, 1, 5.0e-7);
+NCO_MIX_DEFINE_TEST(mix_cmplx, q31, q31_t, 2, 2, 2.0e-7);
+
+/*
+  The phase increment is the frequency divided by the sample rate, in units
+  of 2^-32, negative frequencies wrapping.
+*/
+JTEST_DEFINE_TEST(arm_nco_init_f32_test,
+                  arm_nco_init_f32)
+{
+    arm_nco_instance_f32 nco_inst;
+    uint32_t phase;
+    int32_t inc;
+
+    /* pi/2 is a quarter of a period, within the precision of PI */
+    if ((arm_nco_init_f32(&nco_inst, 1000.0f, 48000.0f, 0.5f * PI) != ARM_MATH_SUCCESS) ||
+        ((int32_t) (nco_inst.phase - 0x40000000U) > 256) ||
+        ((int32_t) (nco_inst.phase - 0x40000000U) < -256))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    /* 2^32 / 48 = 89478485.33 */
+    inc = (int32_t) nco_inst.phaseInc;
+    if ((inc < 89478485 - 8) || (inc > 89478485 + 8))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    /* 49000 Hz aliases to 1000 Hz, -1000 Hz wraps, the phase is kept */
+    phase = nco_inst.phase;
+    arm_nco_set_frequency_f32(&nco_inst, 49000.0f, 48000.0f);
+    inc = (int32_t) nco_inst.phaseInc;
+    if ((inc < 89478485 - 8) || (inc > 89478485 + 8) ||
+        (nco_inst.phase != phase))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    arm_nco_set_frequency_f32(&nco_inst, -1000.0f, 48000.0f);
+    inc = (int32_t) nco_inst.phaseInc;
+    if ((inc > -89478485 + 8) || (inc < -89478485 - 8) ||
+        (arm_nco_set_frequency_f32(&nco_inst, 1000.0f, 0.0f) != ARM_MATH_ARGUMENT_ERROR))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fast_math_nco_tests)
+{
+    JTEST_TEST_CALL(arm_nco_real_f32_test);
+    JTEST_TEST_CALL(arm_nco_real_q31_test);
+    JTEST_TEST_CALL(arm_nco_real_q15_test);
+    JTEST_TEST_CALL(arm_nco_iq_f32_test);
+    JTEST_TEST_CALL(arm_nco_iq_q31_test);
+    JTEST_TEST_CALL(arm_nco_mix_f32_test);
+    JTEST_TEST_CALL(arm_nco_mix_q31_test);
+    JTEST_TEST_CALL(arm_nco_mix_cmplx_f32_test);
+    JTEST_TEST_CALL(arm_nco_mix_cmplx_q31_test);
+    JTEST_TEST_CALL(arm_nco_init_f32_test);
+}
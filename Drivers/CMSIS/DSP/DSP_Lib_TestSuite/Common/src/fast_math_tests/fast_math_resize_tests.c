@@ -0,0 +1,337 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "fast_math_templates.h"
+#include "fast_math_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Input Data */
+/*--------------------------------------------------------------------------------*/
+
+/* Size of the source image, odd to run the remainder loops */
+#define RESIZE_SRC_WIDTH  31U
+#define RESIZE_SRC_HEIGHT 19U
+
+/* Maximum errors of the bilinear mode, in units of the last bit of each channel */
+#define RESIZE_TOL_u8     1.0f
+#define RESIZE_TOL_rgb565 1.5f
+
+#define RESIZE_SNR_THRESHOLD_q15 75
+
+/* Destination sizes: upscaling, downscaling and the same size */
+static const uint16_t resize_sizes[3][2] =
+{
+    {40U, 25U},
+    {17U, 11U},
+    {RESIZE_SRC_WIDTH, RESIZE_SRC_HEIGHT}
+};
+
+static uint8_t resize_src_u8[RESIZE_SRC_WIDTH * RESIZE_SRC_HEIGHT];
+static q15_t resize_src_q15[RESIZE_SRC_WIDTH * RESIZE_SRC_HEIGHT];
+static uint16_t resize_src_rgb565[RESIZE_SRC_WIDTH * RESIZE_SRC_HEIGHT];
+static float32_t resize_src_f32[RESIZE_SRC_WIDTH * RESIZE_SRC_HEIGHT];
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  A smooth pattern in [0.1 0.9], with a different phase for each channel.
+*/
+static float32_t resize_pattern(uint32_t x, uint32_t y, uint32_t channel)
+{
+    return 0.5f + 0.4f * sinf(0.35f * (float32_t) x + 0.2f * (float32_t) y + (float32_t) channel)
+        * cosf(0.27f * (float32_t) y);
+}
+
+static void resize_make_images(void)
+{
+    uint32_t x, y, n;
+
+    for (y = 0; y < RESIZE_SRC_HEIGHT; y++)
+    {
+        for (x = 0; x < RESIZE_SRC_WIDTH; x++)
+        {
+            n = y * RESIZE_SRC_WIDTH + x;
+            resize_src_u8[n] = (uint8_t) (255.0f * resize_pattern(x, y, 0) + 0.5f);
+            resize_src_q15[n] = (q15_t) (32767.0f * (2.0f * resize_pattern(x, y, 0) - 1.0f));
+            resize_src_rgb565[n] = (uint16_t) (((uint32_t) (31.0f * resize_pattern(x, y, 0) + 0.5f) << 11)
+                                               | ((uint32_t) (63.0f * resize_pattern(x, y, 1) + 0.5f) << 5)
+                                               | (uint32_t) (31.0f * resize_pattern(x, y, 2) + 0.5f));
+        }
+    }
+}
+
+/*
+  Largest absolute difference between two images.
+*/
+static float32_t resize_max_error(const float32_t * ref, const float32_t * fut, uint32_t len)
+{
+    float32_t err = 0.0f;
+    uint32_t n;
+
+    for (n = 0; n < len; n++)
+    {
+        if (fabsf(ref[n] - fut[n]) > err)
+        {
+            err = fabsf(ref[n] - fut[n]);
+        }
+    }
+
+    return err;
+}
+
+/*
+  Resize with the bilinear interpolation functions, one point at a time,
+  for the benchmark.  As in arm_bilinear_interp_f32(), X is the column and Y
+  the row.  The kernel bounds X with numRows and Y with numCols, and
+  addresses the table with numCols values per row: both are the width of
+  the image, and Y is kept inside the image below.
+*/
+static void resize_points_q15(const arm_resize_instance * S, q15_t * pSrc, q15_t * pDst)
+{
+    arm_bilinear_interp_instance_q15 bi = {S->srcWidth, S->srcWidth, pSrc};
+    q31_t x, y, xMax, yMax;
+    uint32_t i, j;
+
+    /* Positions in 12.20 format, below the last row and column */
+    xMax = ((q31_t) S->srcWidth - 1) << 20;
+    yMax = ((q31_t) S->srcHeight - 1) << 20;
+
+    for (i = 0; i < S->dstHeight; i++)
+    {
+        y = (q31_t) (((2 * i + 1) * S->srcHeight << 19) / S->dstHeight) - (1 << 19);
+        y = (y < 0) ? 0 : ((y >= yMax) ? (yMax - 1) : y);
+
+        for (j = 0; j < S->dstWidth; j++)
+        {
+            x = (q31_t) (((2 * j + 1) * S->srcWidth << 19) / S->dstWidth) - (1 << 19);
+            x = (x < 0) ? 0 : ((x >= xMax) ? (xMax - 1) : x);
+
+            *pDst++ = arm_bilinear_interp_q15(&bi, x, y);
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Single channel test template.  Arguments are: function suffix (u8/q15),
+  pixel type and scale of the conversion to floating-point.  Each mode and
+  size is compared to the reference: the nearest neighbour mode must match
+  exactly and the bilinear mode within the tolerance (u8) or the SNR
+  threshold (q15).
+*/
+#define RESIZE_DEFINE_TEST(suffix, type, scale, check)                      \
+    JTEST_DEFINE_TEST(arm_resize_##suffix##_test,                           \
+                      arm_resize_##suffix)                                  \
+    {                                                                       \
+        arm_resize_instance S;                                              \
+        type * dst = (type *) fast_math_output_fut;                         \
+        uint32_t mode;                                                      \
+        uint32_t size;                                                      \
+        uint32_t len;                                                       \
+        uint32_t n;                                                         \
+                                                                            \
+        resize_make_images();                                               \
+        for (n = 0; n < RESIZE_SRC_WIDTH * RESIZE_SRC_HEIGHT; n++)          \
+        {                                                                   \
+            resize_src_f32[n] = (float32_t) resize_src_##suffix[n] * scale; \
+        }                                                                   \
+                                                                            \
+        for (mode = ARM_RESIZE_NEAREST; mode <= ARM_RESIZE_BILINEAR; mode++) \
+        {                                                                   \
+            for (size = 0; size < 3; size++)                                \
+            {                                                               \
+                JTEST_DUMP_STRF("Mode: %d\nSize: %dx%d\n", (int)mode,       \
+                                (int)resize_sizes[size][0],                 \
+                                (int)resize_sizes[size][1]);                \
+                                                                            \
+                arm_resize_init(&S, (arm_resize_mode) mode,                 \
+                                RESIZE_SRC_WIDTH, RESIZE_SRC_HEIGHT,        \
+                                resize_sizes[size][0], resize_sizes[size][1]); \
+                len = (uint32_t) S.dstWidth * S.dstHeight;                  \
+                                                                            \
+                JTEST_COUNT_CYCLES(                                         \
+                    arm_resize_##suffix(&S, resize_src_##suffix, dst));     \
+                                                                            \
+                ref_resize_f32((arm_resize_mode) mode, resize_src_f32,      \
+                               RESIZE_SRC_WIDTH, RESIZE_SRC_HEIGHT,         \
+                               fast_math_output_f32_ref,                    \
+                               S.dstWidth, S.dstHeight);                    \
+                for (n = 0; n < len; n++)                                   \
+                {                                                           \
+                    fast_math_output_f32_fut[n] = (float32_t) dst[n] * scale; \
+                }                                                           \
+                                                                            \
+                if (mode == ARM_RESIZE_NEAREST)                             \
+                {                                                           \
+                    if (resize_max_error(fast_math_output_f32_ref,          \
+                                         fast_math_output_f32_fut,          \
+                                         len) != 0.0f)                      \
+                    {                                                       \
+                        return JTEST_TEST_FAILED;                           \
+                    }                                                       \
+                }                                                           \
+                else                                                        \
+                {                                                           \
+                    check;                                                  \
+                }                                                           \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+RESIZE_DEFINE_TEST(u8, uint8_t, 1.0f,
+                   if (resize_max_error(fast_math_output_f32_ref,
+                                        fast_math_output_f32_fut,
+                                        len) > RESIZE_TOL_u8)
+                   {
+                       return JTEST_TEST_FAILED;
+                   });
+RESIZE_DEFINE_TEST(q15, q15_t, (1.0f / 32768.0f),
+                   TEST_ASSERT_SNR(fast_math_output_f32_ref,
+                                   fast_math_output_f32_fut,
+                                   len, RESIZE_SNR_THRESHOLD_q15));
+
+/*
+  Each channel of the RGB565 images is compared to the reference on the
+  same channel.
+*/
+JTEST_DEFINE_TEST(arm_resize_rgb565_test,
+                  arm_resize_rgb565)
+{
+    arm_resize_instance S;
+    uint16_t * dst = (uint16_t *) fast_math_output_fut;
+    static const uint32_t shifts[3] = {11U, 5U, 0U};
+    static const uint32_t masks[3] = {0x1FU, 0x3FU, 0x1FU};
+    float32_t err;
+    uint32_t mode;
+    uint32_t size;
+    uint32_t len;
+    uint32_t ch;
+    uint32_t n;
+
+    resize_make_images();
+
+    for (mode = ARM_RESIZE_NEAREST; mode <= ARM_RESIZE_BILINEAR; mode++)
+    {
+        for (size = 0; size < 3; size++)
+        {
+            arm_resize_init(&S, (arm_resize_mode) mode,
+                            RESIZE_SRC_WIDTH, RESIZE_SRC_HEIGHT,
+                            resize_sizes[size][0], resize_sizes[size][1]);
+            len = (uint32_t) S.dstWidth * S.dstHeight;
+
+            JTEST_COUNT_CYCLES(
+                arm_resize_rgb565(&S, resize_src_rgb565, dst));
+
+            for (ch = 0; ch < 3; ch++)
+            {
+                JTEST_DUMP_STRF("Mode: %d\nSize: %dx%d\nChannel: %d\n", (int)mode,
+                                (int)resize_sizes[size][0],
+                                (int)resize_sizes[size][1], (int)ch);
+
+                for (n = 0; n < RESIZE_SRC_WIDTH * RESIZE_SRC_HEIGHT; n++)
+                {
+                    resize_src_f32[n] = (float32_t) ((resize_src_rgb565[n] >> shifts[ch]) & masks[ch]);
+                }
+                for (n = 0; n < len; n++)
+                {
+                    fast_math_output_f32_fut[n] = (float32_t) ((dst[n] >> shifts[ch]) & masks[ch]);
+                }
+                ref_resize_f32((arm_resize_mode) mode, resize_src_f32,
+                               RESIZE_SRC_WIDTH, RESIZE_SRC_HEIGHT,
+                               fast_math_output_f32_ref, S.dstWidth, S.dstHeight);
+
+                err = resize_max_error(fast_math_output_f32_ref,
+                                       fast_math_output_f32_fut, len);
+                if (err > ((mode == ARM_RESIZE_NEAREST) ? 0.0f : RESIZE_TOL_rgb565))
+                {
+                    JTEST_DUMP_STRF("Error: %f\n", (double)err);
+                    return JTEST_TEST_FAILED;
+                }
+            }
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  A row resized alone matches the same row of the whole image, and wrong
+  sizes are rejected.
+*/
+JTEST_DEFINE_TEST(arm_resize_row_test,
+                  arm_resize_row_rgb565)
+{
+    arm_resize_instance S;
+    uint16_t * dst = (uint16_t *) fast_math_output_fut;
+    uint16_t row[40];
+    uint32_t n;
+
+    resize_make_images();
+
+    arm_resize_init(&S, ARM_RESIZE_BILINEAR, RESIZE_SRC_WIDTH, RESIZE_SRC_HEIGHT, 40U, 25U);
+    arm_resize_rgb565(&S, resize_src_rgb565, dst);
+    arm_resize_row_rgb565(&S, resize_src_rgb565, 24U, row);
+
+    for (n = 0; n < 40U; n++)
+    {
+        if (row[n] != dst[24U * 40U + n])
+        {
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    if ((arm_resize_init(&S, ARM_RESIZE_NEAREST, 0U, 10U, 10U, 10U) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_resize_init(&S, ARM_RESIZE_NEAREST, 10U, 10U, 10U, 0U) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_resize_init(&S, ARM_RESIZE_BILINEAR, 10U, 0x8000U, 10U, 10U) != ARM_MATH_ARGUMENT_ERROR))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Throughput of the resize against the bilinear interpolation of each
+  point.
+*/
+JTEST_DEFINE_TEST(arm_resize_benchmark,
+                  arm_resize_q15)
+{
+    arm_resize_instance S;
+    q15_t * dst = (q15_t *) fast_math_output_fut;
+
+    resize_make_images();
+    arm_resize_init(&S, ARM_RESIZE_BILINEAR, RESIZE_SRC_WIDTH, RESIZE_SRC_HEIGHT, 40U, 25U);
+
+    JTEST_DUMP_STRF("Method: %s\n", "points");
+    JTEST_COUNT_CYCLES(
+        resize_points_q15(&S, resize_src_q15, dst));
+
+    JTEST_DUMP_STRF("Method: %s\n", "rows");
+    JTEST_COUNT_CYCLES(
+        arm_resize_q15(&S, resize_src_q15, dst));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fast_math_resize_tests)
+{
+    JTEST_TEST_CALL(arm_resize_u8_test);
+    JTEST_TEST_CALL(arm_resize_q15_test);
+    JTEST_TEST_CALL(arm_resize_rgb565_test);
+    JTEST_TEST_CALL(arm_resize_row_test);
+    JTEST_TEST_CALL(arm_resize_benchmark);
+}
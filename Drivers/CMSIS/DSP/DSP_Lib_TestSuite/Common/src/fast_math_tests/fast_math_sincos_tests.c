@@ -0,0 +1,236 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "fast_math_templates.h"
+#include "fast_math_test_data.h"
+#include "type_abbrev.h"
+
+/* Number of blocks of FAST_MATH_MAX_LEN samples in an accuracy sweep */
+#define FAST_MATH_SINCOS_SWEEP_BLOCKS 16
+
+/* Double precision pi, the PI of ref.h is single precision */
+#define FAST_MATH_SINCOS_PI_F64 3.14159265358979323846
+
+/* Buffer of the tables above 512 intervals */
+static float32_t fast_math_sincos_table[4096 + 1];
+
+/* Inputs of one sweep block */
+static float32_t fast_math_sincos_in[FAST_MATH_MAX_LEN];
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/* Inputs of the block b of a sweep over [-2*pi 2*pi] */
+static void fast_math_sincos_inputs(uint32_t b)
+{
+    float64_t step = (4.0 * FAST_MATH_SINCOS_PI_F64) /
+        (FAST_MATH_SINCOS_SWEEP_BLOCKS * FAST_MATH_MAX_LEN);
+    uint32_t i;
+
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        fast_math_sincos_in[i] = (float32_t) ((-2.0 * FAST_MATH_SINCOS_PI_F64) +
+                                              (step * (b * FAST_MATH_MAX_LEN + i)));
+    }
+}
+
+/* Maximum absolute error of the sine, cosine and combined functions of an instance */
+static float64_t fast_math_sincos_sweep(const arm_sincos_instance_f32 * S)
+{
+    float32_t * pSin = fast_math_output_fut;
+    float32_t * pCos = fast_math_output_ref;
+    float32_t sinVal, cosVal;
+    float64_t x, err;
+    float64_t maxErr = 0.0;
+    uint32_t b, i;
+
+    for (b = 0; b < FAST_MATH_SINCOS_SWEEP_BLOCKS; b++)
+    {
+        fast_math_sincos_inputs(b);
+
+        for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+        {
+            pSin[i] = arm_sincos_sin_f32(S, fast_math_sincos_in[i]);
+            pCos[i] = arm_sincos_cos_f32(S, fast_math_sincos_in[i]);
+        }
+
+        for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+        {
+            x = (float64_t) fast_math_sincos_in[i];
+            arm_sincos_f32(S, fast_math_sincos_in[i], &sinVal, &cosVal);
+
+            err = fabs((float64_t) pSin[i] - sin(x));
+            maxErr = (err > maxErr) ? err : maxErr;
+            err = fabs((float64_t) pCos[i] - cos(x));
+            maxErr = (err > maxErr) ? err : maxErr;
+            err = fabs((float64_t) sinVal - sin(x));
+            maxErr = (err > maxErr) ? err : maxErr;
+            err = fabs((float64_t) cosVal - cos(x));
+            maxErr = (err > maxErr) ? err : maxErr;
+        }
+    }
+
+    return maxErr;
+}
+
+/* Sine of one block, for the cycle counts */
+static void fast_math_sincos_block(const arm_sincos_instance_f32 * S)
+{
+    uint32_t i;
+
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        fast_math_output_fut[i] = arm_sincos_sin_f32(S, fast_math_sincos_in[i]);
+    }
+}
+
+static void fast_math_sin_block(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        fast_math_output_fut[i] = arm_sin_f32(fast_math_sincos_in[i]);
+    }
+}
+
+static void fast_math_sin_fast_block(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        fast_math_output_fut[i] = arm_sin_fast_f32(fast_math_sincos_in[i]);
+    }
+}
+
+/*
+  Check the error of an initialized instance against the error it reports,
+  and display the cycle count of one block of sines.
+*/
+#define FAST_MATH_SINCOS_CHECK(name, config, S)                         \
+    do                                                                  \
+    {                                                                   \
+        float64_t maxErr = fast_math_sincos_sweep(S);                   \
+                                                                        \
+        JTEST_DUMP_STRF("%s %d max error: %e (reported %e)\n",          \
+                        name, (int) (config), maxErr,                   \
+                        (float64_t) (S)->maxError);                     \
+        if (maxErr > (float64_t) (S)->maxError)                         \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+                                                                        \
+        JTEST_COUNT_CYCLES(fast_math_sincos_block(S));                  \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_TEST(arm_sincos_init_f32_test, arm_sincos_init_f32)
+{
+    arm_sincos_instance_f32 S;
+    uint32_t tableSize;
+
+    fast_math_sincos_inputs(0);
+    JTEST_DUMP_STR("arm_sin_f32:\n");
+    JTEST_COUNT_CYCLES(fast_math_sin_block());
+
+    for (tableSize = 64U; tableSize <= 4096U; tableSize *= 2U)
+    {
+        if (arm_sincos_init_f32(&S, (uint16_t) tableSize, fast_math_sincos_table) != ARM_MATH_SUCCESS)
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        FAST_MATH_SINCOS_CHECK("table", tableSize, &S);
+    }
+
+    /* Unsupported sizes, and a large table without a buffer */
+    if ((arm_sincos_init_f32(&S, 32U, fast_math_sincos_table) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_sincos_init_f32(&S, 768U, fast_math_sincos_table) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_sincos_init_f32(&S, 8192U, fast_math_sincos_table) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_sincos_init_f32(&S, 1024U, NULL) != ARM_MATH_ARGUMENT_ERROR))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_sincos_poly_init_f32_test, arm_sincos_poly_init_f32)
+{
+    arm_sincos_instance_f32 S;
+    uint32_t order;
+
+    fast_math_sincos_inputs(0);
+
+    for (order = 3U; order <= 11U; order += 2U)
+    {
+        if (arm_sincos_poly_init_f32(&S, (uint16_t) order) != ARM_MATH_SUCCESS)
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        FAST_MATH_SINCOS_CHECK("polynomial", order, &S);
+    }
+
+    if ((arm_sincos_poly_init_f32(&S, 1U) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_sincos_poly_init_f32(&S, 6U) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_sincos_poly_init_f32(&S, 13U) != ARM_MATH_ARGUMENT_ERROR))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_sin_fast_f32_test, arm_sin_fast_f32)
+{
+    float64_t bound = (ARM_MATH_SIN_FAST_ORDER == 7) ? 1.3e-6 : 1.1e-4;
+    float64_t x, err;
+    float64_t maxErr = 0.0;
+    uint32_t b, i;
+
+    for (b = 0; b < FAST_MATH_SINCOS_SWEEP_BLOCKS; b++)
+    {
+        fast_math_sincos_inputs(b);
+
+        for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+        {
+            x = (float64_t) fast_math_sincos_in[i];
+
+            err = fabs((float64_t) arm_sin_fast_f32(fast_math_sincos_in[i]) - sin(x));
+            maxErr = (err > maxErr) ? err : maxErr;
+            err = fabs((float64_t) arm_cos_fast_f32(fast_math_sincos_in[i]) - cos(x));
+            maxErr = (err > maxErr) ? err : maxErr;
+        }
+    }
+
+    JTEST_DUMP_STRF("order %d max error: %e (bound %e)\n",
+                    (int) ARM_MATH_SIN_FAST_ORDER, maxErr, bound);
+    if (maxErr > bound)
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    JTEST_COUNT_CYCLES(fast_math_sin_fast_block());
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fast_math_sincos_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_sincos_init_f32_test);
+    JTEST_TEST_CALL(arm_sincos_poly_init_f32_test);
+    JTEST_TEST_CALL(arm_sin_fast_f32_test);
+}
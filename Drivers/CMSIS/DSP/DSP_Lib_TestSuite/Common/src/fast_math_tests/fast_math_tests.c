@@ -4,6 +4,7 @@
 #include "fast_math_templates.h"
 #include "fast_math_test_data.h"
 #include "type_abbrev.h"
+#include "fast_math_test_group.h"
 
 SQRT_TEST_TEMPLATE_ELT1(q31);
 SQRT_TEST_TEMPLATE_ELT1(q15);
@@ -35,4 +36,11 @@ JTEST_DEFINE_GROUP(fast_math_tests)
     JTEST_TEST_CALL(arm_cos_f32_test);
     JTEST_TEST_CALL(arm_cos_q31_test);
     JTEST_TEST_CALL(arm_cos_q15_test);
+
+    JTEST_GROUP_CALL(fast_math_block_tests);
+    JTEST_GROUP_CALL(fast_math_sincos_tests);
+    JTEST_GROUP_CALL(fast_math_divide_tests);
+    JTEST_GROUP_CALL(fast_math_nco_tests);
+    JTEST_GROUP_CALL(fast_math_interp_tests);
+    JTEST_GROUP_CALL(fast_math_resize_tests);
 }
@@ -0,0 +1,219 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Header Stuff */
+/*--------------------------------------------------------------------------------*/
+
+/* Largest FFT of the tests, limited by the length of filtering_output_fut */
+#define CONV_FFT_MAX_FFT_LEN 1024U
+
+#define CONV_FFT_SNR_THRESHOLD 100
+
+/* Delays of the GCC-PHAT test, in samples */
+#define CONV_FFT_PHAT_BLOCKSIZE 256U
+#define CONV_FFT_PHAT_OFFSET    64U
+
+static float32_t conv_fft_scratch[2U * CONV_FFT_MAX_FFT_LEN];
+
+/*
+ *  Length pairs of the inputs, taken in parallel.  Both orders of the
+ *  lengths are tested, down to outputs shorter than the smallest FFT.
+ */
+static const uint32_t conv_fft_lens_a[] = {1, 5, 37, 100, 127, 300, 512};
+static const uint32_t conv_fft_lens_b[] = {1, 16, 100, 37, 300, 127, 512};
+
+static const int32_t conv_fft_phat_delays[] = {0, 7, -13, 50};
+
+/* Lengths of the benchmark, in pairs */
+static const uint32_t conv_fft_bench_lens[] = {8, 32, 64, 128, 256, 512};
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+ *  Fill the output of the FUT with a value it must overwrite.
+ */
+static void conv_fft_poison(uint32_t len)
+{
+    uint32_t n;
+
+    for (n = 0; n < len; n++)
+    {
+        filtering_output_fut[n] = 1.0e30f;
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+ *  Convolution and correlation of the FFT and auto-selecting functions,
+ *  compared to the reference direct functions.
+ */
+#define CONV_FFT_DEFINE_TEST(fn_name, ref_name, out_len, call)              \
+    JTEST_DEFINE_TEST(fn_name##_test, fn_name)                              \
+    {                                                                       \
+        float32_t * input_a = (float32_t *) filtering_f32_inputs;           \
+        float32_t * input_b = (float32_t *) filtering_f32_inputs + 512;     \
+        uint32_t len_a, len_b, len;                                         \
+        uint32_t i, n;                                                      \
+                                                                            \
+        for (i = 0; i < sizeof(conv_fft_lens_a) / sizeof(conv_fft_lens_a[0]); i++) \
+        {                                                                   \
+            len_a = conv_fft_lens_a[i];                                     \
+            len_b = conv_fft_lens_b[i];                                     \
+            len = out_len;                                                  \
+                                                                            \
+            JTEST_DUMP_STRF("Input A Length: %d\nInput B Length: %d\n",     \
+                            (int)len_a, (int)len_b);                        \
+                                                                            \
+            conv_fft_poison(len);                                           \
+            JTEST_COUNT_CYCLES(call);                                       \
+                                                                            \
+            for (n = 0; n < len; n++)                                       \
+            {                                                               \
+                filtering_output_ref[n] = 0.0f;                             \
+            }                                                               \
+            ref_name(input_a, len_a, input_b, len_b, filtering_output_ref); \
+                                                                            \
+            TEST_ASSERT_SNR(filtering_output_ref, filtering_output_fut,     \
+                            len, CONV_FFT_SNR_THRESHOLD);                   \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+#define CONV_FFT_CONV_LEN (len_a + len_b - 1)
+#define CONV_FFT_CORR_LEN (2 * ((len_a > len_b) ? len_a : len_b) - 1)
+
+CONV_FFT_DEFINE_TEST(arm_conv_fft_f32, ref_conv_f32, CONV_FFT_CONV_LEN,
+                     arm_conv_fft_f32(input_a, len_a, input_b, len_b,
+                                      filtering_output_fut, conv_fft_scratch));
+
+CONV_FFT_DEFINE_TEST(arm_correlate_fft_f32, ref_correlate_f32, CONV_FFT_CORR_LEN,
+                     arm_correlate_fft_f32(input_a, len_a, input_b, len_b,
+                                           filtering_output_fut, conv_fft_scratch));
+
+CONV_FFT_DEFINE_TEST(arm_conv_auto_f32, ref_conv_f32, CONV_FFT_CONV_LEN,
+                     arm_conv_auto_f32(input_a, len_a, input_b, len_b,
+                                       filtering_output_fut, conv_fft_scratch));
+
+CONV_FFT_DEFINE_TEST(arm_correlate_auto_f32, ref_correlate_f32, CONV_FFT_CORR_LEN,
+                     arm_correlate_auto_f32(input_a, len_a, input_b, len_b,
+                                            filtering_output_fut, conv_fft_scratch));
+
+/*
+ *  Outputs longer than 4096 samples are rejected.
+ */
+JTEST_DEFINE_TEST(arm_conv_fft_f32_length_test,
+                  arm_conv_fft_f32)
+{
+    float32_t * input = (float32_t *) filtering_f32_inputs;
+
+    if ((arm_conv_fft_f32(input, 2048, input, 2050, filtering_output_fut,
+                          conv_fft_scratch) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_gcc_phat_f32(input, input, 2049, filtering_output_fut,
+                          conv_fft_scratch) != ARM_MATH_ARGUMENT_ERROR))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+ *  The first input is the second one delayed: the maximum of the output
+ *  must be at the delay.
+ */
+JTEST_DEFINE_TEST(arm_gcc_phat_f32_test,
+                  arm_gcc_phat_f32)
+{
+    float32_t * input_b = (float32_t *) filtering_f32_inputs + CONV_FFT_PHAT_OFFSET;
+    float32_t * input_a;
+    float32_t max_val;
+    uint32_t max_idx;
+    int32_t delay;
+    uint32_t i;
+
+    for (i = 0; i < sizeof(conv_fft_phat_delays) / sizeof(conv_fft_phat_delays[0]); i++)
+    {
+        delay = conv_fft_phat_delays[i];
+        input_a = input_b - delay;
+
+        JTEST_DUMP_STRF("Delay: %d\n", (int)delay);
+
+        JTEST_COUNT_CYCLES(
+            arm_gcc_phat_f32(input_a, input_b, CONV_FFT_PHAT_BLOCKSIZE,
+                             filtering_output_fut, conv_fft_scratch));
+
+        arm_max_f32(filtering_output_fut, 2 * CONV_FFT_PHAT_BLOCKSIZE - 1,
+                    &max_val, &max_idx);
+
+        if (((int32_t) max_idx - (int32_t) (CONV_FFT_PHAT_BLOCKSIZE - 1) != delay) ||
+            (max_val > 1.0001f))
+        {
+            JTEST_DUMP_STRF("Peak %f at lag %d\n", (double)max_val,
+                            (int)max_idx - (int)(CONV_FFT_PHAT_BLOCKSIZE - 1));
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+ *  Cycles of the direct and FFT convolutions, to fit the constants of the
+ *  cost model of arm_conv_auto_f32().  Always passes.
+ */
+JTEST_DEFINE_TEST(arm_conv_fft_benchmark,
+                  arm_conv_fft_f32)
+{
+    float32_t * input = (float32_t *) filtering_f32_inputs;
+    uint32_t i, j;
+
+    for (i = 0; i < sizeof(conv_fft_bench_lens) / sizeof(conv_fft_bench_lens[0]); i++)
+    {
+        for (j = 0; j <= i; j++)
+        {
+            JTEST_DUMP_STRF("Input A Length: %d\nInput B Length: %d\nMethod: direct\n",
+                            (int)conv_fft_bench_lens[i], (int)conv_fft_bench_lens[j]);
+            JTEST_COUNT_CYCLES(
+                arm_conv_f32(input, conv_fft_bench_lens[i],
+                             input, conv_fft_bench_lens[j],
+                             filtering_output_fut));
+
+            JTEST_DUMP_STRF("Input A Length: %d\nInput B Length: %d\nMethod: FFT\n",
+                            (int)conv_fft_bench_lens[i], (int)conv_fft_bench_lens[j]);
+            JTEST_COUNT_CYCLES(
+                arm_conv_fft_f32(input, conv_fft_bench_lens[i],
+                                 input, conv_fft_bench_lens[j],
+                                 filtering_output_fut, conv_fft_scratch));
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(conv_fft_tests)
+{
+    JTEST_TEST_CALL(arm_conv_fft_f32_test);
+    JTEST_TEST_CALL(arm_correlate_fft_f32_test);
+    JTEST_TEST_CALL(arm_conv_auto_f32_test);
+    JTEST_TEST_CALL(arm_correlate_auto_f32_test);
+    JTEST_TEST_CALL(arm_conv_fft_f32_length_test);
+    JTEST_TEST_CALL(arm_gcc_phat_f32_test);
+    JTEST_TEST_CALL(arm_conv_fft_benchmark);
+}
@@ -0,0 +1,254 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Header Stuff */
+/*--------------------------------------------------------------------------------*/
+
+#define DYNAMICS_FS         48000.0f
+#define DYNAMICS_BLOCK_SIZE 48U
+#define DYNAMICS_NUM_BLOCKS 150U
+
+/* Tolerance on the steady state gains, in dB */
+#define DYNAMICS_GAIN_TOL 0.25f
+
+#define DYNAMICS_SNR_THRESHOLD_q15 45
+
+static float32_t dynamics_input_f32[DYNAMICS_BLOCK_SIZE];
+static float32_t dynamics_output_f32[DYNAMICS_BLOCK_SIZE];
+static float32_t dynamics_output_q15_f32[DYNAMICS_BLOCK_SIZE];
+static q15_t dynamics_input_q15[DYNAMICS_BLOCK_SIZE];
+static q15_t dynamics_output_q15[DYNAMICS_BLOCK_SIZE];
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+ *  Fill dynamics_input_f32 with block blk of a 1 kHz tone.
+ */
+static void dynamics_make_block(uint32_t blk, float32_t amp)
+{
+    uint32_t n;
+
+    for (n = 0; n < DYNAMICS_BLOCK_SIZE; n++)
+    {
+        dynamics_input_f32[n] = amp * sinf(2.0f * PI * 1000.0f *
+            (float32_t) (blk * DYNAMICS_BLOCK_SIZE + n) / DYNAMICS_FS);
+    }
+}
+
+/*
+ *  Initialize a floating-point processor with a peak detector of 0.1 ms
+ *  attack and 50 ms release, and a gain of 1 ms attack and 20 ms release.
+ */
+static void dynamics_init_f32(arm_dynamics_instance_f32 * S)
+{
+    float32_t blockRate = DYNAMICS_FS / (float32_t) DYNAMICS_BLOCK_SIZE;
+
+    arm_dynamics_init_f32(S, ARM_ENVELOPE_PEAK,
+                          arm_envelope_coeff_f32(0.0001f, DYNAMICS_FS),
+                          arm_envelope_coeff_f32(0.05f, DYNAMICS_FS),
+                          arm_envelope_coeff_f32(0.001f, blockRate),
+                          arm_envelope_coeff_f32(0.02f, blockRate));
+}
+
+/*
+ *  Peak of a block, in dB.
+ */
+static float32_t dynamics_peak_db(float32_t * pSrc)
+{
+    float32_t peak = 0.0f;
+    uint32_t n;
+
+    for (n = 0; n < DYNAMICS_BLOCK_SIZE; n++)
+    {
+        peak = (fabsf(pSrc[n]) > peak) ? fabsf(pSrc[n]) : peak;
+    }
+
+    return 20.0f * log10f(peak);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+ *  Points of the static curve: below and above the threshold, in the
+ *  knee and under the gate.
+ */
+JTEST_DEFINE_TEST(arm_dynamics_gain_f32_test,
+                  arm_dynamics_gain_f32)
+{
+    arm_dynamics_curve_f32 curve;
+    float32_t gains[5];
+    static const float32_t expected[5] = {-40.0f, 0.0f, -0.375f, -7.5f, -15.0f};
+    uint32_t i;
+
+    if (arm_dynamics_set_curve_f32(&curve, -20.0f, 4.0f, 4.0f,
+                                   -60.0f, 40.0f, 6.0f) != ARM_MATH_SUCCESS)
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    JTEST_COUNT_CYCLES(gains[0] = arm_dynamics_gain_f32(&curve, -70.0f));
+    gains[1] = arm_dynamics_gain_f32(&curve, -22.0f);
+    gains[2] = arm_dynamics_gain_f32(&curve, -20.0f);
+    gains[3] = arm_dynamics_gain_f32(&curve, -10.0f);
+
+    /* Limiter */
+    arm_dynamics_set_curve_f32(&curve, -20.0f, 0.0f, 0.0f, -60.0f, 0.0f, 0.0f);
+    gains[4] = arm_dynamics_gain_f32(&curve, -5.0f);
+
+    for (i = 0; i < 5; i++)
+    {
+        if (fabsf(gains[i] - expected[i]) > 1.0e-5f)
+        {
+            JTEST_DUMP_STRF("Gain %d: %f, expected %f\n",
+                            (int)i, (double)gains[i], (double)expected[i]);
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    if ((arm_dynamics_set_curve_f32(&curve, -20.0f, 0.5f, 0.0f, -60.0f, 0.0f, 0.0f)
+         != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_dynamics_set_curve_f32(&curve, -20.0f, 2.0f, -1.0f, -60.0f, 0.0f, 0.0f)
+         != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_dynamics_set_curve_f32(&curve, -20.0f, 2.0f, 0.0f, -60.0f, -1.0f, 0.0f)
+         != ARM_MATH_ARGUMENT_ERROR))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+ *  Steady state of a tone through the compressor, the limiter and the
+ *  gate.  The Q15 processor is compared to the floating-point one.
+ */
+JTEST_DEFINE_TEST(arm_dynamics_f32_test,
+                  arm_dynamics_f32)
+{
+    arm_dynamics_instance_f32 dyn_f32;
+    arm_dynamics_instance_q15 dyn_q15;
+    float32_t expected;
+    float32_t peak;
+    uint32_t cfg;
+    uint32_t blk;
+
+    /* Tone amplitude, threshold, ratio, makeup gain and expected output peak in dB */
+    static const float32_t configs[4][5] =
+    {
+        { -6.0f, -20.0f, 4.0f, 0.0f, -16.5f},   /* compressor */
+        { -6.0f, -20.0f, 4.0f, 6.0f, -10.5f},   /* compressor with makeup gain */
+        { -3.0f, -12.0f, 0.0f, 0.0f, -12.0f},   /* limiter */
+        {-30.0f, -20.0f, 4.0f, 0.0f, -30.0f}    /* under the threshold */
+    };
+
+    for (cfg = 0; cfg < 4; cfg++)
+    {
+        dynamics_init_f32(&dyn_f32);
+        arm_dynamics_set_curve_f32(&dyn_f32.curve, configs[cfg][1], configs[cfg][2],
+                                   0.0f, -200.0f, 0.0f, configs[cfg][3]);
+
+        arm_dynamics_init_q15(&dyn_q15, ARM_ENVELOPE_PEAK,
+                              (q15_t) (arm_envelope_coeff_f32(0.0001f, DYNAMICS_FS) * 32768.0f),
+                              (q15_t) (arm_envelope_coeff_f32(0.05f, DYNAMICS_FS) * 32768.0f),
+                              dyn_f32.gainAttack, dyn_f32.gainRelease);
+        dyn_q15.curve = dyn_f32.curve;
+
+        for (blk = 0; blk < DYNAMICS_NUM_BLOCKS; blk++)
+        {
+            dynamics_make_block(blk, powf(10.0f, configs[cfg][0] / 20.0f));
+            arm_float_to_q15(dynamics_input_f32, dynamics_input_q15, DYNAMICS_BLOCK_SIZE);
+
+            JTEST_COUNT_CYCLES(
+                arm_dynamics_f32(&dyn_f32, dynamics_input_f32,
+                                 dynamics_output_f32, DYNAMICS_BLOCK_SIZE));
+            arm_dynamics_q15(&dyn_q15, dynamics_input_q15,
+                             dynamics_output_q15, DYNAMICS_BLOCK_SIZE);
+        }
+
+        /* The last block spans one period of the tone */
+        peak = dynamics_peak_db(dynamics_output_f32);
+        expected = configs[cfg][4];
+
+        if (fabsf(peak - expected) > DYNAMICS_GAIN_TOL)
+        {
+            JTEST_DUMP_STRF("Configuration %d: peak %f dB, expected %f dB\n",
+                            (int)cfg, (double)peak, (double)expected);
+            return JTEST_TEST_FAILED;
+        }
+
+        arm_q15_to_float(dynamics_output_q15, dynamics_output_q15_f32, DYNAMICS_BLOCK_SIZE);
+        TEST_ASSERT_SNR(dynamics_output_f32, dynamics_output_q15_f32,
+                        DYNAMICS_BLOCK_SIZE, DYNAMICS_SNR_THRESHOLD_q15);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+ *  A tone under the threshold of the gate is attenuated by its range,
+ *  and passes again once it rises above it.
+ */
+JTEST_DEFINE_TEST(arm_dynamics_gate_test,
+                  arm_dynamics_f32)
+{
+    arm_dynamics_instance_f32 dyn_f32;
+    float32_t peak;
+    uint32_t blk;
+
+    dynamics_init_f32(&dyn_f32);
+    arm_dynamics_set_curve_f32(&dyn_f32.curve, 0.0f, 1.0f, 0.0f, -50.0f, 40.0f, 0.0f);
+
+    for (blk = 0; blk < DYNAMICS_NUM_BLOCKS; blk++)
+    {
+        dynamics_make_block(blk, 0.001f);
+        arm_dynamics_f32(&dyn_f32, dynamics_input_f32, dynamics_output_f32,
+                         DYNAMICS_BLOCK_SIZE);
+    }
+
+    peak = dynamics_peak_db(dynamics_output_f32);
+    if (fabsf(peak - (-100.0f)) > DYNAMICS_GAIN_TOL)
+    {
+        JTEST_DUMP_STRF("Closed gate: peak %f dB\n", (double)peak);
+        return JTEST_TEST_FAILED;
+    }
+
+    /* In place processing */
+    for (blk = 0; blk < DYNAMICS_NUM_BLOCKS; blk++)
+    {
+        dynamics_make_block(blk, 0.1f);
+        arm_dynamics_f32(&dyn_f32, dynamics_input_f32, dynamics_input_f32,
+                         DYNAMICS_BLOCK_SIZE);
+    }
+
+    peak = dynamics_peak_db(dynamics_input_f32);
+    if (fabsf(peak - (-20.0f)) > DYNAMICS_GAIN_TOL)
+    {
+        JTEST_DUMP_STRF("Open gate: peak %f dB\n", (double)peak);
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(dynamics_tests)
+{
+    JTEST_TEST_CALL(arm_dynamics_gain_f32_test);
+    JTEST_TEST_CALL(arm_dynamics_f32_test);
+    JTEST_TEST_CALL(arm_dynamics_gate_test);
+}
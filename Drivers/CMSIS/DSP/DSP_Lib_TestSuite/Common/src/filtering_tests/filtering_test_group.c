@@ -8,6 +8,9 @@ JTEST_DEFINE_GROUP(filtering_tests)
     */
     JTEST_GROUP_CALL(biquad_tests);
     JTEST_GROUP_CALL(conv_tests);
+    JTEST_GROUP_CALL(conv_fft_tests);
+    JTEST_GROUP_CALL(dynamics_tests);
+    JTEST_GROUP_CALL(hilbert_tests);
     JTEST_GROUP_CALL(correlate_tests);
     JTEST_GROUP_CALL(fir_tests);
     JTEST_GROUP_CALL(iir_tests);
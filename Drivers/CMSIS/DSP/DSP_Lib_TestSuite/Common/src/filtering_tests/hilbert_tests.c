@@ -0,0 +1,340 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Header Stuff */
+/*--------------------------------------------------------------------------------*/
+
+/* Samples of the streaming tests, processed in blocks */
+#define HILBERT_LEN        256U
+#define HILBERT_BLOCK_SIZE 32U
+#define HILBERT_MAX_TAPS   63U
+
+/* Shape parameter of the Kaiser window of the designs */
+#define HILBERT_KAISER_BETA 6.0f
+
+#define HILBERT_SNR_THRESHOLD_f32 100
+#define HILBERT_SNR_THRESHOLD_q15 60
+
+/* Tone of the instantaneous frequency tests, in cycles per sample */
+#define HILBERT_TONE_FREQ 0.0625f
+#define HILBERT_TONE_AMP  0.75f
+
+/* Tolerances on the amplitude and the frequency of the tone */
+#define HILBERT_AMP_TOL  0.005f
+#define HILBERT_FREQ_TOL 0.0005f
+
+static const uint16_t hilbert_num_taps[] = {3U, 31U, 63U};
+static const uint16_t analytic_fft_lens[] = {32U, 256U, 512U};
+
+static float32_t hilbert_coeffs_f32[(HILBERT_MAX_TAPS + 1U) / 4U];
+static q15_t hilbert_coeffs_q15[(HILBERT_MAX_TAPS + 1U) / 4U];
+static float32_t hilbert_state_f32[HILBERT_MAX_TAPS + HILBERT_LEN - 1U];
+static q15_t hilbert_state_q15[HILBERT_MAX_TAPS + HILBERT_LEN - 1U];
+static float32_t hilbert_input_f32[HILBERT_LEN];
+static q15_t hilbert_input_q15[HILBERT_LEN];
+static q15_t hilbert_output_q15[2U * HILBERT_LEN];
+static float32_t hilbert_amp_f32[HILBERT_LEN];
+static float32_t hilbert_phase_f32[HILBERT_LEN];
+static float32_t hilbert_freq_f32[HILBERT_LEN];
+static q15_t hilbert_amp_q15[HILBERT_LEN];
+static q15_t hilbert_phase_q15[HILBERT_LEN];
+static q15_t hilbert_freq_q15[HILBERT_LEN];
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+ *  Fill the input buffers with the test tone.
+ */
+static void hilbert_make_tone(void)
+{
+    uint32_t n;
+
+    for (n = 0; n < HILBERT_LEN; n++)
+    {
+        hilbert_input_f32[n] = HILBERT_TONE_AMP *
+            cosf(2.0f * PI * HILBERT_TONE_FREQ * (float32_t) n + 0.4f);
+    }
+    arm_float_to_q15(hilbert_input_f32, hilbert_input_q15, HILBERT_LEN);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+ *  Streams of blocks compared to the reference direct form with all the taps.
+ */
+JTEST_DEFINE_TEST(arm_hilbert_f32_test,
+                  arm_hilbert_f32)
+{
+    arm_hilbert_instance_f32 hilbert_inst;
+    float32_t * input = (float32_t *) filtering_f32_inputs;
+    uint32_t i, blk;
+    uint16_t num_taps;
+
+    for (i = 0; i < sizeof(hilbert_num_taps) / sizeof(hilbert_num_taps[0]); i++)
+    {
+        num_taps = hilbert_num_taps[i];
+
+        JTEST_DUMP_STRF("Number of Taps: %d\n", (int)num_taps);
+
+        arm_hilbert_design_f32(num_taps, ARM_WINDOW_KAISER, HILBERT_KAISER_BETA,
+                               hilbert_coeffs_f32);
+        arm_hilbert_init_f32(&hilbert_inst, num_taps, hilbert_coeffs_f32,
+                             hilbert_state_f32, HILBERT_BLOCK_SIZE);
+
+        for (blk = 0; blk < HILBERT_LEN; blk += HILBERT_BLOCK_SIZE)
+        {
+            JTEST_COUNT_CYCLES(
+                arm_hilbert_f32(&hilbert_inst, input + blk,
+                                filtering_output_fut + 2 * blk,
+                                HILBERT_BLOCK_SIZE));
+        }
+
+        ref_hilbert_f32(hilbert_coeffs_f32, num_taps, input,
+                        filtering_output_ref, HILBERT_LEN);
+
+        TEST_ASSERT_SNR(filtering_output_ref, filtering_output_fut,
+                        2 * HILBERT_LEN, HILBERT_SNR_THRESHOLD_f32);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+ *  The Q15 inputs are scaled down by 4 to stay clear of the saturation.
+ */
+JTEST_DEFINE_TEST(arm_hilbert_q15_test,
+                  arm_hilbert_q15)
+{
+    arm_hilbert_instance_q15 hilbert_inst;
+    uint32_t i, n, blk;
+    uint16_t num_taps;
+
+    for (n = 0; n < HILBERT_LEN; n++)
+    {
+        hilbert_input_q15[n] = filtering_q15_inputs[n] >> 2;
+    }
+    TEST_CONVERT_TO_FLOAT(hilbert_input_q15, hilbert_input_f32,
+                          HILBERT_LEN, q15_t);
+
+    for (i = 0; i < sizeof(hilbert_num_taps) / sizeof(hilbert_num_taps[0]); i++)
+    {
+        num_taps = hilbert_num_taps[i];
+
+        JTEST_DUMP_STRF("Number of Taps: %d\n", (int)num_taps);
+
+        arm_hilbert_design_f32(num_taps, ARM_WINDOW_KAISER, HILBERT_KAISER_BETA,
+                               hilbert_coeffs_f32);
+        arm_float_to_q15(hilbert_coeffs_f32, hilbert_coeffs_q15,
+                         (num_taps + 1U) / 4U);
+        arm_hilbert_init_q15(&hilbert_inst, num_taps, hilbert_coeffs_q15,
+                             hilbert_state_q15, HILBERT_BLOCK_SIZE);
+
+        for (blk = 0; blk < HILBERT_LEN; blk += HILBERT_BLOCK_SIZE)
+        {
+            JTEST_COUNT_CYCLES(
+                arm_hilbert_q15(&hilbert_inst, hilbert_input_q15 + blk,
+                                hilbert_output_q15 + 2 * blk,
+                                HILBERT_BLOCK_SIZE));
+        }
+
+        /* Reference with the quantized coefficients */
+        TEST_CONVERT_TO_FLOAT(hilbert_coeffs_q15, hilbert_coeffs_f32,
+                              (num_taps + 1U) / 4U, q15_t);
+        ref_hilbert_f32(hilbert_coeffs_f32, num_taps, hilbert_input_f32,
+                        filtering_output_ref, HILBERT_LEN);
+
+        TEST_CONVERT_TO_FLOAT(hilbert_output_q15, filtering_output_fut,
+                              2 * HILBERT_LEN, q15_t);
+        TEST_ASSERT_SNR(filtering_output_ref, filtering_output_fut,
+                        2 * HILBERT_LEN, HILBERT_SNR_THRESHOLD_q15);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+ *  Lengths that are not of the form 4 * M - 1 are rejected.
+ */
+JTEST_DEFINE_TEST(arm_hilbert_init_f32_test,
+                  arm_hilbert_init_f32)
+{
+    arm_hilbert_instance_f32 hilbert_inst_f32;
+    arm_hilbert_instance_q15 hilbert_inst_q15;
+
+    if ((arm_hilbert_design_f32(33U, ARM_WINDOW_HANN, 0.0f, hilbert_coeffs_f32)
+         != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_hilbert_init_f32(&hilbert_inst_f32, 32U, hilbert_coeffs_f32,
+                              hilbert_state_f32, HILBERT_BLOCK_SIZE)
+         != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_hilbert_init_q15(&hilbert_inst_q15, 1U, hilbert_coeffs_q15,
+                              hilbert_state_q15, HILBERT_BLOCK_SIZE)
+         != ARM_MATH_ARGUMENT_ERROR))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+ *  Blocks compared to the reference circular Hilbert transform.
+ */
+JTEST_DEFINE_TEST(arm_analytic_f32_test,
+                  arm_analytic_f32)
+{
+    arm_analytic_instance_f32 analytic_inst;
+    uint32_t i;
+    uint16_t fft_len;
+
+    for (i = 0; i < sizeof(analytic_fft_lens) / sizeof(analytic_fft_lens[0]); i++)
+    {
+        fft_len = analytic_fft_lens[i];
+
+        JTEST_DUMP_STRF("FFT Length: %d\n", (int)fft_len);
+
+        if (arm_analytic_init_f32(&analytic_inst, fft_len) != ARM_MATH_SUCCESS)
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        /* The input is modified by the FUT */
+        memcpy(filtering_output_f32_fut, filtering_f32_inputs,
+               fft_len * sizeof(float32_t));
+
+        JTEST_COUNT_CYCLES(
+            arm_analytic_f32(&analytic_inst, filtering_output_f32_fut,
+                             filtering_output_fut));
+
+        ref_analytic_f32((float32_t *) filtering_f32_inputs,
+                         filtering_output_ref, fft_len);
+
+        TEST_ASSERT_SNR(filtering_output_ref, filtering_output_fut,
+                        2 * fft_len, HILBERT_SNR_THRESHOLD_f32);
+    }
+
+    if ((arm_analytic_init_f32(&analytic_inst, 16U) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_analytic_init_f32(&analytic_inst, 100U) != ARM_MATH_ARGUMENT_ERROR))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+ *  Instantaneous amplitude, phase and frequency of the analytic signal of the
+ *  test inputs, in two blocks, compared to the reference.
+ */
+JTEST_DEFINE_TEST(arm_cmplx_inst_f32_test,
+                  arm_cmplx_inst_f32)
+{
+    float32_t prev_fut = 0.0f;
+    float32_t prev_ref = 0.0f;
+    uint32_t half = HILBERT_LEN / 2U;
+
+    ref_analytic_f32((float32_t *) filtering_f32_inputs,
+                     filtering_output_fut, HILBERT_LEN);
+
+    JTEST_COUNT_CYCLES(
+        arm_cmplx_inst_f32(filtering_output_fut, hilbert_amp_f32,
+                           hilbert_phase_f32, hilbert_freq_f32,
+                           &prev_fut, half));
+    arm_cmplx_inst_f32(filtering_output_fut + 2 * half, hilbert_amp_f32 + half,
+                       hilbert_phase_f32 + half, hilbert_freq_f32 + half,
+                       &prev_fut, HILBERT_LEN - half);
+
+    ref_cmplx_inst_f32(filtering_output_fut, filtering_output_ref,
+                       filtering_output_ref + HILBERT_LEN,
+                       filtering_output_ref + 2 * HILBERT_LEN,
+                       &prev_ref, HILBERT_LEN);
+
+    TEST_ASSERT_SNR(filtering_output_ref, hilbert_amp_f32,
+                    HILBERT_LEN, HILBERT_SNR_THRESHOLD_f32);
+    TEST_ASSERT_SNR(filtering_output_ref + HILBERT_LEN, hilbert_phase_f32,
+                    HILBERT_LEN, HILBERT_SNR_THRESHOLD_f32);
+    TEST_ASSERT_SNR(filtering_output_ref + 2 * HILBERT_LEN, hilbert_freq_f32,
+                    HILBERT_LEN, HILBERT_SNR_THRESHOLD_f32);
+
+    if (prev_fut != hilbert_phase_f32[HILBERT_LEN - 1U])
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+ *  A tone through the Hilbert transformer: once the filter is filled, the
+ *  amplitude and the frequency of the tone must be recovered at every sample.
+ */
+#define HILBERT_TONE_DEFINE_TEST(suffix, amp_scale, freq_scale)             \
+    JTEST_DEFINE_TEST(arm_cmplx_inst_##suffix##_tone_test,                  \
+                      arm_cmplx_inst_##suffix)                              \
+    {                                                                       \
+        arm_hilbert_instance_##suffix hilbert_inst;                         \
+        TYPE_FROM_ABBREV(suffix) prev = 0;                                  \
+        float32_t amp, freq;                                                \
+        uint32_t n;                                                         \
+                                                                            \
+        hilbert_make_tone();                                                \
+        arm_hilbert_design_f32(31U, ARM_WINDOW_KAISER, HILBERT_KAISER_BETA, \
+                               hilbert_coeffs_f32);                         \
+        arm_float_to_q15(hilbert_coeffs_f32, hilbert_coeffs_q15, 8U);       \
+        arm_hilbert_init_##suffix(&hilbert_inst, 31U,                       \
+                                  hilbert_coeffs_##suffix,                  \
+                                  hilbert_state_##suffix, HILBERT_LEN);     \
+        arm_hilbert_##suffix(&hilbert_inst, hilbert_input_##suffix,         \
+                             (TYPE_FROM_ABBREV(suffix) *) filtering_output_fut, \
+                             HILBERT_LEN);                                  \
+                                                                            \
+        JTEST_COUNT_CYCLES(                                                 \
+            arm_cmplx_inst_##suffix(                                        \
+                (TYPE_FROM_ABBREV(suffix) *) filtering_output_fut,          \
+                hilbert_amp_##suffix, hilbert_phase_##suffix,               \
+                hilbert_freq_##suffix, &prev, HILBERT_LEN));                \
+                                                                            \
+        for (n = 31U; n < HILBERT_LEN; n++)                                 \
+        {                                                                   \
+            amp = (float32_t) hilbert_amp_##suffix[n] * (amp_scale);        \
+            freq = (float32_t) hilbert_freq_##suffix[n] * (freq_scale);     \
+            if ((fabsf(amp - HILBERT_TONE_AMP) > HILBERT_AMP_TOL) ||        \
+                (fabsf(freq - HILBERT_TONE_FREQ) > HILBERT_FREQ_TOL))       \
+            {                                                               \
+                JTEST_DUMP_STRF("Sample %d\nAmplitude: %f\nFrequency: %f\n", \
+                                (int)n, (double)amp, (double)freq);         \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+HILBERT_TONE_DEFINE_TEST(f32, 1.0f, 1.0f);
+HILBERT_TONE_DEFINE_TEST(q15, 1.0f / 16384.0f, 1.0f / 65536.0f);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(hilbert_tests)
+{
+    JTEST_TEST_CALL(arm_hilbert_f32_test);
+    JTEST_TEST_CALL(arm_hilbert_q15_test);
+    JTEST_TEST_CALL(arm_hilbert_init_f32_test);
+    JTEST_TEST_CALL(arm_analytic_f32_test);
+    JTEST_TEST_CALL(arm_cmplx_inst_f32_test);
+    JTEST_TEST_CALL(arm_cmplx_inst_f32_tone_test);
+    JTEST_TEST_CALL(arm_cmplx_inst_q15_tone_test);
+}
@@ -0,0 +1,272 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Header Stuff */
+/*--------------------------------------------------------------------------------*/
+
+#define POLYFIT_MAX_POINTS 1000U
+#define POLYFIT_MAX_ORDER  5U
+
+/* Comparison SNR thresholds of the fitted curves and of the evaluations */
+#define POLYFIT_SNR_THRESHOLD      90
+#define POLY_EVAL_SNR_THRESHOLD_f32 120
+#define POLY_EVAL_SNR_THRESHOLD_q31 140
+
+/* Shift of the Q31 coefficients */
+#define POLY_EVAL_POST_SHIFT 2U
+
+typedef struct
+{
+    uint16_t order;
+    uint32_t num_points;
+    uint8_t weighted;
+    float32_t x_first;
+    float32_t x_step;
+} polyfit_config;
+
+/* The last configuration is the calibration of a sensor over its raw ADC range */
+static const polyfit_config polyfit_configs[] =
+{
+    {1U,   10U, 0U,    0.0f,   1.0f},
+    {2U,    3U, 0U,   -1.0f,   1.0f},
+    {3U,  200U, 1U,   -2.0f,  0.02f},
+    {5U, 1000U, 0U,    0.5f, 0.003f},
+    {5U, 1000U, 1U,    0.5f, 0.003f},
+    {4U,  500U, 1U, 1000.0f,   4.0f}
+};
+
+/* Coefficients of the fitted polynomials, constant term first */
+static const float32_t polyfit_true_coeffs[POLYFIT_MAX_ORDER + 1U] =
+{
+    0.8f, -1.5f, 0.6f, 0.25f, -0.12f, 0.02f
+};
+
+static float32_t polyfit_x[POLYFIT_MAX_POINTS];
+static float32_t polyfit_y[POLYFIT_MAX_POINTS];
+static float32_t polyfit_w[POLYFIT_MAX_POINTS];
+static float32_t polyfit_fit_fut[POLYFIT_MAX_POINTS];
+static float32_t polyfit_fit_ref[POLYFIT_MAX_POINTS];
+static float32_t polyfit_coeffs_fut[POLYFIT_MAX_ORDER + 1U];
+static float32_t polyfit_coeffs_ref[POLYFIT_MAX_ORDER + 1U];
+static float32_t polyfit_work[ARM_POLYFIT_WORK_SIZE(POLYFIT_MAX_ORDER)];
+
+static q31_t poly_eval_coeffs_q31[POLYFIT_MAX_ORDER + 1U];
+static q31_t poly_eval_input_q31[POLYFIT_MAX_POINTS];
+static q31_t poly_eval_output_q31[POLYFIT_MAX_POINTS];
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+ *  Fill the points of a configuration: the reference polynomial of the
+ *  configuration order, rescaled to the range of x, plus a deterministic
+ *  noise.  The weights decrease for the noisier points.
+ */
+static void polyfit_make_points(const polyfit_config * c)
+{
+    uint32_t seed = 12345U;
+    float32_t span = c->x_step * (float32_t) (c->num_points - 1U);
+    float32_t t, noise;
+    uint32_t i;
+
+    for (i = 0; i < c->num_points; i++)
+    {
+        polyfit_x[i] = c->x_first + c->x_step * (float32_t) i;
+
+        t = (span > 0.0f) ? (2.0f * (float32_t) i / (float32_t) (c->num_points - 1U) - 1.0f) : 0.0f;
+        ref_poly_eval_f32(polyfit_true_coeffs, c->order, &t, &polyfit_y[i], 1U);
+
+        seed = seed * 1664525U + 1013904223U;
+        noise = ((float32_t) (seed >> 8) / 16777216.0f - 0.5f) * 0.01f;
+        polyfit_w[i] = ((i & 3U) == 0U) ? 0.25f : 1.0f;
+        polyfit_y[i] += ((i & 3U) == 0U) ? 4.0f * noise : noise;
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+ *  The fitted polynomials are evaluated on the points and compared to the
+ *  ones of the reference fit, solved in double precision from the normal
+ *  equations.
+ */
+JTEST_DEFINE_TEST(arm_polyfit_f32_test,
+                  arm_polyfit_f32)
+{
+    const polyfit_config * c;
+    arm_status status;
+    uint32_t cfg;
+
+    for (cfg = 0; cfg < sizeof(polyfit_configs) / sizeof(polyfit_configs[0]); cfg++)
+    {
+        c = &polyfit_configs[cfg];
+
+        JTEST_DUMP_STRF("Order: %d\nPoints: %d\nWeighted: %d\n",
+                        (int)c->order, (int)c->num_points, (int)c->weighted);
+
+        polyfit_make_points(c);
+
+        JTEST_COUNT_CYCLES(
+            status = arm_polyfit_f32(polyfit_x, polyfit_y,
+                                     c->weighted ? polyfit_w : NULL,
+                                     c->num_points, c->order,
+                                     polyfit_coeffs_fut, polyfit_work));
+
+        if (status != ARM_MATH_SUCCESS)
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        ref_polyfit_f32(polyfit_x, polyfit_y, c->weighted ? polyfit_w : NULL,
+                        c->num_points, c->order, polyfit_coeffs_ref);
+
+        ref_poly_eval_f32(polyfit_coeffs_fut, c->order, polyfit_x,
+                          polyfit_fit_fut, c->num_points);
+        ref_poly_eval_f32(polyfit_coeffs_ref, c->order, polyfit_x,
+                          polyfit_fit_ref, c->num_points);
+
+        TEST_ASSERT_SNR(polyfit_fit_ref, polyfit_fit_fut, c->num_points,
+                        POLYFIT_SNR_THRESHOLD);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+ *  Too few points, or too few distinct abscissae with a nonzero weight,
+ *  are rejected.
+ */
+JTEST_DEFINE_TEST(arm_polyfit_f32_singular_test,
+                  arm_polyfit_f32)
+{
+    uint32_t i;
+
+    for (i = 0; i < 8U; i++)
+    {
+        polyfit_x[i] = (float32_t) (i % 3U);
+        polyfit_y[i] = (float32_t) i;
+        polyfit_w[i] = (i < 4U) ? 1.0f : 0.0f;
+    }
+
+    if ((arm_polyfit_f32(polyfit_x, polyfit_y, NULL, 3U, 3U,
+                         polyfit_coeffs_fut, polyfit_work)
+         != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_polyfit_f32(polyfit_x, polyfit_y, NULL, 8U, 3U,
+                         polyfit_coeffs_fut, polyfit_work)
+         != ARM_MATH_SINGULAR) ||
+        (arm_polyfit_f32(polyfit_x, polyfit_y, polyfit_w, 8U, 2U,
+                         polyfit_coeffs_fut, polyfit_work)
+         != ARM_MATH_SUCCESS))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    /* Only the abscissae 0 and 1 keep a nonzero weight */
+    polyfit_w[2] = 0.0f;
+
+    if (arm_polyfit_f32(polyfit_x, polyfit_y, polyfit_w, 8U, 2U,
+                        polyfit_coeffs_fut, polyfit_work)
+        != ARM_MATH_SINGULAR)
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+ *  Evaluation of the polynomials of all the orders on a ramp, compared to
+ *  the reference Horner evaluation in double precision.
+ */
+JTEST_DEFINE_TEST(arm_poly_eval_f32_test,
+                  arm_poly_eval_f32)
+{
+    uint32_t i;
+    uint16_t order;
+
+    for (i = 0; i < POLYFIT_MAX_POINTS; i++)
+    {
+        polyfit_x[i] = -1.5f + 3.0f * (float32_t) i / (float32_t) POLYFIT_MAX_POINTS;
+    }
+
+    for (order = 0; order <= POLYFIT_MAX_ORDER; order++)
+    {
+        JTEST_DUMP_STRF("Order: %d\n", (int)order);
+
+        /* Lengths that are not multiples of 4 exercise the remainder loop */
+        JTEST_COUNT_CYCLES(
+            arm_poly_eval_f32(polyfit_true_coeffs, order, polyfit_x,
+                              polyfit_fit_fut, POLYFIT_MAX_POINTS - order));
+
+        ref_poly_eval_f32(polyfit_true_coeffs, order, polyfit_x,
+                          polyfit_fit_ref, POLYFIT_MAX_POINTS - order);
+
+        TEST_ASSERT_SNR(polyfit_fit_ref, polyfit_fit_fut,
+                        POLYFIT_MAX_POINTS - order,
+                        POLY_EVAL_SNR_THRESHOLD_f32);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_poly_eval_q31_test,
+                  arm_poly_eval_q31)
+{
+    uint32_t i;
+    uint16_t order;
+
+    for (i = 0; i < POLYFIT_MAX_POINTS; i++)
+    {
+        polyfit_x[i] = -1.0f + 2.0f * (float32_t) i / (float32_t) POLYFIT_MAX_POINTS;
+    }
+    arm_float_to_q31(polyfit_x, poly_eval_input_q31, POLYFIT_MAX_POINTS);
+
+    arm_scale_f32((float32_t *) polyfit_true_coeffs,
+                  1.0f / (float32_t) (1U << POLY_EVAL_POST_SHIFT),
+                  polyfit_coeffs_fut, POLYFIT_MAX_ORDER + 1U);
+    arm_float_to_q31(polyfit_coeffs_fut, poly_eval_coeffs_q31,
+                     POLYFIT_MAX_ORDER + 1U);
+
+    for (order = 0; order <= POLYFIT_MAX_ORDER; order++)
+    {
+        JTEST_DUMP_STRF("Order: %d\n", (int)order);
+
+        JTEST_COUNT_CYCLES(
+            arm_poly_eval_q31(poly_eval_coeffs_q31, order,
+                              POLY_EVAL_POST_SHIFT, poly_eval_input_q31,
+                              poly_eval_output_q31, POLYFIT_MAX_POINTS - order));
+
+        ref_poly_eval_q31(poly_eval_coeffs_q31, order, POLY_EVAL_POST_SHIFT,
+                          poly_eval_input_q31, (q31_t *) polyfit_fit_ref,
+                          POLYFIT_MAX_POINTS - order);
+
+        TEST_CONVERT_AND_ASSERT_SNR(polyfit_fit_ref, (q31_t *) polyfit_fit_ref,
+                                    polyfit_fit_fut, poly_eval_output_q31,
+                                    POLYFIT_MAX_POINTS - order, q31_t,
+                                    POLY_EVAL_SNR_THRESHOLD_q31);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_polyfit_tests)
+{
+    JTEST_TEST_CALL(arm_polyfit_f32_test);
+    JTEST_TEST_CALL(arm_polyfit_f32_singular_test);
+    JTEST_TEST_CALL(arm_poly_eval_f32_test);
+    JTEST_TEST_CALL(arm_poly_eval_q31_test);
+}
@@ -12,6 +12,7 @@ JTEST_DEFINE_GROUP(matrix_tests)
     JTEST_GROUP_CALL(mat_inverse_tests);
     JTEST_GROUP_CALL(mat_mult_tests);
     JTEST_GROUP_CALL(mat_mult_fast_tests);
+    JTEST_GROUP_CALL(mat_polyfit_tests);
     JTEST_GROUP_CALL(mat_sub_tests);
     JTEST_GROUP_CALL(mat_trans_tests);
     JTEST_GROUP_CALL(mat_scale_tests);
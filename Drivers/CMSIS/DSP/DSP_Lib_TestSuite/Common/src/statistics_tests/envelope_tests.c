@@ -0,0 +1,264 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Input Data */
+/*--------------------------------------------------------------------------------*/
+
+#define ENVELOPE_LEN 512U
+
+#define ENVELOPE_SNR_THRESHOLD_f32 120
+#define ENVELOPE_SNR_THRESHOLD_q31 100
+#define ENVELOPE_SNR_THRESHOLD_q15 60
+
+/* Largest envelope of a block, converted to the type of the envelope */
+#define ENVELOPE_MAX_f32(max) (max)
+#define ENVELOPE_MAX_q31(max) (max)
+#define ENVELOPE_MAX_q15(max) ((q15_t) ((max) >> 16))
+
+/* Amplitude of the low level test: the mean square is about 0.1 LSB in 1.15 format */
+#define ENVELOPE_LOW_AMP 0.0025f
+
+typedef struct
+{
+    arm_envelope_detector detector;
+    float32_t attack;
+    float32_t release;
+    uint32_t hold;
+} envelope_config;
+
+/* Peak hold, envelope follower, exponential RMS and RMS with hold */
+static const envelope_config envelope_configs[] =
+{
+    {ARM_ENVELOPE_PEAK, 1.0f,  0.02f,  40},
+    {ARM_ENVELOPE_PEAK, 0.3f,  0.01f,  0},
+    {ARM_ENVELOPE_RMS,  0.02f, 0.02f,  0},
+    {ARM_ENVELOPE_RMS,  0.1f,  0.005f, 8}
+};
+
+/* The signal is processed in blocks of these sizes, in turn */
+static const uint32_t envelope_block_sizes[] = {1, 7, 64, 3, 100, 33};
+
+/* Amplitudes of the four bursts of the signal */
+static const float32_t envelope_amps[4] = {0.1f, 0.8f, 0.3f, 0.02f};
+
+static float32_t envelope_input_f32[ENVELOPE_LEN];
+static float32_t envelope_output_f32_ref[ENVELOPE_LEN];
+static float32_t envelope_output_f32_fut[ENVELOPE_LEN];
+static q31_t envelope_input_fut[ENVELOPE_LEN];
+static q31_t envelope_output_fut[ENVELOPE_LEN];
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Fill envelope_input_f32 with four bursts of a tone of increasing, then
+  decreasing amplitude.
+*/
+static void envelope_make_input(void)
+{
+    uint32_t n;
+
+    for (n = 0; n < ENVELOPE_LEN; n++)
+    {
+        envelope_input_f32[n] = envelope_amps[n / (ENVELOPE_LEN / 4U)] *
+            sinf(0.173f * (float32_t) n + 0.5f);
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Envelope test template.  Arguments are: function suffix (f32/q31/q15), data
+  type and type of the returned value.  The signal is tracked in blocks of
+  varying sizes and compared to the reference tracker run on the whole
+  signal.  The value returned for each block must be the largest envelope
+  of the block.
+*/
+#define ENVELOPE_DEFINE_TEST(suffix, type, max_type)                        \
+    JTEST_DEFINE_TEST(arm_envelope_##suffix##_test,                         \
+                      arm_envelope_##suffix)                                \
+    {                                                                       \
+        arm_envelope_instance_##suffix env_inst;                            \
+        type * input_fut =                                                  \
+            (type *) envelope_input_fut;                                    \
+        type * output_fut =                                                 \
+            (type *) envelope_output_fut;                                   \
+        type coeffs[2];                                                     \
+        max_type block_max;                                                 \
+        type expected_max;                                                  \
+        float32_t coeffs_f32[2];                                            \
+        uint32_t cfg;                                                       \
+        uint32_t pos;                                                       \
+        uint32_t len;                                                       \
+        uint32_t blk;                                                       \
+        uint32_t n;                                                         \
+                                                                            \
+        envelope_make_input();                                              \
+        TEST_CONVERT_FLOAT_TO(envelope_input_f32, input_fut,                \
+                              ENVELOPE_LEN, type);                          \
+        TEST_CONVERT_TO_FLOAT(input_fut, envelope_input_f32,                \
+                              ENVELOPE_LEN, type);                          \
+                                                                            \
+        for (cfg = 0;                                                       \
+             cfg < sizeof(envelope_configs) / sizeof(envelope_configs[0]);  \
+             cfg++)                                                         \
+        {                                                                   \
+            const envelope_config * c = &envelope_configs[cfg];             \
+                                                                            \
+            JTEST_DUMP_STRF("Configuration: %d\n", (int)cfg);               \
+                                                                            \
+            coeffs_f32[0] = c->attack;                                      \
+            coeffs_f32[1] = c->release;                                     \
+            TEST_CONVERT_FLOAT_TO(coeffs_f32, coeffs, 2,                    \
+                                  type);                                    \
+            arm_envelope_init_##suffix(&env_inst, c->detector,              \
+                                       coeffs[0], coeffs[1], c->hold);      \
+                                                                            \
+            for (pos = 0, blk = 0; pos < ENVELOPE_LEN; pos += len, blk++)   \
+            {                                                               \
+                len = envelope_block_sizes[blk % (sizeof(envelope_block_sizes) / \
+                                                  sizeof(envelope_block_sizes[0]))]; \
+                len = (len < ENVELOPE_LEN - pos) ? len : (ENVELOPE_LEN - pos); \
+                                                                            \
+                JTEST_COUNT_CYCLES(                                         \
+                    block_max = arm_envelope_##suffix(                      \
+                        &env_inst, input_fut + pos, output_fut + pos, len)); \
+                                                                            \
+                expected_max = output_fut[pos];                             \
+                for (n = 1; n < len; n++)                                   \
+                {                                                           \
+                    expected_max = (output_fut[pos + n] > expected_max) ?   \
+                        output_fut[pos + n] : expected_max;                 \
+                }                                                           \
+                if (ENVELOPE_MAX_##suffix(block_max) != expected_max)       \
+                {                                                           \
+                    JTEST_DUMP_STRF("Wrong maximum of block %d\n", (int)blk); \
+                    return JTEST_TEST_FAILED;                               \
+                }                                                           \
+            }                                                               \
+                                                                            \
+            ref_envelope_f32(envelope_input_f32, ENVELOPE_LEN, c->detector, \
+                             c->attack, c->release, c->hold,                \
+                             envelope_output_f32_ref);                      \
+                                                                            \
+            TEST_CONVERT_TO_FLOAT(output_fut, envelope_output_f32_fut,      \
+                                  ENVELOPE_LEN, type);                      \
+            TEST_ASSERT_SNR(envelope_output_f32_ref,                        \
+                            envelope_output_f32_fut,                        \
+                            ENVELOPE_LEN, ENVELOPE_SNR_THRESHOLD_##suffix); \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+ENVELOPE_DEFINE_TEST(f32, float32_t, float32_t);
+ENVELOPE_DEFINE_TEST(q31, q31_t, q31_t);
+ENVELOPE_DEFINE_TEST(q15, q15_t, q31_t);
+
+/*
+  The Q15 RMS detector returns the mean square of a signal below -45 dBFS,
+  which is under 1 LSB of the Q15 envelope, in 1.31 format.
+*/
+JTEST_DEFINE_TEST(arm_envelope_q15_low_level_test,
+                  arm_envelope_q15)
+{
+    arm_envelope_instance_q15 env_inst;
+    q15_t * input_fut = (q15_t *) envelope_input_fut;
+    float32_t expected_max;
+    float32_t block_max;
+    uint32_t n;
+
+    for (n = 0; n < ENVELOPE_LEN; n++)
+    {
+        envelope_input_f32[n] = ENVELOPE_LOW_AMP * sinf(0.173f * (float32_t) n + 0.5f);
+    }
+    arm_float_to_q15(envelope_input_f32, input_fut, ENVELOPE_LEN);
+    arm_q15_to_float(input_fut, envelope_input_f32, ENVELOPE_LEN);
+
+    arm_envelope_init_q15(&env_inst, ARM_ENVELOPE_RMS, 655, 655, 0);
+    block_max = (float32_t) arm_envelope_q15(&env_inst, input_fut, NULL,
+                                             ENVELOPE_LEN) / 2147483648.0f;
+
+    ref_envelope_f32(envelope_input_f32, ENVELOPE_LEN, ARM_ENVELOPE_RMS,
+                     655.0f / 32768.0f, 655.0f / 32768.0f, 0,
+                     envelope_output_f32_ref);
+
+    expected_max = 0.0f;
+    for (n = 0; n < ENVELOPE_LEN; n++)
+    {
+        expected_max = (envelope_output_f32_ref[n] > expected_max) ?
+            envelope_output_f32_ref[n] : expected_max;
+    }
+
+    if (fabsf(block_max - expected_max) > 0.02f * expected_max)
+    {
+        JTEST_DUMP_STRF("Maximum: %f, expected: %f\n",
+                        (double)block_max, (double)expected_max);
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  A NULL output only updates the state: the next block continues
+  from the same envelope.
+*/
+JTEST_DEFINE_TEST(arm_envelope_null_output_test,
+                  arm_envelope_f32)
+{
+    arm_envelope_instance_f32 env_inst;
+    float32_t block_max;
+
+    envelope_make_input();
+
+    arm_envelope_init_f32(&env_inst, ARM_ENVELOPE_PEAK,
+                          arm_envelope_coeff_f32(0.0f, 48000.0f),
+                          arm_envelope_coeff_f32(0.01f, 48000.0f), 0);
+
+    block_max = arm_envelope_f32(&env_inst, envelope_input_f32, NULL,
+                                 ENVELOPE_LEN / 2U);
+    arm_envelope_f32(&env_inst, envelope_input_f32 + ENVELOPE_LEN / 2U,
+                     envelope_output_f32_fut, ENVELOPE_LEN / 2U);
+
+    ref_envelope_f32(envelope_input_f32, ENVELOPE_LEN, ARM_ENVELOPE_PEAK,
+                     1.0f, arm_envelope_coeff_f32(0.01f, 48000.0f), 0,
+                     envelope_output_f32_ref);
+
+    /* The second burst has the largest amplitude */
+    if (fabsf(block_max - envelope_amps[1]) > 0.01f)
+    {
+        JTEST_DUMP_STRF("Maximum: %f\n", (double)block_max);
+        return JTEST_TEST_FAILED;
+    }
+
+    TEST_ASSERT_SNR(envelope_output_f32_ref + ENVELOPE_LEN / 2U,
+                    envelope_output_f32_fut,
+                    ENVELOPE_LEN / 2U, ENVELOPE_SNR_THRESHOLD_f32);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(envelope_tests)
+{
+    JTEST_TEST_CALL(arm_envelope_f32_test);
+    JTEST_TEST_CALL(arm_envelope_q31_test);
+    JTEST_TEST_CALL(arm_envelope_q15_test);
+    JTEST_TEST_CALL(arm_envelope_q15_low_level_test);
+    JTEST_TEST_CALL(arm_envelope_null_output_test);
+}
@@ -0,0 +1,152 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Histogram parameters.  The ranges do not cover all the test inputs, so that
+  the clamping of the samples to the first and last bins is exercised.
+*/
+#define HISTOGRAM_NUM_BINS 10
+#define HISTOGRAM_MIN_f32  (-0.3f)
+#define HISTOGRAM_MAX_f32  (0.3f)
+#define HISTOGRAM_MIN_q15  ((q15_t) -20000)
+#define HISTOGRAM_MAX_q15  ((q15_t) 20000)
+
+/*
+  Histogram test function.  The bin counts are cleared before each call and
+  compared exactly.
+*/
+#define JTEST_ARM_HISTOGRAM_TEST(suffix)                                \
+    JTEST_DEFINE_TEST(arm_histogram_##suffix##_test,                    \
+                      arm_histogram_##suffix)                           \
+    {                                                                   \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            input_idx, ARR_DESC_t *, input_ptr, statistics_f_all        \
+            ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                block_size_idx, uint32_t, block_size,                   \
+                statistics_block_sizes                                  \
+                ,                                                       \
+                TYPE_FROM_ABBREV(suffix) * input_data_ptr =             \
+                    (TYPE_FROM_ABBREV(suffix) *) input_ptr->data_ptr;   \
+                                                                        \
+                TEST_DO_VALID_BLOCKSIZE(                                \
+                    block_size, TYPE_FROM_ABBREV(suffix), input_ptr     \
+                    ,                                                   \
+                    memset(statistics_output_fut.data_ptr, 0,           \
+                           HISTOGRAM_NUM_BINS * sizeof(uint32_t));      \
+                    memset(statistics_output_ref.data_ptr, 0,           \
+                           HISTOGRAM_NUM_BINS * sizeof(uint32_t));      \
+                                                                        \
+                    TEST_CALL_FUT_AND_REF(                              \
+                        arm_histogram_##suffix,                         \
+                        PAREN(input_data_ptr, block_size,               \
+                              HISTOGRAM_MIN_##suffix,                   \
+                              HISTOGRAM_MAX_##suffix,                   \
+                              HISTOGRAM_NUM_BINS,                       \
+                              statistics_output_fut.data_ptr),          \
+                        ref_histogram_##suffix,                         \
+                        PAREN(input_data_ptr, block_size,               \
+                              HISTOGRAM_MIN_##suffix,                   \
+                              HISTOGRAM_MAX_##suffix,                   \
+                              HISTOGRAM_NUM_BINS,                       \
+                              statistics_output_ref.data_ptr));         \
+                                                                        \
+                    TEST_ASSERT_BUFFERS_EQUAL(                          \
+                        statistics_output_ref.data_ptr,                 \
+                        statistics_output_fut.data_ptr,                 \
+                        HISTOGRAM_NUM_BINS * sizeof(uint32_t)))));      \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_HISTOGRAM_TEST(f32);
+JTEST_ARM_HISTOGRAM_TEST(q15);
+
+/*
+  Every Q15 value is binned over ranges that are not multiples of the number
+  of bins or not powers of two, and compared to the reference histogram.
+*/
+#define HISTOGRAM_CHUNK    256U
+#define HISTOGRAM_MAX_BINS 13U
+
+typedef struct
+{
+    q15_t minVal;
+    q15_t maxVal;
+    uint16_t numBins;
+} histogram_range;
+
+static const histogram_range histogram_ranges_q15[] =
+{
+    {(q15_t) -20000, (q15_t) 20000,  2U},
+    {(q15_t)      0, (q15_t) 30000,  3U},
+    {(q15_t) -32768, (q15_t) 32767,  7U},
+    {(q15_t)   -100, (q15_t)  1234, 13U}
+};
+
+JTEST_DEFINE_TEST(arm_histogram_q15_ranges_test,
+                  arm_histogram_q15)
+{
+    q15_t input[HISTOGRAM_CHUNK];
+    uint32_t hist_fut[HISTOGRAM_MAX_BINS];
+    uint32_t hist_ref[HISTOGRAM_MAX_BINS];
+    const histogram_range * r;
+    uint32_t range_idx;
+    uint32_t start;
+    uint32_t i;
+
+    for (range_idx = 0;
+         range_idx < sizeof(histogram_ranges_q15) / sizeof(histogram_ranges_q15[0]);
+         range_idx++)
+    {
+        r = &histogram_ranges_q15[range_idx];
+
+        JTEST_DUMP_STRF("Range: [%d %d)\nBins: %d\n",
+                        (int)r->minVal, (int)r->maxVal, (int)r->numBins);
+
+        memset(hist_fut, 0, sizeof(hist_fut));
+        memset(hist_ref, 0, sizeof(hist_ref));
+
+        for (start = 0; start < 65536U; start += HISTOGRAM_CHUNK)
+        {
+            for (i = 0; i < HISTOGRAM_CHUNK; i++)
+            {
+                input[i] = (q15_t) ((int32_t) (start + i) - 32768);
+            }
+
+            arm_histogram_q15(input, HISTOGRAM_CHUNK, r->minVal, r->maxVal,
+                              r->numBins, hist_fut);
+            ref_histogram_q15(input, HISTOGRAM_CHUNK, r->minVal, r->maxVal,
+                              r->numBins, hist_ref);
+        }
+
+        TEST_ASSERT_BUFFERS_EQUAL(hist_ref, hist_fut,
+                                  r->numBins * sizeof(uint32_t));
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(histogram_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_histogram_f32_test);
+    JTEST_TEST_CALL(arm_histogram_q15_test);
+    JTEST_TEST_CALL(arm_histogram_q15_ranges_test);
+}
@@ -0,0 +1,207 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The FUTs reorder their input, so each call works on a copy of the test input:
+  statistics_output_f32_fut for the FUT and statistics_output_f32_ref for the
+  qsort() based reference, whose cycle count is displayed for comparison.
+*/
+#define SELECT_WORK_FUT(suffix)                         \
+    ((TYPE_FROM_ABBREV(suffix) *) statistics_output_f32_fut)
+#define SELECT_WORK_REF(suffix)                         \
+    ((TYPE_FROM_ABBREV(suffix) *) statistics_output_f32_ref)
+
+/* Number of ranks tested for each block, from the smallest to the largest. */
+#define SELECT_NUM_RANKS 3
+
+/*
+  Checks that the FUT left the k-th smallest element at position k, with no
+  greater element before it and no lower element after it.
+*/
+#define SELECT_CHECK_PARTITION(suffix)                                  \
+    static int select_check_partition_##suffix(                         \
+        TYPE_FROM_ABBREV(suffix) * pSrc,                                \
+        uint32_t blockSize,                                             \
+        uint32_t k)                                                     \
+    {                                                                   \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0; i < blockSize; i++)                                 \
+        {                                                               \
+            if (((i < k) && (pSrc[i] > pSrc[k])) ||                     \
+                ((i > k) && (pSrc[i] < pSrc[k])))                       \
+            {                                                           \
+                return 0;                                               \
+            }                                                           \
+        }                                                               \
+        return 1;                                                       \
+    }
+
+SELECT_CHECK_PARTITION(f32)
+SELECT_CHECK_PARTITION(q31)
+SELECT_CHECK_PARTITION(q15)
+
+/*
+  Selection test function.
+*/
+#define JTEST_ARM_SELECT_TEST(suffix)                                   \
+    JTEST_DEFINE_TEST(arm_select_##suffix##_test,                       \
+                      arm_select_##suffix)                              \
+    {                                                                   \
+        uint32_t rank_idx;                                              \
+        uint32_t k;                                                     \
+                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            input_idx, ARR_DESC_t *, input_ptr, statistics_f_all        \
+            ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                block_size_idx, uint32_t, block_size,                   \
+                statistics_block_sizes                                  \
+                ,                                                       \
+                TYPE_FROM_ABBREV(suffix) * input_data_ptr =             \
+                    (TYPE_FROM_ABBREV(suffix) *) input_ptr->data_ptr;   \
+                                                                        \
+                TEST_DO_VALID_BLOCKSIZE(                                \
+                    block_size, TYPE_FROM_ABBREV(suffix), input_ptr     \
+                    ,                                                   \
+                    for (rank_idx = 0; rank_idx < SELECT_NUM_RANKS;     \
+                         rank_idx++)                                    \
+                    {                                                   \
+                        k = (rank_idx * (block_size - 1)) /             \
+                            (SELECT_NUM_RANKS - 1);                     \
+                                                                        \
+                        memcpy(SELECT_WORK_FUT(suffix), input_data_ptr, \
+                               block_size *                             \
+                               sizeof(TYPE_FROM_ABBREV(suffix)));       \
+                        memcpy(SELECT_WORK_REF(suffix), input_data_ptr, \
+                               block_size *                             \
+                               sizeof(TYPE_FROM_ABBREV(suffix)));       \
+                                                                        \
+                        TEST_CALL_FUT(                                  \
+                            arm_select_##suffix,                        \
+                            PAREN(SELECT_WORK_FUT(suffix), block_size,  \
+                                  k, statistics_output_fut.data_ptr));  \
+                                                                        \
+                        JTEST_DUMP_STR("qsort:\n");                     \
+                        JTEST_COUNT_CYCLES(                             \
+                            ref_select_##suffix(                        \
+                                SELECT_WORK_REF(suffix), block_size,    \
+                                k, statistics_output_ref.data_ptr));    \
+                                                                        \
+                        TEST_ASSERT_BUFFERS_EQUAL(                      \
+                            statistics_output_ref.data_ptr,             \
+                            statistics_output_fut.data_ptr,             \
+                            sizeof(TYPE_FROM_ABBREV(suffix)));          \
+                        TEST_ASSERT_EQUAL(                              \
+                            select_check_partition_##suffix(            \
+                                SELECT_WORK_FUT(suffix), block_size,    \
+                                k),                                     \
+                            1);                                         \
+                    })));                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_SELECT_TEST(f32);
+JTEST_ARM_SELECT_TEST(q31);
+JTEST_ARM_SELECT_TEST(q15);
+
+/*
+  Percentiles tested, as fractions converted to the type of the FUT.
+*/
+#define SELECT_NUM_PERCENTILES 4
+static const float32_t select_percentiles[SELECT_NUM_PERCENTILES] =
+    {0.0f, 0.25f, 0.5f, 0.9f};
+
+#define SELECT_PERCENTILE_f32(p) (p)
+#define SELECT_PERCENTILE_q31(p) ((q31_t) ((p) * 2147483648.0f))
+#define SELECT_PERCENTILE_q15(p) ((q15_t) ((p) * 32768.0f))
+
+/*
+  Percentile test function.  The interpolated result is compared by SNR, as
+  the reference interpolates in double precision.
+*/
+#define JTEST_ARM_PERCENTILE_TEST(suffix, output_type)                  \
+    JTEST_DEFINE_TEST(arm_percentile_##suffix##_test,                   \
+                      arm_percentile_##suffix)                          \
+    {                                                                   \
+        uint32_t percentile_idx;                                        \
+        TYPE_FROM_ABBREV(suffix) percentile;                            \
+                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            input_idx, ARR_DESC_t *, input_ptr, statistics_f_all        \
+            ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                block_size_idx, uint32_t, block_size,                   \
+                statistics_block_sizes                                  \
+                ,                                                       \
+                TYPE_FROM_ABBREV(suffix) * input_data_ptr =             \
+                    (TYPE_FROM_ABBREV(suffix) *) input_ptr->data_ptr;   \
+                                                                        \
+                TEST_DO_VALID_BLOCKSIZE(                                \
+                    block_size, TYPE_FROM_ABBREV(suffix), input_ptr     \
+                    ,                                                   \
+                    for (percentile_idx = 0;                            \
+                         percentile_idx < SELECT_NUM_PERCENTILES;       \
+                         percentile_idx++)                              \
+                    {                                                   \
+                        percentile = SELECT_PERCENTILE_##suffix(        \
+                            select_percentiles[percentile_idx]);        \
+                                                                        \
+                        memcpy(SELECT_WORK_FUT(suffix), input_data_ptr, \
+                               block_size *                             \
+                               sizeof(TYPE_FROM_ABBREV(suffix)));       \
+                        memcpy(SELECT_WORK_REF(suffix), input_data_ptr, \
+                               block_size *                             \
+                               sizeof(TYPE_FROM_ABBREV(suffix)));       \
+                                                                        \
+                        TEST_CALL_FUT(                                  \
+                            arm_percentile_##suffix,                    \
+                            PAREN(SELECT_WORK_FUT(suffix), block_size,  \
+                                  percentile,                           \
+                                  statistics_output_fut.data_ptr));     \
+                                                                        \
+                        JTEST_DUMP_STR("qsort:\n");                     \
+                        JTEST_COUNT_CYCLES(                             \
+                            ref_percentile_##suffix(                    \
+                                SELECT_WORK_REF(suffix), block_size,    \
+                                percentile,                             \
+                                statistics_output_ref.data_ptr));       \
+                                                                        \
+                        STATISTICS_SNR_COMPARE_INTERFACE(               \
+                            block_size, output_type);                   \
+                    })));                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_PERCENTILE_TEST(f32, float32_t);
+JTEST_ARM_PERCENTILE_TEST(q31, q31_t);
+JTEST_ARM_PERCENTILE_TEST(q15, q15_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(select_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_select_f32_test);
+    JTEST_TEST_CALL(arm_select_q31_test);
+    JTEST_TEST_CALL(arm_select_q15_test);
+    JTEST_TEST_CALL(arm_percentile_f32_test);
+    JTEST_TEST_CALL(arm_percentile_q31_test);
+    JTEST_TEST_CALL(arm_percentile_q15_test);
+}
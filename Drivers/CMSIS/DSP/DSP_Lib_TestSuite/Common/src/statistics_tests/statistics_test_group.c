@@ -10,5 +10,11 @@ JTEST_DEFINE_GROUP(statistics_tests)
     JTEST_GROUP_CALL(rms_tests);
     JTEST_GROUP_CALL(std_tests);
     JTEST_GROUP_CALL(var_tests);
+    JTEST_GROUP_CALL(stats_tests);
+    JTEST_GROUP_CALL(stats_acc_tests);
+    JTEST_GROUP_CALL(envelope_tests);
+    JTEST_GROUP_CALL(histogram_tests);
+    JTEST_GROUP_CALL(select_tests);
+    JTEST_GROUP_CALL(topk_tests);
     return;
 }
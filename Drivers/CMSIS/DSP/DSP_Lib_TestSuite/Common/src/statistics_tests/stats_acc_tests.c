@@ -0,0 +1,97 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Streaming statistics test function.
+
+  The block is accumulated twice: in one call to arm_stats_acc_update_xxx(), and
+  in three pieces spread over two instances that are then merged.  Both results
+  must match the single pass reference computed on the whole block.
+*/
+#define JTEST_ARM_STATS_ACC_TEST(suffix)                                \
+    JTEST_DEFINE_TEST(arm_stats_acc_##suffix##_test,                    \
+                      arm_stats_acc_update_##suffix)                    \
+    {                                                                   \
+        arm_stats_acc_instance_##suffix acc_a;                          \
+        arm_stats_acc_instance_##suffix acc_b;                          \
+        uint32_t split;                                                 \
+                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            input_idx, ARR_DESC_t *, input_ptr, statistics_f_all        \
+            ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                block_size_idx, uint32_t, block_size,                   \
+                statistics_block_sizes                                  \
+                ,                                                       \
+                TYPE_FROM_ABBREV(suffix) * input_data_ptr =             \
+                    (TYPE_FROM_ABBREV(suffix) *) input_ptr->data_ptr;   \
+                                                                        \
+                TEST_DO_VALID_BLOCKSIZE(                                \
+                    block_size, TYPE_FROM_ABBREV(suffix), input_ptr     \
+                    ,                                                   \
+                    ref_stats_##suffix(                                 \
+                        input_data_ptr, block_size, ARM_STATS_ALL,      \
+                        statistics_output_ref.data_ptr);                \
+                                                                        \
+                    /* Whole block in one update */                     \
+                    arm_stats_acc_init_##suffix(&acc_a);                \
+                    JTEST_COUNT_CYCLES(                                 \
+                        arm_stats_acc_update_##suffix(                  \
+                            &acc_a, input_data_ptr, block_size));       \
+                    arm_stats_acc_result_##suffix(                      \
+                        &acc_a, ARM_STATS_ALL,                          \
+                        statistics_output_fut.data_ptr);                \
+                                                                        \
+                    STATS_COMPARE_INTERFACE(suffix);                    \
+                                                                        \
+                    /* Three updates over two merged instances */       \
+                    split = block_size / 2U;                            \
+                    arm_stats_acc_init_##suffix(&acc_a);                \
+                    arm_stats_acc_init_##suffix(&acc_b);                \
+                    arm_stats_acc_update_##suffix(                      \
+                        &acc_a, input_data_ptr, split / 2U);            \
+                    arm_stats_acc_update_##suffix(                      \
+                        &acc_a, input_data_ptr + (split / 2U),          \
+                        split - (split / 2U));                          \
+                    arm_stats_acc_update_##suffix(                      \
+                        &acc_b, input_data_ptr + split,                 \
+                        block_size - split);                            \
+                    arm_stats_acc_merge_##suffix(&acc_a, &acc_b);       \
+                    arm_stats_acc_result_##suffix(                      \
+                        &acc_a, ARM_STATS_ALL,                          \
+                        statistics_output_fut.data_ptr);                \
+                                                                        \
+                    STATS_COMPARE_INTERFACE(suffix))));                 \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_STATS_ACC_TEST(f32);
+JTEST_ARM_STATS_ACC_TEST(q31);
+JTEST_ARM_STATS_ACC_TEST(q15);
+JTEST_ARM_STATS_ACC_TEST(q7);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(stats_acc_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_stats_acc_f32_test);
+    JTEST_TEST_CALL(arm_stats_acc_q31_test);
+    JTEST_TEST_CALL(arm_stats_acc_q15_test);
+    JTEST_TEST_CALL(arm_stats_acc_q7_test);
+}
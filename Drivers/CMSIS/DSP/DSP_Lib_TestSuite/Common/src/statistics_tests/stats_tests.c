@@ -0,0 +1,139 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Compute the same statistics with the single-statistic functions.  Used to
+  display the cycle count of the multi-pass equivalent of arm_stats_xxx().
+*/
+#define STATS_SEPARATE_CALLS(suffix, output_type)                       \
+    static void stats_separate_calls_##suffix(                          \
+        TYPE_FROM_ABBREV(suffix) * pSrc,                                \
+        uint32_t blockSize)                                             \
+    {                                                                   \
+        output_type * pDst = (output_type *) statistics_output_f32_fut; \
+                                                                        \
+        arm_mean_##suffix(pSrc, blockSize, pDst);                       \
+        arm_var_##suffix(pSrc, blockSize, pDst);                        \
+        arm_rms_##suffix(pSrc, blockSize, pDst);                        \
+        arm_min_##suffix(pSrc, blockSize, pDst, &statistics_idx_fut);   \
+        arm_max_##suffix(pSrc, blockSize, pDst, &statistics_idx_fut);   \
+    }
+
+STATS_SEPARATE_CALLS(f32, float32_t)
+STATS_SEPARATE_CALLS(q31, q31_t)
+STATS_SEPARATE_CALLS(q15, q15_t)
+
+/* There is no arm_var_q7() or arm_rms_q7(), the power is computed instead. */
+static void stats_separate_calls_q7(
+    q7_t * pSrc,
+    uint32_t blockSize)
+{
+    q31_t power;
+    q7_t * pDst = (q7_t *) statistics_output_f32_fut;
+
+    arm_mean_q7(pSrc, blockSize, pDst);
+    arm_power_q7(pSrc, blockSize, &power);
+    arm_min_q7(pSrc, blockSize, pDst, &statistics_idx_fut);
+    arm_max_q7(pSrc, blockSize, pDst, &statistics_idx_fut);
+}
+
+/*
+  Single pass statistics test function.  The cycle count of the equivalent
+  sequence of single-statistic calls is displayed for comparison.
+*/
+#define JTEST_ARM_STATS_TEST(suffix)                                    \
+    JTEST_DEFINE_TEST(arm_stats_##suffix##_test,                        \
+                      arm_stats_##suffix)                               \
+    {                                                                   \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            input_idx, ARR_DESC_t *, input_ptr, statistics_f_all        \
+            ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                block_size_idx, uint32_t, block_size,                   \
+                statistics_block_sizes                                  \
+                ,                                                       \
+                TYPE_FROM_ABBREV(suffix) * input_data_ptr =             \
+                    (TYPE_FROM_ABBREV(suffix) *) input_ptr->data_ptr;   \
+                                                                        \
+                TEST_DO_VALID_BLOCKSIZE(                                \
+                    block_size, TYPE_FROM_ABBREV(suffix), input_ptr     \
+                    ,                                                   \
+                    TEST_CALL_FUT_AND_REF(                              \
+                        arm_stats_##suffix,                             \
+                        ARM_stats_INPUT_INTERFACE(                      \
+                            input_data_ptr, block_size),                \
+                        ref_stats_##suffix,                             \
+                        REF_stats_INPUT_INTERFACE(                      \
+                            input_data_ptr, block_size));               \
+                                                                        \
+                    JTEST_DUMP_STR("Separate calls:\n");                \
+                    JTEST_COUNT_CYCLES(                                 \
+                        stats_separate_calls_##suffix(                  \
+                            input_data_ptr, block_size));               \
+                                                                        \
+                    STATS_COMPARE_INTERFACE(suffix))));                 \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_STATS_TEST(f32);
+JTEST_ARM_STATS_TEST(q31);
+JTEST_ARM_STATS_TEST(q15);
+JTEST_ARM_STATS_TEST(q7);
+
+/*
+  An empty vector is not read and leaves the results untouched.
+*/
+#define JTEST_ARM_STATS_EMPTY_TEST(suffix)                              \
+    JTEST_DEFINE_TEST(arm_stats_##suffix##_empty_test,                  \
+                      arm_stats_##suffix)                               \
+    {                                                                   \
+        arm_stats_result_##suffix result;                               \
+        arm_stats_result_##suffix expected;                             \
+                                                                        \
+        memset(&result, 0x5A, sizeof(result));                          \
+        memset(&expected, 0x5A, sizeof(expected));                      \
+                                                                        \
+        arm_stats_##suffix(NULL, 0U, ARM_STATS_ALL, &result);           \
+                                                                        \
+        if (memcmp(&result, &expected, sizeof(result)) != 0)            \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_STATS_EMPTY_TEST(f32);
+JTEST_ARM_STATS_EMPTY_TEST(q31);
+JTEST_ARM_STATS_EMPTY_TEST(q15);
+JTEST_ARM_STATS_EMPTY_TEST(q7);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(stats_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_stats_f32_test);
+    JTEST_TEST_CALL(arm_stats_q31_test);
+    JTEST_TEST_CALL(arm_stats_q15_test);
+    JTEST_TEST_CALL(arm_stats_q7_test);
+    JTEST_TEST_CALL(arm_stats_f32_empty_test);
+    JTEST_TEST_CALL(arm_stats_q31_empty_test);
+    JTEST_TEST_CALL(arm_stats_q15_empty_test);
+    JTEST_TEST_CALL(arm_stats_q7_empty_test);
+}
@@ -0,0 +1,91 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Largest number of elements returned.  The values are written to the output
+  buffers and the indices to statistics_output_f32_fut/ref.
+*/
+#define TOPK_MAX_K 5
+
+#define TOPK_INDEX_FUT ((uint32_t *) statistics_output_f32_fut)
+#define TOPK_INDEX_REF ((uint32_t *) statistics_output_f32_ref)
+
+/*
+  Top-k test function.  The qsort() based reference sorts the indices of the
+  whole block; its cycle count is displayed for comparison.
+*/
+#define JTEST_ARM_TOPK_TEST(suffix)                                     \
+    JTEST_DEFINE_TEST(arm_topk_##suffix##_test,                         \
+                      arm_topk_##suffix)                                \
+    {                                                                   \
+        uint32_t k;                                                     \
+                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            input_idx, ARR_DESC_t *, input_ptr, statistics_f_all        \
+            ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                block_size_idx, uint32_t, block_size,                   \
+                statistics_block_sizes                                  \
+                ,                                                       \
+                TYPE_FROM_ABBREV(suffix) * input_data_ptr =             \
+                    (TYPE_FROM_ABBREV(suffix) *) input_ptr->data_ptr;   \
+                                                                        \
+                TEST_DO_VALID_BLOCKSIZE(                                \
+                    block_size, TYPE_FROM_ABBREV(suffix), input_ptr     \
+                    ,                                                   \
+                    for (k = 1; (k <= TOPK_MAX_K) && (k <= block_size); \
+                         k += 4)                                        \
+                    {                                                   \
+                        TEST_CALL_FUT(                                  \
+                            arm_topk_##suffix,                          \
+                            PAREN(input_data_ptr, block_size, k,        \
+                                  statistics_output_fut.data_ptr,       \
+                                  TOPK_INDEX_FUT));                     \
+                                                                        \
+                        JTEST_DUMP_STR("qsort:\n");                     \
+                        JTEST_COUNT_CYCLES(                             \
+                            ref_topk_##suffix(                          \
+                                input_data_ptr, block_size, k,          \
+                                statistics_output_ref.data_ptr,         \
+                                TOPK_INDEX_REF));                       \
+                                                                        \
+                        TEST_ASSERT_BUFFERS_EQUAL(                      \
+                            statistics_output_ref.data_ptr,             \
+                            statistics_output_fut.data_ptr,             \
+                            k * sizeof(TYPE_FROM_ABBREV(suffix)));      \
+                        TEST_ASSERT_BUFFERS_EQUAL(                      \
+                            TOPK_INDEX_REF,                             \
+                            TOPK_INDEX_FUT,                             \
+                            k * sizeof(uint32_t));                      \
+                    })));                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_TOPK_TEST(f32);
+JTEST_ARM_TOPK_TEST(q15);
+JTEST_ARM_TOPK_TEST(q7);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(topk_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_topk_f32_test);
+    JTEST_TEST_CALL(arm_topk_q15_test);
+    JTEST_TEST_CALL(arm_topk_q7_test);
+}
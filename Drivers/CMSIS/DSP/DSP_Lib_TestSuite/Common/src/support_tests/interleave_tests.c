@@ -0,0 +1,173 @@
+#include "jtest.h"
+#include "support_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "support_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Parameters */
+/*--------------------------------------------------------------------------------*/
+
+#define INTERLEAVE_MAX_CHANNELS  8
+#define INTERLEAVE_MAX_SAMPLES   (INTERLEAVE_MAX_CHANNELS * 32)
+
+static float32_t interleave_input[INTERLEAVE_MAX_SAMPLES];
+static float32_t interleave_output_fut[INTERLEAVE_MAX_SAMPLES];
+static float32_t interleave_output_ref[INTERLEAVE_MAX_SAMPLES];
+static float32_t interleave_round_trip[INTERLEAVE_MAX_SAMPLES];
+
+/*
+  Fill the input with distinct values, so that any sample moved to the wrong
+  place is detected.  37 is odd, the Q7 values are distinct over 256 samples.
+*/
+#define INTERLEAVE_MAKE_INPUT(suffix)                                   \
+    static void interleave_make_input_##suffix(void)                    \
+    {                                                                   \
+        TYPE_FROM_ABBREV(suffix) * pIn =                                \
+            (TYPE_FROM_ABBREV(suffix) *) interleave_input;              \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0; i < INTERLEAVE_MAX_SAMPLES; i++)                    \
+        {                                                               \
+            pIn[i] = (TYPE_FROM_ABBREV(suffix)) (i * 37U + 11U);        \
+        }                                                               \
+    }
+
+INTERLEAVE_MAKE_INPUT(f32)
+INTERLEAVE_MAKE_INPUT(q31)
+INTERLEAVE_MAKE_INPUT(q15)
+INTERLEAVE_MAKE_INPUT(q7)
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Compare against the reference for 1 to 8 channels, then convert the output
+  back with the inverse function: the round trip must give the input again.
+*/
+#define JTEST_ARM_INTERLEAVE_TEST(fn_name, inverse, suffix)             \
+    JTEST_DEFINE_TEST(arm_##fn_name##_##suffix##_test,                  \
+                      arm_##fn_name##_##suffix)                         \
+    {                                                                   \
+        uint32_t numChannels;                                           \
+        uint32_t size;                                                  \
+                                                                        \
+        interleave_make_input_##suffix();                               \
+                                                                        \
+        for (numChannels = 1;                                           \
+             numChannels <= INTERLEAVE_MAX_CHANNELS;                    \
+             numChannels++)                                             \
+        {                                                               \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                block_size_idx, uint32_t, block_size,                   \
+                support_block_sizes                                     \
+                ,                                                       \
+                size = numChannels * block_size *                       \
+                    sizeof(TYPE_FROM_ABBREV(suffix));                   \
+                                                                        \
+                JTEST_DUMP_STRF("Channels: %d\n", (int) numChannels);   \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_##fn_name##_##suffix(                           \
+                        (TYPE_FROM_ABBREV(suffix) *) interleave_input,  \
+                        numChannels,                                    \
+                        (TYPE_FROM_ABBREV(suffix) *) interleave_output_fut, \
+                        block_size));                                   \
+                ref_##fn_name##_##suffix(                               \
+                    (TYPE_FROM_ABBREV(suffix) *) interleave_input,      \
+                    numChannels,                                        \
+                    (TYPE_FROM_ABBREV(suffix) *) interleave_output_ref, \
+                    block_size);                                        \
+                                                                        \
+                TEST_ASSERT_BUFFERS_EQUAL(                              \
+                    interleave_output_ref, interleave_output_fut, size); \
+                                                                        \
+                arm_##inverse##_##suffix(                               \
+                    (TYPE_FROM_ABBREV(suffix) *) interleave_output_fut, \
+                    numChannels,                                        \
+                    (TYPE_FROM_ABBREV(suffix) *) interleave_round_trip, \
+                    block_size);                                        \
+                                                                        \
+                TEST_ASSERT_BUFFERS_EQUAL(                              \
+                    interleave_input, interleave_round_trip, size));    \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_INTERLEAVE_TEST(deinterleave, interleave, f32);
+JTEST_ARM_INTERLEAVE_TEST(deinterleave, interleave, q31);
+JTEST_ARM_INTERLEAVE_TEST(deinterleave, interleave, q15);
+JTEST_ARM_INTERLEAVE_TEST(deinterleave, interleave, q7);
+JTEST_ARM_INTERLEAVE_TEST(interleave, deinterleave, f32);
+JTEST_ARM_INTERLEAVE_TEST(interleave, deinterleave, q31);
+JTEST_ARM_INTERLEAVE_TEST(interleave, deinterleave, q15);
+JTEST_ARM_INTERLEAVE_TEST(interleave, deinterleave, q7);
+
+/*
+  Dual ADC words, 12-bit right aligned and 16-bit left aligned.  The samples
+  include zero, mid-scale and full scale.
+*/
+JTEST_DEFINE_TEST(arm_adc_dual_to_q15_test,
+                  arm_adc_dual_to_q15)
+{
+    uint32_t * pWords = (uint32_t *) interleave_input;
+    q15_t * pFut = (q15_t *) interleave_output_fut;
+    q15_t * pRef = (q15_t *) interleave_output_ref;
+    uint32_t resolution;
+    uint32_t mask;
+    uint32_t i;
+
+    for (resolution = 12; resolution <= 16; resolution += 4)
+    {
+        mask = (1U << resolution) - 1U;
+
+        for (i = 0; i < 32; i++)
+        {
+            pWords[i] = (((i * 40503U + 7U) & mask) << 16) |
+                ((i * 2654435761U >> 8) & mask);
+        }
+        pWords[0] = 0;
+        pWords[1] = (mask << 16) | (mask >> 1);
+        pWords[2] = ((mask >> 1) << 16) | mask;
+
+        TEMPLATE_DO_ARR_DESC(
+            block_size_idx, uint32_t, block_size,
+            support_block_sizes
+            ,
+            JTEST_DUMP_STRF("Resolution: %d\n", (int) resolution);
+            JTEST_COUNT_CYCLES(
+                arm_adc_dual_to_q15(pWords, resolution,
+                                    pFut, pFut + block_size, block_size));
+            ref_adc_dual_to_q15(pWords, resolution,
+                                pRef, pRef + block_size, block_size);
+
+            TEST_ASSERT_BUFFERS_EQUAL(
+                pRef, pFut, 2 * block_size * sizeof(q15_t)));
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(interleave_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_deinterleave_f32_test);
+    JTEST_TEST_CALL(arm_deinterleave_q31_test);
+    JTEST_TEST_CALL(arm_deinterleave_q15_test);
+    JTEST_TEST_CALL(arm_deinterleave_q7_test);
+    JTEST_TEST_CALL(arm_interleave_f32_test);
+    JTEST_TEST_CALL(arm_interleave_q31_test);
+    JTEST_TEST_CALL(arm_interleave_q15_test);
+    JTEST_TEST_CALL(arm_interleave_q7_test);
+    JTEST_TEST_CALL(arm_adc_dual_to_q15_test);
+}
@@ -0,0 +1,240 @@
+#include "jtest.h"
+#include "support_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "support_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Parameters */
+/*--------------------------------------------------------------------------------*/
+
+#define QUANT_SCALE      0.5f
+#define QUANT_SEED       0x12345678U
+
+/*
+  Low level sine used to measure the quantization error: an amplitude of 20 LSB
+  and a period that is not a multiple of the sampling period.
+*/
+#define QUANT_LEN        1024
+#define QUANT_AMPLITUDE  (20.0f / 32768.0f)
+#define QUANT_FREQ       0.0123f
+
+static float32_t quant_input[QUANT_LEN];
+static float32_t quant_scaled[QUANT_LEN];
+static q15_t quant_output_q15[QUANT_LEN];
+static q31_t quant_output_q31[QUANT_LEN];
+
+static void quant_make_input(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < QUANT_LEN; i++)
+    {
+        quant_input[i] = QUANT_AMPLITUDE *
+            (float32_t) sin(2.0 * 3.14159265358979 * QUANT_FREQ * i);
+    }
+}
+
+/*
+  Power of the quantization error in LSB^2, over the whole band and in the low
+  band, through two cascaded 16-sample moving averages.  The error is measured
+  against the input, so the scale must be 1.
+*/
+static void quant_error_power(
+    const q31_t * pLsb,
+    float32_t lsbScale,
+    float64_t * pPower,
+    float64_t * pLowPower)
+{
+    float64_t e[QUANT_LEN], m[QUANT_LEN];
+    float64_t acc, power = 0.0, lowPower = 0.0;
+    uint32_t i, k;
+
+    for (i = 0; i < QUANT_LEN; i++)
+    {
+        e[i] = (float64_t) pLsb[i] - (float64_t) quant_input[i] * lsbScale;
+        power += e[i] * e[i];
+    }
+
+    for (i = 15; i < QUANT_LEN; i++)
+    {
+        acc = 0.0;
+        for (k = 0; k < 16; k++)
+        {
+            acc += e[i - k];
+        }
+        m[i] = acc / 16.0;
+    }
+
+    for (i = 30; i < QUANT_LEN; i++)
+    {
+        acc = 0.0;
+        for (k = 0; k < 16; k++)
+        {
+            acc += m[i - k];
+        }
+        lowPower += (acc / 16.0) * (acc / 16.0);
+    }
+
+    *pPower = power / QUANT_LEN;
+    *pLowPower = lowPower / (QUANT_LEN - 30);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Compare against the reference on the support inputs, in each mode.  The
+  inputs include values outside of the output range.
+*/
+#define JTEST_ARM_QUANT_TEST(suffix, mode, mode_name)                   \
+    JTEST_DEFINE_TEST(arm_float_to_##suffix##_quant_##mode_name##_test, \
+                      arm_float_to_##suffix##_quant)                    \
+    {                                                                   \
+        arm_quant_instance_f32 fut;                                     \
+        arm_quant_instance_f32 ref;                                     \
+                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            input_idx, ARR_DESC_t *, input_ptr, support_f_all           \
+            ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                block_size_idx, uint32_t, block_size,                   \
+                support_block_sizes                                     \
+                ,                                                       \
+                TEST_DO_VALID_BLOCKSIZE(                                \
+                    block_size, float32_t, input_ptr                    \
+                    ,                                                   \
+                    arm_quant_init_f32(&fut, mode, QUANT_SCALE,         \
+                                       QUANT_SEED);                     \
+                    arm_quant_init_f32(&ref, mode, QUANT_SCALE,         \
+                                       QUANT_SEED);                     \
+                                                                        \
+                    JTEST_COUNT_CYCLES(                                 \
+                        arm_float_to_##suffix##_quant(                  \
+                            &fut, (float32_t *) input_ptr->data_ptr,    \
+                            support_output_fut.data_ptr, block_size));  \
+                    ref_float_to_##suffix##_quant(                      \
+                        &ref, (float32_t *) input_ptr->data_ptr,        \
+                        support_output_ref.data_ptr, block_size);       \
+                                                                        \
+                    SUPPORT_COMPARE_INTERFACE(                          \
+                        block_size, TYPE_FROM_ABBREV(suffix)))));       \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_QUANT_TEST(q15, ARM_QUANT_ROUND,  round);
+JTEST_ARM_QUANT_TEST(q15, ARM_QUANT_TPDF,   tpdf);
+JTEST_ARM_QUANT_TEST(q15, ARM_QUANT_SHAPED, shaped);
+JTEST_ARM_QUANT_TEST(q31, ARM_QUANT_ROUND,  round);
+JTEST_ARM_QUANT_TEST(q31, ARM_QUANT_TPDF,   tpdf);
+JTEST_ARM_QUANT_TEST(q31, ARM_QUANT_SHAPED, shaped);
+
+/*
+  Quantization error of a low level sine, in LSB^2:
+  - rounding: about 1/12, concentrated in harmonics of the sine.
+  - TPDF dither: about 1/4 (1/12 + 1/6), white and with a zero mean.
+  - noise shaping: more power in total, but much less than the TPDF dither
+    in the low band.
+*/
+#define JTEST_ARM_QUANT_NOISE_TEST(suffix, lsb, shift)                  \
+    JTEST_DEFINE_TEST(arm_float_to_##suffix##_quant_noise_test,         \
+                      arm_float_to_##suffix##_quant)                    \
+    {                                                                   \
+        arm_quant_instance_f32 S;                                       \
+        q31_t lsbOut[QUANT_LEN];                                        \
+        float64_t power[3], lowPower[3];                                \
+        uint32_t mode, i;                                               \
+                                                                        \
+        quant_make_input();                                             \
+                                                                        \
+        for (mode = 0; mode < 3; mode++)                                \
+        {                                                               \
+            arm_quant_init_f32(&S, (arm_quant_mode) mode, 1.0f,         \
+                               QUANT_SEED);                             \
+                                                                        \
+            /* Two blocks, to test the state kept between blocks */     \
+            arm_float_to_##suffix##_quant(                              \
+                &S, quant_input, quant_output_##suffix, QUANT_LEN / 2); \
+            arm_float_to_##suffix##_quant(                              \
+                &S, quant_input + QUANT_LEN / 2,                        \
+                quant_output_##suffix + QUANT_LEN / 2, QUANT_LEN / 2);  \
+                                                                        \
+            for (i = 0; i < QUANT_LEN; i++)                             \
+            {                                                           \
+                lsbOut[i] = (quant_output_##suffix[i] +                 \
+                             ((1 << shift) >> 1)) >> shift;             \
+            }                                                           \
+            quant_error_power(lsbOut, lsb, &power[mode],                \
+                              &lowPower[mode]);                         \
+                                                                        \
+            JTEST_DUMP_STRF("Mode %d: error power %f LSB^2, "           \
+                            "low band %f LSB^2\n",                      \
+                            (int) mode, power[mode], lowPower[mode]);   \
+        }                                                               \
+                                                                        \
+        if ((power[ARM_QUANT_ROUND] > 0.1) ||                           \
+            (power[ARM_QUANT_TPDF] < 0.2) ||                            \
+            (power[ARM_QUANT_TPDF] > 0.3) ||                            \
+            (lowPower[ARM_QUANT_SHAPED] > 0.1 * lowPower[ARM_QUANT_TPDF])) \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_QUANT_NOISE_TEST(q15, 32768.0f, 0);
+JTEST_ARM_QUANT_NOISE_TEST(q31, 8388608.0f, 8);
+
+/*
+  Throughput of the fused conversion, compared with arm_scale_f32() followed
+  by arm_float_to_q15().
+*/
+JTEST_DEFINE_TEST(arm_float_to_q15_quant_cycles_test,
+                  arm_float_to_q15_quant)
+{
+    arm_quant_instance_f32 S;
+    uint32_t mode;
+
+    quant_make_input();
+
+    for (mode = 0; mode < 3; mode++)
+    {
+        arm_quant_init_f32(&S, (arm_quant_mode) mode, QUANT_SCALE, QUANT_SEED);
+        JTEST_DUMP_STRF("Mode %d, Block Size: %d\n", (int) mode, QUANT_LEN);
+        JTEST_COUNT_CYCLES(
+            arm_float_to_q15_quant(&S, quant_input, quant_output_q15, QUANT_LEN));
+    }
+
+    JTEST_DUMP_STR("Separate functions:\n");
+    JTEST_COUNT_CYCLES(
+        arm_scale_f32(quant_input, QUANT_SCALE, quant_scaled, QUANT_LEN);
+        arm_float_to_q15(quant_scaled, quant_output_q15, QUANT_LEN));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(quant_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_float_to_q15_quant_round_test);
+    JTEST_TEST_CALL(arm_float_to_q15_quant_tpdf_test);
+    JTEST_TEST_CALL(arm_float_to_q15_quant_shaped_test);
+    JTEST_TEST_CALL(arm_float_to_q31_quant_round_test);
+    JTEST_TEST_CALL(arm_float_to_q31_quant_tpdf_test);
+    JTEST_TEST_CALL(arm_float_to_q31_quant_shaped_test);
+    JTEST_TEST_CALL(arm_float_to_q15_quant_noise_test);
+    JTEST_TEST_CALL(arm_float_to_q31_quant_noise_test);
+    JTEST_TEST_CALL(arm_float_to_q15_quant_cycles_test);
+}
@@ -6,5 +6,7 @@ JTEST_DEFINE_GROUP(support_tests)
     JTEST_GROUP_CALL(copy_tests);
     JTEST_GROUP_CALL(fill_tests);
     JTEST_GROUP_CALL(x_to_y_tests);
+    JTEST_GROUP_CALL(quant_tests);
+    JTEST_GROUP_CALL(interleave_tests);
     return;
 }
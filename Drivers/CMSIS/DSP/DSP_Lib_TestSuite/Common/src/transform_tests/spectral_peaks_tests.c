@@ -0,0 +1,222 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Input Data */
+/*--------------------------------------------------------------------------------*/
+
+/* Number of samples of the frame, before zero padding */
+#define SPECTRAL_PEAKS_FRAME_LEN 256U
+
+/* Tolerances on the frequency, in bins of the frame, and on the relative amplitude */
+#define SPECTRAL_PEAKS_FREQ_TOL 0.01f
+#define SPECTRAL_PEAKS_AMP_TOL  0.005f
+
+/* Two tones, in bins of the frame without zero padding */
+static const float32_t spectral_peaks_tone_freqs[2] = {40.3f, 83.71f};
+static const float32_t spectral_peaks_tone_amps[2] = {1.0f, 0.5f};
+
+typedef struct
+{
+    arm_window_type window;
+    uint16_t pad_factor;
+    arm_peak_interp method;
+} spectral_peaks_config;
+
+static const spectral_peaks_config spectral_peaks_configs[] =
+{
+    {ARM_WINDOW_RECTANGULAR,     1U, ARM_PEAK_INTERP_JACOBSEN},
+    {ARM_WINDOW_RECTANGULAR,     1U, ARM_PEAK_INTERP_QUINN},
+    {ARM_WINDOW_RECTANGULAR,     2U, ARM_PEAK_INTERP_PARABOLIC},
+    {ARM_WINDOW_RECTANGULAR,     2U, ARM_PEAK_INTERP_JACOBSEN},
+    {ARM_WINDOW_HANN,            1U, ARM_PEAK_INTERP_PARABOLIC},
+    {ARM_WINDOW_HANN,            1U, ARM_PEAK_INTERP_JACOBSEN},
+    {ARM_WINDOW_HANN,            1U, ARM_PEAK_INTERP_QUINN},
+    {ARM_WINDOW_HANN,            2U, ARM_PEAK_INTERP_PARABOLIC},
+    {ARM_WINDOW_HANN,            2U, ARM_PEAK_INTERP_JACOBSEN},
+    {ARM_WINDOW_BLACKMAN_HARRIS, 4U, ARM_PEAK_INTERP_JACOBSEN}
+};
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Fill transform_fft_input_fut with the windowed tones, zero padded to
+  SPECTRAL_PEAKS_FRAME_LEN * pad_factor samples.  Returns the sum of the
+  window coefficients.
+*/
+static float32_t spectral_peaks_make_frame(
+    arm_window_type window,
+    uint16_t pad_factor)
+{
+    float32_t sum = 0.0f;
+    float32_t w, x, ph;
+    uint32_t n, t;
+
+    for (n = 0; n < SPECTRAL_PEAKS_FRAME_LEN * pad_factor; n++)
+    {
+        transform_fft_input_fut[n] = 0.0f;
+    }
+
+    for (n = 0; n < SPECTRAL_PEAKS_FRAME_LEN; n++)
+    {
+        ph = 2.0f * PI * (float32_t) n / (float32_t) SPECTRAL_PEAKS_FRAME_LEN;
+
+        switch (window)
+        {
+        case ARM_WINDOW_HANN:
+            w = 0.5f - 0.5f * cosf(ph);
+            break;
+        case ARM_WINDOW_BLACKMAN_HARRIS:
+            w = 0.35875f - 0.48829f * cosf(ph) + 0.14128f * cosf(2.0f * ph)
+                - 0.01168f * cosf(3.0f * ph);
+            break;
+        default:
+            w = 1.0f;
+            break;
+        }
+
+        x = 0.0f;
+        for (t = 0; t < 2; t++)
+        {
+            x += spectral_peaks_tone_amps[t] *
+                cosf(spectral_peaks_tone_freqs[t] * ph + 0.3f + (float32_t) t);
+        }
+
+        transform_fft_input_fut[n] = w * x;
+        sum += w;
+    }
+
+    return sum;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Both tones must be found, the stronger first, with their frequency and
+  amplitude within the tolerances.  Only the stronger tone is checked with
+  the rectangular window.
+*/
+JTEST_DEFINE_TEST(arm_spectral_peaks_f32_test,
+                  arm_spectral_peaks_f32)
+{
+    arm_spectral_peaks_instance_f32 peaks_inst;
+    arm_rfft_fast_instance_f32 rfft_inst;
+    float32_t peak_freqs[4];
+    float32_t peak_amps[4];
+    float32_t win_sum;
+    float32_t expected;
+    uint32_t fftlen;
+    uint32_t num_peaks;
+    uint32_t cfg;
+    uint32_t t;
+
+    for (cfg = 0; cfg < sizeof(spectral_peaks_configs) / sizeof(spectral_peaks_configs[0]); cfg++)
+    {
+        const spectral_peaks_config * c = &spectral_peaks_configs[cfg];
+
+        fftlen = SPECTRAL_PEAKS_FRAME_LEN * c->pad_factor;
+
+        win_sum = spectral_peaks_make_frame(c->window, c->pad_factor);
+
+        /* The threshold rejects the sidelobes of the tapered windows */
+        arm_rfft_fast_init_f32(&rfft_inst, fftlen);
+        if (arm_spectral_peaks_init_f32(&peaks_inst, fftlen / 2, c->method,
+                                        c->window, c->pad_factor, 0.05f * win_sum)
+            != ARM_MATH_SUCCESS)
+        {
+            JTEST_DUMP_STRF("Init failed for configuration %d\n", (int)cfg);
+            return JTEST_TEST_FAILED;
+        }
+
+        arm_rfft_fast_f32(&rfft_inst, transform_fft_input_fut,
+                          transform_fft_output_fut, 0U);
+        arm_cmplx_mag_f32(transform_fft_output_fut,
+                          transform_fft_output_f32_fut, fftlen / 2);
+        transform_fft_output_f32_fut[0] = fabsf(transform_fft_output_fut[0]);
+
+        JTEST_DUMP_STRF("Window: %d\nZero padding: %d\nMethod: %d\n",
+                        (int)c->window, (int)c->pad_factor, (int)c->method);
+
+        JTEST_COUNT_CYCLES(
+            num_peaks = arm_spectral_peaks_f32(
+                &peaks_inst, transform_fft_output_fut,
+                transform_fft_output_f32_fut, 4,
+                peak_freqs, peak_amps));
+
+        /* The sidelobes of the rectangular window are local maxima too */
+        if ((num_peaks < 2) ||
+            ((c->window != ARM_WINDOW_RECTANGULAR) && (num_peaks != 2)))
+        {
+            JTEST_DUMP_STRF("Found %d peaks\n", (int)num_peaks);
+            return JTEST_TEST_FAILED;
+        }
+
+        /* The leakage of the rectangular window biases the weaker tone */
+        for (t = 0; t < ((c->window == ARM_WINDOW_RECTANGULAR) ? 1U : 2U); t++)
+        {
+            expected = spectral_peaks_tone_freqs[t] * (float32_t) c->pad_factor;
+            if (fabsf(peak_freqs[t] - expected) > SPECTRAL_PEAKS_FREQ_TOL * (float32_t) c->pad_factor)
+            {
+                JTEST_DUMP_STRF("Frequency %f, expected %f\n",
+                                (double)peak_freqs[t], (double)expected);
+                return JTEST_TEST_FAILED;
+            }
+
+            expected = spectral_peaks_tone_amps[t] * 0.5f * win_sum;
+            if (fabsf(peak_amps[t] - expected) > SPECTRAL_PEAKS_AMP_TOL * expected)
+            {
+                JTEST_DUMP_STRF("Amplitude %f, expected %f\n",
+                                (double)peak_amps[t], (double)expected);
+                return JTEST_TEST_FAILED;
+            }
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Combinations without corrections are rejected.
+*/
+JTEST_DEFINE_TEST(arm_spectral_peaks_init_f32_test,
+                  arm_spectral_peaks_init_f32)
+{
+    arm_spectral_peaks_instance_f32 peaks_inst;
+
+    if ((arm_spectral_peaks_init_f32(&peaks_inst, 128, ARM_PEAK_INTERP_JACOBSEN,
+                                     ARM_WINDOW_FLAT_TOP, 1, 0.0f)
+         != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_spectral_peaks_init_f32(&peaks_inst, 128, ARM_PEAK_INTERP_QUINN,
+                                     ARM_WINDOW_HANN, 2, 0.0f)
+         != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_spectral_peaks_init_f32(&peaks_inst, 128, ARM_PEAK_INTERP_JACOBSEN,
+                                     ARM_WINDOW_HANN, 3, 0.0f)
+         != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_spectral_peaks_init_f32(&peaks_inst, 2, ARM_PEAK_INTERP_JACOBSEN,
+                                     ARM_WINDOW_HANN, 1, 0.0f)
+         != ARM_MATH_ARGUMENT_ERROR))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(spectral_peaks_tests)
+{
+    JTEST_TEST_CALL(arm_spectral_peaks_f32_test);
+    JTEST_TEST_CALL(arm_spectral_peaks_init_f32_test);
+}
@@ -7,5 +7,8 @@ JTEST_DEFINE_GROUP(transform_tests)
     JTEST_GROUP_CALL(cfft_family_tests);
     JTEST_GROUP_CALL(rfft_tests);
     JTEST_GROUP_CALL(rfft_fast_tests);
+    JTEST_GROUP_CALL(spectral_peaks_tests);
+    JTEST_GROUP_CALL(window_tests);
+    JTEST_GROUP_CALL(welch_tests);
     JTEST_GROUP_CALL(dct4_tests);
 }
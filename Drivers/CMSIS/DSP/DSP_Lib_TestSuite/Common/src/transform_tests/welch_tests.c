@@ -0,0 +1,194 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Input Data */
+/*--------------------------------------------------------------------------------*/
+
+#define WELCH_MAX_FFT_LEN 512U
+#define WELCH_NUM_SAMPLES 2048U
+
+/* Length of the blocks added to the estimator, not a divider of the segment lengths */
+#define WELCH_BLOCK_SIZE 37U
+
+#define WELCH_SAMPLE_RATE 1000.0f
+
+#define WELCH_SNR_THRESHOLD 100
+#define WELCH_POWER_TOL 1.0e-4f
+
+typedef struct
+{
+    uint16_t fft_len;
+    uint16_t hop_size;
+    arm_welch_averaging averaging;
+    float32_t alpha;
+} welch_config;
+
+static const welch_config welch_configs[] =
+{
+    {256U, 128U, ARM_WELCH_LINEAR,      0.0f},
+    {256U, 256U, ARM_WELCH_LINEAR,      0.0f},
+    {128U,  32U, ARM_WELCH_EXPONENTIAL, 0.25f},
+    {512U, 384U, ARM_WELCH_EXPONENTIAL, 0.0625f}
+};
+
+static float32_t welch_coeffs[WELCH_MAX_FFT_LEN / 2U + 1U];
+static float32_t welch_window[WELCH_MAX_FFT_LEN];
+static float32_t welch_state[3U * WELCH_MAX_FFT_LEN];
+static q31_t welch_acc[WELCH_MAX_FFT_LEN / 2U + 1U];
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Initialize the periodic Hann window of the configuration and the estimator.
+*/
+static arm_status welch_init(
+    arm_welch_instance_f32 * welch_inst,
+    arm_window_instance_f32 * win_inst,
+    const welch_config * c)
+{
+    arm_window_generate_f32(ARM_WINDOW_HANN, 0.0f, c->fft_len, 1U, welch_coeffs);
+    arm_window_init_f32(win_inst, c->fft_len, 1U, welch_coeffs);
+    ref_window_f32(ARM_WINDOW_HANN, 0.0f, c->fft_len, 1U, welch_window);
+
+    return arm_welch_init_f32(welch_inst, win_inst, c->hop_size, c->averaging,
+                              c->alpha, WELCH_SAMPLE_RATE, welch_state, welch_acc);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Welch test template.  Arguments are: input type suffix (f32/q15), input
+  array and the conversion of the input to floating-point for the reference.
+  The input is added in blocks of WELCH_BLOCK_SIZE samples and the estimate
+  is compared to the reference estimate of the whole input.
+*/
+#define WELCH_DEFINE_TEST(suffix, input, scale)                             \
+    JTEST_DEFINE_TEST(arm_welch_process_##suffix##_test,                    \
+                      arm_welch_process_##suffix)                           \
+    {                                                                       \
+        arm_welch_instance_f32 welch_inst;                                  \
+        arm_window_instance_f32 win_inst;                                   \
+        uint32_t num_segments = 0;                                          \
+        uint32_t expected;                                                  \
+        uint32_t cfg;                                                       \
+        uint32_t n;                                                         \
+                                                                            \
+        for (n = 0; n < WELCH_NUM_SAMPLES; n++)                             \
+        {                                                                   \
+            transform_fft_input_ref[n] = (float32_t) input[n] * scale;      \
+        }                                                                   \
+                                                                            \
+        for (cfg = 0; cfg < sizeof(welch_configs) / sizeof(welch_configs[0]); cfg++) \
+        {                                                                   \
+            const welch_config * c = &welch_configs[cfg];                   \
+                                                                            \
+            JTEST_DUMP_STRF("FFT Length: %d\nHop Size: %d\nAveraging: %d\n", \
+                            (int)c->fft_len, (int)c->hop_size,              \
+                            (int)c->averaging);                             \
+                                                                            \
+            if (welch_init(&welch_inst, &win_inst, c) != ARM_MATH_SUCCESS)  \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            for (n = 0; n < WELCH_NUM_SAMPLES; n += WELCH_BLOCK_SIZE)       \
+            {                                                               \
+                JTEST_COUNT_CYCLES(                                         \
+                    num_segments = arm_welch_process_##suffix(              \
+                        &welch_inst, &input[n],                             \
+                        (WELCH_NUM_SAMPLES - n < WELCH_BLOCK_SIZE) ?        \
+                        WELCH_NUM_SAMPLES - n : WELCH_BLOCK_SIZE));         \
+            }                                                               \
+                                                                            \
+            expected = (WELCH_NUM_SAMPLES - c->fft_len) / c->hop_size + 1;  \
+            if ((num_segments != expected) ||                               \
+                (arm_welch_get_psd_f32(&welch_inst,                         \
+                                       transform_fft_output_f32_fut)        \
+                 != expected))                                              \
+            {                                                               \
+                JTEST_DUMP_STRF("Segments: %d, expected %d\n",              \
+                                (int)num_segments, (int)expected);          \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            ref_welch_psd_f32(transform_fft_input_ref, WELCH_NUM_SAMPLES,   \
+                              welch_window, c->fft_len, c->hop_size,        \
+                              c->alpha, WELCH_SAMPLE_RATE,                  \
+                              transform_fft_output_f32_ref);                \
+                                                                            \
+            TEST_ASSERT_SNR(transform_fft_output_f32_ref,                   \
+                            transform_fft_output_f32_fut,                   \
+                            c->fft_len / 2 + 1, WELCH_SNR_THRESHOLD);       \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+WELCH_DEFINE_TEST(f32, transform_fft_f32_inputs, 1.0f);
+WELCH_DEFINE_TEST(q15, dct4_transform_fft_q15_inputs, (1.0f / 32768.0f));
+
+/*
+  The power of a sine wave of amplitude 1 centered on a bin is 0.5.  A linear
+  estimate restarts after it is read.
+*/
+JTEST_DEFINE_TEST(arm_welch_get_psd_f32_test,
+                  arm_welch_get_psd_f32)
+{
+    arm_welch_instance_f32 welch_inst;
+    arm_window_instance_f32 win_inst;
+    float32_t power;
+    uint32_t n;
+
+    if (welch_init(&welch_inst, &win_inst, &welch_configs[0]) != ARM_MATH_SUCCESS)
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    for (n = 0; n < WELCH_NUM_SAMPLES; n++)
+    {
+        transform_fft_input_fut[n] = sinf(2.0f * PI * 20.0f * (float32_t) n / 256.0f);
+    }
+
+    arm_welch_process_f32(&welch_inst, transform_fft_input_fut, WELCH_NUM_SAMPLES);
+
+    JTEST_COUNT_CYCLES(
+        arm_welch_get_psd_f32(&welch_inst, transform_fft_output_f32_fut));
+
+    arm_mean_f32(transform_fft_output_f32_fut, 129, &power);
+    power *= 129.0f * WELCH_SAMPLE_RATE / 256.0f;
+
+    if (fabsf(power - 0.5f) > WELCH_POWER_TOL)
+    {
+        JTEST_DUMP_STRF("Power: %f, expected 0.5\n", (double)power);
+        return JTEST_TEST_FAILED;
+    }
+
+    if ((arm_welch_get_psd_f32(&welch_inst, transform_fft_output_f32_fut) != 0) ||
+        (transform_fft_output_f32_fut[20] != 0.0f))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(welch_tests)
+{
+    JTEST_TEST_CALL(arm_welch_process_f32_test);
+    JTEST_TEST_CALL(arm_welch_process_q15_test);
+    JTEST_TEST_CALL(arm_welch_get_psd_f32_test);
+}
@@ -0,0 +1,210 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Input Data */
+/*--------------------------------------------------------------------------------*/
+
+#define WINDOW_MAX_LEN 256U
+
+/* Shape parameter of the Kaiser window */
+#define WINDOW_KAISER_BETA 8.6f
+
+/* Comparison SNR thresholds and tolerance on the gains */
+#define WINDOW_SNR_THRESHOLD_f32 110
+#define WINDOW_SNR_THRESHOLD_q31 110
+#define WINDOW_SNR_THRESHOLD_q15 75
+#define WINDOW_GAIN_TOL_f32 1.0e-5f
+#define WINDOW_GAIN_TOL_q31 1.0e-5f
+#define WINDOW_GAIN_TOL_q15 1.0e-3f
+
+/* Largest value of each type */
+#define WINDOW_ONE_f32 1.0f
+#define WINDOW_ONE_q31 0x7FFFFFFF
+#define WINDOW_ONE_q15 0x7FFF
+
+static const uint16_t window_lengths[] = {8U, 63U, 256U};
+
+static float32_t window_coeffs_f32[WINDOW_MAX_LEN / 2U + 1U];
+static q31_t window_coeffs_q31[WINDOW_MAX_LEN / 2U + 1U];
+static q15_t window_coeffs_q15[WINDOW_MAX_LEN / 2U + 1U];
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Window test template. Arguments are: function suffix (f32/q31/q15) and
+  output type.  Each window is generated as a half table, expanded
+  by applying it to a frame of ones, and compared to the reference window.
+  The coherent gain and the equivalent noise bandwidth are compared to the
+  ones of the reference window.
+*/
+#define WINDOW_DEFINE_TEST(suffix, output_type)                             \
+    JTEST_DEFINE_TEST(arm_window_##suffix##_test,                           \
+                      arm_window_apply_##suffix)                            \
+    {                                                                       \
+        arm_window_instance_##suffix win_inst;                              \
+        TYPE_FROM_ABBREV(suffix) * win_fut =                                \
+            (TYPE_FROM_ABBREV(suffix) *) transform_fft_output_fut;          \
+        float32_t cg_ref;                                                   \
+        float32_t enbw_ref;                                                 \
+        uint32_t type;                                                      \
+        uint32_t periodic;                                                  \
+        uint32_t len_idx;                                                   \
+        uint32_t n;                                                         \
+        uint16_t length;                                                    \
+                                                                            \
+        for (type = ARM_WINDOW_RECTANGULAR; type <= ARM_WINDOW_KAISER; type++) \
+        {                                                                   \
+            for (periodic = 0; periodic < 2; periodic++)                    \
+            {                                                               \
+                for (len_idx = 0;                                           \
+                     len_idx < sizeof(window_lengths) / sizeof(window_lengths[0]); \
+                     len_idx++)                                             \
+                {                                                           \
+                    length = window_lengths[len_idx];                       \
+                                                                            \
+                    JTEST_DUMP_STRF("Window: %d\nPeriodic: %d\nLength: %d\n", \
+                                    (int)type, (int)periodic, (int)length); \
+                                                                            \
+                    arm_window_generate_##suffix(                           \
+                        (arm_window_type) type, WINDOW_KAISER_BETA,         \
+                        length, (uint8_t) periodic,                         \
+                        window_coeffs_##suffix);                            \
+                    arm_window_init_##suffix(                               \
+                        &win_inst, length, (uint8_t) periodic,              \
+                        window_coeffs_##suffix);                            \
+                                                                            \
+                    for (n = 0; n < length; n++)                            \
+                    {                                                       \
+                        win_fut[n] = WINDOW_ONE_##suffix;                   \
+                    }                                                       \
+                                                                            \
+                    JTEST_COUNT_CYCLES(                                     \
+                        arm_window_apply_##suffix(                          \
+                            &win_inst, win_fut, win_fut));                  \
+                                                                            \
+                    ref_window_f32(                                         \
+                        (arm_window_type) type, WINDOW_KAISER_BETA,         \
+                        length, (uint8_t) periodic,                         \
+                        transform_fft_output_f32_ref);                      \
+                    ref_window_info_f32(                                    \
+                        transform_fft_output_f32_ref, length,               \
+                        &cg_ref, &enbw_ref);                                \
+                                                                            \
+                    TEST_CONVERT_TO_FLOAT(                                  \
+                        win_fut, transform_fft_output_f32_fut,              \
+                        length, output_type);                               \
+                    TEST_ASSERT_SNR(                                        \
+                        transform_fft_output_f32_ref,                       \
+                        transform_fft_output_f32_fut,                       \
+                        length, WINDOW_SNR_THRESHOLD_##suffix);             \
+                                                                            \
+                    if ((fabsf(win_inst.coherentGain - cg_ref) >            \
+                         WINDOW_GAIN_TOL_##suffix * cg_ref) ||              \
+                        (fabsf(win_inst.enbw - enbw_ref) >                  \
+                         WINDOW_GAIN_TOL_##suffix * enbw_ref))              \
+                    {                                                       \
+                        JTEST_DUMP_STRF("Gain: %f, expected %f\n"           \
+                                        "ENBW: %f, expected %f\n",          \
+                                        (double)win_inst.coherentGain,      \
+                                        (double)cg_ref,                     \
+                                        (double)win_inst.enbw,              \
+                                        (double)enbw_ref);                  \
+                        return JTEST_TEST_FAILED;                           \
+                    }                                                       \
+                }                                                           \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+WINDOW_DEFINE_TEST(f32, float32_t);
+WINDOW_DEFINE_TEST(q31, q31_t);
+WINDOW_DEFINE_TEST(q15, q15_t);
+
+/*
+  The fused kernels are compared to the reference window applied to the
+  floating-point conversion of the frame.
+*/
+JTEST_DEFINE_TEST(arm_window_q15_to_f32_test,
+                  arm_window_q15_to_f32)
+{
+    arm_window_instance_f32 win_inst;
+    uint32_t n;
+
+    arm_window_generate_f32(ARM_WINDOW_HANN, 0.0f, WINDOW_MAX_LEN, 1U,
+                            window_coeffs_f32);
+    arm_window_init_f32(&win_inst, WINDOW_MAX_LEN, 1U, window_coeffs_f32);
+
+    JTEST_COUNT_CYCLES(
+        arm_window_q15_to_f32(&win_inst, dct4_transform_fft_q15_inputs,
+                              transform_fft_output_f32_fut));
+
+    ref_window_f32(ARM_WINDOW_HANN, 0.0f, WINDOW_MAX_LEN, 1U,
+                   transform_fft_output_f32_ref);
+    for (n = 0; n < WINDOW_MAX_LEN; n++)
+    {
+        transform_fft_output_f32_ref[n] *=
+            (float32_t) dct4_transform_fft_q15_inputs[n] / 32768.0f;
+    }
+
+    TEST_ASSERT_SNR(transform_fft_output_f32_ref,
+                    transform_fft_output_f32_fut,
+                    WINDOW_MAX_LEN, WINDOW_SNR_THRESHOLD_f32);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_window_q15_to_cmplx_q15_test,
+                  arm_window_q15_to_cmplx_q15)
+{
+    arm_window_instance_q15 win_inst;
+    q15_t * cmplx_fut = (q15_t *) transform_fft_output_fut;
+    uint32_t n;
+
+    arm_window_generate_q15(ARM_WINDOW_BLACKMAN_HARRIS, 0.0f, WINDOW_MAX_LEN,
+                            1U, window_coeffs_q15);
+    arm_window_init_q15(&win_inst, WINDOW_MAX_LEN, 1U, window_coeffs_q15);
+
+    JTEST_COUNT_CYCLES(
+        arm_window_q15_to_cmplx_q15(&win_inst, dct4_transform_fft_q15_inputs,
+                                    cmplx_fut));
+
+    ref_window_f32(ARM_WINDOW_BLACKMAN_HARRIS, 0.0f, WINDOW_MAX_LEN, 1U,
+                   transform_fft_output_f32_fut);
+    for (n = 0; n < WINDOW_MAX_LEN; n++)
+    {
+        transform_fft_output_f32_ref[2 * n] = transform_fft_output_f32_fut[n] *
+            (float32_t) dct4_transform_fft_q15_inputs[n] / 32768.0f;
+        transform_fft_output_f32_ref[2 * n + 1] = 0.0f;
+    }
+
+    TEST_CONVERT_TO_FLOAT(cmplx_fut, transform_fft_output_f32_fut,
+                          2 * WINDOW_MAX_LEN, q15_t);
+    TEST_ASSERT_SNR(transform_fft_output_f32_ref,
+                    transform_fft_output_f32_fut,
+                    2 * WINDOW_MAX_LEN, WINDOW_SNR_THRESHOLD_q15);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(window_tests)
+{
+    JTEST_TEST_CALL(arm_window_f32_test);
+    JTEST_TEST_CALL(arm_window_q31_test);
+    JTEST_TEST_CALL(arm_window_q15_test);
+    JTEST_TEST_CALL(arm_window_q15_to_f32_test);
+    JTEST_TEST_CALL(arm_window_q15_to_cmplx_q15_test);
+}
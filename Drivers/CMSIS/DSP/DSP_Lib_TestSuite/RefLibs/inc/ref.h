@@ -329,6 +329,209 @@ void ref_sub_q7(
   q7_t * pSrcA,
   q7_t * pSrcB,
   q7_t * pDst,
+  uint32_t blockSize);
+
+void ref_clamp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t low,
+  float32_t high,
+  uint32_t blockSize);
+
+void ref_clamp_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  q31_t low,
+  q31_t high,
+  uint32_t blockSize);
+
+void ref_clamp_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  q15_t low,
+  q15_t high,
+  uint32_t blockSize);
+
+void ref_clamp_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  q7_t low,
+  q7_t high,
+  uint32_t blockSize);
+
+void ref_compare_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize);
+
+void ref_compare_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize);
+
+void ref_compare_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize);
+
+void ref_compare_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize);
+
+void ref_threshold_f32(
+  float32_t * pSrc,
+  float32_t threshold,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize);
+
+void ref_threshold_q31(
+  q31_t * pSrc,
+  q31_t threshold,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize);
+
+void ref_threshold_q15(
+  q15_t * pSrc,
+  q15_t threshold,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize);
+
+void ref_threshold_q7(
+  q7_t * pSrc,
+  q7_t threshold,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize);
+
+void ref_blend_f32(
+  uint8_t * pMask,
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_blend_q31(
+  uint8_t * pMask,
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+void ref_blend_q15(
+  uint8_t * pMask,
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_blend_q7(
+  uint8_t * pMask,
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+void ref_scale_offset_f32(
+  float32_t * pSrc,
+  float32_t scale,
+  float32_t offset,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_scale_offset_q31(
+  q31_t * pSrc,
+  q31_t scaleFract,
+  int8_t shift,
+  q31_t offset,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+void ref_scale_offset_q15(
+  q15_t * pSrc,
+  q15_t scaleFract,
+  int8_t shift,
+  q15_t offset,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_scale_offset_q7(
+  q7_t * pSrc,
+  q7_t scaleFract,
+  int8_t shift,
+  q7_t offset,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+void ref_mult_add_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pSrcC,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_mult_add_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pSrcC,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+void ref_mult_add_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pSrcC,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_mult_add_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pSrcC,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+void ref_weighted_sum_f32(
+  float32_t * pSrcA,
+  float32_t weightA,
+  float32_t * pSrcB,
+  float32_t weightB,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_weighted_sum_q31(
+  q31_t * pSrcA,
+  q31_t weightA,
+  q31_t * pSrcB,
+  q31_t weightB,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+void ref_weighted_sum_q15(
+  q15_t * pSrcA,
+  q15_t weightA,
+  q15_t * pSrcB,
+  q15_t weightB,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_weighted_sum_q7(
+  q7_t * pSrcA,
+  q7_t weightA,
+  q7_t * pSrcB,
+  q7_t weightB,
+  q7_t * pDst,
   uint32_t blockSize);
 
 	/*
@@ -385,6 +588,32 @@ void ref_cmplx_mag_q15(
   q15_t * pDst,
   uint32_t numSamples);
 
+void ref_cmplx_to_polar_f32(
+  float32_t * pSrc,
+  float32_t * pMag,
+  float32_t * pPhase,
+  uint32_t numSamples);
+
+void ref_cmplx_to_polar_q31(
+  q31_t * pSrc,
+  q31_t * pMag,
+  q31_t * pPhase,
+  uint32_t numSamples);
+
+void ref_cmplx_to_polar_q15(
+  q15_t * pSrc,
+  q15_t * pMag,
+  q15_t * pPhase,
+  uint32_t numSamples);
+
+void ref_cmplx_inst_f32(
+  float32_t * pSrc,
+  float32_t * pAmp,
+  float32_t * pPhase,
+  float32_t * pFreq,
+  float32_t * pPrevPhase,
+  uint32_t numSamples);
+
 void ref_cmplx_mag_squared_f32(
   float32_t * pSrc,
   float32_t * pDst,
@@ -461,6 +690,64 @@ q15_t ref_pid_q15(
 	arm_pid_instance_q15 * S,
 	q15_t in);
 
+float32_t ref_pid_ext_f32(
+	arm_pid_ext_instance_f32 * S,
+	float32_t in);
+
+q31_t ref_pid_ext_q31(
+	arm_pid_ext_instance_q31 * S,
+	q31_t in);
+
+q15_t ref_pid_ext_q15(
+	arm_pid_ext_instance_q15 * S,
+	q15_t in);
+
+void ref_pid_ext_set_gains_f32(
+	arm_pid_ext_instance_f32 * S,
+	float32_t Kp,
+	float32_t Ki,
+	float32_t Kd);
+
+void ref_pid_ext_set_gains_q31(
+	arm_pid_ext_instance_q31 * S,
+	q31_t Kp,
+	q31_t Ki,
+	q31_t Kd);
+
+void ref_pid_ext_set_gains_q15(
+	arm_pid_ext_instance_q15 * S,
+	q15_t Kp,
+	q15_t Ki,
+	q15_t Kd);
+
+q31_t ref_comp_q31(
+	arm_comp_instance_q31 * S,
+	uint32_t order,
+	q31_t in);
+
+q15_t ref_comp_q15(
+	arm_comp_instance_q15 * S,
+	uint32_t order,
+	q15_t in);
+
+void ref_kalman_predict_f32(
+	uint16_t numStates,
+	float32_t * pState,
+	float32_t * pCov,
+	const float32_t * pF,
+	const float32_t * pQ,
+	const float32_t * pNext);
+
+arm_status ref_kalman_update_f32(
+	uint16_t numStates,
+	uint16_t numMeas,
+	float32_t * pState,
+	float32_t * pCov,
+	const float32_t * pH,
+	const float32_t * pR,
+	const float32_t * pZ,
+	const float32_t * pMeasPred);
+
 	/*
 	 * Fast Math Functions
 	 */
@@ -480,6 +767,59 @@ arm_status ref_sqrt_q31(q31_t in, q31_t * pOut);
 
 arm_status ref_sqrt_q15(q15_t in, q15_t * pOut);
 
+void ref_vsin_f32(float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+void ref_vsin_q31(q31_t * pSrc, q31_t * pDst, uint32_t blockSize);
+
+void ref_vsin_q15(q15_t * pSrc, q15_t * pDst, uint32_t blockSize);
+
+void ref_vcos_f32(float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+void ref_vcos_q31(q31_t * pSrc, q31_t * pDst, uint32_t blockSize);
+
+void ref_vcos_q15(q15_t * pSrc, q15_t * pDst, uint32_t blockSize);
+
+void ref_vsqrt_f32(float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+void ref_vsqrt_q31(q31_t * pSrc, q31_t * pDst, uint32_t blockSize);
+
+void ref_vsqrt_q15(q15_t * pSrc, q15_t * pDst, uint32_t blockSize);
+
+void ref_vexp_f32(float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+void ref_vexp_q31(q31_t * pSrc, q31_t * pDst, uint32_t blockSize);
+
+void ref_vexp_q15(q15_t * pSrc, q15_t * pDst, uint32_t blockSize);
+
+void ref_vlog_f32(float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+void ref_vlog_q31(q31_t * pSrc, q31_t * pDst, uint32_t blockSize);
+
+void ref_vlog_q15(q15_t * pSrc, q15_t * pDst, uint32_t blockSize);
+
+void ref_vatan2_f32(float32_t * pSrcY, float32_t * pSrcX, float32_t * pDst, uint32_t blockSize);
+
+void ref_vatan2_q31(q31_t * pSrcY, q31_t * pSrcX, q31_t * pDst, uint32_t blockSize);
+
+void ref_vatan2_q15(q15_t * pSrcY, q15_t * pSrcX, q15_t * pDst, uint32_t blockSize);
+
+arm_status ref_divide_q31(q31_t numerator, q31_t denominator, q31_t * quotient, int16_t * shift);
+
+arm_status ref_divide_q15(q15_t numerator, q15_t denominator, q15_t * quotient, int16_t * shift);
+
+void ref_vdivide_q31(q31_t * pSrcA, q31_t * pSrcB, q31_t * pDst, uint32_t blockSize);
+
+void ref_vdivide_q15(q15_t * pSrcA, q15_t * pSrcB, q15_t * pDst, uint32_t blockSize);
+
+void ref_pwl_f32(const float32_t * pXData, const float32_t * pYData, uint32_t nValues,
+                 float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+void ref_spline_f32(arm_spline_type type, const float32_t * pXData, const float32_t * pYData,
+                    uint32_t nValues, float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+void ref_resize_f32(arm_resize_mode mode, const float32_t * pSrc, uint16_t srcWidth,
+                    uint16_t srcHeight, float32_t * pDst, uint16_t dstWidth, uint16_t dstHeight);
+
 	/*
 	 * Filtering Functions
 	 */
@@ -767,6 +1107,18 @@ void ref_fir_q7(
   q7_t * pDst,
   uint32_t blockSize);
 
+void ref_hilbert_f32(
+  const float32_t * pCoeffs,
+  uint16_t numTaps,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_analytic_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t fftLen);
+
 void ref_fir_decimate_f32(
   const arm_fir_decimate_instance_f32 * S,
   float32_t * pSrc,
@@ -955,6 +1307,29 @@ arm_status ref_mat_inverse_f64(
   const arm_matrix_instance_f64 * pSrc,
   arm_matrix_instance_f64 * pDst);
 
+arm_status ref_polyfit_f32(
+  const float32_t * pX,
+  const float32_t * pY,
+  const float32_t * pW,
+  uint32_t numSamples,
+  uint16_t order,
+  float32_t * pCoeffs);
+
+void ref_poly_eval_f32(
+  const float32_t * pCoeffs,
+  uint16_t order,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_poly_eval_q31(
+  const q31_t * pCoeffs,
+  uint16_t order,
+  uint8_t postShift,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
 arm_status ref_mat_mult_f32(
   const arm_matrix_instance_f32 * pSrcA,
   const arm_matrix_instance_f32 * pSrcB,
@@ -1175,6 +1550,112 @@ void ref_var_q15(
   uint32_t blockSize,
   q15_t * pResult);
 
+void ref_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t statsFlags,
+  arm_stats_result_f32 * pResult);
+
+void ref_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t statsFlags,
+  arm_stats_result_q31 * pResult);
+
+void ref_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t statsFlags,
+  arm_stats_result_q15 * pResult);
+
+void ref_stats_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  uint32_t statsFlags,
+  arm_stats_result_q7 * pResult);
+
+void ref_histogram_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t minVal,
+  float32_t maxVal,
+  uint32_t numBins,
+  uint32_t * pHist);
+
+void ref_histogram_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t minVal,
+  q15_t maxVal,
+  uint16_t numBins,
+  uint32_t * pHist);
+
+void ref_select_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pResult);
+
+void ref_select_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q31_t * pResult);
+
+void ref_select_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q15_t * pResult);
+
+void ref_percentile_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t percentile,
+  float32_t * pResult);
+
+void ref_percentile_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t percentile,
+  q31_t * pResult);
+
+void ref_percentile_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t percentile,
+  q15_t * pResult);
+
+void ref_topk_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pDst,
+  uint32_t * pIndex);
+
+void ref_topk_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q15_t * pDst,
+  uint32_t * pIndex);
+
+void ref_topk_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q7_t * pDst,
+  uint32_t * pIndex);
+
+void ref_envelope_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_envelope_detector detector,
+  float32_t attack,
+  float32_t release,
+  uint32_t holdSamples,
+  float32_t * pDst);
+
 	/*
 	 * Support Functions
 	 */
@@ -1281,6 +1762,73 @@ void ref_float_to_q15(
 void ref_float_to_q7(
   float32_t * pSrc,
   q7_t * pDst,
+  uint32_t blockSize);
+
+void ref_float_to_q15_quant(
+  arm_quant_instance_f32 * S,
+  float32_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_float_to_q31_quant(
+  arm_quant_instance_f32 * S,
+  float32_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+void ref_deinterleave_f32(
+  float32_t * pSrc,
+  uint32_t numChannels,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_interleave_f32(
+  float32_t * pSrc,
+  uint32_t numChannels,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_deinterleave_q31(
+  q31_t * pSrc,
+  uint32_t numChannels,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+void ref_interleave_q31(
+  q31_t * pSrc,
+  uint32_t numChannels,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+void ref_deinterleave_q15(
+  q15_t * pSrc,
+  uint32_t numChannels,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_interleave_q15(
+  q15_t * pSrc,
+  uint32_t numChannels,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_deinterleave_q7(
+  q7_t * pSrc,
+  uint32_t numChannels,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+void ref_interleave_q7(
+  q7_t * pSrc,
+  uint32_t numChannels,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+void ref_adc_dual_to_q15(
+  uint32_t * pSrc,
+  uint32_t resolution,
+  q15_t * pDstA,
+  q15_t * pDstB,
   uint32_t blockSize);
 
 	/*
@@ -1338,6 +1886,29 @@ void ref_rfft_fast_f32(
 	float32_t * p, float32_t * pOut,
 	uint8_t ifftFlag);
 
+void ref_window_f32(
+  arm_window_type type,
+  float32_t beta,
+  uint16_t length,
+  uint8_t periodic,
+  float32_t * pDst);
+
+void ref_window_info_f32(
+  float32_t * pWindow,
+  uint16_t length,
+  float32_t * pCoherentGain,
+  float32_t * pEnbw);
+
+void ref_welch_psd_f32(
+  float32_t * pSrc,
+  uint32_t numSamples,
+  float32_t * pWindow,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  float32_t alpha,
+  float32_t sampleRate,
+  float32_t * pDst);
+
 void ref_rfft_q31(
   const arm_rfft_instance_q31 * S,
   q31_t * pSrc,
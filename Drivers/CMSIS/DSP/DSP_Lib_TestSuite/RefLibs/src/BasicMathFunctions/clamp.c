@@ -0,0 +1,81 @@
+#include "ref.h"
+
+void ref_clamp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t low,
+  float32_t high,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		if (pSrc[i] > high)
+			pDst[i] = high;
+		else if (pSrc[i] < low)
+			pDst[i] = low;
+		else
+			pDst[i] = pSrc[i];
+	}
+}
+
+void ref_clamp_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  q31_t low,
+  q31_t high,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		if (pSrc[i] > high)
+			pDst[i] = high;
+		else if (pSrc[i] < low)
+			pDst[i] = low;
+		else
+			pDst[i] = pSrc[i];
+	}
+}
+
+void ref_clamp_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  q15_t low,
+  q15_t high,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		if (pSrc[i] > high)
+			pDst[i] = high;
+		else if (pSrc[i] < low)
+			pDst[i] = low;
+		else
+			pDst[i] = pSrc[i];
+	}
+}
+
+void ref_clamp_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  q7_t low,
+  q7_t high,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		if (pSrc[i] > high)
+			pDst[i] = high;
+		else if (pSrc[i] < low)
+			pDst[i] = low;
+		else
+			pDst[i] = pSrc[i];
+	}
+}
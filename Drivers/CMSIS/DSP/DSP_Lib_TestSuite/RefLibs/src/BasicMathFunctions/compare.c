@@ -0,0 +1,198 @@
+#include "ref.h"
+
+static uint8_t ref_compare(
+  int32_t lt,
+  int32_t eq,
+  arm_compare_op op)
+{
+	switch (op)
+	{
+	case ARM_CMP_LT: return lt ? 0xFF : 0;
+	case ARM_CMP_EQ: return eq ? 0xFF : 0;
+	case ARM_CMP_LE: return (lt || eq) ? 0xFF : 0;
+	case ARM_CMP_GT: return (!lt && !eq) ? 0xFF : 0;
+	case ARM_CMP_NE: return !eq ? 0xFF : 0;
+	case ARM_CMP_GE: return !lt ? 0xFF : 0;
+	}
+	return 0;
+}
+
+void ref_compare_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pDst[i] = ref_compare(pSrcA[i] < pSrcB[i], pSrcA[i] == pSrcB[i], op);
+	}
+}
+
+void ref_compare_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pDst[i] = ref_compare(pSrcA[i] < pSrcB[i], pSrcA[i] == pSrcB[i], op);
+	}
+}
+
+void ref_compare_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pDst[i] = ref_compare(pSrcA[i] < pSrcB[i], pSrcA[i] == pSrcB[i], op);
+	}
+}
+
+void ref_compare_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pDst[i] = ref_compare(pSrcA[i] < pSrcB[i], pSrcA[i] == pSrcB[i], op);
+	}
+}
+
+void ref_threshold_f32(
+  float32_t * pSrc,
+  float32_t threshold,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pDst[i] = ref_compare(pSrc[i] < threshold, pSrc[i] == threshold, op);
+	}
+}
+
+void ref_threshold_q31(
+  q31_t * pSrc,
+  q31_t threshold,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pDst[i] = ref_compare(pSrc[i] < threshold, pSrc[i] == threshold, op);
+	}
+}
+
+void ref_threshold_q15(
+  q15_t * pSrc,
+  q15_t threshold,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pDst[i] = ref_compare(pSrc[i] < threshold, pSrc[i] == threshold, op);
+	}
+}
+
+void ref_threshold_q7(
+  q7_t * pSrc,
+  q7_t threshold,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pDst[i] = ref_compare(pSrc[i] < threshold, pSrc[i] == threshold, op);
+	}
+}
+
+void ref_blend_f32(
+  uint8_t * pMask,
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pDst[i] = pMask[i] ? pSrcA[i] : pSrcB[i];
+	}
+}
+
+void ref_blend_q31(
+  uint8_t * pMask,
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pDst[i] = pMask[i] ? pSrcA[i] : pSrcB[i];
+	}
+}
+
+void ref_blend_q15(
+  uint8_t * pMask,
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pDst[i] = pMask[i] ? pSrcA[i] : pSrcB[i];
+	}
+}
+
+void ref_blend_q7(
+  uint8_t * pMask,
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pDst[i] = pMask[i] ? pSrcA[i] : pSrcB[i];
+	}
+}
@@ -0,0 +1,162 @@
+#include "ref.h"
+
+void ref_scale_offset_f32(
+  float32_t * pSrc,
+  float32_t scale,
+  float32_t offset,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	ref_scale_f32(pSrc, scale, pDst, blockSize);
+	ref_offset_f32(pDst, offset, pDst, blockSize);
+}
+
+void ref_scale_offset_q31(
+  q31_t * pSrc,
+  q31_t scaleFract,
+  int8_t shift,
+  q31_t offset,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+	ref_scale_q31(pSrc, scaleFract, shift, pDst, blockSize);
+	ref_offset_q31(pDst, offset, pDst, blockSize);
+}
+
+void ref_scale_offset_q15(
+  q15_t * pSrc,
+  q15_t scaleFract,
+  int8_t shift,
+  q15_t offset,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+	ref_scale_q15(pSrc, scaleFract, shift, pDst, blockSize);
+	ref_offset_q15(pDst, offset, pDst, blockSize);
+}
+
+void ref_scale_offset_q7(
+  q7_t * pSrc,
+  q7_t scaleFract,
+  int8_t shift,
+  q7_t offset,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+	ref_scale_q7(pSrc, scaleFract, shift, pDst, blockSize);
+	ref_offset_q7(pDst, offset, pDst, blockSize);
+}
+
+void ref_mult_add_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pSrcC,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	ref_mult_f32(pSrcA, pSrcB, pDst, blockSize);
+	ref_add_f32(pDst, pSrcC, pDst, blockSize);
+}
+
+void ref_mult_add_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pSrcC,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+	ref_mult_q31(pSrcA, pSrcB, pDst, blockSize);
+	ref_add_q31(pDst, pSrcC, pDst, blockSize);
+}
+
+void ref_mult_add_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pSrcC,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+	ref_mult_q15(pSrcA, pSrcB, pDst, blockSize);
+	ref_add_q15(pDst, pSrcC, pDst, blockSize);
+}
+
+void ref_mult_add_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pSrcC,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+	ref_mult_q7(pSrcA, pSrcB, pDst, blockSize);
+	ref_add_q7(pDst, pSrcC, pDst, blockSize);
+}
+
+void ref_weighted_sum_f32(
+  float32_t * pSrcA,
+  float32_t weightA,
+  float32_t * pSrcB,
+  float32_t weightB,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pDst[i] = pSrcA[i] * weightA + pSrcB[i] * weightB;
+	}
+}
+
+void ref_weighted_sum_q31(
+  q31_t * pSrcA,
+  q31_t weightA,
+  q31_t * pSrcB,
+  q31_t weightB,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	q63_t sum;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		sum = (((q63_t)pSrcA[i] * weightA) >> 1) + (((q63_t)pSrcB[i] * weightB) >> 1);
+		pDst[i] = ref_sat_q31(sum >> 30);
+	}
+}
+
+void ref_weighted_sum_q15(
+  q15_t * pSrcA,
+  q15_t weightA,
+  q15_t * pSrcB,
+  q15_t weightB,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	q63_t sum;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		sum = (q63_t)pSrcA[i] * weightA + (q63_t)pSrcB[i] * weightB;
+		pDst[i] = ref_sat_q15((q31_t)(sum >> 15));
+	}
+}
+
+void ref_weighted_sum_q7(
+  q7_t * pSrcA,
+  q7_t weightA,
+  q7_t * pSrcB,
+  q7_t weightB,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	q31_t sum;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		sum = ((q31_t)pSrcA[i] * weightA + (q31_t)pSrcB[i] * weightB) >> 7;
+		pDst[i] = (sum > 127) ? 127 : ((sum < -128) ? -128 : (q7_t)sum);
+	}
+}
@@ -0,0 +1,23 @@
+#include "ref.h"
+
+void ref_cmplx_inst_f32(
+  float32_t * pSrc,
+  float32_t * pAmp,
+  float32_t * pPhase,
+  float32_t * pFreq,
+  float32_t * pPrevPhase,
+  uint32_t numSamples)
+{
+	uint32_t i;
+	float64_t d;
+
+	ref_cmplx_to_polar_f32(pSrc, pAmp, pPhase, numSamples);
+
+	for(i=0;i<numSamples;i++)
+	{
+		d = (float64_t)pPhase[i] - *pPrevPhase;
+		d = d - 2.0 * 3.14159265358979 * floor(d / (2.0 * 3.14159265358979) + 0.5);
+		pFreq[i] = (float32_t)(d / (2.0 * 3.14159265358979));
+		*pPrevPhase = pPhase[i];
+	}
+}
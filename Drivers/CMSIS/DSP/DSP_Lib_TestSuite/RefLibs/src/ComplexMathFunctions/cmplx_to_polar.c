@@ -0,0 +1,49 @@
+#include "ref.h"
+
+void ref_cmplx_to_polar_f32(
+  float32_t * pSrc,
+  float32_t * pMag,
+  float32_t * pPhase,
+  uint32_t numSamples)
+{
+	uint32_t i;
+
+	ref_cmplx_mag_f32(pSrc, pMag, numSamples);
+
+	for(i=0;i<numSamples;i++)
+	{
+		pPhase[i] = atan2f(pSrc[2*i+1], pSrc[2*i]);
+	}
+}
+
+void ref_cmplx_to_polar_q31(
+  q31_t * pSrc,
+  q31_t * pMag,
+  q31_t * pPhase,
+  uint32_t numSamples)
+{
+	uint32_t i;
+
+	ref_cmplx_mag_q31(pSrc, pMag, numSamples);
+
+	for(i=0;i<numSamples;i++)
+	{
+		pPhase[i] = ref_sat_q31((q63_t)(atan2((float64_t)pSrc[2*i+1], (float64_t)pSrc[2*i]) / 3.14159265358979 * 2147483648.0));
+	}
+}
+
+void ref_cmplx_to_polar_q15(
+  q15_t * pSrc,
+  q15_t * pMag,
+  q15_t * pPhase,
+  uint32_t numSamples)
+{
+	uint32_t i;
+
+	ref_cmplx_mag_q15(pSrc, pMag, numSamples);
+
+	for(i=0;i<numSamples;i++)
+	{
+		pPhase[i] = ref_sat_q15((q31_t)(atan2f((float32_t)pSrc[2*i+1], (float32_t)pSrc[2*i]) / PI * 32768.0f));
+	}
+}
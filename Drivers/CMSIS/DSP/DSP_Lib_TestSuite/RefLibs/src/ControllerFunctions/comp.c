@@ -0,0 +1,73 @@
+#include "ref.h"
+
+q31_t ref_comp_q31(
+	arm_comp_instance_q31 * S,
+	uint32_t order,
+	q31_t in)
+{
+	q63_t acc;
+	q31_t out;
+	uint32_t i;
+
+	/* Direct form I: b[0..order] on the inputs, a[1..order] on the outputs */
+	acc = (q63_t) S->coeffs[0] * in;
+	for (i = 0; i < order; i++)
+	{
+		acc += (q63_t) S->coeffs[1 + i] * S->state[i];
+		acc += (q63_t) S->coeffs[4 + i] * S->state[3 + i];
+	}
+
+	acc = acc >> (31 - S->postShift);
+	if (acc > S->outMax)
+		out = S->outMax;
+	else if (acc < S->outMin)
+		out = S->outMin;
+	else
+		out = (q31_t) acc;
+
+	for (i = order - 1; i > 0; i--)
+	{
+		S->state[i] = S->state[i - 1];
+		S->state[3 + i] = S->state[2 + i];
+	}
+	S->state[0] = in;
+	S->state[3] = out;
+
+	return (out);
+}
+
+q15_t ref_comp_q15(
+	arm_comp_instance_q15 * S,
+	uint32_t order,
+	q15_t in)
+{
+	q63_t acc;
+	q15_t out;
+	uint32_t i;
+
+	/* Direct form I: b[0..order] on the inputs, a[1..order] on the outputs */
+	acc = (q31_t) S->coeffs[0] * in;
+	for (i = 0; i < order; i++)
+	{
+		acc += (q31_t) S->coeffs[1 + i] * S->state[i];
+		acc += (q31_t) S->coeffs[4 + i] * S->state[3 + i];
+	}
+
+	acc = acc >> (15 - S->postShift);
+	if (acc > S->outMax)
+		out = S->outMax;
+	else if (acc < S->outMin)
+		out = S->outMin;
+	else
+		out = (q15_t) acc;
+
+	for (i = order - 1; i > 0; i--)
+	{
+		S->state[i] = S->state[i - 1];
+		S->state[3 + i] = S->state[2 + i];
+	}
+	S->state[0] = in;
+	S->state[3] = out;
+
+	return (out);
+}
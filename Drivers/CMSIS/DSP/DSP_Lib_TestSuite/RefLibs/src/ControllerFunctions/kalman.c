@@ -0,0 +1,210 @@
+#include "ref.h"
+
+/*
+ * The Kalman filter reference computes in double precision with the textbook
+ * equations: explicit inverse of the innovation covariance by Gauss-Jordan
+ * elimination and covariance update P = (I - K H) P.
+ */
+
+#define REF_KALMAN_MAX 8
+
+void ref_kalman_predict_f32(
+	uint16_t numStates,
+	float32_t * pState,
+	float32_t * pCov,
+	const float32_t * pF,
+	const float32_t * pQ,
+	const float32_t * pNext)
+{
+	double A[REF_KALMAN_MAX][REF_KALMAN_MAX];
+	double sum;
+	uint32_t n = numStates;
+	uint32_t i, j, k;
+
+	/* A = F P */
+	for (i = 0; i < n; i++)
+	{
+		for (j = 0; j < n; j++)
+		{
+			sum = 0.0;
+			for (k = 0; k < n; k++)
+			{
+				sum += (double)pF[i * n + k] * pCov[k * n + j];
+			}
+			A[i][j] = sum;
+		}
+	}
+
+	/* P = A F' + Q */
+	for (i = 0; i < n; i++)
+	{
+		for (j = 0; j < n; j++)
+		{
+			sum = pQ[i * n + j];
+			for (k = 0; k < n; k++)
+			{
+				sum += A[i][k] * pF[j * n + k];
+			}
+			pCov[i * n + j] = (float32_t)sum;
+		}
+	}
+
+	for (i = 0; i < n; i++)
+	{
+		pState[i] = pNext[i];
+	}
+}
+
+arm_status ref_kalman_update_f32(
+	uint16_t numStates,
+	uint16_t numMeas,
+	float32_t * pState,
+	float32_t * pCov,
+	const float32_t * pH,
+	const float32_t * pR,
+	const float32_t * pZ,
+	const float32_t * pMeasPred)
+{
+	double PHt[REF_KALMAN_MAX][REF_KALMAN_MAX];
+	double S[REF_KALMAN_MAX][2 * REF_KALMAN_MAX];
+	double K[REF_KALMAN_MAX][REF_KALMAN_MAX];
+	double KH[REF_KALMAN_MAX][REF_KALMAN_MAX];
+	double P[REF_KALMAN_MAX][REF_KALMAN_MAX];
+	double y[REF_KALMAN_MAX];
+	double sum, piv, f;
+	uint32_t n = numStates;
+	uint32_t m = numMeas;
+	uint32_t i, j, k;
+
+	/* Innovation y = z - h(x) */
+	for (i = 0; i < m; i++)
+	{
+		if (pMeasPred != NULL)
+		{
+			y[i] = (double)pZ[i] - pMeasPred[i];
+		}
+		else
+		{
+			sum = 0.0;
+			for (k = 0; k < n; k++)
+			{
+				sum += (double)pH[i * n + k] * pState[k];
+			}
+			y[i] = pZ[i] - sum;
+		}
+	}
+
+	/* P H' */
+	for (i = 0; i < n; i++)
+	{
+		for (j = 0; j < m; j++)
+		{
+			sum = 0.0;
+			for (k = 0; k < n; k++)
+			{
+				sum += (double)pCov[i * n + k] * pH[j * n + k];
+			}
+			PHt[i][j] = sum;
+		}
+	}
+
+	/* [S I] with S = H P H' + R */
+	for (i = 0; i < m; i++)
+	{
+		for (j = 0; j < m; j++)
+		{
+			sum = pR[i * m + j];
+			for (k = 0; k < n; k++)
+			{
+				sum += pH[i * n + k] * PHt[k][j];
+			}
+			S[i][j] = sum;
+			S[i][m + j] = (i == j) ? 1.0 : 0.0;
+		}
+	}
+
+	/* Gauss-Jordan elimination to [I S^-1] */
+	for (i = 0; i < m; i++)
+	{
+		piv = S[i][i];
+		if (piv <= 0.0)
+		{
+			return ARM_MATH_SINGULAR;
+		}
+		for (j = 0; j < 2 * m; j++)
+		{
+			S[i][j] /= piv;
+		}
+		for (k = 0; k < m; k++)
+		{
+			if (k != i)
+			{
+				f = S[k][i];
+				for (j = 0; j < 2 * m; j++)
+				{
+					S[k][j] -= f * S[i][j];
+				}
+			}
+		}
+	}
+
+	/* K = P H' S^-1 */
+	for (i = 0; i < n; i++)
+	{
+		for (j = 0; j < m; j++)
+		{
+			sum = 0.0;
+			for (k = 0; k < m; k++)
+			{
+				sum += PHt[i][k] * S[k][m + j];
+			}
+			K[i][j] = sum;
+		}
+	}
+
+	/* x = x + K y */
+	for (i = 0; i < n; i++)
+	{
+		sum = pState[i];
+		for (k = 0; k < m; k++)
+		{
+			sum += K[i][k] * y[k];
+		}
+		pState[i] = (float32_t)sum;
+	}
+
+	/* P = (I - K H) P */
+	for (i = 0; i < n; i++)
+	{
+		for (j = 0; j < n; j++)
+		{
+			sum = (i == j) ? 1.0 : 0.0;
+			for (k = 0; k < m; k++)
+			{
+				sum -= K[i][k] * pH[k * n + j];
+			}
+			KH[i][j] = sum;
+		}
+	}
+	for (i = 0; i < n; i++)
+	{
+		for (j = 0; j < n; j++)
+		{
+			sum = 0.0;
+			for (k = 0; k < n; k++)
+			{
+				sum += KH[i][k] * pCov[k * n + j];
+			}
+			P[i][j] = sum;
+		}
+	}
+	for (i = 0; i < n; i++)
+	{
+		for (j = 0; j < n; j++)
+		{
+			pCov[i * n + j] = (float32_t)P[i][j];
+		}
+	}
+
+	return ARM_MATH_SUCCESS;
+}
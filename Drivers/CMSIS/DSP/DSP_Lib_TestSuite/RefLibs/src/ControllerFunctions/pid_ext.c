@@ -0,0 +1,171 @@
+#include "ref.h"
+
+float32_t ref_pid_ext_f32(
+	arm_pid_ext_instance_f32 * S,
+	float32_t in)
+{
+	float32_t inc, integ, out;
+
+	/* d[n] = d[n-1] + alpha * ((x[n] - x[n-1]) - d[n-1]) */
+	S->deriv = S->deriv + S->alpha * ((in - S->xPrev) - S->deriv);
+	S->xPrev = in;
+
+	/* i[n] = i[n-1] + Ki * x[n] */
+	inc = S->Ki * in;
+	integ = S->integ + inc;
+
+	/* y[n] = Kp * x[n] + i[n] + Kd * d[n] */
+	out = S->Kp * in + integ + S->Kd * S->deriv;
+
+	/* Clamp the output, no integration into the limit */
+	if (out > S->outMax)
+	{
+		out = S->outMax;
+		if (inc > 0.0f)
+			integ = S->integ;
+	}
+	else if (out < S->outMin)
+	{
+		out = S->outMin;
+		if (inc < 0.0f)
+			integ = S->integ;
+	}
+
+	S->integ = integ;
+
+	return (out);
+}
+
+q31_t ref_pid_ext_q31(
+	arm_pid_ext_instance_q31 * S,
+	q31_t in)
+{
+	q63_t acc;
+	q31_t diff, inc, integ, out;
+	int32_t shift = 31 - S->postShift;
+
+	/* d[n] = d[n-1] + alpha * ((x[n] - x[n-1]) - d[n-1]) */
+	diff = ref_sat_q31((q63_t) in - S->xPrev);
+	S->deriv = S->deriv + (q31_t) (((q63_t) S->alpha * ((q63_t) diff - S->deriv)) >> 31);
+	S->xPrev = in;
+
+	/* i[n] = i[n-1] + Ki * x[n] */
+	inc = ref_sat_q31(((q63_t) S->Ki * in) >> shift);
+	integ = ref_sat_q31((q63_t) S->integ + inc);
+
+	/* y[n] = Kp * x[n] + i[n] + Kd * d[n] */
+	acc = ((q63_t) S->Kp * in + (q63_t) S->Kd * S->deriv) >> shift;
+	acc += integ;
+
+	/* Clamp the output, no integration into the limit */
+	if (acc > S->outMax)
+	{
+		out = S->outMax;
+		if (inc > 0)
+			integ = S->integ;
+	}
+	else if (acc < S->outMin)
+	{
+		out = S->outMin;
+		if (inc < 0)
+			integ = S->integ;
+	}
+	else
+	{
+		out = (q31_t) acc;
+	}
+
+	S->integ = integ;
+
+	return (out);
+}
+
+q15_t ref_pid_ext_q15(
+	arm_pid_ext_instance_q15 * S,
+	q15_t in)
+{
+	q63_t acc;
+	q31_t diff, inc, integ;
+	q15_t out;
+	int32_t shift = S->postShift + 1;
+
+	/* d[n] = d[n-1] + alpha * ((x[n] - x[n-1]) - d[n-1]) */
+	diff = ref_sat_q15((q31_t) in - S->xPrev);
+	S->deriv = S->deriv + (q15_t) (((q31_t) S->alpha * (diff - S->deriv)) >> 15);
+	S->xPrev = in;
+
+	/* i[n] = i[n-1] + Ki * x[n], in 1.31 format */
+	inc = ref_sat_q31((q63_t) ((q31_t) S->Ki * in) * (1LL << shift));
+	integ = ref_sat_q31((q63_t) S->integ + inc);
+
+	/* y[n] = Kp * x[n] + i[n] + Kd * d[n], in 1.31 format */
+	acc = ((q63_t) S->Kp * in + (q63_t) S->Kd * S->deriv) * (1LL << shift);
+	acc += integ;
+
+	/* Clamp the output, no integration into the limit */
+	if (acc > (q63_t) S->outMax * 65536)
+	{
+		out = S->outMax;
+		if (inc > 0)
+			integ = S->integ;
+	}
+	else if (acc < (q63_t) S->outMin * 65536)
+	{
+		out = S->outMin;
+		if (inc < 0)
+			integ = S->integ;
+	}
+	else
+	{
+		out = (q15_t) (acc >> 16);
+	}
+
+	S->integ = integ;
+
+	return (out);
+}
+
+void ref_pid_ext_set_gains_f32(
+	arm_pid_ext_instance_f32 * S,
+	float32_t Kp,
+	float32_t Ki,
+	float32_t Kd)
+{
+	S->integ = S->integ + (S->Kp - Kp) * S->xPrev + (S->Kd - Kd) * S->deriv;
+	S->Kp = Kp;
+	S->Ki = Ki;
+	S->Kd = Kd;
+}
+
+void ref_pid_ext_set_gains_q31(
+	arm_pid_ext_instance_q31 * S,
+	q31_t Kp,
+	q31_t Ki,
+	q31_t Kd)
+{
+	int32_t shift = 31 - S->postShift;
+	q63_t acc = S->integ;
+
+	acc += (((q63_t) S->Kp * S->xPrev) >> shift) - (((q63_t) Kp * S->xPrev) >> shift);
+	acc += (((q63_t) S->Kd * S->deriv) >> shift) - (((q63_t) Kd * S->deriv) >> shift);
+	S->integ = ref_sat_q31(acc);
+	S->Kp = Kp;
+	S->Ki = Ki;
+	S->Kd = Kd;
+}
+
+void ref_pid_ext_set_gains_q15(
+	arm_pid_ext_instance_q15 * S,
+	q15_t Kp,
+	q15_t Ki,
+	q15_t Kd)
+{
+	int32_t shift = S->postShift + 1;
+	q63_t acc;
+
+	acc = ((q63_t) S->Kp - Kp) * S->xPrev + ((q63_t) S->Kd - Kd) * S->deriv;
+	S->integ = ref_sat_q31(S->integ + acc * (1LL << shift));
+	S->Kp = Kp;
+	S->Ki = Ki;
+	S->Kd = Kd;
+}
@@ -0,0 +1,31 @@
+#include "ref.h"
+
+void ref_vatan2_f32(float32_t * pSrcY, float32_t * pSrcX, float32_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = atan2f(pSrcY[i], pSrcX[i]);
+	}
+}
+
+void ref_vatan2_q31(q31_t * pSrcY, q31_t * pSrcX, q31_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = ref_sat_q31((q63_t)(atan2((float64_t)pSrcY[i], (float64_t)pSrcX[i]) / 3.14159265358979 * 2147483648.0));
+	}
+}
+
+void ref_vatan2_q15(q15_t * pSrcY, q15_t * pSrcX, q15_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = ref_sat_q15((q31_t)(atan2f((float32_t)pSrcY[i], (float32_t)pSrcX[i]) / PI * 32768.0f));
+	}
+}
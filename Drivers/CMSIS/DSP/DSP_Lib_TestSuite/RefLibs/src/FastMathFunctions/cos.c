@@ -9,3 +9,33 @@ q15_t ref_cos_q15(q15_t x)
 {
 	return (q15_t)(cosf((float32_t)x * 6.28318530717959f / 32768.0f) * 32768.0f);
 }
+
+void ref_vcos_f32(float32_t * pSrc, float32_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = cosf(pSrc[i]);
+	}
+}
+
+void ref_vcos_q31(q31_t * pSrc, q31_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = ref_cos_q31(pSrc[i]);
+	}
+}
+
+void ref_vcos_q15(q15_t * pSrc, q15_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = ref_cos_q15(pSrc[i]);
+	}
+}
@@ -0,0 +1,91 @@
+#include "ref.h"
+
+arm_status ref_divide_q31(q31_t numerator, q31_t denominator, q31_t * quotient, int16_t * shift)
+{
+	q63_t absNum, absDen, q;
+	int16_t sh = 0;
+
+	if (denominator == 0)
+	{
+		*quotient = (numerator < 0) ? INT_MIN : 0x7FFFFFFF;
+		*shift = 0;
+		return ARM_MATH_NANINF;
+	}
+
+	absNum = (numerator < 0) ? -(q63_t)numerator : (q63_t)numerator;
+	absDen = (denominator < 0) ? -(q63_t)denominator : (q63_t)denominator;
+
+	while ((absNum != 0) && (absNum >= (absDen << sh)))
+	{
+		sh++;
+	}
+
+	q = (absNum << 31) / (absDen << sh);
+
+	*quotient = (q31_t)(((numerator ^ denominator) < 0) ? -q : q);
+	*shift = sh;
+
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_divide_q15(q15_t numerator, q15_t denominator, q15_t * quotient, int16_t * shift)
+{
+	q31_t absNum, absDen, q;
+	int16_t sh = 0;
+
+	if (denominator == 0)
+	{
+		*quotient = (numerator < 0) ? SHRT_MIN : 0x7FFF;
+		*shift = 0;
+		return ARM_MATH_NANINF;
+	}
+
+	absNum = (numerator < 0) ? -(q31_t)numerator : (q31_t)numerator;
+	absDen = (denominator < 0) ? -(q31_t)denominator : (q31_t)denominator;
+
+	while ((absNum != 0) && (absNum >= (absDen << sh)))
+	{
+		sh++;
+	}
+
+	q = (absNum << 15) / (absDen << sh);
+
+	*quotient = (q15_t)(((numerator ^ denominator) < 0) ? -q : q);
+	*shift = sh;
+
+	return ARM_MATH_SUCCESS;
+}
+
+void ref_vdivide_q31(q31_t * pSrcA, q31_t * pSrcB, q31_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		if (pSrcB[i] == 0)
+		{
+			pDst[i] = (pSrcA[i] < 0) ? INT_MIN : 0x7FFFFFFF;
+		}
+		else
+		{
+			pDst[i] = ref_sat_q31(((q63_t)pSrcA[i] << 31) / pSrcB[i]);
+		}
+	}
+}
+
+void ref_vdivide_q15(q15_t * pSrcA, q15_t * pSrcB, q15_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		if (pSrcB[i] == 0)
+		{
+			pDst[i] = (pSrcA[i] < 0) ? SHRT_MIN : 0x7FFF;
+		}
+		else
+		{
+			pDst[i] = ref_sat_q15(((q31_t)pSrcA[i] << 15) / pSrcB[i]);
+		}
+	}
+}
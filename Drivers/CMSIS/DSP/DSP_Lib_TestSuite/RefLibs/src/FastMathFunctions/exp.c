@@ -0,0 +1,31 @@
+#include "ref.h"
+
+void ref_vexp_f32(float32_t * pSrc, float32_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = expf(pSrc[i]);
+	}
+}
+
+void ref_vexp_q31(q31_t * pSrc, q31_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = ref_sat_q31((q63_t)(exp((float64_t)pSrc[i] / 67108864.0) * 2147483648.0));
+	}
+}
+
+void ref_vexp_q15(q15_t * pSrc, q15_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = ref_sat_q15((q31_t)(expf((float32_t)pSrc[i] / 2048.0f) * 32768.0f));
+	}
+}
@@ -0,0 +1,121 @@
+#include "ref.h"
+
+/*
+ * The interpolation references search the segment linearly and compute in
+ * double precision.  The points outside the breakpoints return the value at
+ * the nearest end.
+ */
+
+static uint32_t ref_interp_segment(
+  const float32_t * pXData,
+  uint32_t nValues,
+  float32_t x)
+{
+	uint32_t i = 0;
+
+	while ((i < nValues - 2) && (x >= pXData[i + 1]))
+	{
+		i++;
+	}
+
+	return i;
+}
+
+void ref_pwl_f32(
+  const float32_t * pXData,
+  const float32_t * pYData,
+  uint32_t nValues,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t n, i;
+	double t;
+
+	for (n = 0; n < blockSize; n++)
+	{
+		if (pSrc[n] <= pXData[0])
+		{
+			pDst[n] = pYData[0];
+		}
+		else if (pSrc[n] >= pXData[nValues - 1])
+		{
+			pDst[n] = pYData[nValues - 1];
+		}
+		else
+		{
+			i = ref_interp_segment(pXData, nValues, pSrc[n]);
+			t = ((double)pSrc[n] - pXData[i]) / ((double)pXData[i + 1] - pXData[i]);
+			pDst[n] = (float32_t)(pYData[i] + t * ((double)pYData[i + 1] - pYData[i]));
+		}
+	}
+}
+
+void ref_spline_f32(
+  arm_spline_type type,
+  const float32_t * pXData,
+  const float32_t * pYData,
+  uint32_t nValues,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	double sub[64], diag[64], sup[64], rhs[64], m[64];
+	double h0, h1, t, h, b, c, d, f;
+	uint32_t k, n, i, last = nValues - 1;
+
+	/* Tridiagonal system of the inner second derivatives, solved by Gaussian elimination */
+	for (k = 1; k < last; k++)
+	{
+		h0 = (double)pXData[k] - pXData[k - 1];
+		h1 = (double)pXData[k + 1] - pXData[k];
+		sub[k] = h0;
+		diag[k] = 2.0 * (h0 + h1);
+		sup[k] = h1;
+		rhs[k] = 6.0 * (((double)pYData[k + 1] - pYData[k]) / h1 - ((double)pYData[k] - pYData[k - 1]) / h0);
+		if (type == ARM_SPLINE_PARABOLIC_RUNOUT)
+		{
+			if (k == 1) diag[k] += h0;
+			if (k == last - 1) diag[k] += h1;
+		}
+	}
+	for (k = 2; k < last; k++)
+	{
+		f = sub[k] / diag[k - 1];
+		diag[k] -= f * sup[k - 1];
+		rhs[k] -= f * rhs[k - 1];
+	}
+	m[0] = 0.0;
+	m[last] = 0.0;
+	for (k = last - 1; k >= 1; k--)
+	{
+		m[k] = (rhs[k] - ((k < last - 1) ? sup[k] * m[k + 1] : 0.0)) / diag[k];
+	}
+	if ((type == ARM_SPLINE_PARABOLIC_RUNOUT) && (last > 1))
+	{
+		m[0] = m[1];
+		m[last] = m[last - 1];
+	}
+
+	for (n = 0; n < blockSize; n++)
+	{
+		if (pSrc[n] <= pXData[0])
+		{
+			pDst[n] = pYData[0];
+		}
+		else if (pSrc[n] >= pXData[last])
+		{
+			pDst[n] = pYData[last];
+		}
+		else
+		{
+			i = ref_interp_segment(pXData, nValues, pSrc[n]);
+			h = (double)pXData[i + 1] - pXData[i];
+			t = (double)pSrc[n] - pXData[i];
+			b = ((double)pYData[i + 1] - pYData[i]) / h - h * (2.0 * m[i] + m[i + 1]) / 6.0;
+			c = m[i] / 2.0;
+			d = (m[i + 1] - m[i]) / (6.0 * h);
+			pDst[n] = (float32_t)(pYData[i] + t * (b + t * (c + t * d)));
+		}
+	}
+}
@@ -0,0 +1,31 @@
+#include "ref.h"
+
+void ref_vlog_f32(float32_t * pSrc, float32_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = logf(pSrc[i]);
+	}
+}
+
+void ref_vlog_q31(q31_t * pSrc, q31_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = (pSrc[i] > 0) ? (q31_t)(log((float64_t)pSrc[i] / 2147483648.0) * 67108864.0) : INT_MIN;
+	}
+}
+
+void ref_vlog_q15(q15_t * pSrc, q15_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = (pSrc[i] > 0) ? (q15_t)(logf((float32_t)pSrc[i] / 32768.0f) * 2048.0f) : SHRT_MIN;
+	}
+}
@@ -0,0 +1,64 @@
+#include "ref.h"
+
+/*
+ * The resize reference computes the position of each destination pixel and
+ * its interpolation in double precision.  The positions outside the source
+ * are clamped to its border.
+ */
+
+static double ref_resize_pixel(
+  const float32_t * pSrc,
+  uint16_t srcWidth,
+  uint16_t srcHeight,
+  double x,
+  double y)
+{
+	double fx, fy;
+	int32_t x0, y0, x1, y1;
+
+	x = (x < 0.0) ? 0.0 : ((x > srcWidth - 1) ? (double)(srcWidth - 1) : x);
+	y = (y < 0.0) ? 0.0 : ((y > srcHeight - 1) ? (double)(srcHeight - 1) : y);
+
+	x0 = (int32_t)x;
+	y0 = (int32_t)y;
+	x1 = (x0 < srcWidth - 1) ? x0 + 1 : x0;
+	y1 = (y0 < srcHeight - 1) ? y0 + 1 : y0;
+	fx = x - x0;
+	fy = y - y0;
+
+	return (1.0 - fy) * ((1.0 - fx) * pSrc[y0 * srcWidth + x0] + fx * pSrc[y0 * srcWidth + x1])
+	       + fy * ((1.0 - fx) * pSrc[y1 * srcWidth + x0] + fx * pSrc[y1 * srcWidth + x1]);
+}
+
+void ref_resize_f32(
+  arm_resize_mode mode,
+  const float32_t * pSrc,
+  uint16_t srcWidth,
+  uint16_t srcHeight,
+  float32_t * pDst,
+  uint16_t dstWidth,
+  uint16_t dstHeight)
+{
+	double x, y;
+	uint32_t i, j;
+
+	for (i = 0; i < dstHeight; i++)
+	{
+		y = (i + 0.5) * srcHeight / dstHeight;
+
+		for (j = 0; j < dstWidth; j++)
+		{
+			x = (j + 0.5) * srcWidth / dstWidth;
+
+			if (mode == ARM_RESIZE_NEAREST)
+			{
+				pDst[i * dstWidth + j] = pSrc[(uint32_t)y * srcWidth + (uint32_t)x];
+			}
+			else
+			{
+				pDst[i * dstWidth + j] = (float32_t)ref_resize_pixel(pSrc, srcWidth, srcHeight,
+				                                                     x - 0.5, y - 0.5);
+			}
+		}
+	}
+}
@@ -13,3 +13,33 @@ arm_status ref_sqrt_q15(q15_t in, q15_t * pOut)
 	
 	return ARM_MATH_SUCCESS;
 }
+
+void ref_vsqrt_f32(float32_t * pSrc, float32_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = (pSrc[i] > 0.0f) ? sqrtf(pSrc[i]) : 0.0f;
+	}
+}
+
+void ref_vsqrt_q31(q31_t * pSrc, q31_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = (pSrc[i] > 0) ? (q31_t)(sqrtf((float32_t)pSrc[i] / 2147483648.0f) * 2147483648.0f) : 0;
+	}
+}
+
+void ref_vsqrt_q15(q15_t * pSrc, q15_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = (pSrc[i] > 0) ? (q15_t)(sqrtf((float32_t)pSrc[i] / 32768.0f) * 32768.0f) : 0;
+	}
+}
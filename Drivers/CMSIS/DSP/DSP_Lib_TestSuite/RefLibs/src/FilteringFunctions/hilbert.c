@@ -0,0 +1,53 @@
+#include "ref.h"
+
+void ref_hilbert_f32(
+	const float32_t * pCoeffs,
+	uint16_t numTaps,
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t c = (numTaps - 1U) / 2U;
+	uint32_t n, i;
+	float64_t acc, h;
+
+	/* Direct form with all the taps: h[c+k] = pCoeffs[(k-1)/2], h[c-k] = -h[c+k] for odd k */
+	for(n=0;n<blockSize;n++)
+	{
+		acc = 0.0;
+		for(i=0;i<numTaps && i<=n;i++)
+		{
+			if(((i + c) & 1U) == 0U)
+			{
+				continue;
+			}
+			h = (i > c) ? pCoeffs[(i - c - 1U) / 2U] : -pCoeffs[(c - i - 1U) / 2U];
+			acc += h * pSrc[n - i];
+		}
+
+		pDst[2*n] = (n >= c) ? pSrc[n - c] : 0.0f;
+		pDst[2*n+1] = (float32_t)acc;
+	}
+}
+
+void ref_analytic_f32(
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t fftLen)
+{
+	uint32_t n, m;
+	float64_t acc;
+
+	/* Circular Hilbert transform: h[m] = 2 / N cot(pi m / N) for odd m, 0 for even m */
+	for(n=0;n<fftLen;n++)
+	{
+		acc = 0.0;
+		for(m=1;m<fftLen;m+=2)
+		{
+			acc += 2.0 / fftLen / tan(3.14159265358979 * m / fftLen) * pSrc[(n + fftLen - m) % fftLen];
+		}
+
+		pDst[2*n] = pSrc[n];
+		pDst[2*n+1] = (float32_t)acc;
+	}
+}
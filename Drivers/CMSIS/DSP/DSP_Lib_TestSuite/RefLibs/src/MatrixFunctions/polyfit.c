@@ -0,0 +1,146 @@
+#include "ref.h"
+
+arm_status ref_polyfit_f32(
+  const float32_t * pX,
+  const float32_t * pY,
+  const float32_t * pW,
+  uint32_t numSamples,
+  uint16_t order,
+  float32_t * pCoeffs)
+{
+	float64_t a[8][9];
+	float64_t d[8], q[8];
+	float64_t xmin, xmax, c, s, t, p, w, f;
+	uint32_t m = order + 1U;
+	uint32_t i, j, k;
+
+	xmin = xmax = pX[0];
+	for(i=1;i<numSamples;i++)
+	{
+		xmin = (pX[i] < xmin) ? pX[i] : xmin;
+		xmax = (pX[i] > xmax) ? pX[i] : xmax;
+	}
+	c = 0.5 * (xmax + xmin);
+	s = (xmax > xmin) ? 2.0 / (xmax - xmin) : 1.0;
+
+	/* Normal equations in t = (x - c) * s, augmented with the right-hand side */
+	for(j=0;j<m;j++)
+	{
+		for(k=0;k<=m;k++)
+		{
+			a[j][k] = 0.0;
+		}
+	}
+	for(i=0;i<numSamples;i++)
+	{
+		w = (pW != NULL) ? pW[i] : 1.0;
+		t = (pX[i] - c) * s;
+		for(j=0;j<m;j++)
+		{
+			p = w * pow(t, (float64_t)j);
+			for(k=0;k<m;k++)
+			{
+				a[j][k] += p * pow(t, (float64_t)k);
+			}
+			a[j][m] += p * pY[i];
+		}
+	}
+
+	/* Gauss-Jordan elimination with partial pivoting */
+	for(j=0;j<m;j++)
+	{
+		k = j;
+		for(i=j+1;i<m;i++)
+		{
+			k = (fabs(a[i][j]) > fabs(a[k][j])) ? i : k;
+		}
+		if(a[k][j] == 0.0)
+		{
+			return ARM_MATH_SINGULAR;
+		}
+		for(i=0;i<=m;i++)
+		{
+			f = a[j][i]; a[j][i] = a[k][i]; a[k][i] = f;
+		}
+		for(i=0;i<m;i++)
+		{
+			if(i != j)
+			{
+				f = a[i][j] / a[j][j];
+				for(k=j;k<=m;k++)
+				{
+					a[i][k] -= f * a[j][k];
+				}
+			}
+		}
+	}
+	for(j=0;j<m;j++)
+	{
+		d[j] = a[j][m] / a[j][j];
+	}
+
+	/* Coefficients of x: sum d[j] (s x - s c)^j */
+	for(k=0;k<m;k++)
+	{
+		q[k] = 0.0;
+		for(j=k;j<m;j++)
+		{
+			/* binomial(j, k) s^j (-c)^(j-k) */
+			f = 1.0;
+			for(i=0;i<k;i++)
+			{
+				f = f * (j - i) / (i + 1);
+			}
+			q[k] += d[j] * f * pow(s, (float64_t)j) * pow(-c, (float64_t)(j - k));
+		}
+		pCoeffs[k] = (float32_t)q[k];
+	}
+
+	return ARM_MATH_SUCCESS;
+}
+
+void ref_poly_eval_f32(
+  const float32_t * pCoeffs,
+  uint16_t order,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	int32_t k;
+	float64_t acc;
+
+	for(i=0;i<blockSize;i++)
+	{
+		acc = pCoeffs[order];
+		for(k=order-1;k>=0;k--)
+		{
+			acc = acc * pSrc[i] + pCoeffs[k];
+		}
+		pDst[i] = (float32_t)acc;
+	}
+}
+
+void ref_poly_eval_q31(
+  const q31_t * pCoeffs,
+  uint16_t order,
+  uint8_t postShift,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	int32_t k;
+	float64_t acc, x;
+
+	for(i=0;i<blockSize;i++)
+	{
+		x = pSrc[i] / 2147483648.0;
+		acc = pCoeffs[order] / 2147483648.0;
+		for(k=order-1;k>=0;k--)
+		{
+			acc = acc * x + pCoeffs[k] / 2147483648.0;
+		}
+		pDst[i] = ref_sat_q31((q63_t)(acc * 2147483648.0 * (float64_t)(1U << postShift)));
+	}
+}
@@ -0,0 +1,35 @@
+#include "ref.h"
+
+void ref_envelope_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_envelope_detector detector,
+  float32_t attack,
+  float32_t release,
+  uint32_t holdSamples,
+  float32_t * pDst)
+{
+	uint32_t i, hold = 0;
+	float32_t d, env = 0.0f;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		d = (detector == ARM_ENVELOPE_RMS) ? pSrc[i] * pSrc[i] : fabsf(pSrc[i]);
+
+		if (d > env)
+		{
+			env += attack * (d - env);
+			hold = holdSamples;
+		}
+		else if (hold > 0)
+		{
+			hold--;
+		}
+		else
+		{
+			env += release * (d - env);
+		}
+
+		pDst[i] = env;
+	}
+}
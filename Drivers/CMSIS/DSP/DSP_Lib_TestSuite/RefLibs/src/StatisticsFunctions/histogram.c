@@ -0,0 +1,41 @@
+#include "ref.h"
+
+void ref_histogram_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t minVal,
+  float32_t maxVal,
+  uint32_t numBins,
+  uint32_t * pHist)
+{
+	uint32_t i;
+	float64_t pos;
+
+	for(i=0;i<blockSize;i++)
+	{
+		pos = floor(((float64_t)pSrc[i] - minVal) * numBins / ((float64_t)maxVal - minVal));
+		if (pos < 0) pos = 0;
+		if (pos > numBins - 1) pos = numBins - 1;
+		pHist[(uint32_t)pos]++;
+	}
+}
+
+void ref_histogram_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t minVal,
+  q15_t maxVal,
+  uint16_t numBins,
+  uint32_t * pHist)
+{
+	uint32_t i;
+	float64_t pos;
+
+	for(i=0;i<blockSize;i++)
+	{
+		pos = floor(((float64_t)pSrc[i] - minVal) * numBins / ((float64_t)maxVal - minVal));
+		if (pos < 0) pos = 0;
+		if (pos > numBins - 1) pos = numBins - 1;
+		pHist[(uint32_t)pos]++;
+	}
+}
@@ -0,0 +1,110 @@
+#include "ref.h"
+#include <stdlib.h>
+
+/*
+ * The selection and percentile references sort the whole vector with qsort(),
+ * which also satisfies the partial ordering guaranteed by arm_select_xxx().
+ */
+
+static int ref_sort_cmp_f32(const void * a, const void * b)
+{
+	float32_t x = *(const float32_t *)a, y = *(const float32_t *)b;
+	return (x > y) - (x < y);
+}
+
+static int ref_sort_cmp_q31(const void * a, const void * b)
+{
+	q31_t x = *(const q31_t *)a, y = *(const q31_t *)b;
+	return (x > y) - (x < y);
+}
+
+static int ref_sort_cmp_q15(const void * a, const void * b)
+{
+	q15_t x = *(const q15_t *)a, y = *(const q15_t *)b;
+	return (x > y) - (x < y);
+}
+
+void ref_select_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pResult)
+{
+	qsort(pSrc, blockSize, sizeof(float32_t), ref_sort_cmp_f32);
+	*pResult = pSrc[k];
+}
+
+void ref_select_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q31_t * pResult)
+{
+	qsort(pSrc, blockSize, sizeof(q31_t), ref_sort_cmp_q31);
+	*pResult = pSrc[k];
+}
+
+void ref_select_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q15_t * pResult)
+{
+	qsort(pSrc, blockSize, sizeof(q15_t), ref_sort_cmp_q15);
+	*pResult = pSrc[k];
+}
+
+void ref_percentile_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t percentile,
+  float32_t * pResult)
+{
+	float64_t rank, frac;
+	uint32_t k;
+
+	qsort(pSrc, blockSize, sizeof(float32_t), ref_sort_cmp_f32);
+	rank = (float64_t)percentile * (blockSize - 1);
+	k = (uint32_t)rank;
+	if (k >= blockSize - 1)
+	{
+		*pResult = pSrc[blockSize - 1];
+		return;
+	}
+	frac = rank - k;
+	*pResult = pSrc[k] + frac * ((float64_t)pSrc[k + 1] - pSrc[k]);
+}
+
+void ref_percentile_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t percentile,
+  q31_t * pResult)
+{
+	float64_t rank, frac;
+	uint32_t k;
+
+	qsort(pSrc, blockSize, sizeof(q31_t), ref_sort_cmp_q31);
+	rank = (percentile < 0 ? 0 : percentile) / 2147483648.0 * (blockSize - 1);
+	k = (uint32_t)rank;
+	frac = rank - k;
+	*pResult = (frac == 0) ? pSrc[k] :
+		(q31_t)floor(pSrc[k] + frac * ((float64_t)pSrc[k + 1] - pSrc[k]));
+}
+
+void ref_percentile_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t percentile,
+  q15_t * pResult)
+{
+	float64_t rank, frac;
+	uint32_t k;
+
+	qsort(pSrc, blockSize, sizeof(q15_t), ref_sort_cmp_q15);
+	rank = (percentile < 0 ? 0 : percentile) / 32768.0 * (blockSize - 1);
+	k = (uint32_t)rank;
+	frac = rank - k;
+	*pResult = (frac == 0) ? pSrc[k] :
+		(q15_t)floor(pSrc[k] + frac * ((float64_t)pSrc[k + 1] - pSrc[k]));
+}
@@ -0,0 +1,116 @@
+#include "ref.h"
+
+/*
+ * Two-pass mean, variance and sum of squares computed in double precision.
+ * The samples are read from pSrcF, or from pSrcQ scaled by 2^-31 when pSrcF
+ * is NULL, so that Q31 inputs are not rounded to single precision.
+ */
+static void ref_stats_moments(
+  float32_t * pSrcF,
+  q31_t * pSrcQ,
+  uint32_t blockSize,
+  float64_t * pMean,
+  float64_t * pVar,
+  float64_t * pPower)
+{
+	uint32_t i;
+	float64_t sum=0, sumsq=0, power=0, x, diff;
+
+	for(i=0;i<blockSize;i++)
+	{
+			x = (pSrcF != NULL) ? pSrcF[i] : pSrcQ[i] / 2147483648.0;
+			sum += x;
+			power += x * x;
+	}
+	*pMean = sum / blockSize;
+
+	for(i=0;i<blockSize;i++)
+	{
+			x = (pSrcF != NULL) ? pSrcF[i] : pSrcQ[i] / 2147483648.0;
+			diff = x - *pMean;
+			sumsq += diff * diff;
+	}
+	*pVar = (blockSize > 1) ? sumsq / (blockSize - 1) : 0;
+	*pPower = power;
+}
+
+void ref_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t statsFlags,
+  arm_stats_result_f32 * pResult)
+{
+	float64_t mean, var, power;
+
+	ref_stats_moments(pSrc, NULL, blockSize, &mean, &var, &power);
+
+	pResult->mean = (float32_t)mean;
+	pResult->var = (float32_t)var;
+	pResult->std = (float32_t)sqrt(var);
+	pResult->rms = (float32_t)sqrt(power / blockSize);
+	pResult->power = (float32_t)power;
+	ref_min_f32(pSrc, blockSize, &pResult->min, &pResult->minIndex);
+	ref_max_f32(pSrc, blockSize, &pResult->max, &pResult->maxIndex);
+}
+
+void ref_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t statsFlags,
+  arm_stats_result_q31 * pResult)
+{
+	float64_t mean, var, power;
+
+	ref_stats_moments(NULL, pSrc, blockSize, &mean, &var, &power);
+
+	pResult->mean = ref_sat_q31((q63_t)(mean * 2147483648.0));
+	pResult->var = ref_sat_q31((q63_t)(var * 2147483648.0));
+	pResult->std = ref_sat_q31((q63_t)(sqrt(var) * 2147483648.0));
+	pResult->rms = ref_sat_q31((q63_t)(sqrt(power / blockSize) * 2147483648.0));
+	/* 16.48 format */
+	pResult->power = (q63_t)(power * 281474976710656.0);
+	ref_min_q31(pSrc, blockSize, &pResult->min, &pResult->minIndex);
+	ref_max_q31(pSrc, blockSize, &pResult->max, &pResult->maxIndex);
+}
+
+void ref_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t statsFlags,
+  arm_stats_result_q15 * pResult)
+{
+	float64_t mean, var, power;
+
+	ref_q15_to_float(pSrc, scratchArray, blockSize);
+	ref_stats_moments(scratchArray, NULL, blockSize, &mean, &var, &power);
+
+	pResult->mean = ref_sat_q15((q31_t)(mean * 32768.0));
+	pResult->var = ref_sat_q15((q31_t)(var * 32768.0));
+	pResult->std = ref_sat_q15((q31_t)(sqrt(var) * 32768.0));
+	pResult->rms = ref_sat_q15((q31_t)(sqrt(power / blockSize) * 32768.0));
+	/* 34.30 format */
+	pResult->power = (q63_t)(power * 1073741824.0);
+	ref_min_q15(pSrc, blockSize, &pResult->min, &pResult->minIndex);
+	ref_max_q15(pSrc, blockSize, &pResult->max, &pResult->maxIndex);
+}
+
+void ref_stats_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  uint32_t statsFlags,
+  arm_stats_result_q7 * pResult)
+{
+	float64_t mean, var, power;
+
+	ref_q7_to_float(pSrc, scratchArray, blockSize);
+	ref_stats_moments(scratchArray, NULL, blockSize, &mean, &var, &power);
+
+	pResult->mean = ref_sat_q7((q15_t)(mean * 128.0));
+	pResult->var = ref_sat_q7((q15_t)(var * 128.0));
+	pResult->std = ref_sat_q7((q15_t)(sqrt(var) * 128.0));
+	pResult->rms = ref_sat_q7((q15_t)(sqrt(power / blockSize) * 128.0));
+	/* 18.14 format */
+	pResult->power = (q31_t)(power * 16384.0);
+	ref_min_q7(pSrc, blockSize, &pResult->min, &pResult->minIndex);
+	ref_max_q7(pSrc, blockSize, &pResult->max, &pResult->maxIndex);
+}
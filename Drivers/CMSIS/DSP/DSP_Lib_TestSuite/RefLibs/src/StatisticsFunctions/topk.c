@@ -0,0 +1,92 @@
+#include "ref.h"
+#include <stdlib.h>
+
+/*
+ * The top-k references sort the indices of the whole vector with qsort(),
+ * by descending value and then by ascending index.
+ */
+
+static float32_t * ref_topk_src_f32;
+static q15_t * ref_topk_src_q15;
+static q7_t * ref_topk_src_q7;
+
+static int ref_topk_compare_f32(const void * a, const void * b)
+{
+	uint32_t i = *(const uint32_t *)a, j = *(const uint32_t *)b;
+	float32_t x = ref_topk_src_f32[i], y = ref_topk_src_f32[j];
+	if (x != y) return (x < y) ? 1 : -1;
+	return (i > j) - (i < j);
+}
+
+static int ref_topk_compare_q15(const void * a, const void * b)
+{
+	uint32_t i = *(const uint32_t *)a, j = *(const uint32_t *)b;
+	q15_t x = ref_topk_src_q15[i], y = ref_topk_src_q15[j];
+	if (x != y) return (x < y) ? 1 : -1;
+	return (i > j) - (i < j);
+}
+
+static int ref_topk_compare_q7(const void * a, const void * b)
+{
+	uint32_t i = *(const uint32_t *)a, j = *(const uint32_t *)b;
+	q7_t x = ref_topk_src_q7[i], y = ref_topk_src_q7[j];
+	if (x != y) return (x < y) ? 1 : -1;
+	return (i > j) - (i < j);
+}
+
+void ref_topk_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pDst,
+  uint32_t * pIndex)
+{
+	uint32_t i, * order = (uint32_t *)scratchArray;
+
+	for(i=0;i<blockSize;i++) order[i] = i;
+	ref_topk_src_f32 = pSrc;
+	qsort(order, blockSize, sizeof(uint32_t), ref_topk_compare_f32);
+	for(i=0;i<k;i++)
+	{
+		pIndex[i] = order[i];
+		pDst[i] = pSrc[order[i]];
+	}
+}
+
+void ref_topk_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q15_t * pDst,
+  uint32_t * pIndex)
+{
+	uint32_t i, * order = (uint32_t *)scratchArray;
+
+	for(i=0;i<blockSize;i++) order[i] = i;
+	ref_topk_src_q15 = pSrc;
+	qsort(order, blockSize, sizeof(uint32_t), ref_topk_compare_q15);
+	for(i=0;i<k;i++)
+	{
+		pIndex[i] = order[i];
+		pDst[i] = pSrc[order[i]];
+	}
+}
+
+void ref_topk_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q7_t * pDst,
+  uint32_t * pIndex)
+{
+	uint32_t i, * order = (uint32_t *)scratchArray;
+
+	for(i=0;i<blockSize;i++) order[i] = i;
+	ref_topk_src_q7 = pSrc;
+	qsort(order, blockSize, sizeof(uint32_t), ref_topk_compare_q7);
+	for(i=0;i<k;i++)
+	{
+		pIndex[i] = order[i];
+		pDst[i] = pSrc[order[i]];
+	}
+}
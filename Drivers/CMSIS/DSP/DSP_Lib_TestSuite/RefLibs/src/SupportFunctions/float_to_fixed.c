@@ -50,3 +50,91 @@ void ref_float_to_q7(
 		pDst[i] = ref_sat_q7((q15_t)in);
 	}
 }
+
+/*
+ * Quantization with dither and noise shaping, to an integer of the given
+ * range, in LSB.  The sequence of floating-point operations is the one of the
+ * library, so that the results are identical.
+ */
+static q31_t ref_quant_sample(
+	arm_quant_instance_f32 * S,
+	float32_t x,
+	float32_t scale,
+	float32_t lo,
+	float32_t hi)
+{
+	uint32_t r1, r2;
+	float32_t u, d, e;
+
+	u = x * scale;
+	if (S->mode == ARM_QUANT_SHAPED)
+		u = u - 2.0f * S->err[0] + S->err[1];
+
+	d = 0.0f;
+	if (S->mode != ARM_QUANT_ROUND)
+	{
+		r1 = S->seed * 1664525U + 1013904223U;
+		r2 = r1 * 1664525U + 1013904223U;
+		S->seed = r2;
+		d = ((float32_t) ((int32_t) r1 >> 16) + (float32_t) ((int32_t) r2 >> 16)) * (1.0f / 65536.0f);
+	}
+
+	d = u + d;
+	d += d > 0.0f ? 0.5f : -0.5f;
+	if (d > hi) d = hi;
+	if (d < lo) d = lo;
+
+	if (S->mode == ARM_QUANT_SHAPED)
+	{
+		e = (float32_t) (q31_t) d - u;
+		if (e > 2.0f) e = 2.0f;
+		if (e < -2.0f) e = -2.0f;
+		S->err[1] = S->err[0];
+		S->err[0] = e;
+	}
+
+	return (q31_t) d;
+}
+
+void ref_float_to_q15_quant(
+  arm_quant_instance_f32 * S,
+  float32_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	float32_t scale = S->scale * 32768.0f;
+
+	for(i=0;i<blockSize;i++)
+	{
+		pDst[i] = (q15_t) ref_quant_sample(S, pSrc[i], scale, -32768.0f, 32767.0f);
+	}
+}
+
+void ref_float_to_q31_quant(
+  arm_quant_instance_f32 * S,
+  float32_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	float32_t in;
+
+	if (S->mode == ARM_QUANT_ROUND)
+	{
+		for(i=0;i<blockSize;i++)
+		{
+			in = pSrc[i] * (S->scale * 2147483648.0f);
+			in += in > 0.0f ? 0.5f : -0.5f;
+			pDst[i] = (in >= 2147483648.0f) ? INT_MAX :
+			          (in <= -2147483648.0f) ? INT_MIN : (q31_t) in;
+		}
+		return;
+	}
+
+	/* 24-bit output in the dithered modes */
+	for(i=0;i<blockSize;i++)
+	{
+		pDst[i] = ref_quant_sample(S, pSrc[i], S->scale * 8388608.0f, -8388608.0f, 8388607.0f) * 256;
+	}
+}
@@ -0,0 +1,154 @@
+#include "ref.h"
+
+void ref_deinterleave_f32(
+  float32_t * pSrc,
+  uint32_t numChannels,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t ch, i;
+	
+	for(ch=0;ch<numChannels;ch++)
+	{
+		for(i=0;i<blockSize;i++)
+		{
+			pDst[ch * blockSize + i] = pSrc[i * numChannels + ch];
+		}
+	}
+}
+
+void ref_interleave_f32(
+  float32_t * pSrc,
+  uint32_t numChannels,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t ch, i;
+	
+	for(ch=0;ch<numChannels;ch++)
+	{
+		for(i=0;i<blockSize;i++)
+		{
+			pDst[i * numChannels + ch] = pSrc[ch * blockSize + i];
+		}
+	}
+}
+
+void ref_deinterleave_q31(
+  q31_t * pSrc,
+  uint32_t numChannels,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t ch, i;
+	
+	for(ch=0;ch<numChannels;ch++)
+	{
+		for(i=0;i<blockSize;i++)
+		{
+			pDst[ch * blockSize + i] = pSrc[i * numChannels + ch];
+		}
+	}
+}
+
+void ref_interleave_q31(
+  q31_t * pSrc,
+  uint32_t numChannels,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t ch, i;
+	
+	for(ch=0;ch<numChannels;ch++)
+	{
+		for(i=0;i<blockSize;i++)
+		{
+			pDst[i * numChannels + ch] = pSrc[ch * blockSize + i];
+		}
+	}
+}
+
+void ref_deinterleave_q15(
+  q15_t * pSrc,
+  uint32_t numChannels,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t ch, i;
+	
+	for(ch=0;ch<numChannels;ch++)
+	{
+		for(i=0;i<blockSize;i++)
+		{
+			pDst[ch * blockSize + i] = pSrc[i * numChannels + ch];
+		}
+	}
+}
+
+void ref_interleave_q15(
+  q15_t * pSrc,
+  uint32_t numChannels,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t ch, i;
+	
+	for(ch=0;ch<numChannels;ch++)
+	{
+		for(i=0;i<blockSize;i++)
+		{
+			pDst[i * numChannels + ch] = pSrc[ch * blockSize + i];
+		}
+	}
+}
+
+void ref_deinterleave_q7(
+  q7_t * pSrc,
+  uint32_t numChannels,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t ch, i;
+	
+	for(ch=0;ch<numChannels;ch++)
+	{
+		for(i=0;i<blockSize;i++)
+		{
+			pDst[ch * blockSize + i] = pSrc[i * numChannels + ch];
+		}
+	}
+}
+
+void ref_interleave_q7(
+  q7_t * pSrc,
+  uint32_t numChannels,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t ch, i;
+	
+	for(ch=0;ch<numChannels;ch++)
+	{
+		for(i=0;i<blockSize;i++)
+		{
+			pDst[i * numChannels + ch] = pSrc[ch * blockSize + i];
+		}
+	}
+}
+
+void ref_adc_dual_to_q15(
+  uint32_t * pSrc,
+  uint32_t resolution,
+  q15_t * pDstA,
+  q15_t * pDstB,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	int32_t mid = 1 << (resolution - 1);
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pDstA[i] = (q15_t)(((int32_t)(pSrc[i] & 0xFFFF) - mid) * (1 << (16 - resolution)));
+		pDstB[i] = (q15_t)(((int32_t)(pSrc[i] >> 16) - mid) * (1 << (16 - resolution)));
+	}
+}
@@ -0,0 +1,71 @@
+#include "ref.h"
+
+#define REF_WELCH_MAX_BINS 2049
+
+void ref_welch_psd_f32(
+  float32_t * pSrc,
+  uint32_t numSamples,
+  float32_t * pWindow,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  float32_t alpha,
+  float32_t sampleRate,
+  float32_t * pDst)
+{
+	static double acc[REF_WELCH_MAX_BINS];
+	double re, im, p, sumSq = 0.0;
+	uint32_t numBins = fftLen / 2 + 1;
+	uint32_t seg, numSegments, n, k;
+
+	for(n=0;n<fftLen;n++)
+	{
+		sumSq += (double)pWindow[n] * pWindow[n];
+	}
+
+	for(k=0;k<numBins;k++)
+	{
+		acc[k] = 0.0;
+	}
+
+	numSegments = (numSamples < fftLen) ? 0 : (numSamples - fftLen) / hopSize + 1;
+
+	for(seg=0;seg<numSegments;seg++)
+	{
+		for(k=0;k<numBins;k++)
+		{
+			re = 0.0;
+			im = 0.0;
+			for(n=0;n<fftLen;n++)
+			{
+				p = (double)pSrc[seg * hopSize + n] * pWindow[n];
+				re += p * cos(6.283185307179586 * (double)((k * n) % fftLen) / fftLen);
+				im -= p * sin(6.283185307179586 * (double)((k * n) % fftLen) / fftLen);
+			}
+			p = re * re + im * im;
+
+			/* alpha == 0 is the linear mean */
+			if ((alpha == 0.0f) || (seg == 0))
+			{
+				acc[k] += p;
+			}
+			else
+			{
+				acc[k] += alpha * (p - acc[k]);
+			}
+		}
+	}
+
+	for(k=0;k<numBins;k++)
+	{
+		p = acc[k] / (sampleRate * sumSq);
+		if ((alpha == 0.0f) && (numSegments > 0))
+		{
+			p /= numSegments;
+		}
+		if ((k != 0) && (k != numBins - 1))
+		{
+			p *= 2.0;
+		}
+		pDst[k] = (float32_t)p;
+	}
+}
@@ -0,0 +1,77 @@
+#include "ref.h"
+
+static double ref_bessel_i0(double x)
+{
+	double sum = 1.0, term = 1.0;
+	int k;
+
+	for(k=1;k<200;k++)
+	{
+		term *= (x / (2.0 * k)) * (x / (2.0 * k));
+		sum += term;
+		if (term < sum * 1e-17)
+		{
+			break;
+		}
+	}
+
+	return sum;
+}
+
+void ref_window_f32(
+  arm_window_type type,
+  float32_t beta,
+  uint16_t length,
+  uint8_t periodic,
+  float32_t * pDst)
+{
+	static const double coefs[5][5] = {
+		{1.0, 0.0, 0.0, 0.0, 0.0},
+		{0.5, 0.5, 0.0, 0.0, 0.0},
+		{0.54, 0.46, 0.0, 0.0, 0.0},
+		{0.35875, 0.48829, 0.14128, 0.01168, 0.0},
+		{0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368}
+	};
+	double x, r, w;
+	uint32_t n, i;
+
+	for(n=0;n<length;n++)
+	{
+		x = (double)n / (double)(periodic ? length : length - 1);
+
+		if (type == ARM_WINDOW_KAISER)
+		{
+			r = 2.0 * x - 1.0;
+			w = ref_bessel_i0(beta * sqrt(1.0 - r * r)) / ref_bessel_i0(beta);
+		}
+		else
+		{
+			w = 0.0;
+			for(i=0;i<5;i++)
+			{
+				w += ((i & 1) ? -1.0 : 1.0) * coefs[type][i] * cos(6.283185307179586 * i * x);
+			}
+		}
+
+		pDst[n] = (float32_t)w;
+	}
+}
+
+void ref_window_info_f32(
+  float32_t * pWindow,
+  uint16_t length,
+  float32_t * pCoherentGain,
+  float32_t * pEnbw)
+{
+	double sum = 0.0, sumSq = 0.0;
+	uint32_t n;
+
+	for(n=0;n<length;n++)
+	{
+		sum += pWindow[n];
+		sumSq += (double)pWindow[n] * pWindow[n];
+	}
+
+	*pCoherentGain = (float32_t)(sum / length);
+	*pEnbw = (float32_t)(length * sumSq / (sum * sum));
+}
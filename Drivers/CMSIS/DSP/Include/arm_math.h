@@ -172,6 +172,8 @@
  * This set of functions provides a fast approximation to sine, cosine, and square root.
  * As compared to most of the other functions in the CMSIS math library, the fast math functions
  * operate on individual values and not arrays.
+ * Block versions of sine, cosine and square root, and block exponential, natural logarithm
+ * and four quadrant arctangent functions, process arrays without the per-sample call overhead.
  * There are separate functions for Q15, Q31, and floating-point data.
  *
  */
@@ -669,6 +671,81 @@ extern "C"
   }
 
 
+  /**
+   * @ingroup groupFastMath
+   */
+
+  /**
+   * @addtogroup divide
+   * @{
+   */
+
+  /**
+   * @brief  Count of the leading sign bits of a Q31 value.
+   * @param[in] x  input value
+   * @return number of bits after the sign bit that are equal to it, 0 to 31.
+   */
+  CMSIS_INLINE __STATIC_INLINE uint32_t arm_cls_q31(
+  q31_t x)
+  {
+    uint32_t y = (uint32_t) (x ^ (x >> 31));
+
+    return ((y == 0U) ? 31U : ((uint32_t) __CLZ(y) - 1U));
+  }
+
+
+  /**
+   * @brief  Count of the leading sign bits of a Q15 value.
+   * @param[in] x  input value
+   * @return number of bits after the sign bit that are equal to it, 0 to 15.
+   */
+  CMSIS_INLINE __STATIC_INLINE uint32_t arm_cls_q15(
+  q15_t x)
+  {
+    return (arm_cls_q31((q31_t) x) - 16U);
+  }
+
+
+  /**
+   * @brief  Normalization of a Q31 value.
+   * @param[in]  x     input value
+   * @param[out] pOut  points to x shifted left by its count of leading sign bits
+   * @return the left shift applied, x = *pOut * 2^-shift.
+   */
+  CMSIS_INLINE __STATIC_INLINE uint32_t arm_norm_q31(
+  q31_t x,
+  q31_t * pOut)
+  {
+    uint32_t shift = arm_cls_q31(x);
+
+    *pOut = (q31_t) ((uint32_t) x << shift);
+
+    return (shift);
+  }
+
+
+  /**
+   * @brief  Normalization of a Q15 value.
+   * @param[in]  x     input value
+   * @param[out] pOut  points to x shifted left by its count of leading sign bits
+   * @return the left shift applied, x = *pOut * 2^-shift.
+   */
+  CMSIS_INLINE __STATIC_INLINE uint32_t arm_norm_q15(
+  q15_t x,
+  q15_t * pOut)
+  {
+    uint32_t shift = arm_cls_q15(x);
+
+    *pOut = (q15_t) ((uint32_t) x << shift);
+
+    return (shift);
+  }
+
+  /**
+   * @} end of divide group
+   */
+
+
 /*
  * @brief C custom defined intrinsic function for M3 and M0 processors
  */
@@ -1815,6 +1892,722 @@ extern "C"
   arm_pid_instance_q15 * S);
 
 
+  /**
+   * @brief Instance structure for the floating-point extended PID Control.
+   */
+  typedef struct
+  {
+    float32_t Kp;          /**< The proportional gain. */
+    float32_t Ki;          /**< The integral gain, per sampling period. */
+    float32_t Kd;          /**< The derivative gain, per sampling period. */
+    float32_t alpha;       /**< The derivative low-pass coefficient in (0 1]. 1 disables the filter. */
+    float32_t outMin;      /**< The lower output limit. */
+    float32_t outMax;      /**< The upper output limit. */
+    float32_t integ;       /**< The integral term. */
+    float32_t deriv;       /**< The filtered input difference. */
+    float32_t xPrev;       /**< The previous input sample. */
+  } arm_pid_ext_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 extended PID Control.
+   */
+  typedef struct
+  {
+    q31_t Kp;              /**< The proportional gain. */
+    q31_t Ki;              /**< The integral gain, per sampling period. */
+    q31_t Kd;              /**< The derivative gain, per sampling period. */
+    q31_t alpha;           /**< The derivative low-pass coefficient in (0 1]. 0x7FFFFFFF disables the filter. */
+    uint8_t postShift;     /**< The additional shift, in bits, applied to the gains. */
+    q31_t outMin;          /**< The lower output limit. */
+    q31_t outMax;          /**< The upper output limit. */
+    q31_t integ;           /**< The integral term. */
+    q31_t deriv;           /**< The filtered input difference. */
+    q31_t xPrev;           /**< The previous input sample. */
+  } arm_pid_ext_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 extended PID Control.
+   */
+  typedef struct
+  {
+    q15_t Kp;              /**< The proportional gain. */
+    q15_t Ki;              /**< The integral gain, per sampling period. */
+    q15_t Kd;              /**< The derivative gain, per sampling period. */
+    q15_t alpha;           /**< The derivative low-pass coefficient in (0 1]. 0x7FFF disables the filter. */
+    uint8_t postShift;     /**< The additional shift, in bits, applied to the gains. */
+    q15_t outMin;          /**< The lower output limit. */
+    q15_t outMax;          /**< The upper output limit. */
+    q31_t integ;           /**< The integral term, in 1.31 format. */
+    q15_t deriv;           /**< The filtered input difference. */
+    q15_t xPrev;           /**< The previous input sample. */
+  } arm_pid_ext_instance_q15;
+
+
+  /**
+   * @brief  Initialization function for the floating-point extended PID Control.
+   * @param[out] S       points to an instance of the extended PID structure.
+   * @param[in]  Kp      proportional gain.
+   * @param[in]  Ki      integral gain, per sampling period.
+   * @param[in]  Kd      derivative gain, per sampling period.
+   * @param[in]  alpha   derivative low-pass coefficient in (0 1].
+   * @param[in]  outMin  lower output limit.
+   * @param[in]  outMax  upper output limit.
+   */
+  void arm_pid_ext_init_f32(
+  arm_pid_ext_instance_f32 * S,
+  float32_t Kp,
+  float32_t Ki,
+  float32_t Kd,
+  float32_t alpha,
+  float32_t outMin,
+  float32_t outMax);
+
+
+  /**
+   * @brief  Reset function for the floating-point extended PID Control.
+   * @param[in,out] S  points to an instance of the extended PID structure.
+   */
+  void arm_pid_ext_reset_f32(
+  arm_pid_ext_instance_f32 * S);
+
+
+  /**
+   * @brief  Bumpless gain change for the floating-point extended PID Control.
+   * @param[in,out] S   points to an instance of the extended PID structure.
+   * @param[in]     Kp  new proportional gain.
+   * @param[in]     Ki  new integral gain.
+   * @param[in]     Kd  new derivative gain.
+   */
+  void arm_pid_ext_set_gains_f32(
+  arm_pid_ext_instance_f32 * S,
+  float32_t Kp,
+  float32_t Ki,
+  float32_t Kd);
+
+
+  /**
+   * @brief  Steps several independent floating-point extended PID Controls.
+   * @param[in,out] S         points to an array of numLoops instances.
+   * @param[in]     pSrc      points to the input sample of each loop.
+   * @param[out]    pDst      points to the output sample of each loop.
+   * @param[in]     numLoops  number of loops.
+   */
+  void arm_pid_ext_batch_f32(
+  arm_pid_ext_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numLoops);
+
+
+  /**
+   * @brief  Initialization function for the Q31 extended PID Control.
+   * @param[out] S          points to an instance of the extended PID structure.
+   * @param[in]  Kp         proportional gain.
+   * @param[in]  Ki         integral gain, per sampling period.
+   * @param[in]  Kd         derivative gain, per sampling period.
+   * @param[in]  alpha      derivative low-pass coefficient in (0 1].
+   * @param[in]  postShift  shift applied to the gains.
+   * @param[in]  outMin     lower output limit.
+   * @param[in]  outMax     upper output limit.
+   */
+  void arm_pid_ext_init_q31(
+  arm_pid_ext_instance_q31 * S,
+  q31_t Kp,
+  q31_t Ki,
+  q31_t Kd,
+  q31_t alpha,
+  uint8_t postShift,
+  q31_t outMin,
+  q31_t outMax);
+
+
+  /**
+   * @brief  Reset function for the Q31 extended PID Control.
+   * @param[in,out] S  points to an instance of the extended PID structure.
+   */
+  void arm_pid_ext_reset_q31(
+  arm_pid_ext_instance_q31 * S);
+
+
+  /**
+   * @brief  Bumpless gain change for the Q31 extended PID Control.
+   * @param[in,out] S   points to an instance of the extended PID structure.
+   * @param[in]     Kp  new proportional gain.
+   * @param[in]     Ki  new integral gain.
+   * @param[in]     Kd  new derivative gain.
+   */
+  void arm_pid_ext_set_gains_q31(
+  arm_pid_ext_instance_q31 * S,
+  q31_t Kp,
+  q31_t Ki,
+  q31_t Kd);
+
+
+  /**
+   * @brief  Steps several independent Q31 extended PID Controls.
+   * @param[in,out] S         points to an array of numLoops instances.
+   * @param[in]     pSrc      points to the input sample of each loop.
+   * @param[out]    pDst      points to the output sample of each loop.
+   * @param[in]     numLoops  number of loops.
+   */
+  void arm_pid_ext_batch_q31(
+  arm_pid_ext_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numLoops);
+
+
+  /**
+   * @brief  Initialization function for the Q15 extended PID Control.
+   * @param[out] S          points to an instance of the extended PID structure.
+   * @param[in]  Kp         proportional gain.
+   * @param[in]  Ki         integral gain, per sampling period.
+   * @param[in]  Kd         derivative gain, per sampling period.
+   * @param[in]  alpha      derivative low-pass coefficient in (0 1].
+   * @param[in]  postShift  shift applied to the gains.
+   * @param[in]  outMin     lower output limit.
+   * @param[in]  outMax     upper output limit.
+   */
+  void arm_pid_ext_init_q15(
+  arm_pid_ext_instance_q15 * S,
+  q15_t Kp,
+  q15_t Ki,
+  q15_t Kd,
+  q15_t alpha,
+  uint8_t postShift,
+  q15_t outMin,
+  q15_t outMax);
+
+
+  /**
+   * @brief  Reset function for the Q15 extended PID Control.
+   * @param[in,out] S  points to an instance of the extended PID structure.
+   */
+  void arm_pid_ext_reset_q15(
+  arm_pid_ext_instance_q15 * S);
+
+
+  /**
+   * @brief  Bumpless gain change for the Q15 extended PID Control.
+   * @param[in,out] S   points to an instance of the extended PID structure.
+   * @param[in]     Kp  new proportional gain.
+   * @param[in]     Ki  new integral gain.
+   * @param[in]     Kd  new derivative gain.
+   */
+  void arm_pid_ext_set_gains_q15(
+  arm_pid_ext_instance_q15 * S,
+  q15_t Kp,
+  q15_t Ki,
+  q15_t Kd);
+
+
+  /**
+   * @brief  Steps several independent Q15 extended PID Controls.
+   * @param[in,out] S         points to an array of numLoops instances.
+   * @param[in]     pSrc      points to the input sample of each loop.
+   * @param[out]    pDst      points to the output sample of each loop.
+   * @param[in]     numLoops  number of loops.
+   */
+  void arm_pid_ext_batch_q15(
+  arm_pid_ext_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numLoops);
+
+
+  /**
+   * @brief Instance structure for the Q31 2P2Z and 3P3Z compensators.
+   */
+  typedef struct
+  {
+    q31_t coeffs[7];       /**< The coefficients {b0, b1, b2, b3, a1, a2, a3}. b3 and a3 are not used by the 2P2Z compensator. */
+    q31_t state[6];        /**< The state {x[n-1], x[n-2], x[n-3], y[n-1], y[n-2], y[n-3]}. */
+    q31_t outMin;          /**< The lower output limit. */
+    q31_t outMax;          /**< The upper output limit. */
+    uint8_t postShift;     /**< The additional shift, in bits, applied to the coefficients. */
+  } arm_comp_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 2P2Z and 3P3Z compensators.
+   */
+  typedef struct
+  {
+    q15_t coeffs[7];       /**< The coefficients {b0, b1, b2, b3, a1, a2, a3}. b3 and a3 are not used by the 2P2Z compensator. */
+    q15_t state[6];        /**< The state {x[n-1], x[n-2], x[n-3], y[n-1], y[n-2], y[n-3]}. */
+    q15_t outMin;          /**< The lower output limit. */
+    q15_t outMax;          /**< The upper output limit. */
+    uint8_t postShift;     /**< The additional shift, in bits, applied to the coefficients. */
+  } arm_comp_instance_q15;
+
+
+  /**
+   * @brief  Computes the coefficients of a 2P2Z or 3P3Z compensator from its poles and zeros.
+   * @param[in]  order    compensator order, 2 or 3.
+   * @param[in]  gain     integrator gain, in rad/s.
+   * @param[in]  pZeros   points to the order - 1 zero frequencies, in Hz.
+   * @param[in]  pPoles   points to the order - 1 pole frequencies, in Hz.
+   * @param[in]  fs       sampling frequency, in Hz.
+   * @param[out] pCoeffs  points to the 2 * order + 1 coefficients {b0, .., b[order], a1, .., a[order]}.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the order or a frequency is not valid.
+   */
+  arm_status arm_comp_design_f32(
+  uint32_t order,
+  float32_t gain,
+  const float32_t * pZeros,
+  const float32_t * pPoles,
+  float32_t fs,
+  float32_t * pCoeffs);
+
+
+  /**
+   * @brief  Initialization function for the Q31 compensators.
+   * @param[out] S          points to an instance of the compensator structure.
+   * @param[in]  order      compensator order, 2 or 3.
+   * @param[in]  pCoeffs    points to the 2 * order + 1 coefficients {b0, .., b[order], a1, .., a[order]}.
+   * @param[in]  postShift  shift applied to the coefficients.
+   * @param[in]  outMin     lower output limit.
+   * @param[in]  outMax     upper output limit.
+   */
+  void arm_comp_init_q31(
+  arm_comp_instance_q31 * S,
+  uint32_t order,
+  const q31_t * pCoeffs,
+  uint8_t postShift,
+  q31_t outMin,
+  q31_t outMax);
+
+
+  /**
+   * @brief  Reset function for the Q31 compensators.
+   * @param[in,out] S  points to an instance of the compensator structure.
+   */
+  void arm_comp_reset_q31(
+  arm_comp_instance_q31 * S);
+
+
+  /**
+   * @brief  Initialization function for the Q15 compensators.
+   * @param[out] S          points to an instance of the compensator structure.
+   * @param[in]  order      compensator order, 2 or 3.
+   * @param[in]  pCoeffs    points to the 2 * order + 1 coefficients {b0, .., b[order], a1, .., a[order]}.
+   * @param[in]  postShift  shift applied to the coefficients.
+   * @param[in]  outMin     lower output limit.
+   * @param[in]  outMax     upper output limit.
+   */
+  void arm_comp_init_q15(
+  arm_comp_instance_q15 * S,
+  uint32_t order,
+  const q15_t * pCoeffs,
+  uint8_t postShift,
+  q15_t outMin,
+  q15_t outMax);
+
+
+  /**
+   * @brief  Reset function for the Q15 compensators.
+   * @param[in,out] S  points to an instance of the compensator structure.
+   */
+  void arm_comp_reset_q15(
+  arm_comp_instance_q15 * S);
+
+
+  /**
+   * @brief Instance structure for the floating-point field oriented control step.
+   */
+  typedef struct
+  {
+    float32_t KpD;         /**< The proportional gain of the d axis current loop. */
+    float32_t KiD;         /**< The integral gain of the d axis current loop, per sampling period. */
+    float32_t KpQ;         /**< The proportional gain of the q axis current loop. */
+    float32_t KiQ;         /**< The integral gain of the q axis current loop, per sampling period. */
+    float32_t vLimit;      /**< The limit of the magnitude of each axis voltage. */
+    float32_t invBus;      /**< The inverse of the DC bus voltage. */
+    float32_t integD;      /**< The integrator of the d axis current loop. */
+    float32_t integQ;      /**< The integrator of the q axis current loop. */
+    float32_t Id;          /**< The last measured d axis current. */
+    float32_t Iq;          /**< The last measured q axis current. */
+    float32_t Vd;          /**< The last d axis voltage command. */
+    float32_t Vq;          /**< The last q axis voltage command. */
+  } arm_foc_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 field oriented control step.
+   */
+  typedef struct
+  {
+    q31_t KpD;             /**< The proportional gain of the d axis current loop, scaled by 2^-postShift. */
+    q31_t KiD;             /**< The integral gain of the d axis current loop, scaled by 2^-postShift. */
+    q31_t KpQ;             /**< The proportional gain of the q axis current loop, scaled by 2^-postShift. */
+    q31_t KiQ;             /**< The integral gain of the q axis current loop, scaled by 2^-postShift. */
+    uint8_t postShift;     /**< The left shift applied to the gain products. */
+    q31_t vLimit;          /**< The limit of the magnitude of each axis voltage, relative to the DC bus voltage. */
+    q31_t integD;          /**< The integrator of the d axis current loop. */
+    q31_t integQ;          /**< The integrator of the q axis current loop. */
+    q31_t Id;              /**< The last measured d axis current. */
+    q31_t Iq;              /**< The last measured q axis current. */
+    q31_t Vd;              /**< The last d axis voltage command. */
+    q31_t Vq;              /**< The last q axis voltage command. */
+  } arm_foc_instance_q31;
+
+
+  /**
+   * @brief  Initialization function for the floating-point field oriented control step.
+   * @param[in,out] S       points to an instance of the floating-point FOC structure.
+   * @param[in]     Kp      proportional gain of both current loops.
+   * @param[in]     Ki      integral gain of both current loops, per sampling period.
+   * @param[in]     vLimit  limit of the magnitude of each axis voltage.
+   * @param[in]     vBus    DC bus voltage.
+   */
+  void arm_foc_init_f32(
+  arm_foc_instance_f32 * S,
+  float32_t Kp,
+  float32_t Ki,
+  float32_t vLimit,
+  float32_t vBus);
+
+
+  /**
+   * @brief  Reset function for the floating-point field oriented control step.
+   * @param[in,out] S  points to an instance of the floating-point FOC structure.
+   */
+  void arm_foc_reset_f32(
+  arm_foc_instance_f32 * S);
+
+
+  /**
+   * @brief  Floating-point field oriented control step.
+   * @param[in,out] S      points to an instance of the floating-point FOC structure.
+   * @param[in]     Ia     phase a current.
+   * @param[in]     Ib     phase b current.
+   * @param[in]     theta  electrical rotor angle in radians.
+   * @param[in]     IdRef  d axis current reference.
+   * @param[in]     IqRef  q axis current reference.
+   * @param[out]    pDuty  points to the three duty cycles, in [0 1].
+   */
+  void arm_foc_f32(
+  arm_foc_instance_f32 * S,
+  float32_t Ia,
+  float32_t Ib,
+  float32_t theta,
+  float32_t IdRef,
+  float32_t IqRef,
+  float32_t * pDuty);
+
+
+  /**
+   * @brief  Initialization function for the Q31 field oriented control step.
+   * @param[in,out] S          points to an instance of the Q31 FOC structure.
+   * @param[in]     Kp         proportional gain of both current loops, scaled by 2^-postShift.
+   * @param[in]     Ki         integral gain of both current loops, scaled by 2^-postShift.
+   * @param[in]     postShift  left shift applied to the gain products.
+   * @param[in]     vLimit     limit of the magnitude of each axis voltage, relative to the DC bus voltage.
+   */
+  void arm_foc_init_q31(
+  arm_foc_instance_q31 * S,
+  q31_t Kp,
+  q31_t Ki,
+  uint8_t postShift,
+  q31_t vLimit);
+
+
+  /**
+   * @brief  Reset function for the Q31 field oriented control step.
+   * @param[in,out] S  points to an instance of the Q31 FOC structure.
+   */
+  void arm_foc_reset_q31(
+  arm_foc_instance_q31 * S);
+
+
+  /**
+   * @brief  Q31 field oriented control step.
+   * @param[in,out] S      points to an instance of the Q31 FOC structure.
+   * @param[in]     Ia     phase a current.
+   * @param[in]     Ib     phase b current.
+   * @param[in]     theta  scaled electrical rotor angle, [-1 1) maps to [-pi pi).
+   * @param[in]     IdRef  d axis current reference.
+   * @param[in]     IqRef  q axis current reference.
+   * @param[out]    pDuty  points to the three duty cycles, in [0 1).
+   */
+  void arm_foc_q31(
+  arm_foc_instance_q31 * S,
+  q31_t Ia,
+  q31_t Ib,
+  q31_t theta,
+  q31_t IdRef,
+  q31_t IqRef,
+  q31_t * pDuty);
+
+
+  /**
+   * @brief Instance structure for the floating-point grid synchronization PLL.
+   */
+  typedef struct
+  {
+    float32_t Kp;          /**< The proportional gain, in radians per sample per unit of q axis voltage. */
+    float32_t Ki;          /**< The integral gain, in radians per sample squared per unit of q axis voltage. */
+    float32_t sogiGain;    /**< The damping gain k of the second order generalized integrator. */
+    float32_t omegaNom;    /**< The nominal angular frequency, in radians per sample. */
+    float32_t toHz;        /**< The sampling rate divided by 2 pi. */
+    float32_t integ;       /**< The frequency integrator, deviation from omegaNom in radians per sample. */
+    float32_t theta;       /**< The angle of the next sample, in [-pi pi). */
+    float32_t sogiA;       /**< The in-phase state of the generalized integrator. */
+    float32_t sogiB;       /**< The quadrature state of the generalized integrator. */
+    float32_t freq;        /**< The estimated grid frequency, in Hz. */
+    float32_t phase;       /**< The estimated phase of the last sample, in [-pi pi). */
+    float32_t amplitude;   /**< The d axis voltage, amplitude of the fundamental when locked. */
+    float32_t sinPhase;    /**< The sine of phase. */
+    float32_t cosPhase;    /**< The cosine of phase. */
+  } arm_pll_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 grid synchronization PLL.
+   */
+  typedef struct
+  {
+    q31_t Kp;              /**< The proportional gain, in units of pi radians per sample per full scale voltage. */
+    q31_t Ki;              /**< The integral gain, in units of pi radians per sample squared per full scale voltage. */
+    q31_t sogiGain;        /**< The damping gain k of the second order generalized integrator, divided by 2. */
+    q31_t omegaNom;        /**< The nominal frequency, relative to half the sampling rate. */
+    q63_t integ;           /**< The frequency integrator, deviation from omegaNom in 2.62 format. */
+    q31_t theta;           /**< The scaled angle of the next sample, [-1 1) maps to [-pi pi). */
+    q31_t sogiA;           /**< The in-phase state of the generalized integrator. */
+    q31_t sogiB;           /**< The quadrature state of the generalized integrator. */
+    q31_t freq;            /**< The estimated grid frequency, relative to half the sampling rate. */
+    q31_t phase;           /**< The scaled estimated phase of the last sample. */
+    q31_t amplitude;       /**< The d axis voltage, amplitude of the fundamental when locked. */
+    q31_t sinPhase;        /**< The sine of phase. */
+    q31_t cosPhase;        /**< The cosine of phase. */
+  } arm_pll_instance_q31;
+
+
+  /**
+   * @brief  Initialization function for the floating-point grid synchronization PLL.
+   * @param[in,out] S            points to an instance of the floating-point PLL structure.
+   * @param[in]     sampleRate   sampling rate, in Hz.
+   * @param[in]     nominalFreq  nominal grid frequency, in Hz.
+   * @param[in]     Kp           proportional gain, in rad/s per unit of q axis voltage.
+   * @param[in]     Ki           integral gain, in rad/s^2 per unit of q axis voltage.
+   * @param[in]     sogiGain     damping gain of the generalized integrator, only used by arm_pll_sogi_f32().
+   */
+  void arm_pll_init_f32(
+  arm_pll_instance_f32 * S,
+  float32_t sampleRate,
+  float32_t nominalFreq,
+  float32_t Kp,
+  float32_t Ki,
+  float32_t sogiGain);
+
+
+  /**
+   * @brief  Reset function for the floating-point grid synchronization PLL.
+   * @param[in,out] S  points to an instance of the floating-point PLL structure.
+   */
+  void arm_pll_reset_f32(
+  arm_pll_instance_f32 * S);
+
+
+  /**
+   * @brief  Floating-point single-phase SOGI PLL step.
+   * @param[in,out] S  points to an instance of the floating-point PLL structure.
+   * @param[in]     v  grid voltage sample.
+   */
+  void arm_pll_sogi_f32(
+  arm_pll_instance_f32 * S,
+  float32_t v);
+
+
+  /**
+   * @brief  Floating-point three-phase SRF PLL step.
+   * @param[in,out] S   points to an instance of the floating-point PLL structure.
+   * @param[in]     va  phase a voltage sample.
+   * @param[in]     vb  phase b voltage sample.
+   * @param[in]     vc  phase c voltage sample.
+   */
+  void arm_pll_srf_f32(
+  arm_pll_instance_f32 * S,
+  float32_t va,
+  float32_t vb,
+  float32_t vc);
+
+
+  /**
+   * @brief  Initialization function for the Q31 grid synchronization PLL.
+   * @param[in,out] S            points to an instance of the Q31 PLL structure.
+   * @param[in]     nominalFreq  nominal grid frequency, relative to half the sampling rate.
+   * @param[in]     Kp           proportional gain, in pi radians per sample per full scale voltage.
+   * @param[in]     Ki           integral gain, in pi radians per sample squared per full scale voltage.
+   * @param[in]     sogiGain     damping gain of the generalized integrator divided by 2, only used by arm_pll_sogi_q31().
+   */
+  void arm_pll_init_q31(
+  arm_pll_instance_q31 * S,
+  q31_t nominalFreq,
+  q31_t Kp,
+  q31_t Ki,
+  q31_t sogiGain);
+
+
+  /**
+   * @brief  Reset function for the Q31 grid synchronization PLL.
+   * @param[in,out] S  points to an instance of the Q31 PLL structure.
+   */
+  void arm_pll_reset_q31(
+  arm_pll_instance_q31 * S);
+
+
+  /**
+   * @brief  Q31 single-phase SOGI PLL step.
+   * @param[in,out] S  points to an instance of the Q31 PLL structure.
+   * @param[in]     v  grid voltage sample.
+   */
+  void arm_pll_sogi_q31(
+  arm_pll_instance_q31 * S,
+  q31_t v);
+
+
+  /**
+   * @brief  Q31 three-phase SRF PLL step.
+   * @param[in,out] S   points to an instance of the Q31 PLL structure.
+   * @param[in]     va  phase a voltage sample.
+   * @param[in]     vb  phase b voltage sample.
+   * @param[in]     vc  phase c voltage sample.
+   */
+  void arm_pll_srf_q31(
+  arm_pll_instance_q31 * S,
+  q31_t va,
+  q31_t vb,
+  q31_t vc);
+
+
+  /**
+   * @brief State transition callback of the extended Kalman filter.
+   * @param[in]  pContext  user data given to arm_kalman_predict_ext_f32()
+   * @param[in]  pState    points to the state, numStates values
+   * @param[out] pNext     points to the predicted state, numStates values
+   * @param[out] pF        points to the Jacobian of the transition at pState, numStates x numStates values
+   */
+  typedef void (*arm_kalman_transition_f32)(
+  void * pContext,
+  const float32_t * pState,
+  float32_t * pNext,
+  float32_t * pF);
+
+  /**
+   * @brief Measurement callback of the extended Kalman filter.
+   * @param[in]  pContext  user data given to arm_kalman_update_ext_f32()
+   * @param[in]  pState    points to the state, numStates values
+   * @param[out] pMeas     points to the predicted measurement, numMeas values
+   * @param[out] pH        points to the Jacobian of the measurement at pState, numMeas x numStates values
+   */
+  typedef void (*arm_kalman_measurement_f32)(
+  void * pContext,
+  const float32_t * pState,
+  float32_t * pMeas,
+  float32_t * pH);
+
+  /**
+   * @brief Instance structure for the floating-point Kalman filter.
+   */
+  typedef struct
+  {
+    uint16_t numStates;    /**< number of states n. */
+    uint16_t numMeas;      /**< number of measurements m. */
+    uint16_t numInputs;    /**< number of control inputs p, 0 without control input. */
+    float32_t *pState;     /**< points to the state estimate, n values. */
+    float32_t *pCov;       /**< points to the covariance of the estimate, n x n values. */
+    float32_t *pF;         /**< points to the state transition matrix, n x n values. */
+    const float32_t *pB;   /**< points to the control input matrix, n x p values, or NULL. */
+    float32_t *pH;         /**< points to the measurement matrix, m x n values. */
+    const float32_t *pQ;   /**< points to the process noise covariance, n x n values. */
+    const float32_t *pR;   /**< points to the measurement noise covariance, m x m values. */
+    float32_t *pWork;      /**< points to the workspace, ARM_KALMAN_WORK_SIZE(n, m) values. */
+  } arm_kalman_instance_f32;
+
+/**
+ * @brief Size of the workspace of the Kalman filter for n states and m measurements.
+ */
+#define ARM_KALMAN_WORK_SIZE(n, m) \
+  ((((n) * ((n) + 1)) > ((m) * ((n) + (m) + 1))) ? ((n) * ((n) + 1)) : ((m) * ((n) + (m) + 1)))
+
+
+  /**
+   * @brief  Initialization function for the floating-point Kalman filter.
+   * @param[out] S          points to an instance of the floating-point Kalman filter structure.
+   * @param[in]  numStates  number of states n.
+   * @param[in]  numMeas    number of measurements m.
+   * @param[in]  numInputs  number of control inputs p.
+   * @param[in]  pState     points to the initial state, n values.
+   * @param[in]  pCov       points to the initial covariance, n x n values, symmetric.
+   * @param[in]  pF         points to the state transition matrix, n x n values.
+   * @param[in]  pB         points to the control input matrix, n x p values, or NULL.
+   * @param[in]  pH         points to the measurement matrix, m x n values.
+   * @param[in]  pQ         points to the process noise covariance, n x n values.
+   * @param[in]  pR         points to the measurement noise covariance, m x m values.
+   * @param[in]  pWork      points to the workspace, ARM_KALMAN_WORK_SIZE(n, m) values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if n or m is zero.
+   */
+  arm_status arm_kalman_init_f32(
+  arm_kalman_instance_f32 * S,
+  uint16_t numStates,
+  uint16_t numMeas,
+  uint16_t numInputs,
+  float32_t * pState,
+  float32_t * pCov,
+  float32_t * pF,
+  const float32_t * pB,
+  float32_t * pH,
+  const float32_t * pQ,
+  const float32_t * pR,
+  float32_t * pWork);
+
+
+  /**
+   * @brief  Prediction step of the floating-point Kalman filter.
+   * @param[in,out] S   points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     pU  points to the control input, p values, or NULL.
+   */
+  void arm_kalman_predict_f32(
+  arm_kalman_instance_f32 * S,
+  const float32_t * pU);
+
+
+  /**
+   * @brief  Measurement update of the floating-point Kalman filter.
+   * @param[in,out] S   points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     pZ  points to the measurement, m values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_SINGULAR if the innovation covariance is not positive definite.
+   */
+  arm_status arm_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  const float32_t * pZ);
+
+
+  /**
+   * @brief  Prediction step of the floating-point extended Kalman filter.
+   * @param[in,out] S         points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     pFunc     state transition callback, which also writes the Jacobian into pF.
+   * @param[in]     pContext  user data passed to the callback.
+   */
+  void arm_kalman_predict_ext_f32(
+  arm_kalman_instance_f32 * S,
+  arm_kalman_transition_f32 pFunc,
+  void * pContext);
+
+
+  /**
+   * @brief  Measurement update of the floating-point extended Kalman filter.
+   * @param[in,out] S         points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     pFunc     measurement callback, which also writes the Jacobian into pH.
+   * @param[in]     pContext  user data passed to the callback.
+   * @param[in]     pZ        points to the measurement, m values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_SINGULAR if the innovation covariance is not positive definite.
+   */
+  arm_status arm_kalman_update_ext_f32(
+  arm_kalman_instance_f32 * S,
+  arm_kalman_measurement_f32 pFunc,
+  void * pContext,
+  const float32_t * pZ);
+
+
   /**
    * @brief Instance structure for the floating-point Linear Interpolate function.
    */
@@ -2229,6 +3022,484 @@ void arm_rfft_fast_f32(
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+  /**
+   * @brief Window functions.
+   */
+  typedef enum
+  {
+    ARM_WINDOW_RECTANGULAR = 0,          /**< rectangular window, no weighting */
+    ARM_WINDOW_HANN = 1,                 /**< Hann window */
+    ARM_WINDOW_HAMMING = 2,              /**< Hamming window */
+    ARM_WINDOW_BLACKMAN_HARRIS = 3,      /**< 4-term Blackman-Harris window */
+    ARM_WINDOW_FLAT_TOP = 4,             /**< 5-term flat top window */
+    ARM_WINDOW_KAISER = 5                /**< Kaiser window, shape set by beta */
+  } arm_window_type;
+
+  /**
+   * @brief Interpolation methods of the spectral peak detector.
+   */
+  typedef enum
+  {
+    ARM_PEAK_INTERP_PARABOLIC = 0,       /**< parabola through the magnitudes of three bins */
+    ARM_PEAK_INTERP_JACOBSEN = 1,        /**< Jacobsen estimator on three complex bins */
+    ARM_PEAK_INTERP_QUINN = 2            /**< Quinn second estimator on three complex bins */
+  } arm_peak_interp;
+
+  /**
+   * @brief Instance structure for the floating-point spectral peak detector.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                    /**< number of bins of the spectrum. */
+    arm_peak_interp method;              /**< interpolation method. */
+    float32_t threshold;                 /**< minimum magnitude of a peak. */
+    const float32_t *pFreqCoeffs;        /**< points to the coefficients of the frequency correction. */
+    const float32_t *pAmpCoeffs;         /**< points to the coefficients of the amplitude correction. */
+  } arm_spectral_peaks_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point spectral peak detector.
+   * @param[in,out] S          points to an instance of the floating-point spectral peak detector structure.
+   * @param[in]     numBins    number of bins of the spectrum, at least 3.
+   * @param[in]     method     interpolation method.
+   * @param[in]     window     window applied to the data before the FFT.
+   * @param[in]     padFactor  FFT length divided by the number of data samples: 1, 2, 4 or 8.
+   * @param[in]     threshold  minimum magnitude of a peak.
+   * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+   * the combination of <code>method</code>, <code>window</code> and <code>padFactor</code> is not supported.
+   */
+  arm_status arm_spectral_peaks_init_f32(
+  arm_spectral_peaks_instance_f32 * S,
+  uint16_t numBins,
+  arm_peak_interp method,
+  arm_window_type window,
+  uint16_t padFactor,
+  float32_t threshold);
+
+  /**
+   * @brief  Finds and interpolates the highest peaks of a floating-point spectrum.
+   * @param[in]  S         points to an instance of the floating-point spectral peak detector structure.
+   * @param[in]  pSpectrum points to the complex spectrum, numBins complex values. Not used by the parabolic method.
+   * @param[in]  pMag      points to the magnitudes of the spectrum, numBins values.
+   * @param[in]  maxPeaks  maximum number of peaks.
+   * @param[out] pFreq     points to the frequencies of the peaks, in bins.
+   * @param[out] pAmp      points to the amplitudes of the peaks.
+   * @return number of peaks found.
+   */
+  uint32_t arm_spectral_peaks_f32(
+  const arm_spectral_peaks_instance_f32 * S,
+  float32_t * pSpectrum,
+  float32_t * pMag,
+  uint32_t maxPeaks,
+  float32_t * pFreq,
+  float32_t * pAmp);
+
+  /**
+   * @brief Instance structure for the floating-point window.
+   */
+  typedef struct
+  {
+    uint16_t length;                     /**< length of the window. */
+    uint16_t halfLength;                 /**< number of stored coefficients. */
+    uint8_t periodic;                    /**< 1 for a periodic window, 0 for a symmetric window. */
+    const float32_t *pCoeffs;            /**< points to the first halfLength coefficients of the window. */
+    float32_t coherentGain;              /**< mean of the coefficients. */
+    float32_t enbw;                      /**< equivalent noise bandwidth, in bins. */
+  } arm_window_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 window.
+   */
+  typedef struct
+  {
+    uint16_t length;                     /**< length of the window. */
+    uint16_t halfLength;                 /**< number of stored coefficients. */
+    uint8_t periodic;                    /**< 1 for a periodic window, 0 for a symmetric window. */
+    const q31_t *pCoeffs;                /**< points to the first halfLength coefficients of the window. */
+    float32_t coherentGain;              /**< mean of the coefficients. */
+    float32_t enbw;                      /**< equivalent noise bandwidth, in bins. */
+  } arm_window_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 window.
+   */
+  typedef struct
+  {
+    uint16_t length;                     /**< length of the window. */
+    uint16_t halfLength;                 /**< number of stored coefficients. */
+    uint8_t periodic;                    /**< 1 for a periodic window, 0 for a symmetric window. */
+    const q15_t *pCoeffs;                /**< points to the first halfLength coefficients of the window. */
+    float32_t coherentGain;              /**< mean of the coefficients. */
+    float32_t enbw;                      /**< equivalent noise bandwidth, in bins. */
+  } arm_window_instance_q15;
+
+  /**
+   * @brief  Value of a window function.
+   * @param[in] type  window function.
+   * @param[in] beta  shape parameter of the Kaiser window, ignored by the other windows.
+   * @param[in] x     position in the window, from 0 to 1.
+   * @return value of the window at x.
+   */
+  float32_t arm_window_value_f32(
+  arm_window_type type,
+  float32_t beta,
+  float32_t x);
+
+  /**
+   * @brief  Computes the first half of a floating-point window.
+   * @param[in]  type      window function.
+   * @param[in]  beta      shape parameter of the Kaiser window, ignored by the other windows.
+   * @param[in]  length    length of the window, at least 2.
+   * @param[in]  periodic  1 for a periodic window, 0 for a symmetric window.
+   * @param[out] pCoeffs   points to the coefficients, length / 2 + 1 values when periodic, (length + 1) / 2 otherwise.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_window_generate_f32(
+  arm_window_type type,
+  float32_t beta,
+  uint16_t length,
+  uint8_t periodic,
+  float32_t * pCoeffs);
+
+  /**
+   * @brief  Computes the first half of a Q31 window.
+   * @param[in]  type      window function.
+   * @param[in]  beta      shape parameter of the Kaiser window, ignored by the other windows.
+   * @param[in]  length    length of the window, at least 2.
+   * @param[in]  periodic  1 for a periodic window, 0 for a symmetric window.
+   * @param[out] pCoeffs   points to the coefficients, length / 2 + 1 values when periodic, (length + 1) / 2 otherwise.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_window_generate_q31(
+  arm_window_type type,
+  float32_t beta,
+  uint16_t length,
+  uint8_t periodic,
+  q31_t * pCoeffs);
+
+  /**
+   * @brief  Computes the first half of a Q15 window.
+   * @param[in]  type      window function.
+   * @param[in]  beta      shape parameter of the Kaiser window, ignored by the other windows.
+   * @param[in]  length    length of the window, at least 2.
+   * @param[in]  periodic  1 for a periodic window, 0 for a symmetric window.
+   * @param[out] pCoeffs   points to the coefficients, length / 2 + 1 values when periodic, (length + 1) / 2 otherwise.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_window_generate_q15(
+  arm_window_type type,
+  float32_t beta,
+  uint16_t length,
+  uint8_t periodic,
+  q15_t * pCoeffs);
+
+  /**
+   * @brief  Initialization function for the floating-point window.
+   * @param[in,out] S         points to an instance of the floating-point window structure.
+   * @param[in]     length    length of the window, at least 2.
+   * @param[in]     periodic  1 for a periodic window, 0 for a symmetric window.
+   * @param[in]     pCoeffs   points to the first half of the window.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_window_init_f32(
+  arm_window_instance_f32 * S,
+  uint16_t length,
+  uint8_t periodic,
+  const float32_t * pCoeffs);
+
+  /**
+   * @brief  Initialization function for the Q31 window.
+   * @param[in,out] S         points to an instance of the Q31 window structure.
+   * @param[in]     length    length of the window, at least 2.
+   * @param[in]     periodic  1 for a periodic window, 0 for a symmetric window.
+   * @param[in]     pCoeffs   points to the first half of the window.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_window_init_q31(
+  arm_window_instance_q31 * S,
+  uint16_t length,
+  uint8_t periodic,
+  const q31_t * pCoeffs);
+
+  /**
+   * @brief  Initialization function for the Q15 window.
+   * @param[in,out] S         points to an instance of the Q15 window structure.
+   * @param[in]     length    length of the window, at least 2.
+   * @param[in]     periodic  1 for a periodic window, 0 for a symmetric window.
+   * @param[in]     pCoeffs   points to the first half of the window.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_window_init_q15(
+  arm_window_instance_q15 * S,
+  uint16_t length,
+  uint8_t periodic,
+  const q15_t * pCoeffs);
+
+  /**
+   * @brief  Multiplies a floating-point frame by a window.
+   * @param[in]  S     points to an instance of the floating-point window structure.
+   * @param[in]  pSrc  points to the input frame, S->length values.
+   * @param[out] pDst  points to the output frame, S->length values.
+   */
+  void arm_window_apply_f32(
+  const arm_window_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst);
+
+  /**
+   * @brief  Multiplies a Q31 frame by a window.
+   * @param[in]  S     points to an instance of the Q31 window structure.
+   * @param[in]  pSrc  points to the input frame, S->length values.
+   * @param[out] pDst  points to the output frame, S->length values.
+   */
+  void arm_window_apply_q31(
+  const arm_window_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst);
+
+  /**
+   * @brief  Multiplies a Q15 frame by a window.
+   * @param[in]  S     points to an instance of the Q15 window structure.
+   * @param[in]  pSrc  points to the input frame, S->length values.
+   * @param[out] pDst  points to the output frame, S->length values.
+   */
+  void arm_window_apply_q15(
+  const arm_window_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst);
+
+  /**
+   * @brief  Multiplies a Q15 frame by a floating-point window and converts it to floating-point.
+   * @param[in]  S     points to an instance of the floating-point window structure.
+   * @param[in]  pSrc  points to the input frame, S->length values.
+   * @param[out] pDst  points to the output frame, S->length values, in the input format of arm_rfft_fast_f32().
+   */
+  void arm_window_q15_to_f32(
+  const arm_window_instance_f32 * S,
+  q15_t * pSrc,
+  float32_t * pDst);
+
+  /**
+   * @brief  Multiplies a real Q15 frame by a window and converts it to complex.
+   * @param[in]  S     points to an instance of the Q15 window structure.
+   * @param[in]  pSrc  points to the input frame, S->length values.
+   * @param[out] pDst  points to the output frame, 2 * S->length values, in the input format of arm_cfft_q15().
+   */
+  void arm_window_q15_to_cmplx_q15(
+  const arm_window_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point Hilbert transformer.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;                    /**< number of taps of the filter, 4 * M - 1. */
+    float32_t *pState;                   /**< points to the state array, of length numTaps + blockSize - 1. */
+    const float32_t *pCoeffs;            /**< points to the (numTaps + 1) / 4 nonzero coefficients h[1], h[3], ... */
+  } arm_hilbert_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 Hilbert transformer.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;                    /**< number of taps of the filter, 4 * M - 1. */
+    q15_t *pState;                       /**< points to the state array, of length numTaps + blockSize - 1. */
+    const q15_t *pCoeffs;                /**< points to the (numTaps + 1) / 4 nonzero coefficients h[1], h[3], ... */
+  } arm_hilbert_instance_q15;
+
+  /**
+   * @brief  Computes the nonzero coefficients of a windowed Hilbert transformer.
+   * @param[in]  numTaps  number of taps of the filter, 4 * M - 1 with M >= 1.
+   * @param[in]  window   window function applied to the ideal response.
+   * @param[in]  beta     shape parameter of the Kaiser window, ignored by the other windows.
+   * @param[out] pCoeffs  points to the (numTaps + 1) / 4 coefficients.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if numTaps is not of the form 4 * M - 1.
+   */
+  arm_status arm_hilbert_design_f32(
+  uint16_t numTaps,
+  arm_window_type window,
+  float32_t beta,
+  float32_t * pCoeffs);
+
+  /**
+   * @brief  Initialization function for the floating-point Hilbert transformer.
+   * @param[out] S          points to an instance of the floating-point Hilbert transformer structure.
+   * @param[in]  numTaps    number of taps of the filter, 4 * M - 1 with M >= 1.
+   * @param[in]  pCoeffs    points to the (numTaps + 1) / 4 nonzero coefficients.
+   * @param[in]  pState     points to the state buffer, numTaps + blockSize - 1 values.
+   * @param[in]  blockSize  number of input samples processed per call.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if numTaps is not of the form 4 * M - 1.
+   */
+  arm_status arm_hilbert_init_f32(
+  arm_hilbert_instance_f32 * S,
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 Hilbert transformer.
+   * @param[out] S          points to an instance of the Q15 Hilbert transformer structure.
+   * @param[in]  numTaps    number of taps of the filter, 4 * M - 1 with M >= 1.
+   * @param[in]  pCoeffs    points to the (numTaps + 1) / 4 nonzero coefficients.
+   * @param[in]  pState     points to the state buffer, numTaps + blockSize - 1 values.
+   * @param[in]  blockSize  number of input samples processed per call.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if numTaps is not of the form 4 * M - 1.
+   */
+  arm_status arm_hilbert_init_q15(
+  arm_hilbert_instance_q15 * S,
+  uint16_t numTaps,
+  const q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the floating-point Hilbert transformer.
+   * @param[in]  S          points to an instance of the floating-point Hilbert transformer structure.
+   * @param[in]  pSrc       points to the block of real input data.
+   * @param[out] pDst       points to the block of complex output data, 2 * blockSize values.
+   * @param[in]  blockSize  number of input samples to process.
+   */
+  void arm_hilbert_f32(
+  const arm_hilbert_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the Q15 Hilbert transformer.
+   * @param[in]  S          points to an instance of the Q15 Hilbert transformer structure.
+   * @param[in]  pSrc       points to the block of real input data.
+   * @param[out] pDst       points to the block of complex output data, 2 * blockSize values.
+   * @param[in]  blockSize  number of input samples to process.
+   */
+  void arm_hilbert_q15(
+  const arm_hilbert_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point analytic signal.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                     /**< length of the blocks. */
+    arm_rfft_fast_instance_f32 rfft;     /**< real FFT of the blocks. */
+    const arm_cfft_instance_f32 *pCfft;  /**< complex FFT of the same length, for the inverse transform. */
+  } arm_analytic_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point analytic signal.
+   * @param[out] S       points to an instance of the floating-point analytic signal structure.
+   * @param[in]  fftLen  length of the blocks, a power of 2 from 32 to 4096.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if fftLen is not a supported length.
+   */
+  arm_status arm_analytic_init_f32(
+  arm_analytic_instance_f32 * S,
+  uint16_t fftLen);
+
+  /**
+   * @brief  Floating-point analytic signal of a block of real data.
+   * @param[in]  S     points to an instance of the floating-point analytic signal structure.
+   * @param[in]  pSrc  points to the fftLen real input samples. Modified by this function.
+   * @param[out] pDst  points to the fftLen complex output samples, 2 * fftLen values.
+   */
+  void arm_analytic_f32(
+  arm_analytic_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst);
+
+  /**
+   * @brief Averaging modes of the Welch power spectral density estimator.
+   */
+  typedef enum
+  {
+    ARM_WELCH_LINEAR = 0,                /**< mean of the segments since the last estimate */
+    ARM_WELCH_EXPONENTIAL = 1            /**< exponentially weighted mean of all the segments */
+  } arm_welch_averaging;
+
+  /**
+   * @brief Instance structure for the floating-point Welch power spectral density estimator.
+   */
+  typedef struct
+  {
+    const arm_window_instance_f32 *pWindow; /**< points to the window of the segments. */
+    arm_rfft_fast_instance_f32 rfft;     /**< real FFT of the segments. */
+    uint16_t fftLen;                     /**< length of the segments. */
+    uint16_t hopSize;                    /**< number of new samples per segment. */
+    uint16_t fill;                       /**< number of samples in the segment buffer. */
+    arm_welch_averaging averaging;       /**< averaging mode. */
+    q31_t alpha;                         /**< weight of a new segment of the exponential mean, in 1.31 format. */
+    uint32_t numSegments;                /**< number of segments averaged. */
+    int32_t accExp;                      /**< exponent of the accumulators: a value x is stored as x * 2^(31 - accExp). */
+    float32_t accBound;                  /**< upper bound of the accumulators. */
+    float32_t scale;                     /**< normalization of the one-sided density, 1 / (fs * sum(w^2)). */
+    float32_t *pState;                   /**< points to the segment buffer and the scratch of the FFT, 3 * fftLen values. */
+    q31_t *pAcc;                         /**< points to the accumulators, fftLen / 2 + 1 values. */
+  } arm_welch_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point Welch power spectral density estimator.
+   * @param[in,out] S           points to an instance of the floating-point Welch estimator structure.
+   * @param[in]     pWindow     points to the window of the segments, of a length supported by arm_rfft_fast_f32().
+   * @param[in]     hopSize     number of new samples per segment, from 1 to the length of the window.
+   * @param[in]     averaging   averaging mode.
+   * @param[in]     alpha       weight of a new segment of the exponential mean, in (0 1], ignored by the linear mode.
+   * @param[in]     sampleRate  sample rate, in Hz.
+   * @param[in]     pState      points to the state buffer, 3 * fftLen values.
+   * @param[in]     pAcc        points to the accumulators, fftLen / 2 + 1 values.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_welch_init_f32(
+  arm_welch_instance_f32 * S,
+  const arm_window_instance_f32 * pWindow,
+  uint16_t hopSize,
+  arm_welch_averaging averaging,
+  float32_t alpha,
+  float32_t sampleRate,
+  float32_t * pState,
+  q31_t * pAcc);
+
+  /**
+   * @brief  Adds a block of floating-point samples to the Welch power spectral density estimator.
+   * @param[in,out] S          points to an instance of the floating-point Welch estimator structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return number of segments averaged since the last estimate, in linear mode, or since the
+   * initialization, in exponential mode.
+   */
+  uint32_t arm_welch_process_f32(
+  arm_welch_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Adds a block of Q15 samples to the Welch power spectral density estimator.
+   * @param[in,out] S          points to an instance of the floating-point Welch estimator structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return number of segments averaged since the last estimate, in linear mode, or since the
+   * initialization, in exponential mode.
+   */
+  uint32_t arm_welch_process_q15(
+  arm_welch_instance_f32 * S,
+  q15_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  One-sided power spectral density of the Welch estimator.
+   * @param[in,out] S     points to an instance of the floating-point Welch estimator structure.
+   * @param[out]    pDst  points to the density, fftLen / 2 + 1 values, in squared input units per Hz.
+   * @return number of segments averaged.  The linear mode starts a new mean.
+   */
+  uint32_t arm_welch_get_psd_f32(
+  arm_welch_instance_f32 * S,
+  float32_t * pDst);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -2792,3496 +4063,6405 @@ void arm_rfft_fast_f32(
 
 
   /**
-   * @brief  Copies the elements of a floating-point vector.
-   * @param[in]  pSrc       input pointer
-   * @param[out] pDst       output pointer
-   * @param[in]  blockSize  number of samples to process
+   * @brief  Clamps the elements of a floating-point vector to a range.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  low        lower bound
+   * @param[in]  high       upper bound
+   * @param[in]  blockSize  number of samples in the vector
    */
-  void arm_copy_f32(
+  void arm_clamp_f32(
   float32_t * pSrc,
   float32_t * pDst,
+  float32_t low,
+  float32_t high,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Copies the elements of a Q7 vector.
-   * @param[in]  pSrc       input pointer
-   * @param[out] pDst       output pointer
-   * @param[in]  blockSize  number of samples to process
+   * @brief  Clamps the elements of a Q31 vector to a range.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  low        lower bound
+   * @param[in]  high       upper bound
+   * @param[in]  blockSize  number of samples in the vector
    */
-  void arm_copy_q7(
-  q7_t * pSrc,
-  q7_t * pDst,
+  void arm_clamp_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  q31_t low,
+  q31_t high,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Copies the elements of a Q15 vector.
-   * @param[in]  pSrc       input pointer
-   * @param[out] pDst       output pointer
-   * @param[in]  blockSize  number of samples to process
+   * @brief  Clamps the elements of a Q15 vector to a range.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  low        lower bound
+   * @param[in]  high       upper bound
+   * @param[in]  blockSize  number of samples in the vector
    */
-  void arm_copy_q15(
+  void arm_clamp_q15(
   q15_t * pSrc,
   q15_t * pDst,
+  q15_t low,
+  q15_t high,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Copies the elements of a Q31 vector.
-   * @param[in]  pSrc       input pointer
-   * @param[out] pDst       output pointer
-   * @param[in]  blockSize  number of samples to process
+   * @brief  Clamps the elements of a Q7 vector to a range.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  low        lower bound
+   * @param[in]  high       upper bound
+   * @param[in]  blockSize  number of samples in the vector
    */
-  void arm_copy_q31(
-  q31_t * pSrc,
-  q31_t * pDst,
+  void arm_clamp_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  q7_t low,
+  q7_t high,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Fills a constant value into a floating-point vector.
-   * @param[in]  value      input value to be filled
-   * @param[out] pDst       output pointer
-   * @param[in]  blockSize  number of samples to process
+   * @brief Comparison operators of the vector compare functions.
+   * Bits 0, 1 and 2 of the value enable the less than, equal and greater than outcomes.
    */
-  void arm_fill_f32(
-  float32_t value,
-  float32_t * pDst,
-  uint32_t blockSize);
+  typedef enum
+  {
+    ARM_CMP_LT = 1,                      /**< less than */
+    ARM_CMP_EQ = 2,                      /**< equal */
+    ARM_CMP_LE = 3,                      /**< less than or equal */
+    ARM_CMP_GT = 4,                      /**< greater than */
+    ARM_CMP_NE = 5,                      /**< not equal */
+    ARM_CMP_GE = 6                       /**< greater than or equal */
+  } arm_compare_op;
 
 
   /**
-   * @brief  Fills a constant value into a Q7 vector.
-   * @param[in]  value      input value to be filled
-   * @param[out] pDst       output pointer
-   * @param[in]  blockSize  number of samples to process
+   * @brief  Compares two floating-point vectors element by element.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  op         comparison operator
+   * @param[out] pDst       points to the output mask vector, 0xFF where the comparison holds and 0x00 elsewhere
+   * @param[in]  blockSize  number of samples in each vector
    */
-  void arm_fill_q7(
-  q7_t value,
-  q7_t * pDst,
+  void arm_compare_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  arm_compare_op op,
+  uint8_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Fills a constant value into a Q15 vector.
-   * @param[in]  value      input value to be filled
-   * @param[out] pDst       output pointer
-   * @param[in]  blockSize  number of samples to process
+   * @brief  Compares two Q31 vectors element by element.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  op         comparison operator
+   * @param[out] pDst       points to the output mask vector, 0xFF where the comparison holds and 0x00 elsewhere
+   * @param[in]  blockSize  number of samples in each vector
    */
-  void arm_fill_q15(
-  q15_t value,
-  q15_t * pDst,
+  void arm_compare_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  arm_compare_op op,
+  uint8_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Fills a constant value into a Q31 vector.
-   * @param[in]  value      input value to be filled
-   * @param[out] pDst       output pointer
-   * @param[in]  blockSize  number of samples to process
+   * @brief  Compares two Q15 vectors element by element.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  op         comparison operator
+   * @param[out] pDst       points to the output mask vector, 0xFF where the comparison holds and 0x00 elsewhere
+   * @param[in]  blockSize  number of samples in each vector
    */
-  void arm_fill_q31(
-  q31_t value,
-  q31_t * pDst,
+  void arm_compare_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  arm_compare_op op,
+  uint8_t * pDst,
   uint32_t blockSize);
 
 
-/**
- * @brief Convolution of floating-point sequences.
- * @param[in]  pSrcA    points to the first input sequence.
- * @param[in]  srcALen  length of the first input sequence.
- * @param[in]  pSrcB    points to the second input sequence.
- * @param[in]  srcBLen  length of the second input sequence.
- * @param[out] pDst     points to the location where the output result is written.  Length srcALen+srcBLen-1.
- */
-  void arm_conv_f32(
-  float32_t * pSrcA,
-  uint32_t srcALen,
-  float32_t * pSrcB,
-  uint32_t srcBLen,
-  float32_t * pDst);
+  /**
+   * @brief  Compares two Q7 vectors element by element.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  op         comparison operator
+   * @param[out] pDst       points to the output mask vector, 0xFF where the comparison holds and 0x00 elsewhere
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_compare_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Convolution of Q15 sequences.
-   * @param[in]  pSrcA      points to the first input sequence.
-   * @param[in]  srcALen    length of the first input sequence.
-   * @param[in]  pSrcB      points to the second input sequence.
-   * @param[in]  srcBLen    length of the second input sequence.
-   * @param[out] pDst       points to the block of output data  Length srcALen+srcBLen-1.
-   * @param[in]  pScratch1  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @param[in]  pScratch2  points to scratch buffer of size min(srcALen, srcBLen).
+   * @brief  Compares the elements of a floating-point vector with a threshold.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  threshold  value compared with each element
+   * @param[in]  op         comparison operator
+   * @param[out] pDst       points to the output mask vector, 0xFF where the comparison holds and 0x00 elsewhere
+   * @param[in]  blockSize  number of samples in the vector
    */
-  void arm_conv_opt_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst,
-  q15_t * pScratch1,
-  q15_t * pScratch2);
+  void arm_threshold_f32(
+  float32_t * pSrc,
+  float32_t threshold,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize);
 
 
-/**
- * @brief Convolution of Q15 sequences.
- * @param[in]  pSrcA    points to the first input sequence.
- * @param[in]  srcALen  length of the first input sequence.
- * @param[in]  pSrcB    points to the second input sequence.
- * @param[in]  srcBLen  length of the second input sequence.
- * @param[out] pDst     points to the location where the output result is written.  Length srcALen+srcBLen-1.
- */
-  void arm_conv_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst);
+  /**
+   * @brief  Compares the elements of a Q31 vector with a threshold.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  threshold  value compared with each element
+   * @param[in]  op         comparison operator
+   * @param[out] pDst       points to the output mask vector, 0xFF where the comparison holds and 0x00 elsewhere
+   * @param[in]  blockSize  number of samples in the vector
+   */
+  void arm_threshold_q31(
+  q31_t * pSrc,
+  q31_t threshold,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in]  pSrcA    points to the first input sequence.
-   * @param[in]  srcALen  length of the first input sequence.
-   * @param[in]  pSrcB    points to the second input sequence.
-   * @param[in]  srcBLen  length of the second input sequence.
-   * @param[out] pDst     points to the block of output data  Length srcALen+srcBLen-1.
+   * @brief  Compares the elements of a Q15 vector with a threshold.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  threshold  value compared with each element
+   * @param[in]  op         comparison operator
+   * @param[out] pDst       points to the output mask vector, 0xFF where the comparison holds and 0x00 elsewhere
+   * @param[in]  blockSize  number of samples in the vector
    */
-  void arm_conv_fast_q15(
-          q15_t * pSrcA,
-          uint32_t srcALen,
-          q15_t * pSrcB,
-          uint32_t srcBLen,
-          q15_t * pDst);
+  void arm_threshold_q15(
+  q15_t * pSrc,
+  q15_t threshold,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in]  pSrcA      points to the first input sequence.
-   * @param[in]  srcALen    length of the first input sequence.
-   * @param[in]  pSrcB      points to the second input sequence.
-   * @param[in]  srcBLen    length of the second input sequence.
-   * @param[out] pDst       points to the block of output data  Length srcALen+srcBLen-1.
-   * @param[in]  pScratch1  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @param[in]  pScratch2  points to scratch buffer of size min(srcALen, srcBLen).
+   * @brief  Compares the elements of a Q7 vector with a threshold.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  threshold  value compared with each element
+   * @param[in]  op         comparison operator
+   * @param[out] pDst       points to the output mask vector, 0xFF where the comparison holds and 0x00 elsewhere
+   * @param[in]  blockSize  number of samples in the vector
    */
-  void arm_conv_fast_opt_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst,
-  q15_t * pScratch1,
-  q15_t * pScratch2);
+  void arm_threshold_q7(
+  q7_t * pSrc,
+  q7_t threshold,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Convolution of Q31 sequences.
-   * @param[in]  pSrcA    points to the first input sequence.
-   * @param[in]  srcALen  length of the first input sequence.
-   * @param[in]  pSrcB    points to the second input sequence.
-   * @param[in]  srcBLen  length of the second input sequence.
-   * @param[out] pDst     points to the block of output data  Length srcALen+srcBLen-1.
+   * @brief  Selects the elements of two floating-point vectors with a mask.
+   * @param[in]  pMask      points to the mask vector, a non-zero element selects pSrcA
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
    */
-  void arm_conv_q31(
-  q31_t * pSrcA,
-  uint32_t srcALen,
-  q31_t * pSrcB,
-  uint32_t srcBLen,
-  q31_t * pDst);
+  void arm_blend_f32(
+  uint8_t * pMask,
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Convolution of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in]  pSrcA    points to the first input sequence.
-   * @param[in]  srcALen  length of the first input sequence.
-   * @param[in]  pSrcB    points to the second input sequence.
-   * @param[in]  srcBLen  length of the second input sequence.
-   * @param[out] pDst     points to the block of output data  Length srcALen+srcBLen-1.
+   * @brief  Selects the elements of two Q31 vectors with a mask.
+   * @param[in]  pMask      points to the mask vector, a non-zero element selects pSrcA
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
    */
-  void arm_conv_fast_q31(
+  void arm_blend_q31(
+  uint8_t * pMask,
   q31_t * pSrcA,
-  uint32_t srcALen,
   q31_t * pSrcB,
-  uint32_t srcBLen,
-  q31_t * pDst);
+  q31_t * pDst,
+  uint32_t blockSize);
 
 
-    /**
-   * @brief Convolution of Q7 sequences.
-   * @param[in]  pSrcA      points to the first input sequence.
-   * @param[in]  srcALen    length of the first input sequence.
-   * @param[in]  pSrcB      points to the second input sequence.
-   * @param[in]  srcBLen    length of the second input sequence.
-   * @param[out] pDst       points to the block of output data  Length srcALen+srcBLen-1.
-   * @param[in]  pScratch1  points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @param[in]  pScratch2  points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen).
+  /**
+   * @brief  Selects the elements of two Q15 vectors with a mask.
+   * @param[in]  pMask      points to the mask vector, a non-zero element selects pSrcA
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
    */
-  void arm_conv_opt_q7(
-  q7_t * pSrcA,
-  uint32_t srcALen,
-  q7_t * pSrcB,
-  uint32_t srcBLen,
-  q7_t * pDst,
-  q15_t * pScratch1,
-  q15_t * pScratch2);
+  void arm_blend_q15(
+  uint8_t * pMask,
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Convolution of Q7 sequences.
-   * @param[in]  pSrcA    points to the first input sequence.
-   * @param[in]  srcALen  length of the first input sequence.
-   * @param[in]  pSrcB    points to the second input sequence.
-   * @param[in]  srcBLen  length of the second input sequence.
-   * @param[out] pDst     points to the block of output data  Length srcALen+srcBLen-1.
+   * @brief  Selects the elements of two Q7 vectors with a mask.
+   * @param[in]  pMask      points to the mask vector, a non-zero element selects pSrcA
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
    */
-  void arm_conv_q7(
+  void arm_blend_q7(
+  uint8_t * pMask,
   q7_t * pSrcA,
-  uint32_t srcALen,
   q7_t * pSrcB,
-  uint32_t srcBLen,
-  q7_t * pDst);
+  q7_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Partial convolution of floating-point sequences.
-   * @param[in]  pSrcA       points to the first input sequence.
-   * @param[in]  srcALen     length of the first input sequence.
-   * @param[in]  pSrcB       points to the second input sequence.
-   * @param[in]  srcBLen     length of the second input sequence.
-   * @param[out] pDst        points to the block of output data
-   * @param[in]  firstIndex  is the first output sample to start with.
-   * @param[in]  numPoints   is the number of output points to be computed.
-   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief  Multiplies a floating-point vector by a scalar and adds an offset.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  scale      scale factor
+   * @param[in]  offset     offset added after the scaling
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in the vector
    */
-  arm_status arm_conv_partial_f32(
-  float32_t * pSrcA,
-  uint32_t srcALen,
-  float32_t * pSrcB,
-  uint32_t srcBLen,
+  void arm_scale_offset_f32(
+  float32_t * pSrc,
+  float32_t scale,
+  float32_t offset,
   float32_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints);
+  uint32_t blockSize);
 
 
   /**
-   * @brief Partial convolution of Q15 sequences.
-   * @param[in]  pSrcA       points to the first input sequence.
-   * @param[in]  srcALen     length of the first input sequence.
-   * @param[in]  pSrcB       points to the second input sequence.
-   * @param[in]  srcBLen     length of the second input sequence.
-   * @param[out] pDst        points to the block of output data
-   * @param[in]  firstIndex  is the first output sample to start with.
-   * @param[in]  numPoints   is the number of output points to be computed.
-   * @param[in]  pScratch1   points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @param[in]  pScratch2   points to scratch buffer of size min(srcALen, srcBLen).
-   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief  Multiplies a Q31 vector by a scalar and adds an offset.
+   * @param[in]  pSrc        points to the input vector
+   * @param[in]  scaleFract  fractional portion of the scale value
+   * @param[in]  shift       number of bits to shift the result by
+   * @param[in]  offset      offset added after the scaling
+   * @param[out] pDst        points to the output vector
+   * @param[in]  blockSize   number of samples in the vector
    */
-  arm_status arm_conv_partial_opt_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints,
-  q15_t * pScratch1,
-  q15_t * pScratch2);
+  void arm_scale_offset_q31(
+  q31_t * pSrc,
+  q31_t scaleFract,
+  int8_t shift,
+  q31_t offset,
+  q31_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Partial convolution of Q15 sequences.
-   * @param[in]  pSrcA       points to the first input sequence.
-   * @param[in]  srcALen     length of the first input sequence.
-   * @param[in]  pSrcB       points to the second input sequence.
-   * @param[in]  srcBLen     length of the second input sequence.
-   * @param[out] pDst        points to the block of output data
-   * @param[in]  firstIndex  is the first output sample to start with.
-   * @param[in]  numPoints   is the number of output points to be computed.
-   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief  Multiplies a Q15 vector by a scalar and adds an offset.
+   * @param[in]  pSrc        points to the input vector
+   * @param[in]  scaleFract  fractional portion of the scale value
+   * @param[in]  shift       number of bits to shift the result by
+   * @param[in]  offset      offset added after the scaling
+   * @param[out] pDst        points to the output vector
+   * @param[in]  blockSize   number of samples in the vector
    */
-  arm_status arm_conv_partial_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
+  void arm_scale_offset_q15(
+  q15_t * pSrc,
+  q15_t scaleFract,
+  int8_t shift,
+  q15_t offset,
   q15_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints);
+  uint32_t blockSize);
 
 
   /**
-   * @brief Partial convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in]  pSrcA       points to the first input sequence.
-   * @param[in]  srcALen     length of the first input sequence.
-   * @param[in]  pSrcB       points to the second input sequence.
-   * @param[in]  srcBLen     length of the second input sequence.
-   * @param[out] pDst        points to the block of output data
-   * @param[in]  firstIndex  is the first output sample to start with.
-   * @param[in]  numPoints   is the number of output points to be computed.
-   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief  Multiplies a Q7 vector by a scalar and adds an offset.
+   * @param[in]  pSrc        points to the input vector
+   * @param[in]  scaleFract  fractional portion of the scale value
+   * @param[in]  shift       number of bits to shift the result by
+   * @param[in]  offset      offset added after the scaling
+   * @param[out] pDst        points to the output vector
+   * @param[in]  blockSize   number of samples in the vector
    */
-  arm_status arm_conv_partial_fast_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints);
+  void arm_scale_offset_q7(
+  q7_t * pSrc,
+  q7_t scaleFract,
+  int8_t shift,
+  q7_t offset,
+  q7_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Partial convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in]  pSrcA       points to the first input sequence.
-   * @param[in]  srcALen     length of the first input sequence.
-   * @param[in]  pSrcB       points to the second input sequence.
-   * @param[in]  srcBLen     length of the second input sequence.
-   * @param[out] pDst        points to the block of output data
-   * @param[in]  firstIndex  is the first output sample to start with.
-   * @param[in]  numPoints   is the number of output points to be computed.
-   * @param[in]  pScratch1   points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @param[in]  pScratch2   points to scratch buffer of size min(srcALen, srcBLen).
-   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief  Floating-point vector multiplication and addition.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  pSrcC      points to the vector added to the products
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
    */
-  arm_status arm_conv_partial_fast_opt_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints,
-  q15_t * pScratch1,
-  q15_t * pScratch2);
+  void arm_mult_add_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pSrcC,
+  float32_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Partial convolution of Q31 sequences.
-   * @param[in]  pSrcA       points to the first input sequence.
-   * @param[in]  srcALen     length of the first input sequence.
-   * @param[in]  pSrcB       points to the second input sequence.
-   * @param[in]  srcBLen     length of the second input sequence.
-   * @param[out] pDst        points to the block of output data
-   * @param[in]  firstIndex  is the first output sample to start with.
-   * @param[in]  numPoints   is the number of output points to be computed.
-   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief  Q31 vector multiplication and addition.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  pSrcC      points to the vector added to the products
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
    */
-  arm_status arm_conv_partial_q31(
+  void arm_mult_add_q31(
   q31_t * pSrcA,
-  uint32_t srcALen,
   q31_t * pSrcB,
-  uint32_t srcBLen,
+  q31_t * pSrcC,
   q31_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints);
+  uint32_t blockSize);
 
 
   /**
-   * @brief Partial convolution of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in]  pSrcA       points to the first input sequence.
-   * @param[in]  srcALen     length of the first input sequence.
-   * @param[in]  pSrcB       points to the second input sequence.
-   * @param[in]  srcBLen     length of the second input sequence.
-   * @param[out] pDst        points to the block of output data
-   * @param[in]  firstIndex  is the first output sample to start with.
-   * @param[in]  numPoints   is the number of output points to be computed.
-   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief  Q15 vector multiplication and addition.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  pSrcC      points to the vector added to the products
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
    */
-  arm_status arm_conv_partial_fast_q31(
-  q31_t * pSrcA,
-  uint32_t srcALen,
-  q31_t * pSrcB,
-  uint32_t srcBLen,
-  q31_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints);
+  void arm_mult_add_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pSrcC,
+  q15_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Partial convolution of Q7 sequences
-   * @param[in]  pSrcA       points to the first input sequence.
-   * @param[in]  srcALen     length of the first input sequence.
-   * @param[in]  pSrcB       points to the second input sequence.
-   * @param[in]  srcBLen     length of the second input sequence.
-   * @param[out] pDst        points to the block of output data
-   * @param[in]  firstIndex  is the first output sample to start with.
-   * @param[in]  numPoints   is the number of output points to be computed.
-   * @param[in]  pScratch1   points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @param[in]  pScratch2   points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen).
-   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief  Q7 vector multiplication and addition.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  pSrcC      points to the vector added to the products
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
    */
-  arm_status arm_conv_partial_opt_q7(
+  void arm_mult_add_q7(
   q7_t * pSrcA,
-  uint32_t srcALen,
   q7_t * pSrcB,
-  uint32_t srcBLen,
+  q7_t * pSrcC,
   q7_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints,
-  q15_t * pScratch1,
-  q15_t * pScratch2);
+  uint32_t blockSize);
 
 
-/**
-   * @brief Partial convolution of Q7 sequences.
-   * @param[in]  pSrcA       points to the first input sequence.
-   * @param[in]  srcALen     length of the first input sequence.
-   * @param[in]  pSrcB       points to the second input sequence.
-   * @param[in]  srcBLen     length of the second input sequence.
-   * @param[out] pDst        points to the block of output data
-   * @param[in]  firstIndex  is the first output sample to start with.
-   * @param[in]  numPoints   is the number of output points to be computed.
-   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+  /**
+   * @brief  Weighted sum of two floating-point vectors.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  weightA    weight of the first vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  weightB    weight of the second vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
    */
-  arm_status arm_conv_partial_q7(
-  q7_t * pSrcA,
-  uint32_t srcALen,
-  q7_t * pSrcB,
-  uint32_t srcBLen,
-  q7_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints);
+  void arm_weighted_sum_f32(
+  float32_t * pSrcA,
+  float32_t weightA,
+  float32_t * pSrcB,
+  float32_t weightB,
+  float32_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Instance structure for the Q15 FIR decimator.
+   * @brief  Weighted sum of two Q31 vectors.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  weightA    weight of the first vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  weightB    weight of the second vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
    */
-  typedef struct
-  {
-    uint8_t M;                  /**< decimation factor. */
-    uint16_t numTaps;           /**< number of coefficients in the filter. */
-    q15_t *pCoeffs;             /**< points to the coefficient array. The array is of length numTaps.*/
-    q15_t *pState;              /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-  } arm_fir_decimate_instance_q15;
+  void arm_weighted_sum_q31(
+  q31_t * pSrcA,
+  q31_t weightA,
+  q31_t * pSrcB,
+  q31_t weightB,
+  q31_t * pDst,
+  uint32_t blockSize);
+
 
   /**
-   * @brief Instance structure for the Q31 FIR decimator.
+   * @brief  Weighted sum of two Q15 vectors.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  weightA    weight of the first vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  weightB    weight of the second vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
    */
-  typedef struct
-  {
-    uint8_t M;                  /**< decimation factor. */
-    uint16_t numTaps;           /**< number of coefficients in the filter. */
-    q31_t *pCoeffs;             /**< points to the coefficient array. The array is of length numTaps.*/
-    q31_t *pState;              /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-  } arm_fir_decimate_instance_q31;
+  void arm_weighted_sum_q15(
+  q15_t * pSrcA,
+  q15_t weightA,
+  q15_t * pSrcB,
+  q15_t weightB,
+  q15_t * pDst,
+  uint32_t blockSize);
+
 
   /**
-   * @brief Instance structure for the floating-point FIR decimator.
+   * @brief  Weighted sum of two Q7 vectors.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  weightA    weight of the first vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  weightB    weight of the second vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
    */
-  typedef struct
-  {
-    uint8_t M;                  /**< decimation factor. */
-    uint16_t numTaps;           /**< number of coefficients in the filter. */
-    float32_t *pCoeffs;         /**< points to the coefficient array. The array is of length numTaps.*/
-    float32_t *pState;          /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-  } arm_fir_decimate_instance_f32;
+  void arm_weighted_sum_q7(
+  q7_t * pSrcA,
+  q7_t weightA,
+  q7_t * pSrcB,
+  q7_t weightB,
+  q7_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Processing function for the floating-point FIR decimator.
-   * @param[in]  S          points to an instance of the floating-point FIR decimator structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of input samples to process per call.
+   * @brief  Copies the elements of a floating-point vector.
+   * @param[in]  pSrc       input pointer
+   * @param[out] pDst       output pointer
+   * @param[in]  blockSize  number of samples to process
    */
-  void arm_fir_decimate_f32(
-  const arm_fir_decimate_instance_f32 * S,
+  void arm_copy_f32(
   float32_t * pSrc,
   float32_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Initialization function for the floating-point FIR decimator.
-   * @param[in,out] S          points to an instance of the floating-point FIR decimator structure.
-   * @param[in]     numTaps    number of coefficients in the filter.
-   * @param[in]     M          decimation factor.
-   * @param[in]     pCoeffs    points to the filter coefficients.
-   * @param[in]     pState     points to the state buffer.
-   * @param[in]     blockSize  number of input samples to process per call.
-   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * <code>blockSize</code> is not a multiple of <code>M</code>.
+   * @brief  Copies the elements of a Q7 vector.
+   * @param[in]  pSrc       input pointer
+   * @param[out] pDst       output pointer
+   * @param[in]  blockSize  number of samples to process
    */
-  arm_status arm_fir_decimate_init_f32(
-  arm_fir_decimate_instance_f32 * S,
-  uint16_t numTaps,
-  uint8_t M,
-  float32_t * pCoeffs,
-  float32_t * pState,
+  void arm_copy_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief Processing function for the Q15 FIR decimator.
-   * @param[in]  S          points to an instance of the Q15 FIR decimator structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of input samples to process per call.
+   * @brief  Copies the elements of a Q15 vector.
+   * @param[in]  pSrc       input pointer
+   * @param[out] pDst       output pointer
+   * @param[in]  blockSize  number of samples to process
    */
-  void arm_fir_decimate_q15(
-  const arm_fir_decimate_instance_q15 * S,
+  void arm_copy_q15(
   q15_t * pSrc,
   q15_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief Processing function for the Q15 FIR decimator (fast variant) for Cortex-M3 and Cortex-M4.
-   * @param[in]  S          points to an instance of the Q15 FIR decimator structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of input samples to process per call.
+   * @brief  Copies the elements of a Q31 vector.
+   * @param[in]  pSrc       input pointer
+   * @param[out] pDst       output pointer
+   * @param[in]  blockSize  number of samples to process
    */
-  void arm_fir_decimate_fast_q15(
-  const arm_fir_decimate_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pDst,
+  void arm_copy_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Initialization function for the Q15 FIR decimator.
-   * @param[in,out] S          points to an instance of the Q15 FIR decimator structure.
-   * @param[in]     numTaps    number of coefficients in the filter.
-   * @param[in]     M          decimation factor.
-   * @param[in]     pCoeffs    points to the filter coefficients.
-   * @param[in]     pState     points to the state buffer.
-   * @param[in]     blockSize  number of input samples to process per call.
-   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * <code>blockSize</code> is not a multiple of <code>M</code>.
+   * @brief  Fills a constant value into a floating-point vector.
+   * @param[in]  value      input value to be filled
+   * @param[out] pDst       output pointer
+   * @param[in]  blockSize  number of samples to process
    */
-  arm_status arm_fir_decimate_init_q15(
-  arm_fir_decimate_instance_q15 * S,
-  uint16_t numTaps,
-  uint8_t M,
-  q15_t * pCoeffs,
-  q15_t * pState,
+  void arm_fill_f32(
+  float32_t value,
+  float32_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief Processing function for the Q31 FIR decimator.
-   * @param[in]  S     points to an instance of the Q31 FIR decimator structure.
-   * @param[in]  pSrc  points to the block of input data.
-   * @param[out] pDst  points to the block of output data
-   * @param[in] blockSize number of input samples to process per call.
+   * @brief  Fills a constant value into a Q7 vector.
+   * @param[in]  value      input value to be filled
+   * @param[out] pDst       output pointer
+   * @param[in]  blockSize  number of samples to process
    */
-  void arm_fir_decimate_q31(
-  const arm_fir_decimate_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
+  void arm_fill_q7(
+  q7_t value,
+  q7_t * pDst,
   uint32_t blockSize);
 
+
   /**
-   * @brief Processing function for the Q31 FIR decimator (fast variant) for Cortex-M3 and Cortex-M4.
-   * @param[in]  S          points to an instance of the Q31 FIR decimator structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of input samples to process per call.
+   * @brief  Fills a constant value into a Q15 vector.
+   * @param[in]  value      input value to be filled
+   * @param[out] pDst       output pointer
+   * @param[in]  blockSize  number of samples to process
    */
-  void arm_fir_decimate_fast_q31(
-  arm_fir_decimate_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
+  void arm_fill_q15(
+  q15_t value,
+  q15_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Initialization function for the Q31 FIR decimator.
-   * @param[in,out] S          points to an instance of the Q31 FIR decimator structure.
-   * @param[in]     numTaps    number of coefficients in the filter.
-   * @param[in]     M          decimation factor.
-   * @param[in]     pCoeffs    points to the filter coefficients.
-   * @param[in]     pState     points to the state buffer.
-   * @param[in]     blockSize  number of input samples to process per call.
-   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * <code>blockSize</code> is not a multiple of <code>M</code>.
+   * @brief  Fills a constant value into a Q31 vector.
+   * @param[in]  value      input value to be filled
+   * @param[out] pDst       output pointer
+   * @param[in]  blockSize  number of samples to process
    */
-  arm_status arm_fir_decimate_init_q31(
-  arm_fir_decimate_instance_q31 * S,
-  uint16_t numTaps,
-  uint8_t M,
-  q31_t * pCoeffs,
-  q31_t * pState,
+  void arm_fill_q31(
+  q31_t value,
+  q31_t * pDst,
   uint32_t blockSize);
 
 
-  /**
-   * @brief Instance structure for the Q15 FIR interpolator.
-   */
-  typedef struct
-  {
-    uint8_t L;                      /**< upsample factor. */
-    uint16_t phaseLength;           /**< length of each polyphase filter component. */
-    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
-    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
-  } arm_fir_interpolate_instance_q15;
+/**
+ * @brief Convolution of floating-point sequences.
+ * @param[in]  pSrcA    points to the first input sequence.
+ * @param[in]  srcALen  length of the first input sequence.
+ * @param[in]  pSrcB    points to the second input sequence.
+ * @param[in]  srcBLen  length of the second input sequence.
+ * @param[out] pDst     points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ */
+  void arm_conv_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst);
+
 
   /**
-   * @brief Instance structure for the Q31 FIR interpolator.
+   * @brief Convolution of Q15 sequences.
+   * @param[in]  pSrcA      points to the first input sequence.
+   * @param[in]  srcALen    length of the first input sequence.
+   * @param[in]  pSrcB      points to the second input sequence.
+   * @param[in]  srcBLen    length of the second input sequence.
+   * @param[out] pDst       points to the block of output data  Length srcALen+srcBLen-1.
+   * @param[in]  pScratch1  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]  pScratch2  points to scratch buffer of size min(srcALen, srcBLen).
    */
-  typedef struct
-  {
-    uint8_t L;                      /**< upsample factor. */
-    uint16_t phaseLength;           /**< length of each polyphase filter component. */
-    q31_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
-    q31_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
-  } arm_fir_interpolate_instance_q31;
+  void arm_conv_opt_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pScratch1,
+  q15_t * pScratch2);
+
+
+/**
+ * @brief Convolution of Q15 sequences.
+ * @param[in]  pSrcA    points to the first input sequence.
+ * @param[in]  srcALen  length of the first input sequence.
+ * @param[in]  pSrcB    points to the second input sequence.
+ * @param[in]  srcBLen  length of the second input sequence.
+ * @param[out] pDst     points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ */
+  void arm_conv_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst);
+
 
   /**
-   * @brief Instance structure for the floating-point FIR interpolator.
+   * @brief Convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  pSrcB    points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[out] pDst     points to the block of output data  Length srcALen+srcBLen-1.
    */
-  typedef struct
-  {
-    uint8_t L;                     /**< upsample factor. */
-    uint16_t phaseLength;          /**< length of each polyphase filter component. */
-    float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
-    float32_t *pState;             /**< points to the state variable array. The array is of length phaseLength+numTaps-1. */
-  } arm_fir_interpolate_instance_f32;
+  void arm_conv_fast_q15(
+          q15_t * pSrcA,
+          uint32_t srcALen,
+          q15_t * pSrcB,
+          uint32_t srcBLen,
+          q15_t * pDst);
 
 
   /**
-   * @brief Processing function for the Q15 FIR interpolator.
-   * @param[in]  S          points to an instance of the Q15 FIR interpolator structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data.
-   * @param[in]  blockSize  number of input samples to process per call.
+   * @brief Convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in]  pSrcA      points to the first input sequence.
+   * @param[in]  srcALen    length of the first input sequence.
+   * @param[in]  pSrcB      points to the second input sequence.
+   * @param[in]  srcBLen    length of the second input sequence.
+   * @param[out] pDst       points to the block of output data  Length srcALen+srcBLen-1.
+   * @param[in]  pScratch1  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]  pScratch2  points to scratch buffer of size min(srcALen, srcBLen).
    */
-  void arm_fir_interpolate_q15(
-  const arm_fir_interpolate_instance_q15 * S,
-  q15_t * pSrc,
+  void arm_conv_fast_opt_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
   q15_t * pDst,
-  uint32_t blockSize);
+  q15_t * pScratch1,
+  q15_t * pScratch2);
 
 
   /**
-   * @brief  Initialization function for the Q15 FIR interpolator.
-   * @param[in,out] S          points to an instance of the Q15 FIR interpolator structure.
-   * @param[in]     L          upsample factor.
-   * @param[in]     numTaps    number of filter coefficients in the filter.
-   * @param[in]     pCoeffs    points to the filter coefficient buffer.
-   * @param[in]     pState     points to the state buffer.
-   * @param[in]     blockSize  number of input samples to process per call.
-   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   * @brief Convolution of Q31 sequences.
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  pSrcB    points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[out] pDst     points to the block of output data  Length srcALen+srcBLen-1.
    */
-  arm_status arm_fir_interpolate_init_q15(
-  arm_fir_interpolate_instance_q15 * S,
-  uint8_t L,
-  uint16_t numTaps,
-  q15_t * pCoeffs,
-  q15_t * pState,
-  uint32_t blockSize);
+  void arm_conv_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst);
 
 
   /**
-   * @brief Processing function for the Q31 FIR interpolator.
-   * @param[in]  S          points to an instance of the Q15 FIR interpolator structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data.
-   * @param[in]  blockSize  number of input samples to process per call.
+   * @brief Convolution of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  pSrcB    points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[out] pDst     points to the block of output data  Length srcALen+srcBLen-1.
    */
-  void arm_fir_interpolate_q31(
-  const arm_fir_interpolate_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
+  void arm_conv_fast_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst);
 
 
-  /**
-   * @brief  Initialization function for the Q31 FIR interpolator.
-   * @param[in,out] S          points to an instance of the Q31 FIR interpolator structure.
-   * @param[in]     L          upsample factor.
-   * @param[in]     numTaps    number of filter coefficients in the filter.
-   * @param[in]     pCoeffs    points to the filter coefficient buffer.
-   * @param[in]     pState     points to the state buffer.
-   * @param[in]     blockSize  number of input samples to process per call.
-   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+    /**
+   * @brief Convolution of Q7 sequences.
+   * @param[in]  pSrcA      points to the first input sequence.
+   * @param[in]  srcALen    length of the first input sequence.
+   * @param[in]  pSrcB      points to the second input sequence.
+   * @param[in]  srcBLen    length of the second input sequence.
+   * @param[out] pDst       points to the block of output data  Length srcALen+srcBLen-1.
+   * @param[in]  pScratch1  points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]  pScratch2  points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen).
    */
-  arm_status arm_fir_interpolate_init_q31(
-  arm_fir_interpolate_instance_q31 * S,
-  uint8_t L,
-  uint16_t numTaps,
-  q31_t * pCoeffs,
-  q31_t * pState,
-  uint32_t blockSize);
+  void arm_conv_opt_q7(
+  q7_t * pSrcA,
+  uint32_t srcALen,
+  q7_t * pSrcB,
+  uint32_t srcBLen,
+  q7_t * pDst,
+  q15_t * pScratch1,
+  q15_t * pScratch2);
 
 
   /**
-   * @brief Processing function for the floating-point FIR interpolator.
-   * @param[in]  S          points to an instance of the floating-point FIR interpolator structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data.
-   * @param[in]  blockSize  number of input samples to process per call.
+   * @brief Convolution of Q7 sequences.
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  pSrcB    points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[out] pDst     points to the block of output data  Length srcALen+srcBLen-1.
    */
-  void arm_fir_interpolate_f32(
-  const arm_fir_interpolate_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
-  uint32_t blockSize);
+  void arm_conv_q7(
+  q7_t * pSrcA,
+  uint32_t srcALen,
+  q7_t * pSrcB,
+  uint32_t srcBLen,
+  q7_t * pDst);
 
 
   /**
-   * @brief  Initialization function for the floating-point FIR interpolator.
-   * @param[in,out] S          points to an instance of the floating-point FIR interpolator structure.
-   * @param[in]     L          upsample factor.
-   * @param[in]     numTaps    number of filter coefficients in the filter.
-   * @param[in]     pCoeffs    points to the filter coefficient buffer.
-   * @param[in]     pState     points to the state buffer.
-   * @param[in]     blockSize  number of input samples to process per call.
-   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   * @brief Partial convolution of floating-point sequences.
+   * @param[in]  pSrcA       points to the first input sequence.
+   * @param[in]  srcALen     length of the first input sequence.
+   * @param[in]  pSrcB       points to the second input sequence.
+   * @param[in]  srcBLen     length of the second input sequence.
+   * @param[out] pDst        points to the block of output data
+   * @param[in]  firstIndex  is the first output sample to start with.
+   * @param[in]  numPoints   is the number of output points to be computed.
+   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
    */
-  arm_status arm_fir_interpolate_init_f32(
-  arm_fir_interpolate_instance_f32 * S,
-  uint8_t L,
-  uint16_t numTaps,
-  float32_t * pCoeffs,
-  float32_t * pState,
-  uint32_t blockSize);
+  arm_status arm_conv_partial_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints);
 
 
   /**
-   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   * @brief Partial convolution of Q15 sequences.
+   * @param[in]  pSrcA       points to the first input sequence.
+   * @param[in]  srcALen     length of the first input sequence.
+   * @param[in]  pSrcB       points to the second input sequence.
+   * @param[in]  srcBLen     length of the second input sequence.
+   * @param[out] pDst        points to the block of output data
+   * @param[in]  firstIndex  is the first output sample to start with.
+   * @param[in]  numPoints   is the number of output points to be computed.
+   * @param[in]  pScratch1   points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]  pScratch2   points to scratch buffer of size min(srcALen, srcBLen).
+   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
    */
-  typedef struct
-  {
-    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
-    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
-    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
-  } arm_biquad_cas_df1_32x64_ins_q31;
+  arm_status arm_conv_partial_opt_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints,
+  q15_t * pScratch1,
+  q15_t * pScratch2);
 
 
   /**
-   * @param[in]  S          points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of samples to process.
+   * @brief Partial convolution of Q15 sequences.
+   * @param[in]  pSrcA       points to the first input sequence.
+   * @param[in]  srcALen     length of the first input sequence.
+   * @param[in]  pSrcB       points to the second input sequence.
+   * @param[in]  srcBLen     length of the second input sequence.
+   * @param[out] pDst        points to the block of output data
+   * @param[in]  firstIndex  is the first output sample to start with.
+   * @param[in]  numPoints   is the number of output points to be computed.
+   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
    */
-  void arm_biquad_cas_df1_32x64_q31(
-  const arm_biquad_cas_df1_32x64_ins_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
+  arm_status arm_conv_partial_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints);
 
 
   /**
-   * @param[in,out] S          points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]     numStages  number of 2nd order stages in the filter.
-   * @param[in]     pCoeffs    points to the filter coefficients.
-   * @param[in]     pState     points to the state buffer.
-   * @param[in]     postShift  shift to be applied to the output. Varies according to the coefficients format
+   * @brief Partial convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in]  pSrcA       points to the first input sequence.
+   * @param[in]  srcALen     length of the first input sequence.
+   * @param[in]  pSrcB       points to the second input sequence.
+   * @param[in]  srcBLen     length of the second input sequence.
+   * @param[out] pDst        points to the block of output data
+   * @param[in]  firstIndex  is the first output sample to start with.
+   * @param[in]  numPoints   is the number of output points to be computed.
+   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
    */
-  void arm_biquad_cas_df1_32x64_init_q31(
-  arm_biquad_cas_df1_32x64_ins_q31 * S,
-  uint8_t numStages,
-  q31_t * pCoeffs,
-  q63_t * pState,
-  uint8_t postShift);
+  arm_status arm_conv_partial_fast_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints);
 
 
   /**
-   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief Partial convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in]  pSrcA       points to the first input sequence.
+   * @param[in]  srcALen     length of the first input sequence.
+   * @param[in]  pSrcB       points to the second input sequence.
+   * @param[in]  srcBLen     length of the second input sequence.
+   * @param[out] pDst        points to the block of output data
+   * @param[in]  firstIndex  is the first output sample to start with.
+   * @param[in]  numPoints   is the number of output points to be computed.
+   * @param[in]  pScratch1   points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]  pScratch2   points to scratch buffer of size min(srcALen, srcBLen).
+   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
    */
-  typedef struct
-  {
-    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
-    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-  } arm_biquad_cascade_df2T_instance_f32;
+  arm_status arm_conv_partial_fast_opt_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints,
+  q15_t * pScratch1,
+  q15_t * pScratch2);
 
-  /**
-   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
-   */
-  typedef struct
-  {
-    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 4*numStages. */
-    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-  } arm_biquad_cascade_stereo_df2T_instance_f32;
 
   /**
-   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief Partial convolution of Q31 sequences.
+   * @param[in]  pSrcA       points to the first input sequence.
+   * @param[in]  srcALen     length of the first input sequence.
+   * @param[in]  pSrcB       points to the second input sequence.
+   * @param[in]  srcBLen     length of the second input sequence.
+   * @param[out] pDst        points to the block of output data
+   * @param[in]  firstIndex  is the first output sample to start with.
+   * @param[in]  numPoints   is the number of output points to be computed.
+   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
    */
-  typedef struct
-  {
-    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float64_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
-    float64_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-  } arm_biquad_cascade_df2T_instance_f64;
+  arm_status arm_conv_partial_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints);
 
 
   /**
-   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in]  S          points to an instance of the filter data structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of samples to process.
+   * @brief Partial convolution of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in]  pSrcA       points to the first input sequence.
+   * @param[in]  srcALen     length of the first input sequence.
+   * @param[in]  pSrcB       points to the second input sequence.
+   * @param[in]  srcBLen     length of the second input sequence.
+   * @param[out] pDst        points to the block of output data
+   * @param[in]  firstIndex  is the first output sample to start with.
+   * @param[in]  numPoints   is the number of output points to be computed.
+   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
    */
-  void arm_biquad_cascade_df2T_f32(
-  const arm_biquad_cascade_df2T_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
-  uint32_t blockSize);
+  arm_status arm_conv_partial_fast_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints);
 
 
   /**
-   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. 2 channels
-   * @param[in]  S          points to an instance of the filter data structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of samples to process.
+   * @brief Partial convolution of Q7 sequences
+   * @param[in]  pSrcA       points to the first input sequence.
+   * @param[in]  srcALen     length of the first input sequence.
+   * @param[in]  pSrcB       points to the second input sequence.
+   * @param[in]  srcBLen     length of the second input sequence.
+   * @param[out] pDst        points to the block of output data
+   * @param[in]  firstIndex  is the first output sample to start with.
+   * @param[in]  numPoints   is the number of output points to be computed.
+   * @param[in]  pScratch1   points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]  pScratch2   points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen).
+   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
    */
-  void arm_biquad_cascade_stereo_df2T_f32(
-  const arm_biquad_cascade_stereo_df2T_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
-  uint32_t blockSize);
+  arm_status arm_conv_partial_opt_q7(
+  q7_t * pSrcA,
+  uint32_t srcALen,
+  q7_t * pSrcB,
+  uint32_t srcBLen,
+  q7_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints,
+  q15_t * pScratch1,
+  q15_t * pScratch2);
 
 
-  /**
-   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in]  S          points to an instance of the filter data structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of samples to process.
-   */
-  void arm_biquad_cascade_df2T_f64(
-  const arm_biquad_cascade_df2T_instance_f64 * S,
-  float64_t * pSrc,
-  float64_t * pDst,
-  uint32_t blockSize);
-
-
-  /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in,out] S          points to an instance of the filter data structure.
-   * @param[in]     numStages  number of 2nd order stages in the filter.
-   * @param[in]     pCoeffs    points to the filter coefficients.
-   * @param[in]     pState     points to the state buffer.
+/**
+   * @brief Partial convolution of Q7 sequences.
+   * @param[in]  pSrcA       points to the first input sequence.
+   * @param[in]  srcALen     length of the first input sequence.
+   * @param[in]  pSrcB       points to the second input sequence.
+   * @param[in]  srcBLen     length of the second input sequence.
+   * @param[out] pDst        points to the block of output data
+   * @param[in]  firstIndex  is the first output sample to start with.
+   * @param[in]  numPoints   is the number of output points to be computed.
+   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
    */
-  void arm_biquad_cascade_df2T_init_f32(
-  arm_biquad_cascade_df2T_instance_f32 * S,
-  uint8_t numStages,
-  float32_t * pCoeffs,
-  float32_t * pState);
+  arm_status arm_conv_partial_q7(
+  q7_t * pSrcA,
+  uint32_t srcALen,
+  q7_t * pSrcB,
+  uint32_t srcBLen,
+  q7_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints);
 
 
   /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in,out] S          points to an instance of the filter data structure.
-   * @param[in]     numStages  number of 2nd order stages in the filter.
-   * @param[in]     pCoeffs    points to the filter coefficients.
-   * @param[in]     pState     points to the state buffer.
+   * @brief Instance structure for the Q15 FIR decimator.
    */
-  void arm_biquad_cascade_stereo_df2T_init_f32(
-  arm_biquad_cascade_stereo_df2T_instance_f32 * S,
-  uint8_t numStages,
-  float32_t * pCoeffs,
-  float32_t * pState);
-
+  typedef struct
+  {
+    uint8_t M;                  /**< decimation factor. */
+    uint16_t numTaps;           /**< number of coefficients in the filter. */
+    q15_t *pCoeffs;             /**< points to the coefficient array. The array is of length numTaps.*/
+    q15_t *pState;              /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } arm_fir_decimate_instance_q15;
 
   /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in,out] S          points to an instance of the filter data structure.
-   * @param[in]     numStages  number of 2nd order stages in the filter.
-   * @param[in]     pCoeffs    points to the filter coefficients.
-   * @param[in]     pState     points to the state buffer.
+   * @brief Instance structure for the Q31 FIR decimator.
    */
-  void arm_biquad_cascade_df2T_init_f64(
-  arm_biquad_cascade_df2T_instance_f64 * S,
-  uint8_t numStages,
-  float64_t * pCoeffs,
-  float64_t * pState);
-
+  typedef struct
+  {
+    uint8_t M;                  /**< decimation factor. */
+    uint16_t numTaps;           /**< number of coefficients in the filter. */
+    q31_t *pCoeffs;             /**< points to the coefficient array. The array is of length numTaps.*/
+    q31_t *pState;              /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } arm_fir_decimate_instance_q31;
 
   /**
-   * @brief Instance structure for the Q15 FIR lattice filter.
+   * @brief Instance structure for the floating-point FIR decimator.
    */
   typedef struct
   {
-    uint16_t numStages;                  /**< number of filter stages. */
-    q15_t *pState;                       /**< points to the state variable array. The array is of length numStages. */
-    q15_t *pCoeffs;                      /**< points to the coefficient array. The array is of length numStages. */
-  } arm_fir_lattice_instance_q15;
+    uint8_t M;                  /**< decimation factor. */
+    uint16_t numTaps;           /**< number of coefficients in the filter. */
+    float32_t *pCoeffs;         /**< points to the coefficient array. The array is of length numTaps.*/
+    float32_t *pState;          /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } arm_fir_decimate_instance_f32;
+
 
   /**
-   * @brief Instance structure for the Q31 FIR lattice filter.
+   * @brief Processing function for the floating-point FIR decimator.
+   * @param[in]  S          points to an instance of the floating-point FIR decimator structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of input samples to process per call.
    */
-  typedef struct
-  {
-    uint16_t numStages;                  /**< number of filter stages. */
-    q31_t *pState;                       /**< points to the state variable array. The array is of length numStages. */
-    q31_t *pCoeffs;                      /**< points to the coefficient array. The array is of length numStages. */
-  } arm_fir_lattice_instance_q31;
+  void arm_fir_decimate_f32(
+  const arm_fir_decimate_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
 
   /**
-   * @brief Instance structure for the floating-point FIR lattice filter.
+   * @brief  Initialization function for the floating-point FIR decimator.
+   * @param[in,out] S          points to an instance of the floating-point FIR decimator structure.
+   * @param[in]     numTaps    number of coefficients in the filter.
+   * @param[in]     M          decimation factor.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>blockSize</code> is not a multiple of <code>M</code>.
    */
-  typedef struct
-  {
-    uint16_t numStages;                  /**< number of filter stages. */
-    float32_t *pState;                   /**< points to the state variable array. The array is of length numStages. */
-    float32_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numStages. */
-  } arm_fir_lattice_instance_f32;
+  arm_status arm_fir_decimate_init_f32(
+  arm_fir_decimate_instance_f32 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Initialization function for the Q15 FIR lattice filter.
-   * @param[in] S          points to an instance of the Q15 FIR lattice structure.
-   * @param[in] numStages  number of filter stages.
-   * @param[in] pCoeffs    points to the coefficient buffer.  The array is of length numStages.
-   * @param[in] pState     points to the state buffer.  The array is of length numStages.
+   * @brief Processing function for the Q15 FIR decimator.
+   * @param[in]  S          points to an instance of the Q15 FIR decimator structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of input samples to process per call.
    */
-  void arm_fir_lattice_init_q15(
-  arm_fir_lattice_instance_q15 * S,
-  uint16_t numStages,
-  q15_t * pCoeffs,
-  q15_t * pState);
+  void arm_fir_decimate_q15(
+  const arm_fir_decimate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Processing function for the Q15 FIR lattice filter.
-   * @param[in]  S          points to an instance of the Q15 FIR lattice structure.
+   * @brief Processing function for the Q15 FIR decimator (fast variant) for Cortex-M3 and Cortex-M4.
+   * @param[in]  S          points to an instance of the Q15 FIR decimator structure.
    * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data.
-   * @param[in]  blockSize  number of samples to process.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of input samples to process per call.
    */
-  void arm_fir_lattice_q15(
-  const arm_fir_lattice_instance_q15 * S,
+  void arm_fir_decimate_fast_q15(
+  const arm_fir_decimate_instance_q15 * S,
   q15_t * pSrc,
   q15_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief Initialization function for the Q31 FIR lattice filter.
-   * @param[in] S          points to an instance of the Q31 FIR lattice structure.
-   * @param[in] numStages  number of filter stages.
-   * @param[in] pCoeffs    points to the coefficient buffer.  The array is of length numStages.
-   * @param[in] pState     points to the state buffer.   The array is of length numStages.
+   * @brief  Initialization function for the Q15 FIR decimator.
+   * @param[in,out] S          points to an instance of the Q15 FIR decimator structure.
+   * @param[in]     numTaps    number of coefficients in the filter.
+   * @param[in]     M          decimation factor.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>blockSize</code> is not a multiple of <code>M</code>.
    */
-  void arm_fir_lattice_init_q31(
-  arm_fir_lattice_instance_q31 * S,
-  uint16_t numStages,
-  q31_t * pCoeffs,
-  q31_t * pState);
+  arm_status arm_fir_decimate_init_q15(
+  arm_fir_decimate_instance_q15 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Processing function for the Q31 FIR lattice filter.
-   * @param[in]  S          points to an instance of the Q31 FIR lattice structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of samples to process.
+   * @brief Processing function for the Q31 FIR decimator.
+   * @param[in]  S     points to an instance of the Q31 FIR decimator structure.
+   * @param[in]  pSrc  points to the block of input data.
+   * @param[out] pDst  points to the block of output data
+   * @param[in] blockSize number of input samples to process per call.
    */
-  void arm_fir_lattice_q31(
-  const arm_fir_lattice_instance_q31 * S,
+  void arm_fir_decimate_q31(
+  const arm_fir_decimate_instance_q31 * S,
   q31_t * pSrc,
   q31_t * pDst,
   uint32_t blockSize);
 
-
-/**
- * @brief Initialization function for the floating-point FIR lattice filter.
- * @param[in] S          points to an instance of the floating-point FIR lattice structure.
- * @param[in] numStages  number of filter stages.
- * @param[in] pCoeffs    points to the coefficient buffer.  The array is of length numStages.
- * @param[in] pState     points to the state buffer.  The array is of length numStages.
- */
-  void arm_fir_lattice_init_f32(
-  arm_fir_lattice_instance_f32 * S,
-  uint16_t numStages,
-  float32_t * pCoeffs,
-  float32_t * pState);
-
-
   /**
-   * @brief Processing function for the floating-point FIR lattice filter.
-   * @param[in]  S          points to an instance of the floating-point FIR lattice structure.
+   * @brief Processing function for the Q31 FIR decimator (fast variant) for Cortex-M3 and Cortex-M4.
+   * @param[in]  S          points to an instance of the Q31 FIR decimator structure.
    * @param[in]  pSrc       points to the block of input data.
    * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of samples to process.
+   * @param[in]  blockSize  number of input samples to process per call.
    */
-  void arm_fir_lattice_f32(
-  const arm_fir_lattice_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
+  void arm_fir_decimate_fast_q31(
+  arm_fir_decimate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief Instance structure for the Q15 IIR lattice filter.
+   * @brief  Initialization function for the Q31 FIR decimator.
+   * @param[in,out] S          points to an instance of the Q31 FIR decimator structure.
+   * @param[in]     numTaps    number of coefficients in the filter.
+   * @param[in]     M          decimation factor.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>blockSize</code> is not a multiple of <code>M</code>.
    */
-  typedef struct
-  {
-    uint16_t numStages;                  /**< number of stages in the filter. */
-    q15_t *pState;                       /**< points to the state variable array. The array is of length numStages+blockSize. */
-    q15_t *pkCoeffs;                     /**< points to the reflection coefficient array. The array is of length numStages. */
-    q15_t *pvCoeffs;                     /**< points to the ladder coefficient array. The array is of length numStages+1. */
-  } arm_iir_lattice_instance_q15;
+  arm_status arm_fir_decimate_init_q31(
+  arm_fir_decimate_instance_q31 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
 
   /**
-   * @brief Instance structure for the Q31 IIR lattice filter.
+   * @brief Instance structure for the Q15 FIR interpolator.
    */
   typedef struct
   {
-    uint16_t numStages;                  /**< number of stages in the filter. */
-    q31_t *pState;                       /**< points to the state variable array. The array is of length numStages+blockSize. */
-    q31_t *pkCoeffs;                     /**< points to the reflection coefficient array. The array is of length numStages. */
-    q31_t *pvCoeffs;                     /**< points to the ladder coefficient array. The array is of length numStages+1. */
-  } arm_iir_lattice_instance_q31;
+    uint8_t L;                      /**< upsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_interpolate_instance_q15;
 
   /**
-   * @brief Instance structure for the floating-point IIR lattice filter.
+   * @brief Instance structure for the Q31 FIR interpolator.
    */
   typedef struct
   {
-    uint16_t numStages;                  /**< number of stages in the filter. */
-    float32_t *pState;                   /**< points to the state variable array. The array is of length numStages+blockSize. */
-    float32_t *pkCoeffs;                 /**< points to the reflection coefficient array. The array is of length numStages. */
-    float32_t *pvCoeffs;                 /**< points to the ladder coefficient array. The array is of length numStages+1. */
-  } arm_iir_lattice_instance_f32;
+    uint8_t L;                      /**< upsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    q31_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_interpolate_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR interpolator.
+   */
+  typedef struct
+  {
+    uint8_t L;                     /**< upsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;             /**< points to the state variable array. The array is of length phaseLength+numTaps-1. */
+  } arm_fir_interpolate_instance_f32;
 
 
   /**
-   * @brief Processing function for the floating-point IIR lattice filter.
-   * @param[in]  S          points to an instance of the floating-point IIR lattice structure.
+   * @brief Processing function for the Q15 FIR interpolator.
+   * @param[in]  S          points to an instance of the Q15 FIR interpolator structure.
    * @param[in]  pSrc       points to the block of input data.
    * @param[out] pDst       points to the block of output data.
-   * @param[in]  blockSize  number of samples to process.
+   * @param[in]  blockSize  number of input samples to process per call.
    */
-  void arm_iir_lattice_f32(
-  const arm_iir_lattice_instance_f32 * S,
+  void arm_fir_interpolate_q15(
+  const arm_fir_interpolate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 FIR interpolator.
+   * @param[in,out] S          points to an instance of the Q15 FIR interpolator structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+  arm_status arm_fir_interpolate_init_q15(
+  arm_fir_interpolate_instance_q15 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 FIR interpolator.
+   * @param[in]  S          points to an instance of the Q15 FIR interpolator structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of input samples to process per call.
+   */
+  void arm_fir_interpolate_q31(
+  const arm_fir_interpolate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 FIR interpolator.
+   * @param[in,out] S          points to an instance of the Q31 FIR interpolator structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+  arm_status arm_fir_interpolate_init_q31(
+  arm_fir_interpolate_instance_q31 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point FIR interpolator.
+   * @param[in]  S          points to an instance of the floating-point FIR interpolator structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of input samples to process per call.
+   */
+  void arm_fir_interpolate_f32(
+  const arm_fir_interpolate_instance_f32 * S,
   float32_t * pSrc,
   float32_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief Initialization function for the floating-point IIR lattice filter.
-   * @param[in] S          points to an instance of the floating-point IIR lattice structure.
-   * @param[in] numStages  number of stages in the filter.
-   * @param[in] pkCoeffs   points to the reflection coefficient buffer.  The array is of length numStages.
-   * @param[in] pvCoeffs   points to the ladder coefficient buffer.  The array is of length numStages+1.
-   * @param[in] pState     points to the state buffer.  The array is of length numStages+blockSize-1.
-   * @param[in] blockSize  number of samples to process.
+   * @brief  Initialization function for the floating-point FIR interpolator.
+   * @param[in,out] S          points to an instance of the floating-point FIR interpolator structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
    */
-  void arm_iir_lattice_init_f32(
-  arm_iir_lattice_instance_f32 * S,
-  uint16_t numStages,
-  float32_t * pkCoeffs,
-  float32_t * pvCoeffs,
+  arm_status arm_fir_interpolate_init_f32(
+  arm_fir_interpolate_instance_f32 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
   float32_t * pState,
   uint32_t blockSize);
 
 
   /**
-   * @brief Processing function for the Q31 IIR lattice filter.
-   * @param[in]  S          points to an instance of the Q31 IIR lattice structure.
+   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cas_df1_32x64_ins_q31;
+
+
+  /**
+   * @param[in]  S          points to an instance of the high precision Q31 Biquad cascade filter structure.
    * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data.
+   * @param[out] pDst       points to the block of output data
    * @param[in]  blockSize  number of samples to process.
    */
-  void arm_iir_lattice_q31(
-  const arm_iir_lattice_instance_q31 * S,
+  void arm_biquad_cas_df1_32x64_q31(
+  const arm_biquad_cas_df1_32x64_ins_q31 * S,
   q31_t * pSrc,
   q31_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief Initialization function for the Q31 IIR lattice filter.
-   * @param[in] S          points to an instance of the Q31 IIR lattice structure.
-   * @param[in] numStages  number of stages in the filter.
-   * @param[in] pkCoeffs   points to the reflection coefficient buffer.  The array is of length numStages.
-   * @param[in] pvCoeffs   points to the ladder coefficient buffer.  The array is of length numStages+1.
-   * @param[in] pState     points to the state buffer.  The array is of length numStages+blockSize.
-   * @param[in] blockSize  number of samples to process.
+   * @param[in,out] S          points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     postShift  shift to be applied to the output. Varies according to the coefficients format
    */
-  void arm_iir_lattice_init_q31(
-  arm_iir_lattice_instance_q31 * S,
-  uint16_t numStages,
-  q31_t * pkCoeffs,
-  q31_t * pvCoeffs,
-  q31_t * pState,
+  void arm_biquad_cas_df1_32x64_init_q31(
+  arm_biquad_cas_df1_32x64_ins_q31 * S,
+  uint8_t numStages,
+  q31_t * pCoeffs,
+  q63_t * pState,
+  uint8_t postShift);
+
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_df2T_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_stereo_df2T_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float64_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    float64_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_df2T_instance_f64;
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_biquad_cascade_df2T_f32(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. 2 channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_biquad_cascade_stereo_df2T_f32(
+  const arm_biquad_cascade_stereo_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_biquad_cascade_df2T_f64(
+  const arm_biquad_cascade_df2T_instance_f64 * S,
+  float64_t * pSrc,
+  float64_t * pDst,
   uint32_t blockSize);
 
 
-  /**
-   * @brief Processing function for the Q15 IIR lattice filter.
-   * @param[in]  S          points to an instance of the Q15 IIR lattice structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data.
-   * @param[in]  blockSize  number of samples to process.
-   */
-  void arm_iir_lattice_q15(
-  const arm_iir_lattice_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pDst,
-  uint32_t blockSize);
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   */
+  void arm_biquad_cascade_df2T_init_f32(
+  arm_biquad_cascade_df2T_instance_f32 * S,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   */
+  void arm_biquad_cascade_stereo_df2T_init_f32(
+  arm_biquad_cascade_stereo_df2T_instance_f32 * S,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   */
+  void arm_biquad_cascade_df2T_init_f64(
+  arm_biquad_cascade_df2T_instance_f64 * S,
+  uint8_t numStages,
+  float64_t * pCoeffs,
+  float64_t * pState);
+
+
+  /**
+   * @brief Instance structure for the Q15 FIR lattice filter.
+   */
+  typedef struct
+  {
+    uint16_t numStages;                  /**< number of filter stages. */
+    q15_t *pState;                       /**< points to the state variable array. The array is of length numStages. */
+    q15_t *pCoeffs;                      /**< points to the coefficient array. The array is of length numStages. */
+  } arm_fir_lattice_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR lattice filter.
+   */
+  typedef struct
+  {
+    uint16_t numStages;                  /**< number of filter stages. */
+    q31_t *pState;                       /**< points to the state variable array. The array is of length numStages. */
+    q31_t *pCoeffs;                      /**< points to the coefficient array. The array is of length numStages. */
+  } arm_fir_lattice_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR lattice filter.
+   */
+  typedef struct
+  {
+    uint16_t numStages;                  /**< number of filter stages. */
+    float32_t *pState;                   /**< points to the state variable array. The array is of length numStages. */
+    float32_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numStages. */
+  } arm_fir_lattice_instance_f32;
+
+
+  /**
+   * @brief Initialization function for the Q15 FIR lattice filter.
+   * @param[in] S          points to an instance of the Q15 FIR lattice structure.
+   * @param[in] numStages  number of filter stages.
+   * @param[in] pCoeffs    points to the coefficient buffer.  The array is of length numStages.
+   * @param[in] pState     points to the state buffer.  The array is of length numStages.
+   */
+  void arm_fir_lattice_init_q15(
+  arm_fir_lattice_instance_q15 * S,
+  uint16_t numStages,
+  q15_t * pCoeffs,
+  q15_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q15 FIR lattice filter.
+   * @param[in]  S          points to an instance of the Q15 FIR lattice structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_fir_lattice_q15(
+  const arm_fir_lattice_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for the Q31 FIR lattice filter.
+   * @param[in] S          points to an instance of the Q31 FIR lattice structure.
+   * @param[in] numStages  number of filter stages.
+   * @param[in] pCoeffs    points to the coefficient buffer.  The array is of length numStages.
+   * @param[in] pState     points to the state buffer.   The array is of length numStages.
+   */
+  void arm_fir_lattice_init_q31(
+  arm_fir_lattice_instance_q31 * S,
+  uint16_t numStages,
+  q31_t * pCoeffs,
+  q31_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q31 FIR lattice filter.
+   * @param[in]  S          points to an instance of the Q31 FIR lattice structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_fir_lattice_q31(
+  const arm_fir_lattice_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+/**
+ * @brief Initialization function for the floating-point FIR lattice filter.
+ * @param[in] S          points to an instance of the floating-point FIR lattice structure.
+ * @param[in] numStages  number of filter stages.
+ * @param[in] pCoeffs    points to the coefficient buffer.  The array is of length numStages.
+ * @param[in] pState     points to the state buffer.  The array is of length numStages.
+ */
+  void arm_fir_lattice_init_f32(
+  arm_fir_lattice_instance_f32 * S,
+  uint16_t numStages,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+
+  /**
+   * @brief Processing function for the floating-point FIR lattice filter.
+   * @param[in]  S          points to an instance of the floating-point FIR lattice structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_fir_lattice_f32(
+  const arm_fir_lattice_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q15 IIR lattice filter.
+   */
+  typedef struct
+  {
+    uint16_t numStages;                  /**< number of stages in the filter. */
+    q15_t *pState;                       /**< points to the state variable array. The array is of length numStages+blockSize. */
+    q15_t *pkCoeffs;                     /**< points to the reflection coefficient array. The array is of length numStages. */
+    q15_t *pvCoeffs;                     /**< points to the ladder coefficient array. The array is of length numStages+1. */
+  } arm_iir_lattice_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 IIR lattice filter.
+   */
+  typedef struct
+  {
+    uint16_t numStages;                  /**< number of stages in the filter. */
+    q31_t *pState;                       /**< points to the state variable array. The array is of length numStages+blockSize. */
+    q31_t *pkCoeffs;                     /**< points to the reflection coefficient array. The array is of length numStages. */
+    q31_t *pvCoeffs;                     /**< points to the ladder coefficient array. The array is of length numStages+1. */
+  } arm_iir_lattice_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point IIR lattice filter.
+   */
+  typedef struct
+  {
+    uint16_t numStages;                  /**< number of stages in the filter. */
+    float32_t *pState;                   /**< points to the state variable array. The array is of length numStages+blockSize. */
+    float32_t *pkCoeffs;                 /**< points to the reflection coefficient array. The array is of length numStages. */
+    float32_t *pvCoeffs;                 /**< points to the ladder coefficient array. The array is of length numStages+1. */
+  } arm_iir_lattice_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point IIR lattice filter.
+   * @param[in]  S          points to an instance of the floating-point IIR lattice structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_iir_lattice_f32(
+  const arm_iir_lattice_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for the floating-point IIR lattice filter.
+   * @param[in] S          points to an instance of the floating-point IIR lattice structure.
+   * @param[in] numStages  number of stages in the filter.
+   * @param[in] pkCoeffs   points to the reflection coefficient buffer.  The array is of length numStages.
+   * @param[in] pvCoeffs   points to the ladder coefficient buffer.  The array is of length numStages+1.
+   * @param[in] pState     points to the state buffer.  The array is of length numStages+blockSize-1.
+   * @param[in] blockSize  number of samples to process.
+   */
+  void arm_iir_lattice_init_f32(
+  arm_iir_lattice_instance_f32 * S,
+  uint16_t numStages,
+  float32_t * pkCoeffs,
+  float32_t * pvCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 IIR lattice filter.
+   * @param[in]  S          points to an instance of the Q31 IIR lattice structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_iir_lattice_q31(
+  const arm_iir_lattice_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for the Q31 IIR lattice filter.
+   * @param[in] S          points to an instance of the Q31 IIR lattice structure.
+   * @param[in] numStages  number of stages in the filter.
+   * @param[in] pkCoeffs   points to the reflection coefficient buffer.  The array is of length numStages.
+   * @param[in] pvCoeffs   points to the ladder coefficient buffer.  The array is of length numStages+1.
+   * @param[in] pState     points to the state buffer.  The array is of length numStages+blockSize.
+   * @param[in] blockSize  number of samples to process.
+   */
+  void arm_iir_lattice_init_q31(
+  arm_iir_lattice_instance_q31 * S,
+  uint16_t numStages,
+  q31_t * pkCoeffs,
+  q31_t * pvCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q15 IIR lattice filter.
+   * @param[in]  S          points to an instance of the Q15 IIR lattice structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_iir_lattice_q15(
+  const arm_iir_lattice_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+/**
+ * @brief Initialization function for the Q15 IIR lattice filter.
+ * @param[in] S          points to an instance of the fixed-point Q15 IIR lattice structure.
+ * @param[in] numStages  number of stages in the filter.
+ * @param[in] pkCoeffs   points to reflection coefficient buffer.  The array is of length numStages.
+ * @param[in] pvCoeffs   points to ladder coefficient buffer.  The array is of length numStages+1.
+ * @param[in] pState     points to state buffer.  The array is of length numStages+blockSize.
+ * @param[in] blockSize  number of samples to process per call.
+ */
+  void arm_iir_lattice_init_q15(
+  arm_iir_lattice_instance_q15 * S,
+  uint16_t numStages,
+  q15_t * pkCoeffs,
+  q15_t * pvCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the floating-point LMS filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;    /**< number of coefficients in the filter. */
+    float32_t *pState;   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t *pCoeffs;  /**< points to the coefficient array. The array is of length numTaps. */
+    float32_t mu;        /**< step size that controls filter coefficient updates. */
+  } arm_lms_instance_f32;
+
+
+  /**
+   * @brief Processing function for floating-point LMS filter.
+   * @param[in]  S          points to an instance of the floating-point LMS filter structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[in]  pRef       points to the block of reference data.
+   * @param[out] pOut       points to the block of output data.
+   * @param[out] pErr       points to the block of error data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_lms_f32(
+  const arm_lms_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for floating-point LMS filter.
+   * @param[in] S          points to an instance of the floating-point LMS filter structure.
+   * @param[in] numTaps    number of filter coefficients.
+   * @param[in] pCoeffs    points to the coefficient buffer.
+   * @param[in] pState     points to state buffer.
+   * @param[in] mu         step size that controls filter coefficient updates.
+   * @param[in] blockSize  number of samples to process.
+   */
+  void arm_lms_init_f32(
+  arm_lms_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t mu,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q15 LMS filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;    /**< number of coefficients in the filter. */
+    q15_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q15_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
+    q15_t mu;            /**< step size that controls filter coefficient updates. */
+    uint32_t postShift;  /**< bit shift applied to coefficients. */
+  } arm_lms_instance_q15;
+
+
+  /**
+   * @brief Initialization function for the Q15 LMS filter.
+   * @param[in] S          points to an instance of the Q15 LMS filter structure.
+   * @param[in] numTaps    number of filter coefficients.
+   * @param[in] pCoeffs    points to the coefficient buffer.
+   * @param[in] pState     points to the state buffer.
+   * @param[in] mu         step size that controls filter coefficient updates.
+   * @param[in] blockSize  number of samples to process.
+   * @param[in] postShift  bit shift applied to coefficients.
+   */
+  void arm_lms_init_q15(
+  arm_lms_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  q15_t mu,
+  uint32_t blockSize,
+  uint32_t postShift);
+
+
+  /**
+   * @brief Processing function for Q15 LMS filter.
+   * @param[in]  S          points to an instance of the Q15 LMS filter structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[in]  pRef       points to the block of reference data.
+   * @param[out] pOut       points to the block of output data.
+   * @param[out] pErr       points to the block of error data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_lms_q15(
+  const arm_lms_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pRef,
+  q15_t * pOut,
+  q15_t * pErr,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q31 LMS filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;    /**< number of coefficients in the filter. */
+    q31_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q31_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
+    q31_t mu;            /**< step size that controls filter coefficient updates. */
+    uint32_t postShift;  /**< bit shift applied to coefficients. */
+  } arm_lms_instance_q31;
+
+
+  /**
+   * @brief Processing function for Q31 LMS filter.
+   * @param[in]  S          points to an instance of the Q15 LMS filter structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[in]  pRef       points to the block of reference data.
+   * @param[out] pOut       points to the block of output data.
+   * @param[out] pErr       points to the block of error data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_lms_q31(
+  const arm_lms_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pRef,
+  q31_t * pOut,
+  q31_t * pErr,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for Q31 LMS filter.
+   * @param[in] S          points to an instance of the Q31 LMS filter structure.
+   * @param[in] numTaps    number of filter coefficients.
+   * @param[in] pCoeffs    points to coefficient buffer.
+   * @param[in] pState     points to state buffer.
+   * @param[in] mu         step size that controls filter coefficient updates.
+   * @param[in] blockSize  number of samples to process.
+   * @param[in] postShift  bit shift applied to coefficients.
+   */
+  void arm_lms_init_q31(
+  arm_lms_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t mu,
+  uint32_t blockSize,
+  uint32_t postShift);
+
+
+  /**
+   * @brief Instance structure for the floating-point normalized LMS filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;     /**< number of coefficients in the filter. */
+    float32_t *pState;    /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
+    float32_t mu;         /**< step size that control filter coefficient updates. */
+    float32_t energy;     /**< saves previous frame energy. */
+    float32_t x0;         /**< saves previous input sample. */
+  } arm_lms_norm_instance_f32;
+
+
+  /**
+   * @brief Processing function for floating-point normalized LMS filter.
+   * @param[in]  S          points to an instance of the floating-point normalized LMS filter structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[in]  pRef       points to the block of reference data.
+   * @param[out] pOut       points to the block of output data.
+   * @param[out] pErr       points to the block of error data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_lms_norm_f32(
+  arm_lms_norm_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for floating-point normalized LMS filter.
+   * @param[in] S          points to an instance of the floating-point LMS filter structure.
+   * @param[in] numTaps    number of filter coefficients.
+   * @param[in] pCoeffs    points to coefficient buffer.
+   * @param[in] pState     points to state buffer.
+   * @param[in] mu         step size that controls filter coefficient updates.
+   * @param[in] blockSize  number of samples to process.
+   */
+  void arm_lms_norm_init_f32(
+  arm_lms_norm_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t mu,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q31 normalized LMS filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;     /**< number of coefficients in the filter. */
+    q31_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q31_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+    q31_t mu;             /**< step size that controls filter coefficient updates. */
+    uint8_t postShift;    /**< bit shift applied to coefficients. */
+    q31_t *recipTable;    /**< points to the reciprocal initial value table. */
+    q31_t energy;         /**< saves previous frame energy. */
+    q31_t x0;             /**< saves previous input sample. */
+  } arm_lms_norm_instance_q31;
+
+
+  /**
+   * @brief Processing function for Q31 normalized LMS filter.
+   * @param[in]  S          points to an instance of the Q31 normalized LMS filter structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[in]  pRef       points to the block of reference data.
+   * @param[out] pOut       points to the block of output data.
+   * @param[out] pErr       points to the block of error data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_lms_norm_q31(
+  arm_lms_norm_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pRef,
+  q31_t * pOut,
+  q31_t * pErr,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for Q31 normalized LMS filter.
+   * @param[in] S          points to an instance of the Q31 normalized LMS filter structure.
+   * @param[in] numTaps    number of filter coefficients.
+   * @param[in] pCoeffs    points to coefficient buffer.
+   * @param[in] pState     points to state buffer.
+   * @param[in] mu         step size that controls filter coefficient updates.
+   * @param[in] blockSize  number of samples to process.
+   * @param[in] postShift  bit shift applied to coefficients.
+   */
+  void arm_lms_norm_init_q31(
+  arm_lms_norm_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t mu,
+  uint32_t blockSize,
+  uint8_t postShift);
+
+
+  /**
+   * @brief Instance structure for the Q15 normalized LMS filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;     /**< Number of coefficients in the filter. */
+    q15_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q15_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+    q15_t mu;             /**< step size that controls filter coefficient updates. */
+    uint8_t postShift;    /**< bit shift applied to coefficients. */
+    q15_t *recipTable;    /**< Points to the reciprocal initial value table. */
+    q15_t energy;         /**< saves previous frame energy. */
+    q15_t x0;             /**< saves previous input sample. */
+  } arm_lms_norm_instance_q15;
+
+
+  /**
+   * @brief Processing function for Q15 normalized LMS filter.
+   * @param[in]  S          points to an instance of the Q15 normalized LMS filter structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[in]  pRef       points to the block of reference data.
+   * @param[out] pOut       points to the block of output data.
+   * @param[out] pErr       points to the block of error data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_lms_norm_q15(
+  arm_lms_norm_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pRef,
+  q15_t * pOut,
+  q15_t * pErr,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for Q15 normalized LMS filter.
+   * @param[in] S          points to an instance of the Q15 normalized LMS filter structure.
+   * @param[in] numTaps    number of filter coefficients.
+   * @param[in] pCoeffs    points to coefficient buffer.
+   * @param[in] pState     points to state buffer.
+   * @param[in] mu         step size that controls filter coefficient updates.
+   * @param[in] blockSize  number of samples to process.
+   * @param[in] postShift  bit shift applied to coefficients.
+   */
+  void arm_lms_norm_init_q15(
+  arm_lms_norm_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  q15_t mu,
+  uint32_t blockSize,
+  uint8_t postShift);
+
+
+  /**
+   * @brief Correlation of floating-point sequences.
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  pSrcB    points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   */
+  void arm_correlate_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst);
+
+
+  /**
+   * @brief FFT-based convolution of floating-point sequences.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the location where the output result is written.  Length srcALen+srcBLen-1.
+   * @param[in]  pScratch  points to the scratch buffer, 2 * fftLen values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if srcALen+srcBLen-1 is more than 4096.
+   */
+  arm_status arm_conv_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch);
+
+
+  /**
+   * @brief FFT-based correlation of floating-point sequences.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch  points to the scratch buffer, 2 * fftLen values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if srcALen+srcBLen-1 is more than 4096.
+   */
+  arm_status arm_correlate_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch);
+
+
+  /**
+   * @brief Generalized cross-correlation with phase transform of floating-point sequences.
+   * @param[in]  pSrcA      points to the first input sequence.
+   * @param[in]  pSrcB      points to the second input sequence.
+   * @param[in]  blockSize  length of each input sequence, at most 2048.
+   * @param[out] pDst       points to the block of output data  Length 2 * blockSize - 1.
+   * @param[in]  pScratch   points to the scratch buffer, 2 * fftLen values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if blockSize is 0 or more than 2048.
+   */
+  arm_status arm_gcc_phat_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  uint32_t blockSize,
+  float32_t * pDst,
+  float32_t * pScratch);
+
+
+  /**
+   * @brief Convolution of floating-point sequences with the faster of the direct and FFT methods.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the location where the output result is written.  Length srcALen+srcBLen-1.
+   * @param[in]  pScratch  points to the scratch buffer of the FFT method, 2 * fftLen values, or NULL.
+   */
+  void arm_conv_auto_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch);
+
+
+  /**
+   * @brief Correlation of floating-point sequences with the faster of the direct and FFT methods.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch  points to the scratch buffer of the FFT method, 2 * fftLen values, or NULL.
+   */
+  void arm_correlate_auto_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch);
+
+
+   /**
+   * @brief Correlation of Q15 sequences
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   */
+  void arm_correlate_opt_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pScratch);
+
+
+  /**
+   * @brief Correlation of Q15 sequences.
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  pSrcB    points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   */
+
+  void arm_correlate_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst);
+
+
+  /**
+   * @brief Correlation of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4.
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  pSrcB    points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   */
+
+  void arm_correlate_fast_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst);
+
+
+  /**
+   * @brief Correlation of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   */
+  void arm_correlate_fast_opt_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pScratch);
+
+
+  /**
+   * @brief Correlation of Q31 sequences.
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  pSrcB    points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   */
+  void arm_correlate_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst);
+
+
+  /**
+   * @brief Correlation of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  pSrcB    points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   */
+  void arm_correlate_fast_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst);
+
+
+ /**
+   * @brief Correlation of Q7 sequences.
+   * @param[in]  pSrcA      points to the first input sequence.
+   * @param[in]  srcALen    length of the first input sequence.
+   * @param[in]  pSrcB      points to the second input sequence.
+   * @param[in]  srcBLen    length of the second input sequence.
+   * @param[out] pDst       points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch1  points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]  pScratch2  points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen).
+   */
+  void arm_correlate_opt_q7(
+  q7_t * pSrcA,
+  uint32_t srcALen,
+  q7_t * pSrcB,
+  uint32_t srcBLen,
+  q7_t * pDst,
+  q15_t * pScratch1,
+  q15_t * pScratch2);
+
+
+  /**
+   * @brief Correlation of Q7 sequences.
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  pSrcB    points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   */
+  void arm_correlate_q7(
+  q7_t * pSrcA,
+  uint32_t srcALen,
+  q7_t * pSrcB,
+  uint32_t srcBLen,
+  q7_t * pDst);
+
+
+  /**
+   * @brief Instance structure for the floating-point sparse FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    float32_t *pState;            /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    float32_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sparse FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    q31_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    q31_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sparse FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    q15_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    q15_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q7 sparse FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    q7_t *pState;                 /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    q7_t *pCoeffs;                /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_q7;
+
+
+  /**
+   * @brief Processing function for the floating-point sparse FIR filter.
+   * @param[in]  S           points to an instance of the floating-point sparse FIR structure.
+   * @param[in]  pSrc        points to the block of input data.
+   * @param[out] pDst        points to the block of output data
+   * @param[in]  pScratchIn  points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize   number of input samples to process per call.
+   */
+  void arm_fir_sparse_f32(
+  arm_fir_sparse_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pScratchIn,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point sparse FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     pCoeffs    points to the array of filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     pTapDelay  points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   */
+  void arm_fir_sparse_init_f32(
+  arm_fir_sparse_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  int32_t * pTapDelay,
+  uint16_t maxDelay,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 sparse FIR filter.
+   * @param[in]  S           points to an instance of the Q31 sparse FIR structure.
+   * @param[in]  pSrc        points to the block of input data.
+   * @param[out] pDst        points to the block of output data
+   * @param[in]  pScratchIn  points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize   number of input samples to process per call.
+   */
+  void arm_fir_sparse_q31(
+  arm_fir_sparse_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  q31_t * pScratchIn,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 sparse FIR filter.
+   * @param[in,out] S          points to an instance of the Q31 sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     pCoeffs    points to the array of filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     pTapDelay  points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   */
+  void arm_fir_sparse_init_q31(
+  arm_fir_sparse_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  int32_t * pTapDelay,
+  uint16_t maxDelay,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q15 sparse FIR filter.
+   * @param[in]  S            points to an instance of the Q15 sparse FIR structure.
+   * @param[in]  pSrc         points to the block of input data.
+   * @param[out] pDst         points to the block of output data
+   * @param[in]  pScratchIn   points to a temporary buffer of size blockSize.
+   * @param[in]  pScratchOut  points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize    number of input samples to process per call.
+   */
+  void arm_fir_sparse_q15(
+  arm_fir_sparse_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  q15_t * pScratchIn,
+  q31_t * pScratchOut,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 sparse FIR filter.
+   * @param[in,out] S          points to an instance of the Q15 sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     pCoeffs    points to the array of filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     pTapDelay  points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   */
+  void arm_fir_sparse_init_q15(
+  arm_fir_sparse_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  int32_t * pTapDelay,
+  uint16_t maxDelay,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q7 sparse FIR filter.
+   * @param[in]  S            points to an instance of the Q7 sparse FIR structure.
+   * @param[in]  pSrc         points to the block of input data.
+   * @param[out] pDst         points to the block of output data
+   * @param[in]  pScratchIn   points to a temporary buffer of size blockSize.
+   * @param[in]  pScratchOut  points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize    number of input samples to process per call.
+   */
+  void arm_fir_sparse_q7(
+  arm_fir_sparse_instance_q7 * S,
+  q7_t * pSrc,
+  q7_t * pDst,
+  q7_t * pScratchIn,
+  q31_t * pScratchOut,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q7 sparse FIR filter.
+   * @param[in,out] S          points to an instance of the Q7 sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     pCoeffs    points to the array of filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     pTapDelay  points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   */
+  void arm_fir_sparse_init_q7(
+  arm_fir_sparse_instance_q7 * S,
+  uint16_t numTaps,
+  q7_t * pCoeffs,
+  q7_t * pState,
+  int32_t * pTapDelay,
+  uint16_t maxDelay,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point sin_cos function.
+   * @param[in]  theta   input value in degrees
+   * @param[out] pSinVal  points to the processed sine output.
+   * @param[out] pCosVal  points to the processed cos output.
+   */
+  void arm_sin_cos_f32(
+  float32_t theta,
+  float32_t * pSinVal,
+  float32_t * pCosVal);
+
+
+  /**
+   * @brief  Q31 sin_cos function.
+   * @param[in]  theta    scaled input value in degrees
+   * @param[out] pSinVal  points to the processed sine output.
+   * @param[out] pCosVal  points to the processed cosine output.
+   */
+  void arm_sin_cos_q31(
+  q31_t theta,
+  q31_t * pSinVal,
+  q31_t * pCosVal);
+
+
+  /**
+   * @brief  Floating-point complex conjugate.
+   * @param[in]  pSrc        points to the input vector
+   * @param[out] pDst        points to the output vector
+   * @param[in]  numSamples  number of complex samples in each vector
+   */
+  void arm_cmplx_conj_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex conjugate.
+   * @param[in]  pSrc        points to the input vector
+   * @param[out] pDst        points to the output vector
+   * @param[in]  numSamples  number of complex samples in each vector
+   */
+  void arm_cmplx_conj_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Q15 complex conjugate.
+   * @param[in]  pSrc        points to the input vector
+   * @param[out] pDst        points to the output vector
+   * @param[in]  numSamples  number of complex samples in each vector
+   */
+  void arm_cmplx_conj_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Floating-point complex magnitude squared
+   * @param[in]  pSrc        points to the complex input vector
+   * @param[out] pDst        points to the real output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_mag_squared_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Q31 complex magnitude squared
+   * @param[in]  pSrc        points to the complex input vector
+   * @param[out] pDst        points to the real output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_mag_squared_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Q15 complex magnitude squared
+   * @param[in]  pSrc        points to the complex input vector
+   * @param[out] pDst        points to the real output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_mag_squared_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples);
+
+
+ /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup PID PID Motor Control
+   *
+   * A Proportional Integral Derivative (PID) controller is a generic feedback control
+   * loop mechanism widely used in industrial control systems.
+   * A PID controller is the most commonly used type of feedback controller.
+   *
+   * This set of functions implements (PID) controllers
+   * for Q15, Q31, and floating-point data types.  The functions operate on a single sample
+   * of data and each call to the function returns a single processed value.
+   * <code>S</code> points to an instance of the PID control data structure.  <code>in</code>
+   * is the input sample value. The functions return the output value.
+   *
+   * \par Algorithm:
+   * <pre>
+   *    y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]
+   *    A0 = Kp + Ki + Kd
+   *    A1 = (-Kp ) - (2 * Kd )
+   *    A2 = Kd  </pre>
+   *
+   * \par
+   * where \c Kp is proportional constant, \c Ki is Integral constant and \c Kd is Derivative constant
+   *
+   * \par
+   * \image html PID.gif "Proportional Integral Derivative Controller"
+   *
+   * \par
+   * The PID controller calculates an "error" value as the difference between
+   * the measured output and the reference input.
+   * The controller attempts to minimize the error by adjusting the process control inputs.
+   * The proportional value determines the reaction to the current error,
+   * the integral value determines the reaction based on the sum of recent errors,
+   * and the derivative value determines the reaction based on the rate at which the error has been changing.
+   *
+   * \par Instance Structure
+   * The Gains A0, A1, A2 and state variables for a PID controller are stored together in an instance data structure.
+   * A separate instance structure must be defined for each PID Controller.
+   * There are separate instance structure declarations for each of the 3 supported data types.
+   *
+   * \par Reset Functions
+   * There is also an associated reset function for each data type which clears the state array.
+   *
+   * \par Initialization Functions
+   * There is also an associated initialization function for each data type.
+   * The initialization function performs the following operations:
+   * - Initializes the Gains A0, A1, A2 from Kp,Ki, Kd gains.
+   * - Zeros out the values in the state buffer.
+   *
+   * \par
+   * Instance structure cannot be placed into a const data section and it is recommended to use the initialization function.
+   *
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the fixed-point versions of the PID Controller functions.
+   * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+   */
+
+  /**
+   * @addtogroup PID
+   * @{
+   */
+
+  /**
+   * @brief  Process function for the floating-point PID Control.
+   * @param[in,out] S   is an instance of the floating-point PID Control structure
+   * @param[in]     in  input sample to process
+   * @return out processed output sample.
+   */
+  CMSIS_INLINE __STATIC_INLINE float32_t arm_pid_f32(
+  arm_pid_instance_f32 * S,
+  float32_t in)
+  {
+    float32_t out;
+
+    /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]  */
+    out = (S->A0 * in) +
+      (S->A1 * S->state[0]) + (S->A2 * S->state[1]) + (S->state[2]);
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
+
+    /* return to application */
+    return (out);
+
+  }
+
+  /**
+   * @brief  Process function for the Q31 PID Control.
+   * @param[in,out] S  points to an instance of the Q31 PID Control structure
+   * @param[in]     in  input sample to process
+   * @return out processed output sample.
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 64-bit accumulator.
+   * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+   * Thus, if the accumulator result overflows it wraps around rather than clip.
+   * In order to avoid overflows completely the input signal must be scaled down by 2 bits as there are four additions.
+   * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.32 format and then saturated to 1.31 format.
+   */
+  CMSIS_INLINE __STATIC_INLINE q31_t arm_pid_q31(
+  arm_pid_instance_q31 * S,
+  q31_t in)
+  {
+    q63_t acc;
+    q31_t out;
+
+    /* acc = A0 * x[n]  */
+    acc = (q63_t) S->A0 * in;
+
+    /* acc += A1 * x[n-1] */
+    acc += (q63_t) S->A1 * S->state[0];
+
+    /* acc += A2 * x[n-2]  */
+    acc += (q63_t) S->A2 * S->state[1];
+
+    /* convert output to 1.31 format to add y[n-1] */
+    out = (q31_t) (acc >> 31U);
+
+    /* out += y[n-1] */
+    out += S->state[2];
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
+
+    /* return to application */
+    return (out);
+  }
+
+
+  /**
+   * @brief  Process function for the Q15 PID Control.
+   * @param[in,out] S   points to an instance of the Q15 PID Control structure
+   * @param[in]     in  input sample to process
+   * @return out processed output sample.
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using a 64-bit internal accumulator.
+   * Both Gains and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+   * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+   * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
+   * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+   * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+   */
+  CMSIS_INLINE __STATIC_INLINE q15_t arm_pid_q15(
+  arm_pid_instance_q15 * S,
+  q15_t in)
+  {
+    q63_t acc;
+    q15_t out;
+
+#if defined (ARM_MATH_DSP)
+    __SIMD32_TYPE *vstate;
+
+    /* Implementation of PID controller */
+
+    /* acc = A0 * x[n]  */
+    acc = (q31_t) __SMUAD((uint32_t)S->A0, (uint32_t)in);
+
+    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
+    vstate = __SIMD32_CONST(S->state);
+    acc = (q63_t)__SMLALD((uint32_t)S->A1, (uint32_t)*vstate, (uint64_t)acc);
+#else
+    /* acc = A0 * x[n]  */
+    acc = ((q31_t) S->A0) * in;
+
+    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
+    acc += (q31_t) S->A1 * S->state[0];
+    acc += (q31_t) S->A2 * S->state[1];
+#endif
+
+    /* acc += y[n-1] */
+    acc += (q31_t) S->state[2] << 15;
+
+    /* saturate the output */
+    out = (q15_t) (__SSAT((acc >> 15), 16));
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
+
+    /* return to application */
+    return (out);
+  }
+
+  /**
+   * @} end of PID group
+   */
+
+ /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup PIDExt Extended PID Control
+   *
+   * PID controllers with output limits, integrator anti-windup, a low-pass filter
+   * on the derivative term and bumpless gain changes, for Q15, Q31 and floating-point data types.
+   * <code>S</code> points to an instance of the extended PID control data structure.  <code>in</code>
+   * is the input sample value, usually the error between the reference and the measurement.
+   * The functions return the output value.
+   *
+   * \par Algorithm:
+   * The controller is computed in positional form, with the integral term kept in the instance:
+   * <pre>
+   *    d[n] = d[n-1] + alpha * ((x[n] - x[n-1]) - d[n-1])
+   *    i[n] = i[n-1] + Ki * x[n]
+   *    y[n] = Kp * x[n] + i[n] + Kd * d[n]  </pre>
+   * \par
+   * <code>y[n]</code> is clamped to <code>[outMin outMax]</code>.  When the output is clamped and the
+   * integral increment would drive it further into the limit, the increment is discarded
+   * (conditional integration), so the integral term never winds up beyond what the output can deliver.
+   * <code>alpha</code> sets the corner of the first order low-pass filter on the derivative term:
+   * <code>alpha = 1 - exp(-2 * pi * fc / fs)</code>, and 1 disables the filter.
+   *
+   * \par
+   * The controllers differ from the \ref PID functions, which implement the incremental form
+   * <code>y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]</code>: the incremental form has
+   * no integral term that can be clamped and every gain change shows as a step of the output.
+   * A single step costs a few more multiplications and two comparisons.
+   *
+   * \par Bumpless Gain Changes
+   * The integral term stores the sum of the <code>Ki * x[n]</code> products, so a change of \c Ki
+   * does not move the output.  <code>arm_pid_ext_set_gains_xxx()</code> also moves the change of the
+   * proportional and derivative terms into the integral term, so that the output computed
+   * with the last input is unchanged.
+   *
+   * \par Batch Mode
+   * <code>arm_pid_ext_batch_xxx()</code> steps an array of independent controllers, one input
+   * and one output sample each.  It serves multiphase converters and multi-axis drives,
+   * where all the loops run in the same interrupt.
+   *
+   * \par Initialization and Reset Functions
+   * The initialization function sets the gains and the limits and clears the state.
+   * The reset function clears the integral term, the derivative filter and the previous input.
+   *
+   * \par Fixed-Point Behavior
+   * The fixed-point gains are multiplied by <code>2^postShift</code>, which allows gains up to
+   * <code>2^postShift</code>.  The Q31 proportional and derivative products are accumulated in a
+   * 64-bit accumulator with a single guard bit.  The Q15 integral term is kept in 1.31 format,
+   * so small integral gains do not lose the increments.  The integral term saturates.
+   */
+
+  /**
+   * @addtogroup PIDExt
+   * @{
+   */
+
+  /**
+   * @brief  Process function for the floating-point extended PID Control.
+   * @param[in,out] S   points to an instance of the extended PID structure.
+   * @param[in]     in  input sample to process
+   * @return out processed output sample, within [outMin outMax].
+   */
+  CMSIS_INLINE __STATIC_INLINE float32_t arm_pid_ext_f32(
+  arm_pid_ext_instance_f32 * S,
+  float32_t in)
+  {
+    float32_t inc, integ, out;
+
+    /* d[n] = d[n-1] + alpha * ((x[n] - x[n-1]) - d[n-1]) */
+    S->deriv += S->alpha * ((in - S->xPrev) - S->deriv);
+    S->xPrev = in;
+
+    /* i[n] = i[n-1] + Ki * x[n] */
+    inc = S->Ki * in;
+    integ = S->integ + inc;
+
+    /* y[n] = Kp * x[n] + i[n] + Kd * d[n] */
+    out = (S->Kp * in) + integ + (S->Kd * S->deriv);
+
+    /* Clamp the output, and stop the integration into the limit */
+    if (out > S->outMax)
+    {
+      out = S->outMax;
+      integ = (inc > 0.0f) ? S->integ : integ;
+    }
+    else if (out < S->outMin)
+    {
+      out = S->outMin;
+      integ = (inc < 0.0f) ? S->integ : integ;
+    }
+
+    S->integ = integ;
+
+    return (out);
+  }
+
+  /**
+   * @brief  Process function for the Q31 extended PID Control.
+   * @param[in,out] S   points to an instance of the extended PID structure.
+   * @param[in]     in  input sample to process
+   * @return out processed output sample, within [outMin outMax].
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The proportional and derivative products are accumulated in a 64-bit accumulator in 2.62 format,
+   * then shifted to 1.31 format with the gain shift.  The integral increment and the
+   * integral term saturate to 1.31 format, and the output is clamped to the limits.
+   */
+  CMSIS_INLINE __STATIC_INLINE q31_t arm_pid_ext_q31(
+  arm_pid_ext_instance_q31 * S,
+  q31_t in)
+  {
+    q63_t acc;
+    q31_t inc, integ, out;
+    int32_t shift = 31 - (int32_t) S->postShift;
+
+    /* d[n] = d[n-1] + alpha * ((x[n] - x[n-1]) - d[n-1]) */
+    S->deriv += (q31_t) (((q63_t) S->alpha * ((q63_t) __QSUB(in, S->xPrev) - S->deriv)) >> 31);
+    S->xPrev = in;
+
+    /* i[n] = i[n-1] + Ki * x[n] */
+    inc = clip_q63_to_q31(((q63_t) S->Ki * in) >> shift);
+    integ = __QADD(S->integ, inc);
+
+    /* y[n] = Kp * x[n] + i[n] + Kd * d[n] */
+    acc = (((q63_t) S->Kp * in) + ((q63_t) S->Kd * S->deriv)) >> shift;
+    acc += integ;
+
+    /* Clamp the output, and stop the integration into the limit */
+    if (acc > S->outMax)
+    {
+      out = S->outMax;
+      integ = (inc > 0) ? S->integ : integ;
+    }
+    else if (acc < S->outMin)
+    {
+      out = S->outMin;
+      integ = (inc < 0) ? S->integ : integ;
+    }
+    else
+    {
+      out = (q31_t) acc;
+    }
+
+    S->integ = integ;
+
+    return (out);
+  }
+
+  /**
+   * @brief  Process function for the Q15 extended PID Control.
+   * @param[in,out] S   points to an instance of the extended PID structure.
+   * @param[in]     in  input sample to process
+   * @return out processed output sample, within [outMin outMax].
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The 2.30 products are shifted to 1.31 format with the gain shift.  The integral term is kept
+   * in 1.31 format and saturates.  The output is clamped to the limits and truncated to 1.15 format.
+   */
+  CMSIS_INLINE __STATIC_INLINE q15_t arm_pid_ext_q15(
+  arm_pid_ext_instance_q15 * S,
+  q15_t in)
+  {
+    q63_t acc;
+    q31_t inc, integ;
+    q15_t out;
+    int32_t shift = (int32_t) S->postShift + 1;
+
+    /* d[n] = d[n-1] + alpha * ((x[n] - x[n-1]) - d[n-1]) */
+    S->deriv += (q15_t) (((q31_t) S->alpha * (__SSAT((q31_t) in - S->xPrev, 16) - S->deriv)) >> 15);
+    S->xPrev = in;
+
+    /* i[n] = i[n-1] + Ki * x[n] */
+    inc = clip_q63_to_q31((q63_t) ((q31_t) S->Ki * in) << shift);
+    integ = __QADD(S->integ, inc);
+
+    /* y[n] = Kp * x[n] + i[n] + Kd * d[n] */
+    acc = ((q63_t) ((q31_t) S->Kp * in) + ((q31_t) S->Kd * S->deriv)) << shift;
+    acc += integ;
+
+    /* Clamp the output, and stop the integration into the limit */
+    if (acc > ((q63_t) S->outMax << 16))
+    {
+      out = S->outMax;
+      integ = (inc > 0) ? S->integ : integ;
+    }
+    else if (acc < ((q63_t) S->outMin << 16))
+    {
+      out = S->outMin;
+      integ = (inc < 0) ? S->integ : integ;
+    }
+    else
+    {
+      out = (q15_t) (acc >> 16);
+    }
+
+    S->integ = integ;
+
+    return (out);
+  }
+
+  /**
+   * @} end of PIDExt group
+   */
+
+ /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup Compensator 2P2Z and 3P3Z Compensators
+   *
+   * Two-pole two-zero and three-pole three-zero compensators for digital power
+   * conversion, for Q31 and Q15 data types.  They are the discrete forms of the type II and
+   * type III analog compensators and run in the control interrupt of the converter:
+   * the input is the error between the reference and the measured output, the output is
+   * the duty cycle or the current reference.
+   *
+   * \par Algorithm:
+   * Each compensator is a single direct form I section of order 2 or 3:
+   * <pre>
+   *    y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + b3 * x[n-3]
+   *                     + a1 * y[n-1] + a2 * y[n-2] + a3 * y[n-3]  </pre>
+   * \par
+   * The feedback coefficients have the sign convention of the \ref BiquadCascadeDF1 functions,
+   * i.e. they are negated with respect to the transfer function denominator.
+   * The output is clamped to <code>[outMin outMax]</code> and the clamped value is stored in the
+   * state, so the integrator of the compensator does not wind up while the converter is in
+   * its duty cycle limit.
+   *
+   * \par
+   * The process functions are inline and contain no loop and no branch other than the clamping:
+   * the cycle count does not depend on the data, which gives the worst case latency of
+   * the control interrupt.
+   *
+   * \par Design
+   * <code>arm_comp_design_f32()</code> computes the coefficients of
+   * <pre>
+   *              gain   (1 + s / wz1) (1 + s / wz2)
+   *     H(s) =  ----- * ---------------------------
+   *               s     (1 + s / wp1) (1 + s / wp2)  </pre>
+   * with one zero and one pole for the 2P2Z form, using the bilinear transform.
+   * The floating-point coefficients are converted to the fixed-point format after
+   * division by <code>2^postShift</code>, where <code>postShift</code> is chosen so that all
+   * coefficients are smaller than <code>2^postShift</code> in magnitude.
+   *
+   * \par Fixed-Point Behavior
+   * The products are accumulated in a 64-bit accumulator and shifted to the output format
+   * with <code>postShift</code>.  The Q15 accumulator cannot overflow.  Each Q31 product is
+   * smaller than 2^62 in magnitude, so the Q31 accumulator does not overflow as long as the sum of
+   * the magnitudes of the Q31 coefficients is smaller than 2^32, that is, as long as the sum of the
+   * magnitudes of the floating-point coefficients is smaller than <code>2^(postShift + 1)</code>.
+   * Type III designs at high sampling rates have coefficients up to a few tens, which leaves
+   * 10 bits of coefficient resolution in the Q15 version: prefer the Q31 version for them.
+   */
+
+  /**
+   * @addtogroup Compensator
+   * @{
+   */
+
+  /**
+   * @brief  Process function for the Q31 2P2Z compensator.
+   * @param[in,out] S   points to an instance of the Q31 compensator structure.
+   * @param[in]     in  input sample to process
+   * @return out processed output sample, within [outMin outMax].
+   */
+  CMSIS_INLINE __STATIC_INLINE q31_t arm_comp_2p2z_q31(
+  arm_comp_instance_q31 * S,
+  q31_t in)
+  {
+    q63_t acc;
+    q31_t out;
+
+    /* acc = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+    acc  = (q63_t) S->coeffs[0] * in;
+    acc += (q63_t) S->coeffs[1] * S->state[0];
+    acc += (q63_t) S->coeffs[2] * S->state[1];
+    acc += (q63_t) S->coeffs[4] * S->state[3];
+    acc += (q63_t) S->coeffs[5] * S->state[4];
+
+    /* Convert to 1.31 format and clamp the output */
+    acc = acc >> (31 - S->postShift);
+    out = (acc > S->outMax) ? S->outMax : ((acc < S->outMin) ? S->outMin : (q31_t) acc);
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[4] = S->state[3];
+    S->state[3] = out;
+
+    return (out);
+  }
+
+  /**
+   * @brief  Process function for the Q31 3P3Z compensator.
+   * @param[in,out] S   points to an instance of the Q31 compensator structure.
+   * @param[in]     in  input sample to process
+   * @return out processed output sample, within [outMin outMax].
+   */
+  CMSIS_INLINE __STATIC_INLINE q31_t arm_comp_3p3z_q31(
+  arm_comp_instance_q31 * S,
+  q31_t in)
+  {
+    q63_t acc;
+    q31_t out;
+
+    /* acc = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + b3 * x[n-3] + a1 * y[n-1] + a2 * y[n-2] + a3 * y[n-3] */
+    acc  = (q63_t) S->coeffs[0] * in;
+    acc += (q63_t) S->coeffs[1] * S->state[0];
+    acc += (q63_t) S->coeffs[2] * S->state[1];
+    acc += (q63_t) S->coeffs[3] * S->state[2];
+    acc += (q63_t) S->coeffs[4] * S->state[3];
+    acc += (q63_t) S->coeffs[5] * S->state[4];
+    acc += (q63_t) S->coeffs[6] * S->state[5];
+
+    /* Convert to 1.31 format and clamp the output */
+    acc = acc >> (31 - S->postShift);
+    out = (acc > S->outMax) ? S->outMax : ((acc < S->outMin) ? S->outMin : (q31_t) acc);
+
+    /* Update state */
+    S->state[2] = S->state[1];
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[5] = S->state[4];
+    S->state[4] = S->state[3];
+    S->state[3] = out;
+
+    return (out);
+  }
+
+  /**
+   * @brief  Process function for the Q15 2P2Z compensator.
+   * @param[in,out] S   points to an instance of the Q15 compensator structure.
+   * @param[in]     in  input sample to process
+   * @return out processed output sample, within [outMin outMax].
+   */
+  CMSIS_INLINE __STATIC_INLINE q15_t arm_comp_2p2z_q15(
+  arm_comp_instance_q15 * S,
+  q15_t in)
+  {
+    q63_t acc;
+    q15_t out;
+
+    /* acc = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+    acc  = (q31_t) S->coeffs[0] * in;
+    acc += (q31_t) S->coeffs[1] * S->state[0];
+    acc += (q31_t) S->coeffs[2] * S->state[1];
+    acc += (q31_t) S->coeffs[4] * S->state[3];
+    acc += (q31_t) S->coeffs[5] * S->state[4];
+
+    /* Convert to 1.15 format and clamp the output */
+    acc = acc >> (15 - S->postShift);
+    out = (acc > S->outMax) ? S->outMax : ((acc < S->outMin) ? S->outMin : (q15_t) acc);
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[4] = S->state[3];
+    S->state[3] = out;
+
+    return (out);
+  }
+
+  /**
+   * @brief  Process function for the Q15 3P3Z compensator.
+   * @param[in,out] S   points to an instance of the Q15 compensator structure.
+   * @param[in]     in  input sample to process
+   * @return out processed output sample, within [outMin outMax].
+   */
+  CMSIS_INLINE __STATIC_INLINE q15_t arm_comp_3p3z_q15(
+  arm_comp_instance_q15 * S,
+  q15_t in)
+  {
+    q63_t acc;
+    q15_t out;
+
+    /* acc = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + b3 * x[n-3] + a1 * y[n-1] + a2 * y[n-2] + a3 * y[n-3] */
+    acc  = (q31_t) S->coeffs[0] * in;
+    acc += (q31_t) S->coeffs[1] * S->state[0];
+    acc += (q31_t) S->coeffs[2] * S->state[1];
+    acc += (q31_t) S->coeffs[3] * S->state[2];
+    acc += (q31_t) S->coeffs[4] * S->state[3];
+    acc += (q31_t) S->coeffs[5] * S->state[4];
+    acc += (q31_t) S->coeffs[6] * S->state[5];
+
+    /* Convert to 1.15 format and clamp the output */
+    acc = acc >> (15 - S->postShift);
+    out = (acc > S->outMax) ? S->outMax : ((acc < S->outMin) ? S->outMin : (q15_t) acc);
+
+    /* Update state */
+    S->state[2] = S->state[1];
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[5] = S->state[4];
+    S->state[4] = S->state[3];
+    S->state[3] = out;
+
+    return (out);
+  }
+
+  /**
+   * @} end of Compensator group
+   */
+
+
+  /**
+   * @brief Floating-point matrix inverse.
+   * @param[in]  src   points to the instance of the input floating-point matrix structure.
+   * @param[out] dst   points to the instance of the output floating-point matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_inverse_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Floating-point matrix inverse.
+   * @param[in]  src   points to the instance of the input floating-point matrix structure.
+   * @param[out] dst   points to the instance of the output floating-point matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_inverse_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
+
+
+/**
+ * @brief Size of the workspace of arm_polyfit_f32() for a polynomial of the given order.
+ */
+#define ARM_POLYFIT_WORK_SIZE(order) (((order) + 1) * ((order) + 2))
+
+  /**
+   * @brief  Weighted least-squares polynomial fit.
+   * @param[in]  pX          points to the abscissae of the points.
+   * @param[in]  pY          points to the ordinates of the points.
+   * @param[in]  pW          points to the weights of the points, or NULL for equal weights.
+   * @param[in]  numSamples  number of points, at least order + 1.
+   * @param[in]  order       order of the polynomial.
+   * @param[out] pCoeffs     points to the order + 1 coefficients, constant term first.
+   * @param[in]  pWork       points to the workspace, ARM_POLYFIT_WORK_SIZE(order) values.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR if numSamples is less than order + 1,
+   * or ARM_MATH_SINGULAR if the points do not define a unique polynomial.
+   */
+  arm_status arm_polyfit_f32(
+  const float32_t * pX,
+  const float32_t * pY,
+  const float32_t * pW,
+  uint32_t numSamples,
+  uint16_t order,
+  float32_t * pCoeffs,
+  float32_t * pWork);
+
+  /**
+   * @brief  Floating-point polynomial evaluation.
+   * @param[in]  pCoeffs    points to the order + 1 coefficients, constant term first.
+   * @param[in]  order      order of the polynomial.
+   * @param[in]  pSrc       points to the input vector.
+   * @param[out] pDst       points to the output vector.
+   * @param[in]  blockSize  number of samples in the vectors.
+   */
+  void arm_poly_eval_f32(
+  const float32_t * pCoeffs,
+  uint16_t order,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q31 polynomial evaluation.
+   * @param[in]  pCoeffs    points to the order + 1 coefficients, constant term first, scaled by 2^-postShift.
+   * @param[in]  order      order of the polynomial.
+   * @param[in]  postShift  left shift of the result, from 0 to 31.
+   * @param[in]  pSrc       points to the input vector.
+   * @param[out] pDst       points to the output vector.
+   * @param[in]  blockSize  number of samples in the vectors.
+   */
+  void arm_poly_eval_q31(
+  const q31_t * pCoeffs,
+  uint16_t order,
+  uint8_t postShift,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup clarke Vector Clarke Transform
+   * Forward Clarke transform converts the instantaneous stator phases into a two-coordinate time invariant vector.
+   * Generally the Clarke transform uses three-phase currents <code>Ia, Ib and Ic</code> to calculate currents
+   * in the two-phase orthogonal stator axis <code>Ialpha</code> and <code>Ibeta</code>.
+   * When <code>Ialpha</code> is superposed with <code>Ia</code> as shown in the figure below
+   * \image html clarke.gif Stator current space vector and its components in (a,b).
+   * and <code>Ia + Ib + Ic = 0</code>, in this condition <code>Ialpha</code> and <code>Ibeta</code>
+   * can be calculated using only <code>Ia</code> and <code>Ib</code>.
+   *
+   * The function operates on a single sample of data and each call to the function returns the processed output.
+   * The library provides separate functions for Q31 and floating-point data types.
+   * \par Algorithm
+   * \image html clarkeFormula.gif
+   * where <code>Ia</code> and <code>Ib</code> are the instantaneous stator phases and
+   * <code>pIalpha</code> and <code>pIbeta</code> are the two coordinates of time invariant vector.
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the Q31 version of the Clarke transform.
+   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+   */
+
+  /**
+   * @addtogroup clarke
+   * @{
+   */
+
+  /**
+   *
+   * @brief  Floating-point Clarke transform
+   * @param[in]  Ia       input three-phase coordinate <code>a</code>
+   * @param[in]  Ib       input three-phase coordinate <code>b</code>
+   * @param[out] pIalpha  points to output two-phase orthogonal vector axis alpha
+   * @param[out] pIbeta   points to output two-phase orthogonal vector axis beta
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_clarke_f32(
+  float32_t Ia,
+  float32_t Ib,
+  float32_t * pIalpha,
+  float32_t * pIbeta)
+  {
+    /* Calculate pIalpha using the equation, pIalpha = Ia */
+    *pIalpha = Ia;
+
+    /* Calculate pIbeta using the equation, pIbeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
+    *pIbeta = ((float32_t) 0.57735026919 * Ia + (float32_t) 1.15470053838 * Ib);
+  }
+
+
+  /**
+   * @brief  Clarke transform for Q31 version
+   * @param[in]  Ia       input three-phase coordinate <code>a</code>
+   * @param[in]  Ib       input three-phase coordinate <code>b</code>
+   * @param[out] pIalpha  points to output two-phase orthogonal vector axis alpha
+   * @param[out] pIbeta   points to output two-phase orthogonal vector axis beta
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 32-bit accumulator.
+   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
+   * There is saturation on the addition, hence there is no risk of overflow.
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_clarke_q31(
+  q31_t Ia,
+  q31_t Ib,
+  q31_t * pIalpha,
+  q31_t * pIbeta)
+  {
+    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
+
+    /* Calculating pIalpha from Ia by equation pIalpha = Ia */
+    *pIalpha = Ia;
+
+    /* Intermediate product is calculated by (1/(sqrt(3)) * Ia) */
+    product1 = (q31_t) (((q63_t) Ia * 0x24F34E8B) >> 30);
+
+    /* Intermediate product is calculated by (2/sqrt(3) * Ib) */
+    product2 = (q31_t) (((q63_t) Ib * 0x49E69D16) >> 30);
+
+    /* pIbeta is calculated by adding the intermediate products */
+    *pIbeta = __QADD(product1, product2);
+  }
+
+  /**
+   * @} end of clarke group
+   */
+
+  /**
+   * @brief  Converts the elements of the Q7 vector to Q31 vector.
+   * @param[in]  pSrc       input pointer
+   * @param[out] pDst       output pointer
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_q7_to_q31(
+  q7_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup inv_clarke Vector Inverse Clarke Transform
+   * Inverse Clarke transform converts the two-coordinate time invariant vector into instantaneous stator phases.
+   *
+   * The function operates on a single sample of data and each call to the function returns the processed output.
+   * The library provides separate functions for Q31 and floating-point data types.
+   * \par Algorithm
+   * \image html clarkeInvFormula.gif
+   * where <code>pIa</code> and <code>pIb</code> are the instantaneous stator phases and
+   * <code>Ialpha</code> and <code>Ibeta</code> are the two coordinates of time invariant vector.
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the Q31 version of the Clarke transform.
+   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+   */
+
+  /**
+   * @addtogroup inv_clarke
+   * @{
+   */
+
+   /**
+   * @brief  Floating-point Inverse Clarke transform
+   * @param[in]  Ialpha  input two-phase orthogonal vector axis alpha
+   * @param[in]  Ibeta   input two-phase orthogonal vector axis beta
+   * @param[out] pIa     points to output three-phase coordinate <code>a</code>
+   * @param[out] pIb     points to output three-phase coordinate <code>b</code>
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_inv_clarke_f32(
+  float32_t Ialpha,
+  float32_t Ibeta,
+  float32_t * pIa,
+  float32_t * pIb)
+  {
+    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
+    *pIa = Ialpha;
+
+    /* Calculating pIb from Ialpha and Ibeta by equation pIb = -(1/2) * Ialpha + (sqrt(3)/2) * Ibeta */
+    *pIb = -0.5f * Ialpha + 0.8660254039f * Ibeta;
+  }
+
+
+  /**
+   * @brief  Inverse Clarke transform for Q31 version
+   * @param[in]  Ialpha  input two-phase orthogonal vector axis alpha
+   * @param[in]  Ibeta   input two-phase orthogonal vector axis beta
+   * @param[out] pIa     points to output three-phase coordinate <code>a</code>
+   * @param[out] pIb     points to output three-phase coordinate <code>b</code>
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 32-bit accumulator.
+   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
+   * There is saturation on the subtraction, hence there is no risk of overflow.
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_inv_clarke_q31(
+  q31_t Ialpha,
+  q31_t Ibeta,
+  q31_t * pIa,
+  q31_t * pIb)
+  {
+    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
+
+    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
+    *pIa = Ialpha;
+
+    /* Intermediate product is calculated by (1/(2*sqrt(3)) * Ia) */
+    product1 = (q31_t) (((q63_t) (Ialpha) * (0x40000000)) >> 31);
+
+    /* Intermediate product is calculated by (1/sqrt(3) * pIb) */
+    product2 = (q31_t) (((q63_t) (Ibeta) * (0x6ED9EBA1)) >> 31);
+
+    /* pIb is calculated by subtracting the products */
+    *pIb = __QSUB(product2, product1);
+  }
+
+  /**
+   * @} end of inv_clarke group
+   */
+
+  /**
+   * @brief  Converts the elements of the Q7 vector to Q15 vector.
+   * @param[in]  pSrc       input pointer
+   * @param[out] pDst       output pointer
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_q7_to_q15(
+  q7_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup park Vector Park Transform
+   *
+   * Forward Park transform converts the input two-coordinate vector to flux and torque components.
+   * The Park transform can be used to realize the transformation of the <code>Ialpha</code> and the <code>Ibeta</code> currents
+   * from the stationary to the moving reference frame and control the spatial relationship between
+   * the stator vector current and rotor flux vector.
+   * If we consider the d axis aligned with the rotor flux, the diagram below shows the
+   * current vector and the relationship from the two reference frames:
+   * \image html park.gif "Stator current space vector and its component in (a,b) and in the d,q rotating reference frame"
+   *
+   * The function operates on a single sample of data and each call to the function returns the processed output.
+   * The library provides separate functions for Q31 and floating-point data types.
+   * \par Algorithm
+   * \image html parkFormula.gif
+   * where <code>Ialpha</code> and <code>Ibeta</code> are the stator vector components,
+   * <code>pId</code> and <code>pIq</code> are rotor vector components and <code>cosVal</code> and <code>sinVal</code> are the
+   * cosine and sine values of theta (rotor flux position).
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the Q31 version of the Park transform.
+   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+   */
+
+  /**
+   * @addtogroup park
+   * @{
+   */
+
+  /**
+   * @brief Floating-point Park transform
+   * @param[in]  Ialpha  input two-phase vector coordinate alpha
+   * @param[in]  Ibeta   input two-phase vector coordinate beta
+   * @param[out] pId     points to output   rotor reference frame d
+   * @param[out] pIq     points to output   rotor reference frame q
+   * @param[in]  sinVal  sine value of rotation angle theta
+   * @param[in]  cosVal  cosine value of rotation angle theta
+   *
+   * The function implements the forward Park transform.
+   *
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_park_f32(
+  float32_t Ialpha,
+  float32_t Ibeta,
+  float32_t * pId,
+  float32_t * pIq,
+  float32_t sinVal,
+  float32_t cosVal)
+  {
+    /* Calculate pId using the equation, pId = Ialpha * cosVal + Ibeta * sinVal */
+    *pId = Ialpha * cosVal + Ibeta * sinVal;
+
+    /* Calculate pIq using the equation, pIq = - Ialpha * sinVal + Ibeta * cosVal */
+    *pIq = -Ialpha * sinVal + Ibeta * cosVal;
+  }
+
+
+  /**
+   * @brief  Park transform for Q31 version
+   * @param[in]  Ialpha  input two-phase vector coordinate alpha
+   * @param[in]  Ibeta   input two-phase vector coordinate beta
+   * @param[out] pId     points to output rotor reference frame d
+   * @param[out] pIq     points to output rotor reference frame q
+   * @param[in]  sinVal  sine value of rotation angle theta
+   * @param[in]  cosVal  cosine value of rotation angle theta
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 32-bit accumulator.
+   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
+   * There is saturation on the addition and subtraction, hence there is no risk of overflow.
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_park_q31(
+  q31_t Ialpha,
+  q31_t Ibeta,
+  q31_t * pId,
+  q31_t * pIq,
+  q31_t sinVal,
+  q31_t cosVal)
+  {
+    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
+    q31_t product3, product4;                    /* Temporary variables used to store intermediate results */
+
+    /* Intermediate product is calculated by (Ialpha * cosVal) */
+    product1 = (q31_t) (((q63_t) (Ialpha) * (cosVal)) >> 31);
+
+    /* Intermediate product is calculated by (Ibeta * sinVal) */
+    product2 = (q31_t) (((q63_t) (Ibeta) * (sinVal)) >> 31);
+
+
+    /* Intermediate product is calculated by (Ialpha * sinVal) */
+    product3 = (q31_t) (((q63_t) (Ialpha) * (sinVal)) >> 31);
+
+    /* Intermediate product is calculated by (Ibeta * cosVal) */
+    product4 = (q31_t) (((q63_t) (Ibeta) * (cosVal)) >> 31);
+
+    /* Calculate pId by adding the two intermediate products 1 and 2 */
+    *pId = __QADD(product1, product2);
+
+    /* Calculate pIq by subtracting the two intermediate products 3 from 4 */
+    *pIq = __QSUB(product4, product3);
+  }
+
+  /**
+   * @} end of park group
+   */
+
+  /**
+   * @brief  Converts the elements of the Q7 vector to floating-point vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[out] pDst       is output pointer
+   * @param[in]  blockSize  is the number of samples to process
+   */
+  void arm_q7_to_float(
+  q7_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup inv_park Vector Inverse Park transform
+   * Inverse Park transform converts the input flux and torque components to two-coordinate vector.
+   *
+   * The function operates on a single sample of data and each call to the function returns the processed output.
+   * The library provides separate functions for Q31 and floating-point data types.
+   * \par Algorithm
+   * \image html parkInvFormula.gif
+   * where <code>pIalpha</code> and <code>pIbeta</code> are the stator vector components,
+   * <code>Id</code> and <code>Iq</code> are rotor vector components and <code>cosVal</code> and <code>sinVal</code> are the
+   * cosine and sine values of theta (rotor flux position).
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the Q31 version of the Park transform.
+   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+   */
+
+  /**
+   * @addtogroup inv_park
+   * @{
+   */
+
+   /**
+   * @brief  Floating-point Inverse Park transform
+   * @param[in]  Id       input coordinate of rotor reference frame d
+   * @param[in]  Iq       input coordinate of rotor reference frame q
+   * @param[out] pIalpha  points to output two-phase orthogonal vector axis alpha
+   * @param[out] pIbeta   points to output two-phase orthogonal vector axis beta
+   * @param[in]  sinVal   sine value of rotation angle theta
+   * @param[in]  cosVal   cosine value of rotation angle theta
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_inv_park_f32(
+  float32_t Id,
+  float32_t Iq,
+  float32_t * pIalpha,
+  float32_t * pIbeta,
+  float32_t sinVal,
+  float32_t cosVal)
+  {
+    /* Calculate pIalpha using the equation, pIalpha = Id * cosVal - Iq * sinVal */
+    *pIalpha = Id * cosVal - Iq * sinVal;
+
+    /* Calculate pIbeta using the equation, pIbeta = Id * sinVal + Iq * cosVal */
+    *pIbeta = Id * sinVal + Iq * cosVal;
+  }
+
+
+  /**
+   * @brief  Inverse Park transform for   Q31 version
+   * @param[in]  Id       input coordinate of rotor reference frame d
+   * @param[in]  Iq       input coordinate of rotor reference frame q
+   * @param[out] pIalpha  points to output two-phase orthogonal vector axis alpha
+   * @param[out] pIbeta   points to output two-phase orthogonal vector axis beta
+   * @param[in]  sinVal   sine value of rotation angle theta
+   * @param[in]  cosVal   cosine value of rotation angle theta
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 32-bit accumulator.
+   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
+   * There is saturation on the addition, hence there is no risk of overflow.
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_inv_park_q31(
+  q31_t Id,
+  q31_t Iq,
+  q31_t * pIalpha,
+  q31_t * pIbeta,
+  q31_t sinVal,
+  q31_t cosVal)
+  {
+    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
+    q31_t product3, product4;                    /* Temporary variables used to store intermediate results */
+
+    /* Intermediate product is calculated by (Id * cosVal) */
+    product1 = (q31_t) (((q63_t) (Id) * (cosVal)) >> 31);
+
+    /* Intermediate product is calculated by (Iq * sinVal) */
+    product2 = (q31_t) (((q63_t) (Iq) * (sinVal)) >> 31);
+
+
+    /* Intermediate product is calculated by (Id * sinVal) */
+    product3 = (q31_t) (((q63_t) (Id) * (sinVal)) >> 31);
+
+    /* Intermediate product is calculated by (Iq * cosVal) */
+    product4 = (q31_t) (((q63_t) (Iq) * (cosVal)) >> 31);
+
+    /* Calculate pIalpha by using the two intermediate products 1 and 2 */
+    *pIalpha = __QSUB(product1, product2);
+
+    /* Calculate pIbeta by using the two intermediate products 3 and 4 */
+    *pIbeta = __QADD(product4, product3);
+  }
+
+  /**
+   * @} end of Inverse park group
+   */
+
+
+  /**
+   * @brief  Converts the elements of the Q31 vector to floating-point vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[out] pDst       is output pointer
+   * @param[in]  blockSize  is the number of samples to process
+   */
+  void arm_q31_to_float(
+  q31_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @ingroup groupInterpolation
+   */
+
+  /**
+   * @defgroup LinearInterpolate Linear Interpolation
+   *
+   * Linear interpolation is a method of curve fitting using linear polynomials.
+   * Linear interpolation works by effectively drawing a straight line between two neighboring samples and returning the appropriate point along that line
+   *
+   * \par
+   * \image html LinearInterp.gif "Linear interpolation"
+   *
+   * \par
+   * A  Linear Interpolate function calculates an output value(y), for the input(x)
+   * using linear interpolation of the input values x0, x1( nearest input values) and the output values y0 and y1(nearest output values)
+   *
+   * \par Algorithm:
+   * <pre>
+   *       y = y0 + (x - x0) * ((y1 - y0)/(x1-x0))
+   *       where x0, x1 are nearest values of input x
+   *             y0, y1 are nearest values to output y
+   * </pre>
+   *
+   * \par
+   * This set of functions implements Linear interpolation process
+   * for Q7, Q15, Q31, and floating-point data types.  The functions operate on a single
+   * sample of data and each call to the function returns a single processed value.
+   * <code>S</code> points to an instance of the Linear Interpolate function data structure.
+   * <code>x</code> is the input sample value. The functions returns the output value.
+   *
+   * \par
+   * if x is outside of the table boundary, Linear interpolation returns first value of the table
+   * if x is below input range and returns last value of table if x is above range.
+   */
+
+  /**
+   * @addtogroup LinearInterpolate
+   * @{
+   */
+
+  /**
+   * @brief  Process function for the floating-point Linear Interpolation Function.
+   * @param[in,out] S  is an instance of the floating-point Linear Interpolation structure
+   * @param[in]     x  input sample to process
+   * @return y processed output sample.
+   *
+   */
+  CMSIS_INLINE __STATIC_INLINE float32_t arm_linear_interp_f32(
+  arm_linear_interp_instance_f32 * S,
+  float32_t x)
+  {
+    float32_t y;
+    float32_t x0, x1;                            /* Nearest input values */
+    float32_t y0, y1;                            /* Nearest output values */
+    float32_t xSpacing = S->xSpacing;            /* spacing between input values */
+    int32_t i;                                   /* Index variable */
+    float32_t *pYData = S->pYData;               /* pointer to output table */
+
+    /* Calculation of index */
+    i = (int32_t) ((x - S->x1) / xSpacing);
+
+    if (i < 0)
+    {
+      /* Iniatilize output for below specified range as least output value of table */
+      y = pYData[0];
+    }
+    else if ((uint32_t)i >= S->nValues)
+    {
+      /* Iniatilize output for above specified range as last output value of table */
+      y = pYData[S->nValues - 1];
+    }
+    else
+    {
+      /* Calculation of nearest input values */
+      x0 = S->x1 +  i      * xSpacing;
+      x1 = S->x1 + (i + 1) * xSpacing;
+
+      /* Read of nearest output values */
+      y0 = pYData[i];
+      y1 = pYData[i + 1];
+
+      /* Calculation of output */
+      y = y0 + (x - x0) * ((y1 - y0) / (x1 - x0));
+
+    }
+
+    /* returns output value */
+    return (y);
+  }
+
+
+   /**
+   *
+   * @brief  Process function for the Q31 Linear Interpolation Function.
+   * @param[in] pYData   pointer to Q31 Linear Interpolation table
+   * @param[in] x        input sample to process
+   * @param[in] nValues  number of table values
+   * @return y processed output sample.
+   *
+   * \par
+   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
+   * This function can support maximum of table size 2^12.
+   *
+   */
+  CMSIS_INLINE __STATIC_INLINE q31_t arm_linear_interp_q31(
+  q31_t * pYData,
+  q31_t x,
+  uint32_t nValues)
+  {
+    q31_t y;                                     /* output */
+    q31_t y0, y1;                                /* Nearest output values */
+    q31_t fract;                                 /* fractional part */
+    int32_t index;                               /* Index to read nearest output values */
+
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    /* Index value calculation */
+    index = ((x & (q31_t)0xFFF00000) >> 20);
+
+    if (index >= (int32_t)(nValues - 1))
+    {
+      return (pYData[nValues - 1]);
+    }
+    else if (index < 0)
+    {
+      return (pYData[0]);
+    }
+    else
+    {
+      /* 20 bits for the fractional part */
+      /* shift left by 11 to keep fract in 1.31 format */
+      fract = (x & 0x000FFFFF) << 11;
+
+      /* Read two nearest output values from the index in 1.31(q31) format */
+      y0 = pYData[index];
+      y1 = pYData[index + 1];
+
+      /* Calculation of y0 * (1-fract) and y is in 2.30 format */
+      y = ((q31_t) ((q63_t) y0 * (0x7FFFFFFF - fract) >> 32));
+
+      /* Calculation of y0 * (1-fract) + y1 *fract and y is in 2.30 format */
+      y += ((q31_t) (((q63_t) y1 * fract) >> 32));
+
+      /* Convert y to 1.31 format */
+      return (y << 1U);
+    }
+  }
+
+
+  /**
+   *
+   * @brief  Process function for the Q15 Linear Interpolation Function.
+   * @param[in] pYData   pointer to Q15 Linear Interpolation table
+   * @param[in] x        input sample to process
+   * @param[in] nValues  number of table values
+   * @return y processed output sample.
+   *
+   * \par
+   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
+   * This function can support maximum of table size 2^12.
+   *
+   */
+  CMSIS_INLINE __STATIC_INLINE q15_t arm_linear_interp_q15(
+  q15_t * pYData,
+  q31_t x,
+  uint32_t nValues)
+  {
+    q63_t y;                                     /* output */
+    q15_t y0, y1;                                /* Nearest output values */
+    q31_t fract;                                 /* fractional part */
+    int32_t index;                               /* Index to read nearest output values */
+
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    /* Index value calculation */
+    index = ((x & (int32_t)0xFFF00000) >> 20);
+
+    if (index >= (int32_t)(nValues - 1))
+    {
+      return (pYData[nValues - 1]);
+    }
+    else if (index < 0)
+    {
+      return (pYData[0]);
+    }
+    else
+    {
+      /* 20 bits for the fractional part */
+      /* fract is in 12.20 format */
+      fract = (x & 0x000FFFFF);
+
+      /* Read two nearest output values from the index */
+      y0 = pYData[index];
+      y1 = pYData[index + 1];
+
+      /* Calculation of y0 * (1-fract) and y is in 13.35 format */
+      y = ((q63_t) y0 * (0xFFFFF - fract));
 
+      /* Calculation of (y0 * (1-fract) + y1 * fract) and y is in 13.35 format */
+      y += ((q63_t) y1 * (fract));
 
-/**
- * @brief Initialization function for the Q15 IIR lattice filter.
- * @param[in] S          points to an instance of the fixed-point Q15 IIR lattice structure.
- * @param[in] numStages  number of stages in the filter.
- * @param[in] pkCoeffs   points to reflection coefficient buffer.  The array is of length numStages.
- * @param[in] pvCoeffs   points to ladder coefficient buffer.  The array is of length numStages+1.
- * @param[in] pState     points to state buffer.  The array is of length numStages+blockSize.
- * @param[in] blockSize  number of samples to process per call.
- */
-  void arm_iir_lattice_init_q15(
-  arm_iir_lattice_instance_q15 * S,
-  uint16_t numStages,
-  q15_t * pkCoeffs,
-  q15_t * pvCoeffs,
-  q15_t * pState,
-  uint32_t blockSize);
+      /* convert y to 1.15 format */
+      return (q15_t) (y >> 20);
+    }
+  }
 
 
   /**
-   * @brief Instance structure for the floating-point LMS filter.
+   *
+   * @brief  Process function for the Q7 Linear Interpolation Function.
+   * @param[in] pYData   pointer to Q7 Linear Interpolation table
+   * @param[in] x        input sample to process
+   * @param[in] nValues  number of table values
+   * @return y processed output sample.
+   *
+   * \par
+   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
+   * This function can support maximum of table size 2^12.
    */
-  typedef struct
+  CMSIS_INLINE __STATIC_INLINE q7_t arm_linear_interp_q7(
+  q7_t * pYData,
+  q31_t x,
+  uint32_t nValues)
   {
-    uint16_t numTaps;    /**< number of coefficients in the filter. */
-    float32_t *pState;   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    float32_t *pCoeffs;  /**< points to the coefficient array. The array is of length numTaps. */
-    float32_t mu;        /**< step size that controls filter coefficient updates. */
-  } arm_lms_instance_f32;
+    q31_t y;                                     /* output */
+    q7_t y0, y1;                                 /* Nearest output values */
+    q31_t fract;                                 /* fractional part */
+    uint32_t index;                              /* Index to read nearest output values */
+
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    /* Index value calculation */
+    if (x < 0)
+    {
+      return (pYData[0]);
+    }
+    index = (x >> 20) & 0xfff;
 
+    if (index >= (nValues - 1))
+    {
+      return (pYData[nValues - 1]);
+    }
+    else
+    {
+      /* 20 bits for the fractional part */
+      /* fract is in 12.20 format */
+      fract = (x & 0x000FFFFF);
 
-  /**
-   * @brief Processing function for floating-point LMS filter.
-   * @param[in]  S          points to an instance of the floating-point LMS filter structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[in]  pRef       points to the block of reference data.
-   * @param[out] pOut       points to the block of output data.
-   * @param[out] pErr       points to the block of error data.
-   * @param[in]  blockSize  number of samples to process.
-   */
-  void arm_lms_f32(
-  const arm_lms_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pRef,
-  float32_t * pOut,
-  float32_t * pErr,
-  uint32_t blockSize);
+      /* Read two nearest output values from the index and are in 1.7(q7) format */
+      y0 = pYData[index];
+      y1 = pYData[index + 1];
+
+      /* Calculation of y0 * (1-fract ) and y is in 13.27(q27) format */
+      y = ((y0 * (0xFFFFF - fract)));
+
+      /* Calculation of y1 * fract + y0 * (1-fract) and y is in 13.27(q27) format */
+      y += (y1 * fract);
 
+      /* convert y to 1.7(q7) format */
+      return (q7_t) (y >> 20);
+     }
+  }
 
   /**
-   * @brief Initialization function for floating-point LMS filter.
-   * @param[in] S          points to an instance of the floating-point LMS filter structure.
-   * @param[in] numTaps    number of filter coefficients.
-   * @param[in] pCoeffs    points to the coefficient buffer.
-   * @param[in] pState     points to state buffer.
-   * @param[in] mu         step size that controls filter coefficient updates.
-   * @param[in] blockSize  number of samples to process.
+   * @} end of LinearInterpolate group
    */
-  void arm_lms_init_f32(
-  arm_lms_instance_f32 * S,
-  uint16_t numTaps,
-  float32_t * pCoeffs,
-  float32_t * pState,
-  float32_t mu,
-  uint32_t blockSize);
 
 
   /**
-   * @brief Instance structure for the Q15 LMS filter.
+   * @brief  Floating-point linear interpolation of a block of points in a uniform table.
+   * @param[in]  S          points to an instance of the floating-point Linear Interpolation structure
+   * @param[in]  pSrc       points to the block of input points
+   * @param[out] pDst       points to the block of interpolated values
+   * @param[in]  blockSize  number of points to process
    */
-  typedef struct
-  {
-    uint16_t numTaps;    /**< number of coefficients in the filter. */
-    q15_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q15_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
-    q15_t mu;            /**< step size that controls filter coefficient updates. */
-    uint32_t postShift;  /**< bit shift applied to coefficients. */
-  } arm_lms_instance_q15;
+  void arm_linear_interp_block_f32(
+  const arm_linear_interp_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Initialization function for the Q15 LMS filter.
-   * @param[in] S          points to an instance of the Q15 LMS filter structure.
-   * @param[in] numTaps    number of filter coefficients.
-   * @param[in] pCoeffs    points to the coefficient buffer.
-   * @param[in] pState     points to the state buffer.
-   * @param[in] mu         step size that controls filter coefficient updates.
-   * @param[in] blockSize  number of samples to process.
-   * @param[in] postShift  bit shift applied to coefficients.
+   * @brief  Q31 linear interpolation of a block of points in a uniform table.
+   * @param[in]  pYData     points to the Q31 table
+   * @param[in]  pSrc       points to the block of input points, in 12.20 format
+   * @param[out] pDst       points to the block of interpolated values
+   * @param[in]  nValues    number of table values
+   * @param[in]  blockSize  number of points to process
    */
-  void arm_lms_init_q15(
-  arm_lms_instance_q15 * S,
-  uint16_t numTaps,
-  q15_t * pCoeffs,
-  q15_t * pState,
-  q15_t mu,
-  uint32_t blockSize,
-  uint32_t postShift);
+  void arm_linear_interp_block_q31(
+  q31_t * pYData,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t nValues,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Processing function for Q15 LMS filter.
-   * @param[in]  S          points to an instance of the Q15 LMS filter structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[in]  pRef       points to the block of reference data.
-   * @param[out] pOut       points to the block of output data.
-   * @param[out] pErr       points to the block of error data.
-   * @param[in]  blockSize  number of samples to process.
+   * @brief  Q15 linear interpolation of a block of points in a uniform table.
+   * @param[in]  pYData     points to the Q15 table
+   * @param[in]  pSrc       points to the block of input points, in 12.20 format
+   * @param[out] pDst       points to the block of interpolated values
+   * @param[in]  nValues    number of table values
+   * @param[in]  blockSize  number of points to process
    */
-  void arm_lms_q15(
-  const arm_lms_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pRef,
-  q15_t * pOut,
-  q15_t * pErr,
+  void arm_linear_interp_block_q15(
+  q15_t * pYData,
+  q31_t * pSrc,
+  q15_t * pDst,
+  uint32_t nValues,
   uint32_t blockSize);
 
 
   /**
-   * @brief Instance structure for the Q31 LMS filter.
+   * @brief Instance structure for the floating-point piecewise linear interpolation.
    */
   typedef struct
   {
-    uint16_t numTaps;    /**< number of coefficients in the filter. */
-    q31_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q31_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
-    q31_t mu;            /**< step size that controls filter coefficient updates. */
-    uint32_t postShift;  /**< bit shift applied to coefficients. */
-  } arm_lms_instance_q31;
-
+    uint32_t nValues;                    /**< number of breakpoints. */
+    const float32_t *pXData;             /**< points to the breakpoints, strictly increasing. */
+    const float32_t *pYData;             /**< points to the values at the breakpoints. */
+    float32_t *pSlopes;                  /**< points to the slopes of the nValues-1 segments. */
+    uint16_t *pIndex;                    /**< points to the first segment of each bin of the index, NULL for a binary search. */
+    uint32_t indexLen;                   /**< number of bins of the index. */
+    float32_t indexScale;                /**< number of bins of the index per unit of x. */
+  } arm_pwl_instance_f32;
 
   /**
-   * @brief Processing function for Q31 LMS filter.
-   * @param[in]  S          points to an instance of the Q15 LMS filter structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[in]  pRef       points to the block of reference data.
-   * @param[out] pOut       points to the block of output data.
-   * @param[out] pErr       points to the block of error data.
-   * @param[in]  blockSize  number of samples to process.
+   * @brief Instance structure for the Q15 piecewise linear interpolation.
    */
-  void arm_lms_q31(
-  const arm_lms_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pRef,
-  q31_t * pOut,
-  q31_t * pErr,
-  uint32_t blockSize);
-
+  typedef struct
+  {
+    uint32_t nValues;                    /**< number of breakpoints. */
+    const q15_t *pXData;                 /**< points to the breakpoints, strictly increasing. */
+    const q15_t *pYData;                 /**< points to the values at the breakpoints. */
+    q31_t *pSlopes;                      /**< points to the slopes of the nValues-1 segments, in 17.15 format. */
+    uint16_t *pIndex;                    /**< points to the first segment of each bin of the index, NULL for a binary search. */
+    uint8_t indexBits;                   /**< the index has 2^indexBits bins over the Q15 range. */
+  } arm_pwl_instance_q15;
 
   /**
-   * @brief Initialization function for Q31 LMS filter.
-   * @param[in] S          points to an instance of the Q31 LMS filter structure.
-   * @param[in] numTaps    number of filter coefficients.
-   * @param[in] pCoeffs    points to coefficient buffer.
-   * @param[in] pState     points to state buffer.
-   * @param[in] mu         step size that controls filter coefficient updates.
-   * @param[in] blockSize  number of samples to process.
-   * @param[in] postShift  bit shift applied to coefficients.
+   * @brief End conditions of the cubic spline interpolation.
    */
-  void arm_lms_init_q31(
-  arm_lms_instance_q31 * S,
-  uint16_t numTaps,
-  q31_t * pCoeffs,
-  q31_t * pState,
-  q31_t mu,
-  uint32_t blockSize,
-  uint32_t postShift);
-
+  typedef enum
+  {
+    ARM_SPLINE_NATURAL = 0,              /**< zero second derivative at the ends */
+    ARM_SPLINE_PARABOLIC_RUNOUT = 1      /**< parabolic first and last segments */
+  } arm_spline_type;
 
   /**
-   * @brief Instance structure for the floating-point normalized LMS filter.
+   * @brief Instance structure for the floating-point cubic spline interpolation.
    */
   typedef struct
   {
-    uint16_t numTaps;     /**< number of coefficients in the filter. */
-    float32_t *pState;    /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
-    float32_t mu;         /**< step size that control filter coefficient updates. */
-    float32_t energy;     /**< saves previous frame energy. */
-    float32_t x0;         /**< saves previous input sample. */
-  } arm_lms_norm_instance_f32;
+    arm_spline_type type;                /**< end conditions. */
+    uint32_t nValues;                    /**< number of breakpoints. */
+    const float32_t *pXData;             /**< points to the breakpoints, strictly increasing. */
+    const float32_t *pYData;             /**< points to the values at the breakpoints. */
+    float32_t *pCoeffs;                  /**< points to the 3 * (nValues-1) coefficients of the segments. */
+    uint16_t *pIndex;                    /**< points to the first segment of each bin of the index, NULL for a binary search. */
+    uint32_t indexLen;                   /**< number of bins of the index. */
+    float32_t indexScale;                /**< number of bins of the index per unit of x. */
+  } arm_spline_instance_f32;
+
+
+  /**
+   * @brief  Initialization function for the floating-point piecewise linear interpolation.
+   * @param[out] S         points to an instance of the floating-point piecewise linear interpolation
+   * @param[in]  nValues   number of breakpoints, at least 2
+   * @param[in]  pXData    points to the breakpoints, strictly increasing
+   * @param[in]  pYData    points to the values at the breakpoints
+   * @param[out] pSlopes   points to the slopes of the segments, nValues-1 values
+   * @param[out] pIndex    points to the index, indexLen values, or NULL for a binary search
+   * @param[in]  indexLen  number of bins of the index
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the breakpoints are not valid.
+   */
+  arm_status arm_pwl_init_f32(
+  arm_pwl_instance_f32 * S,
+  uint32_t nValues,
+  const float32_t * pXData,
+  const float32_t * pYData,
+  float32_t * pSlopes,
+  uint16_t * pIndex,
+  uint32_t indexLen);
+
+
+  /**
+   * @brief  Initialization function for the Q15 piecewise linear interpolation.
+   * @param[out] S          points to an instance of the Q15 piecewise linear interpolation
+   * @param[in]  nValues    number of breakpoints, at least 2
+   * @param[in]  pXData     points to the breakpoints, strictly increasing
+   * @param[in]  pYData     points to the values at the breakpoints
+   * @param[out] pSlopes    points to the slopes of the segments, nValues-1 values
+   * @param[out] pIndex     points to the index, 2^indexBits values, or NULL for a binary search
+   * @param[in]  indexBits  the index has 2^indexBits bins, at most 16
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the breakpoints are not valid.
+   */
+  arm_status arm_pwl_init_q15(
+  arm_pwl_instance_q15 * S,
+  uint32_t nValues,
+  const q15_t * pXData,
+  const q15_t * pYData,
+  q31_t * pSlopes,
+  uint16_t * pIndex,
+  uint8_t indexBits);
+
+
+  /**
+   * @brief  Floating-point piecewise linear interpolation of a block of points.
+   * @param[in]  S          points to an instance of the floating-point piecewise linear interpolation
+   * @param[in]  pSrc       points to the block of input points
+   * @param[out] pDst       points to the block of interpolated values
+   * @param[in]  blockSize  number of points to process
+   */
+  void arm_pwl_f32(
+  const arm_pwl_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Processing function for floating-point normalized LMS filter.
-   * @param[in]  S          points to an instance of the floating-point normalized LMS filter structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[in]  pRef       points to the block of reference data.
-   * @param[out] pOut       points to the block of output data.
-   * @param[out] pErr       points to the block of error data.
-   * @param[in]  blockSize  number of samples to process.
+   * @brief  Q15 piecewise linear interpolation of a block of points.
+   * @param[in]  S          points to an instance of the Q15 piecewise linear interpolation
+   * @param[in]  pSrc       points to the block of input points
+   * @param[out] pDst       points to the block of interpolated values
+   * @param[in]  blockSize  number of points to process
    */
-  void arm_lms_norm_f32(
-  arm_lms_norm_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pRef,
-  float32_t * pOut,
-  float32_t * pErr,
+  void arm_pwl_q15(
+  const arm_pwl_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief Initialization function for floating-point normalized LMS filter.
-   * @param[in] S          points to an instance of the floating-point LMS filter structure.
-   * @param[in] numTaps    number of filter coefficients.
-   * @param[in] pCoeffs    points to coefficient buffer.
-   * @param[in] pState     points to state buffer.
-   * @param[in] mu         step size that controls filter coefficient updates.
-   * @param[in] blockSize  number of samples to process.
-   */
-  void arm_lms_norm_init_f32(
-  arm_lms_norm_instance_f32 * S,
-  uint16_t numTaps,
+   * @brief  Initialization function for the floating-point cubic spline interpolation.
+   * @param[out] S         points to an instance of the floating-point cubic spline interpolation
+   * @param[in]  type      end conditions
+   * @param[in]  nValues   number of breakpoints, at least 2
+   * @param[in]  pXData    points to the breakpoints, strictly increasing
+   * @param[in]  pYData    points to the values at the breakpoints
+   * @param[out] pCoeffs   points to the coefficients, 3 * (nValues-1) values
+   * @param[in]  pScratch  points to a scratch buffer of 2 * nValues values
+   * @param[out] pIndex    points to the index, indexLen values, or NULL for a binary search
+   * @param[in]  indexLen  number of bins of the index
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the breakpoints are not valid.
+   */
+  arm_status arm_spline_init_f32(
+  arm_spline_instance_f32 * S,
+  arm_spline_type type,
+  uint32_t nValues,
+  const float32_t * pXData,
+  const float32_t * pYData,
   float32_t * pCoeffs,
-  float32_t * pState,
-  float32_t mu,
+  float32_t * pScratch,
+  uint16_t * pIndex,
+  uint32_t indexLen);
+
+
+  /**
+   * @brief  Floating-point cubic spline interpolation of a block of points.
+   * @param[in]  S          points to an instance of the floating-point cubic spline interpolation
+   * @param[in]  pSrc       points to the block of input points
+   * @param[out] pDst       points to the block of interpolated values
+   * @param[in]  blockSize  number of points to process
+   */
+  void arm_spline_f32(
+  const arm_spline_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief Instance structure for the Q31 normalized LMS filter.
+   * @brief Interpolation modes of the image resize functions.
+   */
+  typedef enum
+  {
+    ARM_RESIZE_NEAREST = 0,              /**< nearest neighbour */
+    ARM_RESIZE_BILINEAR = 1              /**< bilinear interpolation */
+  } arm_resize_mode;
+
+  /**
+   * @brief Instance structure for the image resize functions.
    */
   typedef struct
   {
-    uint16_t numTaps;     /**< number of coefficients in the filter. */
-    q31_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q31_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
-    q31_t mu;             /**< step size that controls filter coefficient updates. */
-    uint8_t postShift;    /**< bit shift applied to coefficients. */
-    q31_t *recipTable;    /**< points to the reciprocal initial value table. */
-    q31_t energy;         /**< saves previous frame energy. */
-    q31_t x0;             /**< saves previous input sample. */
-  } arm_lms_norm_instance_q31;
+    arm_resize_mode mode;                /**< interpolation mode. */
+    uint16_t srcWidth;                   /**< number of columns of the source image. */
+    uint16_t srcHeight;                  /**< number of rows of the source image. */
+    uint16_t dstWidth;                   /**< number of columns of the destination image. */
+    uint16_t dstHeight;                  /**< number of rows of the destination image. */
+    uint16_t xFirst;                     /**< first destination column interpolated between two source columns. */
+    uint16_t xLast;                      /**< destination column after the last interpolated one. */
+    int32_t xStart;                      /**< source column of the first destination column, in 16.16 format. */
+    int32_t yStart;                      /**< source row of the first destination row, in 16.16 format. */
+    uint32_t xStep;                      /**< source columns per destination column, in 16.16 format. */
+    uint32_t yStep;                      /**< source rows per destination row, in 16.16 format. */
+  } arm_resize_instance;
+
+
+  /**
+   * @brief  Initialization function for the image resize functions.
+   * @param[out] S          points to an instance of the image resize structure
+   * @param[in]  mode       interpolation mode
+   * @param[in]  srcWidth   number of columns of the source image
+   * @param[in]  srcHeight  number of rows of the source image
+   * @param[in]  dstWidth   number of columns of the destination image
+   * @param[in]  dstHeight  number of rows of the destination image
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if a size is zero.
+   */
+  arm_status arm_resize_init(
+  arm_resize_instance * S,
+  arm_resize_mode mode,
+  uint16_t srcWidth,
+  uint16_t srcHeight,
+  uint16_t dstWidth,
+  uint16_t dstHeight);
+
+
+  /**
+   * @brief  Resizes one row of an 8-bit grayscale image.
+   * @param[in]  S       points to an instance of the image resize structure
+   * @param[in]  pSrc    points to the source image, srcWidth * srcHeight pixels
+   * @param[in]  dstRow  index of the destination row
+   * @param[out] pDst    points to the destination row, dstWidth pixels
+   */
+  void arm_resize_row_u8(
+  const arm_resize_instance * S,
+  const uint8_t * pSrc,
+  uint16_t dstRow,
+  uint8_t * pDst);
+
+
+  /**
+   * @brief  Resizes an 8-bit grayscale image.
+   * @param[in]  S     points to an instance of the image resize structure
+   * @param[in]  pSrc  points to the source image, srcWidth * srcHeight pixels
+   * @param[out] pDst  points to the destination image, dstWidth * dstHeight pixels
+   */
+  void arm_resize_u8(
+  const arm_resize_instance * S,
+  const uint8_t * pSrc,
+  uint8_t * pDst);
+
+
+  /**
+   * @brief  Resizes one row of a Q15 image.
+   * @param[in]  S       points to an instance of the image resize structure
+   * @param[in]  pSrc    points to the source image, srcWidth * srcHeight pixels
+   * @param[in]  dstRow  index of the destination row
+   * @param[out] pDst    points to the destination row, dstWidth pixels
+   */
+  void arm_resize_row_q15(
+  const arm_resize_instance * S,
+  const q15_t * pSrc,
+  uint16_t dstRow,
+  q15_t * pDst);
 
 
   /**
-   * @brief Processing function for Q31 normalized LMS filter.
-   * @param[in]  S          points to an instance of the Q31 normalized LMS filter structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[in]  pRef       points to the block of reference data.
-   * @param[out] pOut       points to the block of output data.
-   * @param[out] pErr       points to the block of error data.
-   * @param[in]  blockSize  number of samples to process.
+   * @brief  Resizes a Q15 image.
+   * @param[in]  S     points to an instance of the image resize structure
+   * @param[in]  pSrc  points to the source image, srcWidth * srcHeight pixels
+   * @param[out] pDst  points to the destination image, dstWidth * dstHeight pixels
    */
-  void arm_lms_norm_q31(
-  arm_lms_norm_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pRef,
-  q31_t * pOut,
-  q31_t * pErr,
-  uint32_t blockSize);
+  void arm_resize_q15(
+  const arm_resize_instance * S,
+  const q15_t * pSrc,
+  q15_t * pDst);
 
 
   /**
-   * @brief Initialization function for Q31 normalized LMS filter.
-   * @param[in] S          points to an instance of the Q31 normalized LMS filter structure.
-   * @param[in] numTaps    number of filter coefficients.
-   * @param[in] pCoeffs    points to coefficient buffer.
-   * @param[in] pState     points to state buffer.
-   * @param[in] mu         step size that controls filter coefficient updates.
-   * @param[in] blockSize  number of samples to process.
-   * @param[in] postShift  bit shift applied to coefficients.
+   * @brief  Resizes one row of an RGB565 image.
+   * @param[in]  S       points to an instance of the image resize structure
+   * @param[in]  pSrc    points to the source image, srcWidth * srcHeight pixels
+   * @param[in]  dstRow  index of the destination row
+   * @param[out] pDst    points to the destination row, dstWidth pixels
    */
-  void arm_lms_norm_init_q31(
-  arm_lms_norm_instance_q31 * S,
-  uint16_t numTaps,
-  q31_t * pCoeffs,
-  q31_t * pState,
-  q31_t mu,
-  uint32_t blockSize,
-  uint8_t postShift);
+  void arm_resize_row_rgb565(
+  const arm_resize_instance * S,
+  const uint16_t * pSrc,
+  uint16_t dstRow,
+  uint16_t * pDst);
 
 
   /**
-   * @brief Instance structure for the Q15 normalized LMS filter.
+   * @brief  Resizes an RGB565 image.
+   * @param[in]  S     points to an instance of the image resize structure
+   * @param[in]  pSrc  points to the source image, srcWidth * srcHeight pixels
+   * @param[out] pDst  points to the destination image, dstWidth * dstHeight pixels
    */
-  typedef struct
-  {
-    uint16_t numTaps;     /**< Number of coefficients in the filter. */
-    q15_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q15_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
-    q15_t mu;             /**< step size that controls filter coefficient updates. */
-    uint8_t postShift;    /**< bit shift applied to coefficients. */
-    q15_t *recipTable;    /**< Points to the reciprocal initial value table. */
-    q15_t energy;         /**< saves previous frame energy. */
-    q15_t x0;             /**< saves previous input sample. */
-  } arm_lms_norm_instance_q15;
+  void arm_resize_rgb565(
+  const arm_resize_instance * S,
+  const uint16_t * pSrc,
+  uint16_t * pDst);
 
 
   /**
-   * @brief Processing function for Q15 normalized LMS filter.
-   * @param[in]  S          points to an instance of the Q15 normalized LMS filter structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[in]  pRef       points to the block of reference data.
-   * @param[out] pOut       points to the block of output data.
-   * @param[out] pErr       points to the block of error data.
-   * @param[in]  blockSize  number of samples to process.
+   * @brief  Fast approximation to the trigonometric sine function for floating-point data.
+   * @param[in] x  input value in radians.
+   * @return  sin(x).
    */
-  void arm_lms_norm_q15(
-  arm_lms_norm_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pRef,
-  q15_t * pOut,
-  q15_t * pErr,
-  uint32_t blockSize);
+  float32_t arm_sin_f32(
+  float32_t x);
 
 
   /**
-   * @brief Initialization function for Q15 normalized LMS filter.
-   * @param[in] S          points to an instance of the Q15 normalized LMS filter structure.
-   * @param[in] numTaps    number of filter coefficients.
-   * @param[in] pCoeffs    points to coefficient buffer.
-   * @param[in] pState     points to state buffer.
-   * @param[in] mu         step size that controls filter coefficient updates.
-   * @param[in] blockSize  number of samples to process.
-   * @param[in] postShift  bit shift applied to coefficients.
+   * @brief  Fast approximation to the trigonometric sine function for Q31 data.
+   * @param[in] x  Scaled input value in radians.
+   * @return  sin(x).
    */
-  void arm_lms_norm_init_q15(
-  arm_lms_norm_instance_q15 * S,
-  uint16_t numTaps,
-  q15_t * pCoeffs,
-  q15_t * pState,
-  q15_t mu,
-  uint32_t blockSize,
-  uint8_t postShift);
+  q31_t arm_sin_q31(
+  q31_t x);
 
 
   /**
-   * @brief Correlation of floating-point sequences.
-   * @param[in]  pSrcA    points to the first input sequence.
-   * @param[in]  srcALen  length of the first input sequence.
-   * @param[in]  pSrcB    points to the second input sequence.
-   * @param[in]  srcBLen  length of the second input sequence.
-   * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @brief  Fast approximation to the trigonometric sine function for Q15 data.
+   * @param[in] x  Scaled input value in radians.
+   * @return  sin(x).
    */
-  void arm_correlate_f32(
-  float32_t * pSrcA,
-  uint32_t srcALen,
-  float32_t * pSrcB,
-  uint32_t srcBLen,
-  float32_t * pDst);
+  q15_t arm_sin_q15(
+  q15_t x);
 
 
-   /**
-   * @brief Correlation of Q15 sequences
-   * @param[in]  pSrcA     points to the first input sequence.
-   * @param[in]  srcALen   length of the first input sequence.
-   * @param[in]  pSrcB     points to the second input sequence.
-   * @param[in]  srcBLen   length of the second input sequence.
-   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @param[in]  pScratch  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+  /**
+   * @brief  Fast approximation to the trigonometric cosine function for floating-point data.
+   * @param[in] x  input value in radians.
+   * @return  cos(x).
    */
-  void arm_correlate_opt_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst,
-  q15_t * pScratch);
+  float32_t arm_cos_f32(
+  float32_t x);
 
 
   /**
-   * @brief Correlation of Q15 sequences.
-   * @param[in]  pSrcA    points to the first input sequence.
-   * @param[in]  srcALen  length of the first input sequence.
-   * @param[in]  pSrcB    points to the second input sequence.
-   * @param[in]  srcBLen  length of the second input sequence.
-   * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @brief Fast approximation to the trigonometric cosine function for Q31 data.
+   * @param[in] x  Scaled input value in radians.
+   * @return  cos(x).
    */
-
-  void arm_correlate_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst);
+  q31_t arm_cos_q31(
+  q31_t x);
 
 
   /**
-   * @brief Correlation of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4.
-   * @param[in]  pSrcA    points to the first input sequence.
-   * @param[in]  srcALen  length of the first input sequence.
-   * @param[in]  pSrcB    points to the second input sequence.
-   * @param[in]  srcBLen  length of the second input sequence.
-   * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @brief  Fast approximation to the trigonometric cosine function for Q15 data.
+   * @param[in] x  Scaled input value in radians.
+   * @return  cos(x).
    */
-
-  void arm_correlate_fast_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst);
+  q15_t arm_cos_q15(
+  q15_t x);
 
 
   /**
-   * @brief Correlation of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4.
-   * @param[in]  pSrcA     points to the first input sequence.
-   * @param[in]  srcALen   length of the first input sequence.
-   * @param[in]  pSrcB     points to the second input sequence.
-   * @param[in]  srcBLen   length of the second input sequence.
-   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @param[in]  pScratch  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @brief  Fast approximation to the sine function of a block for floating-point data.
+   * @param[in]  pSrc       points to the input vector, in radians
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
-  void arm_correlate_fast_opt_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst,
-  q15_t * pScratch);
+  void arm_vsin_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Correlation of Q31 sequences.
-   * @param[in]  pSrcA    points to the first input sequence.
-   * @param[in]  srcALen  length of the first input sequence.
-   * @param[in]  pSrcB    points to the second input sequence.
-   * @param[in]  srcBLen  length of the second input sequence.
-   * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @brief  Fast approximation to the sine function of a block for Q31 data.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
-  void arm_correlate_q31(
-  q31_t * pSrcA,
-  uint32_t srcALen,
-  q31_t * pSrcB,
-  uint32_t srcBLen,
-  q31_t * pDst);
+  void arm_vsin_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Correlation of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in]  pSrcA    points to the first input sequence.
-   * @param[in]  srcALen  length of the first input sequence.
-   * @param[in]  pSrcB    points to the second input sequence.
-   * @param[in]  srcBLen  length of the second input sequence.
-   * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @brief  Fast approximation to the sine function of a block for Q15 data.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
-  void arm_correlate_fast_q31(
-  q31_t * pSrcA,
-  uint32_t srcALen,
-  q31_t * pSrcB,
-  uint32_t srcBLen,
-  q31_t * pDst);
+  void arm_vsin_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
 
- /**
-   * @brief Correlation of Q7 sequences.
-   * @param[in]  pSrcA      points to the first input sequence.
-   * @param[in]  srcALen    length of the first input sequence.
-   * @param[in]  pSrcB      points to the second input sequence.
-   * @param[in]  srcBLen    length of the second input sequence.
-   * @param[out] pDst       points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @param[in]  pScratch1  points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @param[in]  pScratch2  points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen).
+  /**
+   * @brief  Fast approximation to the cosine function of a block for floating-point data.
+   * @param[in]  pSrc       points to the input vector, in radians
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
-  void arm_correlate_opt_q7(
-  q7_t * pSrcA,
-  uint32_t srcALen,
-  q7_t * pSrcB,
-  uint32_t srcBLen,
-  q7_t * pDst,
-  q15_t * pScratch1,
-  q15_t * pScratch2);
+  void arm_vcos_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Correlation of Q7 sequences.
-   * @param[in]  pSrcA    points to the first input sequence.
-   * @param[in]  srcALen  length of the first input sequence.
-   * @param[in]  pSrcB    points to the second input sequence.
-   * @param[in]  srcBLen  length of the second input sequence.
-   * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @brief  Fast approximation to the cosine function of a block for Q31 data.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
-  void arm_correlate_q7(
-  q7_t * pSrcA,
-  uint32_t srcALen,
-  q7_t * pSrcB,
-  uint32_t srcBLen,
-  q7_t * pDst);
+  void arm_vcos_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Instance structure for the floating-point sparse FIR filter.
+   * @brief  Fast approximation to the cosine function of a block for Q15 data.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
-  typedef struct
-  {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    float32_t *pState;            /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    float32_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_f32;
+  void arm_vcos_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
 
   /**
-   * @brief Instance structure for the Q31 sparse FIR filter.
+   * @brief Instance structure for the configurable floating-point sine and cosine functions.
    */
   typedef struct
   {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    q31_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    q31_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_q31;
+    uint16_t tableSize;             /**< number of table intervals over one period, 0 for the polynomial. */
+    uint16_t tableStride;           /**< distance between two used entries of the table. */
+    const float32_t *pTable;        /**< points to the sine table of tableSize*tableStride+1 entries. */
+    uint16_t numCoeffs;             /**< number of polynomial coefficients, 0 for the table. */
+    const float32_t *pCoeffs;       /**< points to the odd polynomial coefficients. */
+    float32_t maxError;             /**< maximum absolute error of the configuration. */
+  } arm_sincos_instance_f32;
+
 
   /**
-   * @brief Instance structure for the Q15 sparse FIR filter.
+   * @brief  Initialization function for the table based configurable sine and cosine.
+   * @param[in,out] S             points to an instance of the sine and cosine structure.
+   * @param[in]     tableSize     number of table intervals, a power of 2 from 64 to 4096.
+   * @param[in]     pTableBuffer  points to a buffer of tableSize+1 values, used when tableSize is above 512.
+   * @return  ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if the configuration is not supported.
    */
-  typedef struct
-  {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    q15_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    q15_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_q15;
+  arm_status arm_sincos_init_f32(
+  arm_sincos_instance_f32 * S,
+  uint16_t tableSize,
+  float32_t * pTableBuffer);
+
 
   /**
-   * @brief Instance structure for the Q7 sparse FIR filter.
+   * @brief  Initialization function for the polynomial based configurable sine and cosine.
+   * @param[in,out] S      points to an instance of the sine and cosine structure.
+   * @param[in]     order  order of the minimax polynomial, 3, 5, 7, 9 or 11.
+   * @return  ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if the order is not supported.
    */
-  typedef struct
-  {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    q7_t *pState;                 /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    q7_t *pCoeffs;                /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_q7;
+  arm_status arm_sincos_poly_init_f32(
+  arm_sincos_instance_f32 * S,
+  uint16_t order);
 
 
   /**
-   * @brief Processing function for the floating-point sparse FIR filter.
-   * @param[in]  S           points to an instance of the floating-point sparse FIR structure.
-   * @param[in]  pSrc        points to the block of input data.
-   * @param[out] pDst        points to the block of output data
-   * @param[in]  pScratchIn  points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize   number of input samples to process per call.
+   * @brief  Configurable sine function for floating-point data.
+   * @param[in] S  points to an initialized instance of the sine and cosine structure.
+   * @param[in] x  input value in radians.
+   * @return  sin(x).
    */
-  void arm_fir_sparse_f32(
-  arm_fir_sparse_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
-  float32_t * pScratchIn,
-  uint32_t blockSize);
+  float32_t arm_sincos_sin_f32(
+  const arm_sincos_instance_f32 * S,
+  float32_t x);
 
 
   /**
-   * @brief  Initialization function for the floating-point sparse FIR filter.
-   * @param[in,out] S          points to an instance of the floating-point sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     pCoeffs    points to the array of filter coefficients.
-   * @param[in]     pState     points to the state buffer.
-   * @param[in]     pTapDelay  points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @brief  Configurable cosine function for floating-point data.
+   * @param[in] S  points to an initialized instance of the sine and cosine structure.
+   * @param[in] x  input value in radians.
+   * @return  cos(x).
    */
-  void arm_fir_sparse_init_f32(
-  arm_fir_sparse_instance_f32 * S,
-  uint16_t numTaps,
-  float32_t * pCoeffs,
-  float32_t * pState,
-  int32_t * pTapDelay,
-  uint16_t maxDelay,
-  uint32_t blockSize);
+  float32_t arm_sincos_cos_f32(
+  const arm_sincos_instance_f32 * S,
+  float32_t x);
 
 
   /**
-   * @brief Processing function for the Q31 sparse FIR filter.
-   * @param[in]  S           points to an instance of the Q31 sparse FIR structure.
-   * @param[in]  pSrc        points to the block of input data.
-   * @param[out] pDst        points to the block of output data
-   * @param[in]  pScratchIn  points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize   number of input samples to process per call.
+   * @brief  Configurable sine and cosine function for floating-point data.
+   * @param[in]  S     points to an initialized instance of the sine and cosine structure.
+   * @param[in]  x     input value in radians.
+   * @param[out] pSin  points to the sine output.
+   * @param[out] pCos  points to the cosine output.
+   * @return none.
    */
-  void arm_fir_sparse_q31(
-  arm_fir_sparse_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
-  q31_t * pScratchIn,
-  uint32_t blockSize);
+  void arm_sincos_f32(
+  const arm_sincos_instance_f32 * S,
+  float32_t x,
+  float32_t * pSin,
+  float32_t * pCos);
 
 
   /**
-   * @brief  Initialization function for the Q31 sparse FIR filter.
-   * @param[in,out] S          points to an instance of the Q31 sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     pCoeffs    points to the array of filter coefficients.
-   * @param[in]     pState     points to the state buffer.
-   * @param[in]     pTapDelay  points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @brief Instance structure for the floating-point numerically controlled oscillator.
    */
-  void arm_fir_sparse_init_q31(
-  arm_fir_sparse_instance_q31 * S,
-  uint16_t numTaps,
-  q31_t * pCoeffs,
-  q31_t * pState,
-  int32_t * pTapDelay,
-  uint16_t maxDelay,
-  uint32_t blockSize);
+  typedef struct
+  {
+    uint32_t phase;                 /**< phase of the next output, 2^32 is one period. */
+    uint32_t phaseInc;              /**< phase increment per sample. */
+  } arm_nco_instance_f32;
 
 
   /**
-   * @brief Processing function for the Q15 sparse FIR filter.
-   * @param[in]  S            points to an instance of the Q15 sparse FIR structure.
-   * @param[in]  pSrc         points to the block of input data.
-   * @param[out] pDst         points to the block of output data
-   * @param[in]  pScratchIn   points to a temporary buffer of size blockSize.
-   * @param[in]  pScratchOut  points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize    number of input samples to process per call.
+   * @brief Instance structure for the Q31 numerically controlled oscillator.
    */
-  void arm_fir_sparse_q15(
-  arm_fir_sparse_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pDst,
-  q15_t * pScratchIn,
-  q31_t * pScratchOut,
-  uint32_t blockSize);
+  typedef struct
+  {
+    uint32_t phase;                 /**< phase of the next output, 2^32 is one period. */
+    uint32_t phaseInc;              /**< phase increment per sample. */
+  } arm_nco_instance_q31;
+
+
+  /* Tables of the oscillators, from arm_common_tables.h */
+  extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
+  extern const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1];
 
 
   /**
-   * @brief  Initialization function for the Q15 sparse FIR filter.
-   * @param[in,out] S          points to an instance of the Q15 sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     pCoeffs    points to the array of filter coefficients.
-   * @param[in]     pState     points to the state buffer.
-   * @param[in]     pTapDelay  points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @brief  Sine and cosine of a phase of the floating-point oscillator.
+   * @param[in]       phase phase, 2^32 is one period
+   * @param[out]      pSin points to the sine
+   * @param[out]      pCos points to the cosine
+   * @return none.
    */
-  void arm_fir_sparse_init_q15(
-  arm_fir_sparse_instance_q15 * S,
-  uint16_t numTaps,
-  q15_t * pCoeffs,
-  q15_t * pState,
-  int32_t * pTapDelay,
-  uint16_t maxDelay,
-  uint32_t blockSize);
+  CMSIS_INLINE __STATIC_INLINE void arm_nco_sincos_f32(
+  uint32_t phase,
+  float32_t * pSin,
+  float32_t * pCos)
+  {
+    float32_t s0, c0;                            /* Sine and cosine of the nearest entry */
+    float32_t d, h;                              /* Offset from the entry in radians, cos(d) */
+    uint32_t index;                              /* Nearest entry of the table */
+
+    /* Nearest of the 512 entries and offset from it, 2*pi / 2^32 radians per LSB */
+    phase += 0x00400000U;
+    index = phase >> 23U;
+    d = (float32_t) ((int32_t) (phase & 0x007FFFFFU) - 0x00400000) * 1.462918079e-9f;
+
+    s0 = sinTable_f32[index];
+    c0 = sinTable_f32[(index + 128U) & 0x1FFU];
+
+    /* sin(a + d) = sin(a) cos(d) + cos(a) sin(d), with cos(d) = 1 - d^2/2 and sin(d) = d */
+    h = 1.0f - (0.5f * (d * d));
+    *pSin = (s0 * h) + (c0 * d);
+    *pCos = (c0 * h) - (s0 * d);
+  }
 
 
   /**
-   * @brief Processing function for the Q7 sparse FIR filter.
-   * @param[in]  S            points to an instance of the Q7 sparse FIR structure.
-   * @param[in]  pSrc         points to the block of input data.
-   * @param[out] pDst         points to the block of output data
-   * @param[in]  pScratchIn   points to a temporary buffer of size blockSize.
-   * @param[in]  pScratchOut  points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize    number of input samples to process per call.
+   * @brief  Sine and cosine of a phase of the Q31 oscillator.
+   * @param[in]       phase phase, 2^32 is one period
+   * @param[out]      pSin points to the sine
+   * @param[out]      pCos points to the cosine
+   * @return none.
    */
-  void arm_fir_sparse_q7(
-  arm_fir_sparse_instance_q7 * S,
-  q7_t * pSrc,
-  q7_t * pDst,
-  q7_t * pScratchIn,
-  q31_t * pScratchOut,
-  uint32_t blockSize);
+  CMSIS_INLINE __STATIC_INLINE void arm_nco_sincos_q31(
+  uint32_t phase,
+  q31_t * pSin,
+  q31_t * pCos)
+  {
+    q31_t s0, c0;                                /* Sine and cosine of the nearest entry */
+    q31_t d, h;                                  /* Offset from the entry in radians, d^2/2 */
+    uint32_t index;                              /* Nearest entry of the table */
+
+    /* Nearest of the 512 entries and offset from it, pi / 2^31 radians per LSB, pi in 3.29 format */
+    phase += 0x00400000U;
+    index = phase >> 23U;
+    d = (q31_t) (((q63_t) ((int32_t) (phase & 0x007FFFFFU) - 0x00400000) * 0x6487ED51) >> 29);
+
+    s0 = sinTable_q31[index];
+    c0 = sinTable_q31[(index + 128U) & 0x1FFU];
+
+    /* sin(a + d) = sin(a) cos(d) + cos(a) sin(d), with cos(d) = 1 - d^2/2 and sin(d) = d */
+    h = (q31_t) (((q63_t) d * d) >> 32);
+    *pSin = clip_q63_to_q31(((((q63_t) s0 << 31) - ((q63_t) s0 * h)) + ((q63_t) c0 * d)) >> 31);
+    *pCos = clip_q63_to_q31(((((q63_t) c0 << 31) - ((q63_t) c0 * h)) - ((q63_t) s0 * d)) >> 31);
+  }
 
 
   /**
-   * @brief  Initialization function for the Q7 sparse FIR filter.
-   * @param[in,out] S          points to an instance of the Q7 sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     pCoeffs    points to the array of filter coefficients.
-   * @param[in]     pState     points to the state buffer.
-   * @param[in]     pTapDelay  points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @brief  Initialization function for the floating-point oscillator.
+   * @param[in,out] S           points to an instance of the floating-point oscillator structure.
+   * @param[in]     frequency   frequency of the oscillator, in Hz.
+   * @param[in]     sampleRate  sample rate, in Hz.
+   * @param[in]     phase       phase of the first output, in radians.
+   * @return  ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if the sample rate is not positive.
    */
-  void arm_fir_sparse_init_q7(
-  arm_fir_sparse_instance_q7 * S,
-  uint16_t numTaps,
-  q7_t * pCoeffs,
-  q7_t * pState,
-  int32_t * pTapDelay,
-  uint16_t maxDelay,
-  uint32_t blockSize);
+  arm_status arm_nco_init_f32(
+  arm_nco_instance_f32 * S,
+  float32_t frequency,
+  float32_t sampleRate,
+  float32_t phase);
 
 
   /**
-   * @brief  Floating-point sin_cos function.
-   * @param[in]  theta   input value in degrees
-   * @param[out] pSinVal  points to the processed sine output.
-   * @param[out] pCosVal  points to the processed cos output.
+   * @brief  Sets the frequency of the floating-point oscillator, keeping its phase.
+   * @param[in,out] S           points to an instance of the floating-point oscillator structure.
+   * @param[in]     frequency   frequency of the oscillator, in Hz.
+   * @param[in]     sampleRate  sample rate, in Hz.
+   * @return  ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if the sample rate is not positive.
    */
-  void arm_sin_cos_f32(
-  float32_t theta,
-  float32_t * pSinVal,
-  float32_t * pCosVal);
+  arm_status arm_nco_set_frequency_f32(
+  arm_nco_instance_f32 * S,
+  float32_t frequency,
+  float32_t sampleRate);
 
 
   /**
-   * @brief  Q31 sin_cos function.
-   * @param[in]  theta    scaled input value in degrees
-   * @param[out] pSinVal  points to the processed sine output.
-   * @param[out] pCosVal  points to the processed cosine output.
+   * @brief  Initialization function for the Q31 oscillator.
+   * @param[in,out] S          points to an instance of the Q31 oscillator structure.
+   * @param[in]     frequency  frequency divided by half the sample rate.
+   * @param[in]     phase      phase of the first output divided by pi.
+   * @return none.
    */
-  void arm_sin_cos_q31(
-  q31_t theta,
-  q31_t * pSinVal,
-  q31_t * pCosVal);
+  void arm_nco_init_q31(
+  arm_nco_instance_q31 * S,
+  q31_t frequency,
+  q31_t phase);
 
 
   /**
-   * @brief  Floating-point complex conjugate.
-   * @param[in]  pSrc        points to the input vector
-   * @param[out] pDst        points to the output vector
-   * @param[in]  numSamples  number of complex samples in each vector
+   * @brief  Generates a block of the real output of the floating-point oscillator.
+   * @param[in,out] S          points to an instance of the floating-point oscillator structure.
+   * @param[out]    pDst       points to the output, cos(phase).
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
    */
-  void arm_cmplx_conj_f32(
-  float32_t * pSrc,
+  void arm_nco_real_f32(
+  arm_nco_instance_f32 * S,
   float32_t * pDst,
-  uint32_t numSamples);
+  uint32_t blockSize);
+
 
   /**
-   * @brief  Q31 complex conjugate.
-   * @param[in]  pSrc        points to the input vector
-   * @param[out] pDst        points to the output vector
-   * @param[in]  numSamples  number of complex samples in each vector
+   * @brief  Generates a block of the real output of the Q31 oscillator.
+   * @param[in,out] S          points to an instance of the Q31 oscillator structure.
+   * @param[out]    pDst       points to the output, cos(phase).
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
    */
-  void arm_cmplx_conj_q31(
-  q31_t * pSrc,
+  void arm_nco_real_q31(
+  arm_nco_instance_q31 * S,
   q31_t * pDst,
-  uint32_t numSamples);
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Q15 complex conjugate.
-   * @param[in]  pSrc        points to the input vector
-   * @param[out] pDst        points to the output vector
-   * @param[in]  numSamples  number of complex samples in each vector
+   * @brief  Generates a block of the real output of the Q31 oscillator in Q15 format.
+   * @param[in,out] S          points to an instance of the Q31 oscillator structure.
+   * @param[out]    pDst       points to the output, cos(phase).
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
    */
-  void arm_cmplx_conj_q15(
-  q15_t * pSrc,
+  void arm_nco_real_q15(
+  arm_nco_instance_q31 * S,
   q15_t * pDst,
-  uint32_t numSamples);
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Floating-point complex magnitude squared
-   * @param[in]  pSrc        points to the complex input vector
-   * @param[out] pDst        points to the real output vector
-   * @param[in]  numSamples  number of complex samples in the input vector
+   * @brief  Generates a block of the complex output of the floating-point oscillator.
+   * @param[in,out] S          points to an instance of the floating-point oscillator structure.
+   * @param[out]    pDst       points to the interleaved output, cos(phase) + j sin(phase).
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
    */
-  void arm_cmplx_mag_squared_f32(
+  void arm_nco_iq_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Generates a block of the complex output of the Q31 oscillator.
+   * @param[in,out] S          points to an instance of the Q31 oscillator structure.
+   * @param[out]    pDst       points to the interleaved output, cos(phase) + j sin(phase).
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
+   */
+  void arm_nco_iq_q31(
+  arm_nco_instance_q31 * S,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Mixes a block of a real floating-point signal with the oscillator.
+   * @param[in,out] S          points to an instance of the floating-point oscillator structure.
+   * @param[in]     pSrc       points to the real input.
+   * @param[out]    pDst       points to the interleaved complex output.
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
+   */
+  void arm_nco_mix_f32(
+  arm_nco_instance_f32 * S,
   float32_t * pSrc,
   float32_t * pDst,
-  uint32_t numSamples);
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Q31 complex magnitude squared
-   * @param[in]  pSrc        points to the complex input vector
-   * @param[out] pDst        points to the real output vector
-   * @param[in]  numSamples  number of complex samples in the input vector
+   * @brief  Mixes a block of a real Q31 signal with the oscillator.
+   * @param[in,out] S          points to an instance of the Q31 oscillator structure.
+   * @param[in]     pSrc       points to the real input.
+   * @param[out]    pDst       points to the interleaved complex output.
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
    */
-  void arm_cmplx_mag_squared_q31(
+  void arm_nco_mix_q31(
+  arm_nco_instance_q31 * S,
   q31_t * pSrc,
   q31_t * pDst,
-  uint32_t numSamples);
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Q15 complex magnitude squared
-   * @param[in]  pSrc        points to the complex input vector
-   * @param[out] pDst        points to the real output vector
-   * @param[in]  numSamples  number of complex samples in the input vector
+   * @brief  Mixes a block of a complex floating-point signal with the oscillator.
+   * @param[in,out] S          points to an instance of the floating-point oscillator structure.
+   * @param[in]     pSrc       points to the interleaved complex input.
+   * @param[out]    pDst       points to the interleaved complex output.
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
    */
-  void arm_cmplx_mag_squared_q15(
-  q15_t * pSrc,
-  q15_t * pDst,
-  uint32_t numSamples);
+  void arm_nco_mix_cmplx_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
 
- /**
-   * @ingroup groupController
+  /**
+   * @brief  Mixes a block of a complex Q31 signal with the oscillator.
+   * @param[in,out] S          points to an instance of the Q31 oscillator structure.
+   * @param[in]     pSrc       points to the interleaved complex input.
+   * @param[out]    pDst       points to the interleaved complex output.
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
    */
+  void arm_nco_mix_cmplx_q31(
+  arm_nco_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
 
   /**
-   * @defgroup PID PID Motor Control
-   *
-   * A Proportional Integral Derivative (PID) controller is a generic feedback control
-   * loop mechanism widely used in industrial control systems.
-   * A PID controller is the most commonly used type of feedback controller.
-   *
-   * This set of functions implements (PID) controllers
-   * for Q15, Q31, and floating-point data types.  The functions operate on a single sample
-   * of data and each call to the function returns a single processed value.
-   * <code>S</code> points to an instance of the PID control data structure.  <code>in</code>
-   * is the input sample value. The functions return the output value.
-   *
-   * \par Algorithm:
-   * <pre>
-   *    y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]
-   *    A0 = Kp + Ki + Kd
-   *    A1 = (-Kp ) - (2 * Kd )
-   *    A2 = Kd  </pre>
-   *
-   * \par
-   * where \c Kp is proportional constant, \c Ki is Integral constant and \c Kd is Derivative constant
-   *
-   * \par
-   * \image html PID.gif "Proportional Integral Derivative Controller"
-   *
-   * \par
-   * The PID controller calculates an "error" value as the difference between
-   * the measured output and the reference input.
-   * The controller attempts to minimize the error by adjusting the process control inputs.
-   * The proportional value determines the reaction to the current error,
-   * the integral value determines the reaction based on the sum of recent errors,
-   * and the derivative value determines the reaction based on the rate at which the error has been changing.
-   *
-   * \par Instance Structure
-   * The Gains A0, A1, A2 and state variables for a PID controller are stored together in an instance data structure.
-   * A separate instance structure must be defined for each PID Controller.
-   * There are separate instance structure declarations for each of the 3 supported data types.
-   *
-   * \par Reset Functions
-   * There is also an associated reset function for each data type which clears the state array.
-   *
-   * \par Initialization Functions
-   * There is also an associated initialization function for each data type.
-   * The initialization function performs the following operations:
-   * - Initializes the Gains A0, A1, A2 from Kp,Ki, Kd gains.
-   * - Zeros out the values in the state buffer.
-   *
-   * \par
-   * Instance structure cannot be placed into a const data section and it is recommended to use the initialization function.
-   *
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the fixed-point versions of the PID Controller functions.
-   * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
+   * @ingroup groupFastMath
    */
 
+
   /**
-   * @addtogroup PID
+   * @addtogroup SinCosConfig
    * @{
    */
 
+/**
+ * @brief Order of the polynomial of arm_sin_fast_f32() and arm_cos_fast_f32(), 5 or 7.
+ */
+#ifndef ARM_MATH_SIN_FAST_ORDER
+#define ARM_MATH_SIN_FAST_ORDER 5
+#endif
+
   /**
-   * @brief  Process function for the floating-point PID Control.
-   * @param[in,out] S   is an instance of the floating-point PID Control structure
-   * @param[in]     in  input sample to process
-   * @return out processed output sample.
+   * @brief  Branch-free sine or cosine of an angle in turns.
+   * @param[in] t  input value in turns, 1.0 is one period.
+   * @return  sin(2*pi*t).
+   *
+   * The angle is reduced to [-0.5 0.5] by adding and subtracting 1.5*2^23, which rounds
+   * to the nearest integer in the default rounding mode, and folded onto [0 0.25] with
+   * two absolute values.  The sign of the reduced angle is copied onto the result.
    */
-  CMSIS_INLINE __STATIC_INLINE float32_t arm_pid_f32(
-  arm_pid_instance_f32 * S,
-  float32_t in)
+  CMSIS_INLINE __STATIC_INLINE float32_t arm_sincos_turn_fast_f32(
+  float32_t t)
   {
-    float32_t out;
-
-    /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]  */
-    out = (S->A0 * in) +
-      (S->A1 * S->state[0]) + (S->A2 * S->state[1]) + (S->state[2]);
-
-    /* Update state */
-    S->state[1] = S->state[0];
-    S->state[0] = in;
-    S->state[2] = out;
+    union
+    {
+      float32_t f;
+      uint32_t i;
+    } sign, out;
+    float32_t w, w2;
+
+    /* Reduce to [-0.5 0.5], valid for |t| < 2^22 */
+    t = t - ((t + 12582912.0f) - 12582912.0f);
+    sign.f = t;
+
+    /* Fold |t| onto w in [0 0.25], sin(2*pi*|t|) = sin(2*pi*w) */
+    w = 0.25f - fabsf(0.25f - fabsf(t));
+    w2 = w * w;
+
+#if (ARM_MATH_SIN_FAST_ORDER == 7)
+    out.f = w * (6.28317940663546f + w2 * (-41.33894249855665f +
+                 w2 * (81.39535863390422f + w2 * -71.47469431773034f)));
+#else
+    out.f = w * (6.282505600119557f + w2 * (-41.16644233591266f +
+                 w2 * 74.45241877214927f));
+#endif
 
-    /* return to application */
-    return (out);
+    /* Copy the sign of t */
+    out.i |= sign.i & 0x80000000U;
 
+    return (out.f);
   }
 
+
   /**
-   * @brief  Process function for the Q31 PID Control.
-   * @param[in,out] S  points to an instance of the Q31 PID Control structure
-   * @param[in]     in  input sample to process
-   * @return out processed output sample.
+   * @brief  Branch-free fast sine function for floating-point data.
+   * @param[in] x  input value in radians.
+   * @return  sin(x).
    *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 64-bit accumulator.
-   * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
-   * Thus, if the accumulator result overflows it wraps around rather than clip.
-   * In order to avoid overflows completely the input signal must be scaled down by 2 bits as there are four additions.
-   * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.32 format and then saturated to 1.31 format.
+   * For |x| <= 2*pi, the maximum absolute error is 1.1e-4 with ARM_MATH_SIN_FAST_ORDER 5,
+   * and 1.3e-6 with 7.  Larger arguments lose accuracy: the rounding of x/(2*pi) adds up to
+   * about 8e-8 * |x|, 8e-4 at |x| = 1e4, and the result is meaningless above 1e7.  Wrap the
+   * angle to [-2*pi 2*pi] to keep the error bound.
    */
-  CMSIS_INLINE __STATIC_INLINE q31_t arm_pid_q31(
-  arm_pid_instance_q31 * S,
-  q31_t in)
+  CMSIS_INLINE __STATIC_INLINE float32_t arm_sin_fast_f32(
+  float32_t x)
   {
-    q63_t acc;
-    q31_t out;
-
-    /* acc = A0 * x[n]  */
-    acc = (q63_t) S->A0 * in;
-
-    /* acc += A1 * x[n-1] */
-    acc += (q63_t) S->A1 * S->state[0];
+    return (arm_sincos_turn_fast_f32(x * 0.159154943092f));
+  }
 
-    /* acc += A2 * x[n-2]  */
-    acc += (q63_t) S->A2 * S->state[1];
 
-    /* convert output to 1.31 format to add y[n-1] */
-    out = (q31_t) (acc >> 31U);
+  /**
+   * @brief  Branch-free fast cosine function for floating-point data.
+   * @param[in] x  input value in radians.
+   * @return  cos(x).
+   *
+   * For |x| <= 2*pi, the maximum absolute error is 1.1e-4 with ARM_MATH_SIN_FAST_ORDER 5,
+   * and 1.3e-6 with 7.  Larger arguments lose accuracy: the rounding of x/(2*pi) adds up to
+   * about 8e-8 * |x|, 8e-4 at |x| = 1e4, and the result is meaningless above 1e7.  Wrap the
+   * angle to [-2*pi 2*pi] to keep the error bound.
+   */
+  CMSIS_INLINE __STATIC_INLINE float32_t arm_cos_fast_f32(
+  float32_t x)
+  {
+    return (arm_sincos_turn_fast_f32((x * 0.159154943092f) + 0.25f));
+  }
 
-    /* out += y[n-1] */
-    out += S->state[2];
+  /**
+   * @} end of SinCosConfig group
+   */
 
-    /* Update state */
-    S->state[1] = S->state[0];
-    S->state[0] = in;
-    S->state[2] = out;
 
-    /* return to application */
-    return (out);
-  }
+  /**
+   * @ingroup groupFastMath
+   */
 
 
   /**
-   * @brief  Process function for the Q15 PID Control.
-   * @param[in,out] S   points to an instance of the Q15 PID Control structure
-   * @param[in]     in  input sample to process
-   * @return out processed output sample.
+   * @defgroup SQRT Square Root
    *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using a 64-bit internal accumulator.
-   * Both Gains and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
-   * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
-   * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
-   * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
-   * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+   * Computes the square root of a number.
+   * There are separate functions for Q15, Q31, and floating-point data types.
+   * The square root function is computed using the Newton-Raphson algorithm.
+   * This is an iterative algorithm of the form:
+   * <pre>
+   *      x1 = x0 - f(x0)/f'(x0)
+   * </pre>
+   * where <code>x1</code> is the current estimate,
+   * <code>x0</code> is the previous estimate, and
+   * <code>f'(x0)</code> is the derivative of <code>f()</code> evaluated at <code>x0</code>.
+   * For the square root function, the algorithm reduces to:
+   * <pre>
+   *     x0 = in/2                         [initial guess]
+   *     x1 = 1/2 * ( x0 + in / x0)        [each iteration]
+   * </pre>
    */
-  CMSIS_INLINE __STATIC_INLINE q15_t arm_pid_q15(
-  arm_pid_instance_q15 * S,
-  q15_t in)
-  {
-    q63_t acc;
-    q15_t out;
 
-#if defined (ARM_MATH_DSP)
-    __SIMD32_TYPE *vstate;
 
-    /* Implementation of PID controller */
+  /**
+   * @addtogroup SQRT
+   * @{
+   */
 
-    /* acc = A0 * x[n]  */
-    acc = (q31_t) __SMUAD((uint32_t)S->A0, (uint32_t)in);
+  /**
+   * @brief  Floating-point square root function.
+   * @param[in]  in    input value.
+   * @param[out] pOut  square root of input value.
+   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
+   * <code>in</code> is negative value and returns zero output for negative values.
+   */
+  CMSIS_INLINE __STATIC_INLINE arm_status arm_sqrt_f32(
+  float32_t in,
+  float32_t * pOut)
+  {
+    if (in >= 0.0f)
+    {
 
-    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
-    vstate = __SIMD32_CONST(S->state);
-    acc = (q63_t)__SMLALD((uint32_t)S->A1, (uint32_t)*vstate, (uint64_t)acc);
+#if   (__FPU_USED == 1) && defined ( __CC_ARM   )
+      *pOut = __sqrtf(in);
+#elif (__FPU_USED == 1) && (defined(__ARMCC_VERSION) && (__ARMCC_VERSION >= 6010050))
+      *pOut = __builtin_sqrtf(in);
+#elif (__FPU_USED == 1) && defined(__GNUC__)
+      *pOut = __builtin_sqrtf(in);
+#elif (__FPU_USED == 1) && defined ( __ICCARM__ ) && (__VER__ >= 6040000)
+      __ASM("VSQRT.F32 %0,%1" : "=t"(*pOut) : "t"(in));
 #else
-    /* acc = A0 * x[n]  */
-    acc = ((q31_t) S->A0) * in;
-
-    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
-    acc += (q31_t) S->A1 * S->state[0];
-    acc += (q31_t) S->A2 * S->state[1];
+      *pOut = sqrtf(in);
 #endif
 
-    /* acc += y[n-1] */
-    acc += (q31_t) S->state[2] << 15;
-
-    /* saturate the output */
-    out = (q15_t) (__SSAT((acc >> 15), 16));
-
-    /* Update state */
-    S->state[1] = S->state[0];
-    S->state[0] = in;
-    S->state[2] = out;
-
-    /* return to application */
-    return (out);
+      return (ARM_MATH_SUCCESS);
+    }
+    else
+    {
+      *pOut = 0.0f;
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
   }
 
+
   /**
-   * @} end of PID group
+   * @brief Q31 square root function.
+   * @param[in]  in    input value.  The range of the input value is [0 +1) or 0x00000000 to 0x7FFFFFFF.
+   * @param[out] pOut  square root of input value.
+   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
+   * <code>in</code> is negative value and returns zero output for negative values.
    */
+  arm_status arm_sqrt_q31(
+  q31_t in,
+  q31_t * pOut);
 
 
   /**
-   * @brief Floating-point matrix inverse.
-   * @param[in]  src   points to the instance of the input floating-point matrix structure.
-   * @param[out] dst   points to the instance of the output floating-point matrix structure.
-   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
-   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   * @brief  Q15 square root function.
+   * @param[in]  in    input value.  The range of the input value is [0 +1) or 0x0000 to 0x7FFF.
+   * @param[out] pOut  square root of input value.
+   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
+   * <code>in</code> is negative value and returns zero output for negative values.
    */
-  arm_status arm_mat_inverse_f32(
-  const arm_matrix_instance_f32 * src,
-  arm_matrix_instance_f32 * dst);
+  arm_status arm_sqrt_q15(
+  q15_t in,
+  q15_t * pOut);
 
 
   /**
-   * @brief Floating-point matrix inverse.
-   * @param[in]  src   points to the instance of the input floating-point matrix structure.
-   * @param[out] dst   points to the instance of the output floating-point matrix structure.
-   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
-   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   * @brief  Square root of a block for floating-point data.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
-  arm_status arm_mat_inverse_f64(
-  const arm_matrix_instance_f64 * src,
-  arm_matrix_instance_f64 * dst);
-
+  void arm_vsqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @ingroup groupController
+   * @brief  Square root of a block for Q31 data.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
+  void arm_vsqrt_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
-  /**
-   * @defgroup clarke Vector Clarke Transform
-   * Forward Clarke transform converts the instantaneous stator phases into a two-coordinate time invariant vector.
-   * Generally the Clarke transform uses three-phase currents <code>Ia, Ib and Ic</code> to calculate currents
-   * in the two-phase orthogonal stator axis <code>Ialpha</code> and <code>Ibeta</code>.
-   * When <code>Ialpha</code> is superposed with <code>Ia</code> as shown in the figure below
-   * \image html clarke.gif Stator current space vector and its components in (a,b).
-   * and <code>Ia + Ib + Ic = 0</code>, in this condition <code>Ialpha</code> and <code>Ibeta</code>
-   * can be calculated using only <code>Ia</code> and <code>Ib</code>.
-   *
-   * The function operates on a single sample of data and each call to the function returns the processed output.
-   * The library provides separate functions for Q31 and floating-point data types.
-   * \par Algorithm
-   * \image html clarkeFormula.gif
-   * where <code>Ia</code> and <code>Ib</code> are the instantaneous stator phases and
-   * <code>pIalpha</code> and <code>pIbeta</code> are the two coordinates of time invariant vector.
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the Q31 version of the Clarke transform.
-   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
-   */
 
   /**
-   * @addtogroup clarke
-   * @{
+   * @brief  Square root of a block for Q15 data.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
+  void arm_vsqrt_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
   /**
-   *
-   * @brief  Floating-point Clarke transform
-   * @param[in]  Ia       input three-phase coordinate <code>a</code>
-   * @param[in]  Ib       input three-phase coordinate <code>b</code>
-   * @param[out] pIalpha  points to output two-phase orthogonal vector axis alpha
-   * @param[out] pIbeta   points to output two-phase orthogonal vector axis beta
+   * @} end of SQRT group
    */
-  CMSIS_INLINE __STATIC_INLINE void arm_clarke_f32(
-  float32_t Ia,
-  float32_t Ib,
-  float32_t * pIalpha,
-  float32_t * pIbeta)
-  {
-    /* Calculate pIalpha using the equation, pIalpha = Ia */
-    *pIalpha = Ia;
-
-    /* Calculate pIbeta using the equation, pIbeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
-    *pIbeta = ((float32_t) 0.57735026919 * Ia + (float32_t) 1.15470053838 * Ib);
-  }
 
 
   /**
-   * @brief  Clarke transform for Q31 version
-   * @param[in]  Ia       input three-phase coordinate <code>a</code>
-   * @param[in]  Ib       input three-phase coordinate <code>b</code>
-   * @param[out] pIalpha  points to output two-phase orthogonal vector axis alpha
-   * @param[out] pIbeta   points to output two-phase orthogonal vector axis beta
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 32-bit accumulator.
-   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
-   * There is saturation on the addition, hence there is no risk of overflow.
+   * @brief  Exponential of a block for floating-point data.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
-  CMSIS_INLINE __STATIC_INLINE void arm_clarke_q31(
-  q31_t Ia,
-  q31_t Ib,
-  q31_t * pIalpha,
-  q31_t * pIbeta)
-  {
-    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
-
-    /* Calculating pIalpha from Ia by equation pIalpha = Ia */
-    *pIalpha = Ia;
-
-    /* Intermediate product is calculated by (1/(sqrt(3)) * Ia) */
-    product1 = (q31_t) (((q63_t) Ia * 0x24F34E8B) >> 30);
-
-    /* Intermediate product is calculated by (2/sqrt(3) * Ib) */
-    product2 = (q31_t) (((q63_t) Ib * 0x49E69D16) >> 30);
-
-    /* pIbeta is calculated by adding the intermediate products */
-    *pIbeta = __QADD(product1, product2);
-  }
+  void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
-  /**
-   * @} end of clarke group
-   */
 
   /**
-   * @brief  Converts the elements of the Q7 vector to Q31 vector.
-   * @param[in]  pSrc       input pointer
-   * @param[out] pDst       output pointer
-   * @param[in]  blockSize  number of samples to process
+   * @brief  Exponential of a block for Q31 data.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
-  void arm_q7_to_q31(
-  q7_t * pSrc,
+  void arm_vexp_q31(
+  q31_t * pSrc,
   q31_t * pDst,
   uint32_t blockSize);
 
 
-
   /**
-   * @ingroup groupController
+   * @brief  Exponential of a block for Q15 data.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
+  void arm_vexp_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
-  /**
-   * @defgroup inv_clarke Vector Inverse Clarke Transform
-   * Inverse Clarke transform converts the two-coordinate time invariant vector into instantaneous stator phases.
-   *
-   * The function operates on a single sample of data and each call to the function returns the processed output.
-   * The library provides separate functions for Q31 and floating-point data types.
-   * \par Algorithm
-   * \image html clarkeInvFormula.gif
-   * where <code>pIa</code> and <code>pIb</code> are the instantaneous stator phases and
-   * <code>Ialpha</code> and <code>Ibeta</code> are the two coordinates of time invariant vector.
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the Q31 version of the Clarke transform.
-   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
-   */
 
   /**
-   * @addtogroup inv_clarke
-   * @{
+   * @brief  Natural logarithm of a block for floating-point data.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
+  void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
-   /**
-   * @brief  Floating-point Inverse Clarke transform
-   * @param[in]  Ialpha  input two-phase orthogonal vector axis alpha
-   * @param[in]  Ibeta   input two-phase orthogonal vector axis beta
-   * @param[out] pIa     points to output three-phase coordinate <code>a</code>
-   * @param[out] pIb     points to output three-phase coordinate <code>b</code>
-   */
-  CMSIS_INLINE __STATIC_INLINE void arm_inv_clarke_f32(
-  float32_t Ialpha,
-  float32_t Ibeta,
-  float32_t * pIa,
-  float32_t * pIb)
-  {
-    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
-    *pIa = Ialpha;
 
-    /* Calculating pIb from Ialpha and Ibeta by equation pIb = -(1/2) * Ialpha + (sqrt(3)/2) * Ibeta */
-    *pIb = -0.5f * Ialpha + 0.8660254039f * Ibeta;
-  }
+  /**
+   * @brief  Natural logarithm of a block for Q31 data.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
+   */
+  void arm_vlog_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Inverse Clarke transform for Q31 version
-   * @param[in]  Ialpha  input two-phase orthogonal vector axis alpha
-   * @param[in]  Ibeta   input two-phase orthogonal vector axis beta
-   * @param[out] pIa     points to output three-phase coordinate <code>a</code>
-   * @param[out] pIb     points to output three-phase coordinate <code>b</code>
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 32-bit accumulator.
-   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
-   * There is saturation on the subtraction, hence there is no risk of overflow.
+   * @brief  Natural logarithm of a block for Q15 data.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
-  CMSIS_INLINE __STATIC_INLINE void arm_inv_clarke_q31(
-  q31_t Ialpha,
-  q31_t Ibeta,
-  q31_t * pIa,
-  q31_t * pIb)
-  {
-    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
-
-    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
-    *pIa = Ialpha;
+  void arm_vlog_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
-    /* Intermediate product is calculated by (1/(2*sqrt(3)) * Ia) */
-    product1 = (q31_t) (((q63_t) (Ialpha) * (0x40000000)) >> 31);
 
-    /* Intermediate product is calculated by (1/sqrt(3) * pIb) */
-    product2 = (q31_t) (((q63_t) (Ibeta) * (0x6ED9EBA1)) >> 31);
+  /**
+   * @brief  Four quadrant arctangent of a block for floating-point data.
+   * @param[in]  pSrcY      points to the y coordinates
+   * @param[in]  pSrcX      points to the x coordinates
+   * @param[out] pDst       points to the output angles
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
+   */
+  void arm_vatan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize);
 
-    /* pIb is calculated by subtracting the products */
-    *pIb = __QSUB(product2, product1);
-  }
 
   /**
-   * @} end of inv_clarke group
+   * @brief  Four quadrant arctangent of a block for Q31 data.
+   * @param[in]  pSrcY      points to the y coordinates
+   * @param[in]  pSrcX      points to the x coordinates
+   * @param[out] pDst       points to the output angles
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
+  void arm_vatan2_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize);
+
 
   /**
-   * @brief  Converts the elements of the Q7 vector to Q15 vector.
-   * @param[in]  pSrc       input pointer
-   * @param[out] pDst       output pointer
-   * @param[in]  blockSize  number of samples to process
-   */
-  void arm_q7_to_q15(
-  q7_t * pSrc,
+   * @brief  Four quadrant arctangent of a block for Q15 data.
+   * @param[in]  pSrcY      points to the y coordinates
+   * @param[in]  pSrcX      points to the x coordinates
+   * @param[out] pDst       points to the output angles
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
+   */
+  void arm_vatan2_q15(
+  q15_t * pSrcY,
+  q15_t * pSrcX,
   q15_t * pDst,
   uint32_t blockSize);
 
 
+  /**
+   * @brief  Fixed-point division for Q31 data.
+   * @param[in]  numerator    numerator
+   * @param[in]  denominator  denominator
+   * @param[out] quotient     points to the quotient, the result is quotient * 2^shift
+   * @param[out] shift        points to the left shift of the quotient
+   * @return ARM_MATH_SUCCESS or ARM_MATH_NANINF for a null denominator.
+   */
+  arm_status arm_divide_q31(
+  q31_t numerator,
+  q31_t denominator,
+  q31_t * quotient,
+  int16_t * shift);
+
 
   /**
-   * @ingroup groupController
+   * @brief  Fixed-point division for Q15 data.
+   * @param[in]  numerator    numerator
+   * @param[in]  denominator  denominator
+   * @param[out] quotient     points to the quotient, the result is quotient * 2^shift
+   * @param[out] shift        points to the left shift of the quotient
+   * @return ARM_MATH_SUCCESS or ARM_MATH_NANINF for a null denominator.
    */
+  arm_status arm_divide_q15(
+  q15_t numerator,
+  q15_t denominator,
+  q15_t * quotient,
+  int16_t * shift);
+
 
   /**
-   * @defgroup park Vector Park Transform
-   *
-   * Forward Park transform converts the input two-coordinate vector to flux and torque components.
-   * The Park transform can be used to realize the transformation of the <code>Ialpha</code> and the <code>Ibeta</code> currents
-   * from the stationary to the moving reference frame and control the spatial relationship between
-   * the stator vector current and rotor flux vector.
-   * If we consider the d axis aligned with the rotor flux, the diagram below shows the
-   * current vector and the relationship from the two reference frames:
-   * \image html park.gif "Stator current space vector and its component in (a,b) and in the d,q rotating reference frame"
-   *
-   * The function operates on a single sample of data and each call to the function returns the processed output.
-   * The library provides separate functions for Q31 and floating-point data types.
-   * \par Algorithm
-   * \image html parkFormula.gif
-   * where <code>Ialpha</code> and <code>Ibeta</code> are the stator vector components,
-   * <code>pId</code> and <code>pIq</code> are rotor vector components and <code>cosVal</code> and <code>sinVal</code> are the
-   * cosine and sine values of theta (rotor flux position).
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the Q31 version of the Park transform.
-   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
+   * @brief  Saturating division of a block for Q31 data.
+   * @param[in]  pSrcA      points to the numerators
+   * @param[in]  pSrcB      points to the denominators
+   * @param[out] pDst       points to the quotients
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
+  void arm_vdivide_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t blockSize);
+
 
   /**
-   * @addtogroup park
-   * @{
+   * @brief  Saturating division of a block for Q15 data.
+   * @param[in]  pSrcA      points to the numerators
+   * @param[in]  pSrcB      points to the denominators
+   * @param[out] pDst       points to the quotients
+   * @param[in]  blockSize  number of samples in each vector
+   * @return none.
    */
+  void arm_vdivide_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize);
+
 
   /**
-   * @brief Floating-point Park transform
-   * @param[in]  Ialpha  input two-phase vector coordinate alpha
-   * @param[in]  Ibeta   input two-phase vector coordinate beta
-   * @param[out] pId     points to output   rotor reference frame d
-   * @param[out] pIq     points to output   rotor reference frame q
-   * @param[in]  sinVal  sine value of rotation angle theta
-   * @param[in]  cosVal  cosine value of rotation angle theta
-   *
-   * The function implements the forward Park transform.
-   *
+   * @brief floating-point Circular write function.
    */
-  CMSIS_INLINE __STATIC_INLINE void arm_park_f32(
-  float32_t Ialpha,
-  float32_t Ibeta,
-  float32_t * pId,
-  float32_t * pIq,
-  float32_t sinVal,
-  float32_t cosVal)
+  CMSIS_INLINE __STATIC_INLINE void arm_circularWrite_f32(
+  int32_t * circBuffer,
+  int32_t L,
+  uint16_t * writeOffset,
+  int32_t bufferInc,
+  const int32_t * src,
+  int32_t srcInc,
+  uint32_t blockSize)
   {
-    /* Calculate pId using the equation, pId = Ialpha * cosVal + Ibeta * sinVal */
-    *pId = Ialpha * cosVal + Ibeta * sinVal;
+    uint32_t i = 0U;
+    int32_t wOffset;
 
-    /* Calculate pIq using the equation, pIq = - Ialpha * sinVal + Ibeta * cosVal */
-    *pIq = -Ialpha * sinVal + Ibeta * cosVal;
+    /* Copy the value of Index pointer that points
+     * to the current location where the input samples to be copied */
+    wOffset = *writeOffset;
+
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while (i > 0U)
+    {
+      /* copy the input sample to the circular buffer */
+      circBuffer[wOffset] = *src;
+
+      /* Update the input pointer */
+      src += srcInc;
+
+      /* Circularly update wOffset.  Watch out for positive and negative value */
+      wOffset += bufferInc;
+      if (wOffset >= L)
+        wOffset -= L;
+
+      /* Decrement the loop counter */
+      i--;
+    }
+
+    /* Update the index pointer */
+    *writeOffset = (uint16_t)wOffset;
   }
 
 
+
   /**
-   * @brief  Park transform for Q31 version
-   * @param[in]  Ialpha  input two-phase vector coordinate alpha
-   * @param[in]  Ibeta   input two-phase vector coordinate beta
-   * @param[out] pId     points to output rotor reference frame d
-   * @param[out] pIq     points to output rotor reference frame q
-   * @param[in]  sinVal  sine value of rotation angle theta
-   * @param[in]  cosVal  cosine value of rotation angle theta
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 32-bit accumulator.
-   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
-   * There is saturation on the addition and subtraction, hence there is no risk of overflow.
+   * @brief floating-point Circular Read function.
    */
-  CMSIS_INLINE __STATIC_INLINE void arm_park_q31(
-  q31_t Ialpha,
-  q31_t Ibeta,
-  q31_t * pId,
-  q31_t * pIq,
-  q31_t sinVal,
-  q31_t cosVal)
+  CMSIS_INLINE __STATIC_INLINE void arm_circularRead_f32(
+  int32_t * circBuffer,
+  int32_t L,
+  int32_t * readOffset,
+  int32_t bufferInc,
+  int32_t * dst,
+  int32_t * dst_base,
+  int32_t dst_length,
+  int32_t dstInc,
+  uint32_t blockSize)
   {
-    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
-    q31_t product3, product4;                    /* Temporary variables used to store intermediate results */
+    uint32_t i = 0U;
+    int32_t rOffset, dst_end;
 
-    /* Intermediate product is calculated by (Ialpha * cosVal) */
-    product1 = (q31_t) (((q63_t) (Ialpha) * (cosVal)) >> 31);
+    /* Copy the value of Index pointer that points
+     * to the current location from where the input samples to be read */
+    rOffset = *readOffset;
+    dst_end = (int32_t) (dst_base + dst_length);
 
-    /* Intermediate product is calculated by (Ibeta * sinVal) */
-    product2 = (q31_t) (((q63_t) (Ibeta) * (sinVal)) >> 31);
+    /* Loop over the blockSize */
+    i = blockSize;
 
+    while (i > 0U)
+    {
+      /* copy the sample from the circular buffer to the destination buffer */
+      *dst = circBuffer[rOffset];
 
-    /* Intermediate product is calculated by (Ialpha * sinVal) */
-    product3 = (q31_t) (((q63_t) (Ialpha) * (sinVal)) >> 31);
+      /* Update the input pointer */
+      dst += dstInc;
 
-    /* Intermediate product is calculated by (Ibeta * cosVal) */
-    product4 = (q31_t) (((q63_t) (Ibeta) * (cosVal)) >> 31);
+      if (dst == (int32_t *) dst_end)
+      {
+        dst = dst_base;
+      }
 
-    /* Calculate pId by adding the two intermediate products 1 and 2 */
-    *pId = __QADD(product1, product2);
+      /* Circularly update rOffset.  Watch out for positive and negative value  */
+      rOffset += bufferInc;
 
-    /* Calculate pIq by subtracting the two intermediate products 3 from 4 */
-    *pIq = __QSUB(product4, product3);
+      if (rOffset >= L)
+      {
+        rOffset -= L;
+      }
+
+      /* Decrement the loop counter */
+      i--;
+    }
+
+    /* Update the index pointer */
+    *readOffset = rOffset;
   }
 
-  /**
-   * @} end of park group
-   */
 
   /**
-   * @brief  Converts the elements of the Q7 vector to floating-point vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[out] pDst       is output pointer
-   * @param[in]  blockSize  is the number of samples to process
+   * @brief Q15 Circular write function.
    */
-  void arm_q7_to_float(
-  q7_t * pSrc,
-  float32_t * pDst,
-  uint32_t blockSize);
+  CMSIS_INLINE __STATIC_INLINE void arm_circularWrite_q15(
+  q15_t * circBuffer,
+  int32_t L,
+  uint16_t * writeOffset,
+  int32_t bufferInc,
+  const q15_t * src,
+  int32_t srcInc,
+  uint32_t blockSize)
+  {
+    uint32_t i = 0U;
+    int32_t wOffset;
 
+    /* Copy the value of Index pointer that points
+     * to the current location where the input samples to be copied */
+    wOffset = *writeOffset;
 
-  /**
-   * @ingroup groupController
-   */
+    /* Loop over the blockSize */
+    i = blockSize;
 
-  /**
-   * @defgroup inv_park Vector Inverse Park transform
-   * Inverse Park transform converts the input flux and torque components to two-coordinate vector.
-   *
-   * The function operates on a single sample of data and each call to the function returns the processed output.
-   * The library provides separate functions for Q31 and floating-point data types.
-   * \par Algorithm
-   * \image html parkInvFormula.gif
-   * where <code>pIalpha</code> and <code>pIbeta</code> are the stator vector components,
-   * <code>Id</code> and <code>Iq</code> are rotor vector components and <code>cosVal</code> and <code>sinVal</code> are the
-   * cosine and sine values of theta (rotor flux position).
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the Q31 version of the Park transform.
-   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
-   */
+    while (i > 0U)
+    {
+      /* copy the input sample to the circular buffer */
+      circBuffer[wOffset] = *src;
 
-  /**
-   * @addtogroup inv_park
-   * @{
-   */
+      /* Update the input pointer */
+      src += srcInc;
 
-   /**
-   * @brief  Floating-point Inverse Park transform
-   * @param[in]  Id       input coordinate of rotor reference frame d
-   * @param[in]  Iq       input coordinate of rotor reference frame q
-   * @param[out] pIalpha  points to output two-phase orthogonal vector axis alpha
-   * @param[out] pIbeta   points to output two-phase orthogonal vector axis beta
-   * @param[in]  sinVal   sine value of rotation angle theta
-   * @param[in]  cosVal   cosine value of rotation angle theta
-   */
-  CMSIS_INLINE __STATIC_INLINE void arm_inv_park_f32(
-  float32_t Id,
-  float32_t Iq,
-  float32_t * pIalpha,
-  float32_t * pIbeta,
-  float32_t sinVal,
-  float32_t cosVal)
-  {
-    /* Calculate pIalpha using the equation, pIalpha = Id * cosVal - Iq * sinVal */
-    *pIalpha = Id * cosVal - Iq * sinVal;
+      /* Circularly update wOffset.  Watch out for positive and negative value */
+      wOffset += bufferInc;
+      if (wOffset >= L)
+        wOffset -= L;
 
-    /* Calculate pIbeta using the equation, pIbeta = Id * sinVal + Iq * cosVal */
-    *pIbeta = Id * sinVal + Iq * cosVal;
+      /* Decrement the loop counter */
+      i--;
+    }
+
+    /* Update the index pointer */
+    *writeOffset = (uint16_t)wOffset;
   }
 
 
   /**
-   * @brief  Inverse Park transform for   Q31 version
-   * @param[in]  Id       input coordinate of rotor reference frame d
-   * @param[in]  Iq       input coordinate of rotor reference frame q
-   * @param[out] pIalpha  points to output two-phase orthogonal vector axis alpha
-   * @param[out] pIbeta   points to output two-phase orthogonal vector axis beta
-   * @param[in]  sinVal   sine value of rotation angle theta
-   * @param[in]  cosVal   cosine value of rotation angle theta
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 32-bit accumulator.
-   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
-   * There is saturation on the addition, hence there is no risk of overflow.
+   * @brief Q15 Circular Read function.
    */
-  CMSIS_INLINE __STATIC_INLINE void arm_inv_park_q31(
-  q31_t Id,
-  q31_t Iq,
-  q31_t * pIalpha,
-  q31_t * pIbeta,
-  q31_t sinVal,
-  q31_t cosVal)
+  CMSIS_INLINE __STATIC_INLINE void arm_circularRead_q15(
+  q15_t * circBuffer,
+  int32_t L,
+  int32_t * readOffset,
+  int32_t bufferInc,
+  q15_t * dst,
+  q15_t * dst_base,
+  int32_t dst_length,
+  int32_t dstInc,
+  uint32_t blockSize)
   {
-    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
-    q31_t product3, product4;                    /* Temporary variables used to store intermediate results */
-
-    /* Intermediate product is calculated by (Id * cosVal) */
-    product1 = (q31_t) (((q63_t) (Id) * (cosVal)) >> 31);
-
-    /* Intermediate product is calculated by (Iq * sinVal) */
-    product2 = (q31_t) (((q63_t) (Iq) * (sinVal)) >> 31);
+    uint32_t i = 0;
+    int32_t rOffset, dst_end;
 
+    /* Copy the value of Index pointer that points
+     * to the current location from where the input samples to be read */
+    rOffset = *readOffset;
 
-    /* Intermediate product is calculated by (Id * sinVal) */
-    product3 = (q31_t) (((q63_t) (Id) * (sinVal)) >> 31);
+    dst_end = (int32_t) (dst_base + dst_length);
 
-    /* Intermediate product is calculated by (Iq * cosVal) */
-    product4 = (q31_t) (((q63_t) (Iq) * (cosVal)) >> 31);
+    /* Loop over the blockSize */
+    i = blockSize;
 
-    /* Calculate pIalpha by using the two intermediate products 1 and 2 */
-    *pIalpha = __QSUB(product1, product2);
+    while (i > 0U)
+    {
+      /* copy the sample from the circular buffer to the destination buffer */
+      *dst = circBuffer[rOffset];
 
-    /* Calculate pIbeta by using the two intermediate products 3 and 4 */
-    *pIbeta = __QADD(product4, product3);
-  }
+      /* Update the input pointer */
+      dst += dstInc;
 
-  /**
-   * @} end of Inverse park group
-   */
+      if (dst == (q15_t *) dst_end)
+      {
+        dst = dst_base;
+      }
 
+      /* Circularly update wOffset.  Watch out for positive and negative value */
+      rOffset += bufferInc;
 
-  /**
-   * @brief  Converts the elements of the Q31 vector to floating-point vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[out] pDst       is output pointer
-   * @param[in]  blockSize  is the number of samples to process
-   */
-  void arm_q31_to_float(
-  q31_t * pSrc,
-  float32_t * pDst,
-  uint32_t blockSize);
+      if (rOffset >= L)
+      {
+        rOffset -= L;
+      }
 
-  /**
-   * @ingroup groupInterpolation
-   */
+      /* Decrement the loop counter */
+      i--;
+    }
 
-  /**
-   * @defgroup LinearInterpolate Linear Interpolation
-   *
-   * Linear interpolation is a method of curve fitting using linear polynomials.
-   * Linear interpolation works by effectively drawing a straight line between two neighboring samples and returning the appropriate point along that line
-   *
-   * \par
-   * \image html LinearInterp.gif "Linear interpolation"
-   *
-   * \par
-   * A  Linear Interpolate function calculates an output value(y), for the input(x)
-   * using linear interpolation of the input values x0, x1( nearest input values) and the output values y0 and y1(nearest output values)
-   *
-   * \par Algorithm:
-   * <pre>
-   *       y = y0 + (x - x0) * ((y1 - y0)/(x1-x0))
-   *       where x0, x1 are nearest values of input x
-   *             y0, y1 are nearest values to output y
-   * </pre>
-   *
-   * \par
-   * This set of functions implements Linear interpolation process
-   * for Q7, Q15, Q31, and floating-point data types.  The functions operate on a single
-   * sample of data and each call to the function returns a single processed value.
-   * <code>S</code> points to an instance of the Linear Interpolate function data structure.
-   * <code>x</code> is the input sample value. The functions returns the output value.
-   *
-   * \par
-   * if x is outside of the table boundary, Linear interpolation returns first value of the table
-   * if x is below input range and returns last value of table if x is above range.
-   */
+    /* Update the index pointer */
+    *readOffset = rOffset;
+  }
 
-  /**
-   * @addtogroup LinearInterpolate
-   * @{
-   */
 
   /**
-   * @brief  Process function for the floating-point Linear Interpolation Function.
-   * @param[in,out] S  is an instance of the floating-point Linear Interpolation structure
-   * @param[in]     x  input sample to process
-   * @return y processed output sample.
-   *
+   * @brief Q7 Circular write function.
    */
-  CMSIS_INLINE __STATIC_INLINE float32_t arm_linear_interp_f32(
-  arm_linear_interp_instance_f32 * S,
-  float32_t x)
+  CMSIS_INLINE __STATIC_INLINE void arm_circularWrite_q7(
+  q7_t * circBuffer,
+  int32_t L,
+  uint16_t * writeOffset,
+  int32_t bufferInc,
+  const q7_t * src,
+  int32_t srcInc,
+  uint32_t blockSize)
   {
-    float32_t y;
-    float32_t x0, x1;                            /* Nearest input values */
-    float32_t y0, y1;                            /* Nearest output values */
-    float32_t xSpacing = S->xSpacing;            /* spacing between input values */
-    int32_t i;                                   /* Index variable */
-    float32_t *pYData = S->pYData;               /* pointer to output table */
+    uint32_t i = 0U;
+    int32_t wOffset;
 
-    /* Calculation of index */
-    i = (int32_t) ((x - S->x1) / xSpacing);
+    /* Copy the value of Index pointer that points
+     * to the current location where the input samples to be copied */
+    wOffset = *writeOffset;
 
-    if (i < 0)
-    {
-      /* Iniatilize output for below specified range as least output value of table */
-      y = pYData[0];
-    }
-    else if ((uint32_t)i >= S->nValues)
-    {
-      /* Iniatilize output for above specified range as last output value of table */
-      y = pYData[S->nValues - 1];
-    }
-    else
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while (i > 0U)
     {
-      /* Calculation of nearest input values */
-      x0 = S->x1 +  i      * xSpacing;
-      x1 = S->x1 + (i + 1) * xSpacing;
+      /* copy the input sample to the circular buffer */
+      circBuffer[wOffset] = *src;
 
-      /* Read of nearest output values */
-      y0 = pYData[i];
-      y1 = pYData[i + 1];
+      /* Update the input pointer */
+      src += srcInc;
 
-      /* Calculation of output */
-      y = y0 + (x - x0) * ((y1 - y0) / (x1 - x0));
+      /* Circularly update wOffset.  Watch out for positive and negative value */
+      wOffset += bufferInc;
+      if (wOffset >= L)
+        wOffset -= L;
 
+      /* Decrement the loop counter */
+      i--;
     }
 
-    /* returns output value */
-    return (y);
+    /* Update the index pointer */
+    *writeOffset = (uint16_t)wOffset;
   }
 
 
-   /**
-   *
-   * @brief  Process function for the Q31 Linear Interpolation Function.
-   * @param[in] pYData   pointer to Q31 Linear Interpolation table
-   * @param[in] x        input sample to process
-   * @param[in] nValues  number of table values
-   * @return y processed output sample.
-   *
-   * \par
-   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
-   * This function can support maximum of table size 2^12.
-   *
+  /**
+   * @brief Q7 Circular Read function.
    */
-  CMSIS_INLINE __STATIC_INLINE q31_t arm_linear_interp_q31(
-  q31_t * pYData,
-  q31_t x,
-  uint32_t nValues)
+  CMSIS_INLINE __STATIC_INLINE void arm_circularRead_q7(
+  q7_t * circBuffer,
+  int32_t L,
+  int32_t * readOffset,
+  int32_t bufferInc,
+  q7_t * dst,
+  q7_t * dst_base,
+  int32_t dst_length,
+  int32_t dstInc,
+  uint32_t blockSize)
   {
-    q31_t y;                                     /* output */
-    q31_t y0, y1;                                /* Nearest output values */
-    q31_t fract;                                 /* fractional part */
-    int32_t index;                               /* Index to read nearest output values */
+    uint32_t i = 0;
+    int32_t rOffset, dst_end;
 
-    /* Input is in 12.20 format */
-    /* 12 bits for the table index */
-    /* Index value calculation */
-    index = ((x & (q31_t)0xFFF00000) >> 20);
+    /* Copy the value of Index pointer that points
+     * to the current location from where the input samples to be read */
+    rOffset = *readOffset;
 
-    if (index >= (int32_t)(nValues - 1))
-    {
-      return (pYData[nValues - 1]);
-    }
-    else if (index < 0)
-    {
-      return (pYData[0]);
-    }
-    else
+    dst_end = (int32_t) (dst_base + dst_length);
+
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while (i > 0U)
     {
-      /* 20 bits for the fractional part */
-      /* shift left by 11 to keep fract in 1.31 format */
-      fract = (x & 0x000FFFFF) << 11;
+      /* copy the sample from the circular buffer to the destination buffer */
+      *dst = circBuffer[rOffset];
 
-      /* Read two nearest output values from the index in 1.31(q31) format */
-      y0 = pYData[index];
-      y1 = pYData[index + 1];
+      /* Update the input pointer */
+      dst += dstInc;
 
-      /* Calculation of y0 * (1-fract) and y is in 2.30 format */
-      y = ((q31_t) ((q63_t) y0 * (0x7FFFFFFF - fract) >> 32));
+      if (dst == (q7_t *) dst_end)
+      {
+        dst = dst_base;
+      }
 
-      /* Calculation of y0 * (1-fract) + y1 *fract and y is in 2.30 format */
-      y += ((q31_t) (((q63_t) y1 * fract) >> 32));
+      /* Circularly update rOffset.  Watch out for positive and negative value */
+      rOffset += bufferInc;
 
-      /* Convert y to 1.31 format */
-      return (y << 1U);
+      if (rOffset >= L)
+      {
+        rOffset -= L;
+      }
+
+      /* Decrement the loop counter */
+      i--;
     }
+
+    /* Update the index pointer */
+    *readOffset = rOffset;
   }
 
 
   /**
-   *
-   * @brief  Process function for the Q15 Linear Interpolation Function.
-   * @param[in] pYData   pointer to Q15 Linear Interpolation table
-   * @param[in] x        input sample to process
-   * @param[in] nValues  number of table values
-   * @return y processed output sample.
-   *
-   * \par
-   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
-   * This function can support maximum of table size 2^12.
-   *
+   * @brief  Sum of the squares of the elements of a Q31 vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
    */
-  CMSIS_INLINE __STATIC_INLINE q15_t arm_linear_interp_q15(
-  q15_t * pYData,
-  q31_t x,
-  uint32_t nValues)
-  {
-    q63_t y;                                     /* output */
-    q15_t y0, y1;                                /* Nearest output values */
-    q31_t fract;                                 /* fractional part */
-    int32_t index;                               /* Index to read nearest output values */
+  void arm_power_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q63_t * pResult);
 
-    /* Input is in 12.20 format */
-    /* 12 bits for the table index */
-    /* Index value calculation */
-    index = ((x & (int32_t)0xFFF00000) >> 20);
 
-    if (index >= (int32_t)(nValues - 1))
-    {
-      return (pYData[nValues - 1]);
-    }
-    else if (index < 0)
-    {
-      return (pYData[0]);
-    }
-    else
-    {
-      /* 20 bits for the fractional part */
-      /* fract is in 12.20 format */
-      fract = (x & 0x000FFFFF);
+  /**
+   * @brief  Sum of the squares of the elements of a floating-point vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
+   */
+  void arm_power_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult);
 
-      /* Read two nearest output values from the index */
-      y0 = pYData[index];
-      y1 = pYData[index + 1];
 
-      /* Calculation of y0 * (1-fract) and y is in 13.35 format */
-      y = ((q63_t) y0 * (0xFFFFF - fract));
+  /**
+   * @brief  Sum of the squares of the elements of a Q15 vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
+   */
+  void arm_power_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q63_t * pResult);
 
-      /* Calculation of (y0 * (1-fract) + y1 * fract) and y is in 13.35 format */
-      y += ((q63_t) y1 * (fract));
 
-      /* convert y to 1.15 format */
-      return (q15_t) (y >> 20);
-    }
-  }
+  /**
+   * @brief  Sum of the squares of the elements of a Q7 vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
+   */
+  void arm_power_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pResult);
 
 
   /**
-   *
-   * @brief  Process function for the Q7 Linear Interpolation Function.
-   * @param[in] pYData   pointer to Q7 Linear Interpolation table
-   * @param[in] x        input sample to process
-   * @param[in] nValues  number of table values
-   * @return y processed output sample.
-   *
-   * \par
-   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
-   * This function can support maximum of table size 2^12.
+   * @brief  Mean value of a Q7 vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
    */
-  CMSIS_INLINE __STATIC_INLINE q7_t arm_linear_interp_q7(
-  q7_t * pYData,
-  q31_t x,
-  uint32_t nValues)
-  {
-    q31_t y;                                     /* output */
-    q7_t y0, y1;                                 /* Nearest output values */
-    q31_t fract;                                 /* fractional part */
-    uint32_t index;                              /* Index to read nearest output values */
+  void arm_mean_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  q7_t * pResult);
 
-    /* Input is in 12.20 format */
-    /* 12 bits for the table index */
-    /* Index value calculation */
-    if (x < 0)
-    {
-      return (pYData[0]);
-    }
-    index = (x >> 20) & 0xfff;
 
-    if (index >= (nValues - 1))
-    {
-      return (pYData[nValues - 1]);
-    }
-    else
-    {
-      /* 20 bits for the fractional part */
-      /* fract is in 12.20 format */
-      fract = (x & 0x000FFFFF);
+  /**
+   * @brief  Mean value of a Q15 vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
+   */
+  void arm_mean_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult);
 
-      /* Read two nearest output values from the index and are in 1.7(q7) format */
-      y0 = pYData[index];
-      y1 = pYData[index + 1];
 
-      /* Calculation of y0 * (1-fract ) and y is in 13.27(q27) format */
-      y = ((y0 * (0xFFFFF - fract)));
+  /**
+   * @brief  Mean value of a Q31 vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
+   */
+  void arm_mean_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pResult);
 
-      /* Calculation of y1 * fract + y0 * (1-fract) and y is in 13.27(q27) format */
-      y += (y1 * fract);
 
-      /* convert y to 1.7(q7) format */
-      return (q7_t) (y >> 20);
-     }
-  }
+  /**
+   * @brief  Mean value of a floating-point vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
+   */
+  void arm_mean_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult);
+
 
   /**
-   * @} end of LinearInterpolate group
+   * @brief  Variance of the elements of a floating-point vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
    */
+  void arm_var_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult);
+
 
   /**
-   * @brief  Fast approximation to the trigonometric sine function for floating-point data.
-   * @param[in] x  input value in radians.
-   * @return  sin(x).
+   * @brief  Variance of the elements of a Q31 vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
    */
-  float32_t arm_sin_f32(
-  float32_t x);
+  void arm_var_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pResult);
 
 
   /**
-   * @brief  Fast approximation to the trigonometric sine function for Q31 data.
-   * @param[in] x  Scaled input value in radians.
-   * @return  sin(x).
+   * @brief  Variance of the elements of a Q15 vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
    */
-  q31_t arm_sin_q31(
-  q31_t x);
+  void arm_var_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult);
+
+
+  /**
+   * @brief  Root Mean Square of the elements of a floating-point vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
+   */
+  void arm_rms_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult);
 
 
   /**
-   * @brief  Fast approximation to the trigonometric sine function for Q15 data.
-   * @param[in] x  Scaled input value in radians.
-   * @return  sin(x).
+   * @brief  Root Mean Square of the elements of a Q31 vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
    */
-  q15_t arm_sin_q15(
-  q15_t x);
+  void arm_rms_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pResult);
 
 
   /**
-   * @brief  Fast approximation to the trigonometric cosine function for floating-point data.
-   * @param[in] x  input value in radians.
-   * @return  cos(x).
+   * @brief  Root Mean Square of the elements of a Q15 vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
    */
-  float32_t arm_cos_f32(
-  float32_t x);
+  void arm_rms_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult);
 
 
   /**
-   * @brief Fast approximation to the trigonometric cosine function for Q31 data.
-   * @param[in] x  Scaled input value in radians.
-   * @return  cos(x).
+   * @brief  Standard deviation of the elements of a floating-point vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
    */
-  q31_t arm_cos_q31(
-  q31_t x);
+  void arm_std_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult);
 
 
   /**
-   * @brief  Fast approximation to the trigonometric cosine function for Q15 data.
-   * @param[in] x  Scaled input value in radians.
-   * @return  cos(x).
+   * @brief  Standard deviation of the elements of a Q31 vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
    */
-  q15_t arm_cos_q15(
-  q15_t x);
+  void arm_std_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pResult);
 
 
   /**
-   * @ingroup groupFastMath
+   * @brief  Standard deviation of the elements of a Q15 vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
    */
+  void arm_std_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult);
 
 
   /**
-   * @defgroup SQRT Square Root
-   *
-   * Computes the square root of a number.
-   * There are separate functions for Q15, Q31, and floating-point data types.
-   * The square root function is computed using the Newton-Raphson algorithm.
-   * This is an iterative algorithm of the form:
-   * <pre>
-   *      x1 = x0 - f(x0)/f'(x0)
-   * </pre>
-   * where <code>x1</code> is the current estimate,
-   * <code>x0</code> is the previous estimate, and
-   * <code>f'(x0)</code> is the derivative of <code>f()</code> evaluated at <code>x0</code>.
-   * For the square root function, the algorithm reduces to:
-   * <pre>
-   *     x0 = in/2                         [initial guess]
-   *     x1 = 1/2 * ( x0 + in / x0)        [each iteration]
-   * </pre>
+   * @brief Flags selecting the statistics computed by the single pass statistics functions.
    */
-
+  typedef enum
+  {
+    ARM_STATS_MEAN  = 0x01,              /**< Mean */
+    ARM_STATS_VAR   = 0x02,              /**< Variance */
+    ARM_STATS_STD   = 0x04,              /**< Standard deviation */
+    ARM_STATS_RMS   = 0x08,              /**< Root mean square */
+    ARM_STATS_POWER = 0x10,              /**< Sum of the squares */
+    ARM_STATS_MIN   = 0x20,              /**< Minimum value and its index */
+    ARM_STATS_MAX   = 0x40,              /**< Maximum value and its index */
+    ARM_STATS_ALL   = 0x7F               /**< All of the above */
+  } arm_stats_flags;
 
   /**
-   * @addtogroup SQRT
-   * @{
+   * @brief Results of the floating-point single pass statistics function.
    */
+  typedef struct
+  {
+    float32_t mean;                      /**< mean value. */
+    float32_t var;                       /**< variance. */
+    float32_t std;                       /**< standard deviation. */
+    float32_t rms;                       /**< root mean square. */
+    float32_t power;                     /**< sum of the squares. */
+    float32_t min;                       /**< minimum value. */
+    float32_t max;                       /**< maximum value. */
+    uint32_t minIndex;                   /**< index of the minimum value. */
+    uint32_t maxIndex;                   /**< index of the maximum value. */
+  } arm_stats_result_f32;
 
   /**
-   * @brief  Floating-point square root function.
-   * @param[in]  in    input value.
-   * @param[out] pOut  square root of input value.
-   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
-   * <code>in</code> is negative value and returns zero output for negative values.
+   * @brief Results of the Q31 single pass statistics function.
    */
-  CMSIS_INLINE __STATIC_INLINE arm_status arm_sqrt_f32(
-  float32_t in,
-  float32_t * pOut)
+  typedef struct
   {
-    if (in >= 0.0f)
-    {
+    q31_t mean;                          /**< mean value in 1.31 format. */
+    q31_t var;                           /**< variance in 1.31 format. */
+    q31_t std;                           /**< standard deviation in 1.31 format. */
+    q31_t rms;                           /**< root mean square in 1.31 format. */
+    q63_t power;                         /**< sum of the squares in 16.48 format. */
+    q31_t min;                           /**< minimum value. */
+    q31_t max;                           /**< maximum value. */
+    uint32_t minIndex;                   /**< index of the minimum value. */
+    uint32_t maxIndex;                   /**< index of the maximum value. */
+  } arm_stats_result_q31;
 
-#if   (__FPU_USED == 1) && defined ( __CC_ARM   )
-      *pOut = __sqrtf(in);
-#elif (__FPU_USED == 1) && (defined(__ARMCC_VERSION) && (__ARMCC_VERSION >= 6010050))
-      *pOut = __builtin_sqrtf(in);
-#elif (__FPU_USED == 1) && defined(__GNUC__)
-      *pOut = __builtin_sqrtf(in);
-#elif (__FPU_USED == 1) && defined ( __ICCARM__ ) && (__VER__ >= 6040000)
-      __ASM("VSQRT.F32 %0,%1" : "=t"(*pOut) : "t"(in));
-#else
-      *pOut = sqrtf(in);
-#endif
+  /**
+   * @brief Results of the Q15 single pass statistics function.
+   */
+  typedef struct
+  {
+    q15_t mean;                          /**< mean value in 1.15 format. */
+    q15_t var;                           /**< variance in 1.15 format. */
+    q15_t std;                           /**< standard deviation in 1.15 format. */
+    q15_t rms;                           /**< root mean square in 1.15 format. */
+    q63_t power;                         /**< sum of the squares in 34.30 format. */
+    q15_t min;                           /**< minimum value. */
+    q15_t max;                           /**< maximum value. */
+    uint32_t minIndex;                   /**< index of the minimum value. */
+    uint32_t maxIndex;                   /**< index of the maximum value. */
+  } arm_stats_result_q15;
 
-      return (ARM_MATH_SUCCESS);
-    }
-    else
-    {
-      *pOut = 0.0f;
-      return (ARM_MATH_ARGUMENT_ERROR);
-    }
-  }
+  /**
+   * @brief Results of the Q7 single pass statistics function.
+   */
+  typedef struct
+  {
+    q7_t mean;                           /**< mean value in 1.7 format. */
+    q7_t var;                            /**< variance in 1.7 format. */
+    q7_t std;                            /**< standard deviation in 1.7 format. */
+    q7_t rms;                            /**< root mean square in 1.7 format. */
+    q31_t power;                         /**< sum of the squares in 18.14 format. */
+    q7_t min;                            /**< minimum value. */
+    q7_t max;                            /**< maximum value. */
+    uint32_t minIndex;                   /**< index of the minimum value. */
+    uint32_t maxIndex;                   /**< index of the maximum value. */
+  } arm_stats_result_q7;
+
+
+  /**
+   * @brief  Single pass statistics of the elements of a floating-point vector.
+   * @param[in]  pSrc        is input pointer
+   * @param[in]  blockSize   is the number of samples to process
+   * @param[in]  statsFlags  selects the statistics to compute, a combination of ::arm_stats_flags
+   * @param[out] pResult     points to the structure receiving the requested statistics
+   */
+  void arm_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t statsFlags,
+  arm_stats_result_f32 * pResult);
 
 
   /**
-   * @brief Q31 square root function.
-   * @param[in]  in    input value.  The range of the input value is [0 +1) or 0x00000000 to 0x7FFFFFFF.
-   * @param[out] pOut  square root of input value.
-   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
-   * <code>in</code> is negative value and returns zero output for negative values.
+   * @brief  Single pass statistics of the elements of a Q31 vector.
+   * @param[in]  pSrc        is input pointer
+   * @param[in]  blockSize   is the number of samples to process
+   * @param[in]  statsFlags  selects the statistics to compute, a combination of ::arm_stats_flags
+   * @param[out] pResult     points to the structure receiving the requested statistics
    */
-  arm_status arm_sqrt_q31(
-  q31_t in,
-  q31_t * pOut);
+  void arm_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t statsFlags,
+  arm_stats_result_q31 * pResult);
 
 
   /**
-   * @brief  Q15 square root function.
-   * @param[in]  in    input value.  The range of the input value is [0 +1) or 0x0000 to 0x7FFF.
-   * @param[out] pOut  square root of input value.
-   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
-   * <code>in</code> is negative value and returns zero output for negative values.
+   * @brief  Single pass statistics of the elements of a Q15 vector.
+   * @param[in]  pSrc        is input pointer
+   * @param[in]  blockSize   is the number of samples to process
+   * @param[in]  statsFlags  selects the statistics to compute, a combination of ::arm_stats_flags
+   * @param[out] pResult     points to the structure receiving the requested statistics
    */
-  arm_status arm_sqrt_q15(
-  q15_t in,
-  q15_t * pOut);
+  void arm_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t statsFlags,
+  arm_stats_result_q15 * pResult);
+
 
   /**
-   * @} end of SQRT group
+   * @brief  Single pass statistics of the elements of a Q7 vector.
+   * @param[in]  pSrc        is input pointer
+   * @param[in]  blockSize   is the number of samples to process
+   * @param[in]  statsFlags  selects the statistics to compute, a combination of ::arm_stats_flags
+   * @param[out] pResult     points to the structure receiving the requested statistics
    */
-
+  void arm_stats_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  uint32_t statsFlags,
+  arm_stats_result_q7 * pResult);
 
   /**
-   * @brief floating-point Circular write function.
+   * @brief Instance structure for the floating-point streaming statistics accumulator.
    */
-  CMSIS_INLINE __STATIC_INLINE void arm_circularWrite_f32(
-  int32_t * circBuffer,
-  int32_t L,
-  uint16_t * writeOffset,
-  int32_t bufferInc,
-  const int32_t * src,
-  int32_t srcInc,
-  uint32_t blockSize)
+  typedef struct
   {
-    uint32_t i = 0U;
-    int32_t wOffset;
-
-    /* Copy the value of Index pointer that points
-     * to the current location where the input samples to be copied */
-    wOffset = *writeOffset;
-
-    /* Loop over the blockSize */
-    i = blockSize;
-
-    while (i > 0U)
-    {
-      /* copy the input sample to the circular buffer */
-      circBuffer[wOffset] = *src;
-
-      /* Update the input pointer */
-      src += srcInc;
-
-      /* Circularly update wOffset.  Watch out for positive and negative value */
-      wOffset += bufferInc;
-      if (wOffset >= L)
-        wOffset -= L;
-
-      /* Decrement the loop counter */
-      i--;
-    }
-
-    /* Update the index pointer */
-    *writeOffset = (uint16_t)wOffset;
-  }
-
-
+    uint32_t count;                      /**< number of samples accumulated. */
+    float32_t mean;                      /**< running mean. */
+    float32_t m2;                        /**< running sum of the squared deviations from the mean. */
+    float32_t min;                       /**< running minimum value. */
+    float32_t max;                       /**< running maximum value. */
+    uint32_t minIndex;                   /**< index of the minimum value. */
+    uint32_t maxIndex;                   /**< index of the maximum value. */
+  } arm_stats_acc_instance_f32;
 
   /**
-   * @brief floating-point Circular Read function.
+   * @brief Instance structure for the Q31 streaming statistics accumulator.
    */
-  CMSIS_INLINE __STATIC_INLINE void arm_circularRead_f32(
-  int32_t * circBuffer,
-  int32_t L,
-  int32_t * readOffset,
-  int32_t bufferInc,
-  int32_t * dst,
-  int32_t * dst_base,
-  int32_t dst_length,
-  int32_t dstInc,
-  uint32_t blockSize)
+  typedef struct
   {
-    uint32_t i = 0U;
-    int32_t rOffset, dst_end;
-
-    /* Copy the value of Index pointer that points
-     * to the current location from where the input samples to be read */
-    rOffset = *readOffset;
-    dst_end = (int32_t) (dst_base + dst_length);
-
-    /* Loop over the blockSize */
-    i = blockSize;
-
-    while (i > 0U)
-    {
-      /* copy the sample from the circular buffer to the destination buffer */
-      *dst = circBuffer[rOffset];
-
-      /* Update the input pointer */
-      dst += dstInc;
-
-      if (dst == (int32_t *) dst_end)
-      {
-        dst = dst_base;
-      }
-
-      /* Circularly update rOffset.  Watch out for positive and negative value  */
-      rOffset += bufferInc;
-
-      if (rOffset >= L)
-      {
-        rOffset -= L;
-      }
-
-      /* Decrement the loop counter */
-      i--;
-    }
-
-    /* Update the index pointer */
-    *readOffset = rOffset;
-  }
-
+    uint32_t count;                      /**< number of samples accumulated. */
+    q63_t mean;                          /**< running mean in 1.63 format. */
+    q63_t var;                           /**< running population variance in 2.62 format. */
+    q31_t min;                           /**< running minimum value. */
+    q31_t max;                           /**< running maximum value. */
+    uint32_t minIndex;                   /**< index of the minimum value. */
+    uint32_t maxIndex;                   /**< index of the maximum value. */
+  } arm_stats_acc_instance_q31;
 
   /**
-   * @brief Q15 Circular write function.
+   * @brief Instance structure for the Q15 streaming statistics accumulator.
    */
-  CMSIS_INLINE __STATIC_INLINE void arm_circularWrite_q15(
-  q15_t * circBuffer,
-  int32_t L,
-  uint16_t * writeOffset,
-  int32_t bufferInc,
-  const q15_t * src,
-  int32_t srcInc,
-  uint32_t blockSize)
+  typedef struct
+  {
+    uint32_t count;                      /**< number of samples accumulated. */
+    q63_t mean;                          /**< running mean in 1.63 format. */
+    q63_t var;                           /**< running population variance in 2.62 format. */
+    q15_t min;                           /**< running minimum value. */
+    q15_t max;                           /**< running maximum value. */
+    uint32_t minIndex;                   /**< index of the minimum value. */
+    uint32_t maxIndex;                   /**< index of the maximum value. */
+  } arm_stats_acc_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q7 streaming statistics accumulator.
+   */
+  typedef struct
   {
-    uint32_t i = 0U;
-    int32_t wOffset;
+    uint32_t count;                      /**< number of samples accumulated. */
+    q63_t mean;                          /**< running mean in 1.63 format. */
+    q63_t var;                           /**< running population variance in 2.62 format. */
+    q7_t min;                            /**< running minimum value. */
+    q7_t max;                            /**< running maximum value. */
+    uint32_t minIndex;                   /**< index of the minimum value. */
+    uint32_t maxIndex;                   /**< index of the maximum value. */
+  } arm_stats_acc_instance_q7;
 
-    /* Copy the value of Index pointer that points
-     * to the current location where the input samples to be copied */
-    wOffset = *writeOffset;
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  /**
+   * @brief  Initialization function for the floating-point streaming statistics accumulator.
+   * @param[out] S  points to an instance of the floating-point streaming statistics accumulator.
+   */
+  void arm_stats_acc_init_f32(
+  arm_stats_acc_instance_f32 * S);
 
-    while (i > 0U)
-    {
-      /* copy the input sample to the circular buffer */
-      circBuffer[wOffset] = *src;
 
-      /* Update the input pointer */
-      src += srcInc;
+  /**
+   * @brief  Accumulates a block of floating-point samples into the streaming statistics.
+   * @param[in,out] S          points to an instance of the floating-point streaming statistics accumulator.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_stats_acc_update_f32(
+  arm_stats_acc_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize);
 
-      /* Circularly update wOffset.  Watch out for positive and negative value */
-      wOffset += bufferInc;
-      if (wOffset >= L)
-        wOffset -= L;
 
-      /* Decrement the loop counter */
-      i--;
-    }
+  /**
+   * @brief  Merges two floating-point streaming statistics accumulators.
+   * @param[in,out] S   points to the accumulator receiving the merged statistics.
+   * @param[in]     S2  points to the accumulator of the samples following the ones of S.
+   */
+  void arm_stats_acc_merge_f32(
+  arm_stats_acc_instance_f32 * S,
+  const arm_stats_acc_instance_f32 * S2);
 
-    /* Update the index pointer */
-    *writeOffset = (uint16_t)wOffset;
-  }
 
+  /**
+   * @brief  Returns the statistics of an floating-point streaming statistics accumulator.
+   * @param[in]  S           points to an instance of the floating-point streaming statistics accumulator.
+   * @param[in]  statsFlags  selects the statistics to compute, a combination of ::arm_stats_flags
+   * @param[out] pResult     points to the structure receiving the requested statistics
+   */
+  void arm_stats_acc_result_f32(
+  const arm_stats_acc_instance_f32 * S,
+  uint32_t statsFlags,
+  arm_stats_result_f32 * pResult);
 
   /**
-   * @brief Q15 Circular Read function.
+   * @brief  Initialization function for the Q31 streaming statistics accumulator.
+   * @param[out] S  points to an instance of the Q31 streaming statistics accumulator.
    */
-  CMSIS_INLINE __STATIC_INLINE void arm_circularRead_q15(
-  q15_t * circBuffer,
-  int32_t L,
-  int32_t * readOffset,
-  int32_t bufferInc,
-  q15_t * dst,
-  q15_t * dst_base,
-  int32_t dst_length,
-  int32_t dstInc,
-  uint32_t blockSize)
-  {
-    uint32_t i = 0;
-    int32_t rOffset, dst_end;
+  void arm_stats_acc_init_q31(
+  arm_stats_acc_instance_q31 * S);
 
-    /* Copy the value of Index pointer that points
-     * to the current location from where the input samples to be read */
-    rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+  /**
+   * @brief  Accumulates a block of Q31 samples into the streaming statistics.
+   * @param[in,out] S          points to an instance of the Q31 streaming statistics accumulator.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_stats_acc_update_q31(
+  arm_stats_acc_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize);
 
-    /* Loop over the blockSize */
-    i = blockSize;
 
-    while (i > 0U)
-    {
-      /* copy the sample from the circular buffer to the destination buffer */
-      *dst = circBuffer[rOffset];
+  /**
+   * @brief  Merges two Q31 streaming statistics accumulators.
+   * @param[in,out] S   points to the accumulator receiving the merged statistics.
+   * @param[in]     S2  points to the accumulator of the samples following the ones of S.
+   */
+  void arm_stats_acc_merge_q31(
+  arm_stats_acc_instance_q31 * S,
+  const arm_stats_acc_instance_q31 * S2);
 
-      /* Update the input pointer */
-      dst += dstInc;
 
-      if (dst == (q15_t *) dst_end)
-      {
-        dst = dst_base;
-      }
+  /**
+   * @brief  Returns the statistics of a Q31 streaming statistics accumulator.
+   * @param[in]  S           points to an instance of the Q31 streaming statistics accumulator.
+   * @param[in]  statsFlags  selects the statistics to compute, a combination of ::arm_stats_flags
+   * @param[out] pResult     points to the structure receiving the requested statistics
+   */
+  void arm_stats_acc_result_q31(
+  const arm_stats_acc_instance_q31 * S,
+  uint32_t statsFlags,
+  arm_stats_result_q31 * pResult);
 
-      /* Circularly update wOffset.  Watch out for positive and negative value */
-      rOffset += bufferInc;
+  /**
+   * @brief  Initialization function for the Q15 streaming statistics accumulator.
+   * @param[out] S  points to an instance of the Q15 streaming statistics accumulator.
+   */
+  void arm_stats_acc_init_q15(
+  arm_stats_acc_instance_q15 * S);
 
-      if (rOffset >= L)
-      {
-        rOffset -= L;
-      }
 
-      /* Decrement the loop counter */
-      i--;
-    }
+  /**
+   * @brief  Accumulates a block of Q15 samples into the streaming statistics.
+   * @param[in,out] S          points to an instance of the Q15 streaming statistics accumulator.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_stats_acc_update_q15(
+  arm_stats_acc_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize);
 
-    /* Update the index pointer */
-    *readOffset = rOffset;
-  }
+
+  /**
+   * @brief  Merges two Q15 streaming statistics accumulators.
+   * @param[in,out] S   points to the accumulator receiving the merged statistics.
+   * @param[in]     S2  points to the accumulator of the samples following the ones of S.
+   */
+  void arm_stats_acc_merge_q15(
+  arm_stats_acc_instance_q15 * S,
+  const arm_stats_acc_instance_q15 * S2);
 
 
   /**
-   * @brief Q7 Circular write function.
+   * @brief  Returns the statistics of a Q15 streaming statistics accumulator.
+   * @param[in]  S           points to an instance of the Q15 streaming statistics accumulator.
+   * @param[in]  statsFlags  selects the statistics to compute, a combination of ::arm_stats_flags
+   * @param[out] pResult     points to the structure receiving the requested statistics
    */
-  CMSIS_INLINE __STATIC_INLINE void arm_circularWrite_q7(
-  q7_t * circBuffer,
-  int32_t L,
-  uint16_t * writeOffset,
-  int32_t bufferInc,
-  const q7_t * src,
-  int32_t srcInc,
-  uint32_t blockSize)
-  {
-    uint32_t i = 0U;
-    int32_t wOffset;
+  void arm_stats_acc_result_q15(
+  const arm_stats_acc_instance_q15 * S,
+  uint32_t statsFlags,
+  arm_stats_result_q15 * pResult);
 
-    /* Copy the value of Index pointer that points
-     * to the current location where the input samples to be copied */
-    wOffset = *writeOffset;
+  /**
+   * @brief  Initialization function for the Q7 streaming statistics accumulator.
+   * @param[out] S  points to an instance of the Q7 streaming statistics accumulator.
+   */
+  void arm_stats_acc_init_q7(
+  arm_stats_acc_instance_q7 * S);
 
-    /* Loop over the blockSize */
-    i = blockSize;
 
-    while (i > 0U)
-    {
-      /* copy the input sample to the circular buffer */
-      circBuffer[wOffset] = *src;
+  /**
+   * @brief  Accumulates a block of Q7 samples into the streaming statistics.
+   * @param[in,out] S          points to an instance of the Q7 streaming statistics accumulator.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_stats_acc_update_q7(
+  arm_stats_acc_instance_q7 * S,
+  q7_t * pSrc,
+  uint32_t blockSize);
 
-      /* Update the input pointer */
-      src += srcInc;
 
-      /* Circularly update wOffset.  Watch out for positive and negative value */
-      wOffset += bufferInc;
-      if (wOffset >= L)
-        wOffset -= L;
+  /**
+   * @brief  Merges two Q7 streaming statistics accumulators.
+   * @param[in,out] S   points to the accumulator receiving the merged statistics.
+   * @param[in]     S2  points to the accumulator of the samples following the ones of S.
+   */
+  void arm_stats_acc_merge_q7(
+  arm_stats_acc_instance_q7 * S,
+  const arm_stats_acc_instance_q7 * S2);
 
-      /* Decrement the loop counter */
-      i--;
-    }
 
-    /* Update the index pointer */
-    *writeOffset = (uint16_t)wOffset;
-  }
+  /**
+   * @brief  Returns the statistics of a Q7 streaming statistics accumulator.
+   * @param[in]  S           points to an instance of the Q7 streaming statistics accumulator.
+   * @param[in]  statsFlags  selects the statistics to compute, a combination of ::arm_stats_flags
+   * @param[out] pResult     points to the structure receiving the requested statistics
+   */
+  void arm_stats_acc_result_q7(
+  const arm_stats_acc_instance_q7 * S,
+  uint32_t statsFlags,
+  arm_stats_result_q7 * pResult);
 
 
   /**
-   * @brief Q7 Circular Read function.
+   * @brief Level detectors of the envelope trackers.
    */
-  CMSIS_INLINE __STATIC_INLINE void arm_circularRead_q7(
-  q7_t * circBuffer,
-  int32_t L,
-  int32_t * readOffset,
-  int32_t bufferInc,
-  q7_t * dst,
-  q7_t * dst_base,
-  int32_t dst_length,
-  int32_t dstInc,
-  uint32_t blockSize)
+  typedef enum
   {
-    uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    ARM_ENVELOPE_PEAK = 0,               /**< tracks the absolute value of the input */
+    ARM_ENVELOPE_RMS = 1                 /**< tracks the square of the input, the envelope is the mean square */
+  } arm_envelope_detector;
 
-    /* Copy the value of Index pointer that points
-     * to the current location from where the input samples to be read */
-    rOffset = *readOffset;
-
-    dst_end = (int32_t) (dst_base + dst_length);
+  /**
+   * @brief Instance structure for the floating-point envelope tracker.
+   */
+  typedef struct
+  {
+    arm_envelope_detector detector;      /**< level detector. */
+    float32_t attack;                    /**< smoothing coefficient when the level rises, in (0 1]. */
+    float32_t release;                   /**< smoothing coefficient when the level falls, in (0 1]. */
+    uint32_t holdSamples;                /**< number of samples the envelope is held after a rise. */
+    uint32_t holdCount;                  /**< number of samples left to hold. */
+    float32_t state;                     /**< current envelope. */
+  } arm_envelope_instance_f32;
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  /**
+   * @brief Instance structure for the Q31 envelope tracker.
+   */
+  typedef struct
+  {
+    arm_envelope_detector detector;      /**< level detector. */
+    q31_t attack;                        /**< smoothing coefficient when the level rises, in 1.31 format. */
+    q31_t release;                       /**< smoothing coefficient when the level falls, in 1.31 format. */
+    uint32_t holdSamples;                /**< number of samples the envelope is held after a rise. */
+    uint32_t holdCount;                  /**< number of samples left to hold. */
+    q31_t state;                         /**< current envelope. */
+  } arm_envelope_instance_q31;
 
-    while (i > 0U)
-    {
-      /* copy the sample from the circular buffer to the destination buffer */
-      *dst = circBuffer[rOffset];
+  /**
+   * @brief Instance structure for the Q15 envelope tracker.
+   */
+  typedef struct
+  {
+    arm_envelope_detector detector;      /**< level detector. */
+    q15_t attack;                        /**< smoothing coefficient when the level rises, in 1.15 format. */
+    q15_t release;                       /**< smoothing coefficient when the level falls, in 1.15 format. */
+    uint32_t holdSamples;                /**< number of samples the envelope is held after a rise. */
+    uint32_t holdCount;                  /**< number of samples left to hold. */
+    q31_t state;                         /**< current envelope, in 1.31 format. */
+  } arm_envelope_instance_q15;
 
-      /* Update the input pointer */
-      dst += dstInc;
 
-      if (dst == (q7_t *) dst_end)
-      {
-        dst = dst_base;
-      }
+  /**
+   * @brief  Smoothing coefficient of an envelope tracker for a time constant.
+   * @param[in]  time        time constant, in seconds
+   * @param[in]  sampleRate  rate at which the coefficient is applied, in Hz
+   * @return the coefficient 1 - exp(-1 / (time * sampleRate)), 1 for a zero time constant.
+   */
+  float32_t arm_envelope_coeff_f32(
+  float32_t time,
+  float32_t sampleRate);
 
-      /* Circularly update rOffset.  Watch out for positive and negative value */
-      rOffset += bufferInc;
 
-      if (rOffset >= L)
-      {
-        rOffset -= L;
-      }
+  /**
+   * @brief  Initialization function for the floating-point envelope tracker.
+   * @param[out] S            points to an instance of the floating-point envelope tracker
+   * @param[in]  detector     level detector
+   * @param[in]  attack       smoothing coefficient when the level rises
+   * @param[in]  release      smoothing coefficient when the level falls
+   * @param[in]  holdSamples  number of samples the envelope is held after a rise
+   */
+  void arm_envelope_init_f32(
+  arm_envelope_instance_f32 * S,
+  arm_envelope_detector detector,
+  float32_t attack,
+  float32_t release,
+  uint32_t holdSamples);
 
-      /* Decrement the loop counter */
-      i--;
-    }
 
-    /* Update the index pointer */
-    *readOffset = rOffset;
-  }
+  /**
+   * @brief  Initialization function for the Q31 envelope tracker.
+   * @param[out] S            points to an instance of the Q31 envelope tracker
+   * @param[in]  detector     level detector
+   * @param[in]  attack       smoothing coefficient when the level rises, in 1.31 format
+   * @param[in]  release      smoothing coefficient when the level falls, in 1.31 format
+   * @param[in]  holdSamples  number of samples the envelope is held after a rise
+   */
+  void arm_envelope_init_q31(
+  arm_envelope_instance_q31 * S,
+  arm_envelope_detector detector,
+  q31_t attack,
+  q31_t release,
+  uint32_t holdSamples);
 
 
   /**
-   * @brief  Sum of the squares of the elements of a Q31 vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief  Initialization function for the Q15 envelope tracker.
+   * @param[out] S            points to an instance of the Q15 envelope tracker
+   * @param[in]  detector     level detector
+   * @param[in]  attack       smoothing coefficient when the level rises, in 1.15 format
+   * @param[in]  release      smoothing coefficient when the level falls, in 1.15 format
+   * @param[in]  holdSamples  number of samples the envelope is held after a rise
    */
-  void arm_power_q31(
-  q31_t * pSrc,
-  uint32_t blockSize,
-  q63_t * pResult);
+  void arm_envelope_init_q15(
+  arm_envelope_instance_q15 * S,
+  arm_envelope_detector detector,
+  q15_t attack,
+  q15_t release,
+  uint32_t holdSamples);
 
 
   /**
-   * @brief  Sum of the squares of the elements of a floating-point vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief  Tracks the envelope of a block of floating-point data.
+   * @param[in,out] S          points to an instance of the floating-point envelope tracker
+   * @param[in]     pSrc       points to the block of input data
+   * @param[out]    pDst       points to the envelope after each input sample, may be NULL
+   * @param[in]     blockSize  number of samples to process
+   * @return the largest envelope of the block.
    */
-  void arm_power_f32(
+  float32_t arm_envelope_f32(
+  arm_envelope_instance_f32 * S,
   float32_t * pSrc,
-  uint32_t blockSize,
-  float32_t * pResult);
+  float32_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Sum of the squares of the elements of a Q15 vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief  Tracks the envelope of a block of Q31 data.
+   * @param[in,out] S          points to an instance of the Q31 envelope tracker
+   * @param[in]     pSrc       points to the block of input data
+   * @param[out]    pDst       points to the envelope after each input sample, may be NULL
+   * @param[in]     blockSize  number of samples to process
+   * @return the largest envelope of the block.
    */
-  void arm_power_q15(
+  q31_t arm_envelope_q31(
+  arm_envelope_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Tracks the envelope of a block of Q15 data.
+   * @param[in,out] S          points to an instance of the Q15 envelope tracker
+   * @param[in]     pSrc       points to the block of input data
+   * @param[out]    pDst       points to the envelope after each input sample, may be NULL
+   * @param[in]     blockSize  number of samples to process
+   * @return the largest envelope of the block, in 1.31 format.
+   */
+  q31_t arm_envelope_q15(
+  arm_envelope_instance_q15 * S,
   q15_t * pSrc,
-  uint32_t blockSize,
-  q63_t * pResult);
+  q15_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Sum of the squares of the elements of a Q7 vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief Static curve of the dynamics processors, in dB.
    */
-  void arm_power_q7(
-  q7_t * pSrc,
-  uint32_t blockSize,
-  q31_t * pResult);
+  typedef struct
+  {
+    float32_t threshold;                 /**< threshold of the compressor. */
+    float32_t slope;                     /**< 1 - 1 / ratio of the compressor, 1 for a limiter. */
+    float32_t knee;                      /**< width of the soft knee of the compressor. */
+    float32_t gateThreshold;             /**< level under which the gate closes. */
+    float32_t gateRange;                 /**< attenuation of the closed gate. */
+    float32_t makeupGain;                /**< gain added to the output. */
+  } arm_dynamics_curve_f32;
 
+  /**
+   * @brief Instance structure for the floating-point dynamics processor.
+   */
+  typedef struct
+  {
+    arm_envelope_instance_f32 env;       /**< level detector. */
+    arm_dynamics_curve_f32 curve;        /**< static curve. */
+    float32_t gainAttack;                /**< smoothing coefficient of the gain when it falls, per block. */
+    float32_t gainRelease;               /**< smoothing coefficient of the gain when it rises, per block. */
+    float32_t gainDb;                    /**< smoothed gain of the curve, in dB. */
+    float32_t gain;                      /**< linear gain at the end of the previous block. */
+  } arm_dynamics_instance_f32;
 
   /**
-   * @brief  Mean value of a Q7 vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief Instance structure for the Q15 dynamics processor.
    */
-  void arm_mean_q7(
-  q7_t * pSrc,
-  uint32_t blockSize,
-  q7_t * pResult);
+  typedef struct
+  {
+    arm_envelope_instance_q15 env;       /**< level detector. */
+    arm_dynamics_curve_f32 curve;        /**< static curve. */
+    float32_t gainAttack;                /**< smoothing coefficient of the gain when it falls, per block. */
+    float32_t gainRelease;               /**< smoothing coefficient of the gain when it rises, per block. */
+    float32_t gainDb;                    /**< smoothed gain of the curve, in dB. */
+    q31_t gain;                          /**< linear gain at the end of the previous block, in 5.27 format. */
+  } arm_dynamics_instance_q15;
+
+
+  /**
+   * @brief  Sets the static curve of a dynamics processor.
+   * @param[out] C              points to the static curve
+   * @param[in]  threshold      threshold of the compressor, in dB
+   * @param[in]  ratio          ratio of the compressor, at least 1, or 0 for a limiter
+   * @param[in]  knee           width of the soft knee, in dB
+   * @param[in]  gateThreshold  level under which the gate closes, in dB
+   * @param[in]  gateRange      attenuation of the closed gate, in dB
+   * @param[in]  makeupGain     gain added to the output, in dB
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if a parameter is out of range.
+   */
+  arm_status arm_dynamics_set_curve_f32(
+  arm_dynamics_curve_f32 * C,
+  float32_t threshold,
+  float32_t ratio,
+  float32_t knee,
+  float32_t gateThreshold,
+  float32_t gateRange,
+  float32_t makeupGain);
+
+
+  /**
+   * @brief  Gain of the static curve of a dynamics processor.
+   * @param[in]  C        points to the static curve
+   * @param[in]  levelDb  input level, in dB
+   * @return the gain, in dB, without the makeup gain.
+   */
+  float32_t arm_dynamics_gain_f32(
+  const arm_dynamics_curve_f32 * C,
+  float32_t levelDb);
+
+
+  /**
+   * @brief  Initialization function for the floating-point dynamics processor.
+   * @param[out] S            points to an instance of the floating-point dynamics processor
+   * @param[in]  detector     level detector
+   * @param[in]  envAttack    smoothing coefficient of the level detector when the level rises
+   * @param[in]  envRelease   smoothing coefficient of the level detector when the level falls
+   * @param[in]  gainAttack   smoothing coefficient of the gain when it falls, per block
+   * @param[in]  gainRelease  smoothing coefficient of the gain when it rises, per block
+   */
+  void arm_dynamics_init_f32(
+  arm_dynamics_instance_f32 * S,
+  arm_envelope_detector detector,
+  float32_t envAttack,
+  float32_t envRelease,
+  float32_t gainAttack,
+  float32_t gainRelease);
+
+
+  /**
+   * @brief  Initialization function for the Q15 dynamics processor.
+   * @param[out] S            points to an instance of the Q15 dynamics processor
+   * @param[in]  detector     level detector
+   * @param[in]  envAttack    smoothing coefficient of the level detector when the level rises, in 1.15 format
+   * @param[in]  envRelease   smoothing coefficient of the level detector when the level falls, in 1.15 format
+   * @param[in]  gainAttack   smoothing coefficient of the gain when it falls, per block
+   * @param[in]  gainRelease  smoothing coefficient of the gain when it rises, per block
+   */
+  void arm_dynamics_init_q15(
+  arm_dynamics_instance_q15 * S,
+  arm_envelope_detector detector,
+  q15_t envAttack,
+  q15_t envRelease,
+  float32_t gainAttack,
+  float32_t gainRelease);
+
+
+  /**
+   * @brief  Processing function for the floating-point dynamics processor.
+   * @param[in,out] S          points to an instance of the floating-point dynamics processor
+   * @param[in]     pSrc       points to the block of input data
+   * @param[out]    pDst       points to the block of output data
+   * @param[in]     blockSize  number of samples to process
+   */
+  void arm_dynamics_f32(
+  arm_dynamics_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Mean value of a Q15 vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief  Processing function for the Q15 dynamics processor.
+   * @param[in,out] S          points to an instance of the Q15 dynamics processor
+   * @param[in]     pSrc       points to the block of input data
+   * @param[out]    pDst       points to the block of output data
+   * @param[in]     blockSize  number of samples to process
    */
-  void arm_mean_q15(
+  void arm_dynamics_q15(
+  arm_dynamics_instance_q15 * S,
   q15_t * pSrc,
-  uint32_t blockSize,
-  q15_t * pResult);
+  q15_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Mean value of a Q31 vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief  Histogram of a floating-point vector with uniform bins.
+   * @param[in]     pSrc       points to the input vector
+   * @param[in]     blockSize  length of the input vector
+   * @param[in]     minVal     lower edge of the first bin
+   * @param[in]     maxVal     upper edge of the last bin
+   * @param[in]     numBins    number of bins
+   * @param[in,out] pHist      points to the bin counts, which are incremented
    */
-  void arm_mean_q31(
-  q31_t * pSrc,
+  void arm_histogram_f32(
+  float32_t * pSrc,
   uint32_t blockSize,
-  q31_t * pResult);
+  float32_t minVal,
+  float32_t maxVal,
+  uint32_t numBins,
+  uint32_t * pHist);
 
 
   /**
-   * @brief  Mean value of a floating-point vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief  Histogram of a Q15 vector with uniform bins.
+   * @param[in]     pSrc       points to the input vector
+   * @param[in]     blockSize  length of the input vector
+   * @param[in]     minVal     lower edge of the first bin
+   * @param[in]     maxVal     upper edge of the last bin
+   * @param[in]     numBins    number of bins, at most (maxVal - minVal)
+   * @param[in,out] pHist      points to the bin counts, which are incremented
    */
-  void arm_mean_f32(
-  float32_t * pSrc,
+  void arm_histogram_q15(
+  q15_t * pSrc,
   uint32_t blockSize,
-  float32_t * pResult);
+  q15_t minVal,
+  q15_t maxVal,
+  uint16_t numBins,
+  uint32_t * pHist);
 
 
   /**
-   * @brief  Variance of the elements of a floating-point vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief  Selection of the k-th smallest element of a floating-point vector.
+   * @param[in,out] pSrc       points to the input vector, which is partially reordered
+   * @param[in]     blockSize  length of the input vector
+   * @param[in]     k          rank of the element to select
+   * @param[out]    pResult    k-th smallest element is returned here
    */
-  void arm_var_f32(
+  void arm_select_f32(
   float32_t * pSrc,
   uint32_t blockSize,
+  uint32_t k,
   float32_t * pResult);
 
 
   /**
-   * @brief  Variance of the elements of a Q31 vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief  Selection of the k-th smallest element of a Q31 vector.
+   * @param[in,out] pSrc       points to the input vector, which is partially reordered
+   * @param[in]     blockSize  length of the input vector
+   * @param[in]     k          rank of the element to select
+   * @param[out]    pResult    k-th smallest element is returned here
    */
-  void arm_var_q31(
+  void arm_select_q31(
   q31_t * pSrc,
   uint32_t blockSize,
+  uint32_t k,
   q31_t * pResult);
 
 
   /**
-   * @brief  Variance of the elements of a Q15 vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief  Selection of the k-th smallest element of a Q15 vector.
+   * @param[in,out] pSrc       points to the input vector, which is partially reordered
+   * @param[in]     blockSize  length of the input vector
+   * @param[in]     k          rank of the element to select
+   * @param[out]    pResult    k-th smallest element is returned here
    */
-  void arm_var_q15(
+  void arm_select_q15(
   q15_t * pSrc,
   uint32_t blockSize,
+  uint32_t k,
   q15_t * pResult);
 
 
   /**
-   * @brief  Root Mean Square of the elements of a floating-point vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief  Percentile of a floating-point vector.
+   * @param[in,out] pSrc        points to the input vector, which is partially reordered
+   * @param[in]     blockSize   length of the input vector
+   * @param[in]     percentile  rank of the result as a fraction between 0 and 1
+   * @param[out]    pResult     percentile value is returned here
    */
-  void arm_rms_f32(
+  void arm_percentile_f32(
   float32_t * pSrc,
   uint32_t blockSize,
+  float32_t percentile,
   float32_t * pResult);
 
 
   /**
-   * @brief  Root Mean Square of the elements of a Q31 vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief  Percentile of a Q31 vector.
+   * @param[in,out] pSrc        points to the input vector, which is partially reordered
+   * @param[in]     blockSize   length of the input vector
+   * @param[in]     percentile  rank of the result as a fraction between 0 and 1
+   * @param[out]    pResult     percentile value is returned here
    */
-  void arm_rms_q31(
+  void arm_percentile_q31(
   q31_t * pSrc,
   uint32_t blockSize,
+  q31_t percentile,
   q31_t * pResult);
 
 
   /**
-   * @brief  Root Mean Square of the elements of a Q15 vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief  Percentile of a Q15 vector.
+   * @param[in,out] pSrc        points to the input vector, which is partially reordered
+   * @param[in]     blockSize   length of the input vector
+   * @param[in]     percentile  rank of the result as a fraction between 0 and 1
+   * @param[out]    pResult     percentile value is returned here
    */
-  void arm_rms_q15(
+  void arm_percentile_q15(
   q15_t * pSrc,
   uint32_t blockSize,
+  q15_t percentile,
   q15_t * pResult);
 
 
   /**
-   * @brief  Standard deviation of the elements of a floating-point vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief  Largest elements of a floating-point vector and their indices.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  blockSize  length of the input vector
+   * @param[in]  k          number of elements to return
+   * @param[out] pDst       points to the k largest elements in descending order
+   * @param[out] pIndex     points to the indices of the k largest elements
    */
-  void arm_std_f32(
+  void arm_topk_f32(
   float32_t * pSrc,
   uint32_t blockSize,
-  float32_t * pResult);
+  uint32_t k,
+  float32_t * pDst,
+  uint32_t * pIndex);
 
 
   /**
-   * @brief  Standard deviation of the elements of a Q31 vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief  Largest elements of a Q15 vector and their indices.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  blockSize  length of the input vector
+   * @param[in]  k          number of elements to return
+   * @param[out] pDst       points to the k largest elements in descending order
+   * @param[out] pIndex     points to the indices of the k largest elements
    */
-  void arm_std_q31(
-  q31_t * pSrc,
+  void arm_topk_q15(
+  q15_t * pSrc,
   uint32_t blockSize,
-  q31_t * pResult);
+  uint32_t k,
+  q15_t * pDst,
+  uint32_t * pIndex);
 
 
   /**
-   * @brief  Standard deviation of the elements of a Q15 vector.
-   * @param[in]  pSrc       is input pointer
-   * @param[in]  blockSize  is the number of samples to process
-   * @param[out] pResult    is output value.
+   * @brief  Largest elements of a Q7 vector and their indices.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  blockSize  length of the input vector
+   * @param[in]  k          number of elements to return
+   * @param[out] pDst       points to the k largest elements in descending order
+   * @param[out] pIndex     points to the indices of the k largest elements
    */
-  void arm_std_q15(
-  q15_t * pSrc,
+  void arm_topk_q7(
+  q7_t * pSrc,
   uint32_t blockSize,
-  q15_t * pResult);
+  uint32_t k,
+  q7_t * pDst,
+  uint32_t * pIndex);
+
 
 
   /**
@@ -6320,6 +10500,137 @@ void arm_rfft_fast_f32(
   uint32_t numSamples);
 
 
+  /**
+   * @brief Estimates of the approximate complex magnitude functions.
+   */
+  typedef enum
+  {
+    ARM_CMPLX_MAG_APPROX_FAST = 0,       /**< alpha max plus beta min, maximum relative error 3.96% */
+    ARM_CMPLX_MAG_APPROX_MEDIUM = 1,     /**< two segment alpha max plus beta min, maximum relative error 0.97% */
+    ARM_CMPLX_MAG_APPROX_NEWTON = 2      /**< two segment estimate and one Newton-Raphson iteration, maximum relative error 4.8e-5 */
+  } arm_cmplx_mag_accuracy;
+
+
+  /**
+   * @brief  Floating-point approximate complex magnitude
+   * @param[in]  pSrc        points to the complex input vector
+   * @param[in]  accuracy    selects the estimate
+   * @param[out] pDst        points to the real output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_mag_approx_f32(
+  float32_t * pSrc,
+  arm_cmplx_mag_accuracy accuracy,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Q31 approximate complex magnitude
+   * @param[in]  pSrc        points to the complex input vector
+   * @param[in]  accuracy    selects the estimate
+   * @param[out] pDst        points to the real output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_mag_approx_q31(
+  q31_t * pSrc,
+  arm_cmplx_mag_accuracy accuracy,
+  q31_t * pDst,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Q15 approximate complex magnitude
+   * @param[in]  pSrc        points to the complex input vector
+   * @param[in]  accuracy    selects the estimate
+   * @param[out] pDst        points to the real output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_mag_approx_q15(
+  q15_t * pSrc,
+  arm_cmplx_mag_accuracy accuracy,
+  q15_t * pDst,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Floating-point complex cartesian to polar conversion
+   * @param[in]  pSrc        points to the complex input vector
+   * @param[out] pMag        points to the magnitude output vector
+   * @param[out] pPhase      points to the phase output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_to_polar_f32(
+  float32_t * pSrc,
+  float32_t * pMag,
+  float32_t * pPhase,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Q31 complex cartesian to polar conversion
+   * @param[in]  pSrc        points to the complex input vector
+   * @param[out] pMag        points to the magnitude output vector
+   * @param[out] pPhase      points to the phase output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_to_polar_q31(
+  q31_t * pSrc,
+  q31_t * pMag,
+  q31_t * pPhase,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Q15 complex cartesian to polar conversion
+   * @param[in]  pSrc        points to the complex input vector
+   * @param[out] pMag        points to the magnitude output vector
+   * @param[out] pPhase      points to the phase output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_to_polar_q15(
+  q15_t * pSrc,
+  q15_t * pMag,
+  q15_t * pPhase,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Floating-point instantaneous amplitude, phase and frequency of an analytic signal
+   * @param[in]     pSrc        points to the complex input vector
+   * @param[out]    pAmp        points to the amplitude output vector
+   * @param[out]    pPhase      points to the phase output vector, in radians
+   * @param[out]    pFreq       points to the frequency output vector, in cycles per sample
+   * @param[in,out] pPrevPhase  points to the phase of the sample before the block
+   * @param[in]     numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_inst_f32(
+  float32_t * pSrc,
+  float32_t * pAmp,
+  float32_t * pPhase,
+  float32_t * pFreq,
+  float32_t * pPrevPhase,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Q15 instantaneous amplitude, phase and frequency of an analytic signal
+   * @param[in]     pSrc        points to the complex input vector
+   * @param[out]    pAmp        points to the amplitude output vector, in 2.14 format
+   * @param[out]    pPhase      points to the phase output vector, divided by pi
+   * @param[out]    pFreq       points to the frequency output vector, fs/2 mapping to 1
+   * @param[in,out] pPrevPhase  points to the phase of the sample before the block
+   * @param[in]     numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_inst_q15(
+  q15_t * pSrc,
+  q15_t * pAmp,
+  q15_t * pPhase,
+  q15_t * pFreq,
+  q15_t * pPrevPhase,
+  uint32_t numSamples);
+
+
   /**
    * @brief  Q15 complex dot product
    * @param[in]  pSrcA       points to the first input vector
@@ -6600,6 +10911,198 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Quantization modes of the floating-point to fixed-point block converters.
+   */
+  typedef enum
+  {
+    ARM_QUANT_ROUND  = 0,                /**< Round to nearest */
+    ARM_QUANT_TPDF   = 1,                /**< Triangular probability density dither, then round */
+    ARM_QUANT_SHAPED = 2                 /**< Triangular dither with second order noise shaping */
+  } arm_quant_mode;
+
+  /**
+   * @brief Instance structure for the floating-point to fixed-point block converters.
+   */
+  typedef struct
+  {
+    arm_quant_mode mode;                 /**< quantization mode. */
+    float32_t scale;                     /**< scale applied to the input before the conversion. */
+    uint32_t seed;                       /**< state of the dither generator. */
+    float32_t err[2];                    /**< noise shaping state, the last two quantization errors. */
+  } arm_quant_instance_f32;
+
+
+  /**
+   * @brief  Initialization function for the floating-point to fixed-point block converters.
+   * @param[out] S      points to an instance of the converter structure.
+   * @param[in]  mode   quantization mode.
+   * @param[in]  scale  scale applied to the input before the conversion.
+   * @param[in]  seed   initial state of the dither generator.
+   */
+  void arm_quant_init_f32(
+  arm_quant_instance_f32 * S,
+  arm_quant_mode mode,
+  float32_t scale,
+  uint32_t seed);
+
+
+  /**
+   * @brief  Scales and converts a floating-point vector to Q15 with rounding, dither or noise shaping.
+   * @param[in,out] S          points to an instance of the converter structure.
+   * @param[in]     pSrc       points to the floating-point input vector
+   * @param[out]    pDst       points to the Q15 output vector
+   * @param[in]     blockSize  length of the input vector
+   */
+  void arm_float_to_q15_quant(
+  arm_quant_instance_f32 * S,
+  float32_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Scales and converts a floating-point vector to Q31 with rounding, dither or noise shaping.
+   * @param[in,out] S          points to an instance of the converter structure.
+   * @param[in]     pSrc       points to the floating-point input vector
+   * @param[out]    pDst       points to the Q31 output vector
+   * @param[in]     blockSize  length of the input vector
+   */
+  void arm_float_to_q31_quant(
+  arm_quant_instance_f32 * S,
+  float32_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Deinterleaves a multi-channel floating-point buffer.
+   * @param[in]  pSrc         points to the interleaved input buffer, blockSize frames of numChannels samples
+   * @param[in]  numChannels  number of channels
+   * @param[out] pDst         points to the planar output buffer, numChannels * blockSize samples
+   * @param[in]  blockSize    number of samples in each channel
+   */
+  void arm_deinterleave_f32(
+  float32_t * pSrc,
+  uint32_t numChannels,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Deinterleaves a multi-channel Q31 buffer.
+   * @param[in]  pSrc         points to the interleaved input buffer, blockSize frames of numChannels samples
+   * @param[in]  numChannels  number of channels
+   * @param[out] pDst         points to the planar output buffer, numChannels * blockSize samples
+   * @param[in]  blockSize    number of samples in each channel
+   */
+  void arm_deinterleave_q31(
+  q31_t * pSrc,
+  uint32_t numChannels,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Deinterleaves a multi-channel Q15 buffer.
+   * @param[in]  pSrc         points to the interleaved input buffer, blockSize frames of numChannels samples
+   * @param[in]  numChannels  number of channels
+   * @param[out] pDst         points to the planar output buffer, numChannels * blockSize samples
+   * @param[in]  blockSize    number of samples in each channel
+   */
+  void arm_deinterleave_q15(
+  q15_t * pSrc,
+  uint32_t numChannels,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Deinterleaves a multi-channel Q7 buffer.
+   * @param[in]  pSrc         points to the interleaved input buffer, blockSize frames of numChannels samples
+   * @param[in]  numChannels  number of channels
+   * @param[out] pDst         points to the planar output buffer, numChannels * blockSize samples
+   * @param[in]  blockSize    number of samples in each channel
+   */
+  void arm_deinterleave_q7(
+  q7_t * pSrc,
+  uint32_t numChannels,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Interleaves the channels of a planar floating-point buffer.
+   * @param[in]  pSrc         points to the planar input buffer, numChannels * blockSize samples
+   * @param[in]  numChannels  number of channels
+   * @param[out] pDst         points to the interleaved output buffer, blockSize frames of numChannels samples
+   * @param[in]  blockSize    number of samples in each channel
+   */
+  void arm_interleave_f32(
+  float32_t * pSrc,
+  uint32_t numChannels,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Interleaves the channels of a planar Q31 buffer.
+   * @param[in]  pSrc         points to the planar input buffer, numChannels * blockSize samples
+   * @param[in]  numChannels  number of channels
+   * @param[out] pDst         points to the interleaved output buffer, blockSize frames of numChannels samples
+   * @param[in]  blockSize    number of samples in each channel
+   */
+  void arm_interleave_q31(
+  q31_t * pSrc,
+  uint32_t numChannels,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Interleaves the channels of a planar Q15 buffer.
+   * @param[in]  pSrc         points to the planar input buffer, numChannels * blockSize samples
+   * @param[in]  numChannels  number of channels
+   * @param[out] pDst         points to the interleaved output buffer, blockSize frames of numChannels samples
+   * @param[in]  blockSize    number of samples in each channel
+   */
+  void arm_interleave_q15(
+  q15_t * pSrc,
+  uint32_t numChannels,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Interleaves the channels of a planar Q7 buffer.
+   * @param[in]  pSrc         points to the planar input buffer, numChannels * blockSize samples
+   * @param[in]  numChannels  number of channels
+   * @param[out] pDst         points to the interleaved output buffer, blockSize frames of numChannels samples
+   * @param[in]  blockSize    number of samples in each channel
+   */
+  void arm_interleave_q7(
+  q7_t * pSrc,
+  uint32_t numChannels,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Unpacks dual mode ADC words to two Q15 vectors.
+   * @param[in]  pSrc        points to the packed words, first ADC in bits [15:0] and second ADC in bits [31:16]
+   * @param[in]  resolution  number of bits of the unsigned, right aligned ADC samples, 1 to 16
+   * @param[out] pDstA       points to the output vector of the first ADC
+   * @param[out] pDstB       points to the output vector of the second ADC
+   * @param[in]  blockSize   number of words to unpack
+   */
+  void arm_adc_dual_to_q15(
+  uint32_t * pSrc,
+  uint32_t resolution,
+  q15_t * pDstA,
+  q15_t * pDstB,
+  uint32_t blockSize);
+
+
   /**
    * @brief  Converts the elements of the Q31 vector to Q15 vector.
    * @param[in]  pSrc       is input pointer
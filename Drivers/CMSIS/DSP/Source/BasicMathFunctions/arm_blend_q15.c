@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_blend_q15.c
+ * Description:  Q15 vector selection with a mask
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup compare
+ * @{
+ */
+
+/**
+ * @brief Selects the elements of two Q15 vectors with a mask.
+ * @param[in]       *pMask points to the mask vector, a non-zero element selects pSrcA
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * \par
+ * Four mask bytes are read at a time and turned into a 0xFF or 0x00 byte each,
+ * then the samples are selected two at a time with logical operations.
+ */
+
+void arm_blend_q15(
+  uint8_t * pMask,
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+  uint32_t mask;                                 /* byte mask of 4 samples */
+  uint32_t mask02, mask13;                       /* half-word masks of samples 0 and 2, 1 and 3 */
+  uint32_t mask01, mask23;                       /* half-word masks of samples 0 and 1, 2 and 3 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = (M != 0) ? A : B */
+    /* Read 4 mask bytes and turn each non-zero byte into 0xFF */
+    mask = *__SIMD32(pMask)++;
+    mask = ((((mask & 0x7F7F7F7FU) + 0x7F7F7F7FU) | mask) >> 7) & 0x01010101U;
+    mask = mask * 0xFFU;
+
+    /* Extend the bytes to half-words in the order of the samples */
+    mask02 = __SXTB16(mask);
+    mask13 = __SXTB16(mask >> 8);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    mask01 = __PKHBT(mask02, mask13, 16);
+    mask23 = __PKHTB(mask13, mask02, 16);
+
+#else
+
+    mask01 = __PKHTB(mask13, mask02, 16);
+    mask23 = __PKHBT(mask02, mask13, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Select 2 samples at a time */
+    *__SIMD32(pDst)++ = (*__SIMD32(pSrcA)++ & mask01) | (*__SIMD32(pSrcB)++ & ~mask01);
+    *__SIMD32(pDst)++ = (*__SIMD32(pSrcA)++ & mask23) | (*__SIMD32(pSrcB)++ & ~mask23);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = (M != 0) ? A : B */
+    *pDst++ = (*pMask++ != 0U) ? *pSrcA : *pSrcB;
+    pSrcA++;
+    pSrcB++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of compare group
+ */
@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_blend_q7.c
+ * Description:  Q7 vector selection with a mask
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup compare
+ * @{
+ */
+
+/**
+ * @brief Selects the elements of two Q7 vectors with a mask.
+ * @param[in]       *pMask points to the mask vector, a non-zero element selects pSrcA
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * \par
+ * Four mask bytes are read at a time and turned into a 0xFF or 0x00 byte each,
+ * then the four samples are selected at once with logical operations.
+ */
+
+void arm_blend_q7(
+  uint8_t * pMask,
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+  uint32_t mask;                                 /* byte mask of 4 samples */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = (M != 0) ? A : B */
+    /* Read 4 mask bytes and turn each non-zero byte into 0xFF */
+    mask = *__SIMD32(pMask)++;
+    mask = ((((mask & 0x7F7F7F7FU) + 0x7F7F7F7FU) | mask) >> 7) & 0x01010101U;
+    mask = mask * 0xFFU;
+
+    /* Select 4 samples */
+    *__SIMD32(pDst)++ = (*__SIMD32(pSrcA)++ & mask) | (*__SIMD32(pSrcB)++ & ~mask);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = (M != 0) ? A : B */
+    *pDst++ = (*pMask++ != 0U) ? *pSrcA : *pSrcB;
+    pSrcA++;
+    pSrcB++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of compare group
+ */
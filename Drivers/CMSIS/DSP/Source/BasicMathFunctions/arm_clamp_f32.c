@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_clamp_f32.c
+ * Description:  Floating-point vector clamp
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @defgroup clamp Vector Clamp
+ *
+ * Limits the elements of a vector to a range.
+ *
+ * <pre>
+ *     pDst[n] = min(max(pSrc[n], low), high);   0 <= n < blockSize.
+ * </pre>
+ *
+ * <code>low</code> must not be greater than <code>high</code>.  In-place
+ * processing is supported.
+ *
+ * There are separate functions for floating point, Q31, Q15, and Q7 data types.
+ */
+
+/**
+ * @addtogroup clamp
+ * @{
+ */
+
+/**
+ * @brief Clamps the elements of a floating-point vector to a range.
+ * @param[in]       *pSrc points to the input vector
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       low lower bound
+ * @param[in]       high upper bound
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ */
+
+void arm_clamp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t low,
+  float32_t high,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+  float32_t in;                                  /* temporary variable */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+  float32_t in1, in2, in3, in4;                  /* temporary variables */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = min(max(A, low), high) */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    in1 = (in1 > high) ? high : ((in1 < low) ? low : in1);
+    in2 = (in2 > high) ? high : ((in2 < low) ? low : in2);
+    in3 = (in3 > high) ? high : ((in3 < low) ? low : in3);
+    in4 = (in4 > high) ? high : ((in4 < low) ? low : in4);
+
+    pDst[0] = in1;
+    pDst[1] = in2;
+    pDst[2] = in3;
+    pDst[3] = in4;
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = min(max(A, low), high) */
+    in = *pSrc++;
+    *pDst++ = (in > high) ? high : ((in < low) ? low : in);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of clamp group
+ */
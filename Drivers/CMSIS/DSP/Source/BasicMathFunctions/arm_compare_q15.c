@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_compare_q15.c
+ * Description:  Q15 vector comparison
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup compare
+ * @{
+ */
+
+/**
+ * @brief Compares two Q15 vectors element by element.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       op comparison operator
+ * @param[out]      *pDst points to the output mask vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_compare_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+  q15_t inA, inB;                                /* temporary input variables */
+  uint8_t mask[3];                               /* output of each outcome */
+
+#if defined (ARM_MATH_DSP)
+
+  q31_t inA2, inB2;                              /* two packed input samples */
+  uint32_t ge, le;                               /* masks of the A >= B and A <= B outcomes */
+  uint32_t out1, out2;                           /* masks of two samples, one per halfword */
+  uint32_t mask2[3];                             /* packed outputs of each outcome */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  /* Masks of the less than, equal and greater than outcomes */
+  mask[0] = ((op & 1U) != 0U) ? 0xFFU : 0U;
+  mask[1] = ((op & 2U) != 0U) ? 0xFFU : 0U;
+  mask[2] = ((op & 4U) != 0U) ? 0xFFU : 0U;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  mask2[0] = mask[0] * 0x00010001U;
+  mask2[1] = mask[1] * 0x00010001U;
+  mask2[2] = mask[2] * 0x00010001U;
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = (A op B) ? 0xFF : 0x00 */
+    inA2 = *__SIMD32(pSrcA)++;
+    inB2 = *__SIMD32(pSrcB)++;
+
+    /* SSUB16 sets the GE flags of each halfword where the difference is not negative,
+     ** SEL turns the flags into a halfword mask */
+    (void) __SSUB16(inA2, inB2);
+    ge = __SEL(0xFFFFFFFFU, 0U);
+    (void) __SSUB16(inB2, inA2);
+    le = __SEL(0xFFFFFFFFU, 0U);
+    out1 = (~ge & mask2[0]) | (ge & le & mask2[1]) | (~le & mask2[2]);
+
+    inA2 = *__SIMD32(pSrcA)++;
+    inB2 = *__SIMD32(pSrcB)++;
+
+    (void) __SSUB16(inA2, inB2);
+    ge = __SEL(0xFFFFFFFFU, 0U);
+    (void) __SSUB16(inB2, inA2);
+    le = __SEL(0xFFFFFFFFU, 0U);
+    out2 = (~ge & mask2[0]) | (ge & le & mask2[1]) | (~le & mask2[2]);
+
+    /* Pack the 4 masks and store them in a single write */
+#ifndef ARM_MATH_BIG_ENDIAN
+    *__SIMD32(pDst)++ = __PACKq7(out1, out1 >> 16, out2, out2 >> 16);
+#else
+    *__SIMD32(pDst)++ = __PACKq7(out1 >> 16, out1, out2 >> 16, out2);
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = (A op B) ? 0xFF : 0x00 */
+    inA = *pSrcA++;
+    inB = *pSrcB++;
+    *pDst++ = mask[(inA >= inB) + (inA > inB)];
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of compare group
+ */
@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mult_add_f32.c
+ * Description:  Floating-point vector multiplication and addition
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @defgroup fma Vector Multiply-Add
+ *
+ * Single pass combinations of multiplications and additions, which otherwise
+ * need several calls to the basic math functions and several passes over memory.
+ *
+ * <pre>
+ *     pDst[n] = pSrc[n] * scale + offset;                          arm_scale_offset_xxx()
+ *     pDst[n] = pSrcA[n] * pSrcB[n] + pSrcC[n];                    arm_mult_add_xxx()
+ *     pDst[n] = pSrcA[n] * weightA + pSrcB[n] * weightB;           arm_weighted_sum_xxx()
+ * </pre>
+ *
+ * The fixed-point arm_scale_offset_xxx() and arm_mult_add_xxx() functions give
+ * the same results as arm_scale_xxx() followed by arm_offset_xxx(), and as
+ * arm_mult_xxx() followed by arm_add_xxx().  All the fixed-point results are
+ * saturated, so that y = clamp(a * x + b) needs one pass when the clamp is the
+ * range of the type, and two passes with arm_clamp_xxx() otherwise.
+ *
+ * There are separate functions for floating point, Q31, Q15, and Q7 data types.
+ */
+
+/**
+ * @addtogroup fma
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector multiplication and addition.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       *pSrcC points to the vector added to the products
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_mult_add_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pSrcC,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+  float32_t out1, out2, out3, out4;              /* temporary output variables */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* D = A * B + C */
+    out1 = (pSrcA[0] * pSrcB[0]) + pSrcC[0];
+    out2 = (pSrcA[1] * pSrcB[1]) + pSrcC[1];
+    out3 = (pSrcA[2] * pSrcB[2]) + pSrcC[2];
+    out4 = (pSrcA[3] * pSrcB[3]) + pSrcC[3];
+
+    pDst[0] = out1;
+    pDst[1] = out2;
+    pDst[2] = out3;
+    pDst[3] = out4;
+
+    /* Update the pointers to process the next samples */
+    pSrcA += 4U;
+    pSrcB += 4U;
+    pSrcC += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* D = A * B + C */
+    *pDst++ = (*pSrcA++ * *pSrcB++) + *pSrcC++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of fma group
+ */
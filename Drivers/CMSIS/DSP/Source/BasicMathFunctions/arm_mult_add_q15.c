@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mult_add_q15.c
+ * Description:  Q15 vector multiplication and addition
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup fma
+ * @{
+ */
+
+/**
+ * @brief Q15 vector multiplication and addition.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       *pSrcC points to the vector added to the products
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are computed and saturated as in arm_mult_q15(), then the
+ * additions are saturated as in arm_add_q15().
+ */
+
+void arm_mult_add_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pSrcC,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+  q31_t out;                                     /* temporary variable */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+  q31_t inA1, inA2, inB1, inB2;                  /* packed input samples */
+  q31_t out1, out2, out3, out4;                  /* temporary output variables */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* D = A * B + C */
+    /* Read 4 samples of A and B in two words each */
+    inA1 = *__SIMD32(pSrcA)++;
+    inB1 = *__SIMD32(pSrcB)++;
+    inA2 = *__SIMD32(pSrcA)++;
+    inB2 = *__SIMD32(pSrcB)++;
+
+    /* Multiply and saturate each half-word */
+    out1 = __SSAT(((q15_t) inA1 * (q15_t) inB1) >> 15, 16);
+    out2 = __SSAT(((q15_t) (inA1 >> 16) * (q15_t) (inB1 >> 16)) >> 15, 16);
+    out3 = __SSAT(((q15_t) inA2 * (q15_t) inB2) >> 15, 16);
+    out4 = __SSAT(((q15_t) (inA2 >> 16) * (q15_t) (inB2 >> 16)) >> 15, 16);
+
+    /* Pack the products back in their half-words and add C, 2 samples at a time */
+    *__SIMD32(pDst)++ = __QADD16(__PKHBT(out1, out2, 16), *__SIMD32(pSrcC)++);
+    *__SIMD32(pDst)++ = __QADD16(__PKHBT(out3, out4, 16), *__SIMD32(pSrcC)++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* D = A * B + C */
+    out = __SSAT(((q31_t) *pSrcA++ * *pSrcB++) >> 15, 16);
+    *pDst++ = (q15_t) __SSAT(out + *pSrcC++, 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of fma group
+ */
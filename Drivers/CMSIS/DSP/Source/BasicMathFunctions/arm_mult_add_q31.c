@@ -0,0 +1,129 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mult_add_q31.c
+ * Description:  Q31 vector multiplication and addition
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup fma
+ * @{
+ */
+
+/**
+ * @brief Q31 vector multiplication and addition.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       *pSrcC points to the vector added to the products
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are computed and saturated as in arm_mult_q31(), then the
+ * additions are saturated as in arm_add_q31().
+ */
+
+void arm_mult_add_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pSrcC,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+  q31_t out;                                     /* temporary variable */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+  q31_t out1, out2, out3, out4;                  /* temporary output variables */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* D = A * B + C */
+    out1 = (q31_t) (((q63_t) pSrcA[0] * pSrcB[0]) >> 32);
+    out2 = (q31_t) (((q63_t) pSrcA[1] * pSrcB[1]) >> 32);
+    out3 = (q31_t) (((q63_t) pSrcA[2] * pSrcB[2]) >> 32);
+    out4 = (q31_t) (((q63_t) pSrcA[3] * pSrcB[3]) >> 32);
+
+    out1 = __SSAT(out1, 31) << 1U;
+    out2 = __SSAT(out2, 31) << 1U;
+    out3 = __SSAT(out3, 31) << 1U;
+    out4 = __SSAT(out4, 31) << 1U;
+
+    pDst[0] = __QADD(out1, pSrcC[0]);
+    pDst[1] = __QADD(out2, pSrcC[1]);
+    pDst[2] = __QADD(out3, pSrcC[2]);
+    pDst[3] = __QADD(out4, pSrcC[3]);
+
+    /* Update the pointers to process the next samples */
+    pSrcA += 4U;
+    pSrcB += 4U;
+    pSrcC += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* D = A * B + C */
+    out = (q31_t) (((q63_t) *pSrcA++ * *pSrcB++) >> 32);
+    *pDst++ = __QADD(__SSAT(out, 31) << 1U, *pSrcC++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of fma group
+ */
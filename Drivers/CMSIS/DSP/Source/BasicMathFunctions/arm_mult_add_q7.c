@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mult_add_q7.c
+ * Description:  Q7 vector multiplication and addition
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup fma
+ * @{
+ */
+
+/**
+ * @brief Q7 vector multiplication and addition.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       *pSrcC points to the vector added to the products
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are computed and saturated as in arm_mult_q7(), then the
+ * additions are saturated as in arm_add_q7().
+ */
+
+void arm_mult_add_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pSrcC,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+  q31_t out;                                     /* temporary variable */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+  q7_t out1, out2, out3, out4;                   /* temporary output variables */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* D = A * B + C */
+    /* Multiply and saturate 4 samples */
+    out1 = (q7_t) __SSAT(((q15_t) pSrcA[0] * pSrcB[0]) >> 7, 8);
+    out2 = (q7_t) __SSAT(((q15_t) pSrcA[1] * pSrcB[1]) >> 7, 8);
+    out3 = (q7_t) __SSAT(((q15_t) pSrcA[2] * pSrcB[2]) >> 7, 8);
+    out4 = (q7_t) __SSAT(((q15_t) pSrcA[3] * pSrcB[3]) >> 7, 8);
+    pSrcA += 4U;
+    pSrcB += 4U;
+
+    /* Pack the products and add C, 4 samples at a time */
+    *__SIMD32(pDst)++ = __QADD8(__PACKq7(out1, out2, out3, out4), *__SIMD32(pSrcC)++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* D = A * B + C */
+    out = __SSAT(((q15_t) *pSrcA++ * *pSrcB++) >> 7, 8);
+    *pDst++ = (q7_t) __SSAT(out + *pSrcC++, 8);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of fma group
+ */
@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_scale_offset_q31.c
+ * Description:  Q31 vector scale and offset
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup fma
+ * @{
+ */
+
+/**
+ * @brief  Scales one Q31 sample as arm_scale_q31() and adds the offset.
+ */
+CMSIS_INLINE __STATIC_INLINE q31_t arm_scale_offset_sample_q31(
+  q31_t in,
+  q31_t scaleFract,
+  int8_t kShift,
+  q31_t offset)
+{
+  q31_t out;
+
+  out = (q31_t) (((q63_t) in * scaleFract) >> 32);
+  out = (kShift >= 0) ? clip_q63_to_q31((q63_t) out << kShift) : (out >> -kShift);
+
+  return (__QADD(out, offset));
+}
+
+/**
+ * @brief Multiplies a Q31 vector by a scalar and adds an offset.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       scaleFract fractional portion of the scale value
+ * @param[in]       shift number of bits to shift the result by
+ * @param[in]       offset offset added after the scaling
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input data <code>*pSrc</code> and <code>scaleFract</code> are in 1.31 format.
+ * These are multiplied to yield a 2.62 intermediate result which is shifted with saturation to 1.31 format.
+ * The offset is then added with saturation.  The results are the same as
+ * arm_scale_q31() followed by arm_offset_q31().
+ */
+
+void arm_scale_offset_q31(
+  q31_t * pSrc,
+  q31_t scaleFract,
+  int8_t shift,
+  q31_t offset,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  int8_t kShift = shift + 1;                     /* Shift to apply after scaling */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+  q31_t in1, in2, in3, in4;                      /* temporary variables */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale + offset */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    pDst[0] = arm_scale_offset_sample_q31(in1, scaleFract, kShift, offset);
+    pDst[1] = arm_scale_offset_sample_q31(in2, scaleFract, kShift, offset);
+    pDst[2] = arm_scale_offset_sample_q31(in3, scaleFract, kShift, offset);
+    pDst[3] = arm_scale_offset_sample_q31(in4, scaleFract, kShift, offset);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale + offset */
+    *pDst++ = arm_scale_offset_sample_q31(*pSrc++, scaleFract, kShift, offset);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of fma group
+ */
@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_threshold_f32.c
+ * Description:  Floating-point vector comparison with a threshold
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup compare
+ * @{
+ */
+
+/**
+ * @brief Compares the elements of a floating-point vector with a threshold.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       threshold value compared with each element
+ * @param[in]       op comparison operator
+ * @param[out]      *pDst points to the output mask vector
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ */
+
+void arm_threshold_f32(
+  float32_t * pSrc,
+  float32_t threshold,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+  float32_t inA;                                 /* temporary input variable */
+  uint8_t mask[3];                               /* output of each outcome */
+
+#if defined (ARM_MATH_DSP)
+
+  float32_t inA1, inA2, inA3, inA4;              /* temporary input variables */
+  uint8_t out1, out2, out3, out4;                /* temporary output variables */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  /* Masks of the less than, equal and greater than outcomes */
+  mask[0] = ((op & 1U) != 0U) ? 0xFFU : 0U;
+  mask[1] = ((op & 2U) != 0U) ? 0xFFU : 0U;
+  mask[2] = ((op & 4U) != 0U) ? 0xFFU : 0U;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = (A op threshold) ? 0xFF : 0x00 */
+    inA1 = pSrc[0];
+    inA2 = pSrc[1];
+    inA3 = pSrc[2];
+    inA4 = pSrc[3];
+
+    out1 = mask[(inA1 >= threshold) + (inA1 > threshold)];
+    out2 = mask[(inA2 >= threshold) + (inA2 > threshold)];
+    out3 = mask[(inA3 >= threshold) + (inA3 > threshold)];
+    out4 = mask[(inA4 >= threshold) + (inA4 > threshold)];
+
+    /* Pack the 4 masks and store them in a single write */
+    *__SIMD32(pDst)++ = __PACKq7(out1, out2, out3, out4);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = (A op threshold) ? 0xFF : 0x00 */
+    inA = *pSrc++;
+    *pDst++ = mask[(inA >= threshold) + (inA > threshold)];
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of compare group
+ */
@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_threshold_q7.c
+ * Description:  Q7 vector comparison with a threshold
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup compare
+ * @{
+ */
+
+/**
+ * @brief Compares the elements of a Q7 vector with a threshold.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       threshold value compared with each element
+ * @param[in]       op comparison operator
+ * @param[out]      *pDst points to the output mask vector
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ */
+
+void arm_threshold_q7(
+  q7_t * pSrc,
+  q7_t threshold,
+  arm_compare_op op,
+  uint8_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+  q7_t inA;                                      /* temporary input variable */
+  uint8_t mask[3];                               /* output of each outcome */
+
+#if defined (ARM_MATH_DSP)
+
+  q31_t inA4;                                    /* four packed input samples */
+  q31_t thr4;                                    /* packed threshold */
+  uint32_t ge, le;                               /* masks of the A >= threshold and A <= threshold outcomes */
+  uint32_t mask4[3];                             /* packed outputs of each outcome */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  /* Masks of the less than, equal and greater than outcomes */
+  mask[0] = ((op & 1U) != 0U) ? 0xFFU : 0U;
+  mask[1] = ((op & 2U) != 0U) ? 0xFFU : 0U;
+  mask[2] = ((op & 4U) != 0U) ? 0xFFU : 0U;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  mask4[0] = mask[0] * 0x01010101U;
+  mask4[1] = mask[1] * 0x01010101U;
+  mask4[2] = mask[2] * 0x01010101U;
+  thr4 = __PACKq7(threshold, threshold, threshold, threshold);
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = (A op threshold) ? 0xFF : 0x00 */
+    inA4 = *__SIMD32(pSrc)++;
+
+    /* SSUB8 sets the GE flag of each byte where the difference is not negative,
+     ** SEL turns the flags into a byte mask */
+    (void) __SSUB8(inA4, thr4);
+    ge = __SEL(0xFFFFFFFFU, 0U);
+    (void) __SSUB8(thr4, inA4);
+    le = __SEL(0xFFFFFFFFU, 0U);
+
+    /* Combine the outcomes and store the 4 masks in a single write */
+    *__SIMD32(pDst)++ = (q31_t) ((~ge & mask4[0]) | (ge & le & mask4[1]) | (~le & mask4[2]));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = (A op threshold) ? 0xFF : 0x00 */
+    inA = *pSrc++;
+    *pDst++ = mask[(inA >= threshold) + (inA > threshold)];
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of compare group
+ */
@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_weighted_sum_q15.c
+ * Description:  Weighted sum of two Q15 vectors
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup fma
+ * @{
+ */
+
+/**
+ * @brief Weighted sum of two Q15 vectors.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       weightA weight of the first vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       weightB weight of the second vector
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are in 2.30 format and are added in a 64-bit accumulator, the sum
+ * is then shifted with saturation to 1.15 format.
+ * Two samples are computed at a time with the dual multiply-accumulate instruction.
+ */
+
+void arm_weighted_sum_q15(
+  q15_t * pSrcA,
+  q15_t weightA,
+  q15_t * pSrcB,
+  q15_t weightB,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+  q63_t sum;                                     /* accumulator */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+  q31_t inA, inB;                                /* packed input samples */
+  q31_t out1, out2;                              /* temporary output variables */
+  q31_t weights;                                 /* weights packed to 32 bit */
+
+  /* Weights are packed to 32 bit, to be multiplied with pairs of A and B samples */
+  weights = __PKHBT(weightA, weightB, 16);
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = A * weightA + B * weightB */
+    /* Read 2 samples of A and B */
+    inA = *__SIMD32(pSrcA)++;
+    inB = *__SIMD32(pSrcB)++;
+
+    /* Pair the samples of A and B at the same position and compute both products at once */
+    out1 = (q31_t) ((q63_t) __SMLALD(__PKHBT(inA, inB, 16), weights, 0) >> 15);
+    out2 = (q31_t) ((q63_t) __SMLALD(__PKHTB(inB, inA, 16), weights, 0) >> 15);
+
+    /* Saturate and pack the results back in their half-words */
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT(out1, 16), __SSAT(out2, 16), 16);
+
+    /* Read the next 2 samples of A and B */
+    inA = *__SIMD32(pSrcA)++;
+    inB = *__SIMD32(pSrcB)++;
+
+    out1 = (q31_t) ((q63_t) __SMLALD(__PKHBT(inA, inB, 16), weights, 0) >> 15);
+    out2 = (q31_t) ((q63_t) __SMLALD(__PKHTB(inB, inA, 16), weights, 0) >> 15);
+
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT(out1, 16), __SSAT(out2, 16), 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * weightA + B * weightB */
+    sum = (q63_t) ((q31_t) *pSrcA++ * weightA) + ((q31_t) *pSrcB++ * weightB);
+    *pDst++ = (q15_t) __SSAT((q31_t) (sum >> 15), 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of fma group
+ */
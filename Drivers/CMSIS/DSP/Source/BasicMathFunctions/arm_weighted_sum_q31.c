@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_weighted_sum_q31.c
+ * Description:  Weighted sum of two Q31 vectors
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup fma
+ * @{
+ */
+
+/**
+ * @brief  Weighted sum of one pair of Q31 samples.
+ */
+CMSIS_INLINE __STATIC_INLINE q31_t arm_weighted_sum_sample_q31(
+  q31_t inA,
+  q31_t weightA,
+  q31_t inB,
+  q31_t weightB)
+{
+  q63_t sum;
+
+  sum = (((q63_t) inA * weightA) >> 1) + (((q63_t) inB * weightB) >> 1);
+
+  return (clip_q63_to_q31(sum >> 30));
+}
+
+/**
+ * @brief Weighted sum of two Q31 vectors.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       weightA weight of the first vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       weightB weight of the second vector
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each product is in 2.62 format and is halved before the addition, the sum is
+ * then shifted with saturation to 1.31 format.
+ */
+
+void arm_weighted_sum_q31(
+  q31_t * pSrcA,
+  q31_t weightA,
+  q31_t * pSrcB,
+  q31_t weightB,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = A * weightA + B * weightB */
+    pDst[0] = arm_weighted_sum_sample_q31(pSrcA[0], weightA, pSrcB[0], weightB);
+    pDst[1] = arm_weighted_sum_sample_q31(pSrcA[1], weightA, pSrcB[1], weightB);
+    pDst[2] = arm_weighted_sum_sample_q31(pSrcA[2], weightA, pSrcB[2], weightB);
+    pDst[3] = arm_weighted_sum_sample_q31(pSrcA[3], weightA, pSrcB[3], weightB);
+
+    /* Update the pointers to process the next samples */
+    pSrcA += 4U;
+    pSrcB += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * weightA + B * weightB */
+    *pDst++ = arm_weighted_sum_sample_q31(*pSrcA++, weightA, *pSrcB++, weightB);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of fma group
+ */
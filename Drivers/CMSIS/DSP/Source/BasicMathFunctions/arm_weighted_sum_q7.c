@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_weighted_sum_q7.c
+ * Description:  Weighted sum of two Q7 vectors
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup fma
+ * @{
+ */
+
+/**
+ * @brief Weighted sum of two Q7 vectors.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       weightA weight of the first vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       weightB weight of the second vector
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are in 2.14 format and are added in a 32-bit accumulator, the sum
+ * is then shifted with saturation to 1.7 format.
+ */
+
+void arm_weighted_sum_q7(
+  q7_t * pSrcA,
+  q7_t weightA,
+  q7_t * pSrcB,
+  q7_t weightB,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+  q7_t out1, out2, out3, out4;                   /* temporary output variables */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = A * weightA + B * weightB */
+    out1 = (q7_t) __SSAT((((q15_t) pSrcA[0] * weightA) + ((q15_t) pSrcB[0] * weightB)) >> 7, 8);
+    out2 = (q7_t) __SSAT((((q15_t) pSrcA[1] * weightA) + ((q15_t) pSrcB[1] * weightB)) >> 7, 8);
+    out3 = (q7_t) __SSAT((((q15_t) pSrcA[2] * weightA) + ((q15_t) pSrcB[2] * weightB)) >> 7, 8);
+    out4 = (q7_t) __SSAT((((q15_t) pSrcA[3] * weightA) + ((q15_t) pSrcB[3] * weightB)) >> 7, 8);
+
+    /* Pack the 4 results and store them in a single write */
+    *__SIMD32(pDst)++ = __PACKq7(out1, out2, out3, out4);
+
+    /* Update the pointers to process the next samples */
+    pSrcA += 4U;
+    pSrcB += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * weightA + B * weightB */
+    *pDst++ = (q7_t) __SSAT((((q15_t) *pSrcA++ * weightA) + ((q15_t) *pSrcB++ * weightB)) >> 7, 8);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of fma group
+ */
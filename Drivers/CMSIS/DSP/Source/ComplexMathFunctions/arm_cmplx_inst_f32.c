@@ -0,0 +1,205 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_inst_f32.c
+ * Description:  Floating-point instantaneous amplitude, phase and frequency
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @defgroup cmplx_inst Complex Instantaneous Amplitude, Phase and Frequency
+ *
+ * Computes the instantaneous amplitude, phase and frequency of an analytic signal
+ * in a single pass.
+ *
+ * <pre>
+ *     pAmp[n]   = sqrt(pSrc[(2*n)+0] ^ 2 + pSrc[(2*n)+1] ^ 2);
+ *     pPhase[n] = atan2(pSrc[(2*n)+1], pSrc[(2*n)+0]);
+ *     pFreq[n]  = wrap(pPhase[n] - pPhase[n-1]) / (2 * pi);
+ * </pre>
+ *
+ * The input is the analytic signal of a real signal, such as the output of
+ * arm_hilbert_f32() or arm_analytic_f32(), in the interleaved format of the complex
+ * math functions.  The amplitude and the phase are computed as in
+ * <code>arm_cmplx_to_polar_xxx()</code>.  The frequency is the phase difference between
+ * consecutive samples, wrapped to [-pi pi), in cycles per sample: the range [-0.5 0.5)
+ * maps to [-fs/2 fs/2).
+ *
+ * The phase of the last sample is kept in <code>*pPrevPhase</code>, so that the frequency
+ * stays continuous across blocks.  Initialize it to zero, or to the phase of the sample
+ * preceding the first block.
+ *
+ * There are separate functions for floating-point and Q15 data types.
+ */
+
+/**
+ * @addtogroup cmplx_inst
+ * @{
+ */
+
+/**
+ * @brief  Floating-point magnitude and phase of one complex sample, as in arm_cmplx_to_polar_f32().
+ * @param[in]       real  real part
+ * @param[in]       imag  imaginary part
+ * @param[out]      *pMag points to the magnitude
+ * @return phase in radians.
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_cmplx_inst_polar_f32(
+  float32_t real,
+  float32_t imag,
+  float32_t * pMag)
+{
+  float32_t ax, ay;                              /* Absolute values of the real and imaginary parts */
+  float32_t r, s, a;                             /* Temporary variables */
+
+  /* Magnitude */
+  arm_sqrt_f32((real * real) + (imag * imag), pMag);
+
+  /* Reduce to the first octant: r = min(|x|, |y|) / max(|x|, |y|) in [0 1] */
+  ax = (real < 0.0f) ? -real : real;
+  ay = (imag < 0.0f) ? -imag : imag;
+  r = (ay > ax) ? (ax / ay) : ((ax > 0.0f) ? (ay / ax) : 0.0f);
+  s = r * r;
+
+  /* atan(r) with the degree 15 odd polynomial of Abramowitz and Stegun 4.4.49 */
+  a = r * (0.9999993329f + s * (-0.3332985605f + s * (0.1994653599f + s * (-0.1390853351f
+            + s * (0.0964200441f + s * (-0.0559098861f + s * (0.0218612288f + s * -0.0040540580f)))))));
+
+  /* Map the octant back to the full circle */
+  a = (ay > ax) ? (1.570796327f - a) : a;
+  a = (real < 0.0f) ? (3.141592654f - a) : a;
+
+  return ((imag < 0.0f) ? -a : a);
+}
+
+/**
+ * @brief  Frequency from two consecutive phases.
+ * @param[in]       phase phase of the sample, in radians
+ * @param[in]       prev  phase of the previous sample, in radians
+ * @return frequency in cycles per sample.
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_cmplx_inst_freq_f32(
+  float32_t phase,
+  float32_t prev)
+{
+  float32_t d = phase - prev;                    /* Phase difference in (-2 pi 2 pi) */
+
+  /* Wrap to [-pi pi) */
+  d = (d >= 3.141592654f) ? (d - 6.283185307f) : ((d < -3.141592654f) ? (d + 6.283185307f) : d);
+
+  return (d * 0.1591549431f);
+}
+
+/**
+ * @brief  Floating-point instantaneous amplitude, phase and frequency.
+ * @param[in]       *pSrc points to the complex input vector
+ * @param[out]      *pAmp points to the amplitude output vector
+ * @param[out]      *pPhase points to the phase output vector, in radians
+ * @param[out]      *pFreq points to the frequency output vector, in cycles per sample
+ * @param[in,out]   *pPrevPhase points to the phase of the sample before the block
+ * @param[in]       numSamples number of complex samples in the input vector
+ * @return none.
+ */
+
+void arm_cmplx_inst_f32(
+  float32_t * pSrc,
+  float32_t * pAmp,
+  float32_t * pPhase,
+  float32_t * pFreq,
+  float32_t * pPrevPhase,
+  uint32_t numSamples)
+{
+  float32_t prev = *pPrevPhase;                  /* Phase of the previous sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = numSamples >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C[0] = |A[0]|, D[0] = arg(A[0]), E[0] = (D[0] - D[-1]) / (2 pi) */
+    pPhase[0] = arm_cmplx_inst_polar_f32(pSrc[0], pSrc[1], &pAmp[0]);
+    pPhase[1] = arm_cmplx_inst_polar_f32(pSrc[2], pSrc[3], &pAmp[1]);
+    pPhase[2] = arm_cmplx_inst_polar_f32(pSrc[4], pSrc[5], &pAmp[2]);
+    pPhase[3] = arm_cmplx_inst_polar_f32(pSrc[6], pSrc[7], &pAmp[3]);
+
+    pFreq[0] = arm_cmplx_inst_freq_f32(pPhase[0], prev);
+    pFreq[1] = arm_cmplx_inst_freq_f32(pPhase[1], pPhase[0]);
+    pFreq[2] = arm_cmplx_inst_freq_f32(pPhase[2], pPhase[1]);
+    pFreq[3] = arm_cmplx_inst_freq_f32(pPhase[3], pPhase[2]);
+    prev = pPhase[3];
+
+    /* Update the pointers to process the next samples */
+    pSrc += 8U;
+    pAmp += 4U;
+    pPhase += 4U;
+    pFreq += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over numSamples number of values */
+  blkCnt = numSamples;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C[0] = |A[0]|, D[0] = arg(A[0]), E[0] = (D[0] - D[-1]) / (2 pi) */
+    *pPhase = arm_cmplx_inst_polar_f32(pSrc[0], pSrc[1], pAmp++);
+    *pFreq++ = arm_cmplx_inst_freq_f32(*pPhase, prev);
+    prev = *pPhase++;
+
+    pSrc += 2U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  *pPrevPhase = prev;
+}
+
+/**
+ * @} end of cmplx_inst group
+ */
@@ -0,0 +1,191 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_inst_q15.c
+ * Description:  Q15 instantaneous amplitude, phase and frequency
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_inst
+ * @{
+ */
+
+/* Odd polynomial of atan(r) / pi on [0 1], Abramowitz and Stegun 4.4.47, in 1.31 format, as in arm_cmplx_to_polar_q15() */
+static const q31_t arm_cmplx_inst_coef_q15[5] =
+{
+  683473678, -225781269, 123138132, -58193963, 14242151
+};
+
+/**
+ * @brief  Q15 magnitude and phase of one complex sample, as in arm_cmplx_to_polar_q15().
+ * @param[in]       real  real part
+ * @param[in]       imag  imaginary part
+ * @param[out]      *pMag points to the magnitude, in 2.14 format
+ * @return phase divided by pi.
+ */
+CMSIS_INLINE __STATIC_INLINE q15_t arm_cmplx_inst_polar_q15(
+  q15_t real,
+  q15_t imag,
+  q15_t * pMag)
+{
+  q31_t ax, ay, mx, mn;                          /* Absolute values, their maximum and minimum */
+  q31_t r, s, acc;                               /* Ratio, its square and accumulator */
+  int32_t i;                                     /* Loop counter */
+
+  /* Magnitude in 2.14 format */
+  arm_sqrt_q15((q15_t) (((q63_t) (real * real) + (imag * imag)) >> 17), pMag);
+
+  ax = (real > 0) ? real : -(q31_t) real;
+  ay = (imag > 0) ? imag : -(q31_t) imag;
+  mx = (ay > ax) ? ay : ax;
+  mn = (ay > ax) ? ax : ay;
+
+  if (mx == 0)
+  {
+    return (0);
+  }
+
+  /* r = mn / mx in [0 1] in 1.31 format, from a 16-bit quotient (hardware divide on Cortex-M3 and above) */
+  r = clip_q63_to_q31((q63_t) ((mn << 16) / mx) << 15);
+  s = (q31_t) (((q63_t) r * r) >> 31);
+
+  /* atan(r) / pi in [0 0.25], Horner evaluation in r^2 */
+  acc = arm_cmplx_inst_coef_q15[4];
+  for (i = 3; i >= 0; i--)
+  {
+    acc = (q31_t) (((q63_t) acc * s) >> 31) + arm_cmplx_inst_coef_q15[i];
+  }
+  acc = (q31_t) (((q63_t) acc * r) >> 31);
+
+  /* Round to 1.15 format */
+  acc = (acc + 0x8000) >> 16;
+
+  /* Map the octant back to the full circle, pi saturating to 0x7FFF */
+  acc = (ay > ax) ? (0x4000 - acc) : acc;
+  acc = (real < 0) ? (0x8000 - acc) : acc;
+  acc = (acc > 0x7FFF) ? 0x7FFF : acc;
+
+  return ((q15_t) ((imag < 0) ? -acc : acc));
+}
+
+/**
+ * @brief  Q15 instantaneous amplitude, phase and frequency.
+ * @param[in]       *pSrc points to the complex input vector
+ * @param[out]      *pAmp points to the amplitude output vector, in 2.14 format
+ * @param[out]      *pPhase points to the phase output vector, divided by pi
+ * @param[out]      *pFreq points to the frequency output vector, in 1.15 format
+ * @param[in,out]   *pPrevPhase points to the phase of the sample before the block, divided by pi
+ * @param[in]       numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The inputs are in 1.15 format.  The amplitudes are in 2.14 format, as in arm_cmplx_mag_q15(),
+ * and the phases are divided by pi, as in arm_cmplx_to_polar_q15().  The frequency is the
+ * difference of the phases, wrapped by the 16-bit arithmetic: it is twice the frequency in
+ * cycles per sample, so that the range [-1 +1) maps to [-fs/2 fs/2).
+ */
+
+void arm_cmplx_inst_q15(
+  q15_t * pSrc,
+  q15_t * pAmp,
+  q15_t * pPhase,
+  q15_t * pFreq,
+  q15_t * pPrevPhase,
+  uint32_t numSamples)
+{
+  q15_t prev = *pPrevPhase;                      /* Phase of the previous sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = numSamples >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C[0] = |A[0]|, D[0] = arg(A[0]) / pi, E[0] = D[0] - D[-1] modulo 2 */
+    pPhase[0] = arm_cmplx_inst_polar_q15(pSrc[0], pSrc[1], &pAmp[0]);
+    pPhase[1] = arm_cmplx_inst_polar_q15(pSrc[2], pSrc[3], &pAmp[1]);
+    pPhase[2] = arm_cmplx_inst_polar_q15(pSrc[4], pSrc[5], &pAmp[2]);
+    pPhase[3] = arm_cmplx_inst_polar_q15(pSrc[6], pSrc[7], &pAmp[3]);
+
+    pFreq[0] = (q15_t) (pPhase[0] - prev);
+    pFreq[1] = (q15_t) (pPhase[1] - pPhase[0]);
+    pFreq[2] = (q15_t) (pPhase[2] - pPhase[1]);
+    pFreq[3] = (q15_t) (pPhase[3] - pPhase[2]);
+    prev = pPhase[3];
+
+    /* Update the pointers to process the next samples */
+    pSrc += 8U;
+    pAmp += 4U;
+    pPhase += 4U;
+    pFreq += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over numSamples number of values */
+  blkCnt = numSamples;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C[0] = |A[0]|, D[0] = arg(A[0]) / pi, E[0] = D[0] - D[-1] modulo 2 */
+    *pPhase = arm_cmplx_inst_polar_q15(pSrc[0], pSrc[1], pAmp++);
+    *pFreq++ = (q15_t) (*pPhase - prev);
+    prev = *pPhase++;
+
+    pSrc += 2U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  *pPrevPhase = prev;
+}
+
+/**
+ * @} end of cmplx_inst group
+ */
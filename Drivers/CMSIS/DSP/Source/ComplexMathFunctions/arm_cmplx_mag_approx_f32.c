@@ -0,0 +1,191 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_mag_approx_f32.c
+ * Description:  Approximate floating-point complex magnitude
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @defgroup cmplx_mag_approx Approximate Complex Magnitude
+ *
+ * Computes an approximation of the magnitude of the elements of a complex data vector,
+ * without a square root.
+ *
+ * The <code>pSrc</code> points to the source data and
+ * <code>pDst</code> points to the where the result should be written.
+ * <code>numSamples</code> specifies the number of complex samples
+ * in the input array and the data is stored in an interleaved fashion
+ * (real, imag, real, imag, ...).
+ * The input array has a total of <code>2*numSamples</code> values;
+ * the output array has a total of <code>numSamples</code> values.
+ *
+ * With <code>mx = max(|real|, |imag|)</code> and <code>mn = min(|real|, |imag|)</code>,
+ * the <code>accuracy</code> argument selects one of the estimates:
+ *
+ * - ::ARM_CMPLX_MAG_APPROX_FAST, the alpha max plus beta min estimate
+ *   <pre>
+ *     e = 0.96043387 * mx + 0.39782473 * mn
+ *   </pre>
+ *   The maximum relative error is 3.96%.
+ * - ::ARM_CMPLX_MAG_APPROX_MEDIUM, the larger of two such estimates
+ *   <pre>
+ *     e = max(0.99032489 * mx + 0.19683025 * mn, 0.83953533 * mx + 0.56095957 * mn)
+ *   </pre>
+ *   The maximum relative error is 0.97%.
+ * - ::ARM_CMPLX_MAG_APPROX_NEWTON, the medium estimate refined with one Newton-Raphson
+ *   iteration of the square root of the power
+ *   <pre>
+ *     e' = (e + (real * real + imag * imag) / e) / 2
+ *   </pre>
+ *   The maximum relative error is 4.8e-5, and the estimate is never below the magnitude.
+ *
+ * The fixed-point versions add the rounding error of their output format to these errors.
+ *
+ * The fast and medium estimates only need multiplications and comparisons, so they
+ * suit peak pickers and detectors that compare magnitudes.  The outputs are in the same
+ * formats as the outputs of <code>arm_cmplx_mag_xxx()</code>.
+ *
+ * There are separate functions for floating-point, Q31, and Q15 data types.
+ */
+
+/**
+ * @addtogroup cmplx_mag_approx
+ * @{
+ */
+
+/**
+ * @brief  Floating-point approximate magnitude of one complex sample.
+ * @param[in]       real     real part
+ * @param[in]       imag     imaginary part
+ * @param[in]       accuracy selects the estimate
+ * @return approximate magnitude.
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_cmplx_mag_approx_sample_f32(
+  float32_t real,
+  float32_t imag,
+  arm_cmplx_mag_accuracy accuracy)
+{
+  float32_t ax, ay, mx, mn;                      /* Absolute values, their maximum and minimum */
+  float32_t e0, e1;                              /* Estimates */
+
+  ax = (real < 0.0f) ? -real : real;
+  ay = (imag < 0.0f) ? -imag : imag;
+  mx = (ay > ax) ? ay : ax;
+  mn = (ay > ax) ? ax : ay;
+
+  if (accuracy == ARM_CMPLX_MAG_APPROX_FAST)
+  {
+    return (0.960433870f * mx + 0.397824735f * mn);
+  }
+
+  /* Two segment estimate */
+  e0 = 0.990324893f * mx + 0.196830252f * mn;
+  e1 = 0.839535330f * mx + 0.560959573f * mn;
+  e0 = (e1 > e0) ? e1 : e0;
+
+  if ((accuracy == ARM_CMPLX_MAG_APPROX_NEWTON) && (e0 > 0.0f))
+  {
+    /* One Newton-Raphson iteration of sqrt(real * real + imag * imag) */
+    e0 = 0.5f * (e0 + ((real * real) + (imag * imag)) / e0);
+  }
+
+  return (e0);
+}
+
+/**
+ * @brief  Floating-point approximate complex magnitude.
+ * @param[in]       *pSrc points to the complex input vector
+ * @param[in]       accuracy selects the estimate, see ::arm_cmplx_mag_accuracy
+ * @param[out]      *pDst points to the real output vector
+ * @param[in]       numSamples number of complex samples in the input vector
+ * @return none.
+ */
+
+void arm_cmplx_mag_approx_f32(
+  float32_t * pSrc,
+  arm_cmplx_mag_accuracy accuracy,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = numSamples >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C[0] ~= sqrt(A[0] * A[0] + A[1] * A[1]) */
+    pDst[0] = arm_cmplx_mag_approx_sample_f32(pSrc[0], pSrc[1], accuracy);
+    pDst[1] = arm_cmplx_mag_approx_sample_f32(pSrc[2], pSrc[3], accuracy);
+    pDst[2] = arm_cmplx_mag_approx_sample_f32(pSrc[4], pSrc[5], accuracy);
+    pDst[3] = arm_cmplx_mag_approx_sample_f32(pSrc[6], pSrc[7], accuracy);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 8U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over numSamples number of values */
+  blkCnt = numSamples;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C[0] ~= sqrt(A[0] * A[0] + A[1] * A[1]) */
+    *pDst++ = arm_cmplx_mag_approx_sample_f32(pSrc[0], pSrc[1], accuracy);
+
+    pSrc += 2U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag_approx group
+ */
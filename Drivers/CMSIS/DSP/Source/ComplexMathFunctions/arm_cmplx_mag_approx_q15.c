@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_mag_approx_q15.c
+ * Description:  Approximate Q15 complex magnitude
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag_approx
+ * @{
+ */
+
+/**
+ * @brief  Q15 approximate magnitude of one complex sample.
+ * @param[in]       real     real part
+ * @param[in]       imag     imaginary part
+ * @param[in]       accuracy selects the estimate
+ * @return approximate magnitude in 2.14 format.
+ */
+CMSIS_INLINE __STATIC_INLINE q15_t arm_cmplx_mag_approx_sample_q15(
+  q15_t real,
+  q15_t imag,
+  arm_cmplx_mag_accuracy accuracy)
+{
+  q31_t ax, ay, mx, mn;                          /* Absolute values, their maximum and minimum */
+  q31_t e0, e1;                                  /* Estimates in 2.30 format */
+  q31_t delta;                                   /* Power error */
+
+  ax = (real > 0) ? real : -(q31_t) real;
+  ay = (imag > 0) ? imag : -(q31_t) imag;
+  mx = (ay > ax) ? ay : ax;
+  mn = (ay > ax) ? ax : ay;
+
+  if (accuracy == ARM_CMPLX_MAG_APPROX_FAST)
+  {
+    return ((q15_t) ((mx * 31471 + mn * 13036) >> 16));
+  }
+
+  /* Two segment estimate */
+  e0 = mx * 32451 + mn * 6450;
+  e1 = mx * 27510 + mn * 18382;
+  e0 = (e1 > e0) ? e1 : e0;
+
+  /* The iteration is skipped when the estimate is below 1 in 1.15 format, which only
+     happens for the inputs of magnitude 1 and 0 */
+  if ((accuracy == ARM_CMPLX_MAG_APPROX_NEWTON) && (e0 >= 0x8000))
+  {
+    /* One Newton-Raphson iteration in 1.15 format: e0 += delta / (2 * e0),
+       the quotient from an integer division (hardware divide on Cortex-M3 and above) */
+    e0 = e0 >> 15;
+    delta = (q31_t) (((uint32_t) (mx * mx) + (uint32_t) (mn * mn)) - (uint32_t) (e0 * e0));
+    e0 += delta / (2 * e0);
+
+    return ((q15_t) (e0 >> 1));
+  }
+
+  return ((q15_t) (e0 >> 16));
+}
+
+/**
+ * @brief  Q15 approximate complex magnitude.
+ * @param[in]       *pSrc points to the complex input vector
+ * @param[in]       accuracy selects the estimate, see ::arm_cmplx_mag_accuracy
+ * @param[out]      *pDst points to the real output vector
+ * @param[in]       numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The inputs are in 1.15 format and the output is in 2.14 format, as in arm_cmplx_mag_q15().
+ */
+
+void arm_cmplx_mag_approx_q15(
+  q15_t * pSrc,
+  arm_cmplx_mag_accuracy accuracy,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = numSamples >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C[0] ~= sqrt(A[0] * A[0] + A[1] * A[1]) */
+    pDst[0] = arm_cmplx_mag_approx_sample_q15(pSrc[0], pSrc[1], accuracy);
+    pDst[1] = arm_cmplx_mag_approx_sample_q15(pSrc[2], pSrc[3], accuracy);
+    pDst[2] = arm_cmplx_mag_approx_sample_q15(pSrc[4], pSrc[5], accuracy);
+    pDst[3] = arm_cmplx_mag_approx_sample_q15(pSrc[6], pSrc[7], accuracy);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 8U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over numSamples number of values */
+  blkCnt = numSamples;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C[0] ~= sqrt(A[0] * A[0] + A[1] * A[1]) */
+    *pDst++ = arm_cmplx_mag_approx_sample_q15(pSrc[0], pSrc[1], accuracy);
+
+    pSrc += 2U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag_approx group
+ */
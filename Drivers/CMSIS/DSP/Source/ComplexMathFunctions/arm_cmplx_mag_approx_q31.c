@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_mag_approx_q31.c
+ * Description:  Approximate Q31 complex magnitude
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag_approx
+ * @{
+ */
+
+/**
+ * @brief  Q31 approximate magnitude of one complex sample.
+ * @param[in]       real     real part
+ * @param[in]       imag     imaginary part
+ * @param[in]       accuracy selects the estimate
+ * @return approximate magnitude in 2.30 format.
+ */
+CMSIS_INLINE __STATIC_INLINE q31_t arm_cmplx_mag_approx_sample_q31(
+  q31_t real,
+  q31_t imag,
+  arm_cmplx_mag_accuracy accuracy)
+{
+  q31_t ax, ay, mx, mn;                          /* Absolute values in 2.30 format, their maximum and minimum */
+  q31_t e0, e1;                                  /* Estimates */
+  q31_t delta, inv;                              /* Power error and reciprocal of the estimate */
+  q63_t pwr;                                     /* Power */
+  uint32_t norm, shift;                          /* Normalization and exponent of the reciprocal */
+
+  ax = real >> 1;
+  ay = imag >> 1;
+  ax = (ax > 0) ? ax : -ax;
+  ay = (ay > 0) ? ay : -ay;
+  mx = (ay > ax) ? ay : ax;
+  mn = (ay > ax) ? ax : ay;
+
+  if (accuracy == ARM_CMPLX_MAG_APPROX_FAST)
+  {
+    return ((q31_t) (((q63_t) mx * 0x7AEF7F3F + (q63_t) mn * 0x32EBEBC1) >> 31));
+  }
+
+  if (accuracy == ARM_CMPLX_MAG_APPROX_MEDIUM)
+  {
+    e0 = (q31_t) (((q63_t) mx * 0x7EC2F752 + (q63_t) mn * 0x1931BBD3) >> 31);
+    e1 = (q31_t) (((q63_t) mx * 0x6B75E4CA + (q63_t) mn * 0x47CD85F7) >> 31);
+
+    return ((e1 > e0) ? e1 : e0);
+  }
+
+  if (mx == 0)
+  {
+    return (0);
+  }
+
+  /* Normalize mx to [0.5 1) in 1.31 format, so that the Newton-Raphson iteration keeps its precision */
+  norm = __CLZ(mx) - 1U;
+  mx = mx << norm;
+  mn = mn << norm;
+
+  /* Two segment estimate of the halved magnitude, in 1.31 format */
+  e0 = (q31_t) (((q63_t) mx * 0x7EC2F752 + (q63_t) mn * 0x1931BBD3) >> 32);
+  e1 = (q31_t) (((q63_t) mx * 0x6B75E4CA + (q63_t) mn * 0x47CD85F7) >> 32);
+  e0 = (e1 > e0) ? e1 : e0;
+
+  /* Error of the estimate on the halved power, in 2.30 format */
+  pwr = (((q63_t) mx * mx) >> 2) + (((q63_t) mn * mn) >> 2);
+  delta = (q31_t) ((pwr - (q63_t) e0 * e0) >> 30);
+
+  /* One Newton-Raphson iteration: e0 += delta / (2 * e0) */
+  shift = arm_recip_q31(e0, &inv, (q31_t *) armRecipTableQ31);
+  e0 += (q31_t) (((q63_t) delta * inv) >> (33U - shift));
+
+  /* Back to the 2.30 format of the input scale */
+  return ((q31_t) (((q63_t) e0 << 1) >> norm));
+}
+
+/**
+ * @brief  Q31 approximate complex magnitude.
+ * @param[in]       *pSrc points to the complex input vector
+ * @param[in]       accuracy selects the estimate, see ::arm_cmplx_mag_accuracy
+ * @param[out]      *pDst points to the real output vector
+ * @param[in]       numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The inputs are in 1.31 format and the output is in 2.30 format, as in arm_cmplx_mag_q31().
+ * The Newton-Raphson iteration uses arm_recip_q31() for the division.
+ */
+
+void arm_cmplx_mag_approx_q31(
+  q31_t * pSrc,
+  arm_cmplx_mag_accuracy accuracy,
+  q31_t * pDst,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = numSamples >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C[0] ~= sqrt(A[0] * A[0] + A[1] * A[1]) */
+    pDst[0] = arm_cmplx_mag_approx_sample_q31(pSrc[0], pSrc[1], accuracy);
+    pDst[1] = arm_cmplx_mag_approx_sample_q31(pSrc[2], pSrc[3], accuracy);
+    pDst[2] = arm_cmplx_mag_approx_sample_q31(pSrc[4], pSrc[5], accuracy);
+    pDst[3] = arm_cmplx_mag_approx_sample_q31(pSrc[6], pSrc[7], accuracy);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 8U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over numSamples number of values */
+  blkCnt = numSamples;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C[0] ~= sqrt(A[0] * A[0] + A[1] * A[1]) */
+    *pDst++ = arm_cmplx_mag_approx_sample_q31(pSrc[0], pSrc[1], accuracy);
+
+    pSrc += 2U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag_approx group
+ */
@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_to_polar_f32.c
+ * Description:  Floating-point complex cartesian to polar conversion
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @defgroup cmplx_to_polar Complex Cartesian to Polar
+ *
+ * Computes the magnitude and the phase of the elements of a complex data vector
+ * in a single pass.
+ *
+ * <pre>
+ *     pMag[n]   = sqrt(pSrc[(2*n)+0] ^ 2 + pSrc[(2*n)+1] ^ 2);
+ *     pPhase[n] = atan2(pSrc[(2*n)+1], pSrc[(2*n)+0]);
+ * </pre>
+ *
+ * The input array has a total of <code>2*numSamples</code> values, stored in an
+ * interleaved fashion (real, imag, real, imag, ...), and each output array has a
+ * total of <code>numSamples</code> values.
+ *
+ * The magnitude is computed as in <code>arm_cmplx_mag_xxx()</code> and the phase with
+ * the same approximations as <code>arm_vatan2_xxx()</code>, with the same accuracy.
+ * A single call avoids splitting the interleaved input into separate real and
+ * imaginary vectors for <code>arm_vatan2_xxx()</code>.
+ * The fixed-point phases are divided by pi, in the range [-1 +1).
+ *
+ * There are separate functions for floating-point, Q31, and Q15 data types.
+ */
+
+/**
+ * @addtogroup cmplx_to_polar
+ * @{
+ */
+
+/**
+ * @brief  Floating-point magnitude and phase of one complex sample.
+ * @param[in]       real  real part
+ * @param[in]       imag  imaginary part
+ * @param[out]      *pMag points to the magnitude
+ * @return phase in radians.
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_cmplx_to_polar_sample_f32(
+  float32_t real,
+  float32_t imag,
+  float32_t * pMag)
+{
+  float32_t ax, ay;                              /* Absolute values of the real and imaginary parts */
+  float32_t r, s, a;                             /* Temporary variables */
+
+  /* Magnitude */
+  arm_sqrt_f32((real * real) + (imag * imag), pMag);
+
+  /* Reduce to the first octant: r = min(|x|, |y|) / max(|x|, |y|) in [0 1] */
+  ax = (real < 0.0f) ? -real : real;
+  ay = (imag < 0.0f) ? -imag : imag;
+  r = (ay > ax) ? (ax / ay) : ((ax > 0.0f) ? (ay / ax) : 0.0f);
+  s = r * r;
+
+  /* atan(r) with the degree 15 odd polynomial of Abramowitz and Stegun 4.4.49 */
+  a = r * (0.9999993329f + s * (-0.3332985605f + s * (0.1994653599f + s * (-0.1390853351f
+            + s * (0.0964200441f + s * (-0.0559098861f + s * (0.0218612288f + s * -0.0040540580f)))))));
+
+  /* Map the octant back to the full circle */
+  a = (ay > ax) ? (1.570796327f - a) : a;
+  a = (real < 0.0f) ? (3.141592654f - a) : a;
+
+  return ((imag < 0.0f) ? -a : a);
+}
+
+/**
+ * @brief  Floating-point complex cartesian to polar conversion.
+ * @param[in]       *pSrc points to the complex input vector
+ * @param[out]      *pMag points to the magnitude output vector
+ * @param[out]      *pPhase points to the phase output vector, in radians
+ * @param[in]       numSamples number of complex samples in the input vector
+ * @return none.
+ */
+
+void arm_cmplx_to_polar_f32(
+  float32_t * pSrc,
+  float32_t * pMag,
+  float32_t * pPhase,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = numSamples >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C[0] = sqrt(A[0] * A[0] + A[1] * A[1]), D[0] = atan2(A[1], A[0]) */
+    pPhase[0] = arm_cmplx_to_polar_sample_f32(pSrc[0], pSrc[1], &pMag[0]);
+    pPhase[1] = arm_cmplx_to_polar_sample_f32(pSrc[2], pSrc[3], &pMag[1]);
+    pPhase[2] = arm_cmplx_to_polar_sample_f32(pSrc[4], pSrc[5], &pMag[2]);
+    pPhase[3] = arm_cmplx_to_polar_sample_f32(pSrc[6], pSrc[7], &pMag[3]);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 8U;
+    pMag += 4U;
+    pPhase += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over numSamples number of values */
+  blkCnt = numSamples;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C[0] = sqrt(A[0] * A[0] + A[1] * A[1]), D[0] = atan2(A[1], A[0]) */
+    *pPhase++ = arm_cmplx_to_polar_sample_f32(pSrc[0], pSrc[1], pMag++);
+
+    pSrc += 2U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_to_polar group
+ */
@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_to_polar_q31.c
+ * Description:  Q31 complex cartesian to polar conversion
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_to_polar
+ * @{
+ */
+
+/* Odd minimax polynomial of atan(r) / pi on [0 1], degree 17, in 1.31 format, as in arm_vatan2_q31() */
+static const q31_t arm_cmplx_to_polar_coef_q31[9] =
+{
+  683565198, -227850059, 136616719, -96801248, 71767157, -49454988, 27193080, -9844278,
+  1679334
+};
+
+/**
+ * @brief  Q31 magnitude and phase of one complex sample.
+ * @param[in]       real  real part
+ * @param[in]       imag  imaginary part
+ * @param[out]      *pMag points to the magnitude, in 2.30 format
+ * @return phase divided by pi.
+ */
+CMSIS_INLINE __STATIC_INLINE q31_t arm_cmplx_to_polar_sample_q31(
+  q31_t real,
+  q31_t imag,
+  q31_t * pMag)
+{
+  q31_t ax, ay, mx, mn;                          /* Absolute values, their maximum and minimum */
+  q31_t inv, r, s, acc;                          /* Reciprocal of mx, ratio, its square and accumulator */
+  uint32_t tempVal;                              /* Newton-Raphson temporary */
+  uint32_t shift;                                /* Exponent of the reciprocal */
+  int32_t i;                                     /* Loop counter */
+
+  /* Magnitude in 2.30 format */
+  acc = (q31_t) (((q63_t) real * real) >> 33) + (q31_t) (((q63_t) imag * imag) >> 33);
+  arm_sqrt_q31(acc, pMag);
+
+  ax = (real > 0) ? real : __QSUB(0, real);
+  ay = (imag > 0) ? imag : __QSUB(0, imag);
+  mx = (ay > ax) ? ay : ax;
+  mn = (ay > ax) ? ax : ay;
+
+  if (mx == 0)
+  {
+    return (0);
+  }
+
+  /* 1 / mx from arm_recip_q31(), refined with a third Newton-Raphson iteration */
+  shift = arm_recip_q31(mx, &inv, (q31_t *) armRecipTableQ31);
+  tempVal = (uint32_t) (((q63_t) (mx << (shift - 1U)) * inv) >> 31);
+  tempVal = 0x7FFFFFFFU - tempVal;
+  inv = clip_q63_to_q31(((q63_t) inv * tempVal) >> 30);
+
+  /* r = mn / mx in [0 1] */
+  r = clip_q63_to_q31(((q63_t) mn * inv) >> (31U - shift));
+  s = (q31_t) (((q63_t) r * r) >> 31);
+
+  /* atan(r) / pi in [0 0.25], Horner evaluation in r^2 */
+  acc = arm_cmplx_to_polar_coef_q31[8];
+  for (i = 7; i >= 0; i--)
+  {
+    acc = (q31_t) (((q63_t) acc * s) >> 31) + arm_cmplx_to_polar_coef_q31[i];
+  }
+  acc = (q31_t) (((q63_t) acc * r) >> 31);
+
+  /* Map the octant back to the full circle, pi saturating to 0x7FFFFFFF */
+  acc = (ay > ax) ? (0x40000000 - acc) : acc;
+  acc = (real < 0) ? clip_q63_to_q31((q63_t) 0x80000000 - acc) : acc;
+
+  return ((imag < 0) ? -acc : acc);
+}
+
+/**
+ * @brief  Q31 complex cartesian to polar conversion.
+ * @param[in]       *pSrc points to the complex input vector
+ * @param[out]      *pMag points to the magnitude output vector
+ * @param[out]      *pPhase points to the phase output vector, divided by pi
+ * @param[in]       numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The inputs are in 1.31 format.  The magnitudes are in 2.30 format, as in arm_cmplx_mag_q31(),
+ * and the phases are divided by pi, as in arm_vatan2_q31().
+ */
+
+void arm_cmplx_to_polar_q31(
+  q31_t * pSrc,
+  q31_t * pMag,
+  q31_t * pPhase,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = numSamples >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C[0] = sqrt(A[0] * A[0] + A[1] * A[1]), D[0] = atan2(A[1], A[0]) / pi */
+    pPhase[0] = arm_cmplx_to_polar_sample_q31(pSrc[0], pSrc[1], &pMag[0]);
+    pPhase[1] = arm_cmplx_to_polar_sample_q31(pSrc[2], pSrc[3], &pMag[1]);
+    pPhase[2] = arm_cmplx_to_polar_sample_q31(pSrc[4], pSrc[5], &pMag[2]);
+    pPhase[3] = arm_cmplx_to_polar_sample_q31(pSrc[6], pSrc[7], &pMag[3]);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 8U;
+    pMag += 4U;
+    pPhase += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over numSamples number of values */
+  blkCnt = numSamples;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C[0] = sqrt(A[0] * A[0] + A[1] * A[1]), D[0] = atan2(A[1], A[0]) / pi */
+    *pPhase++ = arm_cmplx_to_polar_sample_q31(pSrc[0], pSrc[1], pMag++);
+
+    pSrc += 2U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_to_polar group
+ */
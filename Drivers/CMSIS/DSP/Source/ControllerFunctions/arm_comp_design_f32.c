@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_comp_design_f32.c
+ * Description:  2P2Z and 3P3Z compensator design from poles and zeros
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup Compensator
+ * @{
+ */
+
+/**
+ * @brief  Computes the coefficients of a 2P2Z or 3P3Z compensator from its poles and zeros.
+ * @param[in]  order    compensator order, 2 or 3.
+ * @param[in]  gain     integrator gain, in rad/s.
+ * @param[in]  *pZeros  points to the order - 1 zero frequencies, in Hz.
+ * @param[in]  *pPoles  points to the order - 1 pole frequencies, in Hz.
+ * @param[in]  fs       sampling frequency, in Hz.
+ * @param[out] *pCoeffs points to the 2 * order + 1 coefficients {b0, .., b[order], a1, .., a[order]}.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the order is
+ * not 2 or 3 or if a frequency is not positive.
+ *
+ * \par Description:
+ * The analog compensator
+ * <pre>
+ *              gain   (1 + s / wz1) (1 + s / wz2)
+ *     H(s) =  ----- * ---------------------------
+ *               s     (1 + s / wp1) (1 + s / wp2)  </pre>
+ * is mapped with the bilinear transform <code>s = 2 * fs * (1 - z^-1) / (1 + z^-1)</code>.
+ * The pole at the origin is mapped to <code>z = 1</code> and the zero at infinity to
+ * <code>z = -1</code>.  The frequencies are not prewarped: the poles and zeros below
+ * <code>fs / 10</code> move down by at most 3 percent, and those above <code>fs / 10</code>
+ * move down by more.
+ *
+ * \par
+ * The feedback coefficients are negated, as expected by the process functions.
+ */
+
+arm_status arm_comp_design_f32(
+  uint32_t order,
+  float32_t gain,
+  const float32_t * pZeros,
+  const float32_t * pPoles,
+  float32_t fs,
+  float32_t * pCoeffs)
+{
+  float32_t num[4], den[4];                      /* Polynomials in z^-1 */
+  float32_t c = 2.0f * fs;                       /* Bilinear transform constant */
+  float32_t k, p0, p1;                           /* Factor (p0 + p1 * z^-1) */
+  uint32_t i, j, deg;                            /* Loop counters and current degree */
+
+  if ((order < 2U) || (order > 3U) || (fs <= 0.0f))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* gain / s = (gain / c) * (1 + z^-1) / (1 - z^-1) */
+  num[0] = gain / c;
+  num[1] = gain / c;
+  den[0] = 1.0f;
+  den[1] = -1.0f;
+  deg = 1U;
+
+  for (i = 0U; i < (order - 1U); i++)
+  {
+    if ((pZeros[i] <= 0.0f) || (pPoles[i] <= 0.0f))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* (1 + s / wz) = ((1 + c / wz) + (1 - c / wz) * z^-1) / (1 + z^-1) */
+    k = c / (2.0f * PI * pZeros[i]);
+    p0 = 1.0f + k;
+    p1 = 1.0f - k;
+    num[deg + 1U] = p1 * num[deg];
+    for (j = deg; j > 0U; j--)
+    {
+      num[j] = (p0 * num[j]) + (p1 * num[j - 1U]);
+    }
+    num[0] = p0 * num[0];
+
+    /* 1 / (1 + s / wp), the (1 + z^-1) factors cancel */
+    k = c / (2.0f * PI * pPoles[i]);
+    p0 = 1.0f + k;
+    p1 = 1.0f - k;
+    den[deg + 1U] = p1 * den[deg];
+    for (j = deg; j > 0U; j--)
+    {
+      den[j] = (p0 * den[j]) + (p1 * den[j - 1U]);
+    }
+    den[0] = p0 * den[0];
+
+    deg++;
+  }
+
+  /* Normalize with den[0] and negate the feedback coefficients */
+  k = 1.0f / den[0];
+  for (j = 0U; j <= order; j++)
+  {
+    pCoeffs[j] = num[j] * k;
+  }
+  for (j = 1U; j <= order; j++)
+  {
+    pCoeffs[order + j] = -den[j] * k;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Compensator group
+ */
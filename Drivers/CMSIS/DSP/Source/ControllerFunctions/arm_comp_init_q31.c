@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_comp_init_q31.c
+ * Description:  Q31 2P2Z and 3P3Z compensator initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup Compensator
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 compensators.
+ * @param[out] *S        points to an instance of the Q31 compensator structure.
+ * @param[in]  order     compensator order, 2 or 3.
+ * @param[in]  *pCoeffs  points to the 2 * order + 1 coefficients {b0, .., b[order], a1, .., a[order]}.
+ * @param[in]  postShift shift applied to the coefficients.
+ * @param[in]  outMin    lower output limit.
+ * @param[in]  outMax    upper output limit.
+ * @return none.
+ * \par Description:
+ * The coefficients are in 1.31 format and are multiplied by <code>2^postShift</code>.
+ * They are copied into the instance, which can then be used with the 2P2Z function
+ * for an order of 2 and with the 3P3Z function for an order of 3.
+ * The function also clears the state.
+ */
+
+void arm_comp_init_q31(
+  arm_comp_instance_q31 * S,
+  uint32_t order,
+  const q31_t * pCoeffs,
+  uint8_t postShift,
+  q31_t outMin,
+  q31_t outMax)
+{
+  uint32_t i;
+
+  /* Clear the coefficients not used by the 2P2Z form */
+  memset(S->coeffs, 0, 7U * sizeof(q31_t));
+
+  /* Copy {b0, .., b[order]} and {a1, .., a[order]} */
+  for (i = 0U; i <= order; i++)
+  {
+    S->coeffs[i] = pCoeffs[i];
+  }
+  for (i = 1U; i <= order; i++)
+  {
+    S->coeffs[3U + i] = pCoeffs[order + i];
+  }
+
+  S->postShift = postShift;
+  S->outMin = outMin;
+  S->outMax = outMax;
+
+  arm_comp_reset_q31(S);
+}
+
+/**
+ * @} end of Compensator group
+ */
@@ -0,0 +1,53 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_comp_reset_q31.c
+ * Description:  Q31 2P2Z and 3P3Z compensator reset function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup Compensator
+ * @{
+ */
+
+/**
+ * @brief  Reset function for the Q31 compensators.
+ * @param[in,out] *S points to an instance of the Q31 compensator structure.
+ * @return none.
+ * \par Description:
+ * The function clears the state.  The coefficients and the limits are not changed.
+ */
+
+void arm_comp_reset_q31(
+  arm_comp_instance_q31 * S)
+{
+  /* Clear the input and output history, the size is always 6 samples */
+  memset(S->state, 0, 6U * sizeof(q31_t));
+}
+
+/**
+ * @} end of Compensator group
+ */
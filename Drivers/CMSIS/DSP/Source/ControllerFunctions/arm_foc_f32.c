@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_foc_f32.c
+ * Description:  Floating-point field oriented control step
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup FOC Field Oriented Control Step
+ *
+ * Runs the current control of a three-phase motor for one PWM period in a single call:
+ *  -# sine and cosine of the electrical rotor angle
+ *  -# Clarke and Park transforms of the phase currents <code>Ia</code> and <code>Ib</code>
+ *  -# two PI current loops on the d and q axes, with the integrators and the outputs
+ *     limited to <code>vLimit</code>
+ *  -# inverse Park and inverse Clarke transforms of the voltage commands
+ *  -# space vector modulation to three duty cycles
+ *
+ * The same computation written with the Clarke, Park, PID and sin_cos functions
+ * stores and reloads the intermediate values between the calls.  The step function
+ * keeps them in registers.
+ *
+ * \par PI Current Loops
+ * Each loop computes, with <code>e = Iref - I</code>:
+ * <pre>
+ *     integ = clip(integ + Ki * e, -vLimit, vLimit)
+ *     V     = clip(Kp * e + integ, -vLimit, vLimit)
+ * </pre>
+ * <code>Ki</code> is the integral gain multiplied by the sampling period.  The
+ * integrator is clamped to the same limit as the output so that it does not wind up
+ * while the output saturates.  The axes share the gains given to the initialization
+ * function, different gains can be written to the instance afterwards.
+ *
+ * \par Space Vector Modulation
+ * The phase voltages are centered with the min-max zero sequence, which gives the same
+ * duty cycles as the classical sector based space vector modulation:
+ * <pre>
+ *     offset = (max(Va, Vb, Vc) + min(Va, Vb, Vc)) / 2
+ *     duty   = 0.5 + (Vx - offset) / vBus
+ * </pre>
+ * The modulation is linear for voltage vectors up to <code>vBus / sqrt(3)</code>,
+ * so a per axis limit of <code>vBus / sqrt(6)</code> keeps the whole output linear.
+ * Beyond it the duty cycles are clipped to [0 1].
+ *
+ * \par
+ * The last measured d and q currents and the voltage commands are kept in the instance
+ * for monitoring.
+ */
+
+/**
+ * @addtogroup FOC
+ * @{
+ */
+
+/**
+ * @brief  Floating-point field oriented control step.
+ * @param[in,out]   *S points to an instance of the floating-point FOC structure.
+ * @param[in]       Ia phase a current.
+ * @param[in]       Ib phase b current.
+ * @param[in]       theta electrical rotor angle in radians.
+ * @param[in]       IdRef d axis current reference.
+ * @param[in]       IqRef q axis current reference.
+ * @param[out]      *pDuty points to the duty cycles of the phases a, b and c, in [0 1].
+ * @return none.
+ *
+ * \par
+ * The sine and cosine are computed with arm_sin_fast_f32() and arm_cos_fast_f32(),
+ * whose accuracy is set by <code>ARM_MATH_SIN_FAST_ORDER</code>.
+ */
+
+void arm_foc_f32(
+  arm_foc_instance_f32 * S,
+  float32_t Ia,
+  float32_t Ib,
+  float32_t theta,
+  float32_t IdRef,
+  float32_t IqRef,
+  float32_t * pDuty)
+{
+  float32_t sinVal, cosVal;                      /* Sine and cosine of the rotor angle */
+  float32_t Ialpha, Ibeta, Id, Iq;               /* Stationary and rotating frame currents */
+  float32_t err, integ, Vd, Vq;                  /* Loop error, integrator and voltage commands */
+  float32_t Valpha, Vbeta, Va, Vb, Vc;           /* Stationary frame and phase voltages */
+  float32_t vMax, vMin, offset, duty;            /* Zero sequence and duty cycle */
+  float32_t limit = S->vLimit;                   /* Voltage limit */
+  uint32_t i;                                    /* Loop counter */
+
+  sinVal = arm_sin_fast_f32(theta);
+  cosVal = arm_cos_fast_f32(theta);
+
+  /* Current transforms */
+  arm_clarke_f32(Ia, Ib, &Ialpha, &Ibeta);
+  arm_park_f32(Ialpha, Ibeta, &Id, &Iq, sinVal, cosVal);
+
+  /* d axis PI loop */
+  err = IdRef - Id;
+  integ = S->integD + (S->KiD * err);
+  integ = (integ > limit) ? limit : ((integ < -limit) ? -limit : integ);
+  Vd = (S->KpD * err) + integ;
+  Vd = (Vd > limit) ? limit : ((Vd < -limit) ? -limit : Vd);
+  S->integD = integ;
+
+  /* q axis PI loop */
+  err = IqRef - Iq;
+  integ = S->integQ + (S->KiQ * err);
+  integ = (integ > limit) ? limit : ((integ < -limit) ? -limit : integ);
+  Vq = (S->KpQ * err) + integ;
+  Vq = (Vq > limit) ? limit : ((Vq < -limit) ? -limit : Vq);
+  S->integQ = integ;
+
+  /* Voltage transforms */
+  arm_inv_park_f32(Vd, Vq, &Valpha, &Vbeta, sinVal, cosVal);
+  arm_inv_clarke_f32(Valpha, Vbeta, &Va, &Vb);
+  Vc = -(Va + Vb);
+
+  /* Min-max zero sequence of the space vector modulation */
+  vMax = (Va > Vb) ? Va : Vb;
+  vMax = (Vc > vMax) ? Vc : vMax;
+  vMin = (Va < Vb) ? Va : Vb;
+  vMin = (Vc < vMin) ? Vc : vMin;
+  offset = 0.5f * (vMax + vMin);
+
+  pDuty[0] = Va;
+  pDuty[1] = Vb;
+  pDuty[2] = Vc;
+
+  for (i = 0U; i < 3U; i++)
+  {
+    duty = 0.5f + ((pDuty[i] - offset) * S->invBus);
+    pDuty[i] = (duty > 1.0f) ? 1.0f : ((duty < 0.0f) ? 0.0f : duty);
+  }
+
+  /* Monitoring values */
+  S->Id = Id;
+  S->Iq = Iq;
+  S->Vd = Vd;
+  S->Vq = Vq;
+}
+
+/**
+ * @} end of FOC group
+ */
@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_foc_init_f32.c
+ * Description:  Floating-point field oriented control initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup FOC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point field oriented control step.
+ * @param[in,out] *S points to an instance of the floating-point FOC structure.
+ * @param[in]     Kp proportional gain of both current loops.
+ * @param[in]     Ki integral gain of both current loops, multiplied by the sampling period.
+ * @param[in]     vLimit limit of the magnitude of each axis voltage.
+ * @param[in]     vBus DC bus voltage.
+ * @return none.
+ * \par Description:
+ * The function sets the gains of both axes, the voltage limit and the inverse of
+ * the DC bus voltage, and clears the integrators.  The bus voltage can be updated
+ * later by writing <code>invBus</code>.
+ */
+
+void arm_foc_init_f32(
+  arm_foc_instance_f32 * S,
+  float32_t Kp,
+  float32_t Ki,
+  float32_t vLimit,
+  float32_t vBus)
+{
+  S->KpD = Kp;
+  S->KiD = Ki;
+  S->KpQ = Kp;
+  S->KiQ = Ki;
+  S->vLimit = vLimit;
+  S->invBus = 1.0f / vBus;
+
+  arm_foc_reset_f32(S);
+}
+
+/**
+ * @} end of FOC group
+ */
@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_foc_init_q31.c
+ * Description:  Q31 field oriented control initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup FOC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 field oriented control step.
+ * @param[in,out] *S points to an instance of the Q31 FOC structure.
+ * @param[in]     Kp proportional gain of both current loops, scaled by 2^-postShift.
+ * @param[in]     Ki integral gain of both current loops, multiplied by the sampling period
+ *                and scaled by 2^-postShift.
+ * @param[in]     postShift left shift applied to the gain products, 0 to 31.
+ * @param[in]     vLimit limit of the magnitude of each axis voltage, relative to the DC bus voltage.
+ * @return none.
+ * \par Description:
+ * The function sets the gains of both axes, the shift and the voltage limit, and
+ * clears the integrators.
+ */
+
+void arm_foc_init_q31(
+  arm_foc_instance_q31 * S,
+  q31_t Kp,
+  q31_t Ki,
+  uint8_t postShift,
+  q31_t vLimit)
+{
+  S->KpD = Kp;
+  S->KiD = Ki;
+  S->KpQ = Kp;
+  S->KiQ = Ki;
+  S->postShift = postShift;
+  S->vLimit = vLimit;
+
+  arm_foc_reset_q31(S);
+}
+
+/**
+ * @} end of FOC group
+ */
@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_foc_q31.c
+ * Description:  Q31 field oriented control step
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup FOC
+ * @{
+ */
+
+/**
+ * @brief  Q31 field oriented control step.
+ * @param[in,out]   *S points to an instance of the Q31 FOC structure.
+ * @param[in]       Ia phase a current.
+ * @param[in]       Ib phase b current.
+ * @param[in]       theta scaled electrical rotor angle, [-1 1) maps to [-pi pi).
+ * @param[in]       IdRef d axis current reference.
+ * @param[in]       IqRef q axis current reference.
+ * @param[out]      *pDuty points to the duty cycles of the phases a, b and c, in [0 1).
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The currents share one full scale.  The voltages are relative to the DC bus voltage,
+ * so that the duty cycle of a phase is <code>0.5 + Vx - offset</code>.
+ * The real gains are <code>Kp * 2^postShift</code> and <code>Ki * 2^postShift</code>,
+ * in units of the DC bus voltage per full scale current.
+ * The products are computed in 2.62 format, shifted and saturated to 1.31 format.
+ * All additions saturate, the transforms are those of arm_clarke_q31(), arm_park_q31(),
+ * arm_inv_park_q31() and arm_inv_clarke_q31(), and the angle is converted with
+ * arm_sin_cos_q31().
+ */
+
+void arm_foc_q31(
+  arm_foc_instance_q31 * S,
+  q31_t Ia,
+  q31_t Ib,
+  q31_t theta,
+  q31_t IdRef,
+  q31_t IqRef,
+  q31_t * pDuty)
+{
+  q31_t sinVal, cosVal;                          /* Sine and cosine of the rotor angle */
+  q31_t Ialpha, Ibeta, Id, Iq;                   /* Stationary and rotating frame currents */
+  q31_t err, integ, Vd, Vq;                      /* Loop error, integrator and voltage commands */
+  q31_t Valpha, Vbeta, Va, Vb, Vc;               /* Stationary frame and phase voltages */
+  q31_t vMax, vMin, offset, duty;                /* Zero sequence and duty cycle */
+  q31_t limit = S->vLimit;                       /* Voltage limit */
+  uint32_t shift = 31U - S->postShift;           /* Shift of the gain products */
+  uint32_t i;                                    /* Loop counter */
+
+  arm_sin_cos_q31(theta, &sinVal, &cosVal);
+
+  /* Current transforms */
+  arm_clarke_q31(Ia, Ib, &Ialpha, &Ibeta);
+  arm_park_q31(Ialpha, Ibeta, &Id, &Iq, sinVal, cosVal);
+
+  /* d axis PI loop */
+  err = __QSUB(IdRef, Id);
+  integ = __QADD(S->integD, clip_q63_to_q31(((q63_t) S->KiD * err) >> shift));
+  integ = (integ > limit) ? limit : ((integ < -limit) ? -limit : integ);
+  Vd = __QADD(clip_q63_to_q31(((q63_t) S->KpD * err) >> shift), integ);
+  Vd = (Vd > limit) ? limit : ((Vd < -limit) ? -limit : Vd);
+  S->integD = integ;
+
+  /* q axis PI loop */
+  err = __QSUB(IqRef, Iq);
+  integ = __QADD(S->integQ, clip_q63_to_q31(((q63_t) S->KiQ * err) >> shift));
+  integ = (integ > limit) ? limit : ((integ < -limit) ? -limit : integ);
+  Vq = __QADD(clip_q63_to_q31(((q63_t) S->KpQ * err) >> shift), integ);
+  Vq = (Vq > limit) ? limit : ((Vq < -limit) ? -limit : Vq);
+  S->integQ = integ;
+
+  /* Voltage transforms */
+  arm_inv_park_q31(Vd, Vq, &Valpha, &Vbeta, sinVal, cosVal);
+  arm_inv_clarke_q31(Valpha, Vbeta, &Va, &Vb);
+  Vc = __QSUB(__QSUB(0, Va), Vb);
+
+  /* Min-max zero sequence of the space vector modulation */
+  vMax = (Va > Vb) ? Va : Vb;
+  vMax = (Vc > vMax) ? Vc : vMax;
+  vMin = (Va < Vb) ? Va : Vb;
+  vMin = (Vc < vMin) ? Vc : vMin;
+  offset = (vMax >> 1) + (vMin >> 1);
+
+  pDuty[0] = Va;
+  pDuty[1] = Vb;
+  pDuty[2] = Vc;
+
+  for (i = 0U; i < 3U; i++)
+  {
+    duty = __QADD(0x40000000, __QSUB(pDuty[i], offset));
+    pDuty[i] = (duty < 0) ? 0 : duty;
+  }
+
+  /* Monitoring values */
+  S->Id = Id;
+  S->Iq = Iq;
+  S->Vd = Vd;
+  S->Vq = Vq;
+}
+
+/**
+ * @} end of FOC group
+ */
@@ -0,0 +1,57 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_foc_reset_f32.c
+ * Description:  Floating-point field oriented control reset function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup FOC
+ * @{
+ */
+
+/**
+ * @brief  Reset function for the floating-point field oriented control step.
+ * @param[in,out] *S points to an instance of the floating-point FOC structure.
+ * @return none.
+ * \par Description:
+ * The function clears the integrators of the current loops and the monitoring values.
+ */
+
+void arm_foc_reset_f32(
+  arm_foc_instance_f32 * S)
+{
+  S->integD = 0.0f;
+  S->integQ = 0.0f;
+  S->Id = 0.0f;
+  S->Iq = 0.0f;
+  S->Vd = 0.0f;
+  S->Vq = 0.0f;
+}
+
+/**
+ * @} end of FOC group
+ */
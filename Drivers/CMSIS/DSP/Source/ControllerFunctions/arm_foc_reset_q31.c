@@ -0,0 +1,57 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_foc_reset_q31.c
+ * Description:  Q31 field oriented control reset function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup FOC
+ * @{
+ */
+
+/**
+ * @brief  Reset function for the Q31 field oriented control step.
+ * @param[in,out] *S points to an instance of the Q31 FOC structure.
+ * @return none.
+ * \par Description:
+ * The function clears the integrators of the current loops and the monitoring values.
+ */
+
+void arm_foc_reset_q31(
+  arm_foc_instance_q31 * S)
+{
+  S->integD = 0;
+  S->integQ = 0;
+  S->Id = 0;
+  S->Iq = 0;
+  S->Vd = 0;
+  S->Vq = 0;
+}
+
+/**
+ * @} end of FOC group
+ */
@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_init_f32.c
+ * Description:  Initialization function for the floating-point Kalman filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup Kalman Kalman Filter
+ *
+ * Linear and extended Kalman filters with <code>n</code> states, <code>m</code> measurements
+ * and <code>p</code> control inputs.  All the matrices are stored in row order in buffers given
+ * to arm_kalman_init_f32(): the sizes are fixed for the life of the instance and the filter
+ * uses no other memory than its workspace.
+ *
+ * \par Algorithm
+ * The prediction step computes:
+ * <pre>
+ *     x = F x + B u
+ *     P = F P F' + Q
+ * </pre>
+ * and the measurement update:
+ * <pre>
+ *     y = z - H x
+ *     S = H P H' + R
+ *     K = P H' S^-1
+ *     x = x + K y
+ *     P = P - K S K'
+ * </pre>
+ * The innovation covariance <code>S</code> is not inverted: it is factored as <code>S = U' U</code>
+ * with the Cholesky decomposition, and with <code>G = P H' U^-1</code> and <code>v = U'^-1 y</code>,
+ * found by forward substitution, the update becomes:
+ * <pre>
+ *     x = x + G v
+ *     P = P - G G'
+ * </pre>
+ * The covariances are symmetric: only the upper triangles of <code>P</code>, <code>S</code>,
+ * <code>Q</code> and <code>R</code> are computed or read, and <code>P</code> is mirrored after
+ * each step so that it stays exactly symmetric.
+ *
+ * \par Extended Kalman Filter
+ * arm_kalman_predict_ext_f32() and arm_kalman_update_ext_f32() take callbacks that compute the
+ * nonlinear state transition <code>f(x)</code> or measurement <code>h(x)</code> and write their
+ * Jacobians at <code>x</code> into the <code>pF</code> or <code>pH</code> matrix of the
+ * instance.  The covariances are then propagated as in the linear filter.
+ *
+ * \par Workspace
+ * The workspace holds <code>ARM_KALMAN_WORK_SIZE(n, m)</code> values, the largest of
+ * <code>n (n + 1)</code> for the prediction and <code>m (n + m + 1)</code> for the update.
+ * It can be shared by several instances that are not run concurrently.
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Kalman filter.
+ * @param[out]      *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in]       numStates number of states n.
+ * @param[in]       numMeas number of measurements m.
+ * @param[in]       numInputs number of control inputs p, 0 without control input.
+ * @param[in]       *pState points to the initial state, n values.
+ * @param[in]       *pCov points to the initial covariance, n x n values, symmetric.
+ * @param[in]       *pF points to the state transition matrix, n x n values.
+ * @param[in]       *pB points to the control input matrix, n x p values, or NULL.
+ * @param[in]       *pH points to the measurement matrix, m x n values.
+ * @param[in]       *pQ points to the process noise covariance, n x n values.
+ * @param[in]       *pR points to the measurement noise covariance, m x m values.
+ * @param[in]       *pWork points to the workspace, ARM_KALMAN_WORK_SIZE(n, m) values.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if n or m is zero.
+ *
+ * \par
+ * The state and the covariance are updated in place by the filter.  The extended filter
+ * overwrites <code>pF</code> and <code>pH</code> with the Jacobians, which need no initial
+ * value in that case.
+ */
+
+arm_status arm_kalman_init_f32(
+  arm_kalman_instance_f32 * S,
+  uint16_t numStates,
+  uint16_t numMeas,
+  uint16_t numInputs,
+  float32_t * pState,
+  float32_t * pCov,
+  float32_t * pF,
+  const float32_t * pB,
+  float32_t * pH,
+  const float32_t * pQ,
+  const float32_t * pR,
+  float32_t * pWork)
+{
+  if ((numStates == 0U) || (numMeas == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numStates = numStates;
+  S->numMeas = numMeas;
+  S->numInputs = (pB != NULL) ? numInputs : 0U;
+  S->pState = pState;
+  S->pCov = pCov;
+  S->pF = pF;
+  S->pB = pB;
+  S->pH = pH;
+  S->pQ = pQ;
+  S->pR = pR;
+  S->pWork = pWork;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Kalman group
+ */
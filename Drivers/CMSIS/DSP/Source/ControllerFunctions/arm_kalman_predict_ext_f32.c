@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_predict_ext_f32.c
+ * Description:  Prediction step of the floating-point extended Kalman filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+extern void arm_kalman_cov_predict_f32(
+  arm_kalman_instance_f32 * S);
+
+/**
+ * @brief  Prediction step of the floating-point extended Kalman filter.
+ * @param[in,out]   *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in]       pFunc state transition callback.
+ * @param[in]       *pContext user data passed to the callback.
+ * @return none.
+ *
+ * \par
+ * The callback computes <code>f(x)</code> and writes the Jacobian of <code>f</code> at
+ * <code>x</code> into <code>pF</code>.  Then <code>x = f(x)</code> and
+ * <code>P = F P F' + Q</code>.  The control inputs, if any, are handled by the callback
+ * through <code>pContext</code>.
+ */
+
+void arm_kalman_predict_ext_f32(
+  arm_kalman_instance_f32 * S,
+  arm_kalman_transition_f32 pFunc,
+  void * pContext)
+{
+  uint32_t n = S->numStates;                     /* Number of states */
+  float32_t *pNext = S->pWork + (n * n);         /* Predicted state */
+
+  pFunc(pContext, S->pState, pNext, S->pF);
+
+  arm_kalman_cov_predict_f32(S);
+
+  arm_copy_f32(pNext, S->pState, n);
+}
+
+/**
+ * @} end of Kalman group
+ */
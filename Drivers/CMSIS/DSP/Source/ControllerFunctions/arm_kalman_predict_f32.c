@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_predict_f32.c
+ * Description:  Prediction step of the floating-point Kalman filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Propagation of the covariance of the floating-point Kalman filter.
+ * @param[in,out]   *S points to an instance of the floating-point Kalman filter structure.
+ * @return none.
+ *
+ * \par
+ * Computes <code>P = F P F' + Q</code> with the first n x n values of the workspace.
+ * Shared by the linear and the extended filters.
+ */
+
+void arm_kalman_cov_predict_f32(
+  arm_kalman_instance_f32 * S)
+{
+  uint32_t n = S->numStates;                     /* Number of states */
+  float32_t *pP = S->pCov;                       /* Covariance */
+  float32_t *pF = S->pF;                         /* State transition matrix */
+  const float32_t *pQ = S->pQ;                   /* Process noise covariance */
+  float32_t *pA = S->pWork;                      /* F P */
+  float32_t sum;                                 /* Dot product */
+  uint32_t i, j;                                 /* Loop counters */
+
+  /* A = F P.  P is symmetric: column j of P is its row j */
+  for (i = 0U; i < n; i++)
+  {
+    for (j = 0U; j < n; j++)
+    {
+      arm_dot_prod_f32(&pF[i * n], &pP[j * n], n, &pA[(i * n) + j]);
+    }
+  }
+
+  /* P = A F' + Q, upper triangle mirrored to the lower one */
+  for (i = 0U; i < n; i++)
+  {
+    for (j = i; j < n; j++)
+    {
+      arm_dot_prod_f32(&pA[i * n], &pF[j * n], n, &sum);
+      sum += pQ[(i * n) + j];
+      pP[(i * n) + j] = sum;
+      pP[(j * n) + i] = sum;
+    }
+  }
+}
+
+/**
+ * @brief  Prediction step of the floating-point Kalman filter.
+ * @param[in,out]   *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in]       *pU points to the control input, p values, or NULL.
+ * @return none.
+ *
+ * \par
+ * Computes <code>x = F x + B u</code> and <code>P = F P F' + Q</code>.  Only the upper
+ * triangle of <code>Q</code> is read.  The control input is ignored when <code>pU</code>
+ * or <code>pB</code> is NULL.
+ */
+
+void arm_kalman_predict_f32(
+  arm_kalman_instance_f32 * S,
+  const float32_t * pU)
+{
+  uint32_t n = S->numStates;                     /* Number of states */
+  uint32_t p = S->numInputs;                     /* Number of control inputs */
+  float32_t *pX = S->pState;                     /* State estimate */
+  float32_t *pNext = S->pWork + (n * n);         /* Predicted state */
+  float32_t sum;                                 /* Dot product */
+  uint32_t i;                                    /* Loop counter */
+
+  /* x = F x + B u */
+  for (i = 0U; i < n; i++)
+  {
+    arm_dot_prod_f32(&S->pF[i * n], pX, n, &pNext[i]);
+
+    if ((pU != NULL) && (p != 0U))
+    {
+      arm_dot_prod_f32((float32_t *) &S->pB[i * p], (float32_t *) pU, p, &sum);
+      pNext[i] += sum;
+    }
+  }
+
+  arm_kalman_cov_predict_f32(S);
+
+  arm_copy_f32(pNext, pX, n);
+}
+
+/**
+ * @} end of Kalman group
+ */
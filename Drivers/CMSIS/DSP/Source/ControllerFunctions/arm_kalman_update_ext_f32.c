@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_update_ext_f32.c
+ * Description:  Measurement update of the floating-point extended Kalman filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+extern arm_status arm_kalman_correct_f32(
+  arm_kalman_instance_f32 * S);
+
+/**
+ * @brief  Measurement update of the floating-point extended Kalman filter.
+ * @param[in,out]   *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in]       pFunc measurement callback.
+ * @param[in]       *pContext user data passed to the callback.
+ * @param[in]       *pZ points to the measurement, m values.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_SINGULAR if the innovation covariance is not positive
+ * definite.  The state and the covariance are then unchanged.
+ *
+ * \par
+ * The callback computes the predicted measurement <code>h(x)</code> and writes the Jacobian
+ * of <code>h</code> at <code>x</code> into <code>pH</code>.  The update then uses the
+ * innovation <code>y = z - h(x)</code>.  Only the upper triangle of <code>R</code> is read.
+ */
+
+arm_status arm_kalman_update_ext_f32(
+  arm_kalman_instance_f32 * S,
+  arm_kalman_measurement_f32 pFunc,
+  void * pContext,
+  const float32_t * pZ)
+{
+  uint32_t n = S->numStates;                     /* Number of states */
+  uint32_t m = S->numMeas;                       /* Number of measurements */
+  float32_t *pY = S->pWork + (m * (n + m));      /* Innovation */
+  uint32_t i;                                    /* Loop counter */
+
+  pFunc(pContext, S->pState, pY, S->pH);
+
+  /* y = z - h(x) */
+  for (i = 0U; i < m; i++)
+  {
+    pY[i] = pZ[i] - pY[i];
+  }
+
+  return (arm_kalman_correct_f32(S));
+}
+
+/**
+ * @} end of Kalman group
+ */
@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_update_f32.c
+ * Description:  Measurement update of the floating-point Kalman filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Correction of the floating-point Kalman filter with an innovation.
+ * @param[in,out]   *S points to an instance of the floating-point Kalman filter structure.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_SINGULAR if the innovation covariance is not positive definite.
+ *
+ * \par
+ * The workspace holds <code>P H'</code> (n x m), the innovation covariance (m x m) and the
+ * innovation <code>y</code> (m values), which the caller writes before the call.  The state
+ * and the covariance are unchanged when the innovation covariance is not positive definite.
+ * Shared by the linear and the extended filters.
+ */
+
+arm_status arm_kalman_correct_f32(
+  arm_kalman_instance_f32 * S)
+{
+  uint32_t n = S->numStates;                     /* Number of states */
+  uint32_t m = S->numMeas;                       /* Number of measurements */
+  float32_t *pP = S->pCov;                       /* Covariance */
+  float32_t *pH = S->pH;                         /* Measurement matrix */
+  const float32_t *pR = S->pR;                   /* Measurement noise covariance */
+  float32_t *pG = S->pWork;                      /* P H', then G = P H' U^-1 */
+  float32_t *pU = pG + (n * m);                  /* Innovation covariance, then its Cholesky factor */
+  float32_t *pY = pU + (m * m);                  /* Innovation, then v = U'^-1 y */
+  float32_t *pRow;                               /* Right-hand side of a substitution */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t i, j, k;                              /* Loop counters */
+
+  /* P H'.  P is symmetric: column i of P is its row i */
+  for (i = 0U; i < n; i++)
+  {
+    for (j = 0U; j < m; j++)
+    {
+      arm_dot_prod_f32(&pP[i * n], &pH[j * n], n, &pG[(i * m) + j]);
+    }
+  }
+
+  /* S = H P H' + R, upper triangle */
+  for (i = 0U; i < m; i++)
+  {
+    for (j = i; j < m; j++)
+    {
+      sum = pR[(i * m) + j];
+      for (k = 0U; k < n; k++)
+      {
+        sum += pH[(i * n) + k] * pG[(k * m) + j];
+      }
+      pU[(i * m) + j] = sum;
+    }
+  }
+
+  /* Cholesky factorization S = U' U in place.  The diagonal holds the inverses of the
+   ** diagonal elements of U, so that the substitutions below have no division. */
+  for (j = 0U; j < m; j++)
+  {
+    sum = pU[(j * m) + j];
+    for (k = 0U; k < j; k++)
+    {
+      sum -= pU[(k * m) + j] * pU[(k * m) + j];
+    }
+
+    if (sum <= 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    arm_sqrt_f32(sum, &sum);
+    sum = 1.0f / sum;
+    pU[(j * m) + j] = sum;
+
+    for (i = j + 1U; i < m; i++)
+    {
+      for (k = 0U; k < j; k++)
+      {
+        pU[(j * m) + i] -= pU[(k * m) + j] * pU[(k * m) + i];
+      }
+      pU[(j * m) + i] *= sum;
+    }
+  }
+
+  /* Forward substitutions U' g = (P H')' for each row g of G, and U' v = y */
+  for (i = 0U; i <= n; i++)
+  {
+    pRow = (i < n) ? &pG[i * m] : pY;
+
+    for (j = 0U; j < m; j++)
+    {
+      sum = pRow[j];
+      for (k = 0U; k < j; k++)
+      {
+        sum -= pU[(k * m) + j] * pRow[k];
+      }
+      pRow[j] = sum * pU[(j * m) + j];
+    }
+  }
+
+  /* x = x + G v */
+  for (i = 0U; i < n; i++)
+  {
+    arm_dot_prod_f32(&pG[i * m], pY, m, &sum);
+    S->pState[i] += sum;
+  }
+
+  /* P = P - G G', upper triangle mirrored to the lower one */
+  for (i = 0U; i < n; i++)
+  {
+    for (j = i; j < n; j++)
+    {
+      arm_dot_prod_f32(&pG[i * m], &pG[j * m], m, &sum);
+      sum = pP[(i * n) + j] - sum;
+      pP[(i * n) + j] = sum;
+      pP[(j * n) + i] = sum;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Measurement update of the floating-point Kalman filter.
+ * @param[in,out]   *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in]       *pZ points to the measurement, m values.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_SINGULAR if the innovation covariance is not positive
+ * definite.  The state and the covariance are then unchanged.
+ *
+ * \par
+ * Only the upper triangle of <code>R</code> is read.
+ */
+
+arm_status arm_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  const float32_t * pZ)
+{
+  uint32_t n = S->numStates;                     /* Number of states */
+  uint32_t m = S->numMeas;                       /* Number of measurements */
+  float32_t *pY = S->pWork + (m * (n + m));      /* Innovation */
+  uint32_t i;                                    /* Loop counter */
+
+  /* y = z - H x */
+  for (i = 0U; i < m; i++)
+  {
+    arm_dot_prod_f32(&S->pH[i * n], S->pState, n, &pY[i]);
+    pY[i] = pZ[i] - pY[i];
+  }
+
+  return (arm_kalman_correct_f32(S));
+}
+
+/**
+ * @} end of Kalman group
+ */
@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_ext_batch_q15.c
+ * Description:  Q15 extended PID Control for several independent loops
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup PIDExt
+ * @{
+ */
+
+/**
+ * @brief  Steps several independent Q15 extended PID Controls.
+ * @param[in,out] *S       points to an array of numLoops instances.
+ * @param[in]     *pSrc    points to the input sample of each loop.
+ * @param[out]    *pDst    points to the output sample of each loop.
+ * @param[in]     numLoops number of loops.
+ * @return none.
+ * \par Description:
+ * <code>pDst[k] = arm_pid_ext_q15(&S[k], pSrc[k])</code> for each loop <code>k</code>.
+ */
+
+void arm_pid_ext_batch_q15(
+  arm_pid_ext_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numLoops)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = numLoops >> 2U;
+
+  /* First part of the processing with loop unrolling.  Step 4 loops at a time.
+   ** a second loop below steps the remaining 1 to 3 loops. */
+  while (blkCnt > 0U)
+  {
+    pDst[0] = arm_pid_ext_q15(&S[0], pSrc[0]);
+    pDst[1] = arm_pid_ext_q15(&S[1], pSrc[1]);
+    pDst[2] = arm_pid_ext_q15(&S[2], pSrc[2]);
+    pDst[3] = arm_pid_ext_q15(&S[3], pSrc[3]);
+
+    /* Update the pointers to process the next loops */
+    S += 4U;
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If numLoops is not a multiple of 4, step the remaining loops here.
+   ** No loop unrolling is used. */
+  blkCnt = numLoops % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over all the loops */
+  blkCnt = numLoops;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    *pDst++ = arm_pid_ext_q15(S++, *pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of PIDExt group
+ */
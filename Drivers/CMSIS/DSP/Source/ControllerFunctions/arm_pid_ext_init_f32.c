@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_ext_init_f32.c
+ * Description:  Floating-point extended PID Control initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup PIDExt
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point extended PID Control.
+ * @param[out] *S     points to an instance of the extended PID structure.
+ * @param[in]  Kp     proportional gain.
+ * @param[in]  Ki     integral gain, per sampling period.
+ * @param[in]  Kd     derivative gain, per sampling period.
+ * @param[in]  alpha  derivative low-pass coefficient in (0 1]. 1 disables the filter.
+ * @param[in]  outMin lower output limit.
+ * @param[in]  outMax upper output limit.
+ * @return none.
+ * \par Description:
+ * For a controller designed in continuous time with the gains <code>Kp</code>, <code>Ki</code>
+ * and <code>Kd</code> and sampled with the period <code>Ts</code>, the integral gain is
+ * <code>Ki * Ts</code> and the derivative gain is <code>Kd / Ts</code>.
+ * The function also clears the state.
+ */
+
+void arm_pid_ext_init_f32(
+  arm_pid_ext_instance_f32 * S,
+  float32_t Kp,
+  float32_t Ki,
+  float32_t Kd,
+  float32_t alpha,
+  float32_t outMin,
+  float32_t outMax)
+{
+  S->Kp = Kp;
+  S->Ki = Ki;
+  S->Kd = Kd;
+  S->alpha = alpha;
+  S->outMin = outMin;
+  S->outMax = outMax;
+
+  arm_pid_ext_reset_f32(S);
+}
+
+/**
+ * @} end of PIDExt group
+ */
@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_ext_init_q15.c
+ * Description:  Q15 extended PID Control initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup PIDExt
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 extended PID Control.
+ * @param[out] *S        points to an instance of the extended PID structure.
+ * @param[in]  Kp        proportional gain.
+ * @param[in]  Ki        integral gain, per sampling period.
+ * @param[in]  Kd        derivative gain, per sampling period.
+ * @param[in]  alpha     derivative low-pass coefficient in (0 1]. 0x7FFF disables the filter.
+ * @param[in]  postShift shift applied to the gains.
+ * @param[in]  outMin    lower output limit.
+ * @param[in]  outMax    upper output limit.
+ * @return none.
+ * \par Description:
+ * The gains are in 1.15 format and are multiplied by <code>2^postShift</code>.
+ * The function also clears the state.
+ */
+
+void arm_pid_ext_init_q15(
+  arm_pid_ext_instance_q15 * S,
+  q15_t Kp,
+  q15_t Ki,
+  q15_t Kd,
+  q15_t alpha,
+  uint8_t postShift,
+  q15_t outMin,
+  q15_t outMax)
+{
+  S->Kp = Kp;
+  S->Ki = Ki;
+  S->Kd = Kd;
+  S->alpha = alpha;
+  S->postShift = postShift;
+  S->outMin = outMin;
+  S->outMax = outMax;
+
+  arm_pid_ext_reset_q15(S);
+}
+
+/**
+ * @} end of PIDExt group
+ */
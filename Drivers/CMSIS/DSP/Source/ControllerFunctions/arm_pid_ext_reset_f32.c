@@ -0,0 +1,55 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_ext_reset_f32.c
+ * Description:  floating-point extended PID Control reset function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup PIDExt
+ * @{
+ */
+
+/**
+ * @brief  Reset function for the floating-point extended PID Control.
+ * @param[in,out] *S points to an instance of the extended PID structure.
+ * @return none.
+ * \par Description:
+ * The function clears the integral term, the derivative filter and the previous input.
+ * The gains and the limits are not changed.
+ */
+
+void arm_pid_ext_reset_f32(
+  arm_pid_ext_instance_f32 * S)
+{
+  S->integ = 0.0f;
+  S->deriv = 0.0f;
+  S->xPrev = 0.0f;
+}
+
+/**
+ * @} end of PIDExt group
+ */
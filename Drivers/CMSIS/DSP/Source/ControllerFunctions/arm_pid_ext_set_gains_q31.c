@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_ext_set_gains_q31.c
+ * Description:  Q31 extended PID Control bumpless gain change
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup PIDExt
+ * @{
+ */
+
+/**
+ * @brief  Bumpless gain change for the Q31 extended PID Control.
+ * @param[in,out] *S points to an instance of the extended PID structure.
+ * @param[in]     Kp new proportional gain.
+ * @param[in]     Ki new integral gain, per sampling period.
+ * @param[in]     Kd new derivative gain, per sampling period.
+ * @return none.
+ * \par Description:
+ * The change of the proportional and derivative terms computed with the last input is
+ * moved into the integral term, which saturates.  The gain shift is not changed.
+ */
+
+void arm_pid_ext_set_gains_q31(
+  arm_pid_ext_instance_q31 * S,
+  q31_t Kp,
+  q31_t Ki,
+  q31_t Kd)
+{
+  q63_t acc;
+  int32_t shift = 31 - (int32_t) S->postShift;
+
+  /* i = i + (Kp_old - Kp) * x[n-1] + (Kd_old - Kd) * d[n-1] */
+  acc = (q63_t) S->integ;
+  acc += (((q63_t) S->Kp * S->xPrev) >> shift) - (((q63_t) Kp * S->xPrev) >> shift);
+  acc += (((q63_t) S->Kd * S->deriv) >> shift) - (((q63_t) Kd * S->deriv) >> shift);
+  S->integ = clip_q63_to_q31(acc);
+
+  S->Kp = Kp;
+  S->Ki = Ki;
+  S->Kd = Kd;
+}
+
+/**
+ * @} end of PIDExt group
+ */
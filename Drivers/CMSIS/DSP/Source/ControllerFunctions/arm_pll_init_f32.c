@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pll_init_f32.c
+ * Description:  Floating-point grid synchronization PLL initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup GridPLL
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point grid synchronization PLL.
+ * @param[in,out] *S points to an instance of the floating-point PLL structure.
+ * @param[in]     sampleRate sampling rate, in Hz.
+ * @param[in]     nominalFreq nominal grid frequency, in Hz.
+ * @param[in]     Kp proportional gain, in rad/s per unit of q axis voltage.
+ * @param[in]     Ki integral gain, in rad/s^2 per unit of q axis voltage.
+ * @param[in]     sogiGain damping gain of the generalized integrator, only used by arm_pll_sogi_f32().
+ * @return none.
+ * \par Description:
+ * The function converts the frequency and the gains to the sampling period, stores
+ * them in the instance and resets the loop to the nominal frequency.
+ */
+
+void arm_pll_init_f32(
+  arm_pll_instance_f32 * S,
+  float32_t sampleRate,
+  float32_t nominalFreq,
+  float32_t Kp,
+  float32_t Ki,
+  float32_t sogiGain)
+{
+  float32_t Ts = 1.0f / sampleRate;
+
+  S->Kp = Kp * Ts;
+  S->Ki = Ki * Ts * Ts;
+  S->sogiGain = sogiGain;
+  S->omegaNom = 2.0f * PI * nominalFreq * Ts;
+  S->toHz = sampleRate / (2.0f * PI);
+
+  arm_pll_reset_f32(S);
+}
+
+/**
+ * @} end of GridPLL group
+ */
@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pll_init_q31.c
+ * Description:  Q31 grid synchronization PLL initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup GridPLL
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 grid synchronization PLL.
+ * @param[in,out] *S points to an instance of the Q31 PLL structure.
+ * @param[in]     nominalFreq nominal grid frequency, relative to half the sampling rate.
+ * @param[in]     Kp proportional gain, in pi radians per sample per full scale voltage.
+ * @param[in]     Ki integral gain, in pi radians per sample squared per full scale voltage.
+ * @param[in]     sogiGain damping gain of the generalized integrator divided by 2, only used by arm_pll_sogi_q31().
+ * @return none.
+ * \par Description:
+ * The function stores the frequency and the gains in the instance and resets the loop
+ * to the nominal frequency.  With the sampling rate <code>fs</code>, the gains of the
+ * floating-point version in rad/s and rad/s^2, and the voltages in units of the full
+ * scale, the arguments are:
+ * <pre>
+ *     nominalFreq = 2 * f0 / fs
+ *     Kp          = Kp_f32 / (pi * fs)
+ *     Ki          = Ki_f32 / (pi * fs^2)
+ *     sogiGain    = k / 2
+ * </pre>
+ */
+
+void arm_pll_init_q31(
+  arm_pll_instance_q31 * S,
+  q31_t nominalFreq,
+  q31_t Kp,
+  q31_t Ki,
+  q31_t sogiGain)
+{
+  S->Kp = Kp;
+  S->Ki = Ki;
+  S->sogiGain = sogiGain;
+  S->omegaNom = nominalFreq;
+
+  arm_pll_reset_q31(S);
+}
+
+/**
+ * @} end of GridPLL group
+ */
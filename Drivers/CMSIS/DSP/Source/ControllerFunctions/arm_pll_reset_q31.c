@@ -0,0 +1,61 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pll_reset_q31.c
+ * Description:  Q31 grid synchronization PLL reset function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup GridPLL
+ * @{
+ */
+
+/**
+ * @brief  Reset function for the Q31 grid synchronization PLL.
+ * @param[in,out] *S points to an instance of the Q31 PLL structure.
+ * @return none.
+ * \par Description:
+ * The function clears the angle, the integrators and the outputs.  The frequency
+ * output restarts at the nominal frequency.
+ */
+
+void arm_pll_reset_q31(
+  arm_pll_instance_q31 * S)
+{
+  S->integ = 0;
+  S->theta = 0;
+  S->sogiA = 0;
+  S->sogiB = 0;
+  S->freq = S->omegaNom;
+  S->phase = 0;
+  S->amplitude = 0;
+  S->sinPhase = 0;
+  S->cosPhase = 0x7FFFFFFF;
+}
+
+/**
+ * @} end of GridPLL group
+ */
@@ -0,0 +1,182 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pll_sogi_f32.c
+ * Description:  Floating-point single-phase SOGI phase-locked loop
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup GridPLL Grid Synchronization PLL
+ *
+ * Phase-locked loops that track the phase, the frequency and the amplitude of the
+ * fundamental of a grid voltage, one sample per call, for the control interrupt of a
+ * power factor corrector or of a grid-tied inverter:
+ *  - arm_pll_sogi_f32() and arm_pll_sogi_q31() lock to a single-phase voltage through a
+ *    second order generalized integrator (SOGI)
+ *  - arm_pll_srf_f32() and arm_pll_srf_q31() lock to a three-phase voltage in the
+ *    synchronous reference frame (SRF)
+ *
+ * Both build a stationary frame vector <code>(alpha, beta)</code> of the voltage and
+ * share the same loop.
+ *
+ * \par Loop
+ * The vector is rotated by the angle of the loop with the Park transform of arm_park_f32(),
+ * and a PI controller drives the q axis voltage to zero:
+ * <pre>
+ *     d     =  alpha * cos(theta) + beta * sin(theta)
+ *     q     = -alpha * sin(theta) + beta * cos(theta)
+ *     integ = clip(integ + Ki * q, -omegaNom / 2, omegaNom / 2)
+ *     omega = omegaNom + integ + Kp * q
+ *     theta = theta + omega
+ * </pre>
+ * The angular frequencies are in radians per sample.  The controller is the one of
+ * arm_pid_f32() with <code>Kd = 0</code>, with its integrator kept apart: the frequency
+ * output is <code>omegaNom + integ</code>, free of the ripple of the proportional term.
+ * The integrator is limited to half the nominal frequency so that the loop does not run
+ * away while the grid is lost.
+ *
+ * \par Tuning
+ * Once locked, <code>q</code> is about <code>A * (phi - theta)</code> for a fundamental of
+ * amplitude <code>A</code> and phase <code>phi</code>.  The loop is then of second order,
+ * with a natural angular frequency <code>wn</code> and a damping <code>zeta</code> given by:
+ * <pre>
+ *     Kp = 2 * zeta * wn / A
+ *     Ki = wn^2 / A
+ * </pre>
+ * in rad/s and rad/s^2 for the initialization of the floating-point version.  A damping of
+ * 0.7 and a natural frequency of 10 to 30 Hz suit 50 and 60 Hz grids.  A slower loop
+ * rejects the harmonics better and settles later after a phase jump.  The gains scale
+ * with the inverse of the amplitude, so a voltage dip slows the loop down.
+ *
+ * \par Single-Phase Front End
+ * The SOGI is a resonator tuned to the frequency estimate of the loop.  It filters the
+ * input <code>v</code> and builds its quadrature:
+ * <pre>
+ *     e = k * (v - a) - b
+ *     a = a + w * e
+ *     b = b + w * a
+ * </pre>
+ * with <code>w = omegaNom + integ</code>.  The states of the previous call give the vector
+ * of the current sample, <code>alpha = a</code> and <code>beta = b - w * a / 2</code>: the
+ * half sample correction makes both components the same amplitude and exactly 90 degrees
+ * apart.  The gain <code>k</code> sets the bandwidth of the resonator: <code>sqrt(2)</code>
+ * is the usual trade-off, a lower value rejects the harmonics better and responds slower.
+ *
+ * \par Three-Phase Front End
+ * The phase voltages are transformed with the amplitude invariant Clarke transform of the
+ * three phases:
+ * <pre>
+ *     alpha = (2 * va - vb - vc) / 3
+ *     beta  = (vb - vc) / sqrt(3)
+ * </pre>
+ * which removes the zero sequence.  arm_clarke_f32() assumes phase currents that sum to zero
+ * and cannot be used for phase to neutral voltages.  The negative sequence of an unbalanced
+ * grid gives a ripple at twice the grid frequency, the 5th and 7th harmonics a ripple at six
+ * times the grid frequency.
+ *
+ * \par Outputs
+ * After each call the instance holds the frequency estimate, the phase of the sample just
+ * processed with its sine and cosine, and the d axis voltage, which is the amplitude of
+ * the fundamental once the loop is locked.  The sine and cosine give the current
+ * reference of a unity power factor converter without another evaluation.
+ *
+ * \par Cost
+ * A step evaluates one sine and one cosine and about a dozen multiplications, without
+ * division or loop, and fits in a control interrupt at 20 to 100 kHz.
+ */
+
+/**
+ * @addtogroup GridPLL
+ * @{
+ */
+
+/**
+ * @brief  Floating-point single-phase SOGI PLL step.
+ * @param[in,out]   *S points to an instance of the floating-point PLL structure.
+ * @param[in]       v grid voltage sample.
+ * @return none.
+ *
+ * \par
+ * The sine and cosine are computed with arm_sin_fast_f32() and arm_cos_fast_f32(),
+ * whose accuracy is set by <code>ARM_MATH_SIN_FAST_ORDER</code>.
+ */
+
+void arm_pll_sogi_f32(
+  arm_pll_instance_f32 * S,
+  float32_t v)
+{
+  float32_t sinVal, cosVal;                      /* Sine and cosine of the loop angle */
+  float32_t alpha, beta, d, q;                   /* Stationary and rotating frame voltages */
+  float32_t integ, omega, theta;                 /* Loop integrator, frequency and angle */
+  float32_t w = S->omegaNom + S->integ;          /* Frequency of the resonator */
+  float32_t limit = 0.5f * S->omegaNom;          /* Limit of the integrator */
+  float32_t a = S->sogiA;                        /* In-phase state */
+  float32_t b = S->sogiB;                        /* Quadrature state */
+  float32_t e;                                   /* Resonator error */
+
+  theta = S->theta;
+  sinVal = arm_sin_fast_f32(theta);
+  cosVal = arm_cos_fast_f32(theta);
+
+  /* Quadrature signals of the current sample */
+  alpha = a;
+  beta = b - (0.5f * w * a);
+
+  arm_park_f32(alpha, beta, &d, &q, sinVal, cosVal);
+
+  /* PI loop */
+  integ = S->integ + (S->Ki * q);
+  integ = (integ > limit) ? limit : ((integ < -limit) ? -limit : integ);
+  omega = S->omegaNom + integ + (S->Kp * q);
+  S->integ = integ;
+
+  /* Resonator update with the new sample */
+  e = (S->sogiGain * (v - a)) - b;
+  a = a + (w * e);
+  b = b + (w * a);
+  S->sogiA = a;
+  S->sogiB = b;
+
+  /* Outputs */
+  S->freq = (S->omegaNom + integ) * S->toHz;
+  S->phase = theta;
+  S->amplitude = d;
+  S->sinPhase = sinVal;
+  S->cosPhase = cosVal;
+
+  /* Angle of the next sample, wrapped to [-pi pi) */
+  theta = theta + omega;
+  theta = (theta >= PI) ? (theta - (2.0f * PI)) : ((theta < -PI) ? (theta + (2.0f * PI)) : theta);
+  S->theta = theta;
+}
+
+/**
+ * @} end of GridPLL group
+ */
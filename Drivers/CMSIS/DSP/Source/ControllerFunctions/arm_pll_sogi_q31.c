@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pll_sogi_q31.c
+ * Description:  Q31 single-phase SOGI phase-locked loop
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup GridPLL
+ * @{
+ */
+
+/**
+ * @brief  Q31 single-phase SOGI PLL step.
+ * @param[in,out]   *S points to an instance of the Q31 PLL structure.
+ * @param[in]       v grid voltage sample.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The voltages share one full scale and the gains are in units of that full scale.
+ * The angles are scaled so that [-1 1) maps to [-pi pi) and wrap around, the frequencies
+ * are relative to half the sampling rate.  The resonator frequency <code>w</code> is
+ * <code>pi</code> times the frequency estimate, which must stay below <code>1 / pi</code>.
+ * The integrator of the loop is kept in 2.62 format so that small integral gains do not
+ * lose the low phase errors.  All the other products are computed in 2.62 format and
+ * saturated to 1.31 format, all the additions saturate, and the angle is converted with
+ * arm_sin_cos_q31().
+ */
+
+void arm_pll_sogi_q31(
+  arm_pll_instance_q31 * S,
+  q31_t v)
+{
+  q31_t sinVal, cosVal;                          /* Sine and cosine of the loop angle */
+  q31_t alpha, beta, d, q;                       /* Stationary and rotating frame voltages */
+  q31_t freq, omega, theta;                      /* Loop frequency and angle */
+  q63_t integ;                                   /* Loop integrator */
+  q63_t limit = (q63_t) S->omegaNom << 30;       /* Limit of the integrator, half omegaNom */
+  q31_t a = S->sogiA;                            /* In-phase state */
+  q31_t b = S->sogiB;                            /* Quadrature state */
+  q31_t w, e;                                    /* Resonator frequency and error */
+
+  /* w = pi * freq, with pi / 4 in 1.31 format */
+  w = clip_q63_to_q31(((q63_t) S->freq * 0x6487ED51) >> 29);
+
+  theta = S->theta;
+  arm_sin_cos_q31(theta, &sinVal, &cosVal);
+
+  /* Quadrature signals of the current sample */
+  alpha = a;
+  beta = __QSUB(b, (q31_t) (((q63_t) w * a) >> 32));
+
+  arm_park_q31(alpha, beta, &d, &q, sinVal, cosVal);
+
+  /* PI loop */
+  integ = S->integ + ((q63_t) S->Ki * q);
+  integ = (integ > limit) ? limit : ((integ < -limit) ? -limit : integ);
+  freq = S->omegaNom + (q31_t) (integ >> 31);
+  omega = __QADD(freq, (q31_t) (((q63_t) S->Kp * q) >> 31));
+  S->integ = integ;
+
+  /* Resonator update with the new sample */
+  e = __QSUB(clip_q63_to_q31(((q63_t) S->sogiGain * __QSUB(v, a)) >> 30), b);
+  a = __QADD(a, (q31_t) (((q63_t) w * e) >> 31));
+  b = __QADD(b, (q31_t) (((q63_t) w * a) >> 31));
+  S->sogiA = a;
+  S->sogiB = b;
+
+  /* Outputs */
+  S->freq = freq;
+  S->phase = theta;
+  S->amplitude = d;
+  S->sinPhase = sinVal;
+  S->cosPhase = cosVal;
+
+  /* Angle of the next sample, wraps around */
+  S->theta = (q31_t) ((uint32_t) theta + (uint32_t) omega);
+}
+
+/**
+ * @} end of GridPLL group
+ */
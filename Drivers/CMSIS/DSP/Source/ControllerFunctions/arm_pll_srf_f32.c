@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pll_srf_f32.c
+ * Description:  Floating-point three-phase synchronous reference frame phase-locked loop
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup GridPLL
+ * @{
+ */
+
+/**
+ * @brief  Floating-point three-phase SRF PLL step.
+ * @param[in,out]   *S points to an instance of the floating-point PLL structure.
+ * @param[in]       va phase a voltage sample.
+ * @param[in]       vb phase b voltage sample.
+ * @param[in]       vc phase c voltage sample.
+ * @return none.
+ *
+ * \par
+ * The sine and cosine are computed with arm_sin_fast_f32() and arm_cos_fast_f32(),
+ * whose accuracy is set by <code>ARM_MATH_SIN_FAST_ORDER</code>.
+ */
+
+void arm_pll_srf_f32(
+  arm_pll_instance_f32 * S,
+  float32_t va,
+  float32_t vb,
+  float32_t vc)
+{
+  float32_t sinVal, cosVal;                      /* Sine and cosine of the loop angle */
+  float32_t alpha, beta, d, q;                   /* Stationary and rotating frame voltages */
+  float32_t integ, omega, theta;                 /* Loop integrator, frequency and angle */
+  float32_t limit = 0.5f * S->omegaNom;          /* Limit of the integrator */
+
+  theta = S->theta;
+  sinVal = arm_sin_fast_f32(theta);
+  cosVal = arm_cos_fast_f32(theta);
+
+  /* Clarke transform of the three phases */
+  alpha = ((2.0f * va) - vb - vc) * 0.333333333f;
+  beta = (vb - vc) * 0.577350269f;
+
+  arm_park_f32(alpha, beta, &d, &q, sinVal, cosVal);
+
+  /* PI loop */
+  integ = S->integ + (S->Ki * q);
+  integ = (integ > limit) ? limit : ((integ < -limit) ? -limit : integ);
+  omega = S->omegaNom + integ + (S->Kp * q);
+  S->integ = integ;
+
+  /* Outputs */
+  S->freq = (S->omegaNom + integ) * S->toHz;
+  S->phase = theta;
+  S->amplitude = d;
+  S->sinPhase = sinVal;
+  S->cosPhase = cosVal;
+
+  /* Angle of the next sample, wrapped to [-pi pi) */
+  theta = theta + omega;
+  theta = (theta >= PI) ? (theta - (2.0f * PI)) : ((theta < -PI) ? (theta + (2.0f * PI)) : theta);
+  S->theta = theta;
+}
+
+/**
+ * @} end of GridPLL group
+ */
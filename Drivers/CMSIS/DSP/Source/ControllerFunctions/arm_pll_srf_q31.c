@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pll_srf_q31.c
+ * Description:  Q31 three-phase synchronous reference frame phase-locked loop
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup GridPLL
+ * @{
+ */
+
+/**
+ * @brief  Q31 three-phase SRF PLL step.
+ * @param[in,out]   *S points to an instance of the Q31 PLL structure.
+ * @param[in]       va phase a voltage sample.
+ * @param[in]       vb phase b voltage sample.
+ * @param[in]       vc phase c voltage sample.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The voltages share one full scale and the gains are in units of that full scale.
+ * The angles are scaled so that [-1 1) maps to [-pi pi) and wrap around, the frequencies
+ * are relative to half the sampling rate.  The Clarke transform is computed in 2.62 format
+ * and saturated, which only happens for phase voltages beyond the amplitude of a balanced
+ * set at full scale.  The integrator of the loop is kept in 2.62 format so that small
+ * integral gains do not lose the low phase errors.  All the additions saturate, the Park
+ * transform is the one of arm_park_q31(), and the angle is converted with arm_sin_cos_q31().
+ */
+
+void arm_pll_srf_q31(
+  arm_pll_instance_q31 * S,
+  q31_t va,
+  q31_t vb,
+  q31_t vc)
+{
+  q31_t sinVal, cosVal;                          /* Sine and cosine of the loop angle */
+  q31_t alpha, beta, d, q;                       /* Stationary and rotating frame voltages */
+  q31_t freq, omega, theta;                      /* Loop frequency and angle */
+  q63_t integ;                                   /* Loop integrator */
+  q63_t limit = (q63_t) S->omegaNom << 30;       /* Limit of the integrator, half omegaNom */
+
+  theta = S->theta;
+  arm_sin_cos_q31(theta, &sinVal, &cosVal);
+
+  /* Clarke transform of the three phases, 1/3 and 1/sqrt(3) in 1.31 format */
+  alpha = clip_q63_to_q31(((((q63_t) va * 2) - vb - vc) * 0x2AAAAAAB) >> 31);
+  beta = clip_q63_to_q31((((q63_t) vb - vc) * 0x49E69D16) >> 31);
+
+  arm_park_q31(alpha, beta, &d, &q, sinVal, cosVal);
+
+  /* PI loop */
+  integ = S->integ + ((q63_t) S->Ki * q);
+  integ = (integ > limit) ? limit : ((integ < -limit) ? -limit : integ);
+  freq = S->omegaNom + (q31_t) (integ >> 31);
+  omega = __QADD(freq, (q31_t) (((q63_t) S->Kp * q) >> 31));
+  S->integ = integ;
+
+  /* Outputs */
+  S->freq = freq;
+  S->phase = theta;
+  S->amplitude = d;
+  S->sinPhase = sinVal;
+  S->cosPhase = cosVal;
+
+  /* Angle of the next sample, wraps around */
+  S->theta = (q31_t) ((uint32_t) theta + (uint32_t) omega);
+}
+
+/**
+ * @} end of GridPLL group
+ */
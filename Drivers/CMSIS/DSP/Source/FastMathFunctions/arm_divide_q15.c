@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_divide_q15.c
+ * Description:  Q15 fixed-point division
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup divide
+ * @{
+ */
+
+/**
+ * @brief  Fixed-point division for Q15 data.
+ * @param[in]       numerator numerator
+ * @param[in]       denominator denominator
+ * @param[out]      *quotient points to the quotient
+ * @param[out]      *shift points to the left shift of the quotient
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_NANINF if the
+ * denominator is 0.
+ *
+ * \par
+ * The result is <code>quotient * 2^shift</code>, shift is 0 to 16.
+ * If the denominator is 0, the quotient is saturated to the sign of the numerator
+ * and the shift is 0.
+ */
+
+arm_status arm_divide_q15(
+  q15_t numerator,
+  q15_t denominator,
+  q15_t * quotient,
+  int16_t * shift)
+{
+  uint32_t absNum, absDen;                       /* Magnitudes */
+  uint32_t normNum, normDen;                     /* Magnitudes normalized to [0.5 1) in 0.16 format */
+  uint32_t recip, tempVal;                       /* Reciprocal of normDen in 2.14 format, Newton-Raphson temporary */
+  uint32_t num, den;                             /* Scaled numerator and denominator of the remainder */
+  int32_t rem;                                   /* Remainder of the quotient */
+  uint32_t q, i;                                 /* Magnitude of the quotient, loop counter */
+  int32_t k, sh;                                 /* Difference of the normalization shifts, output shift */
+
+  *shift = 0;
+
+  if (denominator == 0)
+  {
+    *quotient = (numerator < 0) ? (q15_t) 0x8000 : (q15_t) 0x7FFF;
+    return (ARM_MATH_NANINF);
+  }
+
+  if (numerator == 0)
+  {
+    *quotient = 0;
+    return (ARM_MATH_SUCCESS);
+  }
+
+  absNum = (numerator > 0) ? (uint32_t) numerator : (uint32_t) (-(q31_t) numerator);
+  absDen = (denominator > 0) ? (uint32_t) denominator : (uint32_t) (-(q31_t) denominator);
+
+  /* Normalize both magnitudes to [0.5 1) */
+  k = (int32_t) __CLZ(absDen) - (int32_t) __CLZ(absNum);
+  normNum = absNum << (__CLZ(absNum) - 16U);
+  normDen = absDen << (__CLZ(absDen) - 16U);
+
+  /* 1 / normDen in (1 2], from 48/17 - 32/17 * normDen and two Newton-Raphson iterations */
+  recip = 46261U - ((normDen * 30840U) >> 16);
+  for (i = 0U; i < 2U; i++)
+  {
+    tempVal = 0x8000U - ((normDen * recip) >> 16);
+    recip = (recip * tempVal) >> 14;
+  }
+
+  /* The quotient of the magnitudes is in [2^(k-1) 2^(k+1)), the shift keeps it below 1 */
+  sh = (normNum >= normDen) ? (k + 1) : k;
+  sh = (sh > 0) ? sh : 0;
+
+  /* Estimate of absNum * 2^(15 - sh) / absDen, from normNum / normDen in 2.30 format */
+  q = (normNum * recip) >> (15 - k + sh);
+
+  /* Exact truncated quotient from the remainder */
+  num = absNum << 15;
+  den = absDen << sh;
+  rem = (int32_t) (num - (q * den));
+
+  while (rem < 0)
+  {
+    q--;
+    rem += (int32_t) den;
+  }
+
+  while (rem >= (int32_t) den)
+  {
+    q++;
+    rem -= (int32_t) den;
+  }
+
+  *quotient = ((numerator ^ denominator) < 0) ? (q15_t) -(q31_t) q : (q15_t) q;
+  *shift = (int16_t) sh;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of divide group
+ */
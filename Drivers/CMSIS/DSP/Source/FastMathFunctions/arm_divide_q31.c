@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_divide_q31.c
+ * Description:  Q31 fixed-point division
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup divide Fixed-point Division
+ *
+ * Divides two fixed-point values without a hardware or library division.
+ * There are separate functions for Q15 and Q31 data types, for one value and
+ * for a block of values.
+ *
+ * The quotient of one value is returned with a shift so that results of 1 and above
+ * can be represented: the result is <code>quotient * 2^shift</code>.  The shift is 0
+ * when the magnitude of the numerator is below the magnitude of the denominator.
+ * The quotient is the exact quotient truncated towards zero, the same value as the
+ * integer division <code>(numerator << (31 - shift)) / denominator</code> for Q31.
+ * The reciprocal of <code>d</code> is the quotient of the largest positive value by
+ * <code>d</code>.
+ *
+ * The block functions saturate the quotient to the range of the data type.
+ *
+ * The algorithm used is:
+ *  -# Both magnitudes are normalized to [0.5 1) with a count of leading zeros.
+ *  -# The reciprocal of the normalized denominator starts from the linear
+ *     approximation <code>48/17 - 32/17 * d</code> and is refined with Newton-Raphson
+ *     iterations <code>r = r * (2 - d * r)</code>, three for Q31 and two for Q15.
+ *  -# The product of the numerator by the reciprocal is corrected by one or a few
+ *     steps on the remainder to give the exact truncated quotient.
+ *
+ * The Q31 division replaces a 64 by 32 bit integer division, which is a library
+ * call on all Cortex-M cores.  The Q15 division only uses 32 bit arithmetic.
+ *
+ * The count of leading sign bits and the normalization of a value are available
+ * as inline functions, arm_cls_q31(), arm_cls_q15(), arm_norm_q31() and arm_norm_q15().
+ */
+
+/**
+ * @addtogroup divide
+ * @{
+ */
+
+/**
+ * @brief  Fixed-point division for Q31 data.
+ * @param[in]       numerator numerator
+ * @param[in]       denominator denominator
+ * @param[out]      *quotient points to the quotient
+ * @param[out]      *shift points to the left shift of the quotient
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_NANINF if the
+ * denominator is 0.
+ *
+ * \par
+ * The result is <code>quotient * 2^shift</code>, shift is 0 to 32.
+ * If the denominator is 0, the quotient is saturated to the sign of the numerator
+ * and the shift is 0.
+ */
+
+arm_status arm_divide_q31(
+  q31_t numerator,
+  q31_t denominator,
+  q31_t * quotient,
+  int16_t * shift)
+{
+  uint32_t absNum, absDen;                       /* Magnitudes */
+  uint32_t normNum, normDen;                     /* Magnitudes normalized to [0.5 1) in 0.32 format */
+  uint32_t recip, tempVal;                       /* Reciprocal of normDen in 2.30 format, Newton-Raphson temporary */
+  uint64_t num, den;                             /* Scaled numerator and denominator of the remainder */
+  int64_t rem;                                   /* Remainder of the quotient */
+  uint32_t q, i;                                 /* Magnitude of the quotient, loop counter */
+  int32_t k, sh;                                 /* Difference of the normalization shifts, output shift */
+
+  *shift = 0;
+
+  if (denominator == 0)
+  {
+    *quotient = (numerator < 0) ? INT32_MIN : INT32_MAX;
+    return (ARM_MATH_NANINF);
+  }
+
+  if (numerator == 0)
+  {
+    *quotient = 0;
+    return (ARM_MATH_SUCCESS);
+  }
+
+  absNum = (numerator > 0) ? (uint32_t) numerator : (0U - (uint32_t) numerator);
+  absDen = (denominator > 0) ? (uint32_t) denominator : (0U - (uint32_t) denominator);
+
+  /* Normalize both magnitudes to [0.5 1) */
+  k = (int32_t) __CLZ(absDen) - (int32_t) __CLZ(absNum);
+  normNum = absNum << __CLZ(absNum);
+  normDen = absDen << __CLZ(absDen);
+
+  /* 1 / normDen in (1 2], from 48/17 - 32/17 * normDen and three Newton-Raphson iterations */
+  recip = 0xB4B4B4B5U - (uint32_t) (((uint64_t) normDen * 0x78787878U) >> 32);
+  for (i = 0U; i < 3U; i++)
+  {
+    tempVal = 0x80000000U - (uint32_t) (((uint64_t) normDen * recip) >> 32);
+    recip = (uint32_t) (((uint64_t) recip * tempVal) >> 30);
+  }
+
+  /* The quotient of the magnitudes is in [2^(k-1) 2^(k+1)), the shift keeps it below 1 */
+  sh = (normNum >= normDen) ? (k + 1) : k;
+  sh = (sh > 0) ? sh : 0;
+
+  /* Estimate of absNum * 2^(31 - sh) / absDen, from normNum / normDen in 2.32 format */
+  q = (uint32_t) ((((uint64_t) normNum * recip) >> 30) >> (1 - k + sh));
+
+  /* Exact truncated quotient from the remainder */
+  num = (uint64_t) absNum << 31;
+  den = (uint64_t) absDen << sh;
+  rem = (int64_t) (num - ((uint64_t) q * den));
+
+  while (rem < 0)
+  {
+    q--;
+    rem += (int64_t) den;
+  }
+
+  while (rem >= (int64_t) den)
+  {
+    q++;
+    rem -= (int64_t) den;
+  }
+
+  *quotient = ((numerator ^ denominator) < 0) ? -(q31_t) q : (q31_t) q;
+  *shift = (int16_t) sh;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of divide group
+ */
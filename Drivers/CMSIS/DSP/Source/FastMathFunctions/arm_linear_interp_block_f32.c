@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_linear_interp_block_f32.c
+ * Description:  Floating-point block linear interpolation in a uniform table
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup LinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Floating-point linear interpolation of one point in a uniform table.
+ * @param[in]       x input point
+ * @param[in]       x1 first point of the table
+ * @param[in]       invSpacing inverse of the spacing of the table
+ * @param[in]       *pYData points to the table
+ * @param[in]       lastIndex index of the last value of the table
+ * @return interpolated value.
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_linear_interp_point_f32(
+  float32_t x,
+  float32_t x1,
+  float32_t invSpacing,
+  const float32_t * pYData,
+  uint32_t lastIndex)
+{
+  float32_t pos;                                 /* Position in the table, in spacings */
+  uint32_t i;                                    /* Index of the segment */
+
+  pos = (x - x1) * invSpacing;
+
+  /* Clamp before the conversion to an index, which is undefined for a NaN or a position
+     out of the uint32_t range.  A NaN position returns the first value. */
+  if (pos >= (float32_t) lastIndex)
+  {
+    return (pYData[lastIndex]);
+  }
+
+  if (!(pos > 0.0f))
+  {
+    return (pYData[0]);
+  }
+
+  i = (uint32_t) pos;
+
+  /* y = y0 + (y1 - y0) * fract */
+  return (pYData[i] + ((pYData[i + 1U] - pYData[i]) * (pos - (float32_t) i)));
+}
+
+/**
+ * @brief  Floating-point linear interpolation of a block of points in a uniform table.
+ * @param[in]       *S points to an instance of the floating-point Linear Interpolation structure.
+ * @param[in]       *pSrc points to the block of input points.
+ * @param[out]      *pDst points to the block of interpolated values.
+ * @param[in]       blockSize number of points to process.
+ * @return none.
+ *
+ * \par
+ * The block version of arm_linear_interp_f32().  The division by the spacing is replaced
+ * by a multiplication with its inverse, computed once per block.  The points below the
+ * table return its first value and the points at or above its last point return its
+ * last value.  A NaN point returns the first value.
+ */
+
+void arm_linear_interp_block_f32(
+  const arm_linear_interp_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  const float32_t *pYData = S->pYData;           /* Table of values */
+  float32_t x1 = S->x1;                          /* First point of the table */
+  float32_t invSpacing = 1.0f / S->xSpacing;     /* Inverse of the spacing */
+  uint32_t lastIndex = S->nValues - 1U;          /* Index of the last value */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = interp(A) */
+    pDst[0] = arm_linear_interp_point_f32(pSrc[0], x1, invSpacing, pYData, lastIndex);
+    pDst[1] = arm_linear_interp_point_f32(pSrc[1], x1, invSpacing, pYData, lastIndex);
+    pDst[2] = arm_linear_interp_point_f32(pSrc[2], x1, invSpacing, pYData, lastIndex);
+    pDst[3] = arm_linear_interp_point_f32(pSrc[3], x1, invSpacing, pYData, lastIndex);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = interp(A) */
+    *pDst++ = arm_linear_interp_point_f32(*pSrc++, x1, invSpacing, pYData, lastIndex);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of LinearInterpolate group
+ */
@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_linear_interp_block_q31.c
+ * Description:  Q31 block linear interpolation in a uniform table
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup LinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Q31 linear interpolation of a block of points in a uniform table.
+ * @param[in]       *pYData points to the Q31 table.
+ * @param[in]       *pSrc points to the block of input points, in 12.20 format.
+ * @param[out]      *pDst points to the block of interpolated values.
+ * @param[in]       nValues number of table values.
+ * @param[in]       blockSize number of points to process.
+ * @return none.
+ *
+ * \par
+ * The block version of arm_linear_interp_q31(), with the same input format and results.
+ */
+
+void arm_linear_interp_block_q31(
+  q31_t * pYData,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t nValues,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = interp(A) */
+    pDst[0] = arm_linear_interp_q31(pYData, pSrc[0], nValues);
+    pDst[1] = arm_linear_interp_q31(pYData, pSrc[1], nValues);
+    pDst[2] = arm_linear_interp_q31(pYData, pSrc[2], nValues);
+    pDst[3] = arm_linear_interp_q31(pYData, pSrc[3], nValues);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = interp(A) */
+    *pDst++ = arm_linear_interp_q31(pYData, *pSrc++, nValues);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of LinearInterpolate group
+ */
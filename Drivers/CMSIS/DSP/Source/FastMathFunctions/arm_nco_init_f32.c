@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_init_f32.c
+ * Description:  Initialization function for the floating-point numerically controlled oscillator
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup NCO Numerically Controlled Oscillator
+ *
+ * Generates a sine wave, or the complex exponential <code>cos(phase) + j sin(phase)</code>, from
+ * a phase accumulator, and mixes a signal with it.  The same oscillator serves the synthesis of
+ * waveforms for a DAC and the down-conversion of a real or complex signal to baseband.
+ *
+ * \par Phase accumulator
+ * The phase is a 32-bit unsigned integer, 2^32 being one period, increased by <code>phaseInc</code>
+ * at each sample and wrapping without error.  The frequency is <code>phaseInc * fs / 2^32</code>,
+ * with a resolution of <code>fs / 2^32</code>, and never drifts.  The phase of the instance is
+ * updated at the end of each block: successive blocks are continuous.
+ *
+ * \par
+ * The Q31 functions take the frequency and the phase as Q31 values directly in this format: the
+ * frequency is normalized to half the sample rate, the phase is divided by pi, as the output of
+ * arm_vatan2_q31().
+ *
+ * \par Algorithm
+ * The sine and the cosine are read from the 512 entry table of arm_sin_f32() at the entry
+ * nearest to the phase, and corrected to the second order for the offset <code>d</code> from the
+ * entry, <code>|d| <= pi/512</code>:
+ * <pre>
+ *     sin(a + d) = sin(a) (1 - d^2/2) + cos(a) d
+ *     cos(a + d) = cos(a) (1 - d^2/2) - sin(a) d
+ * </pre>
+ * The error of the correction is less than <code>d^3/6 = 4e-8</code>.  The maximum error of the
+ * floating-point outputs is 1.2e-7, and of the Q31 outputs 4e-8.  The spurious components are more
+ * than 130 dB below the carrier, with no recursion to renormalize.  All the functions share the
+ * inline kernels arm_nco_sincos_f32() and arm_nco_sincos_q31().
+ *
+ * \par Mixing
+ * arm_nco_mix_f32() multiplies a real input by the complex output of the oscillator, and
+ * arm_nco_mix_cmplx_f32() a complex input.  The spectrum of the input is shifted by the frequency
+ * of the oscillator: a negative frequency moves a carrier down to baseband.
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point oscillator.
+ * @param[in,out]   *S points to an instance of the floating-point oscillator structure.
+ * @param[in]       frequency frequency of the oscillator, in Hz, negative for a clockwise rotation.
+ * @param[in]       sampleRate sample rate, in Hz.
+ * @param[in]       phase phase of the first output, in radians.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>sampleRate</code> is not positive.
+ */
+
+arm_status arm_nco_init_f32(
+  arm_nco_instance_f32 * S,
+  float32_t frequency,
+  float32_t sampleRate,
+  float32_t phase)
+{
+  float32_t cycles;                              /* Phase in periods */
+
+  /* Fractional part of the phase in periods, in (-1 1) */
+  cycles = phase * 0.159154943092f;
+  cycles = cycles - (float32_t) ((int32_t) cycles);
+
+  S->phase = (uint32_t) (q63_t) (cycles * 4294967296.0f);
+
+  return (arm_nco_set_frequency_f32(S, frequency, sampleRate));
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_init_q31.c
+ * Description:  Initialization function for the Q31 numerically controlled oscillator
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 oscillator.
+ * @param[in,out]   *S points to an instance of the Q31 oscillator structure.
+ * @param[in]       frequency frequency of the oscillator divided by half the sample rate, negative for a clockwise rotation.
+ * @param[in]       phase phase of the first output divided by pi.
+ * @return none.
+ *
+ * \par
+ * Both values are used as the phase increment and the phase of the accumulator.  The frequency can be changed
+ * at any time, without a jump of the phase, by writing <code>S->phaseInc</code>.
+ */
+
+void arm_nco_init_q31(
+  arm_nco_instance_q31 * S,
+  q31_t frequency,
+  q31_t phase)
+{
+  S->phaseInc = (uint32_t) frequency;
+  S->phase = (uint32_t) phase;
+}
+
+/**
+ * @} end of NCO group
+ */
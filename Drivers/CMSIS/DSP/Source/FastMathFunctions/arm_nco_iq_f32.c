@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_iq_f32.c
+ * Description:  Complex output of the floating-point numerically controlled oscillator
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Generates a block of the complex output of the floating-point oscillator.
+ * @param[in,out]   *S points to an instance of the floating-point oscillator structure.
+ * @param[out]      *pDst points to the interleaved output, cos(phase) + j sin(phase), 2*blockSize values.
+ * @param[in]       blockSize number of samples to process.
+ * @return none.
+ */
+
+void arm_nco_iq_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* y = cos(phase) + j sin(phase) */
+    arm_nco_sincos_f32(phase, &pDst[1], &pDst[0]);
+    phase += phaseInc;
+    arm_nco_sincos_f32(phase, &pDst[3], &pDst[2]);
+    phase += phaseInc;
+    arm_nco_sincos_f32(phase, &pDst[5], &pDst[4]);
+    phase += phaseInc;
+    arm_nco_sincos_f32(phase, &pDst[7], &pDst[6]);
+    phase += phaseInc;
+
+    pDst += 8U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* y = cos(phase) + j sin(phase) */
+    arm_nco_sincos_f32(phase, &pDst[1], &pDst[0]);
+    phase += phaseInc;
+    pDst += 2U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->phase = phase;
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_mix_cmplx_f32.c
+ * Description:  Mixing of a floating-point complex signal by the numerically controlled oscillator
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Mixes a block of a complex floating-point signal with the oscillator.
+ * @param[in,out]   *S points to an instance of the floating-point oscillator structure.
+ * @param[in]       *pSrc points to the interleaved complex input, 2*blockSize values.
+ * @param[out]      *pDst points to the interleaved complex output, 2*blockSize values.
+ * @param[in]       blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The spectrum of the input is shifted by the frequency of the oscillator.  The input and the output can be the same buffer.
+ */
+
+void arm_nco_mix_cmplx_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment */
+  float32_t s, c;                                /* Sine and cosine of the phase */
+  float32_t a, b;                                /* Real and imaginary parts of the input */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* y = (a + j b) * (cos(phase) + j sin(phase)) */
+    a = pSrc[0];
+    b = pSrc[1];
+    arm_nco_sincos_f32(phase, &s, &c);
+    pDst[0] = (a * c) - (b * s);
+    pDst[1] = (a * s) + (b * c);
+    phase += phaseInc;
+    a = pSrc[2];
+    b = pSrc[3];
+    arm_nco_sincos_f32(phase, &s, &c);
+    pDst[2] = (a * c) - (b * s);
+    pDst[3] = (a * s) + (b * c);
+    phase += phaseInc;
+    a = pSrc[4];
+    b = pSrc[5];
+    arm_nco_sincos_f32(phase, &s, &c);
+    pDst[4] = (a * c) - (b * s);
+    pDst[5] = (a * s) + (b * c);
+    phase += phaseInc;
+    a = pSrc[6];
+    b = pSrc[7];
+    arm_nco_sincos_f32(phase, &s, &c);
+    pDst[6] = (a * c) - (b * s);
+    pDst[7] = (a * s) + (b * c);
+    phase += phaseInc;
+
+    pSrc += 8U;
+    pDst += 8U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* y = (a + j b) * (cos(phase) + j sin(phase)) */
+    a = pSrc[0];
+    b = pSrc[1];
+    arm_nco_sincos_f32(phase, &s, &c);
+    pDst[0] = (a * c) - (b * s);
+    pDst[1] = (a * s) + (b * c);
+    phase += phaseInc;
+
+    pSrc += 2U;
+    pDst += 2U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->phase = phase;
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_mix_cmplx_q31.c
+ * Description:  Mixing of a Q31 complex signal by the numerically controlled oscillator
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Mixes a block of a complex Q31 signal with the oscillator.
+ * @param[in,out]   *S points to an instance of the Q31 oscillator structure.
+ * @param[in]       *pSrc points to the interleaved complex input, 2*blockSize values.
+ * @param[out]      *pDst points to the interleaved complex output, 2*blockSize values.
+ * @param[in]       blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The spectrum of the input is shifted by the frequency of the oscillator.  The input and the output can be the same buffer.
+ * The outputs saturate when the magnitude of the input is above 1.
+ */
+
+void arm_nco_mix_cmplx_q31(
+  arm_nco_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment */
+  q31_t s, c;                                    /* Sine and cosine of the phase */
+  q31_t a, b;                                    /* Real and imaginary parts of the input */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* y = (a + j b) * (cos(phase) + j sin(phase)) */
+    a = pSrc[0];
+    b = pSrc[1];
+    arm_nco_sincos_q31(phase, &s, &c);
+    pDst[0] = clip_q63_to_q31((((q63_t) a * c) - ((q63_t) b * s)) >> 31);
+    pDst[1] = clip_q63_to_q31((((q63_t) a * s) + ((q63_t) b * c)) >> 31);
+    phase += phaseInc;
+    a = pSrc[2];
+    b = pSrc[3];
+    arm_nco_sincos_q31(phase, &s, &c);
+    pDst[2] = clip_q63_to_q31((((q63_t) a * c) - ((q63_t) b * s)) >> 31);
+    pDst[3] = clip_q63_to_q31((((q63_t) a * s) + ((q63_t) b * c)) >> 31);
+    phase += phaseInc;
+    a = pSrc[4];
+    b = pSrc[5];
+    arm_nco_sincos_q31(phase, &s, &c);
+    pDst[4] = clip_q63_to_q31((((q63_t) a * c) - ((q63_t) b * s)) >> 31);
+    pDst[5] = clip_q63_to_q31((((q63_t) a * s) + ((q63_t) b * c)) >> 31);
+    phase += phaseInc;
+    a = pSrc[6];
+    b = pSrc[7];
+    arm_nco_sincos_q31(phase, &s, &c);
+    pDst[6] = clip_q63_to_q31((((q63_t) a * c) - ((q63_t) b * s)) >> 31);
+    pDst[7] = clip_q63_to_q31((((q63_t) a * s) + ((q63_t) b * c)) >> 31);
+    phase += phaseInc;
+
+    pSrc += 8U;
+    pDst += 8U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* y = (a + j b) * (cos(phase) + j sin(phase)) */
+    a = pSrc[0];
+    b = pSrc[1];
+    arm_nco_sincos_q31(phase, &s, &c);
+    pDst[0] = clip_q63_to_q31((((q63_t) a * c) - ((q63_t) b * s)) >> 31);
+    pDst[1] = clip_q63_to_q31((((q63_t) a * s) + ((q63_t) b * c)) >> 31);
+    phase += phaseInc;
+
+    pSrc += 2U;
+    pDst += 2U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->phase = phase;
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_real_q15.c
+ * Description:  Q15 real output of the numerically controlled oscillator
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Generates a block of the real output of the oscillator in Q15 format.
+ * @param[in,out]   *S points to an instance of the Q31 oscillator structure.
+ * @param[out]      *pDst points to the output, cos(phase), blockSize values.
+ * @param[in]       blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * For the sample streams of DACs: the output is rounded from the Q31 output.
+ */
+
+void arm_nco_real_q15(
+  arm_nco_instance_q31 * S,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment */
+  q31_t s, c;                                    /* Sine and cosine of the phase */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* y = cos(phase), rounded to 16 bits */
+    arm_nco_sincos_q31(phase, &s, &c);
+    pDst[0] = (q15_t) __SSAT((q31_t) (((q63_t) c + 0x8000) >> 16), 16);
+    phase += phaseInc;
+    arm_nco_sincos_q31(phase, &s, &c);
+    pDst[1] = (q15_t) __SSAT((q31_t) (((q63_t) c + 0x8000) >> 16), 16);
+    phase += phaseInc;
+    arm_nco_sincos_q31(phase, &s, &c);
+    pDst[2] = (q15_t) __SSAT((q31_t) (((q63_t) c + 0x8000) >> 16), 16);
+    phase += phaseInc;
+    arm_nco_sincos_q31(phase, &s, &c);
+    pDst[3] = (q15_t) __SSAT((q31_t) (((q63_t) c + 0x8000) >> 16), 16);
+    phase += phaseInc;
+
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* y = cos(phase), rounded to 16 bits */
+    arm_nco_sincos_q31(phase, &s, &c);
+    *pDst++ = (q15_t) __SSAT((q31_t) (((q63_t) c + 0x8000) >> 16), 16);
+    phase += phaseInc;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->phase = phase;
+}
+
+/**
+ * @} end of NCO group
+ */
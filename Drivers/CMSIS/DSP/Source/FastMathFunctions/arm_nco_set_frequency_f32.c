@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_set_frequency_f32.c
+ * Description:  Frequency of the floating-point numerically controlled oscillator
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Sets the frequency of the floating-point oscillator.
+ * @param[in,out]   *S points to an instance of the floating-point oscillator structure.
+ * @param[in]       frequency frequency of the oscillator, in Hz, negative for a clockwise rotation.
+ * @param[in]       sampleRate sample rate, in Hz.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>sampleRate</code> is not positive.
+ *
+ * \par
+ * The phase is kept: the output is continuous across the change.  The frequency is rounded to a multiple of
+ * <code>sampleRate / 2^32</code> within the single precision of the ratio <code>frequency / sampleRate</code>.
+ * Frequencies above half the sample rate alias.
+ */
+
+arm_status arm_nco_set_frequency_f32(
+  arm_nco_instance_f32 * S,
+  float32_t frequency,
+  float32_t sampleRate)
+{
+  float32_t cycles;                              /* Fraction of a period per sample */
+
+  if (sampleRate <= 0.0f)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Remove the whole multiples of the sample rate before the division, to keep the precision
+   ** of the fractional part in (-1 1).  The 2^32 wrap of the phase aliases the rest. */
+  cycles = frequency / sampleRate;
+  cycles = (frequency - (sampleRate * (float32_t) ((int32_t) cycles))) / sampleRate;
+
+  S->phaseInc = (uint32_t) (q63_t) (cycles * 4294967296.0f);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of NCO group
+ */
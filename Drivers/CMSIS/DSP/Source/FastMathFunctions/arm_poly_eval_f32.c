@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_poly_eval_f32.c
+ * Description:  Floating-point polynomial evaluation of a vector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup PolyEval Polynomial Evaluation
+ *
+ * Evaluates a polynomial at each element of a vector with the Horner scheme:
+ * <pre>
+ *     pDst[n] = pCoeffs[0] + pSrc[n] * (pCoeffs[1] + pSrc[n] * (... + pSrc[n] * pCoeffs[order]))
+ * </pre>
+ * The coefficients are stored constant term first, as returned by arm_polyfit_f32().
+ * Four elements are evaluated together so that each coefficient is loaded once for
+ * four multiply-accumulates.
+ *
+ * \par Fixed-Point Behavior
+ * In the Q31 version, the inputs are in 1.31 format and the coefficients are scaled down by
+ * <code>2^postShift</code> so that they, and every partial Horner sum, fit in 1.31 format.
+ * The products are truncated to 1.31 format and the additions saturate.  The result is
+ * shifted left by <code>postShift</code> and saturated.  The Q31 coefficients of a polynomial
+ * fitted in floating-point are obtained with arm_scale_f32() by <code>2^-postShift</code>
+ * and arm_float_to_q31().
+ */
+
+/**
+ * @addtogroup PolyEval
+ * @{
+ */
+
+/**
+ * @brief  Floating-point polynomial evaluation.
+ * @param[in]       *pCoeffs points to the order + 1 coefficients, constant term first.
+ * @param[in]       order order of the polynomial.
+ * @param[in]       *pSrc points to the input vector.
+ * @param[out]      *pDst points to the output vector.
+ * @param[in]       blockSize number of samples in the vectors.
+ * @return none.
+ */
+
+void arm_poly_eval_f32(
+  const float32_t * pCoeffs,
+  uint16_t order,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x0, acc0;                            /* Input and accumulator */
+  uint32_t blkCnt;                               /* loop counter */
+  int32_t k;                                     /* Coefficient index */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  float32_t x1, x2, x3;                          /* Inputs */
+  float32_t acc1, acc2, acc3;                    /* Accumulators */
+  float32_t coef;                                /* Current coefficient */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    x0 = pSrc[0];
+    x1 = pSrc[1];
+    x2 = pSrc[2];
+    x3 = pSrc[3];
+
+    coef = pCoeffs[order];
+    acc0 = coef;
+    acc1 = coef;
+    acc2 = coef;
+    acc3 = coef;
+
+    for (k = (int32_t) order - 1; k >= 0; k--)
+    {
+      /* acc = acc * x + c[k] */
+      coef = pCoeffs[k];
+      acc0 = (acc0 * x0) + coef;
+      acc1 = (acc1 * x1) + coef;
+      acc2 = (acc2 * x2) + coef;
+      acc3 = (acc3 * x3) + coef;
+    }
+
+    pDst[0] = acc0;
+    pDst[1] = acc1;
+    pDst[2] = acc2;
+    pDst[3] = acc3;
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    x0 = *pSrc++;
+    acc0 = pCoeffs[order];
+
+    for (k = (int32_t) order - 1; k >= 0; k--)
+    {
+      /* acc = acc * x + c[k] */
+      acc0 = (acc0 * x0) + pCoeffs[k];
+    }
+
+    *pDst++ = acc0;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of PolyEval group
+ */
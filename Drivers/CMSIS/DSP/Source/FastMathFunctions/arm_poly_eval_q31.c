@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_poly_eval_q31.c
+ * Description:  Q31 polynomial evaluation of a vector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup PolyEval
+ * @{
+ */
+
+/**
+ * @brief  Q31 polynomial evaluation.
+ * @param[in]       *pCoeffs points to the order + 1 coefficients, constant term first, scaled by 2^-postShift.
+ * @param[in]       order order of the polynomial.
+ * @param[in]       postShift left shift of the result, from 0 to 31.
+ * @param[in]       *pSrc points to the input vector.
+ * @param[out]      *pDst points to the output vector.
+ * @param[in]       blockSize number of samples in the vectors.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The inputs and the coefficients are in 1.31 format and the partial sums saturate to
+ * 1.31 format.  The result is shifted left by <code>postShift</code> bits and saturated.
+ */
+
+void arm_poly_eval_q31(
+  const q31_t * pCoeffs,
+  uint16_t order,
+  uint8_t postShift,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t x0, acc0;                                /* Input and accumulator */
+  uint32_t blkCnt;                               /* loop counter */
+  int32_t k;                                     /* Coefficient index */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  q31_t x1, x2, x3;                              /* Inputs */
+  q31_t acc1, acc2, acc3;                        /* Accumulators */
+  q31_t coef;                                    /* Current coefficient */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    x0 = pSrc[0];
+    x1 = pSrc[1];
+    x2 = pSrc[2];
+    x3 = pSrc[3];
+
+    coef = pCoeffs[order];
+    acc0 = coef;
+    acc1 = coef;
+    acc2 = coef;
+    acc3 = coef;
+
+    for (k = (int32_t) order - 1; k >= 0; k--)
+    {
+      /* acc = acc * x + c[k] */
+      coef = pCoeffs[k];
+      acc0 = __QADD((q31_t) (((q63_t) acc0 * x0) >> 31), coef);
+      acc1 = __QADD((q31_t) (((q63_t) acc1 * x1) >> 31), coef);
+      acc2 = __QADD((q31_t) (((q63_t) acc2 * x2) >> 31), coef);
+      acc3 = __QADD((q31_t) (((q63_t) acc3 * x3) >> 31), coef);
+    }
+
+    pDst[0] = clip_q63_to_q31((q63_t) acc0 << postShift);
+    pDst[1] = clip_q63_to_q31((q63_t) acc1 << postShift);
+    pDst[2] = clip_q63_to_q31((q63_t) acc2 << postShift);
+    pDst[3] = clip_q63_to_q31((q63_t) acc3 << postShift);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    x0 = *pSrc++;
+    acc0 = pCoeffs[order];
+
+    for (k = (int32_t) order - 1; k >= 0; k--)
+    {
+      /* acc = acc * x + c[k] */
+      acc0 = __QADD((q31_t) (((q63_t) acc0 * x0) >> 31), pCoeffs[k]);
+    }
+
+    *pDst++ = clip_q63_to_q31((q63_t) acc0 << postShift);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of PolyEval group
+ */
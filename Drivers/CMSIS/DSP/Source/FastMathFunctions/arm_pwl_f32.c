@@ -0,0 +1,237 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pwl_f32.c
+ * Description:  Floating-point piecewise linear interpolation
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @defgroup PiecewiseLinear Piecewise Linear Interpolation
+ *
+ * Interpolates blocks of points through a table of breakpoints that need not be
+ * evenly spaced, such as the calibration curve of a sensor.
+ *
+ * \par
+ * The table holds <code>nValues</code> breakpoints <code>x[i]</code>, strictly increasing,
+ * and the values <code>y[i]</code> at the breakpoints.  The initialization function computes
+ * the slope of each segment, so that each point costs one multiplication:
+ * <pre>
+ *     y = y[i] + slope[i] * (x - x[i])      for x[i] <= x < x[i+1]
+ * </pre>
+ * The points below the first breakpoint return <code>y[0]</code> and the points at or above
+ * the last one return <code>y[nValues-1]</code>.
+ *
+ * \par Segment lookup
+ * The segment of each point is found either by a binary search, in <code>log2(nValues)</code>
+ * steps, or through an index built by the initialization function.  The index divides the
+ * range of the input into evenly spaced bins and holds the first segment of each bin: the
+ * lookup is then one multiplication and a short linear scan.  With at least as many bins as
+ * segments and a table without large gaps, the scan rarely goes past one segment.  Pass a
+ * NULL index to select the binary search.
+ *
+ * \par
+ * The floating-point index covers the range of the breakpoints.  The Q15 index covers the
+ * whole Q15 range with <code>2^indexBits</code> bins.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 slopes are in 17.15 format, rounded.  The error of an interpolated value is at
+ * most <code>0.5 + dx / 65536</code> LSB, where <code>dx</code> is the width of its segment
+ * in Q15 codes: 1 LSB for the segments up to 32768 codes wide and 1.5 LSB for a single
+ * segment over the whole Q15 range.  The result saturates to Q15.
+ *
+ * \par
+ * The tables are not copied: they must stay valid while the instance is used.
+ */
+
+/**
+ * @addtogroup PiecewiseLinear
+ * @{
+ */
+
+/**
+ * @brief  Finds the segment of a point in a table of breakpoints.
+ * @param[in]       *pXData points to the breakpoints, strictly increasing.
+ * @param[in]       nValues number of breakpoints, at least 2.
+ * @param[in]       *pIndex points to the index, or NULL for a binary search.
+ * @param[in]       indexLen number of bins of the index.
+ * @param[in]       indexScale number of bins of the index per unit of x.
+ * @param[in]       x point, in <code>[pXData[0] pXData[nValues-1])</code>.
+ * @return the index <code>i</code> of the segment, <code>pXData[i] <= x < pXData[i+1]</code>.
+ *
+ * \par
+ * Shared with the cubic spline interpolation.
+ */
+
+uint32_t arm_interp_segment_f32(
+  const float32_t * pXData,
+  uint32_t nValues,
+  const uint16_t * pIndex,
+  uint32_t indexLen,
+  float32_t indexScale,
+  float32_t x)
+{
+  float32_t pos;                                 /* Position in the index, in bins */
+  uint32_t lo, hi, mid;                          /* Bounds of the search */
+
+  if (pIndex != NULL)
+  {
+    pos = (x - pXData[0]) * indexScale;
+    mid = (pos > 0.0f) ? (uint32_t) pos : 0U;
+    mid = (mid < indexLen) ? mid : (indexLen - 1U);
+    lo = pIndex[mid];
+
+    /* The rounding of pos can select the next bin */
+    while ((lo > 0U) && (x < pXData[lo]))
+    {
+      lo--;
+    }
+    while ((lo < (nValues - 2U)) && (x >= pXData[lo + 1U]))
+    {
+      lo++;
+    }
+
+    return (lo);
+  }
+
+  /* Binary search, pXData[lo] <= x < pXData[hi] */
+  lo = 0U;
+  hi = nValues - 1U;
+  while ((hi - lo) > 1U)
+  {
+    mid = (lo + hi) >> 1U;
+    if (x >= pXData[mid])
+    {
+      lo = mid;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+
+  return (lo);
+}
+
+/**
+ * @brief  Floating-point piecewise linear interpolation of one point.
+ * @param[in]       *S points to an instance of the floating-point piecewise linear interpolation.
+ * @param[in]       x input point.
+ * @return interpolated value.
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_pwl_point_f32(
+  const arm_pwl_instance_f32 * S,
+  float32_t x)
+{
+  const float32_t *pX = S->pXData;               /* Breakpoints */
+  uint32_t last = S->nValues - 1U;               /* Index of the last breakpoint */
+  uint32_t i;                                    /* Index of the segment */
+
+  if (x <= pX[0])
+  {
+    return (S->pYData[0]);
+  }
+  if (x >= pX[last])
+  {
+    return (S->pYData[last]);
+  }
+
+  i = arm_interp_segment_f32(pX, S->nValues, S->pIndex, S->indexLen, S->indexScale, x);
+
+  return (S->pYData[i] + (S->pSlopes[i] * (x - pX[i])));
+}
+
+/**
+ * @brief  Floating-point piecewise linear interpolation of a block of points.
+ * @param[in]       *S points to an instance of the floating-point piecewise linear interpolation.
+ * @param[in]       *pSrc points to the block of input points.
+ * @param[out]      *pDst points to the block of interpolated values.
+ * @param[in]       blockSize number of points to process.
+ * @return none.
+ */
+
+void arm_pwl_f32(
+  const arm_pwl_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = pwl(A) */
+    pDst[0] = arm_pwl_point_f32(S, pSrc[0]);
+    pDst[1] = arm_pwl_point_f32(S, pSrc[1]);
+    pDst[2] = arm_pwl_point_f32(S, pSrc[2]);
+    pDst[3] = arm_pwl_point_f32(S, pSrc[3]);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = pwl(A) */
+    *pDst++ = arm_pwl_point_f32(S, *pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of PiecewiseLinear group
+ */
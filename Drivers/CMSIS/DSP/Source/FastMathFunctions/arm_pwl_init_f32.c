@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pwl_init_f32.c
+ * Description:  Floating-point piecewise linear interpolation initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup PiecewiseLinear
+ * @{
+ */
+
+/**
+ * @brief  Checks the breakpoints and builds the index of a floating-point table.
+ * @param[in]       *pXData points to the breakpoints.
+ * @param[in]       nValues number of breakpoints.
+ * @param[out]      *pIndex points to the index, or NULL for a binary search.
+ * @param[in]       indexLen number of bins of the index.
+ * @param[out]      *pIndexScale points to the number of bins per unit of x.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the breakpoints are not
+ * strictly increasing, if there are less than 2 of them, or if the index is empty or
+ * has more than 65536 segments to address.
+ *
+ * \par
+ * Shared with the cubic spline interpolation.
+ */
+
+arm_status arm_interp_index_init_f32(
+  const float32_t * pXData,
+  uint32_t nValues,
+  uint16_t * pIndex,
+  uint32_t indexLen,
+  float32_t * pIndexScale)
+{
+  float32_t scale;                               /* Bins per unit of x */
+  float32_t xb;                                  /* Start of the current bin */
+  uint32_t seg;                                  /* Current segment */
+  uint32_t i;                                    /* Loop counter */
+
+  if (nValues < 2U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 1U; i < nValues; i++)
+  {
+    if (!(pXData[i] > pXData[i - 1U]))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  *pIndexScale = 0.0f;
+
+  if (pIndex == NULL)
+  {
+    return (ARM_MATH_SUCCESS);
+  }
+
+  if ((indexLen == 0U) || (nValues > 0x10001U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  scale = (float32_t) indexLen / (pXData[nValues - 1U] - pXData[0]);
+
+  /* Last segment starting at or before each bin */
+  seg = 0U;
+  for (i = 0U; i < indexLen; i++)
+  {
+    xb = pXData[0] + ((float32_t) i / scale);
+    while ((seg < (nValues - 2U)) && (xb >= pXData[seg + 1U]))
+    {
+      seg++;
+    }
+    pIndex[i] = (uint16_t) seg;
+  }
+
+  *pIndexScale = scale;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Initialization function for the floating-point piecewise linear interpolation.
+ * @param[out]      *S points to an instance of the floating-point piecewise linear interpolation.
+ * @param[in]       nValues number of breakpoints, at least 2.
+ * @param[in]       *pXData points to the breakpoints, strictly increasing.
+ * @param[in]       *pYData points to the values at the breakpoints.
+ * @param[out]      *pSlopes points to the slopes of the segments, nValues-1 values.
+ * @param[out]      *pIndex points to the index, indexLen values, or NULL for a binary search.
+ * @param[in]       indexLen number of bins of the index, ignored without an index.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the breakpoints are not
+ * strictly increasing, if there are less than 2 of them, or if the index is empty.
+ */
+
+arm_status arm_pwl_init_f32(
+  arm_pwl_instance_f32 * S,
+  uint32_t nValues,
+  const float32_t * pXData,
+  const float32_t * pYData,
+  float32_t * pSlopes,
+  uint16_t * pIndex,
+  uint32_t indexLen)
+{
+  uint32_t i;                                    /* Loop counter */
+
+  if (arm_interp_index_init_f32(pXData, nValues, pIndex, indexLen, &S->indexScale) != ARM_MATH_SUCCESS)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0U; i < (nValues - 1U); i++)
+  {
+    pSlopes[i] = (pYData[i + 1U] - pYData[i]) / (pXData[i + 1U] - pXData[i]);
+  }
+
+  S->nValues = nValues;
+  S->pXData = pXData;
+  S->pYData = pYData;
+  S->pSlopes = pSlopes;
+  S->pIndex = pIndex;
+  S->indexLen = indexLen;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of PiecewiseLinear group
+ */
@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pwl_init_q15.c
+ * Description:  Q15 piecewise linear interpolation initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup PiecewiseLinear
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 piecewise linear interpolation.
+ * @param[out]      *S points to an instance of the Q15 piecewise linear interpolation.
+ * @param[in]       nValues number of breakpoints, at least 2.
+ * @param[in]       *pXData points to the breakpoints, strictly increasing.
+ * @param[in]       *pYData points to the values at the breakpoints.
+ * @param[out]      *pSlopes points to the slopes of the segments, nValues-1 values.
+ * @param[out]      *pIndex points to the index, 2^indexBits values, or NULL for a binary search.
+ * @param[in]       indexBits the index has 2^indexBits bins, from 1 to 16.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the breakpoints are not
+ * strictly increasing, if there are less than 2 of them, or if indexBits is out of range.
+ *
+ * \par
+ * The slopes are rounded to 17.15 format.  Bin <code>k</code> of the index starts at
+ * <code>-32768 + k * 2^(16 - indexBits)</code>.
+ */
+
+arm_status arm_pwl_init_q15(
+  arm_pwl_instance_q15 * S,
+  uint32_t nValues,
+  const q15_t * pXData,
+  const q15_t * pYData,
+  q31_t * pSlopes,
+  uint16_t * pIndex,
+  uint8_t indexBits)
+{
+  q63_t num;                                     /* Rise of a segment, 17.15 format */
+  int32_t dx;                                    /* Run of a segment */
+  int32_t xb;                                    /* Start of the current bin */
+  uint32_t seg;                                  /* Current segment */
+  uint32_t i;                                    /* Loop counter */
+
+  if ((nValues < 2U) || ((pIndex != NULL) && ((indexBits == 0U) || (indexBits > 16U))))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0U; i < (nValues - 1U); i++)
+  {
+    dx = (int32_t) pXData[i + 1U] - pXData[i];
+    if (dx <= 0)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* Rounded (dy << 15) / dx */
+    num = (q63_t) ((int32_t) pYData[i + 1U] - pYData[i]) << 15;
+    num += (num >= 0) ? (dx >> 1) : -(dx >> 1);
+    pSlopes[i] = (q31_t) (num / dx);
+  }
+
+  if (pIndex != NULL)
+  {
+    /* Last segment starting at or before each bin */
+    seg = 0U;
+    for (i = 0U; i < (1UL << indexBits); i++)
+    {
+      xb = -32768 + (int32_t) (i << (16U - indexBits));
+      while ((seg < (nValues - 2U)) && (xb >= pXData[seg + 1U]))
+      {
+        seg++;
+      }
+      pIndex[i] = (uint16_t) seg;
+    }
+  }
+
+  S->nValues = nValues;
+  S->pXData = pXData;
+  S->pYData = pYData;
+  S->pSlopes = pSlopes;
+  S->pIndex = pIndex;
+  S->indexBits = indexBits;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of PiecewiseLinear group
+ */
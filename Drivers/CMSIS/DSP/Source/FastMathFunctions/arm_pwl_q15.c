@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pwl_q15.c
+ * Description:  Q15 piecewise linear interpolation
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup PiecewiseLinear
+ * @{
+ */
+
+/**
+ * @brief  Q15 piecewise linear interpolation of one point.
+ * @param[in]       *S points to an instance of the Q15 piecewise linear interpolation.
+ * @param[in]       x input point.
+ * @return interpolated value.
+ */
+CMSIS_INLINE __STATIC_INLINE q15_t arm_pwl_point_q15(
+  const arm_pwl_instance_q15 * S,
+  q15_t x)
+{
+  const q15_t *pX = S->pXData;                   /* Breakpoints */
+  uint32_t last = S->nValues - 1U;               /* Index of the last breakpoint */
+  uint32_t lo, hi, mid;                          /* Bounds of the search */
+  q31_t y;                                       /* Interpolated value */
+
+  if (x <= pX[0])
+  {
+    return (S->pYData[0]);
+  }
+  if (x >= pX[last])
+  {
+    return (S->pYData[last]);
+  }
+
+  if (S->pIndex != NULL)
+  {
+    /* Segment of the bin, then a linear scan */
+    lo = S->pIndex[(uint32_t) ((int32_t) x + 32768) >> (16U - S->indexBits)];
+    while (x >= pX[lo + 1U])
+    {
+      lo++;
+    }
+  }
+  else
+  {
+    /* Binary search, pX[lo] <= x < pX[hi] */
+    lo = 0U;
+    hi = last;
+    while ((hi - lo) > 1U)
+    {
+      mid = (lo + hi) >> 1U;
+      if (x >= pX[mid])
+      {
+        lo = mid;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+  }
+
+  /* y = y[i] + slope[i] * (x - x[i]), rounded */
+  y = (q31_t) ((((q63_t) ((int32_t) x - pX[lo]) * S->pSlopes[lo]) + 0x4000) >> 15);
+
+  return ((q15_t) __SSAT(S->pYData[lo] + y, 16));
+}
+
+/**
+ * @brief  Q15 piecewise linear interpolation of a block of points.
+ * @param[in]       *S points to an instance of the Q15 piecewise linear interpolation.
+ * @param[in]       *pSrc points to the block of input points.
+ * @param[out]      *pDst points to the block of interpolated values.
+ * @param[in]       blockSize number of points to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The product of the offset from the breakpoint and the slope is rounded to 1.15 format,
+ * added to the value at the breakpoint and saturated.
+ */
+
+void arm_pwl_q15(
+  const arm_pwl_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = pwl(A) */
+    pDst[0] = arm_pwl_point_q15(S, pSrc[0]);
+    pDst[1] = arm_pwl_point_q15(S, pSrc[1]);
+    pDst[2] = arm_pwl_point_q15(S, pSrc[2]);
+    pDst[3] = arm_pwl_point_q15(S, pSrc[3]);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = pwl(A) */
+    *pDst++ = arm_pwl_point_q15(S, *pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of PiecewiseLinear group
+ */
@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resize_init.c
+ * Description:  Initialization function for the image resize functions
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @defgroup ImageResize Image Resize
+ *
+ * Resizes 8-bit grayscale, Q15 and RGB565 images with the nearest neighbour or the
+ * bilinear interpolation.
+ *
+ * \par
+ * The images are stored in row order, without padding between the rows.  Destination
+ * pixel <code>(j, i)</code> is centered on the source position:
+ * <pre>
+ *     x = (j + 0.5) * srcWidth / dstWidth - 0.5
+ *     y = (i + 0.5) * srcHeight / dstHeight - 0.5
+ * </pre>
+ * The nearest neighbour mode rounds this position to the nearest source pixel.  The bilinear
+ * mode blends the four source pixels around it as arm_bilinear_interp_f32() does, the positions
+ * outside the source being clamped to its border.
+ *
+ * \par
+ * Unlike the bilinear interpolation functions, which compute the index of each point from its
+ * coordinates, the resize functions walk each destination row with a constant step in 16.16
+ * fixed-point format.  The clamping is resolved once by arm_resize_init(), which finds the
+ * destination columns left and right of the source, and once per row: the inner loop has no
+ * bounds checks and no floating-point operations.
+ *
+ * \par
+ * The row functions produce one destination row at a time.  They can feed a display one line
+ * after the other, without a frame buffer for the destination image.
+ *
+ * \par Fixed-Point Behavior
+ * The weights of the bilinear mode have 8 bits for the grayscale images, 15 bits for the Q15
+ * images and 5 bits for the RGB565 images, whose three channels are blended at once.  The error
+ * of the blend is about one unit of the last bit of each channel.  The rounding of the steps to
+ * 16.16 format adds a position error that grows along a row, up to <code>dstWidth / 2^17</code>
+ * source pixels: it matters only for the Q15 images.
+ */
+
+/**
+ * @addtogroup ImageResize
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the image resize functions.
+ * @param[out]      *S points to an instance of the image resize structure.
+ * @param[in]       mode interpolation mode.
+ * @param[in]       srcWidth number of columns of the source image, from 1 to 32767.
+ * @param[in]       srcHeight number of rows of the source image, from 1 to 32767.
+ * @param[in]       dstWidth number of columns of the destination image, from 1 to 32767.
+ * @param[in]       dstHeight number of rows of the destination image, from 1 to 32767.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if a size is out of range.
+ *
+ * \par
+ * The sizes are limited to 32767 so that the positions fit in signed 16.16 format.
+ */
+
+arm_status arm_resize_init(
+  arm_resize_instance * S,
+  arm_resize_mode mode,
+  uint16_t srcWidth,
+  uint16_t srcHeight,
+  uint16_t dstWidth,
+  uint16_t dstHeight)
+{
+  int32_t x;                                     /* Source column, 16.16 format */
+  int32_t xMax;                                  /* Last source column, 16.16 format */
+  uint16_t j;                                    /* Destination column */
+
+  if ((srcWidth == 0U) || (srcHeight == 0U) || (dstWidth == 0U) || (dstHeight == 0U) ||
+      (srcWidth > 0x7FFFU) || (srcHeight > 0x7FFFU) || (dstWidth > 0x7FFFU) || (dstHeight > 0x7FFFU))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->mode = mode;
+  S->srcWidth = srcWidth;
+  S->srcHeight = srcHeight;
+  S->dstWidth = dstWidth;
+  S->dstHeight = dstHeight;
+
+  if (mode == ARM_RESIZE_NEAREST)
+  {
+    /* The truncation of the steps keeps the last position inside the source */
+    S->xStep = ((uint32_t) srcWidth << 16) / dstWidth;
+    S->yStep = ((uint32_t) srcHeight << 16) / dstHeight;
+
+    /* Center of the first destination pixel: the integer part is the nearest source pixel */
+    S->xStart = (int32_t) (S->xStep >> 1);
+    S->yStart = (int32_t) (S->yStep >> 1);
+    S->xFirst = 0U;
+    S->xLast = dstWidth;
+  }
+  else
+  {
+    /* Rounded steps: the positions past the last source pixel are clamped */
+    S->xStep = (((uint32_t) srcWidth << 16) + ((uint32_t) dstWidth >> 1)) / dstWidth;
+    S->yStep = (((uint32_t) srcHeight << 16) + ((uint32_t) dstHeight >> 1)) / dstHeight;
+
+    /* Center of the first destination pixel, relative to the center of the first source pixel */
+    S->xStart = (int32_t) (S->xStep >> 1) - 0x8000;
+    S->yStart = (int32_t) (S->yStep >> 1) - 0x8000;
+
+    /* Destination columns left of the first source column */
+    x = S->xStart;
+    j = 0U;
+    while ((j < dstWidth) && (x < 0))
+    {
+      x += (int32_t) S->xStep;
+      j++;
+    }
+    S->xFirst = j;
+
+    /* Destination columns left of the last source column */
+    xMax = (int32_t) (srcWidth - 1U) << 16;
+    while ((j < dstWidth) && (x < xMax))
+    {
+      x += (int32_t) S->xStep;
+      j++;
+    }
+    S->xLast = j;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ImageResize group
+ */
@@ -0,0 +1,67 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resize_rgb565.c
+ * Description:  RGB565 image resize
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup ImageResize
+ * @{
+ */
+
+/**
+ * @brief  Resizes an RGB565 image.
+ * @param[in]       *S points to an instance of the image resize structure.
+ * @param[in]       *pSrc points to the source image, srcWidth * srcHeight pixels.
+ * @param[out]      *pDst points to the destination image, dstWidth * dstHeight pixels.
+ * @return none.
+ *
+ * \par
+ * Calls arm_resize_row_rgb565() for each row of the destination.
+ */
+
+void arm_resize_rgb565(
+  const arm_resize_instance * S,
+  const uint16_t * pSrc,
+  uint16_t * pDst)
+{
+  uint16_t row;                                  /* Destination row */
+
+  for (row = 0U; row < S->dstHeight; row++)
+  {
+    arm_resize_row_rgb565(S, pSrc, row, pDst);
+    pDst += S->dstWidth;
+  }
+}
+
+/**
+ * @} end of ImageResize group
+ */
@@ -0,0 +1,243 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resize_row_q15.c
+ * Description:  Row of a Q15 image resize
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup ImageResize
+ * @{
+ */
+
+/**
+ * @brief  Bilinear blend of four Q15 pixels.
+ * @param[in]       a top left pixel
+ * @param[in]       b top right pixel
+ * @param[in]       c bottom left pixel
+ * @param[in]       d bottom right pixel
+ * @param[in]       wx horizontal weight of b and d, in 1.15 format
+ * @param[in]       wy vertical weight of c and d, in 1.15 format
+ * @return blended pixel.
+ */
+CMSIS_INLINE __STATIC_INLINE q15_t arm_resize_blend_q15(
+  int32_t a,
+  int32_t b,
+  int32_t c,
+  int32_t d,
+  int32_t wx,
+  int32_t wy)
+{
+  int32_t top, bot;                              /* Rows blended horizontally */
+
+  /* The differences are at most 17 bits and the weights 15 bits: the products fit in 32 bits */
+  top = a + ((((b - a) * wx) + 0x4000) >> 15);
+  bot = c + ((((d - c) * wx) + 0x4000) >> 15);
+
+  return ((q15_t) (top + ((((bot - top) * wy) + 0x4000) >> 15)));
+}
+
+/**
+ * @brief  Resizes one row of a Q15 image.
+ * @param[in]       *S points to an instance of the image resize structure.
+ * @param[in]       *pSrc points to the source image, srcWidth * srcHeight pixels.
+ * @param[in]       dstRow index of the destination row, less than dstHeight.
+ * @param[out]      *pDst points to the destination row, dstWidth pixels.
+ * @return none.
+ *
+ * \par
+ * The bilinear weights have 15 bits.
+ */
+
+void arm_resize_row_q15(
+  const arm_resize_instance * S,
+  const q15_t * pSrc,
+  uint16_t dstRow,
+  q15_t * pDst)
+{
+  const q15_t *pRow0, *pRow1;                    /* Source rows above and below the destination row */
+  uint32_t srcWidth = S->srcWidth;               /* Number of columns of the source */
+  uint32_t step = S->xStep;                      /* Source columns per destination column, 16.16 format */
+  uint32_t x;                                    /* Source column, 16.16 format */
+  int32_t y;                                     /* Source row, 16.16 format */
+  uint32_t wy;                                   /* Vertical weight */
+  uint32_t i;                                    /* Index of the left source column */
+  q15_t edge;                                    /* Pixel of the borders */
+  uint32_t blkCnt;                               /* loop counter */
+
+  y = S->yStart + (int32_t) ((uint32_t) dstRow * S->yStep);
+
+  if (S->mode == ARM_RESIZE_NEAREST)
+  {
+    /* The positions of the nearest pixels are always inside the source */
+    pRow0 = pSrc + (((uint32_t) y >> 16) * srcWidth);
+    x = (uint32_t) S->xStart;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+    /* Loop unrolling */
+    blkCnt = S->dstWidth >> 2U;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 outputs. */
+    while (blkCnt > 0U)
+    {
+      /* Nearest source pixel */
+      pDst[0] = pRow0[x >> 16];
+      x += step;
+      pDst[1] = pRow0[x >> 16];
+      x += step;
+      pDst[2] = pRow0[x >> 16];
+      x += step;
+      pDst[3] = pRow0[x >> 16];
+      x += step;
+      pDst += 4U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the number of outputs is not a multiple of 4, compute any remaining outputs here.
+     ** No loop unrolling is used. */
+    blkCnt = S->dstWidth % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over the outputs */
+    blkCnt = S->dstWidth;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      /* Nearest source pixel */
+      *pDst++ = pRow0[x >> 16];
+      x += step;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    return;
+  }
+
+  /* Rows above the first or below the last source row are clamped to it */
+  if (y <= 0)
+  {
+    pRow0 = pSrc;
+    wy = 0U;
+  }
+  else if ((uint32_t) y >= ((uint32_t) (S->srcHeight - 1U) << 16))
+  {
+    pRow0 = pSrc + ((S->srcHeight - 1U) * srcWidth);
+    wy = 0U;
+  }
+  else
+  {
+    pRow0 = pSrc + (((uint32_t) y >> 16) * srcWidth);
+    wy = ((uint32_t) y >> 1) & 0x7FFFU;
+  }
+  pRow1 = (wy != 0U) ? (pRow0 + srcWidth) : pRow0;
+
+  /* Columns left of the first source column */
+  edge = arm_resize_blend_q15(pRow0[0], pRow0[0], pRow1[0], pRow1[0], 0U, wy);
+  arm_fill_q15(edge, pDst, S->xFirst);
+  pDst += S->xFirst;
+
+  /* Interpolated columns: the source column and the next one are inside the source */
+  x = (uint32_t) (S->xStart + (int32_t) ((uint32_t) S->xFirst * step));
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = ((uint32_t) S->xLast - S->xFirst) >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 outputs. */
+  while (blkCnt > 0U)
+  {
+    /* Blend of the four nearest source pixels */
+    i = x >> 16;
+    pDst[0] = arm_resize_blend_q15(pRow0[i], pRow0[i + 1U], pRow1[i], pRow1[i + 1U], (x >> 1) & 0x7FFFU, wy);
+    x += step;
+    i = x >> 16;
+    pDst[1] = arm_resize_blend_q15(pRow0[i], pRow0[i + 1U], pRow1[i], pRow1[i + 1U], (x >> 1) & 0x7FFFU, wy);
+    x += step;
+    i = x >> 16;
+    pDst[2] = arm_resize_blend_q15(pRow0[i], pRow0[i + 1U], pRow1[i], pRow1[i + 1U], (x >> 1) & 0x7FFFU, wy);
+    x += step;
+    i = x >> 16;
+    pDst[3] = arm_resize_blend_q15(pRow0[i], pRow0[i + 1U], pRow1[i], pRow1[i + 1U], (x >> 1) & 0x7FFFU, wy);
+    x += step;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the number of outputs is not a multiple of 4, compute any remaining outputs here.
+   ** No loop unrolling is used. */
+  blkCnt = ((uint32_t) S->xLast - S->xFirst) % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over the outputs */
+  blkCnt = ((uint32_t) S->xLast - S->xFirst);
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* Blend of the four nearest source pixels */
+    i = x >> 16;
+    *pDst++ = arm_resize_blend_q15(pRow0[i], pRow0[i + 1U], pRow1[i], pRow1[i + 1U], (x >> 1) & 0x7FFFU, wy);
+    x += step;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Columns right of the last source column */
+  i = srcWidth - 1U;
+  edge = arm_resize_blend_q15(pRow0[i], pRow0[i], pRow1[i], pRow1[i], 0U, wy);
+  arm_fill_q15(edge, pDst, (uint32_t) S->dstWidth - S->xLast);
+}
+
+/**
+ * @} end of ImageResize group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sincos_cos_f32.c
+ * Description:  Configurable floating-point cosine function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup SinCosConfig
+ * @{
+ */
+
+/**
+ * @brief  Configurable cosine function for floating-point data.
+ * @param[in]  *S points to an initialized instance of the sine and cosine structure.
+ * @param[in]  x input value in radians.
+ * @return cos(x).
+ *
+ * \par
+ * The maximum absolute error for x in [-2*pi 2*pi] is <code>S->maxError</code>.
+ */
+
+float32_t arm_sincos_cos_f32(
+  const arm_sincos_instance_f32 * S,
+  float32_t x)
+{
+  float32_t in, findex, fract;                   /* Input in turns, table index and fractional part */
+  float32_t r;                                   /* Input reduced to [-pi pi] */
+  uint32_t index, i;                             /* Table index, coefficient index */
+  int32_t n;                                     /* Number of periods */
+  float32_t a, b, b2;                            /* Nearest table values, shifted input and its square */
+  float32_t cosVal;                              /* Output */
+
+  if (S->numCoeffs == 0U)
+  {
+    /* Scale the input to [0 1) turns, negative values towards -infinity */
+    in = x * 0.159154943092f;
+    n = (int32_t) in;
+    if (in < 0.0f)
+    {
+      n--;
+    }
+    in = in - (float32_t) n;
+
+    /* Table index and fractional part, the index wraps at one period */
+    findex = in * (float32_t) S->tableSize;
+    index = (uint32_t) findex;
+    fract = findex - (float32_t) index;
+
+    /* cos(x) = sin(x + pi/2), a quarter of the table further */
+    index = (index + ((uint32_t) S->tableSize >> 2U)) & ((uint32_t) S->tableSize - 1U);
+
+    /* Linear interpolation between the two nearest table values */
+    a = S->pTable[index * S->tableStride];
+    b = S->pTable[(index + 1U) * S->tableStride];
+
+    return (a + (fract * (b - a)));
+  }
+
+  /* Reduce to r in [-pi pi], 2*pi = 6.28125 + 1.935307169e-3 with n * 6.28125 exact */
+  in = x * 0.159154943092f;
+  n = (int32_t) ((in < 0.0f) ? (in - 0.5f) : (in + 0.5f));
+  r = (x - ((float32_t) n * 6.28125f)) - ((float32_t) n * 1.935307169e-3f);
+
+  /* cos(r) = sin(pi/2 - |r|), in [-pi/2 pi/2], pi/2 in two parts */
+  b = (1.570796371f - fabsf(r)) + -4.371139006e-8f;
+
+  /* Odd polynomial, Horner's rule in b^2 */
+  b2 = b * b;
+  i = S->numCoeffs - 1U;
+  cosVal = S->pCoeffs[i];
+  while (i > 0U)
+  {
+    i--;
+    cosVal = (cosVal * b2) + S->pCoeffs[i];
+  }
+  cosVal = cosVal * b;
+
+  return (cosVal);
+}
+
+/**
+ * @} end of SinCosConfig group
+ */
@@ -0,0 +1,129 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sincos_f32.c
+ * Description:  Configurable floating-point sine and cosine function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup SinCosConfig
+ * @{
+ */
+
+/**
+ * @brief  Configurable sine and cosine function for floating-point data.
+ * @param[in]  *S points to an initialized instance of the sine and cosine structure.
+ * @param[in]  x input value in radians.
+ * @param[out] *pSin points to the sine output.
+ * @param[out] *pCos points to the cosine output.
+ * @return none.
+ *
+ * \par
+ * The maximum absolute error for x in [-2*pi 2*pi] is <code>S->maxError</code>.
+ */
+
+void arm_sincos_f32(
+  const arm_sincos_instance_f32 * S,
+  float32_t x,
+  float32_t * pSin,
+  float32_t * pCos)
+{
+  float32_t in, findex, fract;                   /* Input in turns, table index and fractional part */
+  float32_t r;                                   /* Input reduced to [-pi pi] */
+  uint32_t index, i;                             /* Table index, coefficient index */
+  int32_t n;                                     /* Number of periods */
+  float32_t a, b, a2, b2;                        /* Folded inputs and their squares */
+  float32_t sinVal, cosVal;                      /* Outputs */
+  uint32_t mask;                                 /* Index wrap mask */
+
+  if (S->numCoeffs == 0U)
+  {
+    /* Scale the input to [0 1) turns, negative values towards -infinity */
+    in = x * 0.159154943092f;
+    n = (int32_t) in;
+    if (in < 0.0f)
+    {
+      n--;
+    }
+    in = in - (float32_t) n;
+
+    /* Table index and fractional part, the index wraps at one period */
+    findex = in * (float32_t) S->tableSize;
+    index = (uint32_t) findex;
+    fract = findex - (float32_t) index;
+    mask = (uint32_t) S->tableSize - 1U;
+
+    /* Sine, linear interpolation between the two nearest table values */
+    a = S->pTable[(index & mask) * S->tableStride];
+    b = S->pTable[((index & mask) + 1U) * S->tableStride];
+    *pSin = a + (fract * (b - a));
+
+    /* Cosine, a quarter of the table further */
+    index = (index + ((uint32_t) S->tableSize >> 2U)) & mask;
+    a = S->pTable[index * S->tableStride];
+    b = S->pTable[(index + 1U) * S->tableStride];
+    *pCos = a + (fract * (b - a));
+
+    return;
+  }
+
+  /* Reduce to r in [-pi pi], 2*pi = 6.28125 + 1.935307169e-3 with n * 6.28125 exact */
+  in = x * 0.159154943092f;
+  n = (int32_t) ((in < 0.0f) ? (in - 0.5f) : (in + 0.5f));
+  r = (x - ((float32_t) n * 6.28125f)) - ((float32_t) n * 1.935307169e-3f);
+
+  /* sin(pi - |r|) = sin(|r|) and cos(r) = sin(pi/2 - |r|), pi in two parts */
+  a = fabsf(r);
+  b = (1.570796371f - a) + -4.371139006e-8f;
+  if (a > 1.570796371f)
+  {
+    a = (3.141592741f - a) + -8.742278013e-8f;
+  }
+
+  /* Both odd polynomials, Horner's rule in a^2 and b^2 */
+  a2 = a * a;
+  b2 = b * b;
+  i = S->numCoeffs - 1U;
+  sinVal = S->pCoeffs[i];
+  cosVal = S->pCoeffs[i];
+  while (i > 0U)
+  {
+    i--;
+    sinVal = (sinVal * a2) + S->pCoeffs[i];
+    cosVal = (cosVal * b2) + S->pCoeffs[i];
+  }
+
+  *pSin = (r < 0.0f) ? -(sinVal * a) : (sinVal * a);
+  *pCos = cosVal * b;
+}
+
+/**
+ * @} end of SinCosConfig group
+ */
@@ -0,0 +1,173 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sincos_init_f32.c
+ * Description:  Initialization function for the configurable floating-point sine and cosine
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup SinCosConfig Configurable Sine and Cosine
+ *
+ * Computes the sine and cosine functions with an accuracy and a cost chosen by
+ * the application, from a run-time instance or from compile-time inline functions.
+ * The input is in radians and is not limited to one period.
+ *
+ * An instance is initialized with one of:
+ *  - arm_sincos_init_f32() for a table of 64 to 4096 intervals with linear interpolation.
+ *    Tables of up to 512 intervals read every 512/N-th entry of <code>sinTable_f32</code>
+ *    and need no memory.  Larger tables are computed into a buffer of N+1 values owned
+ *    by the caller.
+ *  - arm_sincos_poly_init_f32() for an odd minimax polynomial of order 3 to 11.
+ *    The input is reduced to [-pi/2 pi/2] with a two-part 2*pi and the polynomial is
+ *    evaluated with Horner's rule.  No table is read.
+ *
+ * The maximum absolute error of the configuration, for inputs in [-2*pi 2*pi], is
+ * reported in the <code>maxError</code> member of the instance:
+ *
+ * <pre>
+ *     table   64  1.3e-3      polynomial   3  7.3e-3
+ *            128  3.1e-4                   5  1.1e-4
+ *            256  7.6e-5                   7  1.1e-6
+ *            512  2.0e-5                   9  1.8e-7
+ *           1024  5.2e-6                  11  1.7e-7
+ *           2048  1.7e-6
+ *           4096  8.0e-7
+ * </pre>
+ *
+ * The table errors are bounds of the interpolation error plus the rounding of the
+ * single precision argument reduction, which can add about 5e-7 and dominates for the
+ * largest tables.
+ *
+ * Beyond one period the table error grows with the rounding of x/(2*pi).
+ *
+ * arm_sin_fast_f32() and arm_cos_fast_f32() are inline functions without branches nor
+ * table accesses.  The polynomial order is set at compile time with
+ * <code>ARM_MATH_SIN_FAST_ORDER</code>, 5 (the default) or 7.
+ */
+
+/**
+ * @addtogroup SinCosConfig
+ * @{
+ */
+
+/* Maximum absolute error of the tables of 64 to 4096 intervals */
+static const float32_t arm_sincos_table_error_f32[7] =
+{
+  1.3e-3f, 3.1e-4f, 7.6e-5f, 2.0e-5f, 5.2e-6f, 1.7e-6f, 8.0e-7f
+};
+
+/**
+ * @brief  Initialization function for the table based configurable sine and cosine.
+ * @param[in,out] *S points to an instance of the sine and cosine structure.
+ * @param[in]     tableSize number of table intervals over one period, a power of 2 from 64 to 4096.
+ * @param[in]     *pTableBuffer points to a buffer of tableSize+1 values.
+ * @return The function returns ARM_MATH_SUCCESS if initialization is successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>tableSize</code> is not supported or if the buffer is
+ * missing.
+ *
+ * \par
+ * Tables of up to 512 intervals read <code>sinTable_f32</code>, <code>pTableBuffer</code>
+ * is not used and can be NULL.  Larger tables are computed in <code>pTableBuffer</code>
+ * with the order 11 polynomial, which must remain valid while the instance is used.
+ */
+
+arm_status arm_sincos_init_f32(
+  arm_sincos_instance_f32 * S,
+  uint16_t tableSize,
+  float32_t * pTableBuffer)
+{
+  arm_sincos_instance_f32 poly;                  /* Instance used to compute the larger tables */
+  float32_t w;                                   /* Angle of a table entry */
+  uint32_t quarter, i;                           /* Quarter of the table size, loop counter */
+  uint32_t log2Size;                             /* Base 2 logarithm of the table size */
+
+  /* The table size must be a power of 2 from 64 to 4096 */
+  if ((tableSize < 64U) || (tableSize > 4096U) || ((tableSize & (tableSize - 1U)) != 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  log2Size = 6U;
+  while ((1U << log2Size) < tableSize)
+  {
+    log2Size++;
+  }
+
+  S->tableSize = tableSize;
+  S->numCoeffs = 0U;
+  S->pCoeffs = NULL;
+  S->maxError = arm_sincos_table_error_f32[log2Size - 6U];
+
+  if (tableSize <= FAST_MATH_TABLE_SIZE)
+  {
+    /* Every (512 / N)-th entry of the common table */
+    S->tableStride = (uint16_t) (FAST_MATH_TABLE_SIZE / tableSize);
+    S->pTable = sinTable_f32;
+
+    return (ARM_MATH_SUCCESS);
+  }
+
+  if (pTableBuffer == NULL)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* First quarter with the most accurate polynomial, the others by symmetry */
+  arm_sincos_poly_init_f32(&poly, 11U);
+
+  quarter = (uint32_t) tableSize >> 2U;
+
+  for (i = 0U; i <= quarter; i++)
+  {
+    /* 2*pi*i/N, with 2*pi in two parts as i/N is exact */
+    w = (float32_t) i / (float32_t) tableSize;
+    w = (w * 6.283185482f) + (w * -1.748455603e-7f);
+
+    pTableBuffer[i] = arm_sincos_sin_f32(&poly, w);
+    pTableBuffer[(2U * quarter) - i] = pTableBuffer[i];
+    pTableBuffer[(2U * quarter) + i] = -pTableBuffer[i];
+    pTableBuffer[tableSize - i] = -pTableBuffer[i];
+  }
+
+  /* Exact zeros */
+  pTableBuffer[0] = 0.0f;
+  pTableBuffer[2U * quarter] = 0.0f;
+  pTableBuffer[tableSize] = 0.0f;
+
+  S->tableStride = 1U;
+  S->pTable = pTableBuffer;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SinCosConfig group
+ */
@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sincos_poly_init_f32.c
+ * Description:  Polynomial initialization function for the configurable floating-point sine and cosine
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup SinCosConfig
+ * @{
+ */
+
+/* Odd minimax polynomials of sin(x) on [0 pi/2], orders 3, 5, 7, 9 and 11 */
+static const float32_t arm_sincos_coeffs_f32[20] =
+{
+  9.927877188e-01f, -1.462102830e-01f,
+  9.998918176e-01f, -1.659601182e-01f, 7.602903526e-03f,
+  9.999990463e-01f, -1.666555405e-01f, 8.311899379e-03f, -1.848813990e-04f,
+  1.000000000e+00f, -1.666665673e-01f, 8.333025500e-03f, -1.980741945e-04f, 2.601903134e-06f,
+  1.000000000e+00f, -1.666666716e-01f, 8.333330974e-03f, -1.984083210e-04f, 2.752396995e-06f,
+  -2.386834730e-08f
+};
+
+/* Maximum absolute error of the polynomials of order 3 to 11 */
+static const float32_t arm_sincos_coeffs_error_f32[5] =
+{
+  7.3e-3f, 1.1e-4f, 1.1e-6f, 1.8e-7f, 1.7e-7f
+};
+
+/**
+ * @brief  Initialization function for the polynomial based configurable sine and cosine.
+ * @param[in,out] *S points to an instance of the sine and cosine structure.
+ * @param[in]     order order of the minimax polynomial, 3, 5, 7, 9 or 11.
+ * @return The function returns ARM_MATH_SUCCESS if initialization is successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>order</code> is not supported.
+ *
+ * \par
+ * The polynomial of order 2*n-1 has n coefficients and costs n+1 multiplications
+ * and n-1 additions after the range reduction.
+ */
+
+arm_status arm_sincos_poly_init_f32(
+  arm_sincos_instance_f32 * S,
+  uint16_t order)
+{
+  uint32_t n;                                    /* Number of coefficients */
+
+  if ((order < 3U) || (order > 11U) || ((order & 1U) == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  n = ((uint32_t) order + 1U) >> 1U;
+
+  S->tableSize = 0U;
+  S->tableStride = 0U;
+  S->pTable = NULL;
+  S->numCoeffs = (uint16_t) n;
+  S->pCoeffs = &arm_sincos_coeffs_f32[((n * (n - 1U)) >> 1U) - 1U];
+  S->maxError = arm_sincos_coeffs_error_f32[n - 2U];
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SinCosConfig group
+ */
@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spline_f32.c
+ * Description:  Floating-point cubic spline interpolation
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @defgroup SplineInterpolate Cubic Spline Interpolation
+ *
+ * Interpolates blocks of points with the cubic spline through a table of breakpoints,
+ * evenly spaced or not.
+ *
+ * \par
+ * The spline is the piecewise cubic polynomial through the points <code>(x[i], y[i])</code>
+ * with continuous first and second derivatives.  On the segment <code>i</code>:
+ * <pre>
+ *     y = y[i] + b[i] t + c[i] t^2 + d[i] t^3,      t = x - x[i]
+ * </pre>
+ * The initialization function solves the tridiagonal system of the second derivatives
+ * with the Thomas algorithm and stores the coefficients <code>b, c, d</code> of each
+ * segment.  The end conditions are:
+ * - <code>ARM_SPLINE_NATURAL</code>: zero second derivative at the first and the last breakpoints.
+ * - <code>ARM_SPLINE_PARABOLIC_RUNOUT</code>: the first and the last segments are parabolas.
+ *
+ * \par
+ * The points outside the breakpoints return the value at the nearest end, as the other
+ * interpolation functions.  The segment of each point is found with a binary search or
+ * with an index, as described for the piecewise linear interpolation.
+ *
+ * \par
+ * The tables are not copied: they must stay valid while the instance is used.
+ */
+
+/**
+ * @addtogroup SplineInterpolate
+ * @{
+ */
+
+extern uint32_t arm_interp_segment_f32(
+  const float32_t * pXData,
+  uint32_t nValues,
+  const uint16_t * pIndex,
+  uint32_t indexLen,
+  float32_t indexScale,
+  float32_t x);
+
+/**
+ * @brief  Floating-point cubic spline interpolation of one point.
+ * @param[in]       *S points to an instance of the floating-point cubic spline interpolation.
+ * @param[in]       x input point.
+ * @return interpolated value.
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_spline_point_f32(
+  const arm_spline_instance_f32 * S,
+  float32_t x)
+{
+  const float32_t *pX = S->pXData;               /* Breakpoints */
+  const float32_t *pC;                           /* Coefficients of the segment */
+  uint32_t last = S->nValues - 1U;               /* Index of the last breakpoint */
+  uint32_t i;                                    /* Index of the segment */
+  float32_t t;                                   /* Offset from the breakpoint */
+
+  if (x <= pX[0])
+  {
+    return (S->pYData[0]);
+  }
+  if (x >= pX[last])
+  {
+    return (S->pYData[last]);
+  }
+
+  i = arm_interp_segment_f32(pX, S->nValues, S->pIndex, S->indexLen, S->indexScale, x);
+
+  /* Horner evaluation of the segment */
+  pC = &S->pCoeffs[3U * i];
+  t = x - pX[i];
+
+  return (S->pYData[i] + (t * (pC[0] + (t * (pC[1] + (t * pC[2]))))));
+}
+
+/**
+ * @brief  Floating-point cubic spline interpolation of a block of points.
+ * @param[in]       *S points to an instance of the floating-point cubic spline interpolation.
+ * @param[in]       *pSrc points to the block of input points.
+ * @param[out]      *pDst points to the block of interpolated values.
+ * @param[in]       blockSize number of points to process.
+ * @return none.
+ */
+
+void arm_spline_f32(
+  const arm_spline_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = spline(A) */
+    pDst[0] = arm_spline_point_f32(S, pSrc[0]);
+    pDst[1] = arm_spline_point_f32(S, pSrc[1]);
+    pDst[2] = arm_spline_point_f32(S, pSrc[2]);
+    pDst[3] = arm_spline_point_f32(S, pSrc[3]);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = spline(A) */
+    *pDst++ = arm_spline_point_f32(S, *pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of SplineInterpolate group
+ */
@@ -0,0 +1,159 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spline_init_f32.c
+ * Description:  Floating-point cubic spline interpolation initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup SplineInterpolate
+ * @{
+ */
+
+extern arm_status arm_interp_index_init_f32(
+  const float32_t * pXData,
+  uint32_t nValues,
+  uint16_t * pIndex,
+  uint32_t indexLen,
+  float32_t * pIndexScale);
+
+/**
+ * @brief  Initialization function for the floating-point cubic spline interpolation.
+ * @param[out]      *S points to an instance of the floating-point cubic spline interpolation.
+ * @param[in]       type end conditions.
+ * @param[in]       nValues number of breakpoints, at least 2.
+ * @param[in]       *pXData points to the breakpoints, strictly increasing.
+ * @param[in]       *pYData points to the values at the breakpoints.
+ * @param[out]      *pCoeffs points to the coefficients, 3 * (nValues-1) values.
+ * @param[in]       *pScratch points to a scratch buffer of 2 * nValues values.
+ * @param[out]      *pIndex points to the index, indexLen values, or NULL for a binary search.
+ * @param[in]       indexLen number of bins of the index, ignored without an index.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the breakpoints are not
+ * strictly increasing, if there are less than 2 of them, or if the index is empty.
+ *
+ * \par
+ * With <code>h[i] = x[i+1] - x[i]</code> and <code>s[i] = (y[i+1] - y[i]) / h[i]</code>, the
+ * second derivatives <code>M[i]</code> at the inner breakpoints solve:
+ * <pre>
+ *     h[i-1] M[i-1] + 2 (h[i-1] + h[i]) M[i] + h[i] M[i+1] = 6 (s[i] - s[i-1])
+ * </pre>
+ * with <code>M[0] = M[n-1] = 0</code> for the natural spline, and <code>M[0] = M[1]</code>,
+ * <code>M[n-1] = M[n-2]</code> for the parabolic runout.  Two breakpoints give a line.
+ */
+
+arm_status arm_spline_init_f32(
+  arm_spline_instance_f32 * S,
+  arm_spline_type type,
+  uint32_t nValues,
+  const float32_t * pXData,
+  const float32_t * pYData,
+  float32_t * pCoeffs,
+  float32_t * pScratch,
+  uint16_t * pIndex,
+  uint32_t indexLen)
+{
+  float32_t *pCp = pScratch;                     /* Modified upper diagonal */
+  float32_t *pM = pScratch + nValues;            /* Second derivatives */
+  float32_t h0, h1;                              /* Widths of two successive segments */
+  float32_t s0, s1;                              /* Slopes of two successive segments */
+  float32_t diag;                                /* Modified diagonal */
+  uint32_t last = nValues - 1U;                  /* Index of the last breakpoint */
+  uint32_t k;                                    /* Loop counter */
+
+  if (arm_interp_index_init_f32(pXData, nValues, pIndex, indexLen, &S->indexScale) != ARM_MATH_SUCCESS)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  pM[0] = 0.0f;
+  pM[last] = 0.0f;
+
+  /* Forward elimination over the inner breakpoints */
+  for (k = 1U; k < last; k++)
+  {
+    h0 = pXData[k] - pXData[k - 1U];
+    h1 = pXData[k + 1U] - pXData[k];
+    s0 = (pYData[k] - pYData[k - 1U]) / h0;
+    s1 = (pYData[k + 1U] - pYData[k]) / h1;
+
+    diag = 2.0f * (h0 + h1);
+    if (type == ARM_SPLINE_PARABOLIC_RUNOUT)
+    {
+      /* M[0] = M[1] and M[n-1] = M[n-2] move to the diagonal */
+      diag += (k == 1U) ? h0 : 0.0f;
+      diag += (k == (last - 1U)) ? h1 : 0.0f;
+    }
+
+    pM[k] = 6.0f * (s1 - s0);
+    if (k > 1U)
+    {
+      diag -= h0 * pCp[k - 1U];
+      pM[k] -= h0 * pM[k - 1U];
+    }
+
+    pCp[k] = h1 / diag;
+    pM[k] /= diag;
+  }
+
+  /* Back substitution */
+  for (k = last - 1U; k > 1U; k--)
+  {
+    pM[k - 1U] -= pCp[k - 1U] * pM[k];
+  }
+
+  if ((type == ARM_SPLINE_PARABOLIC_RUNOUT) && (last > 1U))
+  {
+    pM[0] = pM[1];
+    pM[last] = pM[last - 1U];
+  }
+
+  /* Coefficients of the segments */
+  for (k = 0U; k < last; k++)
+  {
+    h0 = pXData[k + 1U] - pXData[k];
+    pCoeffs[3U * k] = ((pYData[k + 1U] - pYData[k]) / h0) - ((h0 * ((2.0f * pM[k]) + pM[k + 1U])) / 6.0f);
+    pCoeffs[(3U * k) + 1U] = 0.5f * pM[k];
+    pCoeffs[(3U * k) + 2U] = (pM[k + 1U] - pM[k]) / (6.0f * h0);
+  }
+
+  S->type = type;
+  S->nValues = nValues;
+  S->pXData = pXData;
+  S->pYData = pYData;
+  S->pCoeffs = pCoeffs;
+  S->pIndex = pIndex;
+  S->indexLen = indexLen;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SplineInterpolate group
+ */
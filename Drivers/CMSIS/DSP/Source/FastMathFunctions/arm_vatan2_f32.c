@@ -0,0 +1,207 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vatan2_f32.c
+ * Description:  Block four quadrant arctangent function for floating-point data
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup atan2 Four Quadrant Arctangent
+ *
+ * Computes the angle <code>atan2(y, x)</code> of the points <code>(x, y)</code>
+ * of two blocks of coordinates, in the range [-pi pi].
+ *
+ * The ratio <code>r = min(|x|, |y|) / max(|x|, |y|)</code> reduces the problem to
+ * the first octant, where <code>atan(r)</code> is approximated by an odd polynomial,
+ * and the octant is then mapped back using the signs and the order of the magnitudes
+ * of the coordinates.  <code>atan2(0, 0)</code> returns 0.
+ *
+ * The floating-point version uses the degree 15 polynomial of Abramowitz and Stegun
+ * 4.4.49.  The maximum absolute error is 3.1e-7 radians.
+ *
+ * The fixed-point versions compute the ratio with <code>arm_recip_q31()</code> (Q31)
+ * or an integer division (Q15) and return the angle divided by pi, so the range
+ * [-1 +1) maps to [-pi pi), as the angle input of <code>arm_sin_cos_q31()</code>.
+ * An angle of exactly pi is saturated to the largest positive value.
+ *
+ * There are separate functions for floating-point, Q31, and Q15 data types.
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/**
+ * @brief  Floating-point four quadrant arctangent of a block of data.
+ * @param[in]       *pSrcY points to the y coordinates
+ * @param[in]       *pSrcX points to the x coordinates
+ * @param[out]      *pDst points to the output angles, in radians
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vatan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x, y, ax, ay;                        /* Input coordinates and their absolute values */
+  float32_t r, s, a;                             /* Temporary variables */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  float32_t x1, x2, x3, x4;                      /* Input coordinates and their absolute values */
+  float32_t y1, y2, y3, y4;                      /* Input coordinates and their absolute values */
+  float32_t ax1, ax2, ax3, ax4;                  /* Input coordinates and their absolute values */
+  float32_t ay1, ay2, ay3, ay4;                  /* Input coordinates and their absolute values */
+  float32_t r1, r2, r3, r4;                      /* Temporary variables */
+  float32_t s1, s2, s3, s4;                      /* Temporary variables */
+  float32_t a1, a2, a3, a4;                      /* Temporary variables */
+#endif
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* Absolute values of the coordinates */
+    x1 = pSrcX[0];
+    x2 = pSrcX[1];
+    x3 = pSrcX[2];
+    x4 = pSrcX[3];
+    y1 = pSrcY[0];
+    y2 = pSrcY[1];
+    y3 = pSrcY[2];
+    y4 = pSrcY[3];
+    ax1 = (x1 < 0.0f) ? -x1 : x1;
+    ax2 = (x2 < 0.0f) ? -x2 : x2;
+    ax3 = (x3 < 0.0f) ? -x3 : x3;
+    ax4 = (x4 < 0.0f) ? -x4 : x4;
+    ay1 = (y1 < 0.0f) ? -y1 : y1;
+    ay2 = (y2 < 0.0f) ? -y2 : y2;
+    ay3 = (y3 < 0.0f) ? -y3 : y3;
+    ay4 = (y4 < 0.0f) ? -y4 : y4;
+
+    /* Reduce to the first octant: r = min(|x|, |y|) / max(|x|, |y|) in [0 1] */
+    r1 = (ay1 > ax1) ? (ax1 / ay1) : ((ax1 > 0.0f) ? (ay1 / ax1) : 0.0f);
+    r2 = (ay2 > ax2) ? (ax2 / ay2) : ((ax2 > 0.0f) ? (ay2 / ax2) : 0.0f);
+    r3 = (ay3 > ax3) ? (ax3 / ay3) : ((ax3 > 0.0f) ? (ay3 / ax3) : 0.0f);
+    r4 = (ay4 > ax4) ? (ax4 / ay4) : ((ax4 > 0.0f) ? (ay4 / ax4) : 0.0f);
+    s1 = r1 * r1;
+    s2 = r2 * r2;
+    s3 = r3 * r3;
+    s4 = r4 * r4;
+
+    /* atan(r) with the degree 15 odd polynomial of Abramowitz and Stegun 4.4.49 */
+    a1 = r1 * (0.9999993329f + s1 * (-0.3332985605f + s1 * (0.1994653599f + s1 * (-0.1390853351f
+              + s1 * (0.0964200441f + s1 * (-0.0559098861f + s1 * (0.0218612288f + s1 * -0.0040540580f)))))));
+    a2 = r2 * (0.9999993329f + s2 * (-0.3332985605f + s2 * (0.1994653599f + s2 * (-0.1390853351f
+              + s2 * (0.0964200441f + s2 * (-0.0559098861f + s2 * (0.0218612288f + s2 * -0.0040540580f)))))));
+    a3 = r3 * (0.9999993329f + s3 * (-0.3332985605f + s3 * (0.1994653599f + s3 * (-0.1390853351f
+              + s3 * (0.0964200441f + s3 * (-0.0559098861f + s3 * (0.0218612288f + s3 * -0.0040540580f)))))));
+    a4 = r4 * (0.9999993329f + s4 * (-0.3332985605f + s4 * (0.1994653599f + s4 * (-0.1390853351f
+              + s4 * (0.0964200441f + s4 * (-0.0559098861f + s4 * (0.0218612288f + s4 * -0.0040540580f)))))));
+
+    /* Map the octant back to the full circle */
+    a1 = (ay1 > ax1) ? (1.570796327f - a1) : a1;
+    a2 = (ay2 > ax2) ? (1.570796327f - a2) : a2;
+    a3 = (ay3 > ax3) ? (1.570796327f - a3) : a3;
+    a4 = (ay4 > ax4) ? (1.570796327f - a4) : a4;
+    a1 = (x1 < 0.0f) ? (3.141592654f - a1) : a1;
+    a2 = (x2 < 0.0f) ? (3.141592654f - a2) : a2;
+    a3 = (x3 < 0.0f) ? (3.141592654f - a3) : a3;
+    a4 = (x4 < 0.0f) ? (3.141592654f - a4) : a4;
+    pDst[0] = (y1 < 0.0f) ? -a1 : a1;
+    pDst[1] = (y2 < 0.0f) ? -a2 : a2;
+    pDst[2] = (y3 < 0.0f) ? -a3 : a3;
+    pDst[3] = (y4 < 0.0f) ? -a4 : a4;
+
+    /* Update the pointers to process the next samples */
+    pSrcY += 4U;
+    pSrcX += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* Absolute values of the coordinates */
+    x = *pSrcX;
+    y = *pSrcY;
+    ax = (x < 0.0f) ? -x : x;
+    ay = (y < 0.0f) ? -y : y;
+
+    /* Reduce to the first octant: r = min(|x|, |y|) / max(|x|, |y|) in [0 1] */
+    r = (ay > ax) ? (ax / ay) : ((ax > 0.0f) ? (ay / ax) : 0.0f);
+    s = r * r;
+
+    /* atan(r) with the degree 15 odd polynomial of Abramowitz and Stegun 4.4.49 */
+    a = r * (0.9999993329f + s * (-0.3332985605f + s * (0.1994653599f + s * (-0.1390853351f
+              + s * (0.0964200441f + s * (-0.0559098861f + s * (0.0218612288f + s * -0.0040540580f)))))));
+
+    /* Map the octant back to the full circle */
+    a = (ay > ax) ? (1.570796327f - a) : a;
+    a = (x < 0.0f) ? (3.141592654f - a) : a;
+    *pDst = (y < 0.0f) ? -a : a;
+
+    pSrcY++;
+    pSrcX++;
+    pDst++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of atan2 group
+ */
@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vatan2_q15.c
+ * Description:  Block four quadrant arctangent function for Q15 data
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/* Odd polynomial of atan(r) / pi on [0 1], Abramowitz and Stegun 4.4.47, in 1.31 format */
+static const q31_t arm_vatan2_coef_q15[5] =
+{
+  683473678, -225781269, 123138132, -58193963, 14242151
+};
+
+/**
+ * @brief  Q15 four quadrant arctangent of one point.
+ * @param[in]       y y coordinate
+ * @param[in]       x x coordinate
+ * @return atan2(y, x) / pi.
+ */
+CMSIS_INLINE __STATIC_INLINE q15_t arm_vatan2_sample_q15(
+  q15_t y,
+  q15_t x)
+{
+  q31_t ax, ay, mx, mn;                          /* Absolute values, their maximum and minimum */
+  q31_t r, s, acc;                               /* Ratio, its square and accumulator */
+  int32_t i;                                     /* Loop counter */
+
+  ax = (x > 0) ? x : -(q31_t) x;
+  ay = (y > 0) ? y : -(q31_t) y;
+  mx = (ay > ax) ? ay : ax;
+  mn = (ay > ax) ? ax : ay;
+
+  if (mx == 0)
+  {
+    return (0);
+  }
+
+  /* r = mn / mx in [0 1] in 1.31 format, from a 16-bit quotient (hardware divide on Cortex-M3 and above) */
+  r = clip_q63_to_q31((q63_t) ((mn << 16) / mx) << 15);
+  s = (q31_t) (((q63_t) r * r) >> 31);
+
+  /* atan(r) / pi in [0 0.25], Horner evaluation in r^2 */
+  acc = arm_vatan2_coef_q15[4];
+  for (i = 3; i >= 0; i--)
+  {
+    acc = (q31_t) (((q63_t) acc * s) >> 31) + arm_vatan2_coef_q15[i];
+  }
+  acc = (q31_t) (((q63_t) acc * r) >> 31);
+
+  /* Round to 1.15 format */
+  acc = (acc + 0x8000) >> 16;
+
+  /* Map the octant back to the full circle, pi saturating to 0x7FFF */
+  acc = (ay > ax) ? (0x4000 - acc) : acc;
+  acc = (x < 0) ? (0x8000 - acc) : acc;
+  acc = (acc > 0x7FFF) ? 0x7FFF : acc;
+
+  return ((q15_t) ((y < 0) ? -acc : acc));
+}
+
+/**
+ * @brief  Q15 four quadrant arctangent of a block of data.
+ * @param[in]       *pSrcY points to the y coordinates
+ * @param[in]       *pSrcX points to the x coordinates
+ * @param[out]      *pDst points to the output angles, divided by pi
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * \par
+ * The output is the angle divided by pi: the range [-1 +1) maps to [-pi pi).
+ * The maximum error is 1 LSB.
+ */
+
+void arm_vatan2_q15(
+  q15_t * pSrcY,
+  q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = atan2(A, B) / pi */
+    pDst[0] = arm_vatan2_sample_q15(pSrcY[0], pSrcX[0]);
+    pDst[1] = arm_vatan2_sample_q15(pSrcY[1], pSrcX[1]);
+    pDst[2] = arm_vatan2_sample_q15(pSrcY[2], pSrcX[2]);
+    pDst[3] = arm_vatan2_sample_q15(pSrcY[3], pSrcX[3]);
+
+    /* Update the pointers to process the next samples */
+    pSrcY += 4U;
+    pSrcX += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = atan2(A, B) / pi */
+    *pDst = arm_vatan2_sample_q15(*pSrcY, *pSrcX);
+
+    pSrcY++;
+    pSrcX++;
+    pDst++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of atan2 group
+ */
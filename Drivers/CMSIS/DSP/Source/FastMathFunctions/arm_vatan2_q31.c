@@ -0,0 +1,175 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vatan2_q31.c
+ * Description:  Block four quadrant arctangent function for Q31 data
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/* Odd minimax polynomial of atan(r) / pi on [0 1], degree 17, in 1.31 format */
+static const q31_t arm_vatan2_coef_q31[9] =
+{
+  683565198, -227850059, 136616719, -96801248, 71767157, -49454988, 27193080, -9844278,
+  1679334
+};
+
+/**
+ * @brief  Q31 four quadrant arctangent of one point.
+ * @param[in]       y y coordinate
+ * @param[in]       x x coordinate
+ * @return atan2(y, x) / pi.
+ */
+CMSIS_INLINE __STATIC_INLINE q31_t arm_vatan2_sample_q31(
+  q31_t y,
+  q31_t x)
+{
+  q31_t ax, ay, mx, mn;                          /* Absolute values, their maximum and minimum */
+  q31_t inv, r, s, acc;                          /* Reciprocal of mx, ratio, its square and accumulator */
+  uint32_t tempVal;                              /* Newton-Raphson temporary */
+  uint32_t shift;                                /* Exponent of the reciprocal */
+  int32_t i;                                     /* Loop counter */
+
+  ax = (x > 0) ? x : __QSUB(0, x);
+  ay = (y > 0) ? y : __QSUB(0, y);
+  mx = (ay > ax) ? ay : ax;
+  mn = (ay > ax) ? ax : ay;
+
+  if (mx == 0)
+  {
+    return (0);
+  }
+
+  /* 1 / mx from arm_recip_q31(), refined with a third Newton-Raphson iteration */
+  shift = arm_recip_q31(mx, &inv, (q31_t *) armRecipTableQ31);
+  tempVal = (uint32_t) (((q63_t) (mx << (shift - 1U)) * inv) >> 31);
+  tempVal = 0x7FFFFFFFU - tempVal;
+  inv = clip_q63_to_q31(((q63_t) inv * tempVal) >> 30);
+
+  /* r = mn / mx in [0 1] */
+  r = clip_q63_to_q31(((q63_t) mn * inv) >> (31U - shift));
+  s = (q31_t) (((q63_t) r * r) >> 31);
+
+  /* atan(r) / pi in [0 0.25], Horner evaluation in r^2 */
+  acc = arm_vatan2_coef_q31[8];
+  for (i = 7; i >= 0; i--)
+  {
+    acc = (q31_t) (((q63_t) acc * s) >> 31) + arm_vatan2_coef_q31[i];
+  }
+  acc = (q31_t) (((q63_t) acc * r) >> 31);
+
+  /* Map the octant back to the full circle, pi saturating to 0x7FFFFFFF */
+  acc = (ay > ax) ? (0x40000000 - acc) : acc;
+  acc = (x < 0) ? clip_q63_to_q31((q63_t) 0x80000000 - acc) : acc;
+
+  return ((y < 0) ? -acc : acc);
+}
+
+/**
+ * @brief  Q31 four quadrant arctangent of a block of data.
+ * @param[in]       *pSrcY points to the y coordinates
+ * @param[in]       *pSrcX points to the x coordinates
+ * @param[out]      *pDst points to the output angles, divided by pi
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * \par
+ * The output is the angle divided by pi: the range [-1 +1) maps to [-pi pi).
+ * The maximum error is 12 LSB (1.7e-8 radians).
+ */
+
+void arm_vatan2_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = atan2(A, B) / pi */
+    pDst[0] = arm_vatan2_sample_q31(pSrcY[0], pSrcX[0]);
+    pDst[1] = arm_vatan2_sample_q31(pSrcY[1], pSrcX[1]);
+    pDst[2] = arm_vatan2_sample_q31(pSrcY[2], pSrcX[2]);
+    pDst[3] = arm_vatan2_sample_q31(pSrcY[3], pSrcX[3]);
+
+    /* Update the pointers to process the next samples */
+    pSrcY += 4U;
+    pSrcX += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = atan2(A, B) / pi */
+    *pDst = arm_vatan2_sample_q31(*pSrcY, *pSrcX);
+
+    pSrcY++;
+    pSrcX++;
+    pDst++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of atan2 group
+ */
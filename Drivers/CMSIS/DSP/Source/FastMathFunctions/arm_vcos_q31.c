@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vcos_q31.c
+ * Description:  Block cosine function for Q31 data
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup cos
+ * @{
+ */
+
+/**
+ * @brief  Fast approximation to the trigonometric cosine function for a block of Q31 data.
+ * @param[in]       *pSrc points to the input vector
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * \par
+ * Uses the same table and linear interpolation as <code>arm_cos_q31()</code>.
+ * The input is a phase in units of 2*pi: the whole Q31 range is accepted and wraps
+ * around, [-1 0) mapping to [-2*pi 0) and [0 +1) to [0 2*pi).
+ * The maximum absolute error is 1.9e-5, as for the scalar function.
+ */
+
+void arm_vcos_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t in;                                   /* Wrapped input */
+  uint32_t index;                                /* Table index */
+  q31_t fract, out;                              /* Temporary variables */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  uint32_t in1, in2, in3, in4;                   /* Wrapped input */
+  uint32_t index1, index2, index3, index4;       /* Table index */
+  q31_t fract1, fract2, fract3, fract4;          /* Temporary variables */
+  q31_t out1, out2, out3, out4;                  /* Temporary variables */
+#endif
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* Wrap the input to [0 1) (phase modulo 2*pi), add 0.25 (pi/2) to read the sine table */
+    in1 = (uint32_t) ((uint32_t) pSrc[0] + 0x20000000U);
+    in2 = (uint32_t) ((uint32_t) pSrc[1] + 0x20000000U);
+    in3 = (uint32_t) ((uint32_t) pSrc[2] + 0x20000000U);
+    in4 = (uint32_t) ((uint32_t) pSrc[3] + 0x20000000U);
+
+    /* Calculate the nearest index and the fractional value */
+    index1 = (in1 >> FAST_MATH_Q31_SHIFT) & 0x1FFU;
+    index2 = (in2 >> FAST_MATH_Q31_SHIFT) & 0x1FFU;
+    index3 = (in3 >> FAST_MATH_Q31_SHIFT) & 0x1FFU;
+    index4 = (in4 >> FAST_MATH_Q31_SHIFT) & 0x1FFU;
+    fract1 = (q31_t) ((in1 & 0x3FFFFFU) << 9);
+    fract2 = (q31_t) ((in2 & 0x3FFFFFU) << 9);
+    fract3 = (q31_t) ((in3 & 0x3FFFFFU) << 9);
+    fract4 = (q31_t) ((in4 & 0x3FFFFFU) << 9);
+
+    /* Linear interpolation between the two nearest values of the sin table */
+    out1 = (q31_t) (((q63_t) (0x80000000 - fract1) * sinTable_q31[index1]) >> 32);
+    out2 = (q31_t) (((q63_t) (0x80000000 - fract2) * sinTable_q31[index2]) >> 32);
+    out3 = (q31_t) (((q63_t) (0x80000000 - fract3) * sinTable_q31[index3]) >> 32);
+    out4 = (q31_t) (((q63_t) (0x80000000 - fract4) * sinTable_q31[index4]) >> 32);
+    pDst[0] = (q31_t) (((((q63_t) out1 << 32) + ((q63_t) fract1 * sinTable_q31[index1 + 1])) >> 32) << 1);
+    pDst[1] = (q31_t) (((((q63_t) out2 << 32) + ((q63_t) fract2 * sinTable_q31[index2 + 1])) >> 32) << 1);
+    pDst[2] = (q31_t) (((((q63_t) out3 << 32) + ((q63_t) fract3 * sinTable_q31[index3 + 1])) >> 32) << 1);
+    pDst[3] = (q31_t) (((((q63_t) out4 << 32) + ((q63_t) fract4 * sinTable_q31[index4 + 1])) >> 32) << 1);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* Wrap the input to [0 1) (phase modulo 2*pi), add 0.25 (pi/2) to read the sine table */
+    in = (uint32_t) ((uint32_t) *pSrc + 0x20000000U);
+
+    /* Calculate the nearest index and the fractional value */
+    index = (in >> FAST_MATH_Q31_SHIFT) & 0x1FFU;
+    fract = (q31_t) ((in & 0x3FFFFFU) << 9);
+
+    /* Linear interpolation between the two nearest values of the sin table */
+    out = (q31_t) (((q63_t) (0x80000000 - fract) * sinTable_q31[index]) >> 32);
+    *pDst = (q31_t) (((((q63_t) out << 32) + ((q63_t) fract * sinTable_q31[index + 1])) >> 32) << 1);
+
+    pSrc++;
+    pDst++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cos group
+ */
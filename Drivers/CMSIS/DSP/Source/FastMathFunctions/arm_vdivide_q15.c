@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vdivide_q15.c
+ * Description:  Block saturating division function for Q15 data
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup divide
+ * @{
+ */
+
+/**
+ * @brief  Saturating division of one Q15 value.
+ * @param[in]       a numerator
+ * @param[in]       b denominator
+ * @return a / b saturated to the Q15 range.
+ */
+CMSIS_INLINE __STATIC_INLINE q15_t arm_vdivide_sample_q15(
+  q15_t a,
+  q15_t b)
+{
+  q15_t quotient;                                /* Quotient before the shift */
+  int16_t shift;                                 /* Left shift of the quotient */
+
+  arm_divide_q15(a, b, &quotient, &shift);
+
+  if (shift > 0)
+  {
+    quotient = ((a ^ b) < 0) ? (q15_t) 0x8000 : (q15_t) 0x7FFF;
+  }
+
+  return (quotient);
+}
+
+/**
+ * @brief  Saturating division of a block for Q15 data.
+ * @param[in]       *pSrcA points to the numerators
+ * @param[in]       *pSrcB points to the denominators
+ * @param[out]      *pDst points to the quotients
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * \par
+ * The quotients are truncated towards zero and saturated to the Q15 range.
+ * A denominator of 0 gives the largest value of the sign of the numerator.
+ */
+
+void arm_vdivide_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = A / B */
+    pDst[0] = arm_vdivide_sample_q15(pSrcA[0], pSrcB[0]);
+    pDst[1] = arm_vdivide_sample_q15(pSrcA[1], pSrcB[1]);
+    pDst[2] = arm_vdivide_sample_q15(pSrcA[2], pSrcB[2]);
+    pDst[3] = arm_vdivide_sample_q15(pSrcA[3], pSrcB[3]);
+
+    /* Update the pointers to process the next samples */
+    pSrcA += 4U;
+    pSrcB += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A / B */
+    *pDst = arm_vdivide_sample_q15(*pSrcA, *pSrcB);
+
+    pSrcA++;
+    pSrcB++;
+    pDst++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of divide group
+ */
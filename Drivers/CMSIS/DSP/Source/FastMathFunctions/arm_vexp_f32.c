@@ -0,0 +1,211 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vexp_f32.c
+ * Description:  Block exponential function for floating-point data
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup exp Exponential
+ *
+ * Computes the exponential function <code>e^x</code> of a block of data.
+ *
+ * The floating-point version splits the input as <code>x = n * ln(2) + r</code>
+ * with <code>|r| <= ln(2)/2</code>, evaluates <code>e^r</code> with a degree 6
+ * minimax polynomial and builds <code>2^n</code> directly in the exponent field
+ * of the result.  The maximum relative error is 1.1e-7 (1.3 ulp).  Results that
+ * overflow are set to +infinity, results below the smallest normal number are
+ * flushed to zero.
+ *
+ * The fixed-point versions compute <code>2^(x * log2(e))</code> in the same way,
+ * the power of two becoming a shift.  Their input has 5 (Q31) or 4 (Q15)
+ * integer bits, matching the output format of the logarithm functions, and the
+ * result is saturated to the largest positive value for positive inputs.
+ *
+ * There are separate functions for floating-point, Q31, and Q15 data types.
+ */
+
+/**
+ * @addtogroup exp
+ * @{
+ */
+
+/**
+ * @brief  Floating-point exponential of a block of data.
+ * @param[in]       *pSrc points to the input vector
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+/* Access to the bits of a floating-point value */
+typedef union
+{
+  uint32_t i;
+  float32_t f;
+} arm_vexp_scale_f32;
+
+void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t in, t, r;                            /* Temporary variables */
+  int32_t n;                                     /* Power of two of the result */
+  arm_vexp_scale_f32 scale;                      /* 2^n */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  float32_t in1, in2, in3, in4;                  /* Temporary variables */
+  float32_t t1, t2, t3, t4;                      /* Temporary variables */
+  float32_t r1, r2, r3, r4;                      /* Temporary variables */
+  int32_t n1, n2, n3, n4;                        /* Power of two of the result */
+  arm_vexp_scale_f32 scale1, scale2, scale3, scale4;/* 2^n */
+#endif
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* Limit the input to the range where the result is zero, finite or +infinity */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+    in1 = (in1 > 89.0f) ? 89.0f : in1;
+    in2 = (in2 > 89.0f) ? 89.0f : in2;
+    in3 = (in3 > 89.0f) ? 89.0f : in3;
+    in4 = (in4 > 89.0f) ? 89.0f : in4;
+    in1 = (in1 < -104.0f) ? -104.0f : in1;
+    in2 = (in2 < -104.0f) ? -104.0f : in2;
+    in3 = (in3 < -104.0f) ? -104.0f : in3;
+    in4 = (in4 < -104.0f) ? -104.0f : in4;
+
+    /* n = round(x / ln(2)) */
+    t1 = in1 * 1.44269504089f;
+    t2 = in2 * 1.44269504089f;
+    t3 = in3 * 1.44269504089f;
+    t4 = in4 * 1.44269504089f;
+    n1 = (int32_t) (t1 + ((t1 < 0.0f) ? -0.5f : 0.5f));
+    n2 = (int32_t) (t2 + ((t2 < 0.0f) ? -0.5f : 0.5f));
+    n3 = (int32_t) (t3 + ((t3 < 0.0f) ? -0.5f : 0.5f));
+    n4 = (int32_t) (t4 + ((t4 < 0.0f) ? -0.5f : 0.5f));
+
+    /* r = x - n * ln(2), with ln(2) split in a part exact in single precision and a remainder */
+    r1 = (in1 - (float32_t) n1 * 0.693145751953125f) - (float32_t) n1 * 1.428606765330187e-6f;
+    r2 = (in2 - (float32_t) n2 * 0.693145751953125f) - (float32_t) n2 * 1.428606765330187e-6f;
+    r3 = (in3 - (float32_t) n3 * 0.693145751953125f) - (float32_t) n3 * 1.428606765330187e-6f;
+    r4 = (in4 - (float32_t) n4 * 0.693145751953125f) - (float32_t) n4 * 1.428606765330187e-6f;
+
+    /* 2^n built in the exponent field, saturated to 0 and +infinity */
+    n1 += 127;
+    n2 += 127;
+    n3 += 127;
+    n4 += 127;
+    n1 = (n1 < 0) ? 0 : ((n1 > 255) ? 255 : n1);
+    n2 = (n2 < 0) ? 0 : ((n2 > 255) ? 255 : n2);
+    n3 = (n3 < 0) ? 0 : ((n3 > 255) ? 255 : n3);
+    n4 = (n4 < 0) ? 0 : ((n4 > 255) ? 255 : n4);
+    scale1.i = (uint32_t) n1 << 23U;
+    scale2.i = (uint32_t) n2 << 23U;
+    scale3.i = (uint32_t) n3 << 23U;
+    scale4.i = (uint32_t) n4 << 23U;
+
+    /* C = e^r * 2^n, e^r computed with a minimax polynomial on [-ln(2)/2 ln(2)/2] */
+    pDst[0] = ((((((1.3836846130e-03f * r1 + 8.3748157982e-03f) * r1 + 4.1668225567e-02f) * r1 + 1.6666420170e-01f) * r1
+                 + 4.9999992080e-01f) * r1 + 1.0000000363e+00f) * r1 + 1.0000000006e+00f) * scale1.f;
+    pDst[1] = ((((((1.3836846130e-03f * r2 + 8.3748157982e-03f) * r2 + 4.1668225567e-02f) * r2 + 1.6666420170e-01f) * r2
+                 + 4.9999992080e-01f) * r2 + 1.0000000363e+00f) * r2 + 1.0000000006e+00f) * scale2.f;
+    pDst[2] = ((((((1.3836846130e-03f * r3 + 8.3748157982e-03f) * r3 + 4.1668225567e-02f) * r3 + 1.6666420170e-01f) * r3
+                 + 4.9999992080e-01f) * r3 + 1.0000000363e+00f) * r3 + 1.0000000006e+00f) * scale3.f;
+    pDst[3] = ((((((1.3836846130e-03f * r4 + 8.3748157982e-03f) * r4 + 4.1668225567e-02f) * r4 + 1.6666420170e-01f) * r4
+                 + 4.9999992080e-01f) * r4 + 1.0000000363e+00f) * r4 + 1.0000000006e+00f) * scale4.f;
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* Limit the input to the range where the result is zero, finite or +infinity */
+    in = *pSrc;
+    in = (in > 89.0f) ? 89.0f : in;
+    in = (in < -104.0f) ? -104.0f : in;
+
+    /* n = round(x / ln(2)) */
+    t = in * 1.44269504089f;
+    n = (int32_t) (t + ((t < 0.0f) ? -0.5f : 0.5f));
+
+    /* r = x - n * ln(2), with ln(2) split in a part exact in single precision and a remainder */
+    r = (in - (float32_t) n * 0.693145751953125f) - (float32_t) n * 1.428606765330187e-6f;
+
+    /* 2^n built in the exponent field, saturated to 0 and +infinity */
+    n += 127;
+    n = (n < 0) ? 0 : ((n > 255) ? 255 : n);
+    scale.i = (uint32_t) n << 23U;
+
+    /* C = e^r * 2^n, e^r computed with a minimax polynomial on [-ln(2)/2 ln(2)/2] */
+    *pDst = ((((((1.3836846130e-03f * r + 8.3748157982e-03f) * r + 4.1668225567e-02f) * r + 1.6666420170e-01f) * r
+                 + 4.9999992080e-01f) * r + 1.0000000363e+00f) * r + 1.0000000006e+00f) * scale.f;
+
+    pSrc++;
+    pDst++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of exp group
+ */
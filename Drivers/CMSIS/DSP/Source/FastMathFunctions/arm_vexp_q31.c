@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vexp_q31.c
+ * Description:  Block exponential function for Q31 data
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup exp
+ * @{
+ */
+
+/* Minimax polynomial of 2^f on [0 1) without its constant term, lowest degree first, in 1.31 format */
+static const q31_t arm_vexp_coef_q31[7] =
+{
+  1488522251, 515882171, 119196729, 20644847, 2884123, 307009, 46516
+};
+
+/**
+ * @brief  Q31 exponential of one value.
+ * @param[in]       in input value in 6.26 format
+ * @return e^in in 1.31 format.
+ */
+CMSIS_INLINE __STATIC_INLINE q31_t arm_vexp_sample_q31(
+  q31_t in)
+{
+  q63_t w, p;                                    /* x * log2(e) and 2^f */
+  q31_t f, acc;                                  /* Fractional part and accumulator */
+  int32_t k;                                     /* Integer part */
+  uint32_t shift;                                /* Shift applying 2^k */
+  int32_t i;                                     /* Loop counter */
+
+  /* e^x is 1 or more for x >= 0: saturate */
+  if (in >= 0)
+  {
+    return (0x7FFFFFFF);
+  }
+
+  /* w = x * log2(e) in 7.56 format, split in integer part k <= -1 and fraction f in [0 1) */
+  w = (q63_t) in * 1549082005;
+  k = (int32_t) (w >> 56);
+  f = (q31_t) ((w >> 25) & 0x7FFFFFFF);
+
+  /* The result is below 0.5 LSB */
+  if (k < -32)
+  {
+    return (0);
+  }
+
+  /* 2^f - c0 in 1.31 format, Horner evaluation with rounding */
+  acc = arm_vexp_coef_q31[6];
+  for (i = 5; i >= 0; i--)
+  {
+    acc = (q31_t) ((((q63_t) acc * f) + 0x40000000) >> 31) + arm_vexp_coef_q31[i];
+  }
+
+  /* 2^f in 3.61 format, with the constant term c0 kept at full precision */
+  p = (((q63_t) acc * f) >> 1) + 2305843009081690112LL;
+
+  /* C = 2^f * 2^k, rounded to 1.31 format */
+  shift = (uint32_t) (30 - k);
+  p = (p + ((q63_t) 1 << (shift - 1U))) >> shift;
+
+  return (clip_q63_to_q31(p));
+}
+
+/**
+ * @brief  Q31 exponential of a block of data.
+ * @param[in]       *pSrc points to the input vector, in 6.26 format
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * \par
+ * The input is in 6.26 format, the range [-32 32), the output format of <code>arm_vlog_q31()</code>.
+ * The output is in 1.31 format: inputs of 0 or more saturate to 0x7FFFFFFF.
+ * The maximum error is 3.3 LSB.
+ */
+
+void arm_vexp_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = e^A */
+    pDst[0] = arm_vexp_sample_q31(pSrc[0]);
+    pDst[1] = arm_vexp_sample_q31(pSrc[1]);
+    pDst[2] = arm_vexp_sample_q31(pSrc[2]);
+    pDst[3] = arm_vexp_sample_q31(pSrc[3]);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = e^A */
+    *pDst = arm_vexp_sample_q31(*pSrc);
+
+    pSrc++;
+    pDst++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of exp group
+ */
@@ -0,0 +1,251 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vlog_f32.c
+ * Description:  Block natural logarithm function for floating-point data
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup log Natural Logarithm
+ *
+ * Computes the natural logarithm <code>ln(x)</code> of a block of data.
+ *
+ * The input is split as <code>x = m * 2^e</code> with <code>m</code> in
+ * <code>[sqrt(2)/2 sqrt(2))</code> and <code>ln(m)</code> is approximated by a
+ * polynomial, so <code>ln(x) = ln(m) + e * ln(2)</code>.
+ *
+ * The floating-point version evaluates <code>ln(m) = 2 * atanh((m - 1) / (m + 1))</code>
+ * with a degree 9 odd series.  The maximum absolute error is 6e-8 for x in [0.5 1.5]
+ * and the maximum relative error 1.6 ulp elsewhere.
+ * Zero and denormal inputs give -infinity, negative inputs give NaN.
+ *
+ * The fixed-point versions take an input in (0 1) and normalize it with a count
+ * of leading zeros.  The result, which is negative, has 5 (Q31) or 4 (Q15)
+ * integer bits: it is returned in 6.26 or 5.11 format.
+ * Zero and negative inputs give the most negative output value.
+ *
+ * There are separate functions for floating-point, Q31, and Q15 data types.
+ */
+
+/**
+ * @addtogroup log
+ * @{
+ */
+
+/* Access to the bits of a floating-point value */
+typedef union
+{
+  uint32_t i;
+  float32_t f;
+} arm_vlog_bits_f32;
+
+/**
+ * @brief  Logarithm of the inputs outside of the normal positive range.
+ * @param[in]       bits bits of the input value
+ * @return ln(x).
+ */
+static float32_t arm_vlog_special_f32(
+  uint32_t bits)
+{
+  arm_vlog_bits_f32 result;
+
+  if ((bits & 0x7FFFFFFFU) < 0x00800000U)
+  {
+    /* Zero or denormal of either sign: -infinity */
+    result.i = 0xFF800000U;
+  }
+  else if (bits <= 0x7F800000U)
+  {
+    /* +infinity */
+    result.i = bits;
+  }
+  else
+  {
+    /* Negative or NaN: NaN */
+    result.i = 0x7FC00000U;
+  }
+
+  return (result.f);
+}
+
+/**
+ * @brief  Floating-point natural logarithm of a block of data.
+ * @param[in]       *pSrc points to the input vector
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t z, zz, r;                            /* Temporary variables */
+  arm_vlog_bits_f32 conv;                        /* Bits of the input and mantissa */
+  uint32_t bits;                                 /* Bits of the input */
+  uint32_t big;                                  /* Set when the mantissa is above sqrt(2) */
+  int32_t e;                                     /* Exponent of the input */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  float32_t z1, z2, z3, z4;                      /* Temporary variables */
+  float32_t zz1, zz2, zz3, zz4;                  /* Temporary variables */
+  float32_t r1, r2, r3, r4;                      /* Temporary variables */
+  arm_vlog_bits_f32 conv1, conv2, conv3, conv4;  /* Bits of the input and mantissa */
+  uint32_t bits1, bits2, bits3, bits4;           /* Bits of the input */
+  uint32_t big1, big2, big3, big4;               /* Set when the mantissa is above sqrt(2) */
+  int32_t e1, e2, e3, e4;                        /* Exponent of the input */
+#endif
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* Read the input as an integer to extract the exponent and mantissa */
+    conv1.f = pSrc[0];
+    conv2.f = pSrc[1];
+    conv3.f = pSrc[2];
+    conv4.f = pSrc[3];
+    bits1 = conv1.i;
+    bits2 = conv2.i;
+    bits3 = conv3.i;
+    bits4 = conv4.i;
+
+    /* x = m * 2^e with m in [sqrt(2)/2 sqrt(2)) */
+    e1 = (int32_t) (bits1 >> 23U) - 127;
+    e2 = (int32_t) (bits2 >> 23U) - 127;
+    e3 = (int32_t) (bits3 >> 23U) - 127;
+    e4 = (int32_t) (bits4 >> 23U) - 127;
+    conv1.i = (bits1 & 0x007FFFFFU) | 0x3F800000U;
+    conv2.i = (bits2 & 0x007FFFFFU) | 0x3F800000U;
+    conv3.i = (bits3 & 0x007FFFFFU) | 0x3F800000U;
+    conv4.i = (bits4 & 0x007FFFFFU) | 0x3F800000U;
+    big1 = (conv1.i > 0x3FB504F3U) ? 1U : 0U;
+    big2 = (conv2.i > 0x3FB504F3U) ? 1U : 0U;
+    big3 = (conv3.i > 0x3FB504F3U) ? 1U : 0U;
+    big4 = (conv4.i > 0x3FB504F3U) ? 1U : 0U;
+    conv1.i -= big1 << 23U;
+    conv2.i -= big2 << 23U;
+    conv3.i -= big3 << 23U;
+    conv4.i -= big4 << 23U;
+    e1 += (int32_t) big1;
+    e2 += (int32_t) big2;
+    e3 += (int32_t) big3;
+    e4 += (int32_t) big4;
+
+    /* ln(m) = 2 * atanh(z) with z = (m - 1) / (m + 1) and |z| < 0.1716 */
+    z1 = (conv1.f - 1.0f) / (conv1.f + 1.0f);
+    z2 = (conv2.f - 1.0f) / (conv2.f + 1.0f);
+    z3 = (conv3.f - 1.0f) / (conv3.f + 1.0f);
+    z4 = (conv4.f - 1.0f) / (conv4.f + 1.0f);
+    zz1 = z1 * z1;
+    zz2 = z2 * z2;
+    zz3 = z3 * z3;
+    zz4 = z4 * z4;
+    r1 = z1 * (2.0f + zz1 * (0.666666667f + zz1 * (0.4f + zz1 * (0.285714286f + zz1 * 0.222222222f))));
+    r2 = z2 * (2.0f + zz2 * (0.666666667f + zz2 * (0.4f + zz2 * (0.285714286f + zz2 * 0.222222222f))));
+    r3 = z3 * (2.0f + zz3 * (0.666666667f + zz3 * (0.4f + zz3 * (0.285714286f + zz3 * 0.222222222f))));
+    r4 = z4 * (2.0f + zz4 * (0.666666667f + zz4 * (0.4f + zz4 * (0.285714286f + zz4 * 0.222222222f))));
+
+    /* C = ln(m) + e * ln(2), with ln(2) split in a part exact in single precision and a remainder */
+    r1 = (r1 + (float32_t) e1 * 1.428606765330187e-6f) + (float32_t) e1 * 0.693145751953125f;
+    r2 = (r2 + (float32_t) e2 * 1.428606765330187e-6f) + (float32_t) e2 * 0.693145751953125f;
+    r3 = (r3 + (float32_t) e3 * 1.428606765330187e-6f) + (float32_t) e3 * 0.693145751953125f;
+    r4 = (r4 + (float32_t) e4 * 1.428606765330187e-6f) + (float32_t) e4 * 0.693145751953125f;
+
+    /* Zero, denormal, negative and non finite inputs are handled separately */
+    pDst[0] = ((bits1 - 0x00800000U) < 0x7F000000U) ? r1 : arm_vlog_special_f32(bits1);
+    pDst[1] = ((bits2 - 0x00800000U) < 0x7F000000U) ? r2 : arm_vlog_special_f32(bits2);
+    pDst[2] = ((bits3 - 0x00800000U) < 0x7F000000U) ? r3 : arm_vlog_special_f32(bits3);
+    pDst[3] = ((bits4 - 0x00800000U) < 0x7F000000U) ? r4 : arm_vlog_special_f32(bits4);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* Read the input as an integer to extract the exponent and mantissa */
+    conv.f = *pSrc;
+    bits = conv.i;
+
+    /* x = m * 2^e with m in [sqrt(2)/2 sqrt(2)) */
+    e = (int32_t) (bits >> 23U) - 127;
+    conv.i = (bits & 0x007FFFFFU) | 0x3F800000U;
+    big = (conv.i > 0x3FB504F3U) ? 1U : 0U;
+    conv.i -= big << 23U;
+    e += (int32_t) big;
+
+    /* ln(m) = 2 * atanh(z) with z = (m - 1) / (m + 1) and |z| < 0.1716 */
+    z = (conv.f - 1.0f) / (conv.f + 1.0f);
+    zz = z * z;
+    r = z * (2.0f + zz * (0.666666667f + zz * (0.4f + zz * (0.285714286f + zz * 0.222222222f))));
+
+    /* C = ln(m) + e * ln(2), with ln(2) split in a part exact in single precision and a remainder */
+    r = (r + (float32_t) e * 1.428606765330187e-6f) + (float32_t) e * 0.693145751953125f;
+
+    /* Zero, denormal, negative and non finite inputs are handled separately */
+    *pDst = ((bits - 0x00800000U) < 0x7F000000U) ? r : arm_vlog_special_f32(bits);
+
+    pSrc++;
+    pDst++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of log group
+ */
@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vlog_q15.c
+ * Description:  Block natural logarithm function for Q15 data
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup log
+ * @{
+ */
+
+/* Minimax polynomial of ln(1 + u) on [0 1), lowest degree first, in 1.15 format */
+static const q31_t arm_vlog_coef_q15[5] =
+{
+  2, 32655, -15330, 7238, -1854
+};
+
+/**
+ * @brief  Q15 natural logarithm of one value.
+ * @param[in]       in input value in 1.15 format
+ * @return ln(in) in 5.11 format.
+ */
+CMSIS_INLINE __STATIC_INLINE q15_t arm_vlog_sample_q15(
+  q15_t in)
+{
+  q31_t u, acc;                                  /* Normalized input and accumulator */
+  uint32_t k;                                    /* Normalization shift */
+  int32_t i;                                     /* Loop counter */
+
+  /* The logarithm of 0 and of negative values is not defined: return the minimum */
+  if (in <= 0)
+  {
+    return ((q15_t) 0x8000);
+  }
+
+  /* x = (1 + u) * 2^-k with u in [0 1) */
+  k = __CLZ(in) - 16U;
+  u = ((q31_t) in << k) & 0x7FFF;
+
+  /* ln(1 + u) in 1.15 format, Horner evaluation */
+  acc = arm_vlog_coef_q15[4];
+  for (i = 3; i >= 0; i--)
+  {
+    acc = ((acc * u) >> 15) + arm_vlog_coef_q15[i];
+  }
+
+  /* C = ln(1 + u) - k * ln(2), rounded to 5.11 format */
+  acc = acc - (q31_t) k * 22713;
+
+  return ((q15_t) ((acc + 8) >> 4));
+}
+
+/**
+ * @brief  Q15 natural logarithm of a block of data.
+ * @param[in]       *pSrc points to the input vector
+ * @param[out]      *pDst points to the output vector, in 5.11 format
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * \par
+ * The input range is (0 +1), the output is negative and in 5.11 format.
+ * Zero and negative inputs give 0x8000.  The maximum error is 1 LSB.
+ */
+
+void arm_vlog_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = ln(A) */
+    pDst[0] = arm_vlog_sample_q15(pSrc[0]);
+    pDst[1] = arm_vlog_sample_q15(pSrc[1]);
+    pDst[2] = arm_vlog_sample_q15(pSrc[2]);
+    pDst[3] = arm_vlog_sample_q15(pSrc[3]);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = ln(A) */
+    *pDst = arm_vlog_sample_q15(*pSrc);
+
+    pSrc++;
+    pDst++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of log group
+ */
@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vlog_q31.c
+ * Description:  Block natural logarithm function for Q31 data
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup log
+ * @{
+ */
+
+/* Minimax polynomial of ln(1 + u) on [0 1), lowest degree first, in 1.31 format */
+static const q31_t arm_vlog_coef_q31[10] =
+{
+  10, 2147481555, -1073667310, 714789516, -529393298, 397616406, -270706318, 144513947,
+  -50369980, 8257718
+};
+
+/**
+ * @brief  Q31 natural logarithm of one value.
+ * @param[in]       in input value in 1.31 format
+ * @return ln(in) in 6.26 format.
+ */
+CMSIS_INLINE __STATIC_INLINE q31_t arm_vlog_sample_q31(
+  q31_t in)
+{
+  q31_t u, acc;                                  /* Normalized input and accumulator */
+  q63_t p;                                       /* ln(1 + u) - k * ln(2) in 1.62 format */
+  uint32_t k;                                    /* Normalization shift */
+  int32_t i;                                     /* Loop counter */
+
+  /* The logarithm of 0 and of negative values is not defined: return the minimum */
+  if (in <= 0)
+  {
+    return ((q31_t) 0x80000000);
+  }
+
+  /* x = (1 + u) * 2^-k with u in [0 1) */
+  k = __CLZ(in);
+  u = (q31_t) (((uint32_t) in << k) & 0x7FFFFFFFU);
+
+  /* ln(1 + u) in 1.31 format, Horner evaluation */
+  acc = arm_vlog_coef_q31[9];
+  for (i = 8; i >= 0; i--)
+  {
+    acc = (q31_t) (((q63_t) acc * u) >> 31) + arm_vlog_coef_q31[i];
+  }
+
+  /* C = ln(1 + u) - k * ln(2), rounded to 6.26 format */
+  p = (q63_t) acc - (q63_t) k * 1488522236;
+
+  return ((q31_t) ((p + 16) >> 5));
+}
+
+/**
+ * @brief  Q31 natural logarithm of a block of data.
+ * @param[in]       *pSrc points to the input vector
+ * @param[out]      *pDst points to the output vector, in 6.26 format
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * \par
+ * The input range is (0 +1), the output is negative and in 6.26 format.
+ * Zero and negative inputs give 0x80000000.  The maximum error is 1 LSB.
+ */
+
+void arm_vlog_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = ln(A) */
+    pDst[0] = arm_vlog_sample_q31(pSrc[0]);
+    pDst[1] = arm_vlog_sample_q31(pSrc[1]);
+    pDst[2] = arm_vlog_sample_q31(pSrc[2]);
+    pDst[3] = arm_vlog_sample_q31(pSrc[3]);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = ln(A) */
+    *pDst = arm_vlog_sample_q31(*pSrc);
+
+    pSrc++;
+    pDst++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of log group
+ */
@@ -0,0 +1,175 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsin_f32.c
+ * Description:  Block sine function for floating-point data
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup sin
+ * @{
+ */
+
+/**
+ * @brief  Fast approximation to the trigonometric sine function for a block of floating-point data.
+ * @param[in]       *pSrc points to the input vector, in radians
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * \par
+ * Uses the same table and linear interpolation as <code>arm_sin_f32()</code>, without the
+ * function call overhead, with loop unrolling on Cortex-M4 and Cortex-M7.
+ * The maximum absolute error is 1.9e-5 for inputs in the range [-2*pi 2*pi].
+ */
+
+void arm_vsin_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t in, findex, fract;                   /* Temporary variables */
+  int32_t n;                                     /* Floor value of the scaled input */
+  uint16_t index;                                /* Table index */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  float32_t in1, in2, in3, in4;                  /* Temporary variables */
+  float32_t findex1, findex2, findex3, findex4;  /* Temporary variables */
+  float32_t fract1, fract2, fract3, fract4;      /* Temporary variables */
+  int32_t n1, n2, n3, n4;                        /* Floor value of the scaled input */
+  uint16_t index1, index2, index3, index4;       /* Table index */
+#endif
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* Scale the input to [0 1] range from [0 2*PI], divide input by 2*pi */
+    in1 = pSrc[0] * 0.159154943092f;
+    in2 = pSrc[1] * 0.159154943092f;
+    in3 = pSrc[2] * 0.159154943092f;
+    in4 = pSrc[3] * 0.159154943092f;
+
+    /* Calculation of floor value of input, rounding negative values towards -infinity */
+    n1 = (int32_t) in1;
+    n2 = (int32_t) in2;
+    n3 = (int32_t) in3;
+    n4 = (int32_t) in4;
+    n1 = (in1 < 0.0f) ? (n1 - 1) : n1;
+    n2 = (in2 < 0.0f) ? (n2 - 1) : n2;
+    n3 = (in3 < 0.0f) ? (n3 - 1) : n3;
+    n4 = (in4 < 0.0f) ? (n4 - 1) : n4;
+
+    /* Map input value to [0 1] and compute the table index */
+    findex1 = (float32_t) FAST_MATH_TABLE_SIZE * (in1 - (float32_t) n1);
+    findex2 = (float32_t) FAST_MATH_TABLE_SIZE * (in2 - (float32_t) n2);
+    findex3 = (float32_t) FAST_MATH_TABLE_SIZE * (in3 - (float32_t) n3);
+    findex4 = (float32_t) FAST_MATH_TABLE_SIZE * (in4 - (float32_t) n4);
+    index1 = (uint16_t) findex1;
+    index2 = (uint16_t) findex2;
+    index3 = (uint16_t) findex3;
+    index4 = (uint16_t) findex4;
+
+    /* fractional value calculation */
+    fract1 = findex1 - (float32_t) index1;
+    fract2 = findex2 - (float32_t) index2;
+    fract3 = findex3 - (float32_t) index3;
+    fract4 = findex4 - (float32_t) index4;
+
+    /* Linear interpolation between the two nearest values of the sin table */
+    index1 &= 0x1ff;
+    index2 &= 0x1ff;
+    index3 &= 0x1ff;
+    index4 &= 0x1ff;
+    pDst[0] = (1.0f - fract1) * sinTable_f32[index1] + fract1 * sinTable_f32[index1 + 1];
+    pDst[1] = (1.0f - fract2) * sinTable_f32[index2] + fract2 * sinTable_f32[index2 + 1];
+    pDst[2] = (1.0f - fract3) * sinTable_f32[index3] + fract3 * sinTable_f32[index3 + 1];
+    pDst[3] = (1.0f - fract4) * sinTable_f32[index4] + fract4 * sinTable_f32[index4 + 1];
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* Scale the input to [0 1] range from [0 2*PI], divide input by 2*pi */
+    in = *pSrc * 0.159154943092f;
+
+    /* Calculation of floor value of input, rounding negative values towards -infinity */
+    n = (int32_t) in;
+    n = (in < 0.0f) ? (n - 1) : n;
+
+    /* Map input value to [0 1] and compute the table index */
+    findex = (float32_t) FAST_MATH_TABLE_SIZE * (in - (float32_t) n);
+    index = (uint16_t) findex;
+
+    /* fractional value calculation */
+    fract = findex - (float32_t) index;
+
+    /* Linear interpolation between the two nearest values of the sin table */
+    index &= 0x1ff;
+    *pDst = (1.0f - fract) * sinTable_f32[index] + fract * sinTable_f32[index + 1];
+
+    pSrc++;
+    pDst++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of sin group
+ */
@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsqrt_q31.c
+ * Description:  Block square root function for Q31 data
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup SQRT
+ * @{
+ */
+
+/**
+ * @brief  Q31 square root of one value, without floating-point conversion.
+ * @param[in]       in input value
+ * @return sqrt(in), or 0 for negative inputs.
+ */
+CMSIS_INLINE __STATIC_INLINE q31_t arm_vsqrt_kernel_q31(
+  q31_t in)
+{
+  q31_t m, y, t;                                 /* Normalized input, 1/sqrt(m) and temporary */
+  q63_t e;                                       /* Residual m - sqrt(m)^2 in 2.62 format */
+  uint32_t shift;                                /* Even normalization shift */
+  uint32_t i;                                    /* Loop counter */
+
+  if (in <= 0)
+  {
+    return (0);
+  }
+
+  /* Normalize the input to m in [0.25 1) with an even shift */
+  shift = ((uint32_t) __CLZ(in) - 1U) & ~1U;
+  m = in << shift;
+
+  /* Initial estimate of 1/sqrt(m) in 3.29 format, quadratic minimax with a 2.4% error */
+  y = (q31_t) (((q63_t) 879699408 * m) >> 31) + (-1763812389);
+  y = (q31_t) (((q63_t) y * m) >> 31) + 1433893831;
+
+  /* Three Newton-Raphson iterations y = y * (3 - m * y^2) / 2 */
+  for (i = 0U; i < 3U; i++)
+  {
+    t = (q31_t) (((q63_t) m * y) >> 31);
+    t = (q31_t) (((q63_t) t * y) >> 29);
+    y = (q31_t) (((q63_t) y * (0x60000000 - t)) >> 30);
+  }
+
+  /* sqrt(m) = m * y, corrected with the exact residual: s = s + y * (m - s^2) / 2 */
+  t = clip_q63_to_q31(((q63_t) m * y) >> 29);
+  e = ((q63_t) m << 31) - (q63_t) t * t;
+  e = (q63_t) t + ((((e >> 20) * y) + ((q63_t) 1 << 40)) >> 41);
+
+  /* Scale back by half the normalization shift, with rounding */
+  shift >>= 1U;
+  if (shift > 0U)
+  {
+    e = (e + ((q63_t) 1 << (shift - 1U))) >> shift;
+  }
+
+  return (clip_q63_to_q31(e));
+}
+
+/**
+ * @brief  Q31 square root of a block of data.
+ * @param[in]       *pSrc points to the input vector
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * \par
+ * The input range is [0 +1).  The result is computed with fixed-point Newton-Raphson
+ * iterations on the reciprocal square root followed by a correction with the exact
+ * residual, without the floating-point conversions of <code>arm_sqrt_q31()</code>.
+ * The maximum error is 1 LSB.  Negative inputs give a zero output.
+ */
+
+void arm_vsqrt_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = sqrt(A) */
+    pDst[0] = arm_vsqrt_kernel_q31(pSrc[0]);
+    pDst[1] = arm_vsqrt_kernel_q31(pSrc[1]);
+    pDst[2] = arm_vsqrt_kernel_q31(pSrc[2]);
+    pDst[3] = arm_vsqrt_kernel_q31(pSrc[3]);
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = sqrt(A) */
+    *pDst = arm_vsqrt_kernel_q31(*pSrc);
+
+    pSrc++;
+    pDst++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of SQRT group
+ */
@@ -0,0 +1,331 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_f32.c
+ * Description:  FFT-based convolution of floating-point sequences
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup ConvFFT FFT-based Convolution and Correlation
+ *
+ * The direct convolution and correlation functions compute <code>srcALen * srcBLen</code>
+ * products: two sequences of 2048 samples need more than four million multiply-accumulates.
+ * The functions of this group compute the same results with fast Fourier transforms, in
+ * O(L log L) operations where <code>L</code> is the length of the output.
+ *
+ * \par Algorithm
+ * The two real sequences are zero padded to the smallest power of 2 <code>fftLen</code>,
+ * at least 32, that holds <code>srcALen + srcBLen - 1</code> samples.  They are transformed
+ * together as the real and imaginary parts of one complex sequence with arm_cfft_f32().
+ * The spectrum of each sequence is extracted from the symmetries of the result and the
+ * product of the two spectra, <code>A[k] * B[k]</code> for the convolution and
+ * <code>A[k] * conj(B[k])</code> for the correlation, is transformed back with
+ * arm_rfft_fast_f32().  The outputs have the same lengths and layouts as the outputs
+ * of arm_conv_f32() and arm_correlate_f32().
+ *
+ * \par
+ * The length of the FFT is limited to 4096: <code>srcALen + srcBLen - 1</code> must not be more
+ * than 4096.  The functions use a scratch buffer of <code>2 * fftLen</code> values.
+ *
+ * \par Generalized cross-correlation
+ * arm_gcc_phat_f32() computes the cross-correlation with the phase transform weighting
+ * (GCC-PHAT): each bin of the cross-spectrum is divided by its magnitude before the inverse
+ * transform.  Only the phase differences between the inputs remain, which turns the
+ * correlation peak of a delay into a sharp peak even for colored or reverberant signals.
+ * It is the usual estimator of the time difference of arrival between two microphones.
+ *
+ * \par Automatic selection
+ * arm_conv_auto_f32() and arm_correlate_auto_f32() select the direct or the FFT method from
+ * the lengths of the inputs with a cost model, in cycles:
+ * <pre>
+ *     direct = ARM_CONV_COST_MAC * srcALen * srcBLen
+ *     FFT    = fftLen * (ARM_CONV_COST_FFT * log2(fftLen) + ARM_CONV_COST_BIN)
+ * </pre>
+ * The default constants are unmeasured estimates for a Cortex-M4 with FPU, not fitted to
+ * benchmark results.  Define them at build time with the values of the target: the
+ * <code>arm_conv_fft_benchmark</code> test of the DSP_Lib_TestSuite prints the cycles of both
+ * methods for a range of lengths, from which the constants are fitted.  With the defaults the FFT
+ * is selected for two inputs longer than about 100 samples, and the direct method when one of the
+ * inputs is short.
+ *
+ * \par
+ * The results of the two methods are equal within the rounding errors of the FFT: the relative
+ * error of the FFT method is about 1e-6 of the largest output.  Small outputs next to large ones
+ * have a larger relative error than with the direct method.
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+/* Cost model of the automatic selection: unmeasured estimates for a Cortex-M4 with FPU */
+
+#ifndef ARM_CONV_COST_MAC
+/* Cycles of one multiply-accumulate of the direct method */
+#define ARM_CONV_COST_MAC 2.0f
+#endif
+
+#ifndef ARM_CONV_COST_FFT
+/* Cycles per fftLen * log2(fftLen) of the complex FFT and the real inverse FFT */
+#define ARM_CONV_COST_FFT 8.5f
+#endif
+
+#ifndef ARM_CONV_COST_BIN
+/* Cycles per fftLen of the zero padding, the spectral product and the output copy */
+#define ARM_CONV_COST_BIN 20.0f
+#endif
+
+/**
+ * @brief  Length of the FFT for an output length.
+ * @param[in]       outLen length of the linear convolution or correlation
+ * @return power of 2 from 32 to 4096, or 0 when <code>outLen</code> is more than 4096.
+ */
+CMSIS_INLINE __STATIC_INLINE uint32_t arm_conv_fft_len_f32(
+  uint32_t outLen)
+{
+  uint32_t fftLen = 32U;                         /* Smallest length of arm_rfft_fast_f32() */
+
+  while ((fftLen < outLen) && (fftLen < 4096U))
+  {
+    fftLen <<= 1U;
+  }
+
+  return ((fftLen < outLen) ? 0U : fftLen);
+}
+
+/**
+ * @brief  Complex FFT instance of a length.
+ * @param[in]       fftLen power of 2 from 32 to 4096
+ * @return points to the constant instance.
+ */
+static const arm_cfft_instance_f32 * arm_conv_fft_cfft_f32(
+  uint32_t fftLen)
+{
+  switch (fftLen)
+  {
+  case 32U:
+    return (&arm_cfft_sR_f32_len32);
+  case 64U:
+    return (&arm_cfft_sR_f32_len64);
+  case 128U:
+    return (&arm_cfft_sR_f32_len128);
+  case 256U:
+    return (&arm_cfft_sR_f32_len256);
+  case 512U:
+    return (&arm_cfft_sR_f32_len512);
+  case 1024U:
+    return (&arm_cfft_sR_f32_len1024);
+  case 2048U:
+    return (&arm_cfft_sR_f32_len2048);
+  default:
+    return (&arm_cfft_sR_f32_len4096);
+  }
+}
+
+/**
+ * @brief  Circular convolution or correlation of two zero padded sequences.
+ * @param[in]       *pSrcA points to the first input sequence.
+ * @param[in]       srcALen length of the first input sequence.
+ * @param[in]       *pSrcB points to the second input sequence.
+ * @param[in]       srcBLen length of the second input sequence.
+ * @param[in]       mode 0 for the convolution, 1 for the correlation, 2 for the correlation with PHAT weighting.
+ * @param[in,out]   *pScratch points to the scratch buffer, 2 * fftLen values.
+ * @return length of the FFT, or 0 when <code>srcALen + srcBLen - 1</code> is more than 4096 or the
+ * inverse FFT cannot be initialized.
+ *
+ * \par
+ * The <code>fftLen</code> samples of the circular result are written to <code>pScratch + fftLen</code>.
+ * Shared by arm_conv_fft_f32(), arm_correlate_fft_f32() and arm_gcc_phat_f32().
+ */
+
+uint32_t arm_conv_fft_kernel_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  uint8_t mode,
+  float32_t * pScratch)
+{
+  arm_rfft_fast_instance_f32 rfft;               /* Inverse real FFT */
+  float32_t *pZ = pScratch;                      /* Spectrum of a + j b, then product of the spectra */
+  float32_t zkRe, zkIm, znRe, znIm;              /* Z[k] and Z[fftLen - k] */
+  float32_t aRe, aIm, bRe, bIm;                  /* 2 A[k] and 2 B[k] */
+  float32_t pRe, pIm;                            /* Product of the spectra */
+  float32_t mag;                                 /* Magnitude of the product */
+  uint32_t fftLen;                               /* Length of the FFT */
+  uint32_t i, k;                                 /* Loop counters */
+
+  fftLen = arm_conv_fft_len_f32(srcALen + srcBLen - 1U);
+  if ((fftLen == 0U) || (arm_rfft_fast_init_f32(&rfft, (uint16_t) fftLen) != ARM_MATH_SUCCESS))
+  {
+    return (0U);
+  }
+
+  /* z[n] = a[n] + j b[n], zero padded to fftLen */
+  arm_fill_f32(0.0f, pZ, 2U * fftLen);
+  for (i = 0U; i < srcALen; i++)
+  {
+    pZ[2U * i] = pSrcA[i];
+  }
+  for (i = 0U; i < srcBLen; i++)
+  {
+    pZ[(2U * i) + 1U] = pSrcB[i];
+  }
+
+  arm_cfft_f32(arm_conv_fft_cfft_f32(fftLen), pZ, 0U, 1U);
+
+  /* Bins 0 and fftLen / 2 of A and B are real: packed in the first complex value */
+  pRe = pZ[0] * pZ[1];
+  pIm = pZ[fftLen] * pZ[fftLen + 1U];
+  if (mode == 2U)
+  {
+    pRe = (pRe > 0.0f) ? 1.0f : ((pRe < 0.0f) ? -1.0f : 0.0f);
+    pIm = (pIm > 0.0f) ? 1.0f : ((pIm < 0.0f) ? -1.0f : 0.0f);
+  }
+  pZ[0] = pRe;
+  pZ[1] = pIm;
+
+  /* Bin k of the product overwrites Z[k], which is not read any more */
+  for (k = 1U; k < (fftLen / 2U); k++)
+  {
+    zkRe = pZ[2U * k];
+    zkIm = pZ[(2U * k) + 1U];
+    znRe = pZ[2U * (fftLen - k)];
+    znIm = pZ[(2U * (fftLen - k)) + 1U];
+
+    /* 2 A[k] = Z[k] + conj(Z[N - k]), 2 B[k] = (Z[k] - conj(Z[N - k])) / j */
+    aRe = zkRe + znRe;
+    aIm = zkIm - znIm;
+    bRe = zkIm + znIm;
+    bIm = znRe - zkRe;
+
+    if (mode == 0U)
+    {
+      /* A[k] * B[k] */
+      pRe = 0.25f * ((aRe * bRe) - (aIm * bIm));
+      pIm = 0.25f * ((aRe * bIm) + (aIm * bRe));
+    }
+    else
+    {
+      /* A[k] * conj(B[k]) */
+      pRe = 0.25f * ((aRe * bRe) + (aIm * bIm));
+      pIm = 0.25f * ((aIm * bRe) - (aRe * bIm));
+    }
+
+    if (mode == 2U)
+    {
+      /* Phase transform: keep the phase only */
+      arm_sqrt_f32((pRe * pRe) + (pIm * pIm), &mag);
+      mag = (mag > 1.0e-30f) ? (1.0f / mag) : 0.0f;
+      pRe *= mag;
+      pIm *= mag;
+    }
+
+    pZ[2U * k] = pRe;
+    pZ[(2U * k) + 1U] = pIm;
+  }
+
+  /* Inverse real FFT of the first fftLen values to the second half of the scratch buffer */
+  arm_rfft_fast_f32(&rfft, pZ, pZ + fftLen, 1U);
+
+  return (fftLen);
+}
+
+/**
+ * @brief  Selects the method of the automatic convolution and correlation.
+ * @param[in]       srcALen length of the first input sequence.
+ * @param[in]       srcBLen length of the second input sequence.
+ * @return length of the FFT when the FFT method is faster, 0 when the direct method is faster.
+ *
+ * \par
+ * Shared by arm_conv_auto_f32() and arm_correlate_auto_f32().
+ */
+
+uint32_t arm_conv_fft_select_f32(
+  uint32_t srcALen,
+  uint32_t srcBLen)
+{
+  float32_t costDirect, costFFT;                 /* Estimated cycles of the two methods */
+  uint32_t fftLen;                               /* Length of the FFT */
+  uint32_t log2Len;                              /* log2(fftLen) */
+
+  fftLen = arm_conv_fft_len_f32(srcALen + srcBLen - 1U);
+  if (fftLen == 0U)
+  {
+    return (0U);
+  }
+
+  log2Len = 31U - __CLZ(fftLen);
+
+  costDirect = ARM_CONV_COST_MAC * (float32_t) srcALen * (float32_t) srcBLen;
+  costFFT = (float32_t) fftLen * ((ARM_CONV_COST_FFT * (float32_t) log2Len) + ARM_CONV_COST_BIN);
+
+  return ((costFFT < costDirect) ? fftLen : 0U);
+}
+
+/**
+ * @brief FFT-based convolution of floating-point sequences.
+ * @param[in]       *pSrcA points to the first input sequence.
+ * @param[in]       srcALen length of the first input sequence.
+ * @param[in]       *pSrcB points to the second input sequence.
+ * @param[in]       srcBLen length of the second input sequence.
+ * @param[out]      *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @param[in,out]   *pScratch points to the scratch buffer, 2 * fftLen values.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>srcALen + srcBLen - 1</code>
+ * is more than 4096.
+ */
+
+arm_status arm_conv_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch)
+{
+  uint32_t fftLen;                               /* Length of the FFT */
+
+  fftLen = arm_conv_fft_kernel_f32(pSrcA, srcALen, pSrcB, srcBLen, 0U, pScratch);
+  if (fftLen == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* The first srcALen + srcBLen - 1 samples of the circular convolution are the linear convolution */
+  arm_copy_f32(pScratch + fftLen, pDst, srcALen + srcBLen - 1U);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ConvFFT group
+ */
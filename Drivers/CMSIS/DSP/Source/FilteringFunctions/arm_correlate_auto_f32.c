@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_correlate_auto_f32.c
+ * Description:  Correlation with automatic selection of the direct or FFT method
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern uint32_t arm_conv_fft_select_f32(
+  uint32_t srcALen,
+  uint32_t srcBLen);
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+/**
+ * @brief Correlation of floating-point sequences with the faster of the direct and FFT methods.
+ * @param[in]       *pSrcA points to the first input sequence.
+ * @param[in]       srcALen length of the first input sequence.
+ * @param[in]       *pSrcB points to the second input sequence.
+ * @param[in]       srcBLen length of the second input sequence.
+ * @param[out]      *pDst points to the block of output data.  Length 2 * max(srcALen, srcBLen) - 1.
+ * @param[in,out]   *pScratch points to the scratch buffer of the FFT method, 2 * fftLen values, or NULL.
+ * @return none.
+ *
+ * \par
+ * The method is selected with the cost model of the group.  The direct method is always used when
+ * <code>pScratch</code> is NULL or when <code>srcALen + srcBLen - 1</code> is more than 4096, and
+ * <code>pScratch</code> can then be smaller than <code>2 * fftLen</code> values.
+ */
+
+void arm_correlate_auto_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch)
+{
+  if ((pScratch != NULL) && (arm_conv_fft_select_f32(srcALen, srcBLen) != 0U))
+  {
+    (void) arm_correlate_fft_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst, pScratch);
+  }
+  else
+  {
+    /* arm_correlate_f32() does not write the zeros of the output */
+    arm_fill_f32(0.0f, pDst, (2U * ((srcALen > srcBLen) ? srcALen : srcBLen)) - 1U);
+    arm_correlate_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+  }
+}
+
+/**
+ * @} end of ConvFFT group
+ */
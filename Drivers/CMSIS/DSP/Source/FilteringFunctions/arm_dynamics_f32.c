@@ -0,0 +1,186 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dynamics_f32.c
+ * Description:  Floating-point compressor, limiter and noise gate
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Dynamics Dynamics Processors
+ *
+ * Compressor, limiter and noise gate driven by an envelope tracker, for audio levels
+ * and automatic gain controls.
+ *
+ * \par
+ * Each block goes through three stages:
+ * -# the level detector, an envelope tracker of the Envelope group, tracks the peak or
+ * the mean square of the input.  The largest envelope of the block gives the level
+ * of the block in dB.
+ * -# the static curve maps the level to a gain in dB, see arm_dynamics_gain_f32().
+ * The compressor reduces the level above its threshold by its ratio, with a soft knee.
+ * A ratio of 0 turns it into a limiter.  The gate attenuates the levels below its
+ * threshold by its range.
+ * -# the gain is smoothed in dB with a one-pole filter, with the attack coefficient when
+ * the gain falls and the release coefficient when it rises.  The makeup gain is added
+ * and the linear gain is ramped over the block, from the gain of the previous block,
+ * so that the output has no steps.
+ *
+ * \par
+ * The level detector runs at the sample rate while the gain runs at the block rate: use
+ * arm_envelope_coeff_f32() with <code>sampleRate / blockSize</code> for the coefficients
+ * of the gain, and the same block size for all the calls.  Since the level of a block
+ * is known before it is scaled, the ramp reaches the gain of a peak at its block; the
+ * limiter can still overshoot inside the block by the attack time of the gain.
+ *
+ * \par
+ * The input and the output buffers may be the same.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 processor computes the curve and the smoothing once per block in floating-point.
+ * The ramp is applied in 5.27 format: the total gain must be less than +24 dB and is
+ * saturated above it.  The output saturates to Q15.
+ */
+
+/**
+ * @addtogroup Dynamics
+ * @{
+ */
+
+/**
+ * @brief  Smoothed gain of a block in dB.
+ * @param[in,out]   *S points to an instance of the floating-point dynamics processor.
+ * @param[in]       level largest envelope of the block.
+ * @return the smoothed gain, in dB, with the makeup gain.
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_dynamics_block_gain_f32(
+  arm_dynamics_instance_f32 * S,
+  float32_t level)
+{
+  float32_t levelDb;                             /* Level of the block, in dB */
+  float32_t target;                              /* Gain of the static curve, in dB */
+
+  /* 20 log10(peak) or 10 log10(mean square), floored at -200 dB */
+  level = (level > 1.0e-20f) ? level : 1.0e-20f;
+  levelDb = ((S->env.detector == ARM_ENVELOPE_RMS) ? 4.3429448f : 8.6858896f) * logf(level);
+
+  target = arm_dynamics_gain_f32(&S->curve, levelDb);
+
+  S->gainDb += ((target < S->gainDb) ? S->gainAttack : S->gainRelease) * (target - S->gainDb);
+
+  return (S->gainDb + S->curve.makeupGain);
+}
+
+/**
+ * @brief  Processing function for the floating-point dynamics processor.
+ * @param[in,out]   *S points to an instance of the floating-point dynamics processor.
+ * @param[in]       *pSrc points to the block of input data.
+ * @param[out]      *pDst points to the block of output data.
+ * @param[in]       blockSize number of samples to process.
+ * @return none.
+ */
+
+void arm_dynamics_f32(
+  arm_dynamics_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t gain = S->gain;                      /* Gain of the current sample */
+  float32_t target;                              /* Gain at the end of the block */
+  float32_t step;                                /* Increment of the gain per sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  /* Level of the block, the output of the tracker is not needed */
+  target = arm_dynamics_block_gain_f32(S, arm_envelope_f32(&S->env, pSrc, NULL, blockSize));
+
+  /* 10^(g / 20) */
+  target = expf(target * 0.11512925f);
+  step = (target - gain) / (float32_t) blockSize;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* y[n] = x[n] * (g0 + (n + 1) * step) */
+    pDst[0] = pSrc[0] * (gain + step);
+    pDst[1] = pSrc[1] * (gain + (2.0f * step));
+    pDst[2] = pSrc[2] * (gain + (3.0f * step));
+    gain += 4.0f * step;
+    pDst[3] = pSrc[3] * gain;
+
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* y[n] = x[n] * (g0 + (n + 1) * step) */
+    gain += step;
+    *pDst++ = *pSrc++ * gain;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* The ramp ends exactly on the gain of the block */
+  S->gain = target;
+}
+
+/**
+ * @} end of Dynamics group
+ */
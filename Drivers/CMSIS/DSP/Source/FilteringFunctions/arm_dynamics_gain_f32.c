@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dynamics_gain_f32.c
+ * Description:  Gain of the static curve of the dynamics processors
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Dynamics
+ * @{
+ */
+
+/**
+ * @brief  Gain of the static curve of a dynamics processor.
+ * @param[in]       *C points to the static curve.
+ * @param[in]       levelDb input level, in dB.
+ * @return the gain, in dB, without the makeup gain.
+ *
+ * \par
+ * With <code>o = levelDb - threshold</code> and <code>W</code> the width of the knee,
+ * the gain of the compressor is:
+ * <pre>
+ *     o <= -W/2:           0
+ *     -W/2 < o < W/2:      -slope * (o + W/2)^2 / (2 W)
+ *     o >= W/2:            -slope * o
+ * </pre>
+ * The range of the gate is subtracted when <code>levelDb</code> is below the threshold of
+ * the gate.
+ */
+
+float32_t arm_dynamics_gain_f32(
+  const arm_dynamics_curve_f32 * C,
+  float32_t levelDb)
+{
+  float32_t over = levelDb - C->threshold;       /* Level above the threshold */
+  float32_t halfKnee = 0.5f * C->knee;           /* Half width of the knee */
+  float32_t gain;                                /* Gain, in dB */
+
+  if (over <= -halfKnee)
+  {
+    gain = 0.0f;
+  }
+  else if (over < halfKnee)
+  {
+    /* Quadratic interpolation across the knee */
+    over += halfKnee;
+    gain = (-C->slope * over * over) / (2.0f * C->knee);
+  }
+  else
+  {
+    gain = -C->slope * over;
+  }
+
+  if (levelDb < C->gateThreshold)
+  {
+    gain -= C->gateRange;
+  }
+
+  return (gain);
+}
+
+/**
+ * @} end of Dynamics group
+ */
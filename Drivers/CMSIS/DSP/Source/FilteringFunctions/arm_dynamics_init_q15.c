@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dynamics_init_q15.c
+ * Description:  Q15 dynamics processor initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Dynamics
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 dynamics processor.
+ * @param[out]      *S points to an instance of the Q15 dynamics processor.
+ * @param[in]       detector level detector.
+ * @param[in]       envAttack smoothing coefficient of the level detector when the level rises, in 1.15 format.
+ * @param[in]       envRelease smoothing coefficient of the level detector when the level falls, in 1.15 format.
+ * @param[in]       gainAttack smoothing coefficient of the gain when it falls, per block.
+ * @param[in]       gainRelease smoothing coefficient of the gain when it rises, per block.
+ * @return none.
+ *
+ * \par
+ * The static curve is set to unity gain: call arm_dynamics_set_curve_f32() on
+ * <code>S->curve</code> to configure the compressor, the limiter and the gate.
+ * The gain starts at 0 dB.
+ */
+
+void arm_dynamics_init_q15(
+  arm_dynamics_instance_q15 * S,
+  arm_envelope_detector detector,
+  q15_t envAttack,
+  q15_t envRelease,
+  float32_t gainAttack,
+  float32_t gainRelease)
+{
+  arm_envelope_init_q15(&S->env, detector, envAttack, envRelease, 0U);
+
+  /* Compressor with a ratio of 1 and gate with no range */
+  (void) arm_dynamics_set_curve_f32(&S->curve, 0.0f, 1.0f, 0.0f, -200.0f, 0.0f, 0.0f);
+
+  S->gainAttack = gainAttack;
+  S->gainRelease = gainRelease;
+  S->gainDb = 0.0f;
+  S->gain = 0x08000000;
+}
+
+/**
+ * @} end of Dynamics group
+ */
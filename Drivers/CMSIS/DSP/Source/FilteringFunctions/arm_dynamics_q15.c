@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dynamics_q15.c
+ * Description:  Q15 compressor, limiter and noise gate
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Dynamics
+ * @{
+ */
+
+/**
+ * @brief  Smoothed gain of a block in dB.
+ * @param[in,out]   *S points to an instance of the Q15 dynamics processor.
+ * @param[in]       level largest envelope of the block, in 1.31 format.
+ * @return the smoothed gain, in dB, with the makeup gain.
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_dynamics_block_gain_q15(
+  arm_dynamics_instance_q15 * S,
+  q31_t level)
+{
+  float32_t levelDb;                             /* Level of the block, in dB */
+  float32_t target;                              /* Gain of the static curve, in dB */
+
+  /* 20 log10(peak) or 10 log10(mean square), 0 dB at full scale */
+  levelDb = ((S->env.detector == ARM_ENVELOPE_RMS) ? 4.3429448f : 8.6858896f) *
+    logf(((float32_t) ((level > 0) ? level : 1)) / 2147483648.0f);
+
+  target = arm_dynamics_gain_f32(&S->curve, levelDb);
+
+  S->gainDb += ((target < S->gainDb) ? S->gainAttack : S->gainRelease) * (target - S->gainDb);
+
+  return (S->gainDb + S->curve.makeupGain);
+}
+
+/**
+ * @brief  Processing function for the Q15 dynamics processor.
+ * @param[in,out]   *S points to an instance of the Q15 dynamics processor.
+ * @param[in]       *pSrc points to the block of input data.
+ * @param[out]      *pDst points to the block of output data.
+ * @param[in]       blockSize number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The gain is in 5.27 format and saturates at +24 dB.  The products are in 6.42 format,
+ * shifted right by 27 bits and saturated to 1.15 format.
+ */
+
+void arm_dynamics_q15(
+  arm_dynamics_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t gain = S->gain;                          /* Gain of the current sample, 5.27 format */
+  q31_t target;                                  /* Gain at the end of the block */
+  q31_t step;                                    /* Increment of the gain per sample */
+  q31_t level;                                   /* Level of the block, 1.31 format */
+  float32_t gainF;                               /* Linear gain at the end of the block */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  /* Level of the block */
+  level = arm_envelope_q15(&S->env, pSrc, NULL, blockSize);
+
+  /* 10^(g / 20) in 5.27 format */
+  gainF = expf(arm_dynamics_block_gain_q15(S, level) * 0.11512925f);
+  target = (gainF < 15.999f) ? (q31_t) (gainF * 134217728.0f) : 0x7FFE0000;
+  step = (target - gain) / (q31_t) blockSize;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* y[n] = x[n] * (g0 + (n + 1) * step) */
+    gain += step;
+    pDst[0] = (q15_t) __SSAT((q31_t) (((q63_t) pSrc[0] * gain) >> 27), 16);
+    gain += step;
+    pDst[1] = (q15_t) __SSAT((q31_t) (((q63_t) pSrc[1] * gain) >> 27), 16);
+    gain += step;
+    pDst[2] = (q15_t) __SSAT((q31_t) (((q63_t) pSrc[2] * gain) >> 27), 16);
+    gain += step;
+    pDst[3] = (q15_t) __SSAT((q31_t) (((q63_t) pSrc[3] * gain) >> 27), 16);
+
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* y[n] = x[n] * (g0 + (n + 1) * step) */
+    gain += step;
+    *pDst++ = (q15_t) __SSAT((q31_t) (((q63_t) *pSrc++ * gain) >> 27), 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* The ramp ends exactly on the gain of the block */
+  S->gain = target;
+}
+
+/**
+ * @} end of Dynamics group
+ */
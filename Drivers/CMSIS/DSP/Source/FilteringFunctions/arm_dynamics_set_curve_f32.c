@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dynamics_set_curve_f32.c
+ * Description:  Static curve of the dynamics processors
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Dynamics
+ * @{
+ */
+
+/**
+ * @brief  Sets the static curve of a dynamics processor.
+ * @param[out]      *C points to the static curve.
+ * @param[in]       threshold threshold of the compressor, in dB.
+ * @param[in]       ratio ratio of the compressor, at least 1, or 0 for a limiter.
+ * @param[in]       knee width of the soft knee, in dB.
+ * @param[in]       gateThreshold level under which the gate closes, in dB.
+ * @param[in]       gateRange attenuation of the closed gate, in dB.
+ * @param[in]       makeupGain gain added to the output, in dB.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the ratio is between 0 and 1
+ * or if the knee or the range of the gate is negative.
+ *
+ * \par
+ * A ratio of 1 disables the compressor and a range of 0 disables the gate.  The curve of
+ * an instance can be changed between two blocks: the gain smoothing of the instance
+ * avoids the clicks.
+ */
+
+arm_status arm_dynamics_set_curve_f32(
+  arm_dynamics_curve_f32 * C,
+  float32_t threshold,
+  float32_t ratio,
+  float32_t knee,
+  float32_t gateThreshold,
+  float32_t gateRange,
+  float32_t makeupGain)
+{
+  if (((ratio != 0.0f) && (ratio < 1.0f)) || (knee < 0.0f) || (gateRange < 0.0f))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  C->threshold = threshold;
+  C->slope = (ratio == 0.0f) ? 1.0f : (1.0f - (1.0f / ratio));
+  C->knee = knee;
+  C->gateThreshold = gateThreshold;
+  C->gateRange = gateRange;
+  C->makeupGain = makeupGain;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Dynamics group
+ */
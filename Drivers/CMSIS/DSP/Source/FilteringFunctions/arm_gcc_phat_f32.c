@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_gcc_phat_f32.c
+ * Description:  Generalized cross-correlation with phase transform
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern uint32_t arm_conv_fft_kernel_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  uint8_t mode,
+  float32_t * pScratch);
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+/**
+ * @brief Generalized cross-correlation with phase transform of floating-point sequences.
+ * @param[in]       *pSrcA points to the first input sequence.
+ * @param[in]       *pSrcB points to the second input sequence.
+ * @param[in]       blockSize length of each input sequence, at most 2048.
+ * @param[out]      *pDst points to the block of output data.  Length 2 * blockSize - 1.
+ * @param[in,out]   *pScratch points to the scratch buffer, 2 * fftLen values.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>blockSize</code> is 0
+ * or more than 2048.
+ *
+ * \par
+ * <code>pDst[n]</code> is the weighted correlation at the lag <code>n - (blockSize - 1)</code>, in the
+ * layout of arm_correlate_f32().  The index of the maximum, from arm_max_f32(), minus
+ * <code>blockSize - 1</code> is the delay of <code>pSrcA</code> relative to <code>pSrcB</code>, in samples.
+ * The peak is at most 1.0.
+ */
+
+arm_status arm_gcc_phat_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  uint32_t blockSize,
+  float32_t * pDst,
+  float32_t * pScratch)
+{
+  float32_t *pOut;                               /* Circular correlation */
+  uint32_t fftLen;                               /* Length of the FFT */
+  uint32_t srcALen = blockSize;                  /* Lengths of the inputs */
+  uint32_t srcBLen = blockSize;
+  uint32_t maxLen = blockSize;
+
+  if (blockSize == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  fftLen = arm_conv_fft_kernel_f32(pSrcA, srcALen, pSrcB, srcBLen, 2U, pScratch);
+  if (fftLen == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Lag m = n - (maxLen - 1) of the output, from -(srcBLen - 1) to srcALen - 1, zero elsewhere */
+  pOut = pScratch + fftLen;
+  arm_fill_f32(0.0f, pDst, maxLen - srcBLen);
+  arm_copy_f32(pOut + (fftLen - (srcBLen - 1U)), pDst + (maxLen - srcBLen), srcBLen - 1U);
+  arm_copy_f32(pOut, pDst + (maxLen - 1U), srcALen);
+  arm_fill_f32(0.0f, pDst + (maxLen - 1U) + srcALen, maxLen - srcALen);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ConvFFT group
+ */
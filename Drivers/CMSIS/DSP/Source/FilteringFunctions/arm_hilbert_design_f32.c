@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_hilbert_design_f32.c
+ * Description:  Windowed design of a half-band Hilbert transformer
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Hilbert Hilbert Transformer
+ *
+ * Streaming FIR Hilbert transformer producing the analytic signal of a real input.
+ *
+ * \par
+ * The ideal Hilbert transformer has the impulse response <code>h[k] = 2 / (pi k)</code>
+ * for odd <code>k</code> and zero for even <code>k</code>.  Truncated to <code>numTaps</code>
+ * taps centred on <code>c = (numTaps - 1) / 2</code>, it is a type III FIR filter: every
+ * other tap is zero and the others are antisymmetric.  Each output therefore only needs
+ * <code>(numTaps + 1) / 4</code> multiplications instead of <code>numTaps</code>:
+ * <pre>
+ *     y[n] = sum(h[k] * (x[n-c-k] - x[n-c+k])),  k = 1, 3, ..., c
+ * </pre>
+ * <code>numTaps</code> must be of the form <code>4 * M - 1</code> so that the outer taps
+ * are nonzero.
+ *
+ * \par
+ * The output is complex, in the interleaved format of the complex math functions: the
+ * real part is the input delayed by <code>c</code> samples, to stay aligned with the
+ * Hilbert transform in the imaginary part.  The magnitude and the phase of the output
+ * are the instantaneous amplitude and phase of the input, see arm_cmplx_inst_f32().
+ *
+ * \par Coefficients
+ * Only the <code>M</code> nonzero taps <code>h[1], h[3], ..., h[2M-1]</code> are stored,
+ * in that order.  arm_hilbert_design_f32() computes them with a window on the ideal
+ * response.  The window sets the trade-off between the passband ripple and the width of
+ * the transition bands around DC and Nyquist: with a Kaiser window of <code>beta = 6</code>,
+ * 31 taps keep the ripple under 0.1% from 0.1 to 0.4 times the sampling frequency.
+ *
+ * \par State buffers
+ * The state buffers hold <code>numTaps + blockSize - 1</code> samples, as for the FIR
+ * filters, and let arm_hilbert_f32() and arm_hilbert_q15() process a stream in blocks.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 version subtracts the pairs of samples in 32 bits and accumulates in 64 bits.
+ * The imaginary part is truncated to 1.15 format and saturated, the real part is exact.
+ * The design function gives coefficients in floating-point, to be converted with
+ * arm_float_to_q15().
+ */
+
+/**
+ * @addtogroup Hilbert
+ * @{
+ */
+
+/**
+ * @brief  Computes the nonzero coefficients of a windowed Hilbert transformer.
+ * @param[in]       numTaps number of taps of the filter, 4 * M - 1 with M >= 1.
+ * @param[in]       window window function applied to the ideal response.
+ * @param[in]       beta shape parameter of the Kaiser window, ignored by the other windows.
+ * @param[out]      *pCoeffs points to the (numTaps + 1) / 4 coefficients.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numTaps</code> is not of the form <code>4 * M - 1</code>.
+ */
+
+arm_status arm_hilbert_design_f32(
+  uint16_t numTaps,
+  arm_window_type window,
+  float32_t beta,
+  float32_t * pCoeffs)
+{
+  uint32_t center;                               /* Index of the centre tap */
+  uint32_t k;                                    /* Offset of the tap from the centre */
+  float32_t step;                                /* Window position step between taps */
+
+  if ((numTaps & 3U) != 3U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  center = ((uint32_t) numTaps - 1U) >> 1U;
+  step = 1.0f / (float32_t) (numTaps - 1U);
+
+  for (k = 1U; k <= center; k += 2U)
+  {
+    /* h[k] = 2 / (pi k) w(c + k), the window being symmetric */
+    *pCoeffs++ = (2.0f / (PI * (float32_t) k)) *
+      arm_window_value_f32(window, beta, (float32_t) (center + k) * step);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Hilbert group
+ */
@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_hilbert_f32.c
+ * Description:  Floating-point Hilbert transformer
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Hilbert
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point Hilbert transformer.
+ * @param[in]       *S points to an instance of the floating-point Hilbert transformer structure.
+ * @param[in]       *pSrc points to the block of real input data.
+ * @param[out]      *pDst points to the block of complex output data, 2 * blockSize values.
+ * @param[in]       blockSize number of input samples to process.
+ * @return none.
+ *
+ * \par
+ * The real parts of the output are the input delayed by <code>(numTaps - 1) / 2</code>
+ * samples and the imaginary parts its Hilbert transform.
+ */
+
+void arm_hilbert_f32(
+  const arm_hilbert_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+  float32_t *px;                                 /* Temporary pointer for state buffer */
+  float32_t *pa, *pb;                            /* Samples before and after the centre */
+  const float32_t *pc;                           /* Temporary pointer for coefficient buffer */
+  float32_t acc;                                 /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t center = (numTaps - 1U) >> 1U;        /* Delay of the real part */
+  uint32_t numCoeffs = (numTaps + 1U) >> 2U;     /* Number of nonzero coefficients */
+  uint32_t i, blkCnt;                            /* Loop counters */
+
+  /* Copy the new input samples after the numTaps - 1 previous ones */
+  arm_copy_f32(pSrc, pState + (numTaps - 1U), blockSize);
+
+  px = pState;
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    pa = px + (center - 1U);
+    pb = px + (center + 1U);
+    pc = pCoeffs;
+    acc = 0.0f;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+    /* Loop unrolling */
+    i = numCoeffs >> 2U;
+
+    /* First part of the processing with loop unrolling.  Compute 4 taps at a time.
+     ** a second loop below computes the remaining 1 to 3 taps. */
+    while (i > 0U)
+    {
+      /* acc += h[k] * (x[c-k] - x[c+k]) */
+      acc += pc[0] * (pa[0] - pb[0]);
+      acc += pc[1] * (pa[-2] - pb[2]);
+      acc += pc[2] * (pa[-4] - pb[4]);
+      acc += pc[3] * (pa[-6] - pb[6]);
+
+      pa -= 8U;
+      pb += 8U;
+      pc += 4U;
+
+      i--;
+    }
+
+    /* If the number of coefficients is not a multiple of 4, compute the remaining taps here.
+     ** No loop unrolling is used. */
+    i = numCoeffs % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over the nonzero coefficients */
+    i = numCoeffs;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (i > 0U)
+    {
+      /* acc += h[k] * (x[c-k] - x[c+k]) */
+      acc += *pc++ * (*pa - *pb);
+
+      pa -= 2U;
+      pb += 2U;
+
+      i--;
+    }
+
+    /* Delayed input in the real part, Hilbert transform in the imaginary part */
+    *pDst++ = px[center];
+    *pDst++ = acc;
+
+    /* Advance state pointer by 1 for the next sample */
+    px++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  arm_copy_f32(pState + blockSize, pState, numTaps - 1U);
+}
+
+/**
+ * @} end of Hilbert group
+ */
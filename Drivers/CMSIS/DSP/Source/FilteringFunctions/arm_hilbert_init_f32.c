@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_hilbert_init_f32.c
+ * Description:  Floating-point Hilbert transformer initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Hilbert
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Hilbert transformer.
+ * @param[in,out]   *S points to an instance of the floating-point Hilbert transformer structure.
+ * @param[in]       numTaps number of taps of the filter, 4 * M - 1 with M >= 1.
+ * @param[in]       *pCoeffs points to the (numTaps + 1) / 4 nonzero coefficients.
+ * @param[in]       *pState points to the state buffer, numTaps + blockSize - 1 values.
+ * @param[in]       blockSize number of input samples processed per call.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numTaps</code> is not of the form <code>4 * M - 1</code>.
+ *
+ * \par
+ * The state buffer is cleared.
+ */
+
+arm_status arm_hilbert_init_f32(
+  arm_hilbert_instance_f32 * S,
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  if ((numTaps & 3U) != 3U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Assign filter taps */
+  S->numTaps = numTaps;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and the size of state buffer is (blockSize + numTaps - 1) */
+  memset(pState, 0, (numTaps + (blockSize - 1U)) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Hilbert group
+ */
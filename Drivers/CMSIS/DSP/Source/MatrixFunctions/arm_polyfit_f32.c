@@ -0,0 +1,222 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_polyfit_f32.c
+ * Description:  Weighted least-squares polynomial fit
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup PolyFit Polynomial Least-Squares Fit
+ *
+ * Fits a polynomial of a given order to a set of points in the weighted least-squares sense:
+ * <pre>
+ *     p(x) = pCoeffs[0] + pCoeffs[1] * x + ... + pCoeffs[order] * x^order
+ *
+ *     minimizes sum(pW[i] * (pY[i] - p(pX[i]))^2)
+ * </pre>
+ * The weights are usually the inverse of the variance of each point.  The fitted polynomial
+ * is evaluated with arm_poly_eval_f32() or, after scaling and conversion of the coefficients,
+ * with arm_poly_eval_q31().
+ *
+ * \par Algorithm
+ * The abscissae are first mapped to <code>t = (x - c) * s</code>, in [-1 +1], which keeps the
+ * Vandermonde matrix of the problem well conditioned.  Each point is then merged as a new row
+ * into the triangular factor <code>R</code> of the QR decomposition of the weighted Vandermonde
+ * matrix with Givens rotations, and the same rotations are applied to the right-hand side.
+ * This never forms the normal equations, whose condition number is the square of the one of
+ * the matrix, and only needs <code>(order + 1) * (order + 2)</code> values of workspace,
+ * whatever the number of points.  The coefficients in <code>t</code> come from a back
+ * substitution and are finally expanded to the powers of <code>x</code>.
+ *
+ * \par
+ * The cost per point is about <code>2 * (order + 1)^2</code> multiplications, plus
+ * <code>order + 1</code> square roots and divisions: in the order of 400000 cycles for
+ * 1000 points and an order of 5 on a Cortex-M4 with FPU, a few milliseconds.
+ *
+ * \par Accuracy
+ * The fit itself is as accurate as the data allows.  The final expansion to the powers of
+ * <code>x</code> can however lose precision when the points are far from 0 compared to their
+ * spread, as the evaluation of the polynomial in single precision does: subtract a typical
+ * value from the abscissae before the fit and before the evaluation in that case.
+ */
+
+/**
+ * @addtogroup PolyFit
+ * @{
+ */
+
+/**
+ * @brief  Weighted least-squares polynomial fit.
+ * @param[in]       *pX points to the abscissae of the points.
+ * @param[in]       *pY points to the ordinates of the points.
+ * @param[in]       *pW points to the weights of the points, or NULL for equal weights.
+ * @param[in]       numSamples number of points, at least order + 1.
+ * @param[in]       order order of the polynomial.
+ * @param[out]      *pCoeffs points to the order + 1 coefficients, constant term first.
+ * @param[in]       *pWork points to the workspace, ARM_POLYFIT_WORK_SIZE(order) values.
+ * @return The function returns ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR if there are fewer
+ * points than coefficients, or ARM_MATH_SINGULAR if the points do not define a unique polynomial,
+ * for example when fewer than <code>order + 1</code> of them have distinct abscissae and a nonzero weight.
+ */
+
+arm_status arm_polyfit_f32(
+  const float32_t * pX,
+  const float32_t * pY,
+  const float32_t * pW,
+  uint32_t numSamples,
+  uint16_t order,
+  float32_t * pCoeffs,
+  float32_t * pWork)
+{
+  uint32_t numCoeffs = (uint32_t) order + 1U;    /* Number of coefficients */
+  float32_t *pR = pWork;                         /* Triangular factor, numCoeffs x numCoeffs values */
+  float32_t *pZ = pWork + (numCoeffs * numCoeffs); /* Rotated right-hand side, numCoeffs values */
+  float32_t *pRow = pCoeffs;                     /* Row being merged, in the output buffer */
+  float32_t xMin, xMax;                          /* Range of the abscissae */
+  float32_t center, scale;                       /* Mapping of x to t */
+  float32_t t, b, w;                             /* Mapped abscissa, right-hand side and sqrt of the weight */
+  float32_t r, a, rho, c, s, tmp;                /* Givens rotation */
+  float32_t rMax;                                /* Largest diagonal element of R */
+  uint32_t i, j, k;                              /* Loop counters */
+
+  if (numSamples < numCoeffs)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Map the range of the abscissae to [-1 +1] */
+  xMin = pX[0];
+  xMax = pX[0];
+  for (i = 1U; i < numSamples; i++)
+  {
+    xMin = (pX[i] < xMin) ? pX[i] : xMin;
+    xMax = (pX[i] > xMax) ? pX[i] : xMax;
+  }
+  center = 0.5f * (xMax + xMin);
+  scale = (xMax > xMin) ? (2.0f / (xMax - xMin)) : 1.0f;
+
+  memset(pWork, 0, numCoeffs * (numCoeffs + 1U) * sizeof(float32_t));
+
+  for (i = 0U; i < numSamples; i++)
+  {
+    w = 1.0f;
+    if (pW != NULL)
+    {
+      if (pW[i] <= 0.0f)
+      {
+        continue;
+      }
+      arm_sqrt_f32(pW[i], &w);
+    }
+
+    /* Weighted row [1 t t^2 ... t^order] and right-hand side */
+    t = (pX[i] - center) * scale;
+    pRow[0] = w;
+    for (k = 1U; k < numCoeffs; k++)
+    {
+      pRow[k] = pRow[k - 1U] * t;
+    }
+    b = w * pY[i];
+
+    /* Merge the row into R with one Givens rotation per column */
+    for (j = 0U; j < numCoeffs; j++)
+    {
+      a = pRow[j];
+      if (a == 0.0f)
+      {
+        continue;
+      }
+
+      r = pR[(j * numCoeffs) + j];
+      arm_sqrt_f32((r * r) + (a * a), &rho);
+      tmp = 1.0f / rho;
+      c = r * tmp;
+      s = a * tmp;
+      pR[(j * numCoeffs) + j] = rho;
+
+      for (k = j + 1U; k < numCoeffs; k++)
+      {
+        tmp = pR[(j * numCoeffs) + k];
+        pR[(j * numCoeffs) + k] = (c * tmp) + (s * pRow[k]);
+        pRow[k] = (c * pRow[k]) - (s * tmp);
+      }
+
+      tmp = pZ[j];
+      pZ[j] = (c * tmp) + (s * b);
+      b = (c * b) - (s * tmp);
+    }
+  }
+
+  /* Rank check on the diagonal of R */
+  rMax = 0.0f;
+  for (j = 0U; j < numCoeffs; j++)
+  {
+    rMax = (pR[(j * numCoeffs) + j] > rMax) ? pR[(j * numCoeffs) + j] : rMax;
+  }
+  for (j = 0U; j < numCoeffs; j++)
+  {
+    if (pR[(j * numCoeffs) + j] <= (1.0e-6f * rMax))
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+  }
+
+  /* Back substitution: R d = z, d in place of z */
+  for (j = numCoeffs; j > 0U; j--)
+  {
+    tmp = pZ[j - 1U];
+    for (k = j; k < numCoeffs; k++)
+    {
+      tmp -= pR[((j - 1U) * numCoeffs) + k] * pZ[k];
+    }
+    pZ[j - 1U] = tmp / pR[((j - 1U) * numCoeffs) + (j - 1U)];
+  }
+
+  /* Expand d0 + t (d1 + t (d2 + ...)) with t = scale * x - scale * center */
+  a = scale;
+  b = -scale * center;
+  pCoeffs[0] = pZ[order];
+  for (j = order; j > 0U; j--)
+  {
+    /* q(x) = q(x) * (a x + b) + d[j - 1] */
+    pCoeffs[numCoeffs - j] = a * pCoeffs[order - j];
+    for (k = order - j; k > 0U; k--)
+    {
+      pCoeffs[k] = (b * pCoeffs[k]) + (a * pCoeffs[k - 1U]);
+    }
+    pCoeffs[0] = (b * pCoeffs[0]) + pZ[j - 1U];
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of PolyFit group
+ */
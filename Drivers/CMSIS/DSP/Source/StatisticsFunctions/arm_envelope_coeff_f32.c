@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_envelope_coeff_f32.c
+ * Description:  Smoothing coefficient of the envelope trackers
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Envelope Envelope Trackers
+ *
+ * Tracks the level of a signal sample by sample, for meters, automatic gain controls
+ * and dynamics processors.
+ *
+ * \par
+ * Each input sample <code>x[n]</code> is first turned into a level <code>d[n]</code> by the
+ * detector of the instance:
+ * - <code>ARM_ENVELOPE_PEAK</code>: <code>d[n] = |x[n]|</code>.
+ * - <code>ARM_ENVELOPE_RMS</code>: <code>d[n] = x[n]^2</code>.  The envelope is then a mean
+ * square: use arm_sqrt_f32(), arm_sqrt_q31() or arm_sqrt_q15() on it for the RMS value.
+ *
+ * \par
+ * The envelope follows the level with a one-pole smoother whose coefficient depends on the
+ * direction of the change:
+ * <pre>
+ *     if d[n] > e[n-1]:        e[n] = e[n-1] + attack * (d[n] - e[n-1]),   hold = holdSamples
+ *     else if hold > 0:        e[n] = e[n-1],                              hold = hold - 1
+ *     else:                    e[n] = e[n-1] + release * (d[n] - e[n-1])
+ * </pre>
+ * The same structure covers the usual trackers:
+ * - exponential RMS: <code>ARM_ENVELOPE_RMS</code> with <code>attack = release</code> and no hold.
+ * - peak hold with decay: <code>ARM_ENVELOPE_PEAK</code> with <code>attack = 1</code>, a hold
+ * time and a slow release.
+ * - attack/release envelope follower: <code>ARM_ENVELOPE_PEAK</code> with a fast attack and a
+ * slow release.
+ *
+ * \par
+ * The coefficient of a time constant <code>tau</code> is <code>1 - exp(-1 / (tau * fs))</code>,
+ * computed by arm_envelope_coeff_f32().  The fixed-point versions take the coefficients in
+ * 1.31 or 1.15 format; convert them with arm_float_to_q31() or arm_float_to_q15().  A Q15
+ * coefficient of 1 LSB gives the longest time constant, about 32768 samples.
+ *
+ * \par
+ * The processing functions write the envelope after each sample when <code>pDst</code> is not
+ * NULL, and return the largest envelope of the block.  The state is kept in the instance, so
+ * a signal can be processed in blocks of any size with the same result.
+ *
+ * \par Fixed-Point Behavior
+ * The Q31 tracker computes <code>|x|</code> and <code>x^2</code> with saturation, so that
+ * <code>-1</code> gives <code>0x7FFFFFFF</code>.  The Q15 tracker keeps its state in 1.31
+ * format: the small steps of the long time constants are not lost to the Q15 rounding, and
+ * it returns the largest envelope in 1.31 format, which keeps the low levels of the RMS
+ * detector.
+ */
+
+/**
+ * @addtogroup Envelope
+ * @{
+ */
+
+/**
+ * @brief  Smoothing coefficient of an envelope tracker for a time constant.
+ * @param[in]       time time constant, in seconds
+ * @param[in]       sampleRate rate at which the coefficient is applied, in Hz
+ * @return the coefficient <code>1 - exp(-1 / (time * sampleRate))</code>, 1 for a zero time constant.
+ *
+ * \par
+ * The envelope then reaches 63% of a step of the level after <code>time</code> seconds.
+ * The coefficients of the dynamics processors are applied once per block: use the
+ * block rate <code>sampleRate / blockSize</code> for them.
+ */
+
+float32_t arm_envelope_coeff_f32(
+  float32_t time,
+  float32_t sampleRate)
+{
+  float32_t samples = time * sampleRate;         /* Time constant, in samples */
+
+  if (samples <= 0.0f)
+  {
+    return (1.0f);
+  }
+
+  return (1.0f - expf(-1.0f / samples));
+}
+
+/**
+ * @} end of Envelope group
+ */
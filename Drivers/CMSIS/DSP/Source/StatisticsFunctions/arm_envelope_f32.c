@@ -0,0 +1,186 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_envelope_f32.c
+ * Description:  Floating-point attack/release envelope tracker
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Envelope
+ * @{
+ */
+
+/**
+ * @brief  Floating-point envelope of one sample.
+ * @param[in]       in input sample
+ * @param[in]       rms nonzero for the RMS detector
+ * @param[in]       env envelope after the previous sample
+ * @param[in]       attack smoothing coefficient when the level rises
+ * @param[in]       release smoothing coefficient when the level falls
+ * @param[in]       holdSamples number of samples the envelope is held after a rise
+ * @param[in,out]   *pHold points to the number of samples left to hold
+ * @return the envelope after the sample.
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_envelope_sample_f32(
+  float32_t in,
+  uint32_t rms,
+  float32_t env,
+  float32_t attack,
+  float32_t release,
+  uint32_t holdSamples,
+  uint32_t * pHold)
+{
+  float32_t d;                                   /* Level of the input */
+
+  d = (rms != 0U) ? (in * in) : fabsf(in);
+
+  if (d > env)
+  {
+    *pHold = holdSamples;
+    return (env + (attack * (d - env)));
+  }
+
+  if (*pHold > 0U)
+  {
+    (*pHold)--;
+    return (env);
+  }
+
+  return (env + (release * (d - env)));
+}
+
+/**
+ * @brief  Tracks the envelope of a block of floating-point data.
+ * @param[in,out]   *S points to an instance of the floating-point envelope tracker.
+ * @param[in]       *pSrc points to the block of input data.
+ * @param[out]      *pDst points to the envelope after each input sample, may be NULL.
+ * @param[in]       blockSize number of samples to process.
+ * @return the largest envelope of the block, 0 for an empty block.
+ *
+ * \par
+ * See the description of the group for the update of the envelope.
+ */
+
+float32_t arm_envelope_f32(
+  arm_envelope_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t env = S->state;                      /* Current envelope */
+  float32_t maxEnv = 0.0f;                       /* Largest envelope of the block */
+  float32_t attack = S->attack;                  /* Coefficient when the level rises */
+  float32_t release = S->release;                /* Coefficient when the level falls */
+  uint32_t holdSamples = S->holdSamples;         /* Hold time */
+  uint32_t hold = S->holdCount;                  /* Samples left to hold */
+  uint32_t rms = (S->detector == ARM_ENVELOPE_RMS) ? 1U : 0U;  /* Detector */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  float32_t e1, e2, e3, e4;                      /* Envelopes of four samples */
+#endif
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* e[n] = e[n-1] + c * (d[n] - e[n-1]) */
+    e1 = arm_envelope_sample_f32(pSrc[0], rms, env, attack, release, holdSamples, &hold);
+    e2 = arm_envelope_sample_f32(pSrc[1], rms, e1, attack, release, holdSamples, &hold);
+    e3 = arm_envelope_sample_f32(pSrc[2], rms, e2, attack, release, holdSamples, &hold);
+    e4 = arm_envelope_sample_f32(pSrc[3], rms, e3, attack, release, holdSamples, &hold);
+    env = e4;
+
+    if (pDst != NULL)
+    {
+      pDst[0] = e1;
+      pDst[1] = e2;
+      pDst[2] = e3;
+      pDst[3] = e4;
+      pDst += 4U;
+    }
+
+    /* Largest envelope */
+    e1 = (e2 > e1) ? e2 : e1;
+    e3 = (e4 > e3) ? e4 : e3;
+    e1 = (e3 > e1) ? e3 : e1;
+    maxEnv = (e1 > maxEnv) ? e1 : maxEnv;
+
+    pSrc += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* e[n] = e[n-1] + c * (d[n] - e[n-1]) */
+    env = arm_envelope_sample_f32(*pSrc++, rms, env, attack, release, holdSamples, &hold);
+
+    if (pDst != NULL)
+    {
+      *pDst++ = env;
+    }
+
+    maxEnv = (env > maxEnv) ? env : maxEnv;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the state for the next block */
+  S->state = env;
+  S->holdCount = hold;
+
+  return (maxEnv);
+}
+
+/**
+ * @} end of Envelope group
+ */
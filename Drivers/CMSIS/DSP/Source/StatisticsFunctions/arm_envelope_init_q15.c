@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_envelope_init_q15.c
+ * Description:  Q15 envelope tracker initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Envelope
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 envelope tracker.
+ * @param[out]      *S points to an instance of the Q15 envelope tracker.
+ * @param[in]       detector level detector.
+ * @param[in]       attack smoothing coefficient when the level rises, in 1.15 format.
+ * @param[in]       release smoothing coefficient when the level falls, in 1.15 format.
+ * @param[in]       holdSamples number of samples the envelope is held after a rise.
+ * @return none.
+ *
+ * \par
+ * The envelope starts at zero.
+ */
+
+void arm_envelope_init_q15(
+  arm_envelope_instance_q15 * S,
+  arm_envelope_detector detector,
+  q15_t attack,
+  q15_t release,
+  uint32_t holdSamples)
+{
+  S->detector = detector;
+  S->attack = attack;
+  S->release = release;
+  S->holdSamples = holdSamples;
+  S->holdCount = 0U;
+  S->state = 0;
+}
+
+/**
+ * @} end of Envelope group
+ */
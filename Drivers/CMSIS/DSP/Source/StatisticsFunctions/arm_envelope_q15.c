@@ -0,0 +1,194 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_envelope_q15.c
+ * Description:  Q15 attack/release envelope tracker
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Envelope
+ * @{
+ */
+
+/**
+ * @brief  Q15 envelope of one sample.
+ * @param[in]       in input sample
+ * @param[in]       rms nonzero for the RMS detector
+ * @param[in]       env envelope after the previous sample
+ * @param[in]       attack smoothing coefficient when the level rises
+ * @param[in]       release smoothing coefficient when the level falls
+ * @param[in]       holdSamples number of samples the envelope is held after a rise
+ * @param[in,out]   *pHold points to the number of samples left to hold
+ * @return the envelope after the sample.
+ */
+CMSIS_INLINE __STATIC_INLINE q31_t arm_envelope_sample_q15(
+  q15_t in,
+  uint32_t rms,
+  q31_t env,
+  q15_t attack,
+  q15_t release,
+  uint32_t holdSamples,
+  uint32_t * pHold)
+{
+  q31_t d;                                       /* Level of the input */
+  q31_t p;                                       /* Square of the input */
+
+  p = (q31_t) in * in;
+  d = (rms != 0U) ? __QADD(p, p) : ((q31_t) __SSAT((in > 0) ? (q31_t) in : -(q31_t) in, 16) << 16);
+
+  if (d > env)
+  {
+    *pHold = holdSamples;
+    return (env + (q31_t) (((q63_t) (d - env) * attack) >> 15));
+  }
+
+  if (*pHold > 0U)
+  {
+    (*pHold)--;
+    return (env);
+  }
+
+  return (env + (q31_t) (((q63_t) (d - env) * release) >> 15));
+}
+
+/**
+ * @brief  Tracks the envelope of a block of Q15 data.
+ * @param[in,out]   *S points to an instance of the Q15 envelope tracker.
+ * @param[in]       *pSrc points to the block of input data.
+ * @param[out]      *pDst points to the envelope after each input sample, may be NULL.
+ * @param[in]       blockSize number of samples to process.
+ * @return the largest envelope of the block, in 1.31 format, 0 for an empty block.
+ *
+ * \par
+ * See the description of the group for the update of the envelope.
+ *
+ * \par
+ * The level and the state are in 1.31 format, and the envelope written to <code>pDst</code>
+ * is their upper 16 bits.  The returned value keeps the 1.31 format: the mean square of the
+ * RMS detector is below 1 LSB of 1.15 format for the signals with an RMS under about 0.0055,
+ * or -45 dBFS.  The square of the RMS detector saturates for an input of -1.
+ */
+
+q31_t arm_envelope_q15(
+  arm_envelope_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t env = S->state;                          /* Current envelope */
+  q31_t maxEnv = 0;                              /* Largest envelope of the block */
+  q15_t attack = S->attack;                      /* Coefficient when the level rises */
+  q15_t release = S->release;                    /* Coefficient when the level falls */
+  uint32_t holdSamples = S->holdSamples;         /* Hold time */
+  uint32_t hold = S->holdCount;                  /* Samples left to hold */
+  uint32_t rms = (S->detector == ARM_ENVELOPE_RMS) ? 1U : 0U;  /* Detector */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  q31_t e1, e2, e3, e4;                          /* Envelopes of four samples */
+#endif
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* e[n] = e[n-1] + c * (d[n] - e[n-1]) */
+    e1 = arm_envelope_sample_q15(pSrc[0], rms, env, attack, release, holdSamples, &hold);
+    e2 = arm_envelope_sample_q15(pSrc[1], rms, e1, attack, release, holdSamples, &hold);
+    e3 = arm_envelope_sample_q15(pSrc[2], rms, e2, attack, release, holdSamples, &hold);
+    e4 = arm_envelope_sample_q15(pSrc[3], rms, e3, attack, release, holdSamples, &hold);
+    env = e4;
+
+    if (pDst != NULL)
+    {
+      pDst[0] = (q15_t) (e1 >> 16);
+      pDst[1] = (q15_t) (e2 >> 16);
+      pDst[2] = (q15_t) (e3 >> 16);
+      pDst[3] = (q15_t) (e4 >> 16);
+      pDst += 4U;
+    }
+
+    /* Largest envelope */
+    e1 = (e2 > e1) ? e2 : e1;
+    e3 = (e4 > e3) ? e4 : e3;
+    e1 = (e3 > e1) ? e3 : e1;
+    maxEnv = (e1 > maxEnv) ? e1 : maxEnv;
+
+    pSrc += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* e[n] = e[n-1] + c * (d[n] - e[n-1]) */
+    env = arm_envelope_sample_q15(*pSrc++, rms, env, attack, release, holdSamples, &hold);
+
+    if (pDst != NULL)
+    {
+      *pDst++ = (q15_t) (env >> 16);
+    }
+
+    maxEnv = (env > maxEnv) ? env : maxEnv;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the state for the next block */
+  S->state = env;
+  S->holdCount = hold;
+
+  return (maxEnv);
+}
+
+/**
+ * @} end of Envelope group
+ */
@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_histogram_f32.c
+ * Description:  Histogram of a floating-point vector with uniform bins
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Histogram Histogram
+ *
+ * Counts the number of input samples falling in each of <code>numBins</code>
+ * bins of equal width spanning <code>[minVal, maxVal)</code>.
+ * The bin index of a sample is
+ * <pre>
+ *     index = floor((x - minVal) * numBins / (maxVal - minVal))
+ * </pre>
+ * Samples below <code>minVal</code> are counted in the first bin and samples
+ * greater than or equal to <code>maxVal</code> in the last bin, so every input
+ * sample is counted exactly once.
+ *
+ * The counts are added to the existing content of <code>pHist</code>.
+ * This allows a long record to be processed block by block; the histogram
+ * must be cleared before the first call.
+ *
+ * The bin index is computed with a multiplication by the precomputed scale
+ * <code>numBins / (maxVal - minVal)</code> instead of a division or a search
+ * through the bin edges, so the cost per sample does not depend on the number of bins.
+ *
+ * There are separate functions for floating-point and Q15 data types.
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief Histogram of a floating-point vector with uniform bins.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       minVal lower edge of the first bin
+ * @param[in]       maxVal upper edge of the last bin, must be greater than minVal
+ * @param[in]       numBins number of bins, must be greater than zero
+ * @param[in,out]   *pHist points to the numBins bin counts, which are incremented
+ * @return none.
+ *
+ * \par
+ * The position of a sample is computed in single precision, so a sample lying
+ * exactly on the edge between two bins may be counted in either of them.
+ */
+
+void arm_histogram_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t minVal,
+  float32_t maxVal,
+  uint32_t numBins,
+  uint32_t * pHist)
+{
+  float32_t scale;                               /* Number of bins per unit of input */
+  float32_t binMax;                              /* Scaled position of the last bin */
+  float32_t pos;                                 /* Scaled position of the sample */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  float32_t pos1, pos2, pos3, pos4;              /* Temporary scaled positions */
+#endif
+
+  scale = (float32_t) numBins / (maxVal - minVal);
+  binMax = (float32_t) (numBins - 1U);
+
+#if defined (ARM_MATH_DSP)
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = (x - minVal) * numBins / (maxVal - minVal) */
+    pos1 = (pSrc[0] - minVal) * scale;
+    pos2 = (pSrc[1] - minVal) * scale;
+    pos3 = (pSrc[2] - minVal) * scale;
+    pos4 = (pSrc[3] - minVal) * scale;
+
+    /* Clamp the positions to the first and last bins */
+    pos1 = (pos1 > 0.0f) ? pos1 : 0.0f;
+    pos2 = (pos2 > 0.0f) ? pos2 : 0.0f;
+    pos3 = (pos3 > 0.0f) ? pos3 : 0.0f;
+    pos4 = (pos4 > 0.0f) ? pos4 : 0.0f;
+    pos1 = (pos1 < binMax) ? pos1 : binMax;
+    pos2 = (pos2 < binMax) ? pos2 : binMax;
+    pos3 = (pos3 < binMax) ? pos3 : binMax;
+    pos4 = (pos4 < binMax) ? pos4 : binMax;
+
+    /* Increment the bin counts */
+    pHist[(uint32_t) pos1]++;
+    pHist[(uint32_t) pos2]++;
+    pHist[(uint32_t) pos3]++;
+    pHist[(uint32_t) pos4]++;
+
+    pSrc += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = (x - minVal) * numBins / (maxVal - minVal) */
+    pos = (*pSrc++ - minVal) * scale;
+
+    /* Clamp the position to the first and last bins */
+    pos = (pos > 0.0f) ? pos : 0.0f;
+    pos = (pos < binMax) ? pos : binMax;
+
+    /* Increment the bin count */
+    pHist[(uint32_t) pos]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Histogram group
+ */
@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_histogram_q15.c
+ * Description:  Histogram of a Q15 vector with uniform bins
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief Histogram of a Q15 vector with uniform bins.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       minVal lower edge of the first bin
+ * @param[in]       maxVal upper edge of the last bin, must be greater than minVal
+ * @param[in]       numBins number of bins, between 1 and (maxVal - minVal)
+ * @param[in,out]   *pHist points to the numBins bin counts, which are incremented
+ * @return none.
+ *
+ * <b>Bin Edges:</b>
+ * \par
+ * The bin index is computed exactly in integer arithmetic as
+ * <pre>
+ *     index = ((x - minVal) * numBins) / (maxVal - minVal)
+ * </pre>
+ * so every sample falls in the bin given by the exact edges
+ * <code>minVal + k * (maxVal - minVal) / numBins</code>.  The product is below 2^32
+ * as both factors are below 2^16.
+ */
+
+void arm_histogram_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t minVal,
+  q15_t maxVal,
+  uint16_t numBins,
+  uint32_t * pHist)
+{
+  uint32_t range;                                /* Width of the histogram */
+  uint32_t binMax;                               /* Index of the last bin */
+  int32_t offset;                                /* Distance of the sample to minVal */
+  uint32_t index;                                /* Bin index */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  q31_t in;                                      /* Temporary variable to hold two packed inputs */
+  int32_t offset1, offset2, offset3, offset4;    /* Temporary offsets */
+  uint32_t index1, index2, index3, index4;       /* Temporary bin indices */
+#endif
+
+  range = (uint32_t) ((int32_t) maxVal - minVal);
+  binMax = (uint32_t) numBins - 1U;
+
+#if defined (ARM_MATH_DSP)
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* Read two inputs at a time and unpack them */
+    in = *__SIMD32(pSrc)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+    offset1 = (int32_t) ((q15_t) in) - minVal;
+    offset2 = (int32_t) (in >> 16) - minVal;
+#else
+    offset1 = (int32_t) (in >> 16) - minVal;
+    offset2 = (int32_t) ((q15_t) in) - minVal;
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    in = *__SIMD32(pSrc)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+    offset3 = (int32_t) ((q15_t) in) - minVal;
+    offset4 = (int32_t) (in >> 16) - minVal;
+#else
+    offset3 = (int32_t) (in >> 16) - minVal;
+    offset4 = (int32_t) ((q15_t) in) - minVal;
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Samples below minVal go to the first bin */
+    offset1 = (offset1 > 0) ? offset1 : 0;
+    offset2 = (offset2 > 0) ? offset2 : 0;
+    offset3 = (offset3 > 0) ? offset3 : 0;
+    offset4 = (offset4 > 0) ? offset4 : 0;
+
+    /* C = ((x - minVal) * numBins) / (maxVal - minVal) */
+    index1 = ((uint32_t) offset1 * numBins) / range;
+    index2 = ((uint32_t) offset2 * numBins) / range;
+    index3 = ((uint32_t) offset3 * numBins) / range;
+    index4 = ((uint32_t) offset4 * numBins) / range;
+
+    /* Samples above maxVal go to the last bin */
+    index1 = (index1 < binMax) ? index1 : binMax;
+    index2 = (index2 < binMax) ? index2 : binMax;
+    index3 = (index3 < binMax) ? index3 : binMax;
+    index4 = (index4 < binMax) ? index4 : binMax;
+
+    /* Increment the bin counts */
+    pHist[index1]++;
+    pHist[index2]++;
+    pHist[index3]++;
+    pHist[index4]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* Samples below minVal go to the first bin */
+    offset = (int32_t) *pSrc++ - minVal;
+    offset = (offset > 0) ? offset : 0;
+
+    /* C = ((x - minVal) * numBins) / (maxVal - minVal) */
+    index = ((uint32_t) offset * numBins) / range;
+
+    /* Samples above maxVal go to the last bin */
+    index = (index < binMax) ? index : binMax;
+
+    /* Increment the bin count */
+    pHist[index]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Histogram group
+ */
@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_percentile_f32.c
+ * Description:  Percentile of a floating-point vector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Select
+ * @{
+ */
+
+/**
+ * @brief Percentile of a floating-point vector.
+ * @param[in,out]   *pSrc points to the input vector, which is reordered
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       percentile rank of the result as a fraction between 0.0 and 1.0
+ * @param[out]      *pResult percentile value is returned here
+ * @return none.
+ */
+
+void arm_percentile_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t percentile,
+  float32_t * pResult)
+{
+  float32_t rank;                                /* Fractional rank of the result */
+  float32_t frac;                                /* Fractional part of the rank */
+  float32_t low, high;                           /* Order statistics surrounding the rank */
+  float32_t in;                                  /* Temporary variable */
+  uint32_t k;                                    /* Integer part of the rank */
+  uint32_t i;                                    /* loop counter */
+
+  rank = percentile * (float32_t) (blockSize - 1U);
+  rank = (rank > 0.0f) ? rank : 0.0f;
+  k = (uint32_t) rank;
+
+  if (k >= (blockSize - 1U))
+  {
+    /* The result is the largest element */
+    arm_select_f32(pSrc, blockSize, blockSize - 1U, pResult);
+    return;
+  }
+
+  frac = rank - (float32_t) k;
+
+  /* Move the k-th smallest element to pSrc[k], the greater ones after it */
+  arm_select_f32(pSrc, blockSize, k, &low);
+
+  /* The next order statistic is the smallest of the elements after pSrc[k] */
+  high = pSrc[k + 1U];
+  for (i = k + 2U; i < blockSize; i++)
+  {
+    in = pSrc[i];
+    high = (in < high) ? in : high;
+  }
+
+  /* C = low + frac * (high - low) */
+  *pResult = low + frac * (high - low);
+}
+
+/**
+ * @} end of Select group
+ */
@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_percentile_q15.c
+ * Description:  Percentile of a Q15 vector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Select
+ * @{
+ */
+
+/**
+ * @brief Percentile of a Q15 vector.
+ * @param[in,out]   *pSrc points to the input vector, which is reordered
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       percentile rank of the result as a fraction between 0 and 1 in 1.15 format
+ * @param[out]      *pResult percentile value is returned here
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The rank <code>percentile * (blockSize - 1)</code> is computed exactly in 64 bits
+ * and its 15 fractional bits weight the interpolation.  The result lies between
+ * two input values and cannot overflow.  Negative percentiles are treated as zero.
+ * As 1.0 cannot be represented in 1.15 format, use <code>arm_max_q15()</code>
+ * to obtain the largest element.
+ */
+
+void arm_percentile_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t percentile,
+  q15_t * pResult)
+{
+  uint64_t rank;                                 /* Rank of the result in 49.15 format */
+  uint32_t frac;                                 /* Fractional part of the rank */
+  q15_t low, high;                               /* Order statistics surrounding the rank */
+  q15_t in;                                      /* Temporary variable */
+  uint32_t k;                                    /* Integer part of the rank */
+  uint32_t i;                                    /* loop counter */
+
+  percentile = (percentile > 0) ? percentile : 0;
+  rank = (uint64_t) percentile * (blockSize - 1U);
+  k = (uint32_t) (rank >> 15U);
+  frac = (uint32_t) rank & 0x7FFFU;
+
+  /* Move the k-th smallest element to pSrc[k], the greater ones after it */
+  arm_select_q15(pSrc, blockSize, k, &low);
+
+  if (frac == 0U)
+  {
+    *pResult = low;
+    return;
+  }
+
+  /* The next order statistic is the smallest of the elements after pSrc[k] */
+  high = pSrc[k + 1U];
+  for (i = k + 2U; i < blockSize; i++)
+  {
+    in = pSrc[i];
+    high = (in < high) ? in : high;
+  }
+
+  /* C = low + frac * (high - low).  The difference is non-negative and below 2^16 */
+  *pResult = (q15_t) ((q31_t) low + (q31_t) ((((uint32_t) ((q31_t) high - low)) * frac) >> 15U));
+}
+
+/**
+ * @} end of Select group
+ */
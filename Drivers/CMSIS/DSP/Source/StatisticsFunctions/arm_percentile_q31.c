@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_percentile_q31.c
+ * Description:  Percentile of a Q31 vector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Select
+ * @{
+ */
+
+/**
+ * @brief Percentile of a Q31 vector.
+ * @param[in,out]   *pSrc points to the input vector, which is reordered
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       percentile rank of the result as a fraction between 0 and 1 in 1.31 format
+ * @param[out]      *pResult percentile value is returned here
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The rank <code>percentile * (blockSize - 1)</code> is computed exactly in 64 bits
+ * and its 31 fractional bits weight the interpolation.  The result lies between
+ * two input values and cannot overflow.  Negative percentiles are treated as zero.
+ * As 1.0 cannot be represented in 1.31 format, use <code>arm_max_q31()</code>
+ * to obtain the largest element.
+ */
+
+void arm_percentile_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t percentile,
+  q31_t * pResult)
+{
+  uint64_t rank;                                 /* Rank of the result in 33.31 format */
+  uint64_t diff;                                 /* Difference of the surrounding order statistics */
+  uint32_t frac;                                 /* Fractional part of the rank */
+  q31_t low, high;                               /* Order statistics surrounding the rank */
+  q31_t in;                                      /* Temporary variable */
+  uint32_t k;                                    /* Integer part of the rank */
+  uint32_t i;                                    /* loop counter */
+
+  percentile = (percentile > 0) ? percentile : 0;
+  rank = (uint64_t) percentile * (blockSize - 1U);
+  k = (uint32_t) (rank >> 31U);
+  frac = (uint32_t) rank & 0x7FFFFFFFU;
+
+  /* Move the k-th smallest element to pSrc[k], the greater ones after it */
+  arm_select_q31(pSrc, blockSize, k, &low);
+
+  if (frac == 0U)
+  {
+    *pResult = low;
+    return;
+  }
+
+  /* The next order statistic is the smallest of the elements after pSrc[k] */
+  high = pSrc[k + 1U];
+  for (i = k + 2U; i < blockSize; i++)
+  {
+    in = pSrc[i];
+    high = (in < high) ? in : high;
+  }
+
+  /* C = low + frac * (high - low).  The difference is non-negative and below 2^32 */
+  diff = (uint64_t) ((q63_t) high - low);
+  *pResult = (q31_t) ((q63_t) low + (q63_t) ((diff * frac) >> 31U));
+}
+
+/**
+ * @} end of Select group
+ */
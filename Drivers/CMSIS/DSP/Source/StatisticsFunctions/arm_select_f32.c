@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_select_f32.c
+ * Description:  Selection of the k-th smallest element of a floating-point vector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Select Selection and Percentile
+ *
+ * Finds the element that would be at position <code>k</code> if the input
+ * vector were sorted in ascending order, without sorting the vector.
+ * The median, the quartiles or any other order statistic of a block can be
+ * obtained this way in a time proportional to <code>blockSize</code> on average,
+ * instead of the <code>blockSize * log2(blockSize)</code> of a full sort.
+ *
+ * The input vector is partially reordered in place by a quickselect with a
+ * median-of-three pivot: on return, <code>pSrc[k]</code> holds the result,
+ * the elements before it are lower than or equal to it and the elements after
+ * it are greater than or equal to it.  Copy the input first if its order must
+ * be kept.  No memory other than the input vector is used.
+ *
+ * The percentile functions linearly interpolate between the two order
+ * statistics surrounding the requested rank
+ * <pre>
+ *     rank = percentile * (blockSize - 1)
+ *     Result = x[floor(rank)] + (rank - floor(rank)) * (x[floor(rank) + 1] - x[floor(rank)])
+ * </pre>
+ * where <code>x</code> is the sorted input and <code>percentile</code> is a
+ * fraction between 0 and 1, so 0.5 gives the median.
+ *
+ * There are separate functions for floating-point, Q31, and Q15 data types.
+ */
+
+/**
+ * @addtogroup Select
+ * @{
+ */
+
+/**
+ * @brief Selection of the k-th smallest element of a floating-point vector.
+ * @param[in,out]   *pSrc points to the input vector, which is reordered
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       k rank of the element to select, between 0 and (blockSize - 1)
+ * @param[out]      *pResult k-th smallest element is returned here
+ * @return none.
+ */
+
+void arm_select_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pResult)
+{
+  float32_t pivot, temp;                         /* Pivot value and temporary variable for swaps */
+  int32_t left, right;                           /* Bounds of the partition containing k */
+  int32_t i, j, mid;                             /* Partitioning indices */
+
+  left = 0;
+  right = (int32_t) blockSize - 1;
+
+  while (right > left)
+  {
+    /* Sort the first, middle and last elements and use the median as the pivot.
+     * The first and last elements then act as sentinels for the scans below. */
+    mid = left + ((right - left) >> 1);
+
+    if (pSrc[mid] < pSrc[left])
+    {
+      temp = pSrc[mid];
+      pSrc[mid] = pSrc[left];
+      pSrc[left] = temp;
+    }
+    if (pSrc[right] < pSrc[left])
+    {
+      temp = pSrc[right];
+      pSrc[right] = pSrc[left];
+      pSrc[left] = temp;
+    }
+    if (pSrc[right] < pSrc[mid])
+    {
+      temp = pSrc[right];
+      pSrc[right] = pSrc[mid];
+      pSrc[mid] = temp;
+    }
+
+    pivot = pSrc[mid];
+    i = left;
+    j = right;
+
+    /* Partition: elements lower than the pivot to the left, greater to the right */
+    while (i <= j)
+    {
+      while (pSrc[i] < pivot)
+      {
+        i++;
+      }
+      while (pSrc[j] > pivot)
+      {
+        j--;
+      }
+      if (i <= j)
+      {
+        temp = pSrc[i];
+        pSrc[i] = pSrc[j];
+        pSrc[j] = temp;
+        i++;
+        j--;
+      }
+    }
+
+    /* Continue in the partition containing k.  The elements between j and i
+     * are equal to the pivot and already in place. */
+    if ((int32_t) k <= j)
+    {
+      right = j;
+    }
+    else if ((int32_t) k >= i)
+    {
+      left = i;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  *pResult = pSrc[k];
+}
+
+/**
+ * @} end of Select group
+ */
@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_select_q31.c
+ * Description:  Selection of the k-th smallest element of a Q31 vector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Select
+ * @{
+ */
+
+/**
+ * @brief Selection of the k-th smallest element of a Q31 vector.
+ * @param[in,out]   *pSrc points to the input vector, which is reordered
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       k rank of the element to select, between 0 and (blockSize - 1)
+ * @param[out]      *pResult k-th smallest element is returned here
+ * @return none.
+ */
+
+void arm_select_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q31_t * pResult)
+{
+  q31_t pivot, temp;                             /* Pivot value and temporary variable for swaps */
+  int32_t left, right;                           /* Bounds of the partition containing k */
+  int32_t i, j, mid;                             /* Partitioning indices */
+
+  left = 0;
+  right = (int32_t) blockSize - 1;
+
+  while (right > left)
+  {
+    /* Sort the first, middle and last elements and use the median as the pivot.
+     * The first and last elements then act as sentinels for the scans below. */
+    mid = left + ((right - left) >> 1);
+
+    if (pSrc[mid] < pSrc[left])
+    {
+      temp = pSrc[mid];
+      pSrc[mid] = pSrc[left];
+      pSrc[left] = temp;
+    }
+    if (pSrc[right] < pSrc[left])
+    {
+      temp = pSrc[right];
+      pSrc[right] = pSrc[left];
+      pSrc[left] = temp;
+    }
+    if (pSrc[right] < pSrc[mid])
+    {
+      temp = pSrc[right];
+      pSrc[right] = pSrc[mid];
+      pSrc[mid] = temp;
+    }
+
+    pivot = pSrc[mid];
+    i = left;
+    j = right;
+
+    /* Partition: elements lower than the pivot to the left, greater to the right */
+    while (i <= j)
+    {
+      while (pSrc[i] < pivot)
+      {
+        i++;
+      }
+      while (pSrc[j] > pivot)
+      {
+        j--;
+      }
+      if (i <= j)
+      {
+        temp = pSrc[i];
+        pSrc[i] = pSrc[j];
+        pSrc[j] = temp;
+        i++;
+        j--;
+      }
+    }
+
+    /* Continue in the partition containing k.  The elements between j and i
+     * are equal to the pivot and already in place. */
+    if ((int32_t) k <= j)
+    {
+      right = j;
+    }
+    else if ((int32_t) k >= i)
+    {
+      left = i;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  *pResult = pSrc[k];
+}
+
+/**
+ * @} end of Select group
+ */
@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_acc_init_q31.c
+ * Description:  Q31 streaming statistics accumulator initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup StatsAcc
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 streaming statistics accumulator.
+ * @param[out] *S points to an instance of the Q31 streaming statistics accumulator.
+ * @return none.
+ * \par Description:
+ * \par
+ * Clears the sample count and the running moments.  The instance can then be
+ * updated with blocks of samples or merged with other accumulators.
+ */
+
+void arm_stats_acc_init_q31(
+  arm_stats_acc_instance_q31 * S)
+{
+  /* Clear the sample count and the running moments */
+  S->count = 0U;
+  S->mean = 0;
+  S->var = 0;
+
+  /* Clear the extrema */
+  S->min = 0;
+  S->max = 0;
+  S->minIndex = 0U;
+  S->maxIndex = 0U;
+}
+
+/**
+ * @} end of StatsAcc group
+ */
@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_acc_merge_f32.c
+ * Description:  Merges two floating-point streaming statistics accumulators
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup StatsAcc
+ * @{
+ */
+
+/**
+ * @brief Merges two floating-point streaming statistics accumulators.
+ * @param[in,out]   *S points to the accumulator receiving the merged statistics
+ * @param[in]       *S2 points to the accumulator of the samples following the ones of S
+ * @return none.
+ *
+ * \par Description:
+ * After the call, <code>S</code> holds the statistics of the samples of both
+ * instances.  The indices of the extrema of <code>S2</code> are offset by the
+ * sample count of <code>S</code>.  <code>S2</code> is not modified.
+ */
+
+void arm_stats_acc_merge_f32(
+  arm_stats_acc_instance_f32 * S,
+  const arm_stats_acc_instance_f32 * S2)
+{
+  float32_t countA, countB, count;               /* Sample counts as floating-point values */
+  float32_t delta;                               /* Difference of the means */
+
+  /* Nothing to merge */
+  if (S2->count == 0U)
+  {
+    return;
+  }
+
+  /* The merged statistics are the ones of S2 */
+  if (S->count == 0U)
+  {
+    *S = *S2;
+    return;
+  }
+
+  countA = (float32_t) S->count;
+  countB = (float32_t) S2->count;
+  count = countA + countB;
+
+  /* delta = meanB - meanA */
+  delta = S2->mean - S->mean;
+
+  /* m2 = m2A + m2B + delta^2 * countA * countB / count */
+  S->m2 += S2->m2 + (delta * delta) * (countA * (countB / count));
+
+  /* mean = meanA + delta * countB / count */
+  S->mean += delta * (countB / count);
+
+  /* Update the extrema, keeping the first occurrence */
+  if (S2->min < S->min)
+  {
+    S->min = S2->min;
+    S->minIndex = S->count + S2->minIndex;
+  }
+  if (S2->max > S->max)
+  {
+    S->max = S2->max;
+    S->maxIndex = S->count + S2->maxIndex;
+  }
+
+  S->count += S2->count;
+}
+
+/**
+ * @} end of StatsAcc group
+ */
@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_acc_merge_q31.c
+ * Description:  Merges two Q31 streaming statistics accumulators
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @brief Computes x * num / den, for 0 <= num <= den < 2^31, without intermediate overflow.
+ */
+static q63_t arm_stats_acc_scale_q63(
+  q63_t x,
+  uint32_t num,
+  uint32_t den)
+{
+  return ((x / (q63_t) den) * (q63_t) num) + (((x % (q63_t) den) * (q63_t) num) / (q63_t) den);
+}
+
+/**
+ * @addtogroup StatsAcc
+ * @{
+ */
+
+/**
+ * @brief Merges two Q31 streaming statistics accumulators.
+ * @param[in,out]   *S points to the accumulator receiving the merged statistics
+ * @param[in]       *S2 points to the accumulator of the samples following the ones of S
+ * @return none.
+ *
+ * \par Description:
+ * After the call, <code>S</code> holds the statistics of the samples of both
+ * instances.  The indices of the extrema of <code>S2</code> are offset by the
+ * sample count of <code>S</code>.  <code>S2</code> is not modified.
+ *
+ * \par Scaling and Overflow Behavior:
+ * The weights <code>countA / count</code> and <code>countB / count</code> are
+ * applied with 64-bit quotient and remainder arithmetic rather than as rounded
+ * fractions, so merging many small blocks into a large instance does not drift.
+ * The total number of samples must be less than 2^31.
+ */
+
+void arm_stats_acc_merge_q31(
+  arm_stats_acc_instance_q31 * S,
+  const arm_stats_acc_instance_q31 * S2)
+{
+  q63_t delta;                                   /* Difference of the means in 2.62 format */
+  q63_t correction;                              /* delta^2 * countA * countB / count^2 */
+  q31_t delta31;                                 /* Difference of the means in 2.30 format */
+  uint32_t count;                                /* Total number of samples */
+
+  /* Nothing to merge */
+  if (S2->count == 0U)
+  {
+    return;
+  }
+
+  /* The merged statistics are the ones of S2 */
+  if (S->count == 0U)
+  {
+    *S = *S2;
+    return;
+  }
+
+  count = S->count + S2->count;
+
+  /* delta = meanB - meanA */
+  delta = (S2->mean >> 1) - (S->mean >> 1);
+
+  /* correction = delta^2 * countA * countB / count^2, in 4.60 format */
+  delta31 = (q31_t) (delta >> 32);
+  correction = (q63_t) delta31 * delta31;
+  correction = arm_stats_acc_scale_q63(correction, S->count, count);
+  correction = arm_stats_acc_scale_q63(correction, S2->count, count);
+
+  /* var = varA + (varB - varA) * countB / count + correction */
+  S->var += arm_stats_acc_scale_q63(S2->var - S->var, S2->count, count) + (correction << 2);
+
+  /* mean = meanA + delta * countB / count */
+  S->mean += arm_stats_acc_scale_q63(delta, S2->count, count) << 1;
+
+  /* Update the extrema, keeping the first occurrence */
+  if (S2->min < S->min)
+  {
+    S->min = S2->min;
+    S->minIndex = S->count + S2->minIndex;
+  }
+  if (S2->max > S->max)
+  {
+    S->max = S2->max;
+    S->maxIndex = S->count + S2->maxIndex;
+  }
+
+  S->count = count;
+}
+
+/**
+ * @} end of StatsAcc group
+ */
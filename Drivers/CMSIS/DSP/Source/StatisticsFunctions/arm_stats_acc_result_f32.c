@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_acc_result_f32.c
+ * Description:  Statistics of a floating-point streaming statistics accumulator
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup StatsAcc
+ * @{
+ */
+
+/**
+ * @brief Returns the statistics of a floating-point streaming statistics accumulator.
+ * @param[in]       *S points to an instance of the floating-point streaming statistics accumulator
+ * @param[in]       statsFlags statistics to compute, a combination of ::arm_stats_flags
+ * @param[out]      *pResult requested statistics are returned here
+ * @return none.
+ *
+ * \par Description:
+ * The variance is the sample variance, <code>m2 / (count - 1)</code>, as returned
+ * by <code>arm_var_f32()</code>.  Nothing is written when no sample has been accumulated.
+ */
+
+void arm_stats_acc_result_f32(
+  const arm_stats_acc_instance_f32 * S,
+  uint32_t statsFlags,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t count;                               /* Sample count as a floating-point value */
+  float32_t var;                                 /* Variance */
+  float32_t power;                               /* Sum of the squares */
+
+  if (S->count == 0U)
+  {
+    return;
+  }
+
+  count = (float32_t) S->count;
+
+  if ((statsFlags & (uint32_t) ARM_STATS_MEAN) != 0U)
+  {
+    pResult->mean = S->mean;
+  }
+
+  if ((statsFlags & ((uint32_t) ARM_STATS_VAR | (uint32_t) ARM_STATS_STD)) != 0U)
+  {
+    /* C = m2 / (count - 1) */
+    var = (S->count > 1U) ? (S->m2 / (count - 1.0f)) : 0.0f;
+
+    if ((statsFlags & (uint32_t) ARM_STATS_VAR) != 0U)
+    {
+      pResult->var = var;
+    }
+
+    if ((statsFlags & (uint32_t) ARM_STATS_STD) != 0U)
+    {
+      arm_sqrt_f32(var, &pResult->std);
+    }
+  }
+
+  if ((statsFlags & ((uint32_t) ARM_STATS_POWER | (uint32_t) ARM_STATS_RMS)) != 0U)
+  {
+    /* C = sum(x^2) = m2 + count * mean^2 */
+    power = S->m2 + count * (S->mean * S->mean);
+
+    if ((statsFlags & (uint32_t) ARM_STATS_POWER) != 0U)
+    {
+      pResult->power = power;
+    }
+
+    if ((statsFlags & (uint32_t) ARM_STATS_RMS) != 0U)
+    {
+      arm_sqrt_f32(power / count, &pResult->rms);
+    }
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_MIN) != 0U)
+  {
+    pResult->min = S->min;
+    pResult->minIndex = S->minIndex;
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_MAX) != 0U)
+  {
+    pResult->max = S->max;
+    pResult->maxIndex = S->maxIndex;
+  }
+}
+
+/**
+ * @} end of StatsAcc group
+ */
@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_acc_result_q31.c
+ * Description:  Statistics of a Q31 streaming statistics accumulator
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup StatsAcc
+ * @{
+ */
+
+/**
+ * @brief Returns the statistics of a Q31 streaming statistics accumulator.
+ * @param[in]       *S points to an instance of the Q31 streaming statistics accumulator
+ * @param[in]       statsFlags statistics to compute, a combination of ::arm_stats_flags
+ * @param[out]      *pResult requested statistics are returned here
+ * @return none.
+ *
+ * \par Description:
+ * The variance is the sample variance, <code>m2 / (count - 1)</code>, as returned
+ * by <code>arm_var_q31()</code>.  Nothing is written when no sample has been accumulated.
+ *
+ * \par Scaling and Overflow Behavior:
+ * The mean, variance, standard deviation and RMS are returned in 1.31 format, the
+ * variance being saturated.  The power is returned in 16.48 format, as computed by
+ * <code>arm_power_q31()</code>, and saturates when the sum of the squares
+ * exceeds its range.
+ */
+
+void arm_stats_acc_result_q31(
+  const arm_stats_acc_instance_q31 * S,
+  uint32_t statsFlags,
+  arm_stats_result_q31 * pResult)
+{
+  q63_t var;                                     /* Variance */
+  q63_t meanOfSquares;                           /* Mean of the squares in 2.62 format */
+  q63_t power;                                   /* Mean of the squares in 16.48 format */
+  q31_t mean;                                    /* Mean in 1.31 format */
+
+  if (S->count == 0U)
+  {
+    return;
+  }
+
+  mean = (q31_t) (S->mean >> 32);
+
+  if ((statsFlags & (uint32_t) ARM_STATS_MEAN) != 0U)
+  {
+    pResult->mean = mean;
+  }
+
+  if ((statsFlags & ((uint32_t) ARM_STATS_VAR | (uint32_t) ARM_STATS_STD)) != 0U)
+  {
+    if (S->count > 1U)
+    {
+      /* Convert the population variance from 2.62 to 1.31 format */
+      var = S->var >> 31;
+
+      /* C = var * count / (count - 1) */
+      var = clip_q63_to_q31(var + (var / (q63_t) (S->count - 1U)));
+    }
+    else
+    {
+      var = 0;
+    }
+
+    if ((statsFlags & (uint32_t) ARM_STATS_VAR) != 0U)
+    {
+      pResult->var = (q31_t) var;
+    }
+
+    if ((statsFlags & (uint32_t) ARM_STATS_STD) != 0U)
+    {
+      arm_sqrt_q31((q31_t) var, &pResult->std);
+    }
+  }
+
+  if ((statsFlags & ((uint32_t) ARM_STATS_POWER | (uint32_t) ARM_STATS_RMS)) != 0U)
+  {
+    /* C = var + mean^2, in 2.62 format */
+    meanOfSquares = S->var + ((q63_t) mean * mean);
+
+    if ((statsFlags & (uint32_t) ARM_STATS_POWER) != 0U)
+    {
+      /* C = count * meanOfSquares, in 16.48 format */
+      power = meanOfSquares >> 14U;
+      pResult->power = (power > (0x7FFFFFFFFFFFFFFFLL / (q63_t) S->count)) ?
+        0x7FFFFFFFFFFFFFFFLL : (power * (q63_t) S->count);
+    }
+
+    if ((statsFlags & (uint32_t) ARM_STATS_RMS) != 0U)
+    {
+      /* Convert the mean of the squares from 2.62 to 1.31 format and saturate */
+      arm_sqrt_q31(clip_q63_to_q31(meanOfSquares >> 31), &pResult->rms);
+    }
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_MIN) != 0U)
+  {
+    pResult->min = S->min;
+    pResult->minIndex = S->minIndex;
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_MAX) != 0U)
+  {
+    pResult->max = S->max;
+    pResult->maxIndex = S->maxIndex;
+  }
+}
+
+/**
+ * @} end of StatsAcc group
+ */
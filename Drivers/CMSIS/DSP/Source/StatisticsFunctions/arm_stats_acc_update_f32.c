@@ -0,0 +1,268 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_acc_update_f32.c
+ * Description:  Accumulates a floating-point block into streaming statistics
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup StatsAcc Streaming Statistics
+ *
+ * Accumulates the mean, variance, standard deviation, RMS, power, minimum and
+ * maximum of a signal that is delivered in successive blocks, for example the
+ * half-buffers of a circular DMA transfer.
+ *
+ * The accumulator is used in four steps:
+ * - <code>arm_stats_acc_init_xxx()</code> clears an instance.
+ * - <code>arm_stats_acc_update_xxx()</code> adds a block of samples.  It can be
+ *   called any number of times with blocks of any length.
+ * - <code>arm_stats_acc_merge_xxx()</code> combines two instances, for example
+ *   partial results computed on different channels of a buffer or by different
+ *   tasks.  The samples of the second instance are considered to follow the
+ *   samples of the first one, which defines the min/max indices.
+ * - <code>arm_stats_acc_result_xxx()</code> returns any subset of the statistics,
+ *   selected with ::arm_stats_flags, in the same formats as <code>arm_stats_xxx()</code>.
+ *   The instance is not modified and can keep accumulating.
+ *
+ * \par Algorithm
+ * Instead of sums of the samples and of their squares, which lose precision
+ * (floating-point) or overflow (fixed-point) as the count grows, each instance holds
+ * the count, the mean and the spread of the samples around that mean, as in
+ * Welford's algorithm.  Every block is first reduced to its own mean and spread
+ * and then combined with the running values using the pairwise update of Chan et al.:
+ * <pre>
+ *     delta = meanB - meanA
+ *     mean  = meanA + delta * countB / count
+ *     m2    = m2A + m2B + delta^2 * countA * countB / count
+ * </pre>
+ * <code>arm_stats_acc_merge_xxx()</code> applies the same update, so accumulating
+ * a signal in pieces and merging the pieces gives the same result as accumulating
+ * it in one instance.
+ *
+ * \par Fixed-point behavior
+ * The fixed-point instances store the mean in 1.63 format and the population
+ * variance (<code>m2 / count</code>) in 2.62 format.  Both are bounded by the
+ * input range, so no overflow can occur whatever the number of samples, and their
+ * resolution is much finer than the output formats.  Blocks are reduced with exact
+ * 64-bit integer sums (Q15 and Q7) or with a 64-bit two-pass computation (Q31),
+ * in chunks of at most 32768 samples so that the intermediate sums cannot overflow.
+ * The sample count is a 32-bit value.
+ *
+ * There are separate functions for floating-point, Q31, Q15, and Q7 data types.
+ */
+
+/**
+ * @addtogroup StatsAcc
+ * @{
+ */
+
+/**
+ * @brief Accumulates a block of floating-point samples into the streaming statistics.
+ * @param[in,out]   *S points to an instance of the floating-point streaming statistics accumulator
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples to process
+ * @return none.
+ *
+ * \par Description:
+ * The mean and spread of the block are computed with the shifted-data algorithm,
+ * using the first sample of the block as the shift, and then merged into the instance.
+ */
+
+void arm_stats_acc_update_f32(
+  arm_stats_acc_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  arm_stats_acc_instance_f32 block;              /* Statistics of the current block */
+  float32_t shift;                               /* Shift value K subtracted from all the inputs */
+  float32_t in, diff;                            /* Temporary variables */
+  float32_t sum = 0.0f;                          /* Accumulator of (x - K) */
+  float32_t sumOfSquares = 0.0f;                 /* Accumulator of (x - K)^2 */
+  float32_t sumOfInputs;                         /* Accumulator of x */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+  float32_t diff1, diff2, diff3, diff4;          /* Temporary shifted inputs */
+  uint32_t count = 0U;                           /* Index of the last sample processed */
+#endif
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  /* The first sample is the shift value and the initial reference for the extrema */
+  in = *pSrc++;
+  shift = in;
+  sumOfInputs = in;
+  block.min = in;
+  block.max = in;
+  block.minIndex = 0U;
+  block.maxIndex = 0U;
+
+#if defined (ARM_MATH_DSP)
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = (blockSize - 1U) >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    diff1 = in1 - shift;
+    diff2 = in2 - shift;
+    diff3 = in3 - shift;
+    diff4 = in4 - shift;
+
+    /* C = sum(x - K), sum((x - K)^2) and sum(x) */
+    sum += diff1;
+    sumOfSquares += diff1 * diff1;
+    sumOfInputs += in1;
+    sum += diff2;
+    sumOfSquares += diff2 * diff2;
+    sumOfInputs += in2;
+    sum += diff3;
+    sumOfSquares += diff3 * diff3;
+    sumOfInputs += in3;
+    sum += diff4;
+    sumOfSquares += diff4 * diff4;
+    sumOfInputs += in4;
+
+    /* compare for the extrema */
+    if (in1 < block.min)
+    {
+      block.min = in1;
+      block.minIndex = count + 1U;
+    }
+    if (in1 > block.max)
+    {
+      block.max = in1;
+      block.maxIndex = count + 1U;
+    }
+    if (in2 < block.min)
+    {
+      block.min = in2;
+      block.minIndex = count + 2U;
+    }
+    if (in2 > block.max)
+    {
+      block.max = in2;
+      block.maxIndex = count + 2U;
+    }
+    if (in3 < block.min)
+    {
+      block.min = in3;
+      block.minIndex = count + 3U;
+    }
+    if (in3 > block.max)
+    {
+      block.max = in3;
+      block.maxIndex = count + 3U;
+    }
+    if (in4 < block.min)
+    {
+      block.min = in4;
+      block.minIndex = count + 4U;
+    }
+    if (in4 > block.max)
+    {
+      block.max = in4;
+      block.maxIndex = count + 4U;
+    }
+
+    count += 4U;
+    pSrc += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the (blockSize - 1) is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = (blockSize - 1U) % 0x4U;
+
+#else
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over (blockSize - 1) number of values */
+  blkCnt = (blockSize - 1U);
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+    diff = in - shift;
+
+    /* C = sum(x - K), sum((x - K)^2) and sum(x) */
+    sum += diff;
+    sumOfSquares += diff * diff;
+    sumOfInputs += in;
+
+    /* compare for the extrema and update their index */
+    if (in < block.min)
+    {
+      block.min = in;
+      block.minIndex = blockSize - blkCnt;
+    }
+    if (in > block.max)
+    {
+      block.max = in;
+      block.maxIndex = blockSize - blkCnt;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Mean and sum of the squared deviations of the block */
+  block.count = blockSize;
+  block.mean = sumOfInputs / (float32_t) blockSize;
+  block.m2 = sumOfSquares - (sum * sum) / (float32_t) blockSize;
+
+  /* Guard against a negative result caused by rounding */
+  if (block.m2 < 0.0f)
+  {
+    block.m2 = 0.0f;
+  }
+
+  /* Combine the block with the running statistics */
+  arm_stats_acc_merge_f32(S, &block);
+}
+
+/**
+ * @} end of StatsAcc group
+ */
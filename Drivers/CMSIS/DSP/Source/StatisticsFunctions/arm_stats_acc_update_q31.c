@@ -0,0 +1,261 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_acc_update_q31.c
+ * Description:  Accumulates a Q31 block into streaming statistics
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Largest number of samples reduced at once, keeps the 64-bit sums from overflowing */
+#define STATS_ACC_CHUNK_SIZE 0x8000U
+
+/**
+ * @addtogroup StatsAcc
+ * @{
+ */
+
+/**
+ * @brief Accumulates a block of Q31 samples into the streaming statistics.
+ * @param[in,out]   *S points to an instance of the Q31 streaming statistics accumulator
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples to process
+ * @return none.
+ *
+ * \par Description:
+ * The block is processed in chunks of at most 32768 samples.  For each chunk, a
+ * first pass computes the exact 64-bit sum of the samples and the extrema, and a
+ * second pass accumulates the squared deviations from the truncated mean.
+ * The deviations are halved before squaring and the squares are scaled down by
+ * 2^16, giving a sum in 20.44 format that cannot overflow for the chunk length.
+ * The chunk statistics are then merged into the instance.
+ */
+
+void arm_stats_acc_update_q31(
+  arm_stats_acc_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  arm_stats_acc_instance_q31 block;              /* Statistics of the current chunk */
+  q31_t *pIn;                                    /* Pointer to the current chunk */
+  q63_t sum;                                     /* Accumulator of x */
+  q63_t sumOfSquares;                            /* Accumulator of (x - mean)^2 */
+  q63_t diff;                                    /* Deviation from the mean */
+  q63_t rem;                                     /* Remainder of the divisions */
+  q31_t in;                                      /* Temporary variable */
+  q31_t mean;                                    /* Truncated mean of the chunk */
+  uint32_t chunkSize;                            /* Number of samples of the current chunk */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  q31_t in1, in2, in3, in4;                      /* Temporary input variables */
+  uint32_t count;                                /* Index of the last sample processed */
+#endif
+
+  while (blockSize > 0U)
+  {
+    chunkSize = (blockSize > STATS_ACC_CHUNK_SIZE) ? STATS_ACC_CHUNK_SIZE : blockSize;
+
+    /* First pass: sum and extrema of the chunk */
+    pIn = pSrc;
+    in = *pIn++;
+    sum = in;
+    block.min = in;
+    block.max = in;
+    block.minIndex = 0U;
+    block.maxIndex = 0U;
+
+#if defined (ARM_MATH_DSP)
+    /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+    count = 0U;
+
+    /* Loop unrolling */
+    blkCnt = (chunkSize - 1U) >> 2U;
+
+    while (blkCnt > 0U)
+    {
+      in1 = pIn[0];
+      in2 = pIn[1];
+      in3 = pIn[2];
+      in4 = pIn[3];
+
+      /* C = sum(x) */
+      sum += in1;
+      sum += in2;
+      sum += in3;
+      sum += in4;
+
+      /* compare for the extrema */
+      if (in1 < block.min)
+      {
+        block.min = in1;
+        block.minIndex = count + 1U;
+      }
+      if (in1 > block.max)
+      {
+        block.max = in1;
+        block.maxIndex = count + 1U;
+      }
+      if (in2 < block.min)
+      {
+        block.min = in2;
+        block.minIndex = count + 2U;
+      }
+      if (in2 > block.max)
+      {
+        block.max = in2;
+        block.maxIndex = count + 2U;
+      }
+      if (in3 < block.min)
+      {
+        block.min = in3;
+        block.minIndex = count + 3U;
+      }
+      if (in3 > block.max)
+      {
+        block.max = in3;
+        block.maxIndex = count + 3U;
+      }
+      if (in4 < block.min)
+      {
+        block.min = in4;
+        block.minIndex = count + 4U;
+      }
+      if (in4 > block.max)
+      {
+        block.max = in4;
+        block.maxIndex = count + 4U;
+      }
+
+      count += 4U;
+      pIn += 4U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the (chunkSize - 1) is not a multiple of 4, compute any remaining samples here.
+     ** No loop unrolling is used. */
+    blkCnt = (chunkSize - 1U) % 0x4U;
+
+#else
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over (chunkSize - 1) number of values */
+    blkCnt = (chunkSize - 1U);
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      in = *pIn++;
+
+      /* C = sum(x) */
+      sum += in;
+
+      /* compare for the extrema and update their index */
+      if (in < block.min)
+      {
+        block.min = in;
+        block.minIndex = chunkSize - blkCnt;
+      }
+      if (in > block.max)
+      {
+        block.max = in;
+        block.maxIndex = chunkSize - blkCnt;
+      }
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Mean of the chunk in 1.63 format, from the quotient and the remainder of sum / chunkSize */
+    mean = (q31_t) (sum / (q63_t) chunkSize);
+    rem = sum % (q63_t) chunkSize;
+    block.mean = ((q63_t) mean << 32) + ((rem << 32) / (q63_t) chunkSize);
+
+    /* Second pass: sum of the squared deviations from the truncated mean */
+    pIn = pSrc;
+    sumOfSquares = 0;
+
+#if defined (ARM_MATH_DSP)
+    /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+    /* Loop unrolling */
+    blkCnt = chunkSize >> 2U;
+
+    while (blkCnt > 0U)
+    {
+      /* C = sum(((x - mean) / 2)^2 / 2^16), in 20.44 format */
+      diff = ((q63_t) *pIn++ - mean) >> 1U;
+      sumOfSquares += (diff * diff) >> 16U;
+      diff = ((q63_t) *pIn++ - mean) >> 1U;
+      sumOfSquares += (diff * diff) >> 16U;
+      diff = ((q63_t) *pIn++ - mean) >> 1U;
+      sumOfSquares += (diff * diff) >> 16U;
+      diff = ((q63_t) *pIn++ - mean) >> 1U;
+      sumOfSquares += (diff * diff) >> 16U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the chunkSize is not a multiple of 4, compute any remaining samples here.
+     ** No loop unrolling is used. */
+    blkCnt = chunkSize % 0x4U;
+
+#else
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over chunkSize number of values */
+    blkCnt = chunkSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      /* C = sum(((x - mean) / 2)^2 / 2^16), in 20.44 format */
+      diff = ((q63_t) *pIn++ - mean) >> 1U;
+      sumOfSquares += (diff * diff) >> 16U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Population variance of the chunk, converted from 20.44 to 2.62 format */
+    rem = sumOfSquares % (q63_t) chunkSize;
+    block.var = ((sumOfSquares / (q63_t) chunkSize) << 18) + ((rem << 18) / (q63_t) chunkSize);
+    block.count = chunkSize;
+
+    /* Combine the chunk with the running statistics */
+    arm_stats_acc_merge_q31(S, &block);
+
+    pSrc += chunkSize;
+    blockSize -= chunkSize;
+  }
+}
+
+/**
+ * @} end of StatsAcc group
+ */
@@ -0,0 +1,232 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_acc_update_q7.c
+ * Description:  Accumulates a Q7 block into streaming statistics
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Largest number of samples reduced at once, keeps the 64-bit sums from overflowing */
+#define STATS_ACC_CHUNK_SIZE 0x8000U
+
+/**
+ * @addtogroup StatsAcc
+ * @{
+ */
+
+/**
+ * @brief Accumulates a block of Q7 samples into the streaming statistics.
+ * @param[in,out]   *S points to an instance of the Q7 streaming statistics accumulator
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples to process
+ * @return none.
+ *
+ * \par Description:
+ * The block is processed in chunks of at most 32768 samples.  The sum of the
+ * samples (25.7 format) and the sum of their squares (18.14 format) are
+ * accumulated exactly, so the spread of a chunk is computed without rounding:
+ * <pre>
+ *     count^2 * var = count * sum(x^2) - sum(x)^2
+ * </pre>
+ * The chunk statistics are then merged into the instance.
+ */
+
+void arm_stats_acc_update_q7(
+  arm_stats_acc_instance_q7 * S,
+  q7_t * pSrc,
+  uint32_t blockSize)
+{
+  arm_stats_acc_instance_q7 block;               /* Statistics of the current chunk */
+  q31_t sum;                                     /* Accumulator of the inputs, 25.7 format */
+  q31_t power;                                   /* Accumulator of the squares, 18.14 format */
+  q63_t num, den, rem;                           /* Terms of the exact divisions */
+  q7_t in;                                       /* Temporary input variable */
+  uint32_t chunkSize;                            /* Number of samples of the current chunk */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  q31_t in32;                                    /* Packed input variable */
+  q31_t in1, in2;                                /* Sign extended pairs of inputs */
+  q7_t in3, in4, in5, in6;                       /* Unpacked input variables */
+  uint32_t count;                                /* Index of the first sample of the current block */
+#endif
+
+  while (blockSize > 0U)
+  {
+    chunkSize = (blockSize > STATS_ACC_CHUNK_SIZE) ? STATS_ACC_CHUNK_SIZE : blockSize;
+
+    sum = 0;
+    power = 0;
+
+    /* Load first input value that act as reference value for comparision */
+    block.min = *pSrc;
+    block.max = block.min;
+    block.minIndex = 0U;
+    block.maxIndex = 0U;
+
+#if defined (ARM_MATH_DSP)
+    /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+    count = 0U;
+
+    /* Loop unrolling */
+    blkCnt = chunkSize >> 2U;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while (blkCnt > 0U)
+    {
+      /* read four samples from source buffer and sign extend them in pairs */
+      in32 = *__SIMD32(pSrc)++;
+      in1 = __SXTB16(__ROR(in32, 8));
+      in2 = __SXTB16(in32);
+
+      /* C = A[0] + A[1] + ... + A[chunkSize-1] */
+      sum = __SMLAD(in1, 0x00010001, sum);
+      sum = __SMLAD(in2, 0x00010001, sum);
+
+      /* C = A[0] * A[0] + A[1] * A[1] + ... + A[chunkSize-1] * A[chunkSize-1] */
+      power = __SMLAD(in1, in1, power);
+      power = __SMLAD(in2, in2, power);
+
+      /* Unpack the samples in memory order */
+#ifndef ARM_MATH_BIG_ENDIAN
+      in3 = (q7_t) in32;
+      in4 = (q7_t) (in32 >> 8);
+      in5 = (q7_t) (in32 >> 16);
+      in6 = (q7_t) (in32 >> 24);
+#else
+      in3 = (q7_t) (in32 >> 24);
+      in4 = (q7_t) (in32 >> 16);
+      in5 = (q7_t) (in32 >> 8);
+      in6 = (q7_t) in32;
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      /* compare for the extrema */
+      if (in3 < block.min)
+      {
+        block.min = in3;
+        block.minIndex = count;
+      }
+      if (in3 > block.max)
+      {
+        block.max = in3;
+        block.maxIndex = count;
+      }
+      if (in4 < block.min)
+      {
+        block.min = in4;
+        block.minIndex = count + 1U;
+      }
+      if (in4 > block.max)
+      {
+        block.max = in4;
+        block.maxIndex = count + 1U;
+      }
+      if (in5 < block.min)
+      {
+        block.min = in5;
+        block.minIndex = count + 2U;
+      }
+      if (in5 > block.max)
+      {
+        block.max = in5;
+        block.maxIndex = count + 2U;
+      }
+      if (in6 < block.min)
+      {
+        block.min = in6;
+        block.minIndex = count + 3U;
+      }
+      if (in6 > block.max)
+      {
+        block.max = in6;
+        block.maxIndex = count + 3U;
+      }
+
+      count += 4U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the chunkSize is not a multiple of 4, compute any remaining samples here.
+     ** No loop unrolling is used. */
+    blkCnt = chunkSize % 0x4U;
+
+#else
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over chunkSize number of values */
+    blkCnt = chunkSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      in = *pSrc++;
+
+      /* C = A[0] + A[1] + ... + A[chunkSize-1] */
+      sum += in;
+
+      /* C = A[0] * A[0] + A[1] * A[1] + ... + A[chunkSize-1] * A[chunkSize-1] */
+      power += ((q15_t) in * in);
+
+      /* compare for the extrema and update their index */
+      if (in < block.min)
+      {
+        block.min = in;
+        block.minIndex = chunkSize - blkCnt;
+      }
+      if (in > block.max)
+      {
+        block.max = in;
+        block.maxIndex = chunkSize - blkCnt;
+      }
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Mean of the chunk converted from 1.7 to 1.63 format, from the quotient and the remainder of sum / chunkSize */
+    rem = (q63_t) sum % (q63_t) chunkSize;
+    block.mean = (((q63_t) sum / (q63_t) chunkSize) << 56) + (((rem << 32) / (q63_t) chunkSize) << 24);
+
+    /* Population variance of the chunk, (count * sum(x^2) - sum(x)^2) / count^2, converted from 2.14 to 2.62 format */
+    num = (((q63_t) power * chunkSize) - ((q63_t) sum * sum)) << 16;
+    den = (q63_t) chunkSize * chunkSize;
+    rem = num % den;
+    block.var = ((num / den) << 32) + ((rem << 32) / den);
+    block.count = chunkSize;
+
+    /* Combine the chunk with the running statistics */
+    arm_stats_acc_merge_q7(S, &block);
+
+    blockSize -= chunkSize;
+  }
+}
+
+/**
+ * @} end of StatsAcc group
+ */
@@ -0,0 +1,348 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_f32.c
+ * Description:  Single pass statistics of the elements of a floating-point vector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Stats Single Pass Statistics
+ *
+ * Computes any subset of the mean, variance, standard deviation, RMS, power,
+ * minimum and maximum of a vector while reading the input only once.
+ * Calling <code>arm_mean</code>, <code>arm_var</code>, <code>arm_rms</code>,
+ * <code>arm_min</code> and <code>arm_max</code> on the same buffer reads it five times;
+ * these functions share the loads and accumulate all quantities in the same loop.
+ *
+ * The statistics to compute are selected by OR-ing the flags of ::arm_stats_flags.
+ * Fields of the result structure that were not requested are left untouched.
+ * Minimum and maximum tracking is skipped entirely when neither
+ * <code>ARM_STATS_MIN</code> nor <code>ARM_STATS_MAX</code> is requested.
+ *
+ * Each output uses the same format as the equivalent single-statistic function,
+ * so the results can be substituted directly.  In particular, <code>power</code>
+ * has the format of <code>arm_power_xxx()</code> and the min/max indices follow
+ * the first-occurrence rule of <code>arm_min_xxx()</code> and <code>arm_max_xxx()</code>.
+ *
+ * <b>Variance</b>
+ * \par
+ * The floating-point variance uses the shifted-data algorithm: the first sample
+ * <code>K = pSrc[0]</code> is subtracted from every input before accumulation
+ * <pre>
+ *     Result = (sum((x[n] - K)^2) - sum(x[n] - K)^2 / blockSize) / (blockSize - 1)
+ * </pre>
+ * which avoids the cancellation of the textbook one-pass formula when the mean is
+ * large compared to the spread of the data.  The fixed-point versions accumulate
+ * exactly in 64 bits and subtract the rounded mean, so no precision is lost before
+ * the final scaling.
+ *
+ * There are separate functions for floating-point, Q31, Q15, and Q7 data types.
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief Single pass statistics of a floating-point vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       statsFlags statistics to compute, a combination of ::arm_stats_flags
+ * @param[out]      *pResult requested statistics are returned here
+ * @return none.
+ *
+ * \par
+ * The function returns without writing any result when <code>blockSize</code> is 0.
+ */
+
+void arm_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t statsFlags,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t shift;                               /* Shift value K subtracted from all the inputs */
+  float32_t in, diff;                            /* Temporary variables */
+  float32_t sum = 0.0f;                          /* Accumulator of (x - K) */
+  float32_t sumOfInputs;                         /* Accumulator of x */
+  float32_t sumOfSquares = 0.0f;                 /* Accumulator of (x - K)^2 */
+  float32_t power;                               /* Accumulator of x^2 */
+  float32_t minVal, maxVal;                      /* Running extrema */
+  float32_t var;                                 /* Variance */
+  uint32_t minIndex = 0U, maxIndex = 0U;         /* Index of the running extrema */
+  uint32_t extrema;                              /* Set when min or max is requested */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+  float32_t diff1, diff2, diff3, diff4;          /* Temporary shifted inputs */
+  uint32_t count = 0U;                           /* Index of the last sample processed */
+#endif
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  extrema = statsFlags & ((uint32_t) ARM_STATS_MIN | (uint32_t) ARM_STATS_MAX);
+
+  /* The first sample is the shift value and the initial reference for the extrema */
+  in = *pSrc++;
+  shift = in;
+  sumOfInputs = in;
+  power = in * in;
+  minVal = in;
+  maxVal = in;
+
+#if defined (ARM_MATH_DSP)
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = (blockSize - 1U) >> 2U;
+
+  if (extrema != 0U)
+  {
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while (blkCnt > 0U)
+    {
+      in1 = pSrc[0];
+      in2 = pSrc[1];
+      in3 = pSrc[2];
+      in4 = pSrc[3];
+
+      diff1 = in1 - shift;
+      diff2 = in2 - shift;
+      diff3 = in3 - shift;
+      diff4 = in4 - shift;
+
+      /* C = sum(x - K), sum((x - K)^2), sum(x) and sum(x^2) */
+      sum += diff1;
+      sumOfSquares += diff1 * diff1;
+      sumOfInputs += in1;
+      power += in1 * in1;
+      sum += diff2;
+      sumOfSquares += diff2 * diff2;
+      sumOfInputs += in2;
+      power += in2 * in2;
+      sum += diff3;
+      sumOfSquares += diff3 * diff3;
+      sumOfInputs += in3;
+      power += in3 * in3;
+      sum += diff4;
+      sumOfSquares += diff4 * diff4;
+      sumOfInputs += in4;
+      power += in4 * in4;
+
+      /* compare for the extrema */
+      if (in1 < minVal)
+      {
+        minVal = in1;
+        minIndex = count + 1U;
+      }
+      if (in1 > maxVal)
+      {
+        maxVal = in1;
+        maxIndex = count + 1U;
+      }
+      if (in2 < minVal)
+      {
+        minVal = in2;
+        minIndex = count + 2U;
+      }
+      if (in2 > maxVal)
+      {
+        maxVal = in2;
+        maxIndex = count + 2U;
+      }
+      if (in3 < minVal)
+      {
+        minVal = in3;
+        minIndex = count + 3U;
+      }
+      if (in3 > maxVal)
+      {
+        maxVal = in3;
+        maxIndex = count + 3U;
+      }
+      if (in4 < minVal)
+      {
+        minVal = in4;
+        minIndex = count + 4U;
+      }
+      if (in4 > maxVal)
+      {
+        maxVal = in4;
+        maxIndex = count + 4U;
+      }
+
+      count += 4U;
+      pSrc += 4U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    while (blkCnt > 0U)
+    {
+      in1 = pSrc[0];
+      in2 = pSrc[1];
+      in3 = pSrc[2];
+      in4 = pSrc[3];
+
+      diff1 = in1 - shift;
+      diff2 = in2 - shift;
+      diff3 = in3 - shift;
+      diff4 = in4 - shift;
+
+      /* C = sum(x - K), sum((x - K)^2), sum(x) and sum(x^2) */
+      sum += diff1;
+      sumOfSquares += diff1 * diff1;
+      sumOfInputs += in1;
+      power += in1 * in1;
+      sum += diff2;
+      sumOfSquares += diff2 * diff2;
+      sumOfInputs += in2;
+      power += in2 * in2;
+      sum += diff3;
+      sumOfSquares += diff3 * diff3;
+      sumOfInputs += in3;
+      power += in3 * in3;
+      sum += diff4;
+      sumOfSquares += diff4 * diff4;
+      sumOfInputs += in4;
+      power += in4 * in4;
+
+      pSrc += 4U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* If the (blockSize - 1) is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = (blockSize - 1U) % 0x4U;
+
+#else
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over (blockSize - 1) number of values */
+  blkCnt = (blockSize - 1U);
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+    diff = in - shift;
+
+    /* C = sum(x - K), sum((x - K)^2), sum(x) and sum(x^2) */
+    sum += diff;
+    sumOfSquares += diff * diff;
+    sumOfInputs += in;
+    power += in * in;
+
+    if (extrema != 0U)
+    {
+      /* compare for the extrema and update their index */
+      if (in < minVal)
+      {
+        minVal = in;
+        minIndex = blockSize - blkCnt;
+      }
+      if (in > maxVal)
+      {
+        maxVal = in;
+        maxIndex = blockSize - blkCnt;
+      }
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_MEAN) != 0U)
+  {
+    /* C = sum(x) / blockSize */
+    pResult->mean = sumOfInputs / (float32_t) blockSize;
+  }
+
+  if ((statsFlags & ((uint32_t) ARM_STATS_VAR | (uint32_t) ARM_STATS_STD)) != 0U)
+  {
+    if (blockSize > 1U)
+    {
+      /* C = (sum((x - K)^2) - sum(x - K)^2 / blockSize) / (blockSize - 1) */
+      var = (sumOfSquares - (sum * sum) / (float32_t) blockSize) / (float32_t) (blockSize - 1U);
+    }
+    else
+    {
+      var = 0.0f;
+    }
+
+    if ((statsFlags & (uint32_t) ARM_STATS_VAR) != 0U)
+    {
+      pResult->var = var;
+    }
+
+    if ((statsFlags & (uint32_t) ARM_STATS_STD) != 0U)
+    {
+      arm_sqrt_f32(var, &pResult->std);
+    }
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_POWER) != 0U)
+  {
+    pResult->power = power;
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_RMS) != 0U)
+  {
+    arm_sqrt_f32(power / (float32_t) blockSize, &pResult->rms);
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_MIN) != 0U)
+  {
+    pResult->min = minVal;
+    pResult->minIndex = minIndex;
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_MAX) != 0U)
+  {
+    pResult->max = maxVal;
+    pResult->maxIndex = maxIndex;
+  }
+}
+
+/**
+ * @} end of Stats group
+ */
@@ -0,0 +1,308 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_q31.c
+ * Description:  Single pass statistics of the elements of a Q31 vector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief Single pass statistics of a Q31 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       statsFlags statistics to compute, a combination of ::arm_stats_flags
+ * @param[out]      *pResult requested statistics are returned here
+ * @return none.
+ *
+ * \par
+ * The function returns without writing any result when <code>blockSize</code> is 0.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using two 64-bit internal accumulators.
+ * The sum of the inputs is accumulated without loss in 33.31 format.
+ * The squares of the inputs are truncated from 2.62 to 2.48 format and accumulated
+ * in 16.48 format, exactly as in <code>arm_power_q31()</code>: with 15 guard bits
+ * there is no risk of overflow for blocks of up to 65536 samples.
+ * \par
+ * The mean, variance, standard deviation and RMS are returned in 1.31 format,
+ * the power is returned in 16.48 format.
+ * The variance is computed in 2.46 format by subtracting <code>sum * mean</code>
+ * from the sum of squares, which cannot overflow for blocks of up to 65536 samples,
+ * and is finally right shifted by 15 bits to 1.31 format.
+ */
+
+void arm_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t statsFlags,
+  arm_stats_result_q31 * pResult)
+{
+  q63_t sum = 0;                                 /* Accumulator of the inputs, 33.31 format */
+  q63_t power = 0;                               /* Accumulator of the squares, 16.48 format */
+  q63_t mean, var;                               /* Temporary results */
+  q31_t in;                                      /* Temporary input variable */
+  q31_t minVal, maxVal;                          /* Running extrema */
+  uint32_t minIndex = 0U, maxIndex = 0U;         /* Index of the running extrema */
+  uint32_t extrema;                              /* Set when min or max is requested */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  q31_t in1, in2, in3, in4;                      /* Temporary input variables */
+  uint32_t count = 0U;                           /* Index of the first sample of the current block */
+#endif
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  extrema = statsFlags & ((uint32_t) ARM_STATS_MIN | (uint32_t) ARM_STATS_MAX);
+
+  /* Load first input value that act as reference value for comparision */
+  minVal = *pSrc;
+  maxVal = minVal;
+
+#if defined (ARM_MATH_DSP)
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  if (extrema != 0U)
+  {
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while (blkCnt > 0U)
+    {
+      /* read four samples from source buffer */
+      in1 = pSrc[0];
+      in2 = pSrc[1];
+      in3 = pSrc[2];
+      in4 = pSrc[3];
+
+      /* C = A[0] + A[1] + ... + A[blockSize-1] */
+      sum += in1;
+      sum += in2;
+      sum += in3;
+      sum += in4;
+
+      /* C = A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1] */
+      power += ((q63_t) in1 * in1) >> 14U;
+      power += ((q63_t) in2 * in2) >> 14U;
+      power += ((q63_t) in3 * in3) >> 14U;
+      power += ((q63_t) in4 * in4) >> 14U;
+
+      /* compare for the extrema */
+      if (in1 < minVal)
+      {
+        minVal = in1;
+        minIndex = count;
+      }
+      if (in1 > maxVal)
+      {
+        maxVal = in1;
+        maxIndex = count;
+      }
+      if (in2 < minVal)
+      {
+        minVal = in2;
+        minIndex = count + 1U;
+      }
+      if (in2 > maxVal)
+      {
+        maxVal = in2;
+        maxIndex = count + 1U;
+      }
+      if (in3 < minVal)
+      {
+        minVal = in3;
+        minIndex = count + 2U;
+      }
+      if (in3 > maxVal)
+      {
+        maxVal = in3;
+        maxIndex = count + 2U;
+      }
+      if (in4 < minVal)
+      {
+        minVal = in4;
+        minIndex = count + 3U;
+      }
+      if (in4 > maxVal)
+      {
+        maxVal = in4;
+        maxIndex = count + 3U;
+      }
+
+      count += 4U;
+      pSrc += 4U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    while (blkCnt > 0U)
+    {
+      /* read four samples from source buffer */
+      in1 = pSrc[0];
+      in2 = pSrc[1];
+      in3 = pSrc[2];
+      in4 = pSrc[3];
+
+      /* C = A[0] + A[1] + ... + A[blockSize-1] */
+      sum += in1;
+      sum += in2;
+      sum += in3;
+      sum += in4;
+
+      /* C = A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1] */
+      power += ((q63_t) in1 * in1) >> 14U;
+      power += ((q63_t) in2 * in2) >> 14U;
+      power += ((q63_t) in3 * in3) >> 14U;
+      power += ((q63_t) in4 * in4) >> 14U;
+
+      pSrc += 4U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* C = A[0] + A[1] + ... + A[blockSize-1] */
+    sum += in;
+
+    /* C = A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1] */
+    power += ((q63_t) in * in) >> 14U;
+
+    if (extrema != 0U)
+    {
+      /* compare for the extrema and update their index */
+      if (in < minVal)
+      {
+        minVal = in;
+        minIndex = blockSize - blkCnt;
+      }
+      if (in > maxVal)
+      {
+        maxVal = in;
+        maxIndex = blockSize - blkCnt;
+      }
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Mean in 1.31 format */
+  mean = sum / (q63_t) blockSize;
+
+  if ((statsFlags & (uint32_t) ARM_STATS_MEAN) != 0U)
+  {
+    pResult->mean = (q31_t) mean;
+  }
+
+  if ((statsFlags & ((uint32_t) ARM_STATS_VAR | (uint32_t) ARM_STATS_STD)) != 0U)
+  {
+    if (blockSize > 1U)
+    {
+      /* C = (sum(x^2) - sum(x) * mean) / (blockSize - 1), computed in 2.46 format */
+      var = ((power >> 2U) - (sum >> 8U) * (mean >> 8U)) / (q63_t) (blockSize - 1U);
+
+      /* Convert the 2.46 variance to 1.31 format */
+      var = var >> 15U;
+    }
+    else
+    {
+      var = 0;
+    }
+
+    if ((statsFlags & (uint32_t) ARM_STATS_VAR) != 0U)
+    {
+      pResult->var = (q31_t) var;
+    }
+
+    if ((statsFlags & (uint32_t) ARM_STATS_STD) != 0U)
+    {
+      arm_sqrt_q31((q31_t) var, &pResult->std);
+    }
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_POWER) != 0U)
+  {
+    /* Store the power in 16.48 format */
+    pResult->power = power;
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_RMS) != 0U)
+  {
+    /* Convert the 16.48 mean of squares to 1.31 format and saturate */
+    arm_sqrt_q31(clip_q63_to_q31((power / (q63_t) blockSize) >> 17U), &pResult->rms);
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_MIN) != 0U)
+  {
+    pResult->min = minVal;
+    pResult->minIndex = minIndex;
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_MAX) != 0U)
+  {
+    pResult->max = maxVal;
+    pResult->maxIndex = maxIndex;
+  }
+}
+
+/**
+ * @} end of Stats group
+ */
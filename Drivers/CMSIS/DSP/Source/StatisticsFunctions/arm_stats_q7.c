@@ -0,0 +1,310 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_q7.c
+ * Description:  Single pass statistics of the elements of a Q7 vector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief Single pass statistics of a Q7 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       statsFlags statistics to compute, a combination of ::arm_stats_flags
+ * @param[out]      *pResult requested statistics are returned here
+ * @return none.
+ *
+ * \par
+ * The function returns without writing any result when <code>blockSize</code> is 0.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The sum of the inputs is accumulated in 25.7 format and the squares of the
+ * inputs in 18.14 format, both in 32-bit accumulators which cannot overflow for
+ * blocks of up to 65536 samples.  Four samples are loaded at a time, sign extended
+ * in pairs with <code>SXTB16</code> and accumulated with <code>SMLAD</code>.
+ * \par
+ * The mean and variance are truncated and saturated to 1.7 format.  The standard
+ * deviation and RMS are computed with <code>arm_sqrt_q15()</code> and truncated
+ * to 1.7 format.  The power is returned in 18.14 format as in <code>arm_power_q7()</code>.
+ */
+
+void arm_stats_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  uint32_t statsFlags,
+  arm_stats_result_q7 * pResult)
+{
+  q31_t sum = 0;                                 /* Accumulator of the inputs, 25.7 format */
+  q31_t power = 0;                               /* Accumulator of the squares, 18.14 format */
+  q31_t mean;                                    /* Mean in 1.7 format */
+  q31_t var;                                     /* Variance in 2.14 format */
+  q15_t sqrtOut;                                 /* Square root in 1.15 format */
+  q7_t in;                                       /* Temporary input variable */
+  q7_t minVal, maxVal;                           /* Running extrema */
+  uint32_t minIndex = 0U, maxIndex = 0U;         /* Index of the running extrema */
+  uint32_t extrema;                              /* Set when min or max is requested */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  q31_t in32;                                    /* Packed input variable */
+  q31_t in1, in2;                                /* Sign extended pairs of inputs */
+  q7_t in3, in4, in5, in6;                       /* Unpacked input variables */
+  uint32_t count = 0U;                           /* Index of the first sample of the current block */
+#endif
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  extrema = statsFlags & ((uint32_t) ARM_STATS_MIN | (uint32_t) ARM_STATS_MAX);
+
+  /* Load first input value that act as reference value for comparision */
+  minVal = *pSrc;
+  maxVal = minVal;
+
+#if defined (ARM_MATH_DSP)
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  if (extrema != 0U)
+  {
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while (blkCnt > 0U)
+    {
+      /* read four samples from source buffer and sign extend them in pairs */
+      in32 = *__SIMD32(pSrc)++;
+      in1 = __SXTB16(__ROR(in32, 8));
+      in2 = __SXTB16(in32);
+
+      /* C = A[0] + A[1] + ... + A[blockSize-1] */
+      sum = __SMLAD(in1, 0x00010001, sum);
+      sum = __SMLAD(in2, 0x00010001, sum);
+
+      /* C = A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1] */
+      power = __SMLAD(in1, in1, power);
+      power = __SMLAD(in2, in2, power);
+
+      /* Unpack the samples in memory order */
+#ifndef ARM_MATH_BIG_ENDIAN
+      in3 = (q7_t) in32;
+      in4 = (q7_t) (in32 >> 8);
+      in5 = (q7_t) (in32 >> 16);
+      in6 = (q7_t) (in32 >> 24);
+#else
+      in3 = (q7_t) (in32 >> 24);
+      in4 = (q7_t) (in32 >> 16);
+      in5 = (q7_t) (in32 >> 8);
+      in6 = (q7_t) in32;
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      /* compare for the extrema */
+      if (in3 < minVal)
+      {
+        minVal = in3;
+        minIndex = count;
+      }
+      if (in3 > maxVal)
+      {
+        maxVal = in3;
+        maxIndex = count;
+      }
+      if (in4 < minVal)
+      {
+        minVal = in4;
+        minIndex = count + 1U;
+      }
+      if (in4 > maxVal)
+      {
+        maxVal = in4;
+        maxIndex = count + 1U;
+      }
+      if (in5 < minVal)
+      {
+        minVal = in5;
+        minIndex = count + 2U;
+      }
+      if (in5 > maxVal)
+      {
+        maxVal = in5;
+        maxIndex = count + 2U;
+      }
+      if (in6 < minVal)
+      {
+        minVal = in6;
+        minIndex = count + 3U;
+      }
+      if (in6 > maxVal)
+      {
+        maxVal = in6;
+        maxIndex = count + 3U;
+      }
+
+      count += 4U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    while (blkCnt > 0U)
+    {
+      /* read four samples from source buffer and sign extend them in pairs */
+      in32 = *__SIMD32(pSrc)++;
+      in1 = __SXTB16(__ROR(in32, 8));
+      in2 = __SXTB16(in32);
+
+      /* C = A[0] + A[1] + ... + A[blockSize-1] */
+      sum = __SMLAD(in1, 0x00010001, sum);
+      sum = __SMLAD(in2, 0x00010001, sum);
+
+      /* C = A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1] */
+      power = __SMLAD(in1, in1, power);
+      power = __SMLAD(in2, in2, power);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* C = A[0] + A[1] + ... + A[blockSize-1] */
+    sum += in;
+
+    /* C = A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1] */
+    power += ((q15_t) in * in);
+
+    if (extrema != 0U)
+    {
+      /* compare for the extrema and update their index */
+      if (in < minVal)
+      {
+        minVal = in;
+        minIndex = blockSize - blkCnt;
+      }
+      if (in > maxVal)
+      {
+        maxVal = in;
+        maxIndex = blockSize - blkCnt;
+      }
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Mean in 1.7 format */
+  mean = sum / (q31_t) blockSize;
+
+  if ((statsFlags & (uint32_t) ARM_STATS_MEAN) != 0U)
+  {
+    pResult->mean = (q7_t) mean;
+  }
+
+  if ((statsFlags & ((uint32_t) ARM_STATS_VAR | (uint32_t) ARM_STATS_STD)) != 0U)
+  {
+    if (blockSize > 1U)
+    {
+      /* C = (sum(x^2) - sum(x) * mean) / (blockSize - 1), computed in 2.14 format */
+      var = (power - sum * mean) / (q31_t) (blockSize - 1U);
+    }
+    else
+    {
+      var = 0;
+    }
+
+    if ((statsFlags & (uint32_t) ARM_STATS_VAR) != 0U)
+    {
+      /* Truncate and saturate the 2.14 variance to 1.7 format */
+      pResult->var = (q7_t) __SSAT(var >> 7U, 8);
+    }
+
+    if ((statsFlags & (uint32_t) ARM_STATS_STD) != 0U)
+    {
+      /* Square root of the variance in 1.15 format, truncated to 1.7 format */
+      arm_sqrt_q15((q15_t) __SSAT(var << 1U, 16), &sqrtOut);
+      pResult->std = (q7_t) (sqrtOut >> 8);
+    }
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_POWER) != 0U)
+  {
+    /* Store the power in 18.14 format */
+    pResult->power = power;
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_RMS) != 0U)
+  {
+    /* Square root of the 2.14 mean of squares in 1.15 format, truncated to 1.7 format */
+    arm_sqrt_q15((q15_t) __SSAT((power / (q31_t) blockSize) << 1U, 16), &sqrtOut);
+    pResult->rms = (q7_t) (sqrtOut >> 8);
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_MIN) != 0U)
+  {
+    pResult->min = minVal;
+    pResult->minIndex = minIndex;
+  }
+
+  if ((statsFlags & (uint32_t) ARM_STATS_MAX) != 0U)
+  {
+    pResult->max = maxVal;
+    pResult->maxIndex = maxIndex;
+  }
+}
+
+/**
+ * @} end of Stats group
+ */
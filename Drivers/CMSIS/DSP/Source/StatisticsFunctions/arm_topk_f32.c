@@ -0,0 +1,200 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_topk_f32.c
+ * Description:  Largest elements of a floating-point vector and their indices
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup TopK Top-K Selection
+ *
+ * Returns the <code>k</code> largest elements of a vector in descending order,
+ * together with their indices in the input vector.  Equal elements are returned
+ * in the order of their indices, so the result is the same as a stable sort
+ * in descending order truncated to <code>k</code> elements.
+ *
+ * The functions keep a sorted list of the <code>k</code> best candidates in the
+ * output buffers.  A sample that is not greater than the smallest candidate is
+ * rejected with a single comparison, which is the common case once the list is
+ * filled.  The input vector is not modified and no other memory is used.
+ *
+ * The functions are intended for small values of <code>k</code>, such as the
+ * top-5 classes of a classifier.  The Q7 version can be applied directly to the
+ * output of <code>arm_softmax_q7()</code>; on Cortex-M4 and Cortex-M7 it rejects
+ * four samples at a time with a SIMD comparison.
+ * The worst case, an input sorted in ascending order, costs <code>k</code>
+ * moves per sample.
+ *
+ * There are separate functions for floating-point, Q15, and Q7 data types.
+ */
+
+/**
+ * @addtogroup TopK
+ * @{
+ */
+
+/**
+ * @brief Inserts a new candidate in the sorted list of the largest elements.
+ * @param[in,out]   *pDst points to the candidate values in descending order
+ * @param[in,out]   *pIndex points to the candidate indices
+ * @param[in]       pos position of the free slot at the end of the list
+ * @param[in]       value value of the new candidate
+ * @param[in]       index index of the new candidate
+ * @return none.
+ */
+static void arm_topk_insert_f32(
+  float32_t * pDst,
+  uint32_t * pIndex,
+  uint32_t pos,
+  float32_t value,
+  uint32_t index)
+{
+  /* Move the lower candidates down.  Equal candidates have a lower index and stay in front. */
+  while ((pos > 0U) && (pDst[pos - 1U] < value))
+  {
+    pDst[pos] = pDst[pos - 1U];
+    pIndex[pos] = pIndex[pos - 1U];
+    pos--;
+  }
+
+  pDst[pos] = value;
+  pIndex[pos] = index;
+}
+
+/**
+ * @brief Largest elements of a floating-point vector and their indices.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       k number of elements to return, between 1 and blockSize
+ * @param[out]      *pDst points to the k largest elements in descending order
+ * @param[out]      *pIndex points to the indices of the k largest elements
+ * @return none.
+ */
+
+void arm_topk_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pDst,
+  uint32_t * pIndex)
+{
+  float32_t threshold;                           /* Smallest of the current candidates */
+  float32_t in;                                  /* Temporary variable */
+  uint32_t i;                                    /* Index of the current sample */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+  uint32_t j;                                    /* Index within a group of samples */
+#endif
+
+  if (k == 0U)
+  {
+    return;
+  }
+
+  /* The first k samples fill the list of candidates */
+  for (i = 0U; i < k; i++)
+  {
+    arm_topk_insert_f32(pDst, pIndex, i, pSrc[i], i);
+  }
+
+  threshold = pDst[k - 1U];
+  pSrc += k;
+
+#if defined (ARM_MATH_DSP)
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = (blockSize - k) >> 2U;
+
+  /* First part of the processing with loop unrolling.  Process 4 samples at a time.
+   ** a second loop below processes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    /* Most groups contain no sample greater than the smallest candidate */
+    if ((in1 > threshold) || (in2 > threshold) || (in3 > threshold) || (in4 > threshold))
+    {
+      for (j = 0U; j < 4U; j++)
+      {
+        in = pSrc[j];
+        if (in > threshold)
+        {
+          /* Replace the smallest candidate */
+          arm_topk_insert_f32(pDst, pIndex, k - 1U, in, i + j);
+          threshold = pDst[k - 1U];
+        }
+      }
+    }
+
+    pSrc += 4U;
+    i += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the number of remaining samples is not a multiple of 4, process them here.
+   ** No loop unrolling is used. */
+  blkCnt = (blockSize - k) % 0x4U;
+
+#else
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over the remaining samples */
+  blkCnt = blockSize - k;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (in > threshold)
+    {
+      /* Replace the smallest candidate */
+      arm_topk_insert_f32(pDst, pIndex, k - 1U, in, i);
+      threshold = pDst[k - 1U];
+    }
+
+    i++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of TopK group
+ */
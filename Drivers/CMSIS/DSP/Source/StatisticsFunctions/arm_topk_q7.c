@@ -0,0 +1,185 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_topk_q7.c
+ * Description:  Largest elements of a Q7 vector and their indices
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup TopK
+ * @{
+ */
+
+/**
+ * @brief Inserts a new candidate in the sorted list of the largest elements.
+ * @param[in,out]   *pDst points to the candidate values in descending order
+ * @param[in,out]   *pIndex points to the candidate indices
+ * @param[in]       pos position of the free slot at the end of the list
+ * @param[in]       value value of the new candidate
+ * @param[in]       index index of the new candidate
+ * @return none.
+ */
+static void arm_topk_insert_q7(
+  q7_t * pDst,
+  uint32_t * pIndex,
+  uint32_t pos,
+  q7_t value,
+  uint32_t index)
+{
+  /* Move the lower candidates down.  Equal candidates have a lower index and stay in front. */
+  while ((pos > 0U) && (pDst[pos - 1U] < value))
+  {
+    pDst[pos] = pDst[pos - 1U];
+    pIndex[pos] = pIndex[pos - 1U];
+    pos--;
+  }
+
+  pDst[pos] = value;
+  pIndex[pos] = index;
+}
+
+/**
+ * @brief Largest elements of a Q7 vector and their indices.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       k number of elements to return, between 1 and blockSize
+ * @param[out]      *pDst points to the k largest elements in descending order
+ * @param[out]      *pIndex points to the indices of the k largest elements
+ * @return none.
+ *
+ * \par
+ * The output of <code>arm_softmax_q7()</code> can be passed directly as
+ * <code>pSrc</code> to obtain the most probable classes and their scores.
+ */
+
+void arm_topk_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q7_t * pDst,
+  uint32_t * pIndex)
+{
+  q7_t threshold;                                /* Smallest of the current candidates */
+  q7_t in;                                       /* Temporary variable */
+  uint32_t i;                                    /* Index of the current sample */
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (ARM_MATH_DSP)
+  q31_t in4;                                     /* Four packed input samples */
+  q31_t threshold4;                              /* Smallest candidate replicated in the four bytes */
+  uint32_t j;                                    /* Index within a group of samples */
+#endif
+
+  if (k == 0U)
+  {
+    return;
+  }
+
+  /* The first k samples fill the list of candidates */
+  for (i = 0U; i < k; i++)
+  {
+    arm_topk_insert_q7(pDst, pIndex, i, pSrc[i], i);
+  }
+
+  threshold = pDst[k - 1U];
+  pSrc += k;
+
+#if defined (ARM_MATH_DSP)
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  threshold4 = (q31_t) ((uint32_t) (uint8_t) threshold * 0x01010101U);
+
+  /* Loop unrolling */
+  blkCnt = (blockSize - k) >> 2U;
+
+  /* First part of the processing with loop unrolling.  Process 4 samples at a time.
+   ** a second loop below processes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* Read four samples at a time */
+    in4 = *__SIMD32_CONST(pSrc);
+
+    /* threshold - x saturates per byte and is negative only where x > threshold.
+     * Most groups contain no such sample and are rejected at once. */
+    if (((uint32_t) __QSUB8(threshold4, in4) & 0x80808080U) != 0U)
+    {
+      for (j = 0U; j < 4U; j++)
+      {
+        in = pSrc[j];
+        if (in > threshold)
+        {
+          /* Replace the smallest candidate */
+          arm_topk_insert_q7(pDst, pIndex, k - 1U, in, i + j);
+          threshold = pDst[k - 1U];
+        }
+      }
+
+      threshold4 = (q31_t) ((uint32_t) (uint8_t) threshold * 0x01010101U);
+    }
+
+    pSrc += 4U;
+    i += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the number of remaining samples is not a multiple of 4, process them here.
+   ** No loop unrolling is used. */
+  blkCnt = (blockSize - k) % 0x4U;
+
+#else
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over the remaining samples */
+  blkCnt = blockSize - k;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (in > threshold)
+    {
+      /* Replace the smallest candidate */
+      arm_topk_insert_q7(pDst, pIndex, k - 1U, in, i);
+      threshold = pDst[k - 1U];
+    }
+
+    i++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of TopK group
+ */
@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_adc_dual_to_q15.c
+ * Description:  Unpacks dual mode ADC words to two Q15 vectors
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup interleave
+ * @{
+ */
+
+/**
+ * @brief Unpacks dual mode ADC words to two Q15 vectors.
+ * @param[in]       *pSrc points to the packed words, first ADC in bits [15:0] and second ADC in bits [31:16]
+ * @param[in]       resolution number of bits of the ADC samples, 1 to 16
+ * @param[out]      *pDstA points to the output vector of the first ADC
+ * @param[out]      *pDstB points to the output vector of the second ADC
+ * @param[in]       blockSize number of words to unpack
+ * @return none.
+ *
+ * \par
+ * The samples are unsigned and right aligned: they must be lower than <code>2^resolution</code>.
+ * Mid-scale is mapped to zero, each sample is converted as:
+ * <pre>
+ *     pDstA[n] = (q15_t) ((pSrc[n] & 0xFFFF) - 2^(resolution - 1)) << (16 - resolution);
+ * </pre>
+ * Left aligned samples are converted with a resolution of 16.
+ * \par
+ * Both half-words are converted together: a shift moves both samples to the top
+ * of their half-word, and flipping the two sign bits removes the mid-scale offset.
+ */
+
+void arm_adc_dual_to_q15(
+  uint32_t * pSrc,
+  uint32_t resolution,
+  q15_t * pDstA,
+  q15_t * pDstB,
+  uint32_t blockSize)
+{
+  uint32_t shift = 16U - resolution;             /* shift to the top of the half-words */
+  uint32_t blkCnt;                               /* loop counter */
+  uint32_t in;                                   /* converted word */
+
+#if defined (ARM_MATH_DSP)
+
+  uint32_t in1, in2, in3, in4;                   /* converted words */
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* Convert both samples of four words */
+    in1 = (*pSrc++ << shift) ^ 0x80008000U;
+    in2 = (*pSrc++ << shift) ^ 0x80008000U;
+    in3 = (*pSrc++ << shift) ^ 0x80008000U;
+    in4 = (*pSrc++ << shift) ^ 0x80008000U;
+
+    /* Regroup the samples per ADC, two per word */
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    *__SIMD32(pDstA)++ = __PKHBT(in1, in2, 16);
+    *__SIMD32(pDstB)++ = __PKHTB(in2, in1, 16);
+    *__SIMD32(pDstA)++ = __PKHBT(in3, in4, 16);
+    *__SIMD32(pDstB)++ = __PKHTB(in4, in3, 16);
+
+#else
+
+    *__SIMD32(pDstA)++ = __PKHBT(in2, in1, 16);
+    *__SIMD32(pDstB)++ = __PKHTB(in1, in2, 16);
+    *__SIMD32(pDstA)++ = __PKHBT(in4, in3, 16);
+    *__SIMD32(pDstB)++ = __PKHTB(in3, in4, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* Convert both samples of the word */
+    in = (*pSrc++ << shift) ^ 0x80008000U;
+
+    *pDstA++ = (q15_t) in;
+    *pDstB++ = (q15_t) (in >> 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of interleave group
+ */
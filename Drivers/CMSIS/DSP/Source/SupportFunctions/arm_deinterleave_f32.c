@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_deinterleave_f32.c
+ * Description:  Floating-point interleaved to planar conversion
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup interleave
+ * @{
+ */
+
+/**
+ * @brief Deinterleaves a multi-channel floating-point buffer.
+ * @param[in]       *pSrc points to the interleaved input buffer, blockSize frames of numChannels samples
+ * @param[in]       numChannels number of channels
+ * @param[out]      *pDst points to the planar output buffer, numChannels * blockSize samples
+ * @param[in]       blockSize number of samples in each channel
+ * @return none.
+ *
+ */
+
+void arm_deinterleave_f32(
+  float32_t * pSrc,
+  uint32_t numChannels,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t ch;                                   /* channel counter */
+  uint32_t blkCnt;                               /* loop counter */
+  float32_t *pIn;                                /* input pointer */
+  float32_t *pOut = pDst;                        /* output pointer */
+
+  for (ch = 0U; ch < numChannels; ch++)
+  {
+    pIn = pSrc + ch;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+    /* Loop unrolling */
+    blkCnt = blockSize >> 2U;
+
+    /* First part of the processing with loop unrolling.  Copy 4 samples of the channel at a time.
+     ** a second loop below copies the remaining 1 to 3 samples. */
+    while (blkCnt > 0U)
+    {
+      /* C[ch * blockSize + n] = A[n * numChannels + ch] */
+      pOut[0] = pIn[0];
+      pOut[1] = pIn[numChannels];
+      pOut[2] = pIn[2U * numChannels];
+      pOut[3] = pIn[3U * numChannels];
+
+      /* Update the pointers to process the next frames */
+      pIn += 4U * numChannels;
+      pOut += 4U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, copy the remaining samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over blockSize number of values */
+    blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      *pOut++ = *pIn;
+      pIn += numChannels;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of interleave group
+ */
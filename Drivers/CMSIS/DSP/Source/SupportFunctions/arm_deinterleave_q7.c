@@ -0,0 +1,182 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_deinterleave_q7.c
+ * Description:  Q7 interleaved to planar conversion
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup interleave
+ * @{
+ */
+
+/**
+ * @brief Deinterleaves a multi-channel Q7 buffer.
+ * @param[in]       *pSrc points to the interleaved input buffer, blockSize frames of numChannels samples
+ * @param[in]       numChannels number of channels
+ * @param[out]      *pDst points to the planar output buffer, numChannels * blockSize samples
+ * @param[in]       blockSize number of samples in each channel
+ * @return none.
+ *
+ * \par
+ * With two channels the samples are moved four at a time with the packing instructions.
+ */
+
+void arm_deinterleave_q7(
+  q7_t * pSrc,
+  uint32_t numChannels,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t ch;                                   /* channel counter */
+  uint32_t blkCnt;                               /* loop counter */
+  q7_t *pIn;                                     /* input pointer */
+  q7_t *pOut = pDst;                             /* output pointer */
+
+#if defined (ARM_MATH_DSP)
+
+  q7_t *pOut0, *pOut1;                           /* output pointers of the two channels */
+  q31_t in1, in2;                                /* temporary variables */
+  q31_t lo, hi;                                  /* half-word regrouped words */
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  if (numChannels == 2U)
+  {
+    pOut0 = pDst;
+    pOut1 = pDst + blockSize;
+
+    /* Loop unrolling */
+    blkCnt = blockSize >> 2U;
+
+    /* Each word holds two frames: the half-words are first regrouped in
+     ** frames 0 and 2 and frames 1 and 3, then the bytes are regrouped per channel */
+    while (blkCnt > 0U)
+    {
+      /* Read four frames */
+      in1 = *__SIMD32(pSrc)++;
+      in2 = *__SIMD32(pSrc)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      lo = __PKHBT(in1, in2, 16);
+      hi = __PKHTB(in2, in1, 16);
+
+      *__SIMD32(pOut0)++ = (lo & 0x00FF00FF) | ((hi << 8) & 0xFF00FF00);
+      *__SIMD32(pOut1)++ = ((lo >> 8) & 0x00FF00FF) | (hi & 0xFF00FF00);
+
+#else
+
+      lo = __PKHTB(in1, in2, 16);
+      hi = __PKHBT(in2, in1, 16);
+
+      *__SIMD32(pOut0)++ = (lo & 0xFF00FF00) | ((hi >> 8) & 0x00FF00FF);
+      *__SIMD32(pOut1)++ = ((lo << 8) & 0xFF00FF00) | (hi & 0x00FF00FF);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, copy the remaining frames here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4U;
+
+    while (blkCnt > 0U)
+    {
+      *pOut0++ = *pSrc++;
+      *pOut1++ = *pSrc++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  for (ch = 0U; ch < numChannels; ch++)
+  {
+    pIn = pSrc + ch;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+    /* Loop unrolling */
+    blkCnt = blockSize >> 2U;
+
+    /* First part of the processing with loop unrolling.  Copy 4 samples of the channel at a time.
+     ** a second loop below copies the remaining 1 to 3 samples. */
+    while (blkCnt > 0U)
+    {
+      /* C[ch * blockSize + n] = A[n * numChannels + ch] */
+      pOut[0] = pIn[0];
+      pOut[1] = pIn[numChannels];
+      pOut[2] = pIn[2U * numChannels];
+      pOut[3] = pIn[3U * numChannels];
+
+      /* Update the pointers to process the next frames */
+      pIn += 4U * numChannels;
+      pOut += 4U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, copy the remaining samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over blockSize number of values */
+    blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      *pOut++ = *pIn;
+      pIn += numChannels;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of interleave group
+ */
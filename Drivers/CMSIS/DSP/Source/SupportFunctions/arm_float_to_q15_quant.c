@@ -0,0 +1,188 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_float_to_q15_quant.c
+ * Description:  Converts a floating-point vector to Q15 with rounding, dither or noise shaping
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup quantize
+ * @{
+ */
+
+/**
+ * @brief  Triangular probability density dither in [-1 1), from two linear congruential steps.
+ * @param[in,out]   *pSeed points to the state of the generator
+ * @return dither value, in LSB.
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_quant_tpdf_q15(
+  uint32_t * pSeed)
+{
+  uint32_t r1, r2;                               /* Uniform random values */
+
+  r1 = (*pSeed * 1664525U) + 1013904223U;
+  r2 = (r1 * 1664525U) + 1013904223U;
+  *pSeed = r2;
+
+  /* Sum of the two upper halves, each uniform in [-0.5 0.5) */
+  return (((float32_t) ((int32_t) r1 >> 16) + (float32_t) ((int32_t) r2 >> 16)) * (1.0f / 65536.0f));
+}
+
+/**
+ * @brief  Rounds to the nearest integer and saturates.
+ * @param[in]       u value to round, in LSB
+ * @return rounded value.
+ */
+CMSIS_INLINE __STATIC_INLINE q31_t arm_quant_round_q15(
+  float32_t u)
+{
+  u += (u > 0.0f) ? 0.5f : -0.5f;
+  u = (u > 32767.0f) ? 32767.0f : u;
+  u = (u < -32768.0f) ? -32768.0f : u;
+
+  return ((q31_t) u);
+}
+
+/**
+ * @brief  Scales and converts a floating-point vector to Q15 with rounding, dither or noise shaping.
+ * @param[in,out]   *S points to an instance of the converter structure
+ * @param[in]       *pSrc points to the floating-point input vector
+ * @param[out]      *pDst points to the Q15 output vector
+ * @param[in]       blockSize length of the input vector
+ * @return none.
+ *
+ * \par Description:
+ * <pre>
+ *    pDst[n] = (q15_t) quantize(pSrc[n] * scale * 32768);   0 <= n < blockSize.  </pre>
+ * \par Scaling and Overflow Behavior:
+ * The function saturates to the Q15 range [0x8000 0x7FFF].  The noise shaping error is bounded
+ * to +/- 2 LSB, so that a saturated block does not make the error feedback diverge.
+ */
+
+void arm_float_to_q15_quant(
+  arm_quant_instance_f32 * S,
+  float32_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t scale = S->scale * 32768.0f;         /* Scale to the output LSB */
+  float32_t u, e, e1, e2;                        /* Shaped value and quantization errors */
+  uint32_t seed = S->seed;                       /* Dither generator state */
+  uint32_t blkCnt;                               /* loop counter */
+  q31_t y;                                       /* Quantized value */
+
+  if (S->mode == ARM_QUANT_SHAPED)
+  {
+    e1 = S->err[0];
+    e2 = S->err[1];
+
+    for (blkCnt = blockSize; blkCnt > 0U; blkCnt--)
+    {
+      /* u[n] = x[n] * scale - 2 * e[n-1] + e[n-2] */
+      u = (*pSrc++ * scale) - (2.0f * e1) + e2;
+
+      /* y[n] = round(u[n] + d[n]), e[n] = y[n] - u[n] */
+      y = arm_quant_round_q15(u + arm_quant_tpdf_q15(&seed));
+      e = (float32_t) y - u;
+      e = (e > 2.0f) ? 2.0f : ((e < -2.0f) ? -2.0f : e);
+
+      e2 = e1;
+      e1 = e;
+      *pDst++ = (q15_t) y;
+    }
+
+    S->err[0] = e1;
+    S->err[1] = e2;
+  }
+  else if (S->mode == ARM_QUANT_TPDF)
+  {
+    for (blkCnt = blockSize; blkCnt > 0U; blkCnt--)
+    {
+      /* y[n] = round(x[n] * scale + d[n]) */
+      u = *pSrc++ * scale;
+      *pDst++ = (q15_t) arm_quant_round_q15(u + arm_quant_tpdf_q15(&seed));
+    }
+  }
+  else
+  {
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+    /* Loop unrolling */
+    blkCnt = blockSize >> 2U;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while (blkCnt > 0U)
+    {
+      /* C = round(A * scale * 32768) */
+      pDst[0] = (q15_t) arm_quant_round_q15(pSrc[0] * scale);
+      pDst[1] = (q15_t) arm_quant_round_q15(pSrc[1] * scale);
+      pDst[2] = (q15_t) arm_quant_round_q15(pSrc[2] * scale);
+      pDst[3] = (q15_t) arm_quant_round_q15(pSrc[3] * scale);
+
+      pSrc += 4U;
+      pDst += 4U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over blockSize number of values */
+    blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      /* C = round(A * scale * 32768) */
+      *pDst++ = (q15_t) arm_quant_round_q15(*pSrc++ * scale);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  S->seed = seed;
+}
+
+/**
+ * @} end of quantize group
+ */
@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_interleave_f32.c
+ * Description:  Floating-point planar to interleaved conversion
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup interleave Interleave and Deinterleave
+ *
+ * Converts between interleaved multi-channel data, as produced by I2S and SAI
+ * peripherals or by scanning ADC sequences, and planar data with one buffer per
+ * channel, as expected by the rest of the library.
+ *
+ * The interleaved buffer holds <code>blockSize</code> frames of
+ * <code>numChannels</code> samples.  The planar buffer holds the channels one
+ * after the other, each <code>blockSize</code> samples long:
+ * <pre>
+ *     planar[ch * blockSize + n] = interleaved[n * numChannels + ch];   0 <= ch < numChannels, 0 <= n < blockSize.
+ * </pre>
+ *
+ * Any number of channels is supported.  With two channels the Q15 and Q7
+ * functions move two and four samples per 32-bit word with the packing
+ * instructions, which covers stereo audio and dual ADC data.
+ *
+ * arm_adc_dual_to_q15() unpacks the 32-bit words written by two ADCs in dual
+ * mode, the first ADC in the low half-word and the second in the high half-word,
+ * and converts the unsigned samples to Q15.
+ *
+ * There are separate functions for floating point, Q31, Q15, and Q7 data types.
+ */
+
+/**
+ * @addtogroup interleave
+ * @{
+ */
+
+/**
+ * @brief Interleaves the channels of a planar floating-point buffer.
+ * @param[in]       *pSrc points to the planar input buffer, numChannels * blockSize samples
+ * @param[in]       numChannels number of channels
+ * @param[out]      *pDst points to the interleaved output buffer, blockSize frames of numChannels samples
+ * @param[in]       blockSize number of samples in each channel
+ * @return none.
+ *
+ */
+
+void arm_interleave_f32(
+  float32_t * pSrc,
+  uint32_t numChannels,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t ch;                                   /* channel counter */
+  uint32_t blkCnt;                               /* loop counter */
+  float32_t *pIn = pSrc;                         /* input pointer */
+  float32_t *pOut;                               /* output pointer */
+
+  for (ch = 0U; ch < numChannels; ch++)
+  {
+    pOut = pDst + ch;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+    /* Loop unrolling */
+    blkCnt = blockSize >> 2U;
+
+    /* First part of the processing with loop unrolling.  Copy 4 samples of the channel at a time.
+     ** a second loop below copies the remaining 1 to 3 samples. */
+    while (blkCnt > 0U)
+    {
+      /* C[n * numChannels + ch] = A[ch * blockSize + n] */
+      pOut[0] = pIn[0];
+      pOut[numChannels] = pIn[1];
+      pOut[2U * numChannels] = pIn[2];
+      pOut[3U * numChannels] = pIn[3];
+
+      /* Update the pointers to process the next frames */
+      pIn += 4U;
+      pOut += 4U * numChannels;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, copy the remaining samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over blockSize number of values */
+    blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      *pOut = *pIn++;
+      pOut += numChannels;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of interleave group
+ */
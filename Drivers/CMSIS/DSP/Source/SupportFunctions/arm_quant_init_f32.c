@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_quant_init_f32.c
+ * Description:  Initialization function for the floating-point to fixed-point block converters
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup quantize Convert with Rounding, Dither and Noise Shaping
+ *
+ * Scale and convert a floating-point vector to Q15 or Q31 in a single pass,
+ * with a selectable quantization:
+ *
+ * - <code>ARM_QUANT_ROUND</code> rounds to the nearest value.
+ * - <code>ARM_QUANT_TPDF</code> adds a triangular probability density dither of
+ *   +/- 1 LSB before rounding.  The quantization error is then white and
+ *   independent of the signal, which removes the harmonic distortion of low
+ *   level signals at the cost of 4.8 dB of noise.
+ * - <code>ARM_QUANT_SHAPED</code> adds the same dither and feeds the quantization
+ *   error back through a second order filter.  The noise transfer function is
+ *   <code>(1 - z^-1)^2</code>: the noise falls by 12 dB per octave towards low frequencies,
+ *   and rises at high frequencies.
+ *
+ * The functions replace the sequence of arm_scale_f32() and arm_float_to_q15()
+ * or arm_float_to_q31(), for example before an audio codec: the input is read once.
+ * The outputs saturate.
+ *
+ * \par Algorithm
+ * <pre>
+ *    u[n] = pSrc[n] * scale * 2^B - 2 * e[n-1] + e[n-2]
+ *    y[n] = round(u[n] + d[n])
+ *    e[n] = y[n] - u[n]  </pre>
+ * \par
+ * where <code>B</code> is the number of fractional bits of the output and <code>d[n]</code>
+ * is the dither, the sum of two uniform random values in [-0.5 0.5).  The error feedback
+ * is only used in the noise shaped mode, the dither in the TPDF and noise shaped modes.
+ *
+ * \par
+ * The floating-point input has a 24-bit mantissa: in the dithered modes the Q31 output is
+ * quantized to 24 bits (B = 23) and its low 8 bits are zero, which matches the 24-bit
+ * audio formats.  In the rounding mode all the 32 bits are used.
+ *
+ * \par Instance Structure
+ * The quantization mode, the scale, the state of the dither generator and the noise shaping state
+ * are stored in an instance data structure, which keeps the state between the blocks of a stream.
+ */
+
+/**
+ * @addtogroup quantize
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point to fixed-point block converters.
+ * @param[out] *S     points to an instance of the converter structure.
+ * @param[in]  mode   quantization mode.
+ * @param[in]  scale  scale applied to the input before the conversion.
+ * @param[in]  seed   initial state of the dither generator.
+ * @return none.
+ * \par Description:
+ * The function also clears the noise shaping state.  Different channels of the same stream should
+ * use different seeds so that their dither is not correlated.
+ */
+
+void arm_quant_init_f32(
+  arm_quant_instance_f32 * S,
+  arm_quant_mode mode,
+  float32_t scale,
+  uint32_t seed)
+{
+  S->mode = mode;
+  S->scale = scale;
+  S->seed = seed;
+  S->err[0] = 0.0f;
+  S->err[1] = 0.0f;
+}
+
+/**
+ * @} end of quantize group
+ */
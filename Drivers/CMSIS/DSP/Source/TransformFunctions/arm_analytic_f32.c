@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_analytic_f32.c
+ * Description:  FFT-based analytic signal of a real block
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup AnalyticSignal Analytic Signal
+ *
+ * Computes the analytic signal <code>x + j H{x}</code> of a block of real data with an FFT.
+ *
+ * \par
+ * The spectrum of the block is computed with arm_rfft_fast_f32(), its negative frequencies
+ * are cleared and its positive frequencies doubled, and the complex inverse FFT of the
+ * result is computed with arm_cfft_f32().  DC and Nyquist are kept unchanged.  The real part
+ * of the output is the input, to the rounding errors, and the imaginary part its Hilbert
+ * transform.
+ *
+ * \par
+ * The transform is circular: the block is treated as one period of a periodic signal,
+ * so a discontinuity between the last and the first samples spreads to both ends of the
+ * output.  For a stream, either overlap the blocks and discard the edges, or use the FIR
+ * Hilbert transformer arm_hilbert_f32().  For a whole block, this function is exact and
+ * costs one real FFT and one complex FFT of the same length.
+ */
+
+/**
+ * @addtogroup AnalyticSignal
+ * @{
+ */
+
+/**
+ * @brief  Floating-point analytic signal of a block of real data.
+ * @param[in]       *S points to an instance of the floating-point analytic signal structure.
+ * @param[in]       *pSrc points to the fftLen real input samples. Modified by this function.
+ * @param[out]      *pDst points to the fftLen complex output samples, 2 * fftLen values.
+ * @return none.
+ */
+
+void arm_analytic_f32(
+  arm_analytic_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst)
+{
+  uint32_t fftLen = S->fftLen;                   /* Length of the block */
+  float32_t nyquist;                             /* Real part of the Nyquist bin */
+
+  /* Spectrum of the positive frequencies, in the first fftLen values */
+  arm_rfft_fast_f32(&S->rfft, pSrc, pDst, 0U);
+
+  /* The imaginary part of bin 0 holds the Nyquist bin */
+  nyquist = pDst[1];
+  pDst[1] = 0.0f;
+
+  /* Double the bins 1 to fftLen / 2 - 1 */
+  arm_scale_f32(pDst + 2U, 2.0f, pDst + 2U, fftLen - 2U);
+
+  /* Nyquist bin, then zeros for the negative frequencies */
+  pDst[fftLen] = nyquist;
+  arm_fill_f32(0.0f, pDst + (fftLen + 1U), fftLen - 1U);
+
+  /* Inverse complex FFT, scaled by 1 / fftLen */
+  arm_cfft_f32(S->pCfft, pDst, 1U, 1U);
+}
+
+/**
+ * @} end of AnalyticSignal group
+ */
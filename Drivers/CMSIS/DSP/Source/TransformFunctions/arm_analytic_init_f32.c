@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_analytic_init_f32.c
+ * Description:  Initialization function for the FFT-based analytic signal
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup AnalyticSignal
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point analytic signal.
+ * @param[in,out]   *S points to an instance of the floating-point analytic signal structure.
+ * @param[in]       fftLen length of the blocks, a power of 2 from 32 to 4096.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not a supported length.
+ */
+
+arm_status arm_analytic_init_f32(
+  arm_analytic_instance_f32 * S,
+  uint16_t fftLen)
+{
+  /* Complex FFT of the same length for the inverse transform */
+  switch (fftLen)
+  {
+  case 32U:
+    S->pCfft = &arm_cfft_sR_f32_len32;
+    break;
+  case 64U:
+    S->pCfft = &arm_cfft_sR_f32_len64;
+    break;
+  case 128U:
+    S->pCfft = &arm_cfft_sR_f32_len128;
+    break;
+  case 256U:
+    S->pCfft = &arm_cfft_sR_f32_len256;
+    break;
+  case 512U:
+    S->pCfft = &arm_cfft_sR_f32_len512;
+    break;
+  case 1024U:
+    S->pCfft = &arm_cfft_sR_f32_len1024;
+    break;
+  case 2048U:
+    S->pCfft = &arm_cfft_sR_f32_len2048;
+    break;
+  case 4096U:
+    S->pCfft = &arm_cfft_sR_f32_len4096;
+    break;
+  default:
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->fftLen = fftLen;
+
+  /* Real FFT for the forward transform */
+  return (arm_rfft_fast_init_f32(&S->rfft, fftLen));
+}
+
+/**
+ * @} end of AnalyticSignal group
+ */
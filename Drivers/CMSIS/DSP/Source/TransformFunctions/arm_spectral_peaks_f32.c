@@ -0,0 +1,243 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spectral_peaks_f32.c
+ * Description:  Spectral peak detection with sub-bin interpolation
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup spectral_peaks Spectral Peak Detection
+ *
+ * Finds the highest local maxima of a magnitude spectrum and refines the frequency
+ * and the amplitude of each of them to a fraction of a bin.
+ *
+ * \par
+ * A bin <code>k</code> is a peak when its magnitude is above the threshold of the instance,
+ * strictly greater than the magnitude of bin <code>k-1</code> and not less than the magnitude
+ * of bin <code>k+1</code>.  The first and the last bins are never peaks.  The peaks are
+ * returned by decreasing magnitude of their bin.
+ *
+ * \par
+ * The offset of the tone from the peak bin is estimated from the bins <code>k-1</code>,
+ * <code>k</code> and <code>k+1</code> with one of the following methods:
+ * - <code>ARM_PEAK_INTERP_PARABOLIC</code>: vertex of the parabola through the three magnitudes.
+ * Only uses <code>pMag</code>.
+ * - <code>ARM_PEAK_INTERP_JACOBSEN</code>: real part of <code>(X[k-1] - X[k+1]) / (2 X[k] - X[k-1] - X[k+1])</code>
+ * on the complex bins.
+ * - <code>ARM_PEAK_INTERP_QUINN</code>: second estimator of Quinn on the complex bins.
+ *
+ * \par
+ * None of these estimators is unbiased for a windowed or zero padded frame: the raw estimate
+ * is corrected with an odd polynomial fitted for the window and the zero padding factor
+ * given to arm_spectral_peaks_init_f32().  The magnitude of the peak bin is then corrected
+ * for the scalloping loss of the window at the estimated offset.
+ *
+ * \par
+ * The windows are the periodic windows of length <code>N</code>, the number of data samples:
+ * <pre>
+ *     Hann            w[n] = 0.5 - 0.5 cos(2 pi n / N)
+ *     Hamming         w[n] = 0.54 - 0.46 cos(2 pi n / N)
+ *     Blackman-Harris w[n] = 0.35875 - 0.48829 cos(2 pi n / N) + 0.14128 cos(4 pi n / N) - 0.01168 cos(6 pi n / N)
+ * </pre>
+ * The frame is zero padded at the end to <code>N * padFactor</code> samples before the FFT.
+ *
+ * \par Accuracy
+ * For frames of at least 256 samples and a tone away from the other tones and from DC and
+ * Nyquist, the error on the frequency is less than 0.002 bin and the error on the amplitude
+ * is less than 0.15%.  The parabolic method without zero padding on the rectangular window is
+ * the exception: its errors reach 0.11 bin and 16%.  Shorter frames increase the errors, up to
+ * about 0.004 bin for 64 samples.
+ *
+ * \par Spectrum format
+ * <code>pSpectrum</code> holds <code>numBins</code> complex values in the format of the output of
+ * arm_rfft_fast_f32(): the imaginary part of bin 0 holds the real part of the Nyquist bin and is
+ * ignored.  <code>pMag[0]</code> must then be the absolute value of the real part of bin 0.
+ * The amplitude of a peak is in the unit of the magnitudes: for a real sine wave of amplitude
+ * <code>A</code> it is <code>A / 2</code> times the sum of the window coefficients.
+ */
+
+/**
+ * @addtogroup spectral_peaks
+ * @{
+ */
+
+/**
+ * @brief  Correction term of the second estimator of Quinn.
+ * @param[in]       x square of a one-sided offset estimate
+ * @return tau(x).
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_spectral_peaks_tau_f32(
+  float32_t x)
+{
+  /* 1/4 log(3x^2 + 6x + 1) - sqrt(6)/24 log((x + 1 - sqrt(2/3)) / (x + 1 + sqrt(2/3))) */
+  return ((0.25f * logf((((3.0f * x) + 6.0f) * x) + 1.0f)) -
+          (0.10206207f * logf((x + 0.18350342f) / (x + 1.81649658f))));
+}
+
+/**
+ * @brief  Raw fractional offset of a peak from the three bins around it.
+ * @param[in]       method interpolation method
+ * @param[in]       *pX points to the complex bins k-1, k and k+1
+ * @param[in]       *pM points to the magnitudes of the bins k-1, k and k+1
+ * @param[in]       first nonzero when bin k-1 is bin 0
+ * @return uncorrected offset, in bins.
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_spectral_peaks_raw_f32(
+  arm_peak_interp method,
+  const float32_t * pX,
+  const float32_t * pM,
+  uint32_t first)
+{
+  float32_t aRe, aIm, bRe, bIm, cRe, cIm;        /* Bins k-1, k and k+1 */
+  float32_t nRe, nIm, dRe, dIm;                  /* Numerator and denominator */
+  float32_t den, bb, ap, am, dp, dm;             /* Temporary variables */
+
+  if (method == ARM_PEAK_INTERP_PARABOLIC)
+  {
+    den = (2.0f * pM[1]) - pM[0] - pM[2];
+    return ((den > 0.0f) ? ((0.5f * (pM[2] - pM[0])) / den) : 0.0f);
+  }
+
+  aRe = pX[0];
+  aIm = (first != 0U) ? 0.0f : pX[1];
+  bRe = pX[2];
+  bIm = pX[3];
+  cRe = pX[4];
+  cIm = pX[5];
+
+  if (method == ARM_PEAK_INTERP_JACOBSEN)
+  {
+    /* Re{(a - c) / (2b - a - c)} */
+    nRe = aRe - cRe;
+    nIm = aIm - cIm;
+    dRe = (2.0f * bRe) - aRe - cRe;
+    dIm = (2.0f * bIm) - aIm - cIm;
+    den = (dRe * dRe) + (dIm * dIm);
+    return ((den > 0.0f) ? (((nRe * dRe) + (nIm * dIm)) / den) : 0.0f);
+  }
+
+  /* Quinn: ap = Re{c / b}, am = Re{a / b} */
+  bb = (bRe * bRe) + (bIm * bIm);
+  if (bb <= 0.0f)
+  {
+    return (0.0f);
+  }
+  ap = ((cRe * bRe) + (cIm * bIm)) / bb;
+  am = ((aRe * bRe) + (aIm * bIm)) / bb;
+  dp = -ap / (1.0f - ap);
+  dm = am / (1.0f - am);
+
+  return (((dp + dm) * 0.5f) + arm_spectral_peaks_tau_f32(dp * dp) - arm_spectral_peaks_tau_f32(dm * dm));
+}
+
+/**
+ * @brief  Finds and interpolates the highest peaks of a floating-point spectrum.
+ * @param[in]       *S points to an instance of the floating-point spectral peak detector structure.
+ * @param[in]       *pSpectrum points to the complex spectrum, numBins complex values. Not used by the parabolic method.
+ * @param[in]       *pMag points to the magnitudes of the spectrum, numBins values.
+ * @param[in]       maxPeaks maximum number of peaks.
+ * @param[out]      *pFreq points to the frequencies of the peaks, in bins, maxPeaks values.
+ * @param[out]      *pAmp points to the amplitudes of the peaks, maxPeaks values.
+ * @return number of peaks found, at most <code>maxPeaks</code>.
+ */
+
+uint32_t arm_spectral_peaks_f32(
+  const arm_spectral_peaks_instance_f32 * S,
+  float32_t * pSpectrum,
+  float32_t * pMag,
+  uint32_t maxPeaks,
+  float32_t * pFreq,
+  float32_t * pAmp)
+{
+  const float32_t *pC = S->pFreqCoeffs;          /* Coefficients of the frequency correction */
+  const float32_t *pG = S->pAmpCoeffs;           /* Coefficients of the amplitude correction */
+  float32_t threshold = S->threshold;            /* Minimum magnitude of a peak */
+  float32_t m;                                   /* Magnitude of the current bin */
+  float32_t r, r2, d, d2;                        /* Raw and corrected offsets and their squares */
+  uint32_t numPeaks = 0U;                        /* Number of peaks found */
+  uint32_t k, i, bin;                            /* Loop counters and bin index */
+
+  if (maxPeaks == 0U)
+  {
+    return (0U);
+  }
+
+  /* Keep the highest local maxima, sorted by decreasing magnitude.
+   ** pFreq holds the bin indexes and pAmp the magnitudes until the interpolation. */
+  for (k = 1U; k < ((uint32_t) S->numBins - 1U); k++)
+  {
+    m = pMag[k];
+
+    if ((m > threshold) && (m > pMag[k - 1U]) && (m >= pMag[k + 1U]))
+    {
+      if ((numPeaks < maxPeaks) || (m > pAmp[numPeaks - 1U]))
+      {
+        i = (numPeaks < maxPeaks) ? numPeaks++ : (numPeaks - 1U);
+
+        /* Insertion sort */
+        while ((i > 0U) && (pAmp[i - 1U] < m))
+        {
+          pAmp[i] = pAmp[i - 1U];
+          pFreq[i] = pFreq[i - 1U];
+          i--;
+        }
+        pAmp[i] = m;
+        pFreq[i] = (float32_t) k;
+      }
+
+      /* Bin k + 1 cannot be a peak */
+      k++;
+    }
+  }
+
+  /* Interpolate the peaks */
+  for (i = 0U; i < numPeaks; i++)
+  {
+    bin = (uint32_t) pFreq[i];
+
+    r = arm_spectral_peaks_raw_f32(S->method, &pSpectrum[2U * (bin - 1U)], &pMag[bin - 1U], (bin == 1U) ? 1U : 0U);
+
+    /* d = r * (c1 + c3 r^2 + c5 r^4), in [-0.5 0.5] */
+    r2 = r * r;
+    d = r * (pC[0] + (r2 * (pC[1] + (r2 * pC[2]))));
+    d = (d > 0.5f) ? 0.5f : ((d < -0.5f) ? -0.5f : d);
+
+    /* Scalloping loss: m * (1 + g2 d^2 + g4 d^4 + g6 d^6) */
+    d2 = d * d;
+    pAmp[i] = pAmp[i] * (1.0f + (d2 * (pG[0] + (d2 * (pG[1] + (d2 * pG[2]))))));
+    pFreq[i] = (float32_t) bin + d;
+  }
+
+  return (numPeaks);
+}
+
+/**
+ * @} end of spectral_peaks group
+ */
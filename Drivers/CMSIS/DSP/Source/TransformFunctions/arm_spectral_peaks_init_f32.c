@@ -0,0 +1,196 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spectral_peaks_init_f32.c
+ * Description:  Initialization function for the floating-point spectral peak detector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup spectral_peaks
+ * @{
+ */
+
+/*
+ * Coefficients of the corrections, indexed by window and zero padding factor.
+ * The frequency offset in bins is d = r * (c[0] + c[1] * r^2 + c[2] * r^4), from the
+ * raw estimate r of the method, and the amplitude is m * (1 + a[0] * d^2 + a[1] * d^4 + a[2] * d^6),
+ * from the magnitude m of the peak bin.  Least squares fits of single tones for the
+ * periodic windows.
+ */
+static const float32_t arm_spectral_peaks_parabolic_f32[16][3] =
+{
+  { 3.369851f, -25.32747f, 65.10131f },           /* Rectangular, x1 */
+  { 1.140719f, -0.692821f, 0.5238918f },          /* Rectangular, x2 */
+  { 1.03186f, -0.1347507f, 0.02930633f },         /* Rectangular, x4 */
+  { 1.007773f, -0.03153809f, 0.00178257f },       /* Rectangular, x8 */
+  { 1.323256f, -1.915304f, 2.529532f },           /* Hann, x1 */
+  { 1.068466f, -0.3075658f, 0.1353816f },         /* Hann, x2 */
+  { 1.016399f, -0.06762515f, 0.00812272f },       /* Hann, x4 */
+  { 1.004056f, -0.01634907f, 0.0005024657f },     /* Hann, x8 */
+  { 1.43543f, -2.801518f, 4.324129f },            /* Hamming, x1 */
+  { 1.088865f, -0.4113804f, 0.2249062f },         /* Hamming, x2 */
+  { 1.021053f, -0.0875497f, 0.01336256f },        /* Hamming, x4 */
+  { 1.005192f, -0.02097544f, 0.0008244844f },     /* Hamming, x8 */
+  { 1.197136f, -1.045632f, 1.04f },               /* Blackman-Harris, x1 */
+  { 1.044853f, -0.1945074f, 0.06055486f },        /* Blackman-Harris, x2 */
+  { 1.010938f, -0.04467889f, 0.003711571f },      /* Blackman-Harris, x4 */
+  { 1.002717f, -0.010927f, 0.0002308212f }        /* Blackman-Harris, x8 */
+};
+
+static const float32_t arm_spectral_peaks_jacobsen_f32[16][3] =
+{
+  { 1.000013f, -1.255032e-05f, 0.0f },            /* Rectangular, x1 */
+  { 2.469694f, 0.7525535f, 1.613665f },           /* Rectangular, x2 */
+  { 3.538125f, 1.154787f, 1.588281f },            /* Rectangular, x4 */
+  { 3.878871f, 0.4319618f, 0.1842444f },          /* Rectangular, x8 */
+  { 2.0f, 0.0f, 0.0f },                           /* Hann, x1 */
+  { 4.163739f, 0.1997698f, 0.2436499f },          /* Hann, x2 */
+  { 5.211736f, 0.3677367f, 0.1989797f },          /* Hann, x4 */
+  { 5.519439f, 0.1330479f, 0.02145884f },         /* Hann, x8 */
+  { 1.81177f, 0.1253127f, 0.03855286f },          /* Hamming, x1 */
+  { 3.651112f, 0.2516487f, 0.0806233f },          /* Hamming, x2 */
+  { 4.611521f, 0.3261992f, 0.1114483f },          /* Hamming, x4 */
+  { 4.898032f, 0.1169482f, 0.01293787f },         /* Hamming, x8 */
+  { 3.155789f, 0.2849903f, 0.1280812f },          /* Blackman-Harris, x1 */
+  { 6.336579f, 0.5739688f, 0.2489758f },          /* Blackman-Harris, x2 */
+  { 7.671756f, 0.4610576f, 0.1230758f },          /* Blackman-Harris, x4 */
+  { 8.05115f, 0.151775f, 0.01244245f }            /* Blackman-Harris, x8 */
+};
+
+static const float32_t arm_spectral_peaks_quinn_f32[4][3] =
+{
+  { 1.000013f, -1.255032e-05f, 0.0f },            /* Rectangular */
+  { 1.568184f, 0.2789494f, 0.1764299f },          /* Hann */
+  { 1.382387f, 0.4453619f, 0.2026646f },          /* Hamming */
+  { 2.681818f, 0.5937122f, 0.37105f }             /* Blackman-Harris */
+};
+
+static const float32_t arm_spectral_peaks_amp_f32[16][3] =
+{
+  { 1.653443f, 1.686583f, 3.313128f },            /* Rectangular, x1 */
+  { 0.4112536f, 0.1178266f, 0.03469876f },        /* Rectangular, x2 */
+  { 0.1028081f, 0.007396675f, 0.0004955045f },    /* Rectangular, x4 */
+  { 0.025702f, 0.0004624083f, 7.57403e-06f },     /* Rectangular, x8 */
+  { 0.6449939f, 0.2476086f, 0.08778678f },        /* Hann, x1 */
+  { 0.1612337f, 0.01556529f, 0.001242936f },      /* Hann, x2 */
+  { 0.04030838f, 0.0009731495f, 1.895853e-05f },  /* Hann, x4 */
+  { 0.01007709f, 6.082306e-05f, 2.944579e-07f },  /* Hann, x8 */
+  { 0.7931993f, 0.363685f, 0.1520553f },          /* Hamming, x1 */
+  { 0.1982713f, 0.02290368f, 0.002127481f },      /* Hamming, x2 */
+  { 0.04956773f, 0.001432091f, 3.235632e-05f },   /* Hamming, x4 */
+  { 0.01239193f, 8.950803e-05f, 5.021842e-07f },  /* Hamming, x8 */
+  { 0.378686f, 0.0775909f, 0.01216555f },         /* Blackman-Harris, x1 */
+  { 0.09467062f, 0.004854817f, 0.0001822986f },   /* Blackman-Harris, x2 */
+  { 0.02366765f, 0.0003034463f, 2.818966e-06f },  /* Blackman-Harris, x4 */
+  { 0.005916913f, 1.896547e-05f, 4.393201e-08f }  /* Blackman-Harris, x8 */
+};
+
+/**
+ * @brief  Initialization function for the floating-point spectral peak detector.
+ * @param[in,out]   *S points to an instance of the floating-point spectral peak detector structure.
+ * @param[in]       numBins number of bins of the spectrum, at least 3.
+ * @param[in]       method interpolation method.
+ * @param[in]       window window applied to the data before the FFT.
+ * @param[in]       padFactor FFT length divided by the number of data samples: 1, 2, 4 or 8.
+ * @param[in]       threshold minimum magnitude of a peak.
+ * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * the combination of <code>method</code>, <code>window</code> and <code>padFactor</code> is not supported.
+ *
+ * \par
+ * The corrections are available for the rectangular, Hann, Hamming and Blackman-Harris windows.
+ * The Quinn estimator is only available without zero padding (<code>padFactor</code> = 1).
+ */
+
+arm_status arm_spectral_peaks_init_f32(
+  arm_spectral_peaks_instance_f32 * S,
+  uint16_t numBins,
+  arm_peak_interp method,
+  arm_window_type window,
+  uint16_t padFactor,
+  float32_t threshold)
+{
+  uint32_t padIdx;                               /* Index of the zero padding factor */
+  uint32_t idx;                                  /* Index of the corrections */
+
+  switch (padFactor)
+  {
+  case 1U:
+    padIdx = 0U;
+    break;
+  case 2U:
+    padIdx = 1U;
+    break;
+  case 4U:
+    padIdx = 2U;
+    break;
+  case 8U:
+    padIdx = 3U;
+    break;
+  default:
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if ((numBins < 3U) || ((uint32_t) window > (uint32_t) ARM_WINDOW_BLACKMAN_HARRIS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  idx = ((uint32_t) window * 4U) + padIdx;
+
+  switch (method)
+  {
+  case ARM_PEAK_INTERP_PARABOLIC:
+    S->pFreqCoeffs = arm_spectral_peaks_parabolic_f32[idx];
+    break;
+  case ARM_PEAK_INTERP_JACOBSEN:
+    S->pFreqCoeffs = arm_spectral_peaks_jacobsen_f32[idx];
+    break;
+  case ARM_PEAK_INTERP_QUINN:
+    if (padIdx != 0U)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+    S->pFreqCoeffs = arm_spectral_peaks_quinn_f32[window];
+    break;
+  default:
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numBins = numBins;
+  S->method = method;
+  S->threshold = threshold;
+  S->pAmpCoeffs = arm_spectral_peaks_amp_f32[idx];
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of spectral_peaks group
+ */
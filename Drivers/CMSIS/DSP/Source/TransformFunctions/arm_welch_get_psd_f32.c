@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_welch_get_psd_f32.c
+ * Description:  Power spectral density of the Welch estimator
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include <math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup WelchPSD
+ * @{
+ */
+
+/**
+ * @brief  One-sided power spectral density of the Welch estimator.
+ * @param[in,out]   *S points to an instance of the floating-point Welch estimator structure.
+ * @param[out]      *pDst points to the density, <code>fftLen / 2 + 1</code> values, in squared input units per Hz.
+ * @return number of segments averaged.  When it is 0, the density is set to 0.
+ *
+ * \par
+ * In linear mode the accumulators are cleared and the next segments start a new mean.  The samples
+ * of the current segment are kept.
+ */
+
+uint32_t arm_welch_get_psd_f32(
+  arm_welch_instance_f32 * S,
+  float32_t * pDst)
+{
+  float32_t scale;                               /* Normalization of the accumulators */
+  uint32_t numBins = ((uint32_t) S->fftLen / 2U) + 1U;  /* Number of bins */
+  uint32_t numSegments = S->numSegments;         /* Number of segments averaged */
+
+  if (numSegments == 0U)
+  {
+    arm_fill_f32(0.0f, pDst, numBins);
+    return (0U);
+  }
+
+  /* x = acc * 2^(accExp - 31) */
+  arm_q31_to_float(S->pAcc, pDst, numBins);
+
+  scale = ldexpf(S->scale, S->accExp);
+  if (S->averaging == ARM_WELCH_LINEAR)
+  {
+    scale /= (float32_t) numSegments;
+
+    /* Start a new mean */
+    arm_fill_q31(0, S->pAcc, numBins);
+    S->numSegments = 0U;
+    S->accBound = 0.0f;
+  }
+
+  /* One-sided density: the bins other than DC and Nyquist hold the power of the negative frequencies */
+  pDst[0] *= scale;
+  arm_scale_f32(pDst + 1U, 2.0f * scale, pDst + 1U, numBins - 2U);
+  pDst[numBins - 1U] *= scale;
+
+  return (numSegments);
+}
+
+/**
+ * @} end of WelchPSD group
+ */
@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_welch_init_f32.c
+ * Description:  Initialization function for the Welch power spectral density estimator
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup WelchPSD
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Welch power spectral density estimator.
+ * @param[in,out]   *S points to an instance of the floating-point Welch estimator structure.
+ * @param[in]       *pWindow points to an initialized window instance, of a length supported by arm_rfft_fast_f32().
+ * @param[in]       hopSize number of new samples per segment, from 1 to the length of the window.
+ * @param[in]       averaging averaging mode.
+ * @param[in]       alpha weight of a new segment of the exponential mean, in (0 1].  Ignored by the linear mode.
+ * @param[in]       sampleRate sample rate of the input, in Hz.
+ * @param[in]       *pState points to the state buffer, <code>3 * fftLen</code> values.
+ * @param[in]       *pAcc points to the accumulators, <code>fftLen / 2 + 1</code> values.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an argument is out of range.
+ *
+ * \par
+ * The length of the segments <code>fftLen</code> is the length of the window.  The overlap of two segments
+ * is <code>fftLen - hopSize</code> samples: a hop size of <code>fftLen / 2</code> gives the usual 50% overlap.
+ * The window instance is not copied and must remain valid.
+ */
+
+arm_status arm_welch_init_f32(
+  arm_welch_instance_f32 * S,
+  const arm_window_instance_f32 * pWindow,
+  uint16_t hopSize,
+  arm_welch_averaging averaging,
+  float32_t alpha,
+  float32_t sampleRate,
+  float32_t * pState,
+  q31_t * pAcc)
+{
+  float32_t sumSq;                               /* Sum of the squared window coefficients */
+  uint16_t fftLen = pWindow->length;             /* Length of the segments */
+
+  if ((hopSize == 0U) || (hopSize > fftLen) || (sampleRate <= 0.0f) ||
+      ((averaging == ARM_WELCH_EXPONENTIAL) && ((alpha <= 0.0f) || (alpha > 1.0f))))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if (arm_rfft_fast_init_f32(&S->rfft, fftLen) != ARM_MATH_SUCCESS)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* sum(w^2) = N * ENBW * CG^2 */
+  sumSq = (float32_t) fftLen * pWindow->enbw * (pWindow->coherentGain * pWindow->coherentGain);
+
+  S->pWindow = pWindow;
+  S->fftLen = fftLen;
+  S->hopSize = hopSize;
+  S->fill = 0U;
+  S->averaging = averaging;
+  S->alpha = (alpha >= 1.0f) ? 0x7FFFFFFF : (q31_t) (alpha * 2147483648.0f);
+  S->numSegments = 0U;
+  S->accExp = 0;
+  S->accBound = 0.0f;
+  S->scale = 1.0f / (sampleRate * sumSq);
+  S->pState = pState;
+  S->pAcc = pAcc;
+
+  /* Clear the accumulators */
+  arm_fill_q31(0, pAcc, ((uint32_t) fftLen / 2U) + 1U);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of WelchPSD group
+ */
@@ -0,0 +1,203 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_welch_process_f32.c
+ * Description:  Welch power spectral density estimation of floating-point data
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include <math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup WelchPSD Welch Power Spectral Density
+ *
+ * Estimates the power spectral density of a stream with the method of Welch: the stream
+ * is cut into overlapping segments, each segment is windowed and transformed, and the
+ * squared magnitudes of the spectra are averaged.
+ *
+ * \par
+ * The samples are added in blocks of any length, such as the half-buffers of a DMA transfer,
+ * with arm_welch_process_f32() or arm_welch_process_q15().  Each time <code>fftLen</code>
+ * samples are available, a segment is processed; the last <code>fftLen - hopSize</code>
+ * samples are kept for the next segment.  The estimate is read at any time with
+ * arm_welch_get_psd_f32().
+ *
+ * \par Averaging
+ * - <code>ARM_WELCH_LINEAR</code>: the estimate is the mean of the segments processed since the
+ * previous call to arm_welch_get_psd_f32(), which then starts a new mean.
+ * - <code>ARM_WELCH_EXPONENTIAL</code>: each segment updates the mean with the weight
+ * <code>alpha</code>, <code>P = P + alpha * (Pk - P)</code>.  The first segment initializes
+ * the mean.  Reading the estimate does not change it.
+ *
+ * \par Units
+ * The estimate is the one-sided density <code>2 |X[k]|^2 / (fs * sum(w[n]^2))</code>, in squared
+ * input units per Hz: the sum of <code>pDst[k] * fs / fftLen</code> over all the bins is the mean
+ * power of the input.  Bin 0 and bin <code>fftLen / 2</code> are not doubled.  The Q15 samples are
+ * in units of the full scale: a full scale sine wave has a power of 0.5.
+ *
+ * \par Accumulators
+ * The accumulators are Q31 values sharing a block exponent.  The exponent follows the largest
+ * accumulator: it grows before a segment could overflow them and, in exponential mode,
+ * decreases when the mean decays, so that the largest bin keeps its full precision.  The sum of
+ * many segments keeps 31 bits instead of the 24 bits of a floating-point accumulator, at the
+ * cost of a dynamic range of about 90 dB below the largest bin of the estimate.
+ *
+ * \par
+ * The state buffer holds the segment, the windowed segment and the spectrum, <code>3 * fftLen</code>
+ * values.  The accumulators use <code>fftLen / 2 + 1</code> values.
+ */
+
+/**
+ * @addtogroup WelchPSD
+ * @{
+ */
+
+/**
+ * @brief  Processes the full segment of a Welch estimator.
+ * @param[in,out]   *S points to an instance of the floating-point Welch estimator structure.
+ * @return none.
+ */
+
+void arm_welch_segment_f32(
+  arm_welch_instance_f32 * S)
+{
+  float32_t *pSeg = S->pState;                   /* Segment */
+  float32_t *pWin = pSeg + S->fftLen;            /* Windowed segment, then periodogram */
+  float32_t *pSpec = pWin + S->fftLen;           /* Spectrum, then periodogram in Q31 */
+  q31_t *pAcc = S->pAcc;                         /* Accumulators */
+  q31_t maxAcc;                                  /* Largest accumulator */
+  float32_t maxVal;                              /* Largest bin of the periodogram */
+  float32_t bound;                               /* Upper bound of the accumulators */
+  uint32_t numBins = ((uint32_t) S->fftLen / 2U) + 1U;  /* Number of bins */
+  uint32_t index;                                /* Index of the largest bin */
+  int32_t shift;                                 /* Shift of the accumulators */
+  int exponent;                                  /* Exponent of the bound */
+
+  arm_window_apply_f32(S->pWindow, pSeg, pWin);
+
+  /* Keep the overlap for the next segment */
+  S->fill = S->fftLen - S->hopSize;
+  arm_copy_f32(pSeg + S->hopSize, pSeg, S->fill);
+
+  /* Periodogram, bin 0 and bin N/2 are packed in the first complex value */
+  arm_rfft_fast_f32(&S->rfft, pWin, pSpec, 0U);
+  pWin[0] = pSpec[0] * pSpec[0];
+  pWin[numBins - 1U] = pSpec[1] * pSpec[1];
+  arm_cmplx_mag_squared_f32(pSpec + 2U, pWin + 1U, numBins - 2U);
+
+  arm_max_f32(pWin, numBins, &maxVal, &index);
+
+  /* Bound of the accumulators and of the periodogram during the update */
+  if ((S->averaging == ARM_WELCH_LINEAR) || (S->numSegments == 0U))
+  {
+    bound = S->accBound + maxVal;
+  }
+  else
+  {
+    bound = (maxVal > S->accBound) ? maxVal : S->accBound;
+  }
+
+  /* Move the block exponent to the bound */
+  if (bound > 0.0f)
+  {
+    (void) frexpf(bound, &exponent);
+
+    shift = S->accExp - (int32_t) exponent;
+    if (shift < -31)
+    {
+      arm_fill_q31(0, pAcc, numBins);
+    }
+    else if (shift != 0)
+    {
+      shift = (shift > 31) ? 31 : shift;
+      arm_shift_q31(pAcc, (int8_t) shift, pAcc, numBins);
+    }
+    S->accExp -= shift;
+  }
+
+  /* Periodogram in the format of the accumulators */
+  arm_scale_f32(pWin, ldexpf(1.0f, -S->accExp), pWin, numBins);
+  arm_float_to_q31(pWin, (q31_t *) pSpec, numBins);
+
+  if ((S->averaging == ARM_WELCH_LINEAR) || (S->numSegments == 0U))
+  {
+    arm_add_q31(pAcc, (q31_t *) pSpec, pAcc, numBins);
+  }
+  else
+  {
+    /* acc = acc + alpha * (P - acc), P and acc are positive */
+    arm_sub_q31((q31_t *) pSpec, pAcc, (q31_t *) pSpec, numBins);
+    arm_scale_q31((q31_t *) pSpec, S->alpha, 0, (q31_t *) pSpec, numBins);
+    arm_add_q31(pAcc, (q31_t *) pSpec, pAcc, numBins);
+  }
+
+  /* The largest accumulator is a tighter bound for the next segment */
+  arm_max_q31(pAcc, numBins, &maxAcc, &index);
+  S->accBound = ldexpf((float32_t) maxAcc + 1.0f, S->accExp - 31);
+
+  S->numSegments++;
+}
+
+/**
+ * @brief  Adds a block of floating-point samples to the Welch power spectral density estimator.
+ * @param[in,out]   *S points to an instance of the floating-point Welch estimator structure.
+ * @param[in]       *pSrc points to the block of input data.
+ * @param[in]       blockSize number of samples to process.
+ * @return number of segments averaged since the last estimate, in linear mode, or since the
+ * initialization, in exponential mode.
+ */
+
+uint32_t arm_welch_process_f32(
+  arm_welch_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  uint32_t n;                                    /* Number of samples copied to the segment */
+
+  while (blockSize > 0U)
+  {
+    n = (uint32_t) S->fftLen - S->fill;
+    n = (n < blockSize) ? n : blockSize;
+
+    arm_copy_f32(pSrc, S->pState + S->fill, n);
+    S->fill += (uint16_t) n;
+    pSrc += n;
+    blockSize -= n;
+
+    if (S->fill == S->fftLen)
+    {
+      arm_welch_segment_f32(S);
+    }
+  }
+
+  return (S->numSegments);
+}
+
+/**
+ * @} end of WelchPSD group
+ */
@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_welch_process_q15.c
+ * Description:  Welch power spectral density estimation of Q15 data
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_welch_segment_f32(
+  arm_welch_instance_f32 * S);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup WelchPSD
+ * @{
+ */
+
+/**
+ * @brief  Adds a block of Q15 samples to the Welch power spectral density estimator.
+ * @param[in,out]   *S points to an instance of the floating-point Welch estimator structure.
+ * @param[in]       *pSrc points to the block of input data.
+ * @param[in]       blockSize number of samples to process.
+ * @return number of segments averaged since the last estimate, in linear mode, or since the
+ * initialization, in exponential mode.
+ *
+ * \par
+ * The samples are converted to floating-point in units of the full scale as they are copied to the segment.
+ */
+
+uint32_t arm_welch_process_q15(
+  arm_welch_instance_f32 * S,
+  q15_t * pSrc,
+  uint32_t blockSize)
+{
+  uint32_t n;                                    /* Number of samples copied to the segment */
+
+  while (blockSize > 0U)
+  {
+    n = (uint32_t) S->fftLen - S->fill;
+    n = (n < blockSize) ? n : blockSize;
+
+    arm_q15_to_float(pSrc, S->pState + S->fill, n);
+    S->fill += (uint16_t) n;
+    pSrc += n;
+    blockSize -= n;
+
+    if (S->fill == S->fftLen)
+    {
+      arm_welch_segment_f32(S);
+    }
+  }
+
+  return (S->numSegments);
+}
+
+/**
+ * @} end of WelchPSD group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_window_apply_f32.c
+ * Description:  Multiplication of a floating-point frame by a window
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup window
+ * @{
+ */
+
+/**
+ * @brief  Multiplies samples by coefficients read forward or backward.
+ * @param[in]       *pW points to the first coefficient
+ * @param[in]       step increment between two coefficients, 1 or -1
+ * @param[in]       *pSrc points to the input samples
+ * @param[out]      *pDst points to the output samples
+ * @param[in]       blockSize number of samples
+ * @return none.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_window_mult_f32(
+  const float32_t * pW,
+  int32_t step,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = A * W */
+    pDst[0] = pSrc[0] * pW[0];
+    pDst[1] = pSrc[1] * pW[step];
+    pDst[2] = pSrc[2] * pW[2 * step];
+    pDst[3] = pSrc[3] * pW[3 * step];
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 4U;
+    pW += 4 * step;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * W */
+    *pDst++ = *pSrc * *pW;
+
+    pSrc++;
+    pW += step;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @brief  Multiplies a floating-point frame by a window.
+ * @param[in]       *S points to an instance of the floating-point window structure.
+ * @param[in]       *pSrc points to the input frame, <code>S->length</code> samples.
+ * @param[out]      *pDst points to the output frame, <code>S->length</code> samples.
+ * @return none.
+ *
+ * \par
+ * The operation can be done in place.
+ */
+
+void arm_window_apply_f32(
+  const arm_window_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst)
+{
+  uint32_t halfLength = S->halfLength;           /* Number of coefficients */
+  uint32_t tailLength = (uint32_t) S->length - halfLength;  /* Number of mirrored coefficients */
+
+  /* First half, w[0] to w[halfLength - 1] */
+  arm_window_mult_f32(S->pCoeffs, 1, pSrc, pDst, halfLength);
+
+  /* Second half, w[N - n] for a periodic window or w[N - 1 - n] for a symmetric window */
+  arm_window_mult_f32(S->pCoeffs + ((S->periodic != 0U) ? tailLength : (tailLength - 1U)), -1,
+                     pSrc + halfLength, pDst + halfLength, tailLength);
+}
+
+/**
+ * @} end of window group
+ */
@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_window_generate_q31.c
+ * Description:  Generation of a Q31 window
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup window
+ * @{
+ */
+
+/**
+ * @brief  Computes the first half of a Q31 window.
+ * @param[in]       type window function
+ * @param[in]       beta shape parameter of the Kaiser window, ignored by the other windows
+ * @param[in]       length length of the window, at least 2
+ * @param[in]       periodic 1 for a periodic window, 0 for a symmetric window
+ * @param[out]      *pCoeffs points to the coefficients, <code>length / 2 + 1</code> values when periodic, <code>(length + 1) / 2</code> otherwise
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>length</code> is less than 2 or
+ * <code>type</code> is not a window.
+ */
+
+arm_status arm_window_generate_q31(
+  arm_window_type type,
+  float32_t beta,
+  uint16_t length,
+  uint8_t periodic,
+  q31_t * pCoeffs)
+{
+  float32_t value;                               /* Floating-point coefficient */
+  float32_t step;                                /* Distance between two coefficients */
+  uint32_t halfLength;                           /* Number of coefficients */
+  uint32_t n;                                    /* Loop counter */
+
+  if ((length < 2U) || ((uint32_t) type > (uint32_t) ARM_WINDOW_KAISER))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if (periodic != 0U)
+  {
+    /* w[n] = w(n / N), n = 0 to N / 2 */
+    halfLength = ((uint32_t) length / 2U) + 1U;
+    step = 1.0f / (float32_t) length;
+  }
+  else
+  {
+    /* w[n] = w(n / (N - 1)), n = 0 to (N - 1) / 2 */
+    halfLength = ((uint32_t) length + 1U) / 2U;
+    step = 1.0f / (float32_t) (length - 1U);
+  }
+
+  for (n = 0U; n < halfLength; n++)
+  {
+    /* Convert to 1.31, 1.0 saturates to 0x7FFFFFFF */
+    value = arm_window_value_f32(type, beta, (float32_t) n * step);
+    *pCoeffs++ = clip_q63_to_q31((q63_t) (value * 2147483648.0f));
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of window group
+ */
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_window_init_f32.c
+ * Description:  Initialization function for the floating-point window
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup window
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point window.
+ * @param[in,out]   *S points to an instance of the floating-point window structure.
+ * @param[in]       length length of the window, at least 2.
+ * @param[in]       periodic 1 for a periodic window, 0 for a symmetric window.
+ * @param[in]       *pCoeffs points to the first half of the window, <code>length / 2 + 1</code> values when periodic, <code>(length + 1) / 2</code> otherwise.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>length</code> is less than 2.
+ *
+ * \par
+ * The coefficients are not copied: <code>pCoeffs</code> can point to a constant table.
+ * The coherent gain and the equivalent noise bandwidth of the window are computed from them.
+ */
+
+arm_status arm_window_init_f32(
+  arm_window_instance_f32 * S,
+  uint16_t length,
+  uint8_t periodic,
+  const float32_t * pCoeffs)
+{
+  float32_t w;                                   /* Coefficient */
+  float32_t m;                                   /* Number of occurrences of the coefficient */
+  float32_t sum = 0.0f;                          /* Sum of the coefficients */
+  float32_t sumSq = 0.0f;                        /* Sum of the squared coefficients */
+  uint32_t halfLength;                           /* Number of coefficients */
+  uint32_t first, last;                          /* Range of the coefficients used twice */
+  uint32_t i;                                    /* Loop counter */
+
+  if (length < 2U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  halfLength = (periodic != 0U) ? (((uint32_t) length / 2U) + 1U) : (((uint32_t) length + 1U) / 2U);
+
+  /* The second half of the window mirrors the coefficients first to last - 1 */
+  first = (periodic != 0U) ? 1U : 0U;
+  last = first + ((uint32_t) length - halfLength);
+
+  for (i = 0U; i < halfLength; i++)
+  {
+    w = pCoeffs[i];
+    m = ((i >= first) && (i < last)) ? 2.0f : 1.0f;
+
+    sum += m * w;
+    sumSq += m * (w * w);
+  }
+
+  S->length = length;
+  S->halfLength = (uint16_t) halfLength;
+  S->periodic = periodic;
+  S->pCoeffs = pCoeffs;
+  S->coherentGain = sum / (float32_t) length;
+  S->enbw = (sum != 0.0f) ? (((float32_t) length * sumSq) / (sum * sum)) : 0.0f;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of window group
+ */
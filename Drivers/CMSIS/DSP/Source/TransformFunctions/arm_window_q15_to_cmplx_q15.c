@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_window_q15_to_cmplx_q15.c
+ * Description:  Multiplication of a real Q15 frame by a window with conversion to complex
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup window
+ * @{
+ */
+
+/**
+ * @brief  Multiplies real samples by coefficients read forward or backward and writes them as complex samples.
+ * @param[in]       *pW points to the first coefficient
+ * @param[in]       step increment between two coefficients, 1 or -1
+ * @param[in]       *pSrc points to the input samples
+ * @param[out]      *pDst points to the output complex samples
+ * @param[in]       blockSize number of samples
+ * @return none.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_window_mult_q15_to_cmplx(
+  const q15_t * pW,
+  int32_t step,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* Re{C} = A * W, Im{C} = 0 */
+    pDst[0] = (q15_t) (((q31_t) pSrc[0] * pW[0]) >> 15);
+    pDst[1] = 0;
+    pDst[2] = (q15_t) (((q31_t) pSrc[1] * pW[step]) >> 15);
+    pDst[3] = 0;
+    pDst[4] = (q15_t) (((q31_t) pSrc[2] * pW[2 * step]) >> 15);
+    pDst[5] = 0;
+    pDst[6] = (q15_t) (((q31_t) pSrc[3] * pW[3 * step]) >> 15);
+    pDst[7] = 0;
+
+    /* Update the pointers to process the next samples */
+    pSrc += 4U;
+    pDst += 8U;
+    pW += 4 * step;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* Re{C} = A * W, Im{C} = 0 */
+    *pDst++ = (q15_t) (((q31_t) *pSrc * *pW) >> 15);
+    *pDst++ = 0;
+
+    pSrc++;
+    pW += step;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @brief  Multiplies a real Q15 frame by a window and converts it to complex.
+ * @param[in]       *S points to an instance of the Q15 window structure.
+ * @param[in]       *pSrc points to the input frame, <code>S->length</code> samples.
+ * @param[out]      *pDst points to the output frame, <code>S->length</code> complex samples.
+ * @return none.
+ *
+ * \par
+ * The output is the input of arm_cfft_q15() for a frame of <code>S->length</code> real samples:
+ * interleaved real and imaginary parts, with imaginary parts set to 0.  The operation cannot be
+ * done in place.
+ */
+
+void arm_window_q15_to_cmplx_q15(
+  const arm_window_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst)
+{
+  uint32_t halfLength = S->halfLength;           /* Number of coefficients */
+  uint32_t tailLength = (uint32_t) S->length - halfLength;  /* Number of mirrored coefficients */
+
+  /* First half, w[0] to w[halfLength - 1] */
+  arm_window_mult_q15_to_cmplx(S->pCoeffs, 1, pSrc, pDst, halfLength);
+
+  /* Second half, w[N - n] for a periodic window or w[N - 1 - n] for a symmetric window */
+  arm_window_mult_q15_to_cmplx(S->pCoeffs + ((S->periodic != 0U) ? tailLength : (tailLength - 1U)), -1,
+                               pSrc + halfLength, pDst + (2U * halfLength), tailLength);
+}
+
+/**
+ * @} end of window group
+ */
@@ -0,0 +1,174 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_window_value_f32.c
+ * Description:  Value of a window function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup window Window Functions
+ *
+ * Generation and application of the usual windows of spectral analysis and filter design.
+ *
+ * \par
+ * The windows are defined for a position <code>x</code> from 0 to 1:
+ * <pre>
+ *     Rectangular     w(x) = 1
+ *     Hann            w(x) = 0.5 - 0.5 cos(2 pi x)
+ *     Hamming         w(x) = 0.54 - 0.46 cos(2 pi x)
+ *     Blackman-Harris w(x) = 0.35875 - 0.48829 cos(2 pi x) + 0.14128 cos(4 pi x) - 0.01168 cos(6 pi x)
+ *     Flat top        w(x) = 0.21557895 - 0.41663158 cos(2 pi x) + 0.277263158 cos(4 pi x)
+ *                            - 0.083578947 cos(6 pi x) + 0.006947368 cos(8 pi x)
+ *     Kaiser          w(x) = I0(beta sqrt(1 - (2x - 1)^2)) / I0(beta)
+ * </pre>
+ * where I0 is the modified Bessel function of the first kind of order 0.  The Kaiser window
+ * trades the width of the main lobe for the level of the sidelobes: beta = 0 is the
+ * rectangular window and beta = 8.6 has sidelobes at about -63 dB.
+ *
+ * \par
+ * A window of length <code>N</code> samples is either:
+ * - periodic, <code>w[n] = w(n / N)</code>: the window for spectral analysis, whose DFT has
+ * exactly three nonzero bins for the Hann window.
+ * - symmetric, <code>w[n] = w(n / (N - 1))</code>: the window for the design of FIR filters.
+ *
+ * \par
+ * Both are symmetric around their center, so only the first half is stored:
+ * <code>N / 2 + 1</code> coefficients for a periodic window and <code>(N + 1) / 2</code>
+ * coefficients for a symmetric window.  The half can be computed at startup with
+ * arm_window_generate_f32(), arm_window_generate_q31() or arm_window_generate_q15(),
+ * or placed in a constant table.
+ *
+ * \par
+ * The initialization functions also compute the coherent gain of the window, the mean of
+ * the coefficients, and its equivalent noise bandwidth in bins,
+ * <code>N * sum(w[n]^2) / sum(w[n])^2</code>.  A sine wave of amplitude <code>A</code> in a bin
+ * of the DFT of the windowed frame has a magnitude of <code>A * N * coherentGain / 2</code>,
+ * and white noise has a power of <code>enbw</code> bins in each bin.
+ * For large <code>N</code>:
+ * <pre>
+ *     Window             coherentGain   enbw
+ *     Rectangular        1.0            1.0
+ *     Hann               0.5            1.5
+ *     Hamming            0.54           1.363
+ *     Blackman-Harris    0.35875        2.004
+ *     Flat top           0.2156         3.770
+ *     Kaiser, beta = 8.6 0.4208         1.721
+ * </pre>
+ *
+ * \par Fixed-Point Behavior
+ * The Q31 and Q15 windows are computed in floating-point and rounded.  The flat top window
+ * reaches 1.0 at its center, which is saturated to the largest positive value.
+ */
+
+/**
+ * @addtogroup window
+ * @{
+ */
+
+/**
+ * @brief  Modified Bessel function of the first kind of order 0.
+ * @param[in]       x input value
+ * @return I0(x).
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_window_bessel_i0_f32(
+  float32_t x)
+{
+  float32_t sum = 1.0f;                          /* Sum of the series */
+  float32_t term = 1.0f;                         /* Current term, ((x / 2)^k / k!)^2 */
+  float32_t h;                                   /* x / (2k) */
+  uint32_t k = 1U;                               /* Loop counter */
+
+  /* The terms decrease after k = x / 2 and stop mattering in single precision */
+  do
+  {
+    h = x / (2.0f * (float32_t) k);
+    term *= h * h;
+    sum += term;
+    k++;
+  } while ((term > (sum * 1.0e-8f)) && (k < 100U));
+
+  return (sum);
+}
+
+/**
+ * @brief  Value of a window function.
+ * @param[in]       type window function
+ * @param[in]       beta shape parameter of the Kaiser window, ignored by the other windows
+ * @param[in]       x position in the window, from 0 to 1
+ * @return value of the window at <code>x</code>, 0 for an unknown window.
+ */
+
+float32_t arm_window_value_f32(
+  arm_window_type type,
+  float32_t beta,
+  float32_t x)
+{
+  float32_t c1, c2, c3, c4;                      /* Cosines of the multiples of 2 pi x */
+  float32_t r;                                   /* Position from the center, from -1 to 1 */
+
+  c1 = cosf(2.0f * PI * x);
+
+  switch (type)
+  {
+  case ARM_WINDOW_RECTANGULAR:
+    return (1.0f);
+
+  case ARM_WINDOW_HANN:
+    return (0.5f - (0.5f * c1));
+
+  case ARM_WINDOW_HAMMING:
+    return (0.54f - (0.46f * c1));
+
+  case ARM_WINDOW_BLACKMAN_HARRIS:
+    /* cos(2a) and cos(3a) from the Chebyshev recurrence */
+    c2 = (2.0f * c1 * c1) - 1.0f;
+    c3 = (2.0f * c1 * c2) - c1;
+    return (0.35875f - (0.48829f * c1) + (0.14128f * c2) - (0.01168f * c3));
+
+  case ARM_WINDOW_FLAT_TOP:
+    c2 = (2.0f * c1 * c1) - 1.0f;
+    c3 = (2.0f * c1 * c2) - c1;
+    c4 = (2.0f * c1 * c3) - c2;
+    return (0.21557895f - (0.41663158f * c1) + (0.277263158f * c2) - (0.083578947f * c3) + (0.006947368f * c4));
+
+  case ARM_WINDOW_KAISER:
+    r = (2.0f * x) - 1.0f;
+    r = 1.0f - (r * r);
+    r = (r > 0.0f) ? sqrtf(r) : 0.0f;
+    return (arm_window_bessel_i0_f32(beta * r) / arm_window_bessel_i0_f32(beta));
+
+  default:
+    return (0.0f);
+  }
+}
+
+/**
+ * @} end of window group
+ */